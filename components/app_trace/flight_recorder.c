@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "esp_flight_recorder.h"
+#include "sdkconfig.h"
+
+#define FLIGHT_REC_MAGIC 0x464C5243 // "FLRC", located by espcoredump.py
+
+typedef struct {
+    uint32_t ts_us;     // microseconds since boot, truncated
+    uint8_t type;       // esp_flight_rec_event_type_t
+    uint8_t core;
+    uint16_t id;
+    uint32_t arg;
+} flight_rec_event_t;
+
+#define FLIGHT_REC_EVENT_COUNT \
+    (CONFIG_APPTRACE_FLIGHT_RECORDER_BUFFER_SIZE / sizeof(flight_rec_event_t))
+
+typedef struct {
+    uint32_t magic;
+    uint32_t event_size;
+    uint32_t event_count;
+    volatile uint32_t next;     // monotonically increasing event sequence number
+    volatile uint32_t frozen;
+} flight_rec_ctl_t;
+
+// Both structures live in the .dram2.coredump section, so they are embedded
+// into every core dump
+static COREDUMP_DRAM_ATTR flight_rec_ctl_t s_ctl = {
+    .magic = FLIGHT_REC_MAGIC,
+    .event_size = sizeof(flight_rec_event_t),
+    .event_count = FLIGHT_REC_EVENT_COUNT,
+};
+static COREDUMP_DRAM_ATTR flight_rec_event_t s_events[FLIGHT_REC_EVENT_COUNT];
+
+// Multi-producer, no consumer until frozen: a slot is claimed with one atomic
+// increment, then filled without further synchronization. A reader only ever
+// looks at the buffer while recording is frozen.
+static inline void s_record(uint8_t type, uint16_t id, uint32_t arg)
+{
+    if (s_ctl.frozen) {
+        return;
+    }
+    uint32_t seq = __atomic_fetch_add((uint32_t*) &s_ctl.next, 1, __ATOMIC_RELAXED);
+    flight_rec_event_t* ev = &s_events[seq % FLIGHT_REC_EVENT_COUNT];
+    ev->ts_us = (uint32_t) esp_timer_get_time();
+    ev->type = type;
+    ev->core = (uint8_t) esp_cpu_get_core_id();
+    ev->id = id;
+    ev->arg = arg;
+}
+
+void esp_flight_rec_task_switched_in(void)
+{
+    s_record(ESP_FLIGHT_REC_EV_TASK_IN, 0, (uint32_t) (uintptr_t) xTaskGetCurrentTaskHandle());
+}
+
+void esp_flight_rec_task_switched_out(void)
+{
+    s_record(ESP_FLIGHT_REC_EV_TASK_OUT, 0, (uint32_t) (uintptr_t) xTaskGetCurrentTaskHandle());
+}
+
+void esp_flight_rec_isr_enter(uint32_t intr_num)
+{
+    s_record(ESP_FLIGHT_REC_EV_ISR_IN, (uint16_t) intr_num, 0);
+}
+
+void esp_flight_rec_isr_exit(void)
+{
+    s_record(ESP_FLIGHT_REC_EV_ISR_OUT, 0, 0);
+}
+
+void esp_flight_rec_marker(uint16_t id, uint32_t value)
+{
+    s_record(ESP_FLIGHT_REC_EV_MARKER, id, value);
+}
+
+void esp_flight_rec_freeze(void)
+{
+    s_ctl.frozen = 1;
+}
+
+void esp_flight_rec_unfreeze(void)
+{
+    s_ctl.frozen = 0;
+}
+
+esp_err_t esp_flight_rec_dump(FILE* stream)
+{
+    static const char* type_names[] = {
+        [ESP_FLIGHT_REC_EV_TASK_IN] = "task_in",
+        [ESP_FLIGHT_REC_EV_TASK_OUT] = "task_out",
+        [ESP_FLIGHT_REC_EV_ISR_IN] = "isr_in",
+        [ESP_FLIGHT_REC_EV_ISR_OUT] = "isr_out",
+        [ESP_FLIGHT_REC_EV_MARKER] = "marker",
+    };
+    if (stream == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint32_t was_frozen = s_ctl.frozen;
+    s_ctl.frozen = 1;
+    uint32_t total = s_ctl.next;
+    uint32_t start = (total > FLIGHT_REC_EVENT_COUNT) ? total - FLIGHT_REC_EVENT_COUNT : 0;
+    fprintf(stream, "flight recorder: %" PRIu32 " events recorded, showing %" PRIu32 "\n",
+            total, total - start);
+    for (uint32_t seq = start; seq < total; ++seq) {
+        const flight_rec_event_t* ev = &s_events[seq % FLIGHT_REC_EVENT_COUNT];
+        const char* name = (ev->type >= ESP_FLIGHT_REC_EV_TASK_IN && ev->type <= ESP_FLIGHT_REC_EV_MARKER)
+                           ? type_names[ev->type] : "?";
+        fprintf(stream, "%10" PRIu32 "us core%d %-8s id=%u arg=0x%08" PRIx32 "\n",
+                ev->ts_us, ev->core, name, ev->id, ev->arg);
+    }
+    s_ctl.frozen = was_frozen;
+    return ESP_OK;
+}
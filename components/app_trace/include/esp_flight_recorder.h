@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * Always-on flight recorder.
+ *
+ * Continuously records scheduler events (task switches, ISR enter/exit) and
+ * user markers into a circular RAM buffer. The buffer and its control block
+ * live in the .dram2.coredump section, so espcoredump embeds the last
+ * moments of scheduling history into every core dump; espcoredump.py can
+ * extract them from a field failure without any host connection at the time
+ * of the crash.
+ *
+ * The scheduler hooks are installed through the FreeRTOS trace macros when
+ * CONFIG_APPTRACE_FLIGHT_RECORDER_ENABLE is set and the macros are not
+ * already claimed by SystemView.
+ *
+ * Note: this header is included from FreeRTOSConfig.h and must not pull in
+ * FreeRTOS headers.
+ */
+
+/**
+ * @brief Event types stored in the flight recorder buffer
+ */
+typedef enum {
+    ESP_FLIGHT_REC_EV_TASK_IN = 1,  /*!< task switched in; arg is the task handle */
+    ESP_FLIGHT_REC_EV_TASK_OUT,     /*!< task switched out; arg is the task handle */
+    ESP_FLIGHT_REC_EV_ISR_IN,       /*!< interrupt entry; id is the interrupt number */
+    ESP_FLIGHT_REC_EV_ISR_OUT,      /*!< interrupt exit */
+    ESP_FLIGHT_REC_EV_MARKER,       /*!< user marker; id and arg are caller-defined */
+} esp_flight_rec_event_type_t;
+
+/** @cond **/
+/* Scheduler hooks, wired to the FreeRTOS trace macros in FreeRTOSConfig.h */
+void esp_flight_rec_task_switched_in(void);
+void esp_flight_rec_task_switched_out(void);
+void esp_flight_rec_isr_enter(uint32_t intr_num);
+void esp_flight_rec_isr_exit(void);
+/** @endcond **/
+
+/**
+ * @brief Record a user marker
+ *
+ * Safe to call from any context, including ISRs. Costs one atomic increment
+ * and a 12-byte store.
+ *
+ * @param id     caller-defined marker identifier
+ * @param value  caller-defined payload
+ */
+void esp_flight_rec_marker(uint16_t id, uint32_t value);
+
+/**
+ * @brief Stop recording, keeping the current buffer contents
+ *
+ * Recording stops automatically for core dumps; use this to preserve the
+ * history around an event of interest for a live esp_flight_rec_dump().
+ */
+void esp_flight_rec_freeze(void);
+
+/**
+ * @brief Resume recording after esp_flight_rec_freeze()
+ */
+void esp_flight_rec_unfreeze(void);
+
+/**
+ * @brief Print the recorded events, oldest first, to a stream
+ *
+ * Recording is frozen for the duration of the dump.
+ *
+ * @param stream  stream obtained using fopen or fdopen, or stdout
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if stream is NULL
+ */
+esp_err_t esp_flight_rec_dump(FILE* stream);
+
+#ifdef __cplusplus
+}
+#endif
@@ -34,6 +34,13 @@
 
 #define SUB_TYPE_ID(i) (i & 0x0F)
 
+/* The incremental digest cannot cover an appended signature block, so it is only
+   compiled in when app images are not signed */
+#if CONFIG_APP_UPDATE_INCREMENTAL_OTA_VERIFY && !CONFIG_SECURE_BOOT && !CONFIG_SECURE_SIGNED_APPS_NO_SECURE_BOOT
+#define OTA_INCREMENTAL_VERIFY 1
+#include "mbedtls/sha256.h"
+#endif
+
 /* Partial_data is word aligned so no reallocation is necessary for encrypted flash write */
 typedef struct ota_ops_entry_ {
     uint32_t handle;
@@ -42,6 +49,13 @@ typedef struct ota_ops_entry_ {
     uint32_t wrote_size;
     uint8_t partial_bytes;
     WORD_ALIGNED_ATTR uint8_t partial_data[16];
+#if OTA_INCREMENTAL_VERIFY
+    bool sha_valid;                 // rolling digest tracks the written stream, dropped on non-sequential writes
+    mbedtls_sha256_context sha_ctx; // rolling SHA-256 of the stream, always lagging sizeof(sha_tail) bytes behind
+    uint8_t sha_tail[32];           // most recent stream bytes, held back as they may be the appended digest
+    uint32_t sha_tail_len;
+    uint32_t stream_len;            // total bytes passed to esp_ota_write() so far
+#endif
     LIST_ENTRY(ota_ops_entry_) entries;
 } ota_ops_entry_t;
 
@@ -101,6 +115,53 @@ static esp_err_t image_validate(const esp_partition_t *partition, esp_image_load
     return ESP_OK;
 }
 
+#if OTA_INCREMENTAL_VERIFY
+/* Feed written data into the rolling image digest. The newest sizeof(sha_tail) bytes
+   are always held back in the tail buffer: once the stream ends they are the appended
+   image digest, which is not part of the digest itself. */
+static void ota_sha_update(ota_ops_entry_t *it, const uint8_t *data, size_t size)
+{
+    if (!it->sha_valid) {
+        return;
+    }
+    it->stream_len += size;
+    size_t total = it->sha_tail_len + size;
+    if (total <= sizeof(it->sha_tail)) {
+        memcpy(it->sha_tail + it->sha_tail_len, data, size);
+        it->sha_tail_len = total;
+        return;
+    }
+    int ret = 0;
+    size_t to_hash = total - sizeof(it->sha_tail);
+    size_t from_tail = MIN(to_hash, it->sha_tail_len);
+    if (from_tail > 0) {
+        ret |= mbedtls_sha256_update(&it->sha_ctx, it->sha_tail, from_tail);
+        memmove(it->sha_tail, it->sha_tail + from_tail, it->sha_tail_len - from_tail);
+        it->sha_tail_len -= from_tail;
+        to_hash -= from_tail;
+    }
+    if (to_hash > 0) {
+        ret |= mbedtls_sha256_update(&it->sha_ctx, data, to_hash);
+        data += to_hash;
+        size -= to_hash;
+    }
+    memcpy(it->sha_tail + it->sha_tail_len, data, size);
+    it->sha_tail_len += size;
+    if (ret != 0) {
+        mbedtls_sha256_free(&it->sha_ctx);
+        it->sha_valid = false;
+    }
+}
+
+static void ota_sha_drop(ota_ops_entry_t *it)
+{
+    if (it->sha_valid) {
+        mbedtls_sha256_free(&it->sha_ctx);
+        it->sha_valid = false;
+    }
+}
+#endif //OTA_INCREMENTAL_VERIFY
+
 static esp_ota_img_states_t set_new_state_otadata(void)
 {
 #ifdef CONFIG_BOOTLOADER_APP_ROLLBACK_ENABLE
@@ -167,6 +228,10 @@ esp_err_t esp_ota_begin(const esp_partition_t *partition, size_t image_size, esp
     new_entry->part = partition;
     new_entry->handle = ++s_ota_ops_last_handle;
     new_entry->need_erase = (image_size == OTA_WITH_SEQUENTIAL_WRITES);
+#if OTA_INCREMENTAL_VERIFY
+    mbedtls_sha256_init(&new_entry->sha_ctx);
+    new_entry->sha_valid = (mbedtls_sha256_starts(&new_entry->sha_ctx, false) == 0);
+#endif
     *out_handle = new_entry->handle;
     return ESP_OK;
 }
@@ -211,6 +276,11 @@ esp_err_t esp_ota_write(esp_ota_handle_t handle, const void *data, size_t size)
                 return ESP_ERR_OTA_VALIDATE_FAILED;
             }
 
+#if OTA_INCREMENTAL_VERIFY
+            // Hash the stream in arrival order, independent of how it gets chunked onto flash
+            ota_sha_update(it, data_bytes, size);
+#endif
+
             if (esp_flash_encryption_enabled()) {
                 /* Can only write 16 byte blocks to flash, so need to cache anything else */
                 size_t copy_len;
@@ -273,6 +343,11 @@ esp_err_t esp_ota_write_with_offset(esp_ota_handle_t handle, const void *data, s
             // must erase the partition before writing to it
             assert(it->need_erase == 0 && "must erase the partition before writing to it");
 
+#if OTA_INCREMENTAL_VERIFY
+            // Non-contiguous writes cannot be hashed on the fly, esp_ota_end() will re-read the image
+            ota_sha_drop(it);
+#endif
+
             /* esp_ota_write_with_offset is used to write data in non contiguous manner.
              * Hence, unaligned data(less than 16 bytes) cannot be cached if flash encryption is enabled.
              */
@@ -311,6 +386,9 @@ esp_err_t esp_ota_abort(esp_ota_handle_t handle)
     if (it == NULL) {
         return ESP_ERR_NOT_FOUND;
     }
+#if OTA_INCREMENTAL_VERIFY
+    ota_sha_drop(it);
+#endif
     LIST_REMOVE(it, entries);
     free(it);
     return ESP_OK;
@@ -350,12 +428,40 @@ esp_err_t esp_ota_end(esp_ota_handle_t handle)
       .size = it->part->size,
     };
 
+#if OTA_INCREMENTAL_VERIFY
+    if (it->sha_valid) {
+        /* The rolling digest has already covered every written byte, so only the image
+           structure needs to be parsed here and the digest compared against the one
+           appended to the image, instead of re-reading and re-hashing the partition. */
+        if (esp_image_get_metadata(&part_pos, &data) == ESP_OK
+                && data.image.hash_appended
+                && data.image_len == it->stream_len
+                && it->sha_tail_len == sizeof(it->sha_tail)) {
+            uint8_t digest[32];
+            int sha_ret = mbedtls_sha256_finish(&it->sha_ctx, digest);
+            mbedtls_sha256_free(&it->sha_ctx);
+            it->sha_valid = false;
+            if (sha_ret == 0 && memcmp(digest, data.image_digest, sizeof(digest)) == 0) {
+                goto cleanup; // image verified incrementally
+            }
+            ESP_LOGE(TAG, "Rolling image digest does not match the appended one");
+            ret = ESP_ERR_OTA_VALIDATE_FAILED;
+            goto cleanup;
+        }
+        /* No appended digest or length mismatch: fall back to the full verification */
+        ota_sha_drop(it);
+    }
+#endif //OTA_INCREMENTAL_VERIFY
+
     if (esp_image_verify(ESP_IMAGE_VERIFY, &part_pos, &data) != ESP_OK) {
         ret = ESP_ERR_OTA_VALIDATE_FAILED;
         goto cleanup;
     }
 
  cleanup:
+#if OTA_INCREMENTAL_VERIFY
+    ota_sha_drop(it);
+#endif
     LIST_REMOVE(it, entries);
     free(it);
     return ret;
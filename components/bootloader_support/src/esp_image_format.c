@@ -714,25 +714,34 @@ static esp_err_t process_segment_data(int segment, intptr_t load_addr, uint32_t
 #endif // CONFIG_BOOTLOADER_APP_ANTI_ROLLBACK
     }
 
-    for (size_t i = 0; i < data_len; i += 4) {
-        int w_i = i / 4; // Word index
-        uint32_t w = src[w_i];
-        if (checksum != NULL) {
-            *checksum ^= w;
+    // SHA_CHUNK determined experimentally as the optimum size
+    // to call bootloader_sha256_data() with. This is a bit
+    // counter-intuitive, but it's ~3ms better than using the
+    // SHA256 block size.
+    const size_t SHA_CHUNK = 1024;
+    for (size_t chunk = 0; chunk < data_len; chunk += SHA_CHUNK) {
+        size_t chunk_len = MIN(SHA_CHUNK, data_len - chunk);
+        // Feed the SHA peripheral first: the ROM driver keeps the digest state in the
+        // hardware between calls and returns while the tail block is still being hashed,
+        // so the checksum/load pass below overlaps with it and finds the chunk's words
+        // already fetched into the cache by the SHA feed.
+        if (sha_handle != NULL) {
+            bootloader_sha256_data(sha_handle, &src[chunk / 4], chunk_len);
         }
-#ifdef BOOTLOADER_BUILD
-        if (do_load) {
-            dest[w_i] = w ^ ((w_i & 1) ? ram_obfs_value[0] : ram_obfs_value[1]);
+        if (checksum == NULL && !do_load) {
+            continue; // SHA-only verification, nothing to compute per word
         }
+        for (size_t i = chunk; i < chunk + chunk_len; i += 4) {
+            int w_i = i / 4; // Word index
+            uint32_t w = src[w_i];
+            if (checksum != NULL) {
+                *checksum ^= w;
+            }
+#ifdef BOOTLOADER_BUILD
+            if (do_load) {
+                dest[w_i] = w ^ ((w_i & 1) ? ram_obfs_value[0] : ram_obfs_value[1]);
+            }
 #endif
-        // SHA_CHUNK determined experimentally as the optimum size
-        // to call bootloader_sha256_data() with. This is a bit
-        // counter-intuitive, but it's ~3ms better than using the
-        // SHA256 block size.
-        const size_t SHA_CHUNK = 1024;
-        if (sha_handle != NULL && i % SHA_CHUNK == 0) {
-            bootloader_sha256_data(sha_handle, &src[w_i],
-                                   MIN(SHA_CHUNK, data_len - i));
         }
     }
 #if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __ESP_BLE_ADV_PREFILTER_H__
+#define __ESP_BLE_ADV_PREFILTER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Maximum number of prefix bytes a prefilter rule can match on
+#define ESP_BLE_ADV_PREFILTER_PREFIX_LEN_MAX    (8)
+
+/// Maximum number of rules that can be registered at a time
+#define ESP_BLE_ADV_PREFILTER_RULES_MAX         (8)
+
+/**
+ * @brief One advertisement match rule
+ *
+ * A report matches a rule if its advertising data contains an AD structure of
+ * the given type whose payload starts with the given prefix. A prefix length
+ * of zero matches any AD structure of the type (e.g. any manufacturer data).
+ */
+typedef struct {
+    uint8_t ad_type;                /*!< AD type to look for, e.g. 0xFF for manufacturer specific data */
+    uint8_t prefix_len;             /*!< Number of valid bytes in prefix, 0 to match the AD type alone */
+    uint8_t prefix[ESP_BLE_ADV_PREFILTER_PREFIX_LEN_MAX];   /*!< Payload prefix to match, e.g. a manufacturer ID */
+} esp_ble_adv_prefilter_rule_t;
+
+/**
+ * @brief One matched advertisement as deposited in the prefilter ring
+ */
+typedef struct {
+    int64_t timestamp_us;           /*!< Time the report was received, from esp_timer_get_time() */
+    uint8_t addr[6];                /*!< Advertiser address */
+    uint8_t addr_type;              /*!< Advertiser address type */
+    uint8_t event_type;             /*!< Advertising event type as reported by the controller */
+    int8_t rssi;                    /*!< RSSI of the advertisement */
+    uint8_t adv_data_len;           /*!< Length of adv_data */
+    uint8_t adv_data[31];           /*!< Raw advertising data */
+} esp_ble_adv_prefilter_report_t;
+
+/**
+ * @brief Prefilter counters, useful to verify the filter and size the ring
+ */
+typedef struct {
+    uint32_t num_received;          /*!< Advertising reports seen by the prefilter */
+    uint32_t num_matched;           /*!< Reports that matched a rule and were deposited in the ring */
+    uint32_t num_ring_overflows;    /*!< Matched reports dropped because the ring was full */
+} esp_ble_adv_prefilter_stats_t;
+
+/**
+ * @brief Enable advertisement prefiltering at the controller/host boundary
+ *
+ * Once enabled, legacy advertising reports are matched against the registered
+ * rules before they are queued towards the host stack. Matching reports are
+ * deposited in an internal ring (read with esp_ble_adv_prefilter_read()) and
+ * non-matching reports are dropped, so neither reaches the GAP callbacks.
+ * This removes the per-advertisement host processing cost in dense RF
+ * environments where only a small fraction of the traffic is of interest.
+ *
+ * Extended (BLE 5.0) advertising reports and non-report events are not
+ * affected and follow the normal host path.
+ *
+ * @param rules        Array of match rules, copied internally
+ * @param num_rules    Number of rules, 1 to ESP_BLE_ADV_PREFILTER_RULES_MAX
+ * @param ring_entries Capacity of the matched-report ring, must be > 0
+ *
+ * @return
+ *      - ESP_OK: Success
+ *      - ESP_ERR_INVALID_ARG: Invalid rules or ring size
+ *      - ESP_ERR_INVALID_STATE: Prefilter already enabled
+ *      - ESP_ERR_NO_MEM: Ring allocation failed
+ */
+esp_err_t esp_ble_adv_prefilter_enable(const esp_ble_adv_prefilter_rule_t *rules, uint8_t num_rules, uint16_t ring_entries);
+
+/**
+ * @brief Disable advertisement prefiltering
+ *
+ * Advertising reports resume flowing to the host stack. Reports still in the
+ * ring are discarded.
+ *
+ * @return
+ *      - ESP_OK: Success
+ *      - ESP_ERR_INVALID_STATE: Prefilter not enabled
+ */
+esp_err_t esp_ble_adv_prefilter_disable(void);
+
+/**
+ * @brief Read the oldest matched report from the prefilter ring
+ *
+ * This function does not block; poll it or pace reads with a timer.
+ *
+ * @param[out] report Filled with the oldest matched report
+ *
+ * @return true if a report was read, false if the ring is empty or the
+ *         prefilter is not enabled
+ */
+bool esp_ble_adv_prefilter_read(esp_ble_adv_prefilter_report_t *report);
+
+/**
+ * @brief Read the prefilter counters
+ *
+ * @param[out] stats Filled with the current counters
+ *
+ * @return
+ *      - ESP_OK: Success
+ *      - ESP_ERR_INVALID_ARG: stats is NULL
+ *      - ESP_ERR_INVALID_STATE: Prefilter not enabled
+ */
+esp_err_t esp_ble_adv_prefilter_get_stats(esp_ble_adv_prefilter_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ESP_BLE_ADV_PREFILTER_H__ */
@@ -0,0 +1,219 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "common/bt_defs.h"
+#include "common/bt_trace.h"
+#include "osi/allocator.h"
+#include "osi/mutex.h"
+#include "hci/hci_hal.h"
+#include "hci/hci_ble_adv_prefilter.h"
+#include "stack/hcidefs.h"
+#include "esp_ble_adv_prefilter.h"
+#include "esp_timer.h"
+
+#define HCI_BLE_EVENT                   (0x3e)
+
+/* Offset of the first advertising report within the H4 packet:
+ * indicator(1) + event code(1) + param len(1) + subevent(1) + num reports(1) */
+#define ADV_RPT_FIRST_REPORT_OFFSET     (5)
+
+typedef struct {
+    bool enabled;
+    osi_mutex_t lock;
+    bool lock_inited;
+    esp_ble_adv_prefilter_rule_t rules[ESP_BLE_ADV_PREFILTER_RULES_MAX];
+    uint8_t num_rules;
+    esp_ble_adv_prefilter_report_t *ring;
+    uint16_t ring_entries;
+    uint16_t ring_head;      /* next entry to write */
+    uint16_t ring_tail;      /* next entry to read */
+    uint16_t ring_count;
+    esp_ble_adv_prefilter_stats_t stats;
+} adv_prefilter_env_t;
+
+static adv_prefilter_env_t s_prefilter_env;
+
+static bool adv_data_matches_rule(const uint8_t *adv_data, uint8_t adv_len,
+                                  const esp_ble_adv_prefilter_rule_t *rule)
+{
+    uint8_t offset = 0;
+
+    /* Walk the AD structures: length (excluding itself), type, payload */
+    while (offset + 1 < adv_len) {
+        uint8_t struct_len = adv_data[offset];
+        if (struct_len == 0 || offset + 1 + struct_len > adv_len) {
+            break;
+        }
+        if (adv_data[offset + 1] == rule->ad_type) {
+            uint8_t payload_len = struct_len - 1;
+            if (rule->prefix_len <= payload_len &&
+                    memcmp(&adv_data[offset + 2], rule->prefix, rule->prefix_len) == 0) {
+                return true;
+            }
+        }
+        offset += 1 + struct_len;
+    }
+    return false;
+}
+
+bool hci_ble_adv_prefilter_process(const uint8_t *data, uint16_t len)
+{
+    if (!s_prefilter_env.enabled) {
+        return false;
+    }
+
+    /* Only legacy advertising report events with a single report are handled;
+     * anything else (direct adv, discard reports, multi-report events) follows
+     * the normal host path. */
+    if (len < ADV_RPT_FIRST_REPORT_OFFSET + 10 ||
+            data[0] != DATA_TYPE_EVENT || data[1] != HCI_BLE_EVENT ||
+            data[3] != HCI_BLE_ADV_PKT_RPT_EVT || data[4] != 1) {
+        return false;
+    }
+
+    /* Report layout: event type(1), addr type(1), addr(6), data len(1), data(N), RSSI(1) */
+    const uint8_t *report = &data[ADV_RPT_FIRST_REPORT_OFFSET];
+    uint8_t adv_data_len = report[9];
+    if (adv_data_len > sizeof(((esp_ble_adv_prefilter_report_t *)0)->adv_data) ||
+            ADV_RPT_FIRST_REPORT_OFFSET + 10 + adv_data_len + 1 > len) {
+        return false;
+    }
+    const uint8_t *adv_data = &report[10];
+    int8_t rssi = (int8_t)report[10 + adv_data_len];
+
+    osi_mutex_lock(&s_prefilter_env.lock, OSI_MUTEX_MAX_TIMEOUT);
+    if (!s_prefilter_env.enabled) {
+        osi_mutex_unlock(&s_prefilter_env.lock);
+        return false;
+    }
+
+    s_prefilter_env.stats.num_received++;
+
+    bool matched = false;
+    for (int i = 0; i < s_prefilter_env.num_rules; i++) {
+        if (adv_data_matches_rule(adv_data, adv_data_len, &s_prefilter_env.rules[i])) {
+            matched = true;
+            break;
+        }
+    }
+
+    if (matched) {
+        if (s_prefilter_env.ring_count < s_prefilter_env.ring_entries) {
+            esp_ble_adv_prefilter_report_t *entry = &s_prefilter_env.ring[s_prefilter_env.ring_head];
+            entry->timestamp_us = esp_timer_get_time();
+            entry->event_type = report[0];
+            entry->addr_type = report[1];
+            memcpy(entry->addr, &report[2], sizeof(entry->addr));
+            entry->adv_data_len = adv_data_len;
+            memcpy(entry->adv_data, adv_data, adv_data_len);
+            entry->rssi = rssi;
+            s_prefilter_env.ring_head = (s_prefilter_env.ring_head + 1) % s_prefilter_env.ring_entries;
+            s_prefilter_env.ring_count++;
+            s_prefilter_env.stats.num_matched++;
+        } else {
+            s_prefilter_env.stats.num_ring_overflows++;
+        }
+    }
+    osi_mutex_unlock(&s_prefilter_env.lock);
+
+    /* Matched or not, the report has been handled here and must not reach the host */
+    return true;
+}
+
+esp_err_t esp_ble_adv_prefilter_enable(const esp_ble_adv_prefilter_rule_t *rules, uint8_t num_rules, uint16_t ring_entries)
+{
+    if (rules == NULL || num_rules == 0 || num_rules > ESP_BLE_ADV_PREFILTER_RULES_MAX || ring_entries == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (int i = 0; i < num_rules; i++) {
+        if (rules[i].prefix_len > ESP_BLE_ADV_PREFILTER_PREFIX_LEN_MAX) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    if (s_prefilter_env.enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (!s_prefilter_env.lock_inited) {
+        osi_mutex_new(&s_prefilter_env.lock);
+        s_prefilter_env.lock_inited = true;
+    }
+
+    esp_ble_adv_prefilter_report_t *ring = osi_calloc(ring_entries * sizeof(esp_ble_adv_prefilter_report_t));
+    if (ring == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    osi_mutex_lock(&s_prefilter_env.lock, OSI_MUTEX_MAX_TIMEOUT);
+    memcpy(s_prefilter_env.rules, rules, num_rules * sizeof(esp_ble_adv_prefilter_rule_t));
+    s_prefilter_env.num_rules = num_rules;
+    s_prefilter_env.ring = ring;
+    s_prefilter_env.ring_entries = ring_entries;
+    s_prefilter_env.ring_head = 0;
+    s_prefilter_env.ring_tail = 0;
+    s_prefilter_env.ring_count = 0;
+    memset(&s_prefilter_env.stats, 0, sizeof(s_prefilter_env.stats));
+    s_prefilter_env.enabled = true;
+    osi_mutex_unlock(&s_prefilter_env.lock);
+
+    return ESP_OK;
+}
+
+esp_err_t esp_ble_adv_prefilter_disable(void)
+{
+    if (!s_prefilter_env.enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    osi_mutex_lock(&s_prefilter_env.lock, OSI_MUTEX_MAX_TIMEOUT);
+    s_prefilter_env.enabled = false;
+    esp_ble_adv_prefilter_report_t *ring = s_prefilter_env.ring;
+    s_prefilter_env.ring = NULL;
+    s_prefilter_env.ring_entries = 0;
+    s_prefilter_env.ring_count = 0;
+    s_prefilter_env.num_rules = 0;
+    osi_mutex_unlock(&s_prefilter_env.lock);
+
+    osi_free(ring);
+    return ESP_OK;
+}
+
+bool esp_ble_adv_prefilter_read(esp_ble_adv_prefilter_report_t *report)
+{
+    bool have_report = false;
+
+    if (report == NULL || !s_prefilter_env.enabled) {
+        return false;
+    }
+
+    osi_mutex_lock(&s_prefilter_env.lock, OSI_MUTEX_MAX_TIMEOUT);
+    if (s_prefilter_env.enabled && s_prefilter_env.ring_count > 0) {
+        *report = s_prefilter_env.ring[s_prefilter_env.ring_tail];
+        s_prefilter_env.ring_tail = (s_prefilter_env.ring_tail + 1) % s_prefilter_env.ring_entries;
+        s_prefilter_env.ring_count--;
+        have_report = true;
+    }
+    osi_mutex_unlock(&s_prefilter_env.lock);
+
+    return have_report;
+}
+
+esp_err_t esp_ble_adv_prefilter_get_stats(esp_ble_adv_prefilter_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_prefilter_env.enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    osi_mutex_lock(&s_prefilter_env.lock, OSI_MUTEX_MAX_TIMEOUT);
+    *stats = s_prefilter_env.stats;
+    osi_mutex_unlock(&s_prefilter_env.lock);
+
+    return ESP_OK;
+}
@@ -23,6 +23,7 @@
 #include "hci/hci_internals.h"
 #include "hci/hci_layer.h"
 #include "hci/hci_trans_int.h"
+#include "hci/hci_ble_adv_prefilter.h"
 #include "osi/thread.h"
 #include "osi/pkt_queue.h"
 #if (BLE_ADV_REPORT_FLOW_CONTROL == TRUE)
@@ -572,6 +573,16 @@ static int host_recv_pkt_cb(uint8_t *data, uint16_t len)
 
     bool is_adv_rpt = host_recv_adv_packet(data);
 
+    if (is_adv_rpt && hci_ble_adv_prefilter_process(data, len)) {
+        // The report was consumed at the controller/host boundary; release its
+        // credit the same way as for a discarded report and skip host queueing.
+#if (BLE_ADV_REPORT_FLOW_CONTROL == TRUE)
+        hci_adv_credits_consumed(1);
+        hci_adv_credits_prep_to_release(1);
+#endif
+        return 0;
+    }
+
     if (!is_adv_rpt) {
         pkt_size = BT_HDR_SIZE + len;
         pkt = (BT_HDR *) osi_calloc(pkt_size);
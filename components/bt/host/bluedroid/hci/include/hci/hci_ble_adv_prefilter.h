@@ -0,0 +1,26 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _HCI_BLE_ADV_PREFILTER_H_
+#define _HCI_BLE_ADV_PREFILTER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Internal hook called from the HCI HAL receive path for advertising report
+ * packets, before they are queued towards the host stack. data/len cover the
+ * whole H4 packet (indicator byte included).
+ *
+ * Returns true if the packet was consumed by the prefilter (either deposited
+ * in the matched-report ring or filtered out); the caller must then drop it
+ * without queueing it to the host. Returns false if the packet should follow
+ * the normal host path (prefilter disabled, not a legacy advertising report,
+ * or a packet the filter does not handle).
+ */
+bool hci_ble_adv_prefilter_process(const uint8_t *data, uint16_t len);
+
+#endif /* _HCI_BLE_ADV_PREFILTER_H_ */
@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Occupancy statistics of one msys mbuf pool
+ *
+ * The msys pools back the `om` mbufs used for ACL data, GATT notifications and
+ * advertising reports. Watching `num_free`/`min_free` shows whether a workload
+ * (e.g. high-rate notification fan-out) is running the pools dry, which shows
+ * up as allocation retries and stalled throughput.
+ */
+typedef struct {
+    const char *name;       /*!< Pool name, e.g. "msys_1" */
+    uint32_t block_size;    /*!< Size of one memory block, in bytes */
+    uint16_t num_blocks;    /*!< Total number of blocks in the pool */
+    uint16_t num_free;      /*!< Number of blocks currently free */
+    uint16_t min_free;      /*!< Lowest number of free blocks ever observed */
+} esp_ble_msys_pool_stats_t;
+
+/**
+ * @brief Read occupancy statistics of the msys mbuf pools
+ *
+ * Fills up to max_pools entries with a snapshot of the current pool state.
+ * The snapshot is taken without locking; the counts may be slightly stale if
+ * the stack is actively allocating, which is acceptable for telemetry.
+ *
+ * @param[out] stats   Array to fill with per-pool statistics
+ * @param max_pools    Capacity of the stats array
+ *
+ * @return Number of entries filled, or -1 if the msys pools are managed inside
+ *         the controller library and cannot be inspected
+ */
+int esp_ble_msys_pool_stats_get(esp_ble_msys_pool_stats_t *stats, int max_pools);
+
+#ifdef __cplusplus
+}
+#endif
@@ -12,6 +12,7 @@
 #include "mem_api.h"
 #include "bt_osi_mem.h"
 #include "esp_err.h"
+#include "esp_ble_msys_stats.h"
 
 #if CONFIG_BT_NIMBLE_ENABLED
 #include "syscfg/syscfg.h"
@@ -238,3 +239,40 @@ void os_msys_init(void)
 #endif
 }
 #endif // CONFIG_BT_LE_MSYS_INIT_IN_CONTROLLER
+
+int
+esp_ble_msys_pool_stats_get(esp_ble_msys_pool_stats_t *stats, int max_pools)
+{
+#if CONFIG_BT_LE_MSYS_INIT_IN_CONTROLLER
+    /* The pools live inside the controller library and cannot be inspected */
+    (void)stats;
+    (void)max_pools;
+    return -1;
+#else
+    int count = 0;
+
+#if OS_MSYS_1_BLOCK_COUNT > 0
+    if (count < max_pools) {
+        stats[count].name = os_msys_init_1_mempool.name;
+        stats[count].block_size = os_msys_init_1_mempool.mp_block_size;
+        stats[count].num_blocks = os_msys_init_1_mempool.mp_num_blocks;
+        stats[count].num_free = os_msys_init_1_mempool.mp_num_free;
+        stats[count].min_free = os_msys_init_1_mempool.mp_min_free;
+        count++;
+    }
+#endif
+
+#if OS_MSYS_2_BLOCK_COUNT > 0
+    if (count < max_pools) {
+        stats[count].name = os_msys_init_2_mempool.name;
+        stats[count].block_size = os_msys_init_2_mempool.mp_block_size;
+        stats[count].num_blocks = os_msys_init_2_mempool.mp_num_blocks;
+        stats[count].num_free = os_msys_init_2_mempool.mp_num_free;
+        stats[count].min_free = os_msys_init_2_mempool.mp_min_free;
+        count++;
+    }
+#endif
+
+    return count;
+#endif // CONFIG_BT_LE_MSYS_INIT_IN_CONTROLLER
+}
@@ -8,6 +8,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <sys/param.h>
+#include <sys/lock.h>
 #include "esp_heap_caps.h"
 #include "esp_log.h"
 #include "esp_console.h"
@@ -52,6 +53,9 @@ static esp_console_config_t s_config = {
 /** temporary buffer used for command line parsing */
 static char *s_tmp_line_buf;
 
+/** serializes esp_console_run() callers sharing s_tmp_line_buf */
+static _lock_t s_run_lock;
+
 static const cmd_item_t *find_command_by_name(const char *name);
 
 static esp_console_help_verbose_level_e s_verbose_level = ESP_CONSOLE_HELP_VERBOSE_LEVEL_1;
@@ -236,8 +240,12 @@ esp_err_t esp_console_run(const char *cmdline, int *cmd_ret)
     if (s_tmp_line_buf == NULL) {
         return ESP_ERR_INVALID_STATE;
     }
+    /* serialize access to s_tmp_line_buf: commands may run concurrently from
+     * the REPL task and the esp_console_run_async() worker */
+    _lock_acquire(&s_run_lock);
     char **argv = (char **) heap_caps_calloc(s_config.max_cmdline_args, sizeof(char *), s_config.heap_alloc_caps);
     if (argv == NULL) {
+        _lock_release(&s_run_lock);
         return ESP_ERR_NO_MEM;
     }
     strlcpy(s_tmp_line_buf, cmdline, s_config.max_cmdline_length);
@@ -246,11 +254,13 @@ esp_err_t esp_console_run(const char *cmdline, int *cmd_ret)
                                          s_config.max_cmdline_args);
     if (argc == 0) {
         free(argv);
+        _lock_release(&s_run_lock);
         return ESP_ERR_INVALID_ARG;
     }
     const cmd_item_t *cmd = find_command_by_name(argv[0]);
     if (cmd == NULL) {
         free(argv);
+        _lock_release(&s_run_lock);
         return ESP_ERR_NOT_FOUND;
     }
     if (cmd->func) {
@@ -260,6 +270,7 @@ esp_err_t esp_console_run(const char *cmdline, int *cmd_ret)
         *cmd_ret = (*cmd->func_w_context)(cmd->context, argc, argv);
     }
     free(argv);
+    _lock_release(&s_run_lock);
     return ESP_OK;
 }
 
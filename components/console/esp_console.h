@@ -259,6 +259,109 @@ esp_err_t esp_console_cmd_deregister(const char *cmd_name);
  */
 esp_err_t esp_console_run(const char *cmdline, int *cmd_ret);
 
+/**
+ * @brief Parameters for asynchronous command execution
+ */
+typedef struct {
+    uint32_t task_stack_size;   //!< worker task stack size
+    uint32_t task_priority;     //!< worker task priority; keep it low so that heavy diagnostic
+                                //!< commands do not perturb the system they are inspecting
+    BaseType_t task_core_id;    //!< worker task affinity, i.e. which core the task is pinned to
+    size_t output_buf_size;     //!< size of the output ring buffer, in bytes
+    size_t cmd_queue_depth;     //!< number of command lines that can be queued to the worker
+} esp_console_async_config_t;
+
+/**
+ * @brief Default asynchronous command execution configuration value
+ *
+ */
+#define ESP_CONSOLE_ASYNC_CONFIG_DEFAULT()  \
+    {                                       \
+        .task_stack_size = 4096,            \
+        .task_priority = 1,                 \
+        .task_core_id = tskNO_AFFINITY,     \
+        .output_buf_size = 2048,            \
+        .cmd_queue_depth = 4,               \
+    }
+
+/**
+ * @brief Start the asynchronous command execution worker
+ *
+ * Creates a worker task which executes command lines queued with
+ * esp_console_run_async(). The worker's standard output and standard error
+ * are captured into a ring buffer which can be drained with
+ * esp_console_async_read_output(), so a long-running command neither blocks
+ * the calling task (typically the REPL) nor stalls on the console device.
+ *
+ * @param config worker configuration
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if config is NULL or contains zero-sized fields
+ *      - ESP_ERR_INVALID_STATE if the worker is already running
+ *      - ESP_ERR_NO_MEM if out of memory
+ */
+esp_err_t esp_console_async_init(const esp_console_async_config_t *config);
+
+/**
+ * @brief Stop the asynchronous command execution worker
+ *
+ * Waits for the command currently being executed (if any) to finish, discards
+ * queued commands and releases all resources.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if the worker is not running
+ */
+esp_err_t esp_console_async_deinit(void);
+
+/**
+ * @brief Queue a command line for execution on the worker task
+ *
+ * The command line is copied, the caller's buffer may be reused immediately.
+ * Use esp_console_async_pending() to find out when the command has finished
+ * and esp_console_async_get_last_result() for its return code.
+ *
+ * @param cmdline command line (command name followed by a number of arguments)
+ * @return
+ *      - ESP_OK, if the command was queued
+ *      - ESP_ERR_INVALID_ARG, if cmdline is NULL
+ *      - ESP_ERR_INVALID_STATE, if the worker is not running
+ *      - ESP_ERR_TIMEOUT, if the command queue is full
+ *      - ESP_ERR_NO_MEM, if out of memory
+ */
+esp_err_t esp_console_run_async(const char *cmdline);
+
+/**
+ * @brief Drain captured output of asynchronously executed commands
+ *
+ * Copies up to buf_len bytes of captured output. If the ring buffer
+ * overflows before it is drained, the oldest output is dropped.
+ *
+ * @param buf buffer to copy the output into (not NUL terminated)
+ * @param buf_len size of buf, in bytes
+ * @param timeout ticks to wait for output when none is buffered
+ * @return number of bytes copied, 0 if no output arrived within the timeout
+ */
+size_t esp_console_async_read_output(char *buf, size_t buf_len, TickType_t timeout);
+
+/**
+ * @brief Get the number of queued or currently executing commands
+ * @return number of commands queued with esp_console_run_async() which have
+ *         not finished yet
+ */
+size_t esp_console_async_pending(void);
+
+/**
+ * @brief Get the return code of the last asynchronously executed command
+ * @param[out] cmd_ret return code from the command
+ * @return
+ *      - ESP_OK, if the return code was stored
+ *      - ESP_ERR_INVALID_ARG, if cmd_ret is NULL
+ *      - ESP_ERR_INVALID_STATE, if no command has completed yet or commands
+ *        are still pending
+ */
+esp_err_t esp_console_async_get_last_result(int *cmd_ret);
+
 /**
  * @brief Split command line into arguments in place
  * @verbatim
@@ -0,0 +1,287 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/lock.h>
+#include <sys/param.h>
+#include <sys/stat.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_vfs.h"
+#include "esp_console.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+/*
+ * Asynchronous command execution. Commands are queued to a dedicated
+ * low-priority worker task instead of running on the caller (typically the
+ * REPL task). The worker redirects its stdout/stderr to a small VFS device
+ * which appends into a ring buffer, so a long-running diagnostic command
+ * neither stalls the REPL nor blocks on the UART while it runs; the operator
+ * drains the captured output at their own pace.
+ */
+
+static const char *TAG = "console.async";
+
+/** VFS path the worker's stdout is reopened on */
+#define CONSOLE_ASYNC_VFS_PATH "/dev/console_async"
+
+static struct {
+    TaskHandle_t task;              //!< worker task handle
+    QueueHandle_t cmd_queue;        //!< queue of heap-allocated command lines; NULL entry stops the worker
+    SemaphoreHandle_t data_sem;     //!< given whenever output is appended to the ring
+    SemaphoreHandle_t done_sem;     //!< given by the worker on shutdown
+    char *ring;                     //!< output ring buffer
+    size_t ring_size;
+    size_t ring_head;               //!< write position
+    size_t ring_count;              //!< bytes currently stored
+    size_t pending;                 //!< commands queued or executing
+    int last_ret;                   //!< return code of the last completed command
+    bool last_ret_valid;
+} s_async;
+
+static _lock_t s_async_lock;
+
+static void ring_write(const char *data, size_t size)
+{
+    _lock_acquire(&s_async_lock);
+    for (size_t i = 0; i < size; i++) {
+        s_async.ring[s_async.ring_head] = data[i];
+        s_async.ring_head = (s_async.ring_head + 1) % s_async.ring_size;
+        if (s_async.ring_count < s_async.ring_size) {
+            s_async.ring_count++;
+        }
+        /* on overflow the oldest output is overwritten; the most recent
+         * output of a diagnostic command is the interesting part */
+    }
+    _lock_release(&s_async_lock);
+}
+
+static ssize_t console_async_write(int fd, const void *data, size_t size)
+{
+    ring_write((const char *) data, size);
+    xSemaphoreGive(s_async.data_sem);
+    return size;
+}
+
+static int console_async_open(const char *path, int flags, int mode)
+{
+    return 0;
+}
+
+static int console_async_close(int fd)
+{
+    return 0;
+}
+
+static int console_async_fstat(int fd, struct stat *st)
+{
+    memset(st, 0, sizeof(*st));
+    st->st_mode = S_IFCHR;
+    return 0;
+}
+
+static const esp_vfs_t s_async_vfs = {
+    .flags = ESP_VFS_FLAG_DEFAULT,
+    .write = &console_async_write,
+    .open = &console_async_open,
+    .fstat = &console_async_fstat,
+    .close = &console_async_close,
+};
+
+static void console_async_task(void *arg)
+{
+    /* Standard streams are per-task: reopening stdout here redirects only the
+     * worker's output into the ring, the REPL keeps printing to the console. */
+    FILE *out = fopen(CONSOLE_ASYNC_VFS_PATH, "w");
+    if (out != NULL) {
+        setvbuf(out, NULL, _IOLBF, 128);
+        stdout = out;
+        stderr = out;
+    } else {
+        ESP_LOGE(TAG, "Failed to open %s, output will not be captured", CONSOLE_ASYNC_VFS_PATH);
+    }
+
+    while (true) {
+        char *line;
+        if (xQueueReceive(s_async.cmd_queue, &line, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (line == NULL) { // shutdown request from esp_console_async_deinit()
+            break;
+        }
+        int cmd_ret = 0;
+        esp_err_t err = esp_console_run(line, &cmd_ret);
+        if (err == ESP_ERR_NOT_FOUND) {
+            printf("Unrecognized command: %s\n", line);
+        } else if (err != ESP_OK) {
+            printf("Command error: 0x%x (%s)\n", err, esp_err_to_name(err));
+        }
+        fflush(stdout);
+        free(line);
+
+        _lock_acquire(&s_async_lock);
+        s_async.last_ret = cmd_ret;
+        s_async.last_ret_valid = true;
+        s_async.pending--;
+        _lock_release(&s_async_lock);
+    }
+
+    if (out != NULL) {
+        fclose(out);
+    }
+    xSemaphoreGive(s_async.done_sem);
+    vTaskDelete(NULL);
+}
+
+esp_err_t esp_console_async_init(const esp_console_async_config_t *config)
+{
+    if (config == NULL || config->output_buf_size == 0 || config->cmd_queue_depth == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_async.task != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t err = esp_vfs_register(CONSOLE_ASYNC_VFS_PATH, &s_async_vfs, NULL);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    s_async.ring = calloc(1, config->output_buf_size);
+    s_async.cmd_queue = xQueueCreate(config->cmd_queue_depth, sizeof(char *));
+    s_async.data_sem = xSemaphoreCreateBinary();
+    s_async.done_sem = xSemaphoreCreateBinary();
+    if (s_async.ring == NULL || s_async.cmd_queue == NULL ||
+            s_async.data_sem == NULL || s_async.done_sem == NULL) {
+        goto no_mem;
+    }
+    s_async.ring_size = config->output_buf_size;
+    s_async.ring_head = 0;
+    s_async.ring_count = 0;
+    s_async.pending = 0;
+    s_async.last_ret_valid = false;
+
+    if (xTaskCreatePinnedToCore(console_async_task, "console_async",
+                                config->task_stack_size, NULL, config->task_priority,
+                                &s_async.task, config->task_core_id) != pdPASS) {
+        goto no_mem;
+    }
+    return ESP_OK;
+
+no_mem:
+    esp_vfs_unregister(CONSOLE_ASYNC_VFS_PATH);
+    free(s_async.ring);
+    if (s_async.cmd_queue) {
+        vQueueDelete(s_async.cmd_queue);
+    }
+    if (s_async.data_sem) {
+        vSemaphoreDelete(s_async.data_sem);
+    }
+    if (s_async.done_sem) {
+        vSemaphoreDelete(s_async.done_sem);
+    }
+    memset(&s_async, 0, sizeof(s_async));
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t esp_console_async_deinit(void)
+{
+    if (s_async.task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    char *stop = NULL;
+    xQueueSend(s_async.cmd_queue, &stop, portMAX_DELAY);
+    xSemaphoreTake(s_async.done_sem, portMAX_DELAY);
+    /* the worker gave done_sem just before deleting itself and no longer
+     * touches any of the resources released below */
+    char *line;
+    while (xQueueReceive(s_async.cmd_queue, &line, 0) == pdTRUE) {
+        free(line);
+    }
+    vQueueDelete(s_async.cmd_queue);
+    vSemaphoreDelete(s_async.data_sem);
+    vSemaphoreDelete(s_async.done_sem);
+    free(s_async.ring);
+    esp_vfs_unregister(CONSOLE_ASYNC_VFS_PATH);
+    memset(&s_async, 0, sizeof(s_async));
+    return ESP_OK;
+}
+
+esp_err_t esp_console_run_async(const char *cmdline)
+{
+    if (cmdline == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_async.task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    char *line = strdup(cmdline);
+    if (line == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    _lock_acquire(&s_async_lock);
+    s_async.pending++;
+    _lock_release(&s_async_lock);
+    if (xQueueSend(s_async.cmd_queue, &line, 0) != pdTRUE) {
+        _lock_acquire(&s_async_lock);
+        s_async.pending--;
+        _lock_release(&s_async_lock);
+        free(line);
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+size_t esp_console_async_read_output(char *buf, size_t buf_len, TickType_t timeout)
+{
+    if (buf == NULL || buf_len == 0 || s_async.task == NULL) {
+        return 0;
+    }
+    _lock_acquire(&s_async_lock);
+    if (s_async.ring_count == 0 && timeout > 0) {
+        _lock_release(&s_async_lock);
+        xSemaphoreTake(s_async.data_sem, timeout);
+        _lock_acquire(&s_async_lock);
+    }
+    size_t to_copy = MIN(buf_len, s_async.ring_count);
+    size_t tail = (s_async.ring_head + s_async.ring_size - s_async.ring_count) % s_async.ring_size;
+    for (size_t i = 0; i < to_copy; i++) {
+        buf[i] = s_async.ring[tail];
+        tail = (tail + 1) % s_async.ring_size;
+    }
+    s_async.ring_count -= to_copy;
+    _lock_release(&s_async_lock);
+    return to_copy;
+}
+
+size_t esp_console_async_pending(void)
+{
+    _lock_acquire(&s_async_lock);
+    size_t pending = s_async.pending;
+    _lock_release(&s_async_lock);
+    return pending;
+}
+
+esp_err_t esp_console_async_get_last_result(int *cmd_ret)
+{
+    if (cmd_ret == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = ESP_OK;
+    _lock_acquire(&s_async_lock);
+    if (s_async.pending != 0 || !s_async.last_ret_valid) {
+        err = ESP_ERR_INVALID_STATE;
+    } else {
+        *cmd_ret = s_async.last_ret;
+    }
+    _lock_release(&s_async_lock);
+    return err;
+}
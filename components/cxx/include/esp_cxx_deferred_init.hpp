@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cxxabi.h>
+#include <new>
+
+extern "C" int __cxa_guard_acquire(__cxxabiv1::__guard *);
+extern "C" void __cxa_guard_release(__cxxabiv1::__guard *) throw();
+extern "C" void __cxa_guard_abort(__cxxabiv1::__guard *) throw();
+
+namespace esp {
+
+/**
+ * Opt-in replacement for a global object whose constructor is too expensive to
+ * run during startup (e.g. lookup-table builders). Declaring the object as
+ *
+ *     static esp::deferred_init<BigTables> s_tables;
+ *
+ * keeps startup free of its constructor; the object is default-constructed on
+ * the first call to get() (or operator* / operator->) instead. Construction
+ * goes through the same __cxa_guard machinery that protects function-local
+ * statics (cxx_guards.cpp), so concurrent first use from several tasks is
+ * safe and constructs exactly once.
+ *
+ * Enable CONFIG_ESP_SYSTEM_GLOBAL_CTOR_TIME_REPORT to get a per-constructor
+ * cost report during boot when deciding which globals are worth deferring.
+ *
+ * Unlike a function-local static, the object is never destructed: it stays
+ * alive until reset, which is the usual lifetime of such globals on this
+ * platform anyway. The wrapper itself is constexpr-constructible and
+ * therefore placed in zero-initialized data, adding no startup work.
+ */
+template <typename T>
+class deferred_init {
+public:
+    constexpr deferred_init() noexcept = default;
+    deferred_init(const deferred_init &) = delete;
+    deferred_init &operator=(const deferred_init &) = delete;
+
+    /** Return the wrapped object, default-constructing it on first use */
+    T &get()
+    {
+        if (__cxa_guard_acquire(&m_guard)) {
+#if __cpp_exceptions
+            try {
+                new (m_storage) T();
+            } catch (...) {
+                __cxa_guard_abort(&m_guard);
+                throw;
+            }
+#else
+            new (m_storage) T();
+#endif
+            __cxa_guard_release(&m_guard);
+        }
+        return *reinterpret_cast<T *>(m_storage);
+    }
+
+    T &operator*()
+    {
+        return get();
+    }
+
+    T *operator->()
+    {
+        return &get();
+    }
+
+private:
+    alignas(T) unsigned char m_storage[sizeof(T)] = {};
+    __cxxabiv1::__guard m_guard = {};
+};
+
+} // namespace esp
@@ -76,6 +76,8 @@ static const char *TAG = "esp-tls";
 #define _esp_tls_server_session_delete      esp_mbedtls_server_session_delete
 #define _esp_tls_server_session_ticket_ctx_init    esp_mbedtls_server_session_ticket_ctx_init
 #define _esp_tls_server_session_ticket_ctx_free    esp_mbedtls_server_session_ticket_ctx_free
+#define _esp_tls_server_session_cache_ctx_init     esp_mbedtls_server_session_cache_ctx_init
+#define _esp_tls_server_session_cache_ctx_free     esp_mbedtls_server_session_cache_ctx_free
 #define _esp_tls_get_bytes_avail            esp_mbedtls_get_bytes_avail
 #define _esp_tls_init_global_ca_store       esp_mbedtls_init_global_ca_store
 #define _esp_tls_set_global_ca_store        esp_mbedtls_set_global_ca_store                 /*!< Callback function for setting global CA store data for TLS/SSL */
@@ -696,6 +698,38 @@ void esp_tls_cfg_server_session_tickets_free(esp_tls_cfg_server_t *cfg)
 #endif
 }
 
+esp_err_t esp_tls_cfg_server_session_cache_init(esp_tls_cfg_server_t *cfg)
+{
+#if defined(CONFIG_ESP_TLS_SERVER_SESSION_CACHE)
+    if (!cfg || cfg->cache_ctx) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    cfg->cache_ctx = calloc(1, sizeof(esp_tls_server_session_cache_ctx_t));
+    if (!cfg->cache_ctx) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t ret = _esp_tls_server_session_cache_ctx_init(cfg->cache_ctx);
+    if (ret != ESP_OK) {
+        free(cfg->cache_ctx);
+        cfg->cache_ctx = NULL;
+    }
+    return ret;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+void esp_tls_cfg_server_session_cache_free(esp_tls_cfg_server_t *cfg)
+{
+#if defined(CONFIG_ESP_TLS_SERVER_SESSION_CACHE)
+    if (cfg && cfg->cache_ctx) {
+        _esp_tls_server_session_cache_ctx_free(cfg->cache_ctx);
+        free(cfg->cache_ctx);
+        cfg->cache_ctx = NULL;
+    }
+#endif
+}
+
 /**
  * @brief      Create a server side TLS/SSL connection
  */
@@ -721,6 +755,18 @@ void *esp_tls_get_ssl_context(esp_tls_t *tls)
     return _esp_tls_get_ssl_context(tls);
 }
 
+#ifdef CONFIG_ESP_TLS_CONN_PERF_STATS
+esp_err_t esp_tls_get_conn_perf_stats(esp_tls_t *tls, esp_tls_conn_perf_stats_t *stats)
+{
+    if (!tls || !stats) {
+        ESP_LOGE(TAG, "Invalid arguments passed");
+        return ESP_ERR_INVALID_ARG;
+    }
+    *stats = tls->perf_stats;
+    return ESP_OK;
+}
+#endif /* CONFIG_ESP_TLS_CONN_PERF_STATS */
+
 esp_err_t esp_tls_get_conn_sockfd(esp_tls_t *tls, int *sockfd)
 {
     if (!tls || !sockfd) {
@@ -18,6 +18,9 @@
 #include "mbedtls/entropy.h"
 #include "mbedtls/ctr_drbg.h"
 #endif
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_CACHE
+#include "mbedtls/ssl_cache.h"
+#endif
 #elif CONFIG_ESP_TLS_USING_WOLFSSL
 #include "wolfssl/wolfcrypt/settings.h"
 #include "wolfssl/ssl.h"
@@ -211,6 +214,13 @@ typedef struct esp_tls_cfg {
     const int *ciphersuites_list;           /*!< Pointer to a zero-terminated array of IANA identifiers of TLS ciphersuites.
                                                 Please check the list validity by esp_tls_get_ciphersuites_list() API */
     esp_tls_proto_ver_t tls_version;        /*!< TLS protocol version of the connection, e.g., TLS 1.2, TLS 1.3 (default - no preference) */
+
+    unsigned int max_fragment_length;       /*!< Maximum plaintext fragment length (RFC 6066) to negotiate with the server:
+                                                 0 (default, no negotiation), 512, 1024, 2048 or 4096. A smaller fragment
+                                                 length caps the size of the records the peer may send, so less RX buffer
+                                                 memory is needed; combined with CONFIG_MBEDTLS_DYNAMIC_BUFFER it also caps
+                                                 how far the RX buffer grows during bursts. Requires
+                                                 MBEDTLS_SSL_MAX_FRAGMENT_LENGTH support in the TLS stack. */
 } esp_tls_cfg_t;
 
 #if defined(CONFIG_ESP_TLS_SERVER_SESSION_TICKETS)
@@ -227,6 +237,15 @@ typedef struct esp_tls_server_session_ticket_ctx {
 } esp_tls_server_session_ticket_ctx_t;
 #endif
 
+#if defined(CONFIG_ESP_TLS_SERVER_SESSION_CACHE)
+/**
+ * @brief Data structure for the server side TLS session cache
+ */
+typedef struct esp_tls_server_session_cache_ctx {
+    mbedtls_ssl_cache_context cache;                                            /*!< mbedTLS session cache context */
+} esp_tls_server_session_cache_ctx_t;
+#endif
+
 #if defined(CONFIG_ESP_TLS_SERVER_CERT_SELECT_HOOK)
 /**
  * @brief tls handshake callback
@@ -314,6 +333,14 @@ typedef struct esp_tls_cfg_server {
                                                     to free the data associated with this context. */
 #endif
 
+#if defined(CONFIG_ESP_TLS_SERVER_SESSION_CACHE)
+    esp_tls_server_session_cache_ctx_t * cache_ctx; /*!< Server side session cache context.
+                                                    You have to call esp_tls_cfg_server_session_cache_init
+                                                    to use it.
+                                                    Call esp_tls_cfg_server_session_cache_free
+                                                    to free the data associated with this context. */
+#endif
+
     void *userdata;                             /*!< User data to be added to the ssl context.
                                                   Can be retrieved by callbacks */
 #if defined(CONFIG_ESP_TLS_SERVER_CERT_SELECT_HOOK)
@@ -349,6 +376,32 @@ esp_err_t esp_tls_cfg_server_session_tickets_init(esp_tls_cfg_server_t *cfg);
  */
 void esp_tls_cfg_server_session_tickets_free(esp_tls_cfg_server_t *cfg);
 
+/**
+ * @brief Initialize the server side TLS session cache context
+ *
+ * This function initializes a bounded in-memory cache of negotiated sessions
+ * (at most CONFIG_ESP_TLS_SERVER_SESSION_CACHE_SIZE entries). Clients that do
+ * not support session tickets can then still resume with an abbreviated
+ * handshake on reconnect. The cache is shared by all sessions created from
+ * this configuration.
+ * Use esp_tls_cfg_server_session_cache_free to free the data.
+ *
+ * @param[in]  cfg server configuration as esp_tls_cfg_server_t
+ * @return
+ *             ESP_OK if setup succeeded
+ *             ESP_ERR_INVALID_ARG if context is already initialized
+ *             ESP_ERR_NO_MEM if memory allocation failed
+ *             ESP_ERR_NOT_SUPPORTED if the session cache is not available due to build configuration
+ */
+esp_err_t esp_tls_cfg_server_session_cache_init(esp_tls_cfg_server_t *cfg);
+
+/**
+ * @brief Free the server side TLS session cache context
+ *
+ * @param cfg server configuration as esp_tls_cfg_server_t
+ */
+void esp_tls_cfg_server_session_cache_free(esp_tls_cfg_server_t *cfg);
+
 typedef struct esp_tls esp_tls_t;
 
 /**
@@ -577,6 +630,37 @@ esp_err_t esp_tls_set_conn_state(esp_tls_t *tls, esp_tls_conn_state_t conn_state
  */
 void *esp_tls_get_ssl_context(esp_tls_t *tls);
 
+#if defined(CONFIG_ESP_TLS_CONN_PERF_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief      Per-connection performance counters
+ */
+typedef struct esp_tls_conn_perf_stats {
+    uint32_t handshake_time_ms;             /*!< Wall-clock duration of the TLS handshake */
+    uint32_t tx_records;                    /*!< Number of TLS records written so far */
+    uint32_t rx_records;                    /*!< Number of TLS records read so far */
+    uint64_t tx_bytes;                      /*!< Plaintext bytes written so far */
+    uint64_t rx_bytes;                      /*!< Plaintext bytes read so far */
+} esp_tls_conn_perf_stats_t;
+
+/**
+ * @brief       Retrieve the performance counters of a connection
+ *
+ * The counters start with the handshake and accumulate over the lifetime of the
+ * connection; sampling them periodically yields records/s and bytes/s rates for
+ * tuning the negotiated fragment length against throughput.
+ *
+ * @param[in]   tls          handle to esp_tls context
+ *
+ * @param[out]  stats        pointer where the counters are copied to.
+ *
+ * @return     - ESP_OK on success
+ *             - ESP_ERR_INVALID_ARG if (tls == NULL || stats == NULL)
+ *
+ * @note This API is only available if CONFIG_ESP_TLS_CONN_PERF_STATS=y
+ */
+esp_err_t esp_tls_get_conn_perf_stats(esp_tls_t *tls, esp_tls_conn_perf_stats_t *stats);
+#endif /* CONFIG_ESP_TLS_CONN_PERF_STATS || __DOXYGEN__ */
+
 /**
  * @brief      Create a global CA store, initially empty.
  *
@@ -16,6 +16,7 @@
 #include "esp_tls_mbedtls.h"
 #include "esp_tls_private.h"
 #include "esp_tls_error_capture_internal.h"
+#include "esp_tls_platform_port.h"
 #include <errno.h>
 #include "esp_log.h"
 #include "esp_check.h"
@@ -28,6 +29,10 @@
 #include "esp_crt_bundle.h"
 #endif
 
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_TICKETS_NVS
+#include "nvs.h"
+#endif
+
 #ifdef CONFIG_ESP_TLS_USE_SECURE_ELEMENT
 /* cryptoauthlib includes */
 #include "mbedtls/atca_mbedtls_wrap.h"
@@ -226,10 +231,18 @@ int esp_mbedtls_handshake(esp_tls_t *tls, const esp_tls_cfg_t *cfg)
             return -1;
         }
     }
+#endif
+#ifdef CONFIG_ESP_TLS_CONN_PERF_STATS
+    if (tls->handshake_start_us == 0) {
+        tls->handshake_start_us = esp_tls_get_platform_time();
+    }
 #endif
     ret = mbedtls_ssl_handshake(&tls->ssl);
     if (ret == 0) {
         tls->conn_state = ESP_TLS_DONE;
+#ifdef CONFIG_ESP_TLS_CONN_PERF_STATS
+        tls->perf_stats.handshake_time_ms = (esp_tls_get_platform_time() - tls->handshake_start_us) / 1000;
+#endif
 
 #ifdef CONFIG_ESP_TLS_USE_DS_PERIPHERAL
         esp_ds_release_ds_lock();
@@ -280,6 +293,12 @@ ssize_t esp_mbedtls_read(esp_tls_t *tls, char *data, size_t datalen)
             mbedtls_print_error_msg(ret);
         }
     }
+#ifdef CONFIG_ESP_TLS_CONN_PERF_STATS
+    if (ret > 0) {
+        tls->perf_stats.rx_records++;
+        tls->perf_stats.rx_bytes += ret;
+    }
+#endif
     return ret;
 }
 
@@ -310,6 +329,10 @@ ssize_t esp_mbedtls_write(esp_tls_t *tls, const char *data, size_t datalen)
                 return (written > 0) ? written : ret;
             }
         }
+#ifdef CONFIG_ESP_TLS_CONN_PERF_STATS
+        tls->perf_stats.tx_records++;
+        tls->perf_stats.tx_bytes += ret;
+#endif
         written += ret;
         write_len = datalen - written;
     }
@@ -357,13 +380,108 @@ ssize_t esp_mbedtls_get_bytes_avail(esp_tls_t *tls)
     return mbedtls_ssl_get_bytes_avail(&tls->ssl);
 }
 
+#ifdef CONFIG_ESP_TLS_CACERT_PARSE_CACHE
+#include <sys/lock.h>
+
+/* Parsed CA certificates shared across connections. Entries are keyed by the
+ * caller's buffer address and length, so hitting the cache costs a pointer
+ * comparison instead of a full mbedtls_x509_crt_parse. Entries whose refcount
+ * has dropped to zero stay parsed and are only evicted when the table is full
+ * and a new buffer needs the slot. */
+typedef struct {
+    const unsigned char *buf;
+    size_t len;
+    mbedtls_x509_crt chain;
+    int refcount;
+    int parse_ret;      // 0 or the >0 partial-parse count from mbedtls_x509_crt_parse
+} cacert_cache_entry_t;
+
+static cacert_cache_entry_t s_cacert_cache[CONFIG_ESP_TLS_CACERT_PARSE_CACHE_SIZE];
+static _lock_t s_cacert_cache_lock;
+
+/* Returns the shared chain for (buf, len), parsing it on a miss. On return
+ * *parse_ret is <0 if the parse failed, else the partial-parse count. A NULL
+ * return with *parse_ret >= 0 means every slot is referenced by an open
+ * connection and the caller must fall back to a per-connection parse. */
+static mbedtls_x509_crt *cacert_cache_acquire(const unsigned char *buf, size_t len, int *parse_ret)
+{
+    cacert_cache_entry_t *free_slot = NULL;
+    cacert_cache_entry_t *idle_slot = NULL;
+
+    _lock_acquire(&s_cacert_cache_lock);
+    for (int i = 0; i < CONFIG_ESP_TLS_CACERT_PARSE_CACHE_SIZE; i++) {
+        cacert_cache_entry_t *entry = &s_cacert_cache[i];
+        if (entry->buf == buf && entry->len == len) {
+            entry->refcount++;
+            *parse_ret = entry->parse_ret;
+            _lock_release(&s_cacert_cache_lock);
+            return &entry->chain;
+        }
+        if (entry->buf == NULL && free_slot == NULL) {
+            free_slot = entry;
+        }
+        if (entry->buf != NULL && entry->refcount == 0 && idle_slot == NULL) {
+            idle_slot = entry;
+        }
+    }
+    cacert_cache_entry_t *entry = free_slot;
+    if (entry == NULL && idle_slot != NULL) {
+        mbedtls_x509_crt_free(&idle_slot->chain);
+        *idle_slot = (cacert_cache_entry_t) { 0 };
+        entry = idle_slot;
+    }
+    if (entry == NULL) {
+        _lock_release(&s_cacert_cache_lock);
+        return NULL;
+    }
+    mbedtls_x509_crt_init(&entry->chain);
+    int ret = mbedtls_x509_crt_parse(&entry->chain, buf, len);
+    *parse_ret = ret;
+    if (ret < 0) {
+        mbedtls_x509_crt_free(&entry->chain);
+        _lock_release(&s_cacert_cache_lock);
+        return NULL;
+    }
+    entry->buf = buf;
+    entry->len = len;
+    entry->parse_ret = ret;
+    entry->refcount = 1;
+    _lock_release(&s_cacert_cache_lock);
+    return &entry->chain;
+}
+
+/* Drops one reference if chain belongs to the cache. Returns true if it did,
+ * false if the chain is connection-owned and the caller must free it. */
+static bool cacert_cache_release(mbedtls_x509_crt *chain)
+{
+    bool released = false;
+    _lock_acquire(&s_cacert_cache_lock);
+    for (int i = 0; i < CONFIG_ESP_TLS_CACERT_PARSE_CACHE_SIZE; i++) {
+        cacert_cache_entry_t *entry = &s_cacert_cache[i];
+        if (chain == &entry->chain) {
+            entry->refcount--;
+            released = true;
+            break;
+        }
+    }
+    _lock_release(&s_cacert_cache_lock);
+    return released;
+}
+#endif /* CONFIG_ESP_TLS_CACERT_PARSE_CACHE */
+
 void esp_mbedtls_cleanup(esp_tls_t *tls)
 {
     if (!tls) {
         return;
     }
     if (tls->cacert_ptr != global_cacert) {
+#ifdef CONFIG_ESP_TLS_CACERT_PARSE_CACHE
+        if (!cacert_cache_release(tls->cacert_ptr)) {
+            mbedtls_x509_crt_free(tls->cacert_ptr);
+        }
+#else
         mbedtls_x509_crt_free(tls->cacert_ptr);
+#endif
     }
     tls->cacert_ptr = NULL;
     mbedtls_x509_crt_free(&tls->cacert);
@@ -384,6 +502,26 @@ void esp_mbedtls_cleanup(esp_tls_t *tls)
 static esp_err_t set_ca_cert(esp_tls_t *tls, const unsigned char *cacert, size_t cacert_len)
 {
     assert(tls);
+#ifdef CONFIG_ESP_TLS_CACERT_PARSE_CACHE
+    int cache_ret = 0;
+    mbedtls_x509_crt *cached = cacert_cache_acquire(cacert, cacert_len, &cache_ret);
+    if (cached != NULL) {
+        if (cache_ret > 0) {
+            ESP_LOGW(TAG, "mbedtls_x509_crt_parse was partly successful. No. of failed certificates: %d", cache_ret);
+        }
+        tls->cacert_ptr = cached;
+        mbedtls_ssl_conf_authmode(&tls->conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+        mbedtls_ssl_conf_ca_chain(&tls->conf, tls->cacert_ptr, NULL);
+        return ESP_OK;
+    }
+    if (cache_ret < 0) {
+        ESP_LOGE(TAG, "mbedtls_x509_crt_parse of CA cert returned -0x%04X", -cache_ret);
+        mbedtls_print_error_msg(cache_ret);
+        ESP_INT_EVENT_TRACKER_CAPTURE(tls->error_handle, ESP_TLS_ERR_TYPE_MBEDTLS, -cache_ret);
+        return ESP_ERR_MBEDTLS_X509_CRT_PARSE_FAILED;
+    }
+    /* every cache slot is held by an open connection, parse a per-connection copy */
+#endif
     tls->cacert_ptr = &tls->cacert;
     mbedtls_x509_crt_init(tls->cacert_ptr);
     int ret = mbedtls_x509_crt_parse(tls->cacert_ptr, cacert, cacert_len);
@@ -488,6 +626,50 @@ static esp_err_t set_global_ca_store(esp_tls_t *tls)
 }
 
 #ifdef CONFIG_ESP_TLS_SERVER_SESSION_TICKETS
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_TICKETS_NVS
+#define TLS_TICKET_KEY_NVS_NAMESPACE "esp_tls"
+#define TLS_TICKET_KEY_NVS_KEY       "ticket_key"
+#define TLS_TICKET_KEY_NAME_BYTES    4
+#define TLS_TICKET_KEY_BYTES         32
+
+static esp_err_t esp_mbedtls_load_ticket_key(esp_tls_server_session_ticket_ctx_t *ctx)
+{
+    /* 4-byte key name followed by the AES-256 ticket encryption key */
+    unsigned char key_blob[TLS_TICKET_KEY_NAME_BYTES + TLS_TICKET_KEY_BYTES];
+    nvs_handle_t handle;
+    esp_err_t esp_ret = nvs_open(TLS_TICKET_KEY_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (esp_ret != ESP_OK) {
+        return esp_ret;
+    }
+    size_t blob_len = sizeof(key_blob);
+    esp_ret = nvs_get_blob(handle, TLS_TICKET_KEY_NVS_KEY, key_blob, &blob_len);
+    if (esp_ret == ESP_ERR_NVS_NOT_FOUND || (esp_ret == ESP_OK && blob_len != sizeof(key_blob))) {
+        if (mbedtls_ctr_drbg_random(&ctx->ctr_drbg, key_blob, sizeof(key_blob)) != 0) {
+            nvs_close(handle);
+            return ESP_FAIL;
+        }
+        esp_ret = nvs_set_blob(handle, TLS_TICKET_KEY_NVS_KEY, key_blob, sizeof(key_blob));
+        if (esp_ret == ESP_OK) {
+            esp_ret = nvs_commit(handle);
+        }
+    }
+    nvs_close(handle);
+    if (esp_ret != ESP_OK) {
+        return esp_ret;
+    }
+    int ret = mbedtls_ssl_ticket_rotate(&ctx->ticket_ctx,
+                    key_blob, TLS_TICKET_KEY_NAME_BYTES,
+                    key_blob + TLS_TICKET_KEY_NAME_BYTES, TLS_TICKET_KEY_BYTES,
+                    CONFIG_ESP_TLS_SERVER_SESSION_TICKET_TIMEOUT);
+    if (ret != 0) {
+        ESP_LOGE(TAG, "mbedtls_ssl_ticket_rotate returned -0x%04X", -ret);
+        mbedtls_print_error_msg(ret);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+#endif /* CONFIG_ESP_TLS_SERVER_SESSION_TICKETS_NVS */
+
 int esp_mbedtls_server_session_ticket_write(void *p_ticket, const mbedtls_ssl_session *session, unsigned char *start, const unsigned char *end, size_t *tlen, uint32_t *lifetime)
 {
     int ret = mbedtls_ssl_ticket_write(p_ticket, session, start, end, tlen, lifetime);
@@ -539,6 +721,15 @@ esp_err_t esp_mbedtls_server_session_ticket_ctx_init(esp_tls_server_session_tick
         esp_ret = ESP_ERR_MBEDTLS_SSL_TICKET_SETUP_FAILED;
         goto exit;
     }
+
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_TICKETS_NVS
+    /* Replace the random ticket key by the one persisted in NVS so tickets
+     * issued before a reboot can still be decrypted afterwards. On failure
+     * the random key set up above remains in use. */
+    if (esp_mbedtls_load_ticket_key(ctx) != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to load the session ticket key from NVS, tickets will not survive reboot");
+    }
+#endif
     return ESP_OK;
 exit:
     esp_mbedtls_server_session_ticket_ctx_free(ctx);
@@ -555,6 +746,25 @@ void esp_mbedtls_server_session_ticket_ctx_free(esp_tls_server_session_ticket_ct
 }
 #endif
 
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_CACHE
+esp_err_t esp_mbedtls_server_session_cache_ctx_init(esp_tls_server_session_cache_ctx_t *ctx)
+{
+    if (!ctx) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    mbedtls_ssl_cache_init(&ctx->cache);
+    mbedtls_ssl_cache_set_max_entries(&ctx->cache, CONFIG_ESP_TLS_SERVER_SESSION_CACHE_SIZE);
+    return ESP_OK;
+}
+
+void esp_mbedtls_server_session_cache_ctx_free(esp_tls_server_session_cache_ctx_t *ctx)
+{
+    if (ctx) {
+        mbedtls_ssl_cache_free(&ctx->cache);
+    }
+}
+#endif
+
 static esp_err_t set_server_config(esp_tls_cfg_server_t *cfg, esp_tls_t *tls)
 {
     assert(cfg != NULL);
@@ -685,6 +895,16 @@ static esp_err_t set_server_config(esp_tls_cfg_server_t *cfg, esp_tls_t *tls)
     }
 #endif
 
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_CACHE
+    if (cfg->cache_ctx) {
+        ESP_LOGD(TAG, "Enabling server-side tls session cache");
+
+        mbedtls_ssl_conf_session_cache( &tls->conf, &cfg->cache_ctx->cache,
+                mbedtls_ssl_cache_get,
+                mbedtls_ssl_cache_set );
+    }
+#endif
+
     return ESP_OK;
 }
 
@@ -729,6 +949,30 @@ esp_err_t set_client_config(const char *hostname, size_t hostlen, esp_tls_cfg_t
     mbedtls_ssl_conf_renegotiation(&tls->conf, MBEDTLS_SSL_RENEGOTIATION_ENABLED);
 #endif
 
+    if (cfg->max_fragment_length) {
+#ifdef MBEDTLS_SSL_MAX_FRAGMENT_LENGTH
+        unsigned char mfl_code;
+        switch (cfg->max_fragment_length) {
+            case 512:  mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_512;  break;
+            case 1024: mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_1024; break;
+            case 2048: mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_2048; break;
+            case 4096: mfl_code = MBEDTLS_SSL_MAX_FRAG_LEN_4096; break;
+            default:
+                ESP_LOGE(TAG, "Unsupported max_fragment_length %u, must be 512, 1024, 2048 or 4096", cfg->max_fragment_length);
+                return ESP_ERR_INVALID_ARG;
+        }
+        if ((ret = mbedtls_ssl_conf_max_frag_len(&tls->conf, mfl_code)) != 0) {
+            ESP_LOGE(TAG, "mbedtls_ssl_conf_max_frag_len returned -0x%04X", -ret);
+            mbedtls_print_error_msg(ret);
+            ESP_INT_EVENT_TRACKER_CAPTURE(tls->error_handle, ESP_TLS_ERR_TYPE_MBEDTLS, -ret);
+            return ESP_ERR_INVALID_ARG;
+        }
+#else
+        ESP_LOGE(TAG, "max_fragment_length configured but MBEDTLS_SSL_MAX_FRAGMENT_LENGTH is disabled in the TLS stack");
+        return ESP_ERR_INVALID_STATE;
+#endif
+    }
+
     if (cfg->alpn_protos) {
 #ifdef CONFIG_MBEDTLS_SSL_ALPN
         if ((ret = mbedtls_ssl_conf_alpn_protocols(&tls->conf, cfg->alpn_protos)) != 0) {
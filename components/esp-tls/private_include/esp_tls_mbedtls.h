@@ -92,6 +92,22 @@ esp_err_t esp_mbedtls_server_session_ticket_ctx_init(esp_tls_server_session_tick
 void esp_mbedtls_server_session_ticket_ctx_free(esp_tls_server_session_ticket_ctx_t *cfg);
 #endif
 
+#ifdef CONFIG_ESP_TLS_SERVER_SESSION_CACHE
+/**
+ * Internal function to setup server side session cache context
+ *
+ * /note :- The function can only be used with mbedtls ssl library
+ */
+esp_err_t esp_mbedtls_server_session_cache_ctx_init(esp_tls_server_session_cache_ctx_t *ctx);
+
+/**
+ * Internal function to free server side session cache context
+ *
+ * /note :- The function can only be used with mbedtls ssl library
+ */
+void esp_mbedtls_server_session_cache_ctx_free(esp_tls_server_session_cache_ctx_t *ctx);
+#endif
+
 /**
  * Internal Callback for set_client_config_function
  */
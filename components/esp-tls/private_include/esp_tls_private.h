@@ -94,6 +94,11 @@ struct esp_tls {
 
     esp_tls_error_handle_t error_handle;                                        /*!< handle to error descriptor */
 
+#ifdef CONFIG_ESP_TLS_CONN_PERF_STATS
+    esp_tls_conn_perf_stats_t perf_stats;                                       /*!< Per-connection performance counters */
+
+    uint64_t handshake_start_us;                                                /*!< Timestamp of the first handshake step */
+#endif
 };
 
 // Function pointer for the server configuration API
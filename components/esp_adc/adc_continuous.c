@@ -58,6 +58,82 @@ extern portMUX_TYPE rtc_spinlock; //TODO: Will be placed in the appropriate posi
                    ADC Continuous Read Mode (via DMA)
 ---------------------------------------------------------------*/
 
+/**
+ * Average every `decimation_factor` conversion results of each channel into one output result,
+ * keeping the conversion result format. Accumulators persist across frames, so no result is lost
+ * at frame boundaries. Returns the number of bytes written to `decim_out_buf`.
+ */
+static IRAM_ATTR uint32_t adc_digi_decimate_frame(adc_continuous_ctx_t *adc_digi_ctx, const uint8_t *finished_buffer, uint32_t finished_size)
+{
+    const adc_digi_output_data_t *record = (const adc_digi_output_data_t *)finished_buffer;
+    adc_digi_output_data_t *out = (adc_digi_output_data_t *)adc_digi_ctx->decim_out_buf;
+    uint32_t out_count = 0;
+    uint32_t record_num = finished_size / SOC_ADC_DIGI_RESULT_BYTES;
+
+    for (uint32_t i = 0; i < record_num; i++, record++) {
+        uint32_t channel = 0;
+        uint32_t unit = 0;
+        uint32_t data = 0;
+#if CONFIG_IDF_TARGET_ESP32
+        channel = record->type1.channel;
+        data = record->type1.data;
+#elif CONFIG_IDF_TARGET_ESP32S2
+        if (adc_digi_ctx->output_format == ADC_DIGI_OUTPUT_FORMAT_TYPE1) {
+            channel = record->type1.channel;
+            data = record->type1.data;
+        } else {
+            channel = record->type2.channel;
+            unit = record->type2.unit;
+            data = record->type2.data;
+        }
+#elif CONFIG_IDF_TARGET_ESP32C6 || CONFIG_IDF_TARGET_ESP32H2 || CONFIG_IDF_TARGET_ESP32C5
+        channel = record->type2.channel;
+        data = record->type2.data;
+#else
+        channel = record->type2.channel;
+        unit = record->type2.unit;
+        data = record->type2.data;
+#endif
+        if (channel >= SOC_ADC_MAX_CHANNEL_NUM) {
+            //The role of the arbiter may produce invalid results, drop them here
+            continue;
+        }
+
+        uint32_t key = unit * SOC_ADC_MAX_CHANNEL_NUM + channel;
+        adc_digi_ctx->decim_sum[key] += data;
+        if (++adc_digi_ctx->decim_cnt[key] >= adc_digi_ctx->decimation_factor) {
+            uint32_t average = adc_digi_ctx->decim_sum[key] / adc_digi_ctx->decimation_factor;
+            adc_digi_ctx->decim_sum[key] = 0;
+            adc_digi_ctx->decim_cnt[key] = 0;
+
+            adc_digi_output_data_t out_record = {};
+#if CONFIG_IDF_TARGET_ESP32
+            out_record.type1.channel = channel;
+            out_record.type1.data = average;
+#elif CONFIG_IDF_TARGET_ESP32S2
+            if (adc_digi_ctx->output_format == ADC_DIGI_OUTPUT_FORMAT_TYPE1) {
+                out_record.type1.channel = channel;
+                out_record.type1.data = average;
+            } else {
+                out_record.type2.channel = channel;
+                out_record.type2.unit = unit;
+                out_record.type2.data = average;
+            }
+#elif CONFIG_IDF_TARGET_ESP32C6 || CONFIG_IDF_TARGET_ESP32H2 || CONFIG_IDF_TARGET_ESP32C5
+            out_record.type2.channel = channel;
+            out_record.type2.data = average;
+#else
+            out_record.type2.channel = channel;
+            out_record.type2.unit = unit;
+            out_record.type2.data = average;
+#endif
+            out[out_count++] = out_record;
+        }
+    }
+
+    return out_count * SOC_ADC_DIGI_RESULT_BYTES;
+}
+
 static IRAM_ATTR bool adc_dma_intr(adc_continuous_ctx_t *adc_digi_ctx)
 {
     BaseType_t taskAwoken = 0;
@@ -79,13 +155,24 @@ static IRAM_ATTR bool adc_dma_intr(adc_continuous_ctx_t *adc_digi_ctx)
         }
 #endif
 
-        ret = xRingbufferSendFromISR(adc_digi_ctx->ringbuf_hdl, finished_buffer, finished_size, &taskAwoken);
+        uint8_t *result_buffer = finished_buffer;
+        uint32_t result_size = finished_size;
+        if (adc_digi_ctx->decimation_factor > 1) {
+            result_size = adc_digi_decimate_frame(adc_digi_ctx, finished_buffer, finished_size);
+            result_buffer = adc_digi_ctx->decim_out_buf;
+            if (result_size == 0) {
+                //not enough results accumulated yet to produce a decimated frame
+                continue;
+            }
+        }
+
+        ret = xRingbufferSendFromISR(adc_digi_ctx->ringbuf_hdl, result_buffer, result_size, &taskAwoken);
         need_yield |= (taskAwoken == pdTRUE);
 
         if (adc_digi_ctx->cbs.on_conv_done) {
             adc_continuous_evt_data_t edata = {
-                .conv_frame_buffer = finished_buffer,
-                .size = finished_size,
+                .conv_frame_buffer = result_buffer,
+                .size = result_size,
             };
             if (adc_digi_ctx->cbs.on_conv_done(adc_digi_ctx, &edata, adc_digi_ctx->user_data)) {
                 need_yield |= true;
@@ -104,7 +191,7 @@ static IRAM_ATTR bool adc_dma_intr(adc_continuous_ctx_t *adc_digi_ctx)
                  */
                 if (old_data) {
                     vRingbufferReturnItemFromISR(adc_digi_ctx->ringbuf_hdl, old_data, &taskAwoken);
-                    xRingbufferSendFromISR(adc_digi_ctx->ringbuf_hdl, finished_buffer, finished_size, &taskAwoken);
+                    xRingbufferSendFromISR(adc_digi_ctx->ringbuf_hdl, result_buffer, result_size, &taskAwoken);
                     if (taskAwoken == pdTRUE) {
                         need_yield |= true;
                     }
@@ -177,8 +264,9 @@ esp_err_t adc_continuous_new_handle(const adc_continuous_handle_cfg_t *hdl_confi
     }
 
     //ringbuffer storage/struct buffer
+    uint32_t store_caps = hdl_config->flags.store_buf_in_psram ? (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT) : (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
     adc_ctx->ringbuf_size = hdl_config->max_store_buf_size;
-    adc_ctx->ringbuf_storage = heap_caps_calloc(1, hdl_config->max_store_buf_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    adc_ctx->ringbuf_storage = heap_caps_calloc(1, hdl_config->max_store_buf_size, store_caps);
     adc_ctx->ringbuf_struct = heap_caps_calloc(1, sizeof(StaticRingbuffer_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
     if (!adc_ctx->ringbuf_storage || !adc_ctx->ringbuf_struct) {
         ret = ESP_ERR_NO_MEM;
@@ -215,6 +303,18 @@ esp_err_t adc_continuous_new_handle(const adc_continuous_handle_cfg_t *hdl_confi
         goto cleanup;
     }
 
+    //decimation stage context, the staging buffer is accessed in the ISR, so it stays in internal RAM
+    if (hdl_config->decimation_factor > 1) {
+        adc_ctx->decimation_factor = hdl_config->decimation_factor;
+        adc_ctx->decim_sum = heap_caps_calloc(SOC_ADC_PERIPH_NUM * SOC_ADC_MAX_CHANNEL_NUM, sizeof(uint32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        adc_ctx->decim_cnt = heap_caps_calloc(SOC_ADC_PERIPH_NUM * SOC_ADC_MAX_CHANNEL_NUM, sizeof(uint32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        adc_ctx->decim_out_buf = heap_caps_calloc(1, hdl_config->conv_frame_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!adc_ctx->decim_sum || !adc_ctx->decim_cnt || !adc_ctx->decim_out_buf) {
+            ret = ESP_ERR_NO_MEM;
+            goto cleanup;
+        }
+    }
+
 #if CONFIG_PM_ENABLE
     ret = esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "adc_dma", &adc_ctx->pm_lock);
     if (ret != ESP_OK) {
@@ -409,6 +509,9 @@ esp_err_t adc_continuous_deinit(adc_continuous_handle_t handle)
     free(handle->rx_dma_buf);
     free(handle->hal.rx_desc);
     free(handle->hal_digi_ctrlr_cfg.adc_pattern);
+    free(handle->decim_sum);
+    free(handle->decim_cnt);
+    free(handle->decim_out_buf);
     adc_dma_deinit(handle->adc_dma);
     free(handle);
     handle = NULL;
@@ -472,6 +575,7 @@ esp_err_t adc_continuous_config(adc_continuous_handle_t handle, const adc_contin
     memcpy(handle->hal_digi_ctrlr_cfg.adc_pattern, config->adc_pattern, config->pattern_num * sizeof(adc_digi_pattern_config_t));
     handle->hal_digi_ctrlr_cfg.clk_src = ADC_DIGI_CLK_SRC_DEFAULT;
     handle->hal_digi_ctrlr_cfg.clk_src_freq_hz = clk_src_freq_hz;
+    handle->output_format = config->format;
 
     const int atten_uninitialized = 999;
     handle->adc1_atten = atten_uninitialized;
@@ -93,6 +93,11 @@ struct adc_continuous_ctx_t {
     struct {
         uint32_t flush_pool: 1;     //Flush the internal pool when the pool is full. With this flag, the `on_pool_ovf` event will not happen.
     } flags;
+    adc_digi_output_format_t        output_format;              //Conversion output format, needed to parse results in the decimation stage
+    uint32_t                        decimation_factor;          //Average each `decimation_factor` results per channel into one output result, 0/1: disabled
+    uint32_t                        *decim_sum;                 //Per-channel accumulators of the decimation stage, indexed by (unit, channel)
+    uint32_t                        *decim_cnt;                 //Per-channel result counters of the decimation stage, indexed by (unit, channel)
+    uint8_t                         *decim_out_buf;             //Staging buffer holding one decimated conversion frame
 #if SOC_ADC_DIG_IIR_FILTER_SUPPORTED
     adc_iir_filter_t                *iir_filter[SOC_ADC_DIGI_IIR_FILTER_NUM];  //ADC IIR filter context
 #endif
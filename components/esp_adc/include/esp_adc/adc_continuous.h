@@ -52,8 +52,15 @@ typedef struct adc_continuous_ctx_t *adc_continuous_handle_t;
 typedef struct {
     uint32_t max_store_buf_size;    ///< Max length of the conversion results that driver can store, in bytes.
     uint32_t conv_frame_size;       ///< Conversion frame size, in bytes. This should be in multiples of `SOC_ADC_DIGI_DATA_BYTES_PER_CONV`.
+    uint32_t decimation_factor;     ///< When set to N (N > 1), the driver averages every N conversion results of each channel into
+                                    ///< one result during the ISR buffer handoff, so the application receives ready-to-use,
+                                    ///< downsampled data at 1/N rate. The output keeps the conversion result format.
+                                    ///< Set to 0 or 1 to receive the raw conversion results.
     struct {
         uint32_t flush_pool: 1;     ///< Flush the internal pool when the pool is full.
+        uint32_t store_buf_in_psram: 1;  ///< Allocate the conversion result store buffer in PSRAM, keeping internal RAM free.
+                                         ///< Reading the results then streams from PSRAM, which fits large store buffers
+                                         ///< combined with `decimation_factor`.
     } flags;                        ///< Driver flags
 } adc_continuous_handle_cfg_t;
 
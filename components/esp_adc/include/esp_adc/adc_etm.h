@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "esp_etm.h"
+#include "esp_adc/adc_continuous.h"
+#include "hal/adc_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief ADC ETM event configuration
+ */
+typedef struct {
+    adc_etm_event_type_t event_type;    /*!< ADC ETM event type */
+} adc_etm_event_config_t;
+
+/**
+ * @brief Get the ETM event for ADC
+ *
+ * @note The created ETM event object can be deleted later by calling `esp_etm_del_event`
+ *
+ * @param[in] handle ADC continuous mode driver handle, allocated by `adc_continuous_new_handle()`
+ * @param[in] config ADC ETM event configuration
+ * @param[out] out_event Returned ETM event handle
+ * @return
+ *      - ESP_OK: Get ETM event successfully
+ *      - ESP_ERR_INVALID_ARG: Get ETM event failed because of invalid argument
+ *      - ESP_FAIL: Get ETM event failed because of other error
+ */
+esp_err_t adc_continuous_new_etm_event(adc_continuous_handle_t handle, const adc_etm_event_config_t *config, esp_etm_event_handle_t *out_event);
+
+/**
+ * @brief ADC ETM task configuration
+ */
+typedef struct {
+    adc_etm_task_type_t task_type;      /*!< ADC ETM task type */
+    adc_unit_t unit;                    /*!< ADC unit the task applies to. Only valid for `ADC_ETM_TASK_SAMPLE`,
+                                             `ADC_ETM_TASK_START` and `ADC_ETM_TASK_STOP` act on the whole digital controller */
+} adc_etm_task_config_t;
+
+/**
+ * @brief Get the ETM task for ADC
+ *
+ * @note The created ETM task object can be deleted later by calling `esp_etm_del_task`
+ * @note With the `ADC_ETM_TASK_SAMPLE` task connected to a timer event, conversions are paced entirely
+ *       by hardware and accumulate in the continuous mode DMA buffers, the CPU is only interrupted
+ *       once per conversion frame.
+ *
+ * @param[in] handle ADC continuous mode driver handle, allocated by `adc_continuous_new_handle()`
+ * @param[in] config ADC ETM task configuration
+ * @param[out] out_task Returned ETM task handle
+ * @return
+ *      - ESP_OK: Get ETM task successfully
+ *      - ESP_ERR_INVALID_ARG: Get ETM task failed because of invalid argument
+ *      - ESP_ERR_NOT_SUPPORTED: Get ETM task failed because the task is not supported on this ADC unit
+ *      - ESP_FAIL: Get ETM task failed because of other error
+ */
+esp_err_t adc_continuous_new_etm_task(adc_continuous_handle_t handle, const adc_etm_task_config_t *config, esp_etm_task_handle_t *out_task);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef __ESP_COEXIST_POLICY_H__
+#define __ESP_COEXIST_POLICY_H__
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Application coexistence scheduling policy
+ *
+ * A policy declares which traffic currently matters to the application and
+ * maps it onto the coexistence arbitration: the RF preference on the Wi-Fi
+ * side and, on chips with an 802.15.4 radio, the priority the 802.15.4
+ * driver requests for its TX/RX windows.
+ */
+typedef enum {
+    ESP_COEX_POLICY_BALANCED = 0,       /*!< Default arbitration, no protocol is favored */
+    ESP_COEX_POLICY_WIFI_BULK,          /*!< Wi-Fi throughput matters most, e.g. an OTA download
+                                             is in progress; 802.15.4 keeps only its scheduled
+                                             timeslots at elevated priority */
+    ESP_COEX_POLICY_IEEE802154_LATENCY, /*!< 802.15.4 latency matters most, e.g. alarm signaling
+                                             over Thread/Zigbee; its TX/RX windows are requested
+                                             at high priority so Wi-Fi traffic cannot starve them */
+    ESP_COEX_POLICY_NUM,
+} esp_coex_policy_t;
+
+/**
+ * @brief Per-policy usage counters
+ */
+typedef struct {
+    uint32_t switch_count;      /*!< Number of times this policy was entered */
+    int64_t total_active_us;    /*!< Cumulative time this policy was active, in microseconds */
+} esp_coex_policy_stats_t;
+
+/**
+ * @brief Set the coexistence scheduling policy
+ *
+ * Takes effect immediately for the Wi-Fi side preference; the 802.15.4
+ * driver picks the new priority up at its next TX/RX scene change (i.e.
+ * within one radio operation).
+ *
+ * @param policy Policy to apply
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if policy is out of range
+ */
+esp_err_t esp_coex_policy_set(esp_coex_policy_t policy);
+
+/**
+ * @brief Get the currently active coexistence scheduling policy
+ *
+ * @return Active policy, ESP_COEX_POLICY_BALANCED if never set
+ */
+esp_coex_policy_t esp_coex_policy_get(void);
+
+/**
+ * @brief Get the usage counters of a policy
+ *
+ * Reports how often and for how long a policy has been active, so fleet
+ * telemetry can correlate protocol latency with the phases the application
+ * declared. Per-packet arbitration outcomes on the 802.15.4 side are
+ * available separately through CONFIG_IEEE802154_TXRX_STATISTIC.
+ *
+ * @param[in] policy Policy to query
+ * @param[out] stats Filled with the counters of the policy
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if policy is out of range or stats is NULL
+ */
+esp_err_t esp_coex_policy_get_stats(esp_coex_policy_t policy, esp_coex_policy_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ESP_COEXIST_POLICY_H__ */
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_coexist.h"
+#include "esp_coexist_policy.h"
+#include "private/esp_coexist_internal.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+
+#if CONFIG_SOC_IEEE802154_SUPPORTED
+#include "esp_coex_i154.h"
+#endif
+
+static volatile esp_coex_policy_t s_coex_policy = ESP_COEX_POLICY_BALANCED;
+static esp_coex_policy_stats_t s_coex_policy_stats[ESP_COEX_POLICY_NUM];
+static int64_t s_coex_policy_since_us;
+static portMUX_TYPE s_coex_policy_lock = portMUX_INITIALIZER_UNLOCKED;
+
+esp_err_t esp_coex_policy_set(esp_coex_policy_t policy)
+{
+    if (policy >= ESP_COEX_POLICY_NUM) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&s_coex_policy_lock);
+    if (s_coex_policy_since_us != 0) {
+        s_coex_policy_stats[s_coex_policy].total_active_us += now - s_coex_policy_since_us;
+    }
+    s_coex_policy = policy;
+    s_coex_policy_stats[policy].switch_count++;
+    s_coex_policy_since_us = now;
+    portEXIT_CRITICAL(&s_coex_policy_lock);
+
+    /* The Wi-Fi side preference takes effect immediately. The 802.15.4 TX/RX
+     * priority is not forced here: the 802.15.4 driver re-issues its PTI on
+     * every scene change and consults the active policy when doing so. */
+    coex_prefer_t prefer = (policy == ESP_COEX_POLICY_WIFI_BULK) ? COEX_PREFER_WIFI : COEX_PREFER_BALANCE;
+    esp_err_t ret = coex_preference_set(prefer);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+#if CONFIG_SOC_IEEE802154_SUPPORTED
+    /* ACK windows are short and timing critical; keep them above Wi-Fi data
+     * whenever 802.15.4 latency is what the application cares about. */
+    esp_coex_ieee802154_ack_pti_set((policy == ESP_COEX_POLICY_IEEE802154_LATENCY) ? IEEE802154_HIGH : IEEE802154_MIDDLE);
+#endif
+    return ESP_OK;
+}
+
+esp_coex_policy_t esp_coex_policy_get(void)
+{
+    return s_coex_policy;
+}
+
+esp_err_t esp_coex_policy_get_stats(esp_coex_policy_t policy, esp_coex_policy_stats_t *stats)
+{
+    if (policy >= ESP_COEX_POLICY_NUM || stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&s_coex_policy_lock);
+    *stats = s_coex_policy_stats[policy];
+    if (policy == s_coex_policy && s_coex_policy_since_us != 0) {
+        stats->total_active_us += esp_timer_get_time() - s_coex_policy_since_us;
+    }
+    portEXIT_CRITICAL(&s_coex_policy_lock);
+    return ESP_OK;
+}
@@ -0,0 +1,380 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cassert>
+#include <cerrno>
+#include "esp_coro.hpp"
+#include "esp_check.h"
+#include "esp_log.h"
+#if CONFIG_ESP_CORO_SOCKETS
+#include <unistd.h>
+#include <sys/select.h>
+#include "esp_vfs_eventfd.h"
+#endif
+
+static const char *TAG = "esp_coro";
+
+namespace esp_coro {
+
+using detail::queue_waiter;
+using detail::event_waiter;
+
+// executors resume coroutines only in their own task, so the current executor
+// is a property of the running task
+static thread_local executor *s_current_executor = nullptr;
+
+executor *executor::current()
+{
+    return s_current_executor;
+}
+
+esp_err_t executor::start(const config_t &config)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(!m_task, ESP_ERR_INVALID_STATE, TAG, "executor already started");
+    ESP_RETURN_ON_FALSE(config.wait_capacity >= config.ready_queue_len, ESP_ERR_INVALID_ARG, TAG,
+                        "wait capacity smaller than ready queue");
+
+    m_ready_q = xQueueCreate(config.ready_queue_len, sizeof(std::coroutine_handle<>));
+    ESP_GOTO_ON_FALSE(m_ready_q, ESP_ERR_NO_MEM, err, TAG, "no mem for ready queue");
+    m_queue_set = xQueueCreateSet(config.wait_capacity);
+    ESP_GOTO_ON_FALSE(m_queue_set, ESP_ERR_NO_MEM, err, TAG, "no mem for queue set");
+    ESP_GOTO_ON_FALSE(xQueueAddToSet(m_ready_q, m_queue_set) == pdPASS, ESP_FAIL, err, TAG,
+                      "failed to add ready queue to set");
+
+#if CONFIG_ESP_CORO_SOCKETS
+    esp_vfs_eventfd_config_t efd_config = ESP_VFS_EVENTD_CONFIG_DEFAULT();
+    ret = esp_vfs_eventfd_register(&efd_config);
+    // the application may have registered the eventfd vfs already
+    ESP_GOTO_ON_FALSE(ret == ESP_OK || ret == ESP_ERR_INVALID_STATE, ret, err, TAG,
+                      "failed to register eventfd vfs");
+    m_wakeup_fd = eventfd(0, 0);
+    ESP_GOTO_ON_FALSE(m_wakeup_fd >= 0, ESP_FAIL, err, TAG, "failed to create wakeup eventfd");
+    ESP_GOTO_ON_FALSE(xTaskCreatePinnedToCore(select_task, "coro_select",
+                                              CONFIG_ESP_CORO_SELECT_TASK_STACK_SIZE, this,
+                                              config.priority, &m_select_task, config.core_id) == pdPASS,
+                      ESP_ERR_NO_MEM, err, TAG, "no mem for select task");
+#endif
+    ESP_GOTO_ON_FALSE(xTaskCreatePinnedToCore(run_task, "esp_coro", config.stack_size, this,
+                                              config.priority, &m_task, config.core_id) == pdPASS,
+                      ESP_ERR_NO_MEM, err, TAG, "no mem for executor task");
+    return ESP_OK;
+
+err:
+#if CONFIG_ESP_CORO_SOCKETS
+    if (m_select_task) {
+        vTaskDelete(m_select_task);
+        m_select_task = nullptr;
+    }
+    if (m_wakeup_fd >= 0) {
+        close(m_wakeup_fd);
+        m_wakeup_fd = -1;
+    }
+#endif
+    if (m_queue_set) {
+        xQueueRemoveFromSet(m_ready_q, m_queue_set);
+        vQueueDelete(m_queue_set);
+        m_queue_set = nullptr;
+    }
+    if (m_ready_q) {
+        vQueueDelete(m_ready_q);
+        m_ready_q = nullptr;
+    }
+    return ret;
+}
+
+executor::~executor()
+{
+    // destroying an executor with coroutines in flight is not supported: the
+    // frames of suspended coroutines would leak together with their wakeup
+    // sources, only tear down the plumbing of a never-used executor here
+    assert(!m_queue_waiters && !m_event_waiters);
+    if (m_task) {
+        vTaskDelete(m_task);
+    }
+#if CONFIG_ESP_CORO_SOCKETS
+    assert(!m_fd_waiters);
+    if (m_select_task) {
+        vTaskDelete(m_select_task);
+    }
+    if (m_wakeup_fd >= 0) {
+        close(m_wakeup_fd);
+    }
+#endif
+    if (m_queue_set) {
+        if (m_ready_q) {
+            xQueueRemoveFromSet(m_ready_q, m_queue_set);
+        }
+        vQueueDelete(m_queue_set);
+    }
+    if (m_ready_q) {
+        vQueueDelete(m_ready_q);
+    }
+}
+
+esp_err_t executor::spawn(task &&t)
+{
+    ESP_RETURN_ON_FALSE(m_task, ESP_ERR_INVALID_STATE, TAG, "executor not started");
+    ESP_RETURN_ON_FALSE(t.m_handle, ESP_ERR_INVALID_ARG, TAG, "empty task");
+    std::coroutine_handle<task::promise_type> handle = t.m_handle;
+    handle.promise().detached = true;
+    std::coroutine_handle<> generic = handle;
+    if (xQueueSend(m_ready_q, &generic, 0) != pdTRUE) {
+        handle.promise().detached = false;
+        return ESP_ERR_TIMEOUT;
+    }
+    // ownership moved to the executor, the frame self-destroys on completion
+    t.m_handle = nullptr;
+    return ESP_OK;
+}
+
+void executor::post_ready(std::coroutine_handle<> handle)
+{
+    // called from completion contexts (esp_timer task, select task): block
+    // until the executor drains the queue rather than losing a coroutine
+    xQueueSend(m_ready_q, &handle, portMAX_DELAY);
+}
+
+void executor::run_task(void *arg)
+{
+    static_cast<executor *>(arg)->run();
+}
+
+void executor::run()
+{
+    s_current_executor = this;
+    while (true) {
+        // event group waits have no queue to multiplex, poll them periodically
+        TickType_t timeout = m_event_waiters ? pdMS_TO_TICKS(CONFIG_ESP_CORO_EVENT_POLL_PERIOD_MS) : portMAX_DELAY;
+        QueueSetMemberHandle_t member = xQueueSelectFromSet(m_queue_set, timeout);
+        if (member == m_ready_q) {
+            std::coroutine_handle<> handle;
+            if (xQueueReceive(m_ready_q, &handle, 0) == pdTRUE) {
+                handle.resume();
+            }
+        } else if (member != nullptr) {
+            service_queue(reinterpret_cast<QueueHandle_t>(member));
+        }
+        poll_event_waiters();
+    }
+}
+
+void executor::service_queue(QueueHandle_t queue)
+{
+    queue_waiter **indirect = &m_queue_waiters;
+    while (*indirect && (*indirect)->queue != queue) {
+        indirect = &(*indirect)->next;
+    }
+    queue_waiter *waiter = *indirect;
+    if (!waiter) {
+        // stale readiness event, the membership is reclaimed by the next waiter
+        return;
+    }
+    if (xQueueReceive(queue, waiter->item, 0) != pdTRUE) {
+        return;
+    }
+    *indirect = waiter->next;
+    bool more_waiters = false;
+    for (queue_waiter *it = m_queue_waiters; it; it = it->next) {
+        if (it->queue == queue) {
+            more_waiters = true;
+            break;
+        }
+    }
+    if (!more_waiters) {
+        // fails when items are pending, the membership then stays behind and
+        // is reused by the next waiter on this queue
+        xQueueRemoveFromSet(queue, m_queue_set);
+    }
+    waiter->handle.resume();
+}
+
+void executor::poll_event_waiters()
+{
+    event_waiter **indirect = &m_event_waiters;
+    while (*indirect) {
+        event_waiter *waiter = *indirect;
+        EventBits_t bits = xEventGroupGetBits(waiter->group);
+        bool met = waiter->wait_all ? ((bits & waiter->bits) == waiter->bits) : ((bits & waiter->bits) != 0);
+        if (!met) {
+            indirect = &waiter->next;
+            continue;
+        }
+        waiter->result = xEventGroupClearBits(waiter->group, waiter->clear_on_exit ? waiter->bits : 0);
+        *indirect = waiter->next;
+        waiter->handle.resume();
+        // the resumed coroutine may have registered or satisfied other waits
+        indirect = &m_event_waiters;
+    }
+}
+
+static void sleep_timer_cb(void *arg)
+{
+    sleep_awaiter *awaiter = static_cast<sleep_awaiter *>(arg);
+    awaiter->exec->post_ready(awaiter->handle);
+}
+
+void sleep_awaiter::await_suspend(std::coroutine_handle<> h)
+{
+    exec = executor::current();
+    assert(exec && "esp_coro awaitables can only be awaited on an executor");
+    handle = h;
+    const esp_timer_create_args_t timer_args = {
+        .callback = sleep_timer_cb,
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "coro_sleep",
+        .skip_unhandled_events = false,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &timer));
+    ESP_ERROR_CHECK(esp_timer_start_once(timer, delay_us));
+}
+
+void sleep_awaiter::await_resume()
+{
+    if (timer) {
+        esp_timer_delete(timer);
+        timer = nullptr;
+    }
+}
+
+bool queue_recv_awaiter::await_suspend(std::coroutine_handle<> h)
+{
+    exec = executor::current();
+    assert(exec && "esp_coro awaitables can only be awaited on an executor");
+    bool in_set = false;
+    for (queue_waiter *it = exec->m_queue_waiters; it; it = it->next) {
+        if (it->queue == queue) {
+            in_set = true;
+            break;
+        }
+    }
+    if (!in_set && xQueueAddToSet(queue, exec->m_queue_set) != pdPASS) {
+        if (xQueueReceive(queue, item, 0) == pdTRUE) {
+            // an item arrived between await_ready() and here, no need to suspend
+            return false;
+        }
+        // the queue is empty yet already in the set: stale membership left
+        // behind by a previous waiter, reuse it
+    }
+    waiter.queue = queue;
+    waiter.item = item;
+    waiter.handle = h;
+    waiter.next = nullptr;
+    // append so concurrent waiters on one queue are served in FIFO order
+    queue_waiter **indirect = &exec->m_queue_waiters;
+    while (*indirect) {
+        indirect = &(*indirect)->next;
+    }
+    *indirect = &waiter;
+    return true;
+}
+
+bool event_bits_awaiter::await_ready()
+{
+    EventBits_t cur = xEventGroupGetBits(group);
+    bool met = wait_all ? ((cur & bits) == bits) : ((cur & bits) != 0);
+    if (met) {
+        waiter.result = xEventGroupClearBits(group, clear_on_exit ? bits : 0);
+    }
+    return met;
+}
+
+void event_bits_awaiter::await_suspend(std::coroutine_handle<> h)
+{
+    executor *exec = executor::current();
+    assert(exec && "esp_coro awaitables can only be awaited on an executor");
+    waiter.group = group;
+    waiter.bits = bits;
+    waiter.clear_on_exit = clear_on_exit;
+    waiter.wait_all = wait_all;
+    waiter.handle = h;
+    waiter.next = exec->m_event_waiters;
+    exec->m_event_waiters = &waiter;
+}
+
+#if CONFIG_ESP_CORO_SOCKETS
+
+using detail::fd_waiter;
+
+void fd_awaiter::await_suspend(std::coroutine_handle<> h)
+{
+    executor *exec = executor::current();
+    assert(exec && "esp_coro awaitables can only be awaited on an executor");
+    waiter.fd = fd;
+    waiter.write = write;
+    waiter.handle = h;
+    portENTER_CRITICAL(&exec->m_fd_lock);
+    waiter.next = exec->m_fd_waiters;
+    exec->m_fd_waiters = &waiter;
+    portEXIT_CRITICAL(&exec->m_fd_lock);
+    exec->wake_select_task();
+}
+
+void executor::wake_select_task()
+{
+    uint64_t val = 1;
+    write(m_wakeup_fd, &val, sizeof(val));
+}
+
+void executor::select_task(void *arg)
+{
+    executor *self = static_cast<executor *>(arg);
+    while (true) {
+        fd_set read_fds;
+        fd_set write_fds;
+        FD_ZERO(&read_fds);
+        FD_ZERO(&write_fds);
+        FD_SET(self->m_wakeup_fd, &read_fds);
+        int max_fd = self->m_wakeup_fd;
+        portENTER_CRITICAL(&self->m_fd_lock);
+        for (fd_waiter *w = self->m_fd_waiters; w; w = w->next) {
+            FD_SET(w->fd, w->write ? &write_fds : &read_fds);
+            if (w->fd > max_fd) {
+                max_fd = w->fd;
+            }
+        }
+        portEXIT_CRITICAL(&self->m_fd_lock);
+
+        int ret = select(max_fd + 1, &read_fds, &write_fds, nullptr, nullptr);
+        if (ret <= 0) {
+            // typically EBADF from a descriptor closed while awaited, back off
+            // so the error does not spin this task at full speed
+            ESP_LOGW(TAG, "select failed, errno %d", errno);
+            vTaskDelay(1);
+            continue;
+        }
+        if (FD_ISSET(self->m_wakeup_fd, &read_fds)) {
+            uint64_t val;
+            read(self->m_wakeup_fd, &val, sizeof(val));
+        }
+
+        fd_waiter *ready = nullptr;
+        portENTER_CRITICAL(&self->m_fd_lock);
+        fd_waiter **indirect = &self->m_fd_waiters;
+        while (*indirect) {
+            fd_waiter *w = *indirect;
+            if (FD_ISSET(w->fd, w->write ? &write_fds : &read_fds)) {
+                *indirect = w->next;
+                w->next = ready;
+                ready = w;
+            } else {
+                indirect = &w->next;
+            }
+        }
+        portEXIT_CRITICAL(&self->m_fd_lock);
+
+        while (ready) {
+            fd_waiter *w = ready;
+            ready = w->next;
+            self->post_ready(w->handle);
+        }
+    }
+}
+
+#endif // CONFIG_ESP_CORO_SOCKETS
+
+} // namespace esp_coro
@@ -0,0 +1,384 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/event_groups.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+
+/**
+ * @file esp_coro.hpp
+ * @brief Single-task C++20 coroutine executor over FreeRTOS
+ *
+ * One FreeRTOS task drives an arbitrary number of logical sessions written as
+ * coroutines. A suspended coroutine costs only its frame on the heap instead
+ * of a dedicated task stack, so I/O-bound fan-out (many mostly-blocked
+ * sessions) scales with frame size rather than with minimum task stack size.
+ *
+ * Coroutines resume exclusively in the executor task, so state shared between
+ * coroutines of one executor needs no locking. Blocking FreeRTOS or socket
+ * calls inside a coroutine stall every session on the executor; use the
+ * awaitables below instead.
+ */
+
+namespace esp_coro {
+
+class executor;
+
+namespace detail {
+
+struct queue_waiter {
+    queue_waiter *next;
+    QueueHandle_t queue;
+    void *item;
+    std::coroutine_handle<> handle;
+};
+
+struct event_waiter {
+    event_waiter *next;
+    EventGroupHandle_t group;
+    EventBits_t bits;
+    bool clear_on_exit;
+    bool wait_all;
+    EventBits_t result;
+    std::coroutine_handle<> handle;
+};
+
+#if CONFIG_ESP_CORO_SOCKETS
+struct fd_waiter {
+    fd_waiter *next;
+    int fd;
+    bool write;
+    std::coroutine_handle<> handle;
+};
+#endif
+
+} // namespace detail
+
+/**
+ * @brief Coroutine return type
+ *
+ * A function returning `task` and containing at least one `co_await` or
+ * `co_return` is a coroutine. The coroutine body does not start running until
+ * the task is either spawned on an executor (`executor::spawn`) or awaited
+ * from another coroutine (`co_await some_task()`), in which case it runs to
+ * completion before the awaiting coroutine resumes.
+ */
+class task {
+public:
+    struct promise_type {
+        std::coroutine_handle<> continuation {};
+        bool detached = false;
+
+        task get_return_object()
+        {
+            return task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        struct final_awaiter {
+            bool await_ready() noexcept
+            {
+                return false;
+            }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept
+            {
+                promise_type &promise = h.promise();
+                std::coroutine_handle<> cont = promise.continuation;
+                if (promise.detached) {
+                    // spawned task: nobody owns the frame anymore, reclaim it here
+                    h.destroy();
+                }
+                return cont ? cont : std::noop_coroutine();
+            }
+            void await_resume() noexcept {}
+        };
+        final_awaiter final_suspend() noexcept
+        {
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception()
+        {
+            // a coroutine body must not leak exceptions into the executor
+            abort();
+        }
+    };
+
+    task() = default;
+    explicit task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+    task(task &&other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    task &operator=(task &&other) noexcept
+    {
+        if (this != &other) {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+    task(const task &) = delete;
+    task &operator=(const task &) = delete;
+    ~task()
+    {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+    /** @cond - awaiter interface for `co_await` on a sub-task */
+    bool await_ready() const noexcept
+    {
+        return !m_handle || m_handle.done();
+    }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> cont) noexcept
+    {
+        m_handle.promise().continuation = cont;
+        return m_handle;
+    }
+    void await_resume() const noexcept {}
+    /** @endcond */
+
+private:
+    friend class executor;
+    std::coroutine_handle<promise_type> m_handle {};
+};
+
+/**
+ * @brief Awaitable returned by `sleep_for_us()`
+ */
+struct sleep_awaiter {
+    uint64_t delay_us;                     /*!< Delay before resumption, in microseconds */
+    executor *exec = nullptr;              /*!< Executor driving the awaiting coroutine */
+    esp_timer_handle_t timer = nullptr;    /*!< One-shot timer backing the delay */
+    std::coroutine_handle<> handle {};     /*!< Awaiting coroutine */
+
+    bool await_ready() const noexcept
+    {
+        return delay_us == 0;
+    }
+    void await_suspend(std::coroutine_handle<> h);
+    void await_resume();
+};
+
+/**
+ * @brief Awaitable returned by `queue_receive()`
+ */
+struct queue_recv_awaiter {
+    QueueHandle_t queue;                   /*!< Queue to receive from */
+    void *item;                            /*!< Destination buffer for the received item */
+    executor *exec = nullptr;              /*!< Executor driving the awaiting coroutine */
+    detail::queue_waiter waiter {};        /*!< Registration node, lives in the coroutine frame */
+
+    bool await_ready()
+    {
+        return xQueueReceive(queue, item, 0) == pdTRUE;
+    }
+    bool await_suspend(std::coroutine_handle<> h);
+    void await_resume() const noexcept {}
+};
+
+/**
+ * @brief Awaitable returned by `wait_bits()`
+ */
+struct event_bits_awaiter {
+    EventGroupHandle_t group;              /*!< Event group to wait on */
+    EventBits_t bits;                      /*!< Bits to wait for */
+    bool clear_on_exit;                    /*!< Whether to clear the waited bits on resumption */
+    bool wait_all;                         /*!< true: all bits must be set, false: any bit suffices */
+    detail::event_waiter waiter {};        /*!< Registration node, lives in the coroutine frame */
+
+    bool await_ready();
+    void await_suspend(std::coroutine_handle<> h);
+    EventBits_t await_resume() const noexcept
+    {
+        return waiter.result;
+    }
+};
+
+#if CONFIG_ESP_CORO_SOCKETS || __DOXYGEN__
+/**
+ * @brief Awaitable returned by `readable()` / `writable()`
+ */
+struct fd_awaiter {
+    int fd;                                /*!< File descriptor to wait on, must be selectable through VFS */
+    bool write;                            /*!< true: wait for writability, false: readability */
+    detail::fd_waiter waiter {};           /*!< Registration node, lives in the coroutine frame */
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+    void await_suspend(std::coroutine_handle<> h);
+    void await_resume() const noexcept {}
+};
+#endif // CONFIG_ESP_CORO_SOCKETS
+
+/**
+ * @brief Coroutine executor bound to one FreeRTOS task
+ *
+ * All coroutines spawned on an executor resume in its task, one at a time.
+ * Multiple executors (e.g. one per core) are independent.
+ */
+class executor {
+public:
+    /**
+     * @brief Executor configuration
+     */
+    struct config_t {
+        uint32_t stack_size = 6144;            /*!< Executor task stack size in bytes, shared by all coroutine bodies */
+        UBaseType_t priority = 5;              /*!< Executor task priority */
+        BaseType_t core_id = tskNO_AFFINITY;   /*!< Core the executor task is pinned to */
+        UBaseType_t ready_queue_len = 16;      /*!< Capacity of the ready-to-resume queue */
+        UBaseType_t wait_capacity = 64;        /*!< Queue set length, must cover the ready queue plus the
+                                                    total length of all queues concurrently awaited */
+    };
+
+    executor() = default;
+    ~executor();
+    executor(const executor &) = delete;
+    executor &operator=(const executor &) = delete;
+
+    /**
+     * @brief Create the executor task and start dispatching
+     *
+     * @param[in] config Executor configuration
+     * @return
+     *      - ESP_OK: Executor started successfully
+     *      - ESP_ERR_INVALID_STATE: Executor is already started
+     *      - ESP_ERR_NO_MEM: Out of memory
+     */
+    esp_err_t start(const config_t &config);
+
+    /**
+     * @brief Hand a coroutine over to the executor and detach it
+     *
+     * The coroutine frame is destroyed automatically when the coroutine runs
+     * to completion. Can be called from any task.
+     *
+     * @param[in] t Task to spawn, moved from on success
+     * @return
+     *      - ESP_OK: Coroutine queued for execution
+     *      - ESP_ERR_INVALID_STATE: Executor is not started
+     *      - ESP_ERR_INVALID_ARG: Empty task
+     *      - ESP_ERR_TIMEOUT: Ready queue is full, task is left untouched
+     */
+    esp_err_t spawn(task &&t);
+
+    /**
+     * @brief Executor driving the calling coroutine
+     *
+     * @return Executor whose task the caller runs in, NULL when called from
+     *         outside any executor task
+     */
+    static executor *current();
+
+private:
+    friend struct sleep_awaiter;
+    friend struct queue_recv_awaiter;
+    friend struct event_bits_awaiter;
+#if CONFIG_ESP_CORO_SOCKETS
+    friend struct fd_awaiter;
+#endif
+
+    static void run_task(void *arg);
+    void run();
+    void post_ready(std::coroutine_handle<> handle);
+    void service_queue(QueueHandle_t queue);
+    void poll_event_waiters();
+
+    TaskHandle_t m_task = nullptr;
+    QueueHandle_t m_ready_q = nullptr;
+    QueueSetHandle_t m_queue_set = nullptr;
+    detail::queue_waiter *m_queue_waiters = nullptr;
+    detail::event_waiter *m_event_waiters = nullptr;
+#if CONFIG_ESP_CORO_SOCKETS
+    static void select_task(void *arg);
+    void wake_select_task();
+
+    TaskHandle_t m_select_task = nullptr;
+    int m_wakeup_fd = -1;
+    detail::fd_waiter *m_fd_waiters = nullptr;
+    portMUX_TYPE m_fd_lock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+};
+
+/**
+ * @brief Suspend the calling coroutine for `delay_us` microseconds
+ *
+ * Backed by a one-shot `esp_timer`; other coroutines keep running meanwhile.
+ */
+inline sleep_awaiter sleep_for_us(uint64_t delay_us)
+{
+    return sleep_awaiter{delay_us};
+}
+
+/**
+ * @brief Suspend the calling coroutine until an item arrives on `queue`
+ *
+ * The executor must be the only consumer of an awaited queue, and the queue
+ * must not be a member of another FreeRTOS queue set.
+ *
+ * @param[in] queue Queue to receive from
+ * @param[out] item Destination buffer, sized for one queue item
+ */
+inline queue_recv_awaiter queue_receive(QueueHandle_t queue, void *item)
+{
+    return queue_recv_awaiter{queue, item};
+}
+
+/**
+ * @brief Suspend the calling coroutine until the requested event bits are set
+ *
+ * Event groups carry no wakeup that a queue set can multiplex, so pending
+ * waits are polled every `CONFIG_ESP_CORO_EVENT_POLL_PERIOD_MS` milliseconds.
+ *
+ * @param[in] group Event group to wait on
+ * @param[in] bits Bits to wait for
+ * @param[in] clear_on_exit Whether to clear `bits` when the wait completes
+ * @param[in] wait_all true: wait for all of `bits`, false: any of them
+ * @return (via `co_await`) The event group bits at the time the wait completed
+ */
+inline event_bits_awaiter wait_bits(EventGroupHandle_t group, EventBits_t bits, bool clear_on_exit, bool wait_all)
+{
+    return event_bits_awaiter{group, bits, clear_on_exit, wait_all};
+}
+
+#if CONFIG_ESP_CORO_SOCKETS || __DOXYGEN__
+/**
+ * @brief Suspend the calling coroutine until `fd` becomes readable
+ *
+ * Readiness is detected with `select()` through VFS, so lwIP sockets and any
+ * other selectable descriptor work. Follow up with a non-blocking `recv`/`read`.
+ */
+inline fd_awaiter readable(int fd)
+{
+    return fd_awaiter{fd, false};
+}
+
+/**
+ * @brief Suspend the calling coroutine until `fd` becomes writable
+ */
+inline fd_awaiter writable(int fd)
+{
+    return fd_awaiter{fd, true};
+}
+#endif // CONFIG_ESP_CORO_SOCKETS
+
+} // namespace esp_coro
@@ -28,6 +28,11 @@ typedef struct {
     cam_ctlr_color_t input_data_color_type;     ///< Input color type
     cam_ctlr_color_t output_data_color_type;    ///< Output color type
     int queue_items;                            ///< Queue items
+    uint32_t loan_buffer_num;                   ///< Number of driver-owned frame buffers for the frame-loan pipeline, at least 2.
+                                                ///< When set, finished frames are handed out by reference via the `on_trans_finished`
+                                                ///< callback and must be given back with `esp_cam_ctlr_csi_return_buffer` once consumed
+                                                ///< (e.g. after JPEG encode), eliminating the copy out of the driver buffer.
+                                                ///< Set to 0 to provide receive buffers via `esp_cam_ctlr_receive` / `on_get_new_trans` instead
     struct {
         uint32_t byte_swap_en   : 1;            ///< Enable byte swap
         uint32_t bk_buffer_dis  : 1;            ///< Disable backup buffer
@@ -49,6 +54,25 @@ typedef struct {
  */
 esp_err_t esp_cam_new_csi_ctlr(const esp_cam_ctlr_csi_config_t *config, esp_cam_ctlr_handle_t *ret_handle);
 
+/**
+ * @brief Return a loaned frame buffer to the CSI controller
+ *
+ * In the frame-loan pipeline (see `loan_buffer_num`), a frame buffer handed out via the
+ * `on_trans_finished` callback stays on loan to the caller until it is returned with this function.
+ * While all buffers are on loan, newly finished frames are dropped instead of overwriting loaned data.
+ *
+ * @note This function can be called from an ISR context, e.g. from a DMA done callback of the consumer.
+ *
+ * @param[in] handle ESP CAM controller handle, created by `esp_cam_new_csi_ctlr`
+ * @param[in] buffer Frame buffer received from the `on_trans_finished` callback
+ *
+ * @return
+ *        - ESP_OK
+ *        - ESP_ERR_INVALID_ARG:   Invalid argument, or the buffer is not a loaned frame buffer
+ *        - ESP_ERR_INVALID_STATE: The frame-loan pipeline is not enabled, or the buffer is returned already
+ */
+esp_err_t esp_cam_ctlr_csi_return_buffer(esp_cam_ctlr_handle_t handle, const void *buffer);
+
 #ifdef __cplusplus
 }
 #endif
@@ -155,20 +155,36 @@ esp_err_t esp_cam_new_csi_ctlr(const esp_cam_ctlr_csi_config_t *config, esp_cam_
     ctlr->fb_size_in_bytes = fb_size_in_bits / 8;
     ESP_LOGD(TAG, "ctlr->fb_size_in_bytes=%d", ctlr->fb_size_in_bytes);
 
+    size_t dma_alignment = 4;  //TODO: IDF-9126, replace with dwgdma alignment API
+    size_t cache_alignment = 1;
+    ESP_GOTO_ON_ERROR(esp_cache_get_alignment(MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA, &cache_alignment), err, TAG, "failed to get cache alignment");
+    size_t alignment = MAX(cache_alignment, dma_alignment);
+    ESP_LOGD(TAG, "alignment: 0x%x\n", alignment);
+
     ctlr->bk_buffer_dis = config->bk_buffer_dis;
     if (!ctlr->bk_buffer_dis) {
-        size_t dma_alignment = 4;  //TODO: IDF-9126, replace with dwgdma alignment API
-        size_t cache_alignment = 1;
-        ESP_GOTO_ON_ERROR(esp_cache_get_alignment(MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA, &cache_alignment), err, TAG, "failed to get cache alignment");
-        size_t alignment = MAX(cache_alignment, dma_alignment);
-        ESP_LOGD(TAG, "alignment: 0x%x\n", alignment);
-
         ctlr->backup_buffer = heap_caps_aligned_alloc(alignment, ctlr->fb_size_in_bytes, MALLOC_CAP_SPIRAM);
         ESP_GOTO_ON_FALSE(ctlr->backup_buffer, ESP_ERR_NO_MEM, err, TAG, "no mem for backup buffer");
         ESP_LOGD(TAG, "ctlr->backup_buffer: %p\n", ctlr->backup_buffer);
         esp_cache_msync((void *)(ctlr->backup_buffer), ctlr->fb_size_in_bytes, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
     }
 
+    if (config->loan_buffer_num) {
+        ESP_GOTO_ON_FALSE(config->loan_buffer_num >= 2, ESP_ERR_INVALID_ARG, err, TAG, "at least 2 loan buffers are needed to overlap receive and consume");
+        ctlr->loan_buffers = heap_caps_calloc(config->loan_buffer_num, sizeof(void *), CSI_MEM_ALLOC_CAPS);
+        ESP_GOTO_ON_FALSE(ctlr->loan_buffers, ESP_ERR_NO_MEM, err, TAG, "no mem for loan buffer array");
+        ctlr->loan_free_que = xQueueCreateWithCaps(config->loan_buffer_num, sizeof(void *), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        ESP_GOTO_ON_FALSE(ctlr->loan_free_que, ESP_ERR_NO_MEM, err, TAG, "no memory for loan buffer queue");
+        ctlr->loan_buffer_num = config->loan_buffer_num;
+        for (uint32_t i = 0; i < config->loan_buffer_num; i++) {
+            ctlr->loan_buffers[i] = heap_caps_aligned_alloc(alignment, ctlr->fb_size_in_bytes, MALLOC_CAP_SPIRAM);
+            ESP_GOTO_ON_FALSE(ctlr->loan_buffers[i], ESP_ERR_NO_MEM, err, TAG, "no mem for loan buffer");
+            esp_cache_msync(ctlr->loan_buffers[i], ctlr->fb_size_in_bytes, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+            xQueueSend(ctlr->loan_free_que, &ctlr->loan_buffers[i], 0);
+        }
+        ctlr->loan_buffer_num = config->loan_buffer_num;
+    }
+
     mipi_csi_hal_config_t hal_config;
     hal_config.frame_height = config->h_res;
     hal_config.frame_width = config->v_res;
@@ -253,6 +269,17 @@ esp_err_t s_del_csi_ctlr(csi_controller_t *ctlr)
     if (!ctlr->bk_buffer_dis) {
         free(ctlr->backup_buffer);
     }
+    if (ctlr->loan_buffers) {
+        for (uint32_t i = 0; i < ctlr->loan_buffer_num; i++) {
+            if (ctlr->loan_buffers[i]) {
+                free(ctlr->loan_buffers[i]);
+            }
+        }
+        free(ctlr->loan_buffers);
+    }
+    if (ctlr->loan_free_que) {
+        vQueueDeleteWithCaps(ctlr->loan_free_que);
+    }
     vQueueDeleteWithCaps(ctlr->trans_que);
     free(ctlr);
 
@@ -323,7 +350,16 @@ IRAM_ATTR static bool csi_dma_trans_done_callback(dw_gdma_channel_handle_t chan,
     };
     esp_cam_ctlr_trans_t new_trans = {};
 
-    if (ctlr->cbs.on_get_new_trans) {
+    if (ctlr->loan_buffer_num) {
+        void *free_buf = NULL;
+        if (xQueueReceiveFromISR(ctlr->loan_free_que, &free_buf, &high_task_woken) == pdTRUE) {
+            new_trans.buffer = free_buf;
+            new_trans.buflen = ctlr->fb_size_in_bytes;
+            new_trans.received_size = ctlr->fb_size_in_bytes;
+            csi_dma_transfer_config.dst.addr = (uint32_t)free_buf;
+            has_new_trans = true;
+        }
+    } else if (ctlr->cbs.on_get_new_trans) {
         need_yield = ctlr->cbs.on_get_new_trans(&(ctlr->base), &new_trans, ctlr->cbs_user_data);
         if (new_trans.buffer && new_trans.buflen >= ctlr->fb_size_in_bytes) {
             csi_dma_transfer_config.dst.addr = (uint32_t)(new_trans.buffer);
@@ -337,7 +373,12 @@ IRAM_ATTR static bool csi_dma_trans_done_callback(dw_gdma_channel_handle_t chan,
     }
 
     if (!has_new_trans) {
-        if (!ctlr->bk_buffer_dis) {
+        if (ctlr->loan_buffer_num) {
+            // All loaned buffers are still on loan, overwrite the just finished frame instead of loaned data
+            new_trans = ctlr->trans;
+            ESP_EARLY_LOGD(TAG, "all loan buffers on loan, dropping frame");
+            csi_dma_transfer_config.dst.addr = (uint32_t)new_trans.buffer;
+        } else if (!ctlr->bk_buffer_dis) {
             new_trans.buffer = ctlr->backup_buffer;
             new_trans.buflen = ctlr->fb_size_in_bytes;
             ESP_EARLY_LOGD(TAG, "no new buffer or no long enough new buffer, use driver internal buffer");
@@ -351,7 +392,13 @@ IRAM_ATTR static bool csi_dma_trans_done_callback(dw_gdma_channel_handle_t chan,
     dw_gdma_channel_config_transfer(chan, &csi_dma_transfer_config);
     dw_gdma_channel_enable_ctrl(chan, true);
 
-    if ((ctlr->trans.buffer != ctlr->backup_buffer) || ctlr->bk_buffer_exposed) {
+    bool deliver_trans = (ctlr->trans.buffer != ctlr->backup_buffer) || ctlr->bk_buffer_exposed;
+    if (ctlr->loan_buffer_num) {
+        // A finished frame is loaned out only when a replacement buffer is available, otherwise it is reused above
+        deliver_trans = has_new_trans;
+    }
+
+    if (deliver_trans) {
         esp_err_t ret = esp_cache_msync((void *)(ctlr->trans.buffer), ctlr->trans.received_size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
         assert(ret == ESP_OK);
         assert(ctlr->cbs.on_trans_finished);
@@ -427,7 +474,16 @@ esp_err_t s_ctlr_csi_start(esp_cam_ctlr_handle_t handle)
     esp_cam_ctlr_trans_t trans = {};
     bool has_new_trans = false;
 
-    if (ctlr->cbs.on_get_new_trans) {
+    if (ctlr->loan_buffer_num) {
+        void *free_buf = ctlr->trans.buffer;  // reuse the in-flight buffer left from a previous start-stop cycle
+        if (!free_buf) {
+            ESP_RETURN_ON_FALSE(xQueueReceive(ctlr->loan_free_que, &free_buf, 0) == pdTRUE, ESP_ERR_INVALID_STATE, TAG, "all loaned frame buffers are still on loan");
+        }
+        trans.buffer = free_buf;
+        trans.buflen = ctlr->fb_size_in_bytes;
+        trans.received_size = ctlr->fb_size_in_bytes;
+        has_new_trans = true;
+    } else if (ctlr->cbs.on_get_new_trans) {
         ctlr->cbs.on_get_new_trans(handle, &trans, ctlr->cbs_user_data);
         if (trans.buffer) {
             has_new_trans = true;
@@ -494,6 +550,36 @@ esp_err_t s_ctlr_csi_stop(esp_cam_ctlr_handle_t handle)
     return ESP_OK;
 }
 
+esp_err_t esp_cam_ctlr_csi_return_buffer(esp_cam_ctlr_handle_t handle, const void *buffer)
+{
+    ESP_RETURN_ON_FALSE_ISR(handle && buffer, ESP_ERR_INVALID_ARG, TAG, "invalid argument: null pointer");
+    csi_controller_t *ctlr = __containerof(handle, csi_controller_t, base);
+    ESP_RETURN_ON_FALSE_ISR(ctlr->loan_buffer_num, ESP_ERR_INVALID_STATE, TAG, "frame-loan pipeline is not enabled");
+
+    bool is_loan_buffer = false;
+    for (uint32_t i = 0; i < ctlr->loan_buffer_num; i++) {
+        if (ctlr->loan_buffers[i] == buffer) {
+            is_loan_buffer = true;
+            break;
+        }
+    }
+    ESP_RETURN_ON_FALSE_ISR(is_loan_buffer, ESP_ERR_INVALID_ARG, TAG, "buffer is not a loaned frame buffer");
+
+    BaseType_t sent = pdFALSE;
+    if (xPortInIsrContext()) {
+        BaseType_t high_task_woken = pdFALSE;
+        sent = xQueueSendFromISR(ctlr->loan_free_que, &buffer, &high_task_woken);
+        if (high_task_woken == pdTRUE) {
+            portYIELD_FROM_ISR();
+        }
+    } else {
+        sent = xQueueSend(ctlr->loan_free_que, &buffer, 0);
+    }
+    ESP_RETURN_ON_FALSE_ISR(sent == pdTRUE, ESP_ERR_INVALID_STATE, TAG, "buffer is returned already");
+
+    return ESP_OK;
+}
+
 esp_err_t s_ctlr_csi_receive(esp_cam_ctlr_handle_t handle, esp_cam_ctlr_trans_t *trans, uint32_t timeout_ms)
 {
     esp_err_t ret = ESP_OK;
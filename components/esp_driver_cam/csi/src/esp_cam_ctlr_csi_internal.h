@@ -57,6 +57,9 @@ struct csi_controller_t {
     void                        *backup_buffer;     //backup buffer to make csi bridge can work to avoid wrong state
     bool                        bk_buffer_exposed;  //status of if back_buffer is exposed to users
     bool                        bk_buffer_dis;      //Allow to not malloc backup_buffer
+    void                        **loan_buffers;     //array of frame buffers owned by the driver for the frame-loan pipeline
+    uint32_t                    loan_buffer_num;    //number of loaned frame buffers, 0 if the frame-loan pipeline is unused
+    QueueHandle_t               loan_free_que;      //queue of loaned frame buffers currently held by the driver
     QueueHandle_t               trans_que;          //transaction queue
     esp_cam_ctlr_evt_cbs_t      cbs;                //user callbacks
     void                        *cbs_user_data;     //callback userdata
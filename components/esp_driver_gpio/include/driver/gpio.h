@@ -70,6 +70,25 @@ typedef struct {
  */
 esp_err_t gpio_config(const gpio_config_t *pGPIOConfig);
 
+/**
+ * @brief GPIO batch configuration
+ *
+ *        Apply an array of GPIO configurations in one pass, holding the GPIO
+ *        lock once for the whole batch instead of re-acquiring it per pin
+ *
+ * @param  configs Array of GPIO configure structs, each entry selects its pins with pin_bit_mask
+ * @param  num_configs Number of entries in the array
+ *
+ * @note This function always overwrite all the current IO configurations
+ * @note The whole batch is validated before any pin is touched, so an invalid entry fails the call without a partial apply
+ *
+ * @return
+ *     - ESP_OK success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ *
+ */
+esp_err_t gpio_config_batch(const gpio_config_t *configs, size_t num_configs);
+
 /**
  * @brief Reset an gpio to default state (select gpio function, enable pullup and disable input and output).
  *
@@ -142,6 +161,23 @@ esp_err_t gpio_intr_disable(gpio_num_t gpio_num);
  */
 esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level);
 
+/**
+ * @brief  GPIO set and clear output levels with a bit mask
+ *
+ * All pins within the same 32-bit bank are updated with a single register
+ * write, so they change level on the same clock edge — e.g. for driving a
+ * parallel bus from GPIOs.
+ *
+ * @param  set_mask Bit mask of GPIOs to drive to high level, each bit maps to a GPIO
+ * @param  clear_mask Bit mask of GPIOs to drive to low level, each bit maps to a GPIO
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Mask contains a non-output-capable GPIO, or a GPIO is present in both masks
+ *
+ */
+esp_err_t gpio_multi_set_level(uint64_t set_mask, uint64_t clear_mask);
+
 /**
  * @brief  GPIO get input level
  *
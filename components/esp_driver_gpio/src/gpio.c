@@ -433,6 +433,137 @@ esp_err_t gpio_config(const gpio_config_t *pGPIOConfig)
     return ESP_OK;
 }
 
+esp_err_t gpio_config_batch(const gpio_config_t *configs, size_t num_configs)
+{
+    GPIO_CHECK(configs != NULL && num_configs > 0, "GPIO batch parameter error", ESP_ERR_INVALID_ARG);
+
+    // Validate every entry up front, so a bad entry cannot leave the batch half-applied
+    for (size_t i = 0; i < num_configs; i++) {
+        if (configs[i].pin_bit_mask == 0 ||
+                configs[i].pin_bit_mask & ~SOC_GPIO_VALID_GPIO_MASK) {
+            ESP_LOGE(GPIO_TAG, "GPIO_PIN mask error ");
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (configs[i].mode & GPIO_MODE_DEF_OUTPUT &&
+                configs[i].pin_bit_mask & ~SOC_GPIO_VALID_OUTPUT_GPIO_MASK) {
+            ESP_LOGE(GPIO_TAG, "GPIO can only be used as input mode");
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+#if SOC_RTCIO_PIN_COUNT > 0
+    // Hand the pins back from the RTC mux before entering the critical section
+    for (size_t i = 0; i < num_configs; i++) {
+        for (uint32_t io_num = 0; io_num < GPIO_PIN_COUNT; io_num++) {
+            if (((configs[i].pin_bit_mask >> io_num) & BIT(0)) && rtc_gpio_is_valid_gpio(io_num)) {
+                rtc_gpio_deinit(io_num);
+            }
+        }
+    }
+#endif
+
+    portENTER_CRITICAL(&gpio_context.gpio_spinlock);
+    for (size_t i = 0; i < num_configs; i++) {
+        const gpio_config_t *cfg = &configs[i];
+        for (uint32_t io_num = 0; io_num < GPIO_PIN_COUNT; io_num++) {
+            if (!((cfg->pin_bit_mask >> io_num) & BIT(0))) {
+                continue;
+            }
+
+            if (cfg->mode & GPIO_MODE_DEF_INPUT) {
+                gpio_hal_input_enable(gpio_context.gpio_hal, io_num);
+            } else {
+                gpio_hal_input_disable(gpio_context.gpio_hal, io_num);
+            }
+
+            if (cfg->mode & GPIO_MODE_DEF_OD) {
+                gpio_hal_od_enable(gpio_context.gpio_hal, io_num);
+            } else {
+                gpio_hal_od_disable(gpio_context.gpio_hal, io_num);
+            }
+
+            if (cfg->mode & GPIO_MODE_DEF_OUTPUT) {
+                gpio_hal_matrix_out_default(gpio_context.gpio_hal, io_num);
+                gpio_hal_output_enable(gpio_context.gpio_hal, io_num);
+            } else {
+                gpio_hal_output_disable(gpio_context.gpio_hal, io_num);
+                gpio_hal_matrix_out_default(gpio_context.gpio_hal, io_num);
+            }
+
+            if (!rtc_gpio_is_valid_gpio(io_num) || SOC_GPIO_SUPPORT_RTC_INDEPENDENT) {
+                if (cfg->pull_up_en) {
+                    gpio_hal_pullup_en(gpio_context.gpio_hal, io_num);
+                } else {
+                    gpio_hal_pullup_dis(gpio_context.gpio_hal, io_num);
+                }
+                if (cfg->pull_down_en) {
+                    gpio_hal_pulldown_en(gpio_context.gpio_hal, io_num);
+                } else {
+                    gpio_hal_pulldown_dis(gpio_context.gpio_hal, io_num);
+                }
+            } else {
+#if SOC_RTCIO_INPUT_OUTPUT_SUPPORTED
+                if (cfg->pull_up_en) {
+                    rtc_gpio_pullup_en(io_num);
+                } else {
+                    rtc_gpio_pullup_dis(io_num);
+                }
+                if (cfg->pull_down_en) {
+                    rtc_gpio_pulldown_en(io_num);
+                } else {
+                    rtc_gpio_pulldown_dis(io_num);
+                }
+#else
+                abort(); // This should be eliminated as unreachable, unless a programming error has occurred
+#endif
+            }
+
+            gpio_hal_set_intr_type(gpio_context.gpio_hal, io_num, cfg->intr_type);
+            if (cfg->intr_type == GPIO_INTR_POSEDGE || cfg->intr_type == GPIO_INTR_NEGEDGE || cfg->intr_type == GPIO_INTR_ANYEDGE) {
+                gpio_context.isr_clr_on_entry_mask |= (1ULL << (io_num));
+            } else {
+                gpio_context.isr_clr_on_entry_mask &= ~(1ULL << (io_num));
+            }
+
+            if (cfg->intr_type) {
+                if (gpio_context.isr_core_id == GPIO_ISR_CORE_ID_UNINIT) {
+                    gpio_context.isr_core_id = xPortGetCoreID();
+                }
+                gpio_hal_intr_enable_on_core(gpio_context.gpio_hal, io_num, gpio_context.isr_core_id);
+            } else {
+                gpio_hal_intr_disable(gpio_context.gpio_hal, io_num);
+            }
+
+#if SOC_GPIO_SUPPORT_PIN_HYS_FILTER
+            if (cfg->hys_ctrl_mode == GPIO_HYS_SOFT_ENABLE) {
+                gpio_hal_hysteresis_soft_enable(gpio_context.gpio_hal, io_num, true);
+            } else if (cfg->hys_ctrl_mode == GPIO_HYS_SOFT_DISABLE) {
+                gpio_hal_hysteresis_soft_enable(gpio_context.gpio_hal, io_num, false);
+            }
+#if SOC_GPIO_SUPPORT_PIN_HYS_CTRL_BY_EFUSE
+            else {
+                gpio_hal_hysteresis_from_efuse(gpio_context.gpio_hal, io_num);
+            }
+#endif
+#endif  //SOC_GPIO_SUPPORT_PIN_HYS_FILTER
+
+            /* By default, all the pins have to be configured as GPIO pins. */
+            gpio_hal_func_sel(gpio_context.gpio_hal, io_num, PIN_FUNC_GPIO);
+        }
+    }
+    portEXIT_CRITICAL(&gpio_context.gpio_spinlock);
+
+    return ESP_OK;
+}
+
+esp_err_t gpio_multi_set_level(uint64_t set_mask, uint64_t clear_mask)
+{
+    GPIO_CHECK(((set_mask | clear_mask) & ~SOC_GPIO_VALID_OUTPUT_GPIO_MASK) == 0, "GPIO output mask error", ESP_ERR_INVALID_ARG);
+    GPIO_CHECK((set_mask & clear_mask) == 0, "GPIO set/clear masks overlap", ESP_ERR_INVALID_ARG);
+    gpio_hal_set_level_mask(gpio_context.gpio_hal, set_mask, clear_mask);
+    return ESP_OK;
+}
+
 esp_err_t gpio_reset_pin(gpio_num_t gpio_num)
 {
     assert(GPIO_IS_VALID_GPIO(gpio_num));
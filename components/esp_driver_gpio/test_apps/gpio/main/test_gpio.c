@@ -535,6 +535,35 @@ TEST_CASE("GPIO_set_output_level_get_input_level_test", "[gpio]")
     TEST_ASSERT_EQUAL_INT_MESSAGE(1, gpio_get_level(TEST_GPIO_EXT_IN_IO), "get level error! the level should be high!");
 }
 
+TEST_CASE("GPIO_batch_config_and_multi_pin_set_level_test", "[gpio]")
+{
+    gpio_config_t io_confs[] = {
+        {
+            .pin_bit_mask = BIT64(TEST_GPIO_INPUT_OUTPUT_IO1) | BIT64(TEST_GPIO_INPUT_OUTPUT_IO2),
+            .mode = GPIO_MODE_INPUT_OUTPUT,
+            .pull_up_en = GPIO_PULLUP_DISABLE,
+            .pull_down_en = GPIO_PULLDOWN_DISABLE,
+            .intr_type = GPIO_INTR_DISABLE,
+        },
+    };
+    TEST_ESP_OK(gpio_config_batch(io_confs, sizeof(io_confs) / sizeof(io_confs[0])));
+
+    const uint64_t io1_mask = BIT64(TEST_GPIO_INPUT_OUTPUT_IO1);
+    const uint64_t io2_mask = BIT64(TEST_GPIO_INPUT_OUTPUT_IO2);
+    TEST_ESP_OK(gpio_multi_set_level(io1_mask | io2_mask, 0));
+    TEST_ASSERT_EQUAL_INT(1, gpio_get_level(TEST_GPIO_INPUT_OUTPUT_IO1));
+    TEST_ASSERT_EQUAL_INT(1, gpio_get_level(TEST_GPIO_INPUT_OUTPUT_IO2));
+    TEST_ESP_OK(gpio_multi_set_level(io1_mask, io2_mask));
+    TEST_ASSERT_EQUAL_INT(1, gpio_get_level(TEST_GPIO_INPUT_OUTPUT_IO1));
+    TEST_ASSERT_EQUAL_INT(0, gpio_get_level(TEST_GPIO_INPUT_OUTPUT_IO2));
+    TEST_ESP_OK(gpio_multi_set_level(0, io1_mask | io2_mask));
+    TEST_ASSERT_EQUAL_INT(0, gpio_get_level(TEST_GPIO_INPUT_OUTPUT_IO1));
+    TEST_ASSERT_EQUAL_INT(0, gpio_get_level(TEST_GPIO_INPUT_OUTPUT_IO2));
+
+    // A pin must not be present in both masks
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, gpio_multi_set_level(io1_mask, io1_mask));
+}
+
 // This test routes constant-high/low signal to pins, another way is to directly connect TEST_GPIO_EXT_IN_IO to
 // 3.3v or GND pin
 TEST_CASE("GPIO_get_level_from_fixed_voltage_test", "[gpio]")
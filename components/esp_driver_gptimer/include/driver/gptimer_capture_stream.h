@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_etm.h"
+#include "driver/gptimer_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Type of GPTimer capture stream handle
+ */
+typedef struct gptimer_capture_stream_t *gptimer_capture_stream_handle_t;
+
+/**
+ * @brief GPTimer capture stream configuration
+ */
+typedef struct {
+    size_t ring_depth; /*!< Number of timestamp slots in the RAM ring. Size it to the worst case
+                            number of edges arriving between two `gptimer_capture_stream_read` calls,
+                            further edges are lost until the ring is drained. */
+} gptimer_capture_stream_config_t;
+
+/**
+ * @brief Create a capture stream on top of a GPTimer
+ *
+ * A capture stream emulates a hardware timestamp FIFO: every hardware trigger of the
+ * timer's `GPTIMER_ETM_TASK_CAPTURE` task latches the count value, and a memory-to-memory
+ * GDMA channel, kicked by the same ETM event, copies the latched value into a RAM ring
+ * without any CPU involvement. High edge rates thus cost memory bandwidth instead of one
+ * interrupt per edge, and the CPU drains timestamps in batches at its own pace.
+ *
+ * The stream only sets up the DMA side; wire the trigger yourself by connecting the same
+ * edge event (e.g. a GPIO ETM event) to two ETM channels:
+ *  1. the timer's capture task from `gptimer_new_etm_task` (latches the count), and
+ *  2. the stream's DMA task from `gptimer_capture_stream_new_etm_task` (copies it out).
+ *
+ * @note The stream copies the lower 32 bits of the latched count, which at 1 MHz
+ *       resolution wraps after ~71 minutes; unwrap in the application if needed.
+ * @note The timer must be kept enabled and running while the stream is enabled.
+ *
+ * @param[in] timer Timer handle created by `gptimer_new_timer`
+ * @param[in] config Capture stream configuration
+ * @param[out] ret_stream Returned capture stream handle
+ * @return
+ *      - ESP_OK: Create capture stream successfully
+ *      - ESP_ERR_INVALID_ARG: Create capture stream failed because of invalid argument
+ *      - ESP_ERR_NO_MEM: Create capture stream failed because out of memory
+ *      - ESP_FAIL: Create capture stream failed because of other error
+ */
+esp_err_t gptimer_new_capture_stream(gptimer_handle_t timer, const gptimer_capture_stream_config_t *config,
+                                     gptimer_capture_stream_handle_t *ret_stream);
+
+/**
+ * @brief Delete a capture stream
+ *
+ * @note Delete any ETM task created from the stream (via `esp_etm_del_task`) first
+ *
+ * @param[in] stream Capture stream handle created by `gptimer_new_capture_stream`
+ * @return
+ *      - ESP_OK: Delete capture stream successfully
+ *      - ESP_ERR_INVALID_ARG: Delete capture stream failed because of invalid argument
+ *      - ESP_ERR_INVALID_STATE: Delete capture stream failed because it is still enabled
+ */
+esp_err_t gptimer_del_capture_stream(gptimer_capture_stream_handle_t stream);
+
+/**
+ * @brief Get the ETM task that streams one latched timestamp into the ring
+ *
+ * Connect this task to the same ETM event that triggers the timer's capture task.
+ *
+ * @note The created ETM task object should be deleted with `esp_etm_del_task`
+ *       before the stream itself is deleted
+ *
+ * @param[in] stream Capture stream handle created by `gptimer_new_capture_stream`
+ * @param[out] out_task Returned ETM task handle
+ * @return
+ *      - ESP_OK: Get ETM task successfully
+ *      - ESP_ERR_INVALID_ARG: Get ETM task failed because of invalid argument
+ *      - ESP_ERR_NO_MEM: Get ETM task failed because out of memory
+ */
+esp_err_t gptimer_capture_stream_new_etm_task(gptimer_capture_stream_handle_t stream, esp_etm_task_handle_t *out_task);
+
+/**
+ * @brief Enable a capture stream
+ *
+ * Arms the receiving DMA channel; from now on every trigger of the stream's ETM task
+ * deposits one timestamp in the ring.
+ *
+ * @param[in] stream Capture stream handle created by `gptimer_new_capture_stream`
+ * @return
+ *      - ESP_OK: Enable capture stream successfully
+ *      - ESP_ERR_INVALID_ARG: Enable capture stream failed because of invalid argument
+ *      - ESP_ERR_INVALID_STATE: Enable capture stream failed because it is already enabled
+ */
+esp_err_t gptimer_capture_stream_enable(gptimer_capture_stream_handle_t stream);
+
+/**
+ * @brief Disable a capture stream
+ *
+ * @param[in] stream Capture stream handle created by `gptimer_new_capture_stream`
+ * @return
+ *      - ESP_OK: Disable capture stream successfully
+ *      - ESP_ERR_INVALID_ARG: Disable capture stream failed because of invalid argument
+ *      - ESP_ERR_INVALID_STATE: Disable capture stream failed because it is not enabled
+ */
+esp_err_t gptimer_capture_stream_disable(gptimer_capture_stream_handle_t stream);
+
+/**
+ * @brief Read a batch of captured timestamps from the ring
+ *
+ * Returns immediately with whatever has accumulated since the last read, up to
+ * `max_timestamps`, oldest first, and hands the drained slots back to the DMA.
+ * Timestamps are raw count values in units of the timer resolution.
+ *
+ * @param[in] stream Capture stream handle created by `gptimer_new_capture_stream`
+ * @param[out] timestamps Array to store the captured count values
+ * @param[in] max_timestamps Capacity of the `timestamps` array
+ * @param[out] out_count Number of timestamps actually read
+ * @return
+ *      - ESP_OK: Read captured timestamps successfully (`*out_count` may be 0)
+ *      - ESP_ERR_INVALID_ARG: Read captured timestamps failed because of invalid argument
+ *      - ESP_ERR_INVALID_STATE: Read captured timestamps failed because the stream is not enabled
+ */
+esp_err_t gptimer_capture_stream_read(gptimer_capture_stream_handle_t stream, uint32_t *timestamps,
+                                      size_t max_timestamps, size_t *out_count);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,248 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_cache.h"
+#include "driver/gptimer.h"
+#include "driver/gptimer_capture_stream.h"
+#include "gptimer_priv.h"
+#include "hal/timer_ll.h"
+#include "esp_private/gdma.h"
+#include "esp_private/gdma_link.h"
+#include "esp_private/esp_cache_private.h"
+
+static const char *TAG = "gptimer-capture";
+
+typedef enum {
+    GPTIMER_CAPTURE_STREAM_INIT,
+    GPTIMER_CAPTURE_STREAM_ENABLED,
+} gptimer_capture_stream_fsm_t;
+
+struct gptimer_capture_stream_t {
+    gptimer_t *timer;                   // the timer whose latched count is streamed out
+    gdma_channel_handle_t tx_channel;   // reads the capture register, started per-edge by ETM
+    gdma_channel_handle_t rx_channel;   // deposits timestamps into the ring, armed by software
+    gdma_link_list_handle_t tx_link;    // single item, re-run by every ETM kick
+    gdma_link_list_handle_t rx_link;    // circular list, one item per ring slot
+    uint8_t *ring;                      // timestamp slots, one DMA-aligned stride each
+    size_t ring_depth;                  // number of slots
+    size_t slot_stride;                 // distance between slots, covers cache line alignment
+    size_t read_index;                  // next slot to be drained
+    gptimer_capture_stream_fsm_t fsm;
+};
+
+static esp_err_t gptimer_capture_stream_destroy(gptimer_capture_stream_handle_t stream)
+{
+    if (stream->tx_channel) {
+        gdma_disconnect(stream->tx_channel);
+        gdma_del_channel(stream->tx_channel);
+    }
+    if (stream->rx_channel) {
+        gdma_disconnect(stream->rx_channel);
+        gdma_del_channel(stream->rx_channel);
+    }
+    if (stream->tx_link) {
+        gdma_del_link_list(stream->tx_link);
+    }
+    if (stream->rx_link) {
+        gdma_del_link_list(stream->rx_link);
+    }
+    if (stream->ring) {
+        free(stream->ring);
+    }
+    free(stream);
+    return ESP_OK;
+}
+
+esp_err_t gptimer_new_capture_stream(gptimer_handle_t timer, const gptimer_capture_stream_config_t *config,
+                                     gptimer_capture_stream_handle_t *ret_stream)
+{
+    esp_err_t ret = ESP_OK;
+    gptimer_capture_stream_handle_t stream = NULL;
+    ESP_RETURN_ON_FALSE(timer && config && ret_stream, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(config->ring_depth >= 2, ESP_ERR_INVALID_ARG, TAG, "ring depth too small");
+
+    stream = heap_caps_calloc(1, sizeof(struct gptimer_capture_stream_t), GPTIMER_MEM_ALLOC_CAPS);
+    ESP_RETURN_ON_FALSE(stream, ESP_ERR_NO_MEM, TAG, "no memory for capture stream");
+    stream->timer = timer;
+    stream->ring_depth = config->ring_depth;
+
+    // each slot owns a full DMA alignment unit, so the DMA engine and the CPU
+    // never share a cache line while the ring is being filled
+    size_t dma_alignment = 0;
+    ESP_GOTO_ON_ERROR(esp_cache_get_alignment(MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL, &dma_alignment),
+                      err, TAG, "failed to get DMA alignment");
+    stream->slot_stride = MAX(sizeof(uint32_t), dma_alignment);
+    stream->ring = heap_caps_aligned_calloc(stream->slot_stride, config->ring_depth, stream->slot_stride,
+                                            MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT | MALLOC_CAP_DMA);
+    ESP_GOTO_ON_FALSE(stream->ring, ESP_ERR_NO_MEM, err, TAG, "no memory for timestamp ring");
+
+    // TX and RX channel must reside in the same pair for a memory-to-memory transfer
+    gdma_channel_alloc_config_t tx_alloc_config = {
+        .flags.reserve_sibling = 1,
+        .direction = GDMA_CHANNEL_DIRECTION_TX,
+    };
+    ESP_GOTO_ON_ERROR(gdma_new_ahb_channel(&tx_alloc_config, &stream->tx_channel), err, TAG,
+                      "failed to create GDMA TX channel");
+    gdma_channel_alloc_config_t rx_alloc_config = {
+        .direction = GDMA_CHANNEL_DIRECTION_RX,
+        .sibling_chan = stream->tx_channel,
+    };
+    ESP_GOTO_ON_ERROR(gdma_new_ahb_channel(&rx_alloc_config, &stream->rx_channel), err, TAG,
+                      "failed to create GDMA RX channel");
+
+    gdma_trigger_t m2m_trigger = GDMA_MAKE_TRIGGER(GDMA_TRIG_PERIPH_M2M, 0);
+    uint32_t free_m2m_id_mask = 0;
+    gdma_get_free_m2m_trig_id_mask(stream->tx_channel, &free_m2m_id_mask);
+    ESP_GOTO_ON_FALSE(free_m2m_id_mask, ESP_ERR_NOT_FOUND, err, TAG, "no free M2M trigger");
+    m2m_trigger.instance_id = __builtin_ctz(free_m2m_id_mask);
+    ESP_GOTO_ON_ERROR(gdma_connect(stream->rx_channel, m2m_trigger), err, TAG, "GDMA rx connect failed");
+    ESP_GOTO_ON_ERROR(gdma_connect(stream->tx_channel, m2m_trigger), err, TAG, "GDMA tx connect failed");
+
+    // the TX side re-reads the same capture register for every edge: a single
+    // self-terminating item, re-run from the head by each ETM kick
+    gdma_link_list_config_t tx_link_config = {
+        .num_items = 1,
+    };
+    ESP_GOTO_ON_ERROR(gdma_new_link_list(&tx_link_config, &stream->tx_link), err, TAG,
+                      "failed to create TX link list");
+    // the latched count value lives in the LO register until the next capture;
+    // only the lower 32 bits fit in one transfer
+    gdma_buffer_mount_config_t tx_mount_config = {
+        .buffer = (void *)&timer->hal.dev->hw_timer[timer->timer_id].lo,
+        .length = sizeof(uint32_t),
+        .flags = {
+            .mark_eof = true,
+            .mark_final = true,
+        },
+    };
+    ESP_GOTO_ON_ERROR(gdma_link_mount_buffers(stream->tx_link, 0, &tx_mount_config, 1, NULL), err, TAG,
+                      "failed to mount capture register");
+
+    // the RX side is a circular list with one slot per ring entry; the owner
+    // flag of each item tells the reader which slots the DMA has filled
+    gdma_link_list_config_t rx_link_config = {
+        .num_items = config->ring_depth,
+        .flags.check_owner = true,
+    };
+    ESP_GOTO_ON_ERROR(gdma_new_link_list(&rx_link_config, &stream->rx_link), err, TAG,
+                      "failed to create RX link list");
+    for (size_t i = 0; i < config->ring_depth; i++) {
+        gdma_buffer_mount_config_t rx_mount_config = {
+            .buffer = stream->ring + i * stream->slot_stride,
+            .length = sizeof(uint32_t),
+        };
+        ESP_GOTO_ON_ERROR(gdma_link_mount_buffers(stream->rx_link, i, &rx_mount_config, 1, NULL), err, TAG,
+                          "failed to mount ring slot");
+        ESP_GOTO_ON_ERROR(gdma_link_set_owner(stream->rx_link, i, GDMA_LLI_OWNER_DMA), err, TAG,
+                          "failed to hand slot to DMA");
+    }
+
+    stream->fsm = GPTIMER_CAPTURE_STREAM_INIT;
+    ESP_LOGD(TAG, "new capture stream @ %p, ring %zu x %zu bytes", stream,
+             stream->ring_depth, stream->slot_stride);
+    *ret_stream = stream;
+    return ESP_OK;
+
+err:
+    gptimer_capture_stream_destroy(stream);
+    return ret;
+}
+
+esp_err_t gptimer_del_capture_stream(gptimer_capture_stream_handle_t stream)
+{
+    ESP_RETURN_ON_FALSE(stream, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(stream->fsm == GPTIMER_CAPTURE_STREAM_INIT, ESP_ERR_INVALID_STATE, TAG,
+                        "stream not disabled yet");
+    return gptimer_capture_stream_destroy(stream);
+}
+
+esp_err_t gptimer_capture_stream_new_etm_task(gptimer_capture_stream_handle_t stream, esp_etm_task_handle_t *out_task)
+{
+    ESP_RETURN_ON_FALSE(stream && out_task, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    gdma_etm_task_config_t task_config = {
+        .task_type = GDMA_ETM_TASK_START,
+    };
+    return gdma_new_etm_task(stream->tx_channel, &task_config, out_task);
+}
+
+esp_err_t gptimer_capture_stream_enable(gptimer_capture_stream_handle_t stream)
+{
+    ESP_RETURN_ON_FALSE(stream, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(stream->fsm == GPTIMER_CAPTURE_STREAM_INIT, ESP_ERR_INVALID_STATE, TAG,
+                        "stream already enabled");
+
+    stream->read_index = 0;
+    // arm the receiving side; the transmitting side is started per-edge by the ETM task
+    ESP_RETURN_ON_ERROR(gdma_reset(stream->rx_channel), TAG, "failed to reset RX channel");
+    ESP_RETURN_ON_ERROR(gdma_start(stream->rx_channel, gdma_link_get_head_addr(stream->rx_link)),
+                        TAG, "failed to start RX channel");
+    stream->fsm = GPTIMER_CAPTURE_STREAM_ENABLED;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_capture_stream_disable(gptimer_capture_stream_handle_t stream)
+{
+    ESP_RETURN_ON_FALSE(stream, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(stream->fsm == GPTIMER_CAPTURE_STREAM_ENABLED, ESP_ERR_INVALID_STATE, TAG,
+                        "stream not enabled yet");
+
+    ESP_RETURN_ON_ERROR(gdma_stop(stream->rx_channel), TAG, "failed to stop RX channel");
+    stream->fsm = GPTIMER_CAPTURE_STREAM_INIT;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_capture_stream_read(gptimer_capture_stream_handle_t stream, uint32_t *timestamps,
+                                      size_t max_timestamps, size_t *out_count)
+{
+    ESP_RETURN_ON_FALSE(stream && timestamps && out_count, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(stream->fsm == GPTIMER_CAPTURE_STREAM_ENABLED, ESP_ERR_INVALID_STATE, TAG,
+                        "stream not enabled yet");
+
+    // when the ring lives in cached memory, pick up the slots the DMA wrote behind the cache
+    if (stream->slot_stride > sizeof(uint32_t)) {
+        ESP_RETURN_ON_ERROR(esp_cache_msync(stream->ring, stream->ring_depth * stream->slot_stride,
+                                            ESP_CACHE_MSYNC_FLAG_DIR_M2C), TAG, "cache sync failed");
+    }
+
+    size_t count = 0;
+    bool recycled = false;
+    while (count < max_timestamps) {
+        gdma_lli_owner_t owner = GDMA_LLI_OWNER_DMA;
+        ESP_RETURN_ON_ERROR(gdma_link_get_owner(stream->rx_link, stream->read_index, &owner),
+                            TAG, "failed to get slot owner");
+        if (owner != GDMA_LLI_OWNER_CPU) {
+            // the DMA has not filled this slot yet, the ring is drained
+            break;
+        }
+        timestamps[count++] = *(uint32_t *)(stream->ring + stream->read_index * stream->slot_stride);
+        // hand the drained slot back to the DMA
+        ESP_RETURN_ON_ERROR(gdma_link_set_owner(stream->rx_link, stream->read_index, GDMA_LLI_OWNER_DMA),
+                            TAG, "failed to recycle slot");
+        recycled = true;
+        stream->read_index++;
+        if (stream->read_index >= stream->ring_depth) {
+            stream->read_index = 0;
+        }
+    }
+
+    // if the RX channel stalled on a CPU-owned slot (reader fell behind and edges
+    // were lost), the doorbell lets it resume with the recycled slots
+    if (recycled) {
+        ESP_RETURN_ON_ERROR(gdma_append(stream->rx_channel), TAG, "failed to ring RX doorbell");
+    }
+
+    *out_count = count;
+    return ESP_OK;
+}
@@ -1220,6 +1220,75 @@ esp_err_t i2c_master_receive(i2c_master_dev_handle_t i2c_dev, uint8_t *read_buff
     return ESP_OK;
 }
 
+/// Precompiled command list: the hardware command sequence is built once and re-submitted as-is
+struct i2c_master_cmd_list_t {
+    i2c_master_dev_t *i2c_dev;                           // device the list was compiled for
+    size_t cmd_count;                                    // number of commands in `ops`
+    i2c_operation_t ops[I2C_STATIC_OPERATION_ARRAY_MAX]; // precompiled I2C operation array
+};
+
+esp_err_t i2c_master_compile_cmd_list(i2c_master_dev_handle_t i2c_dev, const uint8_t *write_buffer, size_t write_size, uint8_t *read_buffer, size_t read_size, i2c_master_cmd_list_handle_t *ret_cmd_list)
+{
+    ESP_RETURN_ON_FALSE(i2c_dev != NULL, ESP_ERR_INVALID_ARG, TAG, "i2c handle not initialized");
+    ESP_RETURN_ON_FALSE(ret_cmd_list != NULL, ESP_ERR_INVALID_ARG, TAG, "i2c command list pointer invalid");
+    ESP_RETURN_ON_FALSE(write_size == 0 || write_buffer != NULL, ESP_ERR_INVALID_ARG, TAG, "i2c transmit buffer or size invalid");
+    ESP_RETURN_ON_FALSE(read_size == 0 || read_buffer != NULL, ESP_ERR_INVALID_ARG, TAG, "i2c receive buffer or size invalid");
+    ESP_RETURN_ON_FALSE(write_size > 0 || read_size > 0, ESP_ERR_INVALID_ARG, TAG, "i2c command list contains no transfer");
+
+    i2c_master_cmd_list_t *cmd_list = heap_caps_calloc(1, sizeof(i2c_master_cmd_list_t), I2C_MEM_ALLOC_CAPS);
+    ESP_RETURN_ON_FALSE(cmd_list, ESP_ERR_NO_MEM, TAG, "no memory for i2c command list");
+    cmd_list->i2c_dev = i2c_dev;
+
+    size_t op_index = 0;
+    cmd_list->ops[op_index++].hw_cmd = (i2c_ll_hw_cmd_t)I2C_TRANS_START_COMMAND;
+    if (write_size > 0) {
+        cmd_list->ops[op_index].hw_cmd = (i2c_ll_hw_cmd_t)I2C_TRANS_WRITE_COMMAND(i2c_dev->ack_check_disable ? false : true);
+        cmd_list->ops[op_index].data = (uint8_t *)write_buffer;
+        cmd_list->ops[op_index].total_bytes = write_size;
+        op_index++;
+        if (read_size > 0) {
+            cmd_list->ops[op_index++].hw_cmd = (i2c_ll_hw_cmd_t)I2C_TRANS_START_COMMAND;
+        }
+    }
+    if (read_size > 0) {
+        if (read_size > 1) {
+            cmd_list->ops[op_index].hw_cmd = (i2c_ll_hw_cmd_t)I2C_TRANS_READ_COMMAND(ACK_VAL);
+            cmd_list->ops[op_index].data = read_buffer;
+            cmd_list->ops[op_index].total_bytes = read_size - 1;
+            op_index++;
+        }
+        cmd_list->ops[op_index].hw_cmd = (i2c_ll_hw_cmd_t)I2C_TRANS_READ_COMMAND(NACK_VAL);
+        cmd_list->ops[op_index].data = read_buffer + read_size - 1;
+        cmd_list->ops[op_index].total_bytes = 1;
+        op_index++;
+    }
+    cmd_list->ops[op_index++].hw_cmd = (i2c_ll_hw_cmd_t)I2C_TRANS_STOP_COMMAND;
+    cmd_list->cmd_count = op_index;
+
+    *ret_cmd_list = cmd_list;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_execute_cmd_list(i2c_master_cmd_list_handle_t cmd_list, int xfer_timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(cmd_list != NULL, ESP_ERR_INVALID_ARG, TAG, "i2c command list not initialized");
+
+    i2c_master_dev_handle_t i2c_dev = cmd_list->i2c_dev;
+    if (i2c_dev->master_bus->async_trans == false) {
+        ESP_RETURN_ON_ERROR(s_i2c_synchronous_transaction(i2c_dev, cmd_list->ops, cmd_list->cmd_count, xfer_timeout_ms), TAG, "I2C transaction failed");
+    } else {
+        ESP_RETURN_ON_ERROR(s_i2c_asynchronous_transaction(i2c_dev, cmd_list->ops, cmd_list->cmd_count, xfer_timeout_ms), TAG, "I2C transaction failed");
+    }
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_del_cmd_list(i2c_master_cmd_list_handle_t cmd_list)
+{
+    ESP_RETURN_ON_FALSE(cmd_list != NULL, ESP_ERR_INVALID_ARG, TAG, "i2c command list not initialized");
+    free(cmd_list);
+    return ESP_OK;
+}
+
 esp_err_t i2c_master_probe(i2c_master_bus_handle_t bus_handle, uint16_t address, int xfer_timeout_ms)
 {
     ESP_RETURN_ON_FALSE(bus_handle != NULL, ESP_ERR_INVALID_ARG, TAG, "i2c handle not initialized");
@@ -192,6 +192,62 @@ esp_err_t i2c_master_transmit_receive(i2c_master_dev_handle_t i2c_dev, const uin
  */
 esp_err_t i2c_master_receive(i2c_master_dev_handle_t i2c_dev, uint8_t *read_buffer, size_t read_size, int xfer_timeout_ms);
 
+/**
+ * @brief Precompile a write-read pattern into a reusable command list.
+ *
+ * The hardware command sequence (start/write/restart/read/stop) is built once from the given
+ * buffers and lengths, so re-executing the list with `i2c_master_execute_cmd_list` skips the
+ * per-call command construction. This is meant for periodic patterns such as polling a sensor
+ * register at a fixed rate. Either the write part (`write_size = 0`) or the read part
+ * (`read_size = 0`) can be omitted to compile a pure read or write.
+ *
+ * @note The command list references the buffers, it does not copy them: the buffers must stay
+ *       valid as long as the list is in use, and the write buffer content may be updated in
+ *       place between executions.
+ *
+ * @param[in] i2c_dev I2C master device handle that created by `i2c_master_bus_add_device`.
+ * @param[in] write_buffer Data bytes to send on the I2C bus, NULL to compile a pure read.
+ * @param[in] write_size Size, in bytes, of the write buffer.
+ * @param[out] read_buffer Data bytes received from i2c bus, NULL to compile a pure write.
+ * @param[in] read_size Size, in bytes, of the read buffer.
+ * @param[out] ret_cmd_list Returned command list handle.
+ * @return
+ *      - ESP_OK: I2C command list compiled successfully
+ *      - ESP_ERR_INVALID_ARG: I2C command list compile parameter invalid.
+ *      - ESP_ERR_NO_MEM: No memory for the command list.
+ */
+esp_err_t i2c_master_compile_cmd_list(i2c_master_dev_handle_t i2c_dev, const uint8_t *write_buffer, size_t write_size, uint8_t *read_buffer, size_t read_size, i2c_master_cmd_list_handle_t *ret_cmd_list);
+
+/**
+ * @brief Execute a precompiled command list.
+ *
+ * Behaves like the corresponding `i2c_master_transmit`/`i2c_master_transmit_receive`/
+ * `i2c_master_receive` call the list was compiled from, without rebuilding the command
+ * sequence. On a bus created with `trans_queue_depth` != 0 the execution is asynchronous and
+ * pipelined: multiple outstanding lists are serviced back-to-back from the ISR, completions are
+ * reported through the `on_trans_done` callback and drained with `i2c_master_bus_wait_all_done`.
+ *
+ * @param[in] cmd_list Command list handle that created by `i2c_master_compile_cmd_list`.
+ * @param[in] xfer_timeout_ms Wait timeout, in ms. Note: -1 means wait forever.
+ * @return
+ *      - ESP_OK: I2C master transaction success
+ *      - ESP_ERR_INVALID_ARG: I2C master transaction parameter invalid.
+ *      - ESP_ERR_TIMEOUT: Operation timeout(larger than xfer_timeout_ms) because the bus is busy or hardware crash.
+ */
+esp_err_t i2c_master_execute_cmd_list(i2c_master_cmd_list_handle_t cmd_list, int xfer_timeout_ms);
+
+/**
+ * @brief Delete a precompiled command list and free its memory.
+ *
+ * @note Must not be called while the command list is still queued on an asynchronous bus.
+ *
+ * @param[in] cmd_list Command list handle that created by `i2c_master_compile_cmd_list`.
+ * @return
+ *      - ESP_OK: If command list is successfully deleted.
+ *      - ESP_ERR_INVALID_ARG: Command list handle is not initialized.
+ */
+esp_err_t i2c_master_del_cmd_list(i2c_master_cmd_list_handle_t cmd_list);
+
 /**
  * @brief Probe I2C address, if address is correct and ACK is received, this function will return ESP_OK.
  *
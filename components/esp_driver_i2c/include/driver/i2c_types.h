@@ -54,6 +54,11 @@ typedef struct i2c_master_bus_t *i2c_master_bus_handle_t;
  */
 typedef struct i2c_master_dev_t *i2c_master_dev_handle_t;
 
+/**
+ * @brief Type of I2C master precompiled command list handle
+ */
+typedef struct i2c_master_cmd_list_t *i2c_master_cmd_list_handle_t;
+
 /**
  * @brief Type of I2C slave device handle
  */
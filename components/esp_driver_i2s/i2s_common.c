@@ -65,6 +65,7 @@
 
 #include "esp_rom_gpio.h"
 #include "esp_memory_utils.h"
+#include "esp_timer.h"
 
 /* The actual max size of DMA buffer is 4095
  * Reserve several bytes for alignment, so that the position of the slot data in the buffer will be relatively fixed */
@@ -446,6 +447,8 @@ uint32_t i2s_get_buf_size(i2s_chan_handle_t handle, uint32_t data_bit_width, uin
         bufsize = frame_num * bytes_per_frame;
         ESP_LOGW(TAG, "dma frame num is out of dma buffer size, limited to %"PRIu32, frame_num);
     }
+    /* Record the actual frame number that one DMA buffer holds, the frame counter steps by this value on every EOF */
+    handle->dma.frames_per_buf = bufsize / bytes_per_frame;
     return bufsize;
 }
 
@@ -582,6 +585,9 @@ static bool IRAM_ATTR i2s_dma_rx_callback(gdma_channel_handle_t dma_chan, gdma_e
     uint32_t dummy;
 
     finish_desc = (lldesc_t *)event_data->rx_eof_desc_addr;
+    /* Step the frame counter and timestamp it, so that the received frames can be mapped to the wall clock */
+    handle->dma.frame_count += handle->dma.frames_per_buf;
+    handle->dma.frame_ts = esp_timer_get_time();
 #if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
     esp_cache_msync((void *)finish_desc->buf, handle->dma.buf_size, ESP_CACHE_MSYNC_FLAG_INVALIDATE);
 #endif
@@ -615,6 +621,8 @@ static bool IRAM_ATTR i2s_dma_tx_callback(gdma_channel_handle_t dma_chan, gdma_e
     uint32_t dummy;
 
     finish_desc = (lldesc_t *)event_data->tx_eof_desc_addr;
+    handle->dma.frame_count += handle->dma.frames_per_buf;
+    handle->dma.frame_ts = esp_timer_get_time();
     void *curr_buf = (void *)finish_desc->buf;
     i2s_event_data_t evt = {
         .data = &(finish_desc->buf),
@@ -672,6 +680,8 @@ static void IRAM_ATTR i2s_dma_rx_callback(void *arg)
 
     if (handle && (status & I2S_LL_EVENT_RX_EOF)) {
         i2s_hal_get_in_eof_des_addr(&(handle->controller->hal), (uint32_t *)&finish_desc);
+        handle->dma.frame_count += handle->dma.frames_per_buf;
+        handle->dma.frame_ts = esp_timer_get_time();
         evt.data = &(finish_desc->buf);
         evt.dma_buf = (void *)finish_desc->buf;
         evt.size = handle->dma.buf_size;
@@ -712,6 +722,8 @@ static void IRAM_ATTR i2s_dma_tx_callback(void *arg)
 
     if (handle && (status & I2S_LL_EVENT_TX_EOF)) {
         i2s_hal_get_out_eof_des_addr(&(handle->controller->hal), (uint32_t *)&finish_desc);
+        handle->dma.frame_count += handle->dma.frames_per_buf;
+        handle->dma.frame_ts = esp_timer_get_time();
         void *curr_buf = (void *)finish_desc->buf;
         evt.data = &(finish_desc->buf);
         evt.dma_buf = curr_buf;
@@ -1162,6 +1174,9 @@ esp_err_t i2s_channel_enable(i2s_chan_handle_t handle)
 #if CONFIG_PM_ENABLE
     esp_pm_lock_acquire(handle->pm_lock);
 #endif
+    /* Restart the frame counter for this streaming session */
+    handle->dma.frame_count = 0;
+    handle->dma.frame_ts = 0;
     handle->start(handle);
     handle->state = I2S_CHAN_STATE_RUNNING;
     /* Reset queue */
@@ -1208,6 +1223,60 @@ err:
     return ret;
 }
 
+esp_err_t i2s_channel_get_frame_counter(i2s_chan_handle_t handle, uint64_t *frame_count, int64_t *timestamp)
+{
+    I2S_NULL_POINTER_CHECK(TAG, handle);
+    I2S_NULL_POINTER_CHECK(TAG, frame_count);
+
+    uint64_t cnt;
+    int64_t ts;
+    /* The counter and the timestamp are updated in the ISR, read them lock-free here
+     * and retry if an EOF interrupt sneaks in between the two reads */
+    do {
+        ts = handle->dma.frame_ts;
+        cnt = handle->dma.frame_count;
+    } while (ts != handle->dma.frame_ts);
+    *frame_count = cnt;
+    if (timestamp) {
+        *timestamp = ts;
+    }
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_reconfig_dma_buffer(i2s_chan_handle_t handle, uint32_t dma_desc_num, uint32_t dma_frame_num)
+{
+    I2S_NULL_POINTER_CHECK(TAG, handle);
+    ESP_RETURN_ON_FALSE(dma_desc_num >= 2, ESP_ERR_INVALID_ARG, TAG, "there should be at least 2 DMA buffers");
+    ESP_RETURN_ON_FALSE(dma_frame_num, ESP_ERR_INVALID_ARG, TAG, "invalid dma frame number");
+
+    esp_err_t ret = ESP_OK;
+    xSemaphoreTake(handle->mutex, portMAX_DELAY);
+    /* The descriptor chain can't be rebuilt while DMA is running on it, the channel has to be disabled first */
+    ESP_GOTO_ON_FALSE(handle->state == I2S_CHAN_STATE_READY, ESP_ERR_INVALID_STATE, err, TAG,
+                      "the DMA buffer can only be reconfigured when the channel is READY");
+    /* Derive the bytes per frame from the current buffer layout, so that no slot information is needed here */
+    uint32_t bytes_per_frame = handle->dma.buf_size / handle->dma.frames_per_buf;
+    uint32_t buf_size = i2s_get_buf_size(handle, bytes_per_frame / handle->active_slot * 8, dma_frame_num);
+    if (dma_desc_num != handle->dma.desc_num) {
+        /* The message queue depth follows the descriptor number, recreate it as well.
+         * No reading / writing task can block on the old queue now because the channel has been disabled */
+        QueueHandle_t new_queue = xQueueCreateWithCaps(dma_desc_num - 1, sizeof(uint8_t *), I2S_MEM_ALLOC_CAPS);
+        ESP_GOTO_ON_FALSE(new_queue, ESP_ERR_NO_MEM, err, TAG, "No memory for message queue");
+        vQueueDeleteWithCaps(handle->msg_queue);
+        handle->msg_queue = new_queue;
+    }
+    i2s_free_dma_desc(handle);
+    ESP_GOTO_ON_ERROR(i2s_alloc_dma_desc(handle, dma_desc_num, buf_size), err, TAG, "allocate memory for dma descriptor failed");
+    handle->dma.frame_num = dma_frame_num;
+    /* The data that pre-loaded into the old buffers is gone, reset the loading position */
+    handle->dma.curr_ptr = NULL;
+    handle->dma.curr_desc = NULL;
+    handle->dma.rw_pos = 0;
+err:
+    xSemaphoreGive(handle->mutex);
+    return ret;
+}
+
 esp_err_t i2s_channel_preload_data(i2s_chan_handle_t tx_handle, const void *src, size_t size, size_t *bytes_loaded)
 {
     I2S_NULL_POINTER_CHECK(TAG, tx_handle);
@@ -116,6 +116,9 @@ typedef struct {
     uint32_t                desc_num;       /*!< I2S DMA buffer number, it is also the number of DMA descriptor */
     uint32_t                frame_num;      /*!< I2S frame number in one DMA buffer. One frame means one-time sample data in all slots */
     uint32_t                buf_size;       /*!< dma buffer size */
+    uint32_t                frames_per_buf; /*!< Actual frame number in one DMA buffer, may differ from `frame_num` after the buffer size is aligned */
+    volatile uint64_t       frame_count;    /*!< Accumulated frame number that DMA has transferred since the channel is enabled, updated in ISR */
+    volatile int64_t        frame_ts;       /*!< Timestamp of the last `frame_count` update, in microseconds from `esp_timer_get_time` */
     bool                    auto_clear_after_cb;     /*!< Set to auto clear DMA TX descriptor after callback, i2s will always send zero automatically if no data to send */
     bool                    auto_clear_before_cb;    /*!< Set to auto clear DMA TX descriptor before callback, i2s will always send zero automatically if no data to send */
     uint32_t                rw_pos;         /*!< reading/writing pointer position */
@@ -174,6 +174,44 @@ esp_err_t i2s_channel_enable(i2s_chan_handle_t handle);
  */
 esp_err_t i2s_channel_disable(i2s_chan_handle_t handle);
 
+/**
+ * @brief Get the accumulated frame counter of the I2S channel
+ * @note  The counter steps by the frame number in one DMA buffer every time a DMA buffer is finished,
+ *        and it restarts from zero every time the channel is enabled.
+ * @note  The timestamp is taken from `esp_timer_get_time` in the DMA interrupt that updated the counter last time,
+ *        so the frame position can be mapped to the wall clock.
+ *        In full-duplex mode, the TX and RX channels share the same BCLK and WS signals,
+ *        their counters advance at the same rate, so the two counters (with their timestamps) can be used
+ *        to align the sending and receiving streams, e.g., for acoustic echo cancellation.
+ *
+ * @param[in]   handle      I2S channel handler
+ * @param[out]  frame_count Accumulated frame number that DMA has transferred since the channel is enabled
+ * @param[out]  timestamp   Timestamp of the last frame counter update, in microseconds, can be NULL if not needed
+ * @return
+ *      - ESP_OK    Get the frame counter successfully
+ *      - ESP_ERR_INVALID_ARG   NULL pointer
+ */
+esp_err_t i2s_channel_get_frame_counter(i2s_chan_handle_t handle, uint64_t *frame_count, int64_t *timestamp);
+
+/**
+ * @brief Reconfigure the DMA buffer number and size of the I2S channel
+ * @note  Only allowed to be called when the channel state is READY, (i.e., channel has been initialized but not started),
+ *        because the DMA descriptor chain can't be rebuilt while the hardware is running on it.
+ *        To deepen the buffering of a running channel, disable the channel first, reconfigure the DMA buffer
+ *        and then enable the channel again.
+ * @note  The data that has been preloaded into the old DMA buffers will be dropped after the reconfiguration.
+ *
+ * @param[in]   handle          I2S channel handler
+ * @param[in]   dma_desc_num    New DMA buffer number, at least 2, it is also the number of DMA descriptor
+ * @param[in]   dma_frame_num   New frame number in one DMA buffer, see `i2s_chan_config_t::dma_frame_num`
+ * @return
+ *      - ESP_OK    Reconfigure the DMA buffer successfully
+ *      - ESP_ERR_INVALID_ARG   NULL pointer or invalid buffer number
+ *      - ESP_ERR_INVALID_STATE The channel is not at READY state
+ *      - ESP_ERR_NO_MEM        No memory for the new DMA buffers
+ */
+esp_err_t i2s_channel_reconfig_dma_buffer(i2s_chan_handle_t handle, uint32_t dma_desc_num, uint32_t dma_frame_num);
+
 /**
  * @brief Preload the data into TX DMA buffer
  * @note  Only allowed to be called when the channel state is READY, (i.e., channel has been initialized, but not started)
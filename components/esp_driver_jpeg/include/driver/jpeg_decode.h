@@ -48,6 +48,41 @@ typedef struct {
     jpeg_dec_buffer_alloc_direction_t buffer_direction;  /*!< Buffer direction for jpeg decoder memory allocation */
 } jpeg_decode_memory_alloc_cfg_t;
 
+/**
+ * @brief Information of one decoded band, passed to the band callback
+ */
+typedef struct {
+    uint8_t *band_buf;       /*!< Pointer to the buffer holding the decoded band */
+    uint32_t band_size;      /*!< Number of valid bytes in the band buffer */
+    uint32_t band_offset_y;  /*!< Line offset of the first line of this band inside the full picture */
+    uint32_t band_lines;     /*!< Number of picture lines contained in this band */
+} jpeg_decode_band_event_data_t;
+
+/**
+ * @brief Prototype of the JPEG decoder band callback
+ *
+ * The callback is invoked from the task that called `jpeg_decoder_process_banded`, every time a band of
+ * output lines has been decoded. The band buffer is handed back to the decoder as soon as the callback
+ * returns, so the content must be consumed (e.g. sent to the PPA or an LCD) before returning.
+ *
+ * @param[in] decoder_engine Handle of the JPEG decoder instance that produced the band.
+ * @param[in] event_data Information of the decoded band.
+ * @param[in] user_ctx User registered context, passed from `jpeg_decode_band_cfg_t`.
+ */
+typedef void (*jpeg_decode_band_cb_t)(jpeg_decoder_handle_t decoder_engine, const jpeg_decode_band_event_data_t *event_data, void *user_ctx);
+
+/**
+ * @brief Configuration parameters for a JPEG decoder band (streaming) process.
+ */
+typedef struct {
+    uint8_t **band_bufs;                  /*!< Array of band buffers that the decoder cycles through. Every buffer must be
+                                               allocated with `jpeg_alloc_decoder_mem` in `JPEG_DEC_ALLOC_OUTPUT_BUFFER` direction */
+    uint32_t num_band_bufs;               /*!< Number of buffers in `band_bufs`, at least 2 to overlap decode and post-process */
+    uint32_t band_buf_size;               /*!< Size of each band buffer, in bytes. Must hold at least one MCU row of decoded output */
+    jpeg_decode_band_cb_t on_band_decoded;  /*!< Callback invoked for every decoded band */
+    void *user_ctx;                       /*!< User registered context, passed to the band callback */
+} jpeg_decode_band_cfg_t;
+
 /**
  * @brief Acquire a JPEG decode engine with the specified configuration.
  *
@@ -107,6 +142,36 @@ esp_err_t jpeg_decoder_get_info(const uint8_t *bit_stream, uint32_t stream_size,
  */
 esp_err_t jpeg_decoder_process(jpeg_decoder_handle_t decoder_engine, const jpeg_decode_cfg_t *decode_cfg, const uint8_t *bit_stream, uint32_t stream_size, uint8_t *decode_outbuf, uint32_t outbuf_size, uint32_t *out_size);
 
+/**
+ * @brief Process a JPEG image band by band with the specified decoder instance.
+ *
+ * Instead of decoding into one buffer that holds the whole picture, this function decodes into a small
+ * ring of band buffers and invokes `on_band_decoded` every time a band of output lines is complete, while
+ * the hardware already decodes the next band. This allows decode and post-processing (e.g. PPA scaling or
+ * pushing to an LCD) to overlap, and reduces the peak output memory from the whole frame to
+ * `num_band_bufs * band_buf_size`. The band height is derived from `band_buf_size`: the largest multiple
+ * of the MCU height whose lines fit in one band buffer.
+ *
+ * If all band buffers are filled before the callback hands one back, the 2D-DMA runs out of receive
+ * descriptors and back-pressures the decoder until the next band buffer is recycled, so no band is ever
+ * overwritten. The function returns after the last band has been delivered.
+ *
+ * @note The content of the `bit_stream` buffer must not be modified until this function returns.
+ *
+ * @param[in] decoder_engine Handle of the JPEG decoder instance to use for processing.
+ * @param[in] decode_cfg Config structure of decoder.
+ * @param[in] bit_stream Pointer to the buffer containing the input JPEG image data.
+ * @param[in] stream_size Size of the input JPEG image data in bytes.
+ * @param[in] band_cfg Config structure of the band process, including the band buffer ring and the band callback.
+ * @param[out] out_size Pointer to a variable that will receive the total length of the decoded image data.
+ * @return
+ *      - ESP_OK: JPEG decoder process successfully.
+ *      - ESP_ERR_INVALID_ARG: JPEG decoder process failed because of invalid argument.
+ *      - ESP_ERR_NO_MEM: JPEG decoder process failed because of out of memory.
+ *      - ESP_ERR_TIMEOUT: JPEG decoder process failed because of timeout.
+ */
+esp_err_t jpeg_decoder_process_banded(jpeg_decoder_handle_t decoder_engine, const jpeg_decode_cfg_t *decode_cfg, const uint8_t *bit_stream, uint32_t stream_size, const jpeg_decode_band_cfg_t *band_cfg, uint32_t *out_size);
+
 /**
  * @brief Release resources used by a JPEG decoder instance.
  *
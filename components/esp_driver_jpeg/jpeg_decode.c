@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <sys/param.h>
 #include "esp_err.h"
 #include "jpeg_private.h"
 #include "private/jpeg_parse_marker.h"
@@ -37,7 +38,10 @@
 static const char *TAG = "jpeg.decoder";
 
 static void s_decoder_error_log_print(uint32_t status);
+static void cfg_desc(jpeg_decoder_handle_t decoder_engine, dma2d_descriptor_t *dsc, uint8_t en_2d, uint8_t mode, uint16_t vb, uint16_t hb, uint8_t eof, uint32_t pbyte, uint8_t owner, uint16_t va, uint16_t ha, uint8_t *buf, dma2d_descriptor_t *next_dsc);
+static esp_err_t jpeg_dec_get_dma_rx_block_info(jpeg_decoder_handle_t decoder_engine, uint32_t *dma_hb, uint32_t *dma_vb, uint32_t *dma_pbyte);
 static esp_err_t jpeg_dec_config_dma_descriptor(jpeg_decoder_handle_t decoder_engine);
+static void jpeg_dec_config_band_descriptor(jpeg_decoder_handle_t decoder_engine, dma2d_descriptor_t *dsc, uint32_t dma_hb, uint32_t dma_vb, uint32_t dma_pbyte, uint32_t band_va, uint8_t *band_buf, dma2d_descriptor_t *next_dsc);
 static esp_err_t jpeg_parse_marker(jpeg_decoder_handle_t decoder_engine, const uint8_t *in_buf, uint32_t inbuf_len);
 static esp_err_t jpeg_parse_header_info_to_hw(jpeg_decoder_handle_t decoder_engine);
 static bool jpeg_dec_transaction_on_picked(uint32_t channel_num, const dma2d_trans_channel_info_t *dma2d_chans, void *users_config);
@@ -108,7 +112,8 @@ esp_err_t jpeg_new_decoder_engine(const jpeg_decode_engine_cfg_t *dec_eng_cfg, j
     jpeg_ll_enable_intr_mask(hal->dev, JPEG_LL_DECODER_EVENT_INTR);
 
     // Initialize queue
-    decoder_engine->evt_queue = xQueueCreateWithCaps(2, sizeof(jpeg_dma2d_dec_evt_t), JPEG_MEM_ALLOC_CAPS);
+    decoder_engine->evt_queue_depth = 2;
+    decoder_engine->evt_queue = xQueueCreateWithCaps(decoder_engine->evt_queue_depth, sizeof(jpeg_dma2d_dec_evt_t), JPEG_MEM_ALLOC_CAPS);
     ESP_GOTO_ON_FALSE(decoder_engine->evt_queue, ESP_ERR_NO_MEM, err, TAG, "No memory for event queue");
 
     dma2d_pool_config_t dma2d_client_config = {
@@ -216,6 +221,7 @@ esp_err_t jpeg_decoder_process(jpeg_decoder_handle_t decoder_engine, const jpeg_
     decoder_engine->rgb_order = decode_cfg->rgb_order;
     decoder_engine->conv_std = decode_cfg->conv_std;
     decoder_engine->decoded_buf = decode_outbuf;
+    decoder_engine->band_decode_mode = false;
 
     ESP_GOTO_ON_ERROR(jpeg_parse_marker(decoder_engine, bit_stream, stream_size), err2, TAG, "jpeg parse marker failed");
     ESP_GOTO_ON_ERROR(jpeg_parse_header_info_to_hw(decoder_engine), err2, TAG, "write header info to hw failed");
@@ -275,6 +281,174 @@ err2:
     return ret;
 }
 
+esp_err_t jpeg_decoder_process_banded(jpeg_decoder_handle_t decoder_engine, const jpeg_decode_cfg_t *decode_cfg, const uint8_t *bit_stream, uint32_t stream_size, const jpeg_decode_band_cfg_t *band_cfg, uint32_t *out_size)
+{
+    ESP_RETURN_ON_FALSE(decoder_engine, ESP_ERR_INVALID_ARG, TAG, "jpeg decode handle is null");
+    ESP_RETURN_ON_FALSE(decode_cfg, ESP_ERR_INVALID_ARG, TAG, "jpeg decode config is null");
+    ESP_RETURN_ON_FALSE(band_cfg && band_cfg->band_bufs && band_cfg->on_band_decoded, ESP_ERR_INVALID_ARG, TAG, "jpeg decode band config is invalid");
+    ESP_RETURN_ON_FALSE(band_cfg->num_band_bufs >= 2, ESP_ERR_INVALID_ARG, TAG, "at least 2 band buffers are needed to overlap decode and post-process");
+    esp_dma_mem_info_t dma_mem_info = {
+        .dma_alignment_bytes = 4,
+    };
+    for (uint32_t i = 0; i < band_cfg->num_band_bufs; i++) {
+        ESP_RETURN_ON_FALSE(esp_dma_is_buffer_alignment_satisfied(band_cfg->band_bufs[i], band_cfg->band_buf_size, dma_mem_info), ESP_ERR_INVALID_ARG, TAG, "band buffer % " PRId32 " is not aligned, please use jpeg_alloc_decoder_mem to malloc your buffer", i);
+    }
+
+    esp_err_t ret = ESP_OK;
+
+    if (decoder_engine->codec_base->pm_lock) {
+        ESP_RETURN_ON_ERROR(esp_pm_lock_acquire(decoder_engine->codec_base->pm_lock), TAG, "acquire pm_lock failed");
+    }
+
+    xSemaphoreTake(decoder_engine->codec_base->codec_mutex, portMAX_DELAY);
+
+    // The descriptor ring holds one descriptor more than there are band buffers, so that a recycled band
+    // is always linked behind a tail descriptor different from its own and `dma2d_append` can pick it up.
+    uint32_t ring_len = band_cfg->num_band_bufs + 1;
+    if (decoder_engine->band_desc_count < ring_len) {
+        uint32_t cache_line_size = cache_hal_get_cache_line_size(CACHE_LL_LEVEL_EXT_MEM, CACHE_TYPE_DATA);
+        if (decoder_engine->band_rxlink) {
+            free(decoder_engine->band_rxlink);
+            decoder_engine->band_desc_count = 0;
+        }
+        decoder_engine->band_rxlink = (dma2d_descriptor_t*)heap_caps_aligned_calloc(cache_line_size, ring_len, decoder_engine->dma_desc_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL | JPEG_MEM_ALLOC_CAPS);
+        ESP_GOTO_ON_FALSE(decoder_engine->band_rxlink, ESP_ERR_NO_MEM, err2, TAG, "no memory for jpeg decode band rxlink");
+        decoder_engine->band_desc_count = ring_len;
+    }
+
+    // One rx done event can be pending per armed band, plus the final eof and a possible decoder error.
+    if (decoder_engine->evt_queue_depth < band_cfg->num_band_bufs + 2) {
+        QueueHandle_t new_queue = xQueueCreateWithCaps(band_cfg->num_band_bufs + 2, sizeof(jpeg_dma2d_dec_evt_t), JPEG_MEM_ALLOC_CAPS);
+        ESP_GOTO_ON_FALSE(new_queue, ESP_ERR_NO_MEM, err2, TAG, "No memory for event queue");
+        vQueueDeleteWithCaps(decoder_engine->evt_queue);
+        decoder_engine->evt_queue = new_queue;
+        decoder_engine->evt_queue_depth = band_cfg->num_band_bufs + 2;
+    }
+    /* Reset queue */
+    xQueueReset(decoder_engine->evt_queue);
+
+    decoder_engine->output_format = decode_cfg->output_format;
+    decoder_engine->rgb_order = decode_cfg->rgb_order;
+    decoder_engine->conv_std = decode_cfg->conv_std;
+    decoder_engine->decoded_buf = NULL;
+    decoder_engine->band_decode_mode = true;
+
+    ESP_GOTO_ON_ERROR(jpeg_parse_marker(decoder_engine, bit_stream, stream_size), err2, TAG, "jpeg parse marker failed");
+    ESP_GOTO_ON_ERROR(jpeg_parse_header_info_to_hw(decoder_engine), err2, TAG, "write header info to hw failed");
+
+    uint32_t dma_hb = 0;
+    uint32_t dma_vb = 0;
+    uint32_t dma_pbyte = 0;
+    ESP_GOTO_ON_ERROR(jpeg_dec_get_dma_rx_block_info(decoder_engine, &dma_hb, &dma_vb, &dma_pbyte), err2, TAG, "get dma block info failed");
+
+    jpeg_dec_header_info_t *header_info = decoder_engine->header_info;
+    uint32_t bytes_per_line = header_info->process_h * decoder_engine->bit_per_pixel / 8;
+    // A band must cover a whole number of MCU rows, otherwise the 2D-DMA cannot switch descriptors in between.
+    uint32_t band_lines = band_cfg->band_buf_size / bytes_per_line / header_info->mcuy * header_info->mcuy;
+    ESP_GOTO_ON_FALSE(band_lines >= header_info->mcuy, ESP_ERR_INVALID_ARG, err2, TAG, "band buffer size % " PRId32 " cannot hold one MCU row (% " PRId32 " bytes)", band_cfg->band_buf_size, bytes_per_line * header_info->mcuy);
+    uint32_t num_bands = (header_info->process_v + band_lines - 1) / band_lines;
+
+    *out_size = header_info->process_h * header_info->process_v * decoder_engine->bit_per_pixel / 8;
+
+    // Configure tx link descriptor, same as in whole-picture decode.
+    cfg_desc(decoder_engine, decoder_engine->txlink, JPEG_DMA2D_2D_DISABLE, DMA2D_DESCRIPTOR_BLOCK_RW_MODE_SINGLE, header_info->buffer_left & JPEG_DMA2D_MAX_SIZE, header_info->buffer_left & JPEG_DMA2D_MAX_SIZE, JPEG_DMA2D_EOF_NOT_LAST, 1, DMA2D_DESCRIPTOR_BUFFER_OWNER_DMA, (header_info->buffer_left >> JPEG_DMA2D_1D_HIGH_14BIT), (header_info->buffer_left >> JPEG_DMA2D_1D_HIGH_14BIT), header_info->buffer_offset, NULL);
+
+    // Arm one rx descriptor per band buffer (configure back to front, as cfg_desc links and syncs the descriptor).
+    uint32_t initial_armed = MIN(num_bands, band_cfg->num_band_bufs);
+    for (int i = initial_armed - 1; i >= 0; i--) {
+        dma2d_descriptor_t *dsc = (dma2d_descriptor_t *)((uint8_t *)decoder_engine->band_rxlink + (i % ring_len) * decoder_engine->dma_desc_size);
+        dma2d_descriptor_t *next_dsc = (i == (int)initial_armed - 1) ? NULL : (dma2d_descriptor_t *)((uint8_t *)decoder_engine->band_rxlink + ((i + 1) % ring_len) * decoder_engine->dma_desc_size);
+        uint32_t lines = MIN(band_lines, header_info->process_v - i * band_lines);
+        jpeg_dec_config_band_descriptor(decoder_engine, dsc, dma_hb, dma_vb, dma_pbyte, lines, band_cfg->band_bufs[i % band_cfg->num_band_bufs], next_dsc);
+    }
+
+    dma2d_trans_config_t trans_desc = {
+        .tx_channel_num = 1,
+        .rx_channel_num = 1,
+        .channel_flags = DMA2D_CHANNEL_FUNCTION_FLAG_RX_REORDER,
+        .user_config = decoder_engine,
+        .on_job_picked = jpeg_dec_transaction_on_picked,
+    };
+
+    // Before 2DDMA starts. sync buffer from cache to psram
+    ret = esp_cache_msync((void*)header_info->buffer_offset, header_info->buffer_left, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+    assert(ret == ESP_OK);
+
+    ESP_GOTO_ON_ERROR(dma2d_enqueue(decoder_engine->dma2d_group_handle, &trans_desc, decoder_engine->trans_desc), err2, TAG, "enqueue dma2d failed");
+    bool need_yield;
+    uint32_t next_band_to_deliver = 0;
+    uint32_t next_band_to_arm = initial_armed;
+    // Blocking for JPEG decode transaction finishes, delivering bands as they land.
+    while (1) {
+        jpeg_dma2d_dec_evt_t jpeg_dma2d_event;
+        BaseType_t ret_val = xQueueReceive(decoder_engine->evt_queue, &jpeg_dma2d_event, decoder_engine->timeout_tick);
+        ESP_GOTO_ON_FALSE(ret_val == pdTRUE, ESP_ERR_TIMEOUT, err1, TAG, "jpeg-dma2d handle jpeg decode timeout, please check image accuracy and `timeout_ms` ");
+
+        // Dealing with JPEG event
+        if (jpeg_dma2d_event.jpgd_status != 0) {
+            uint32_t status = jpeg_dma2d_event.jpgd_status;
+            s_decoder_error_log_print(status);
+            ret = ESP_ERR_INVALID_STATE;
+            goto err1;
+        }
+
+        if (jpeg_dma2d_event.dma_evt & (JPEG_DMA2D_RX_DONE | JPEG_DMA2D_RX_EOF)) {
+            bool is_eof = jpeg_dma2d_event.dma_evt & JPEG_DMA2D_RX_EOF;
+            // One band is delivered per rx done event; the eof event flushes whatever is left.
+            while (next_band_to_deliver < num_bands) {
+                uint8_t *band_buf = band_cfg->band_bufs[next_band_to_deliver % band_cfg->num_band_bufs];
+                uint32_t lines = MIN(band_lines, header_info->process_v - next_band_to_deliver * band_lines);
+                ret = esp_cache_msync((void*)band_buf, band_cfg->band_buf_size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+                assert(ret == ESP_OK);
+                jpeg_decode_band_event_data_t band_event = {
+                    .band_buf = band_buf,
+                    .band_size = lines * bytes_per_line,
+                    .band_offset_y = next_band_to_deliver * band_lines,
+                    .band_lines = lines,
+                };
+                band_cfg->on_band_decoded(decoder_engine, &band_event, band_cfg->user_ctx);
+                next_band_to_deliver++;
+                // The delivered band buffer is free again, recycle it for the next pending band and
+                // append it behind the current chain tail.
+                if (next_band_to_arm < num_bands) {
+                    dma2d_descriptor_t *new_dsc = (dma2d_descriptor_t *)((uint8_t *)decoder_engine->band_rxlink + (next_band_to_arm % ring_len) * decoder_engine->dma_desc_size);
+                    dma2d_descriptor_t *tail_dsc = (dma2d_descriptor_t *)((uint8_t *)decoder_engine->band_rxlink + ((next_band_to_arm - 1) % ring_len) * decoder_engine->dma_desc_size);
+                    uint32_t arm_lines = MIN(band_lines, header_info->process_v - next_band_to_arm * band_lines);
+                    jpeg_dec_config_band_descriptor(decoder_engine, new_dsc, dma_hb, dma_vb, dma_pbyte, arm_lines, band_cfg->band_bufs[next_band_to_arm % band_cfg->num_band_bufs], NULL);
+                    tail_dsc->next = new_dsc;
+                    esp_err_t msync_ret = esp_cache_msync((void*)tail_dsc, decoder_engine->dma_desc_size, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_INVALIDATE);
+                    assert(msync_ret == ESP_OK);
+                    dma2d_append(decoder_engine->dma2d_rx_channel);
+                    next_band_to_arm++;
+                }
+                if (!is_eof) {
+                    break;
+                }
+            }
+            if (is_eof && next_band_to_deliver >= num_bands) {
+                break;
+            }
+        }
+    }
+
+    decoder_engine->band_decode_mode = false;
+    xSemaphoreGive(decoder_engine->codec_base->codec_mutex);
+    if (decoder_engine->codec_base->pm_lock) {
+        ESP_RETURN_ON_ERROR(esp_pm_lock_release(decoder_engine->codec_base->pm_lock), TAG, "release pm_lock failed");
+    }
+    return ESP_OK;
+
+err1:
+    dma2d_force_end(decoder_engine->trans_desc, &need_yield);
+err2:
+    decoder_engine->band_decode_mode = false;
+    xSemaphoreGive(decoder_engine->codec_base->codec_mutex);
+    if (decoder_engine->codec_base->pm_lock) {
+        esp_pm_lock_release(decoder_engine->codec_base->pm_lock);
+    }
+    return ret;
+}
+
 esp_err_t jpeg_del_decoder_engine(jpeg_decoder_handle_t decoder_engine)
 {
     ESP_RETURN_ON_FALSE(decoder_engine, ESP_ERR_INVALID_ARG, TAG, "jpeg decode handle is null");
@@ -286,6 +460,9 @@ esp_err_t jpeg_del_decoder_engine(jpeg_decoder_handle_t decoder_engine)
         if (decoder_engine->txlink) {
             free(decoder_engine->txlink);
         }
+        if (decoder_engine->band_rxlink) {
+            free(decoder_engine->band_rxlink);
+        }
         if (decoder_engine->header_info) {
             free(decoder_engine->header_info);
         }
@@ -347,10 +524,8 @@ static void cfg_desc(jpeg_decoder_handle_t decoder_engine, dma2d_descriptor_t *d
     assert(ret == ESP_OK);
 }
 
-static esp_err_t jpeg_dec_config_dma_descriptor(jpeg_decoder_handle_t decoder_engine)
+static esp_err_t jpeg_dec_get_dma_rx_block_info(jpeg_decoder_handle_t decoder_engine, uint32_t *dma_hb, uint32_t *dma_vb, uint32_t *dma_pbyte)
 {
-    ESP_LOGD(TAG, "Config 2DDMA parameter start");
-
     jpeg_dec_format_hb_t best_hb_idx = 0;
     color_space_pixel_format_t picture_format;
     picture_format.color_type_id = decoder_engine->output_format;
@@ -396,18 +571,36 @@ static esp_err_t jpeg_dec_config_dma_descriptor(jpeg_decoder_handle_t decoder_en
         return ESP_ERR_NOT_SUPPORTED;
     }
 
-    uint32_t dma_hb = dec_hb_tbl[sample_method_idx][best_hb_idx];
-    uint32_t dma_vb = decoder_engine->header_info->mcuy;
+    *dma_hb = dec_hb_tbl[sample_method_idx][best_hb_idx];
+    *dma_vb = decoder_engine->header_info->mcuy;
+    *dma_pbyte = dma2d_desc_pixel_format_to_pbyte_value(picture_format);
+
+    return ESP_OK;
+}
+
+static esp_err_t jpeg_dec_config_dma_descriptor(jpeg_decoder_handle_t decoder_engine)
+{
+    ESP_LOGD(TAG, "Config 2DDMA parameter start");
+
+    uint32_t dma_hb = 0;
+    uint32_t dma_vb = 0;
+    uint32_t dma_pbyte = 0;
+    ESP_RETURN_ON_ERROR(jpeg_dec_get_dma_rx_block_info(decoder_engine, &dma_hb, &dma_vb, &dma_pbyte), TAG, "get dma block info failed");
 
     // Configure tx link descriptor
     cfg_desc(decoder_engine, decoder_engine->txlink, JPEG_DMA2D_2D_DISABLE, DMA2D_DESCRIPTOR_BLOCK_RW_MODE_SINGLE, decoder_engine->header_info->buffer_left & JPEG_DMA2D_MAX_SIZE, decoder_engine->header_info->buffer_left & JPEG_DMA2D_MAX_SIZE, JPEG_DMA2D_EOF_NOT_LAST, 1, DMA2D_DESCRIPTOR_BUFFER_OWNER_DMA, (decoder_engine->header_info->buffer_left >> JPEG_DMA2D_1D_HIGH_14BIT), (decoder_engine->header_info->buffer_left >> JPEG_DMA2D_1D_HIGH_14BIT), decoder_engine->header_info->buffer_offset, NULL);
 
     // Configure rx link descriptor
-    cfg_desc(decoder_engine, decoder_engine->rxlink, JPEG_DMA2D_2D_ENABLE, DMA2D_DESCRIPTOR_BLOCK_RW_MODE_MULTIPLE, dma_vb, dma_hb, JPEG_DMA2D_EOF_NOT_LAST, dma2d_desc_pixel_format_to_pbyte_value(picture_format), DMA2D_DESCRIPTOR_BUFFER_OWNER_DMA, decoder_engine->header_info->process_v, decoder_engine->header_info->process_h, decoder_engine->decoded_buf, NULL);
+    cfg_desc(decoder_engine, decoder_engine->rxlink, JPEG_DMA2D_2D_ENABLE, DMA2D_DESCRIPTOR_BLOCK_RW_MODE_MULTIPLE, dma_vb, dma_hb, JPEG_DMA2D_EOF_NOT_LAST, dma_pbyte, DMA2D_DESCRIPTOR_BUFFER_OWNER_DMA, decoder_engine->header_info->process_v, decoder_engine->header_info->process_h, decoder_engine->decoded_buf, NULL);
 
     return ESP_OK;
 }
 
+static void jpeg_dec_config_band_descriptor(jpeg_decoder_handle_t decoder_engine, dma2d_descriptor_t *dsc, uint32_t dma_hb, uint32_t dma_vb, uint32_t dma_pbyte, uint32_t band_va, uint8_t *band_buf, dma2d_descriptor_t *next_dsc)
+{
+    cfg_desc(decoder_engine, dsc, JPEG_DMA2D_2D_ENABLE, DMA2D_DESCRIPTOR_BLOCK_RW_MODE_MULTIPLE, dma_vb, dma_hb, JPEG_DMA2D_EOF_NOT_LAST, dma_pbyte, DMA2D_DESCRIPTOR_BUFFER_OWNER_DMA, band_va, decoder_engine->header_info->process_h, band_buf, next_dsc);
+}
+
 static bool jpeg_rx_eof(dma2d_channel_handle_t dma2d_chan, dma2d_event_data_t *event_data, void *user_data)
 {
     portBASE_TYPE higher_priority_task_awoken = pdFALSE;
@@ -422,6 +615,20 @@ static bool jpeg_rx_eof(dma2d_channel_handle_t dma2d_chan, dma2d_event_data_t *e
     return higher_priority_task_awoken;
 }
 
+static bool jpeg_rx_band_done(dma2d_channel_handle_t dma2d_chan, dma2d_event_data_t *event_data, void *user_data)
+{
+    portBASE_TYPE higher_priority_task_awoken = pdFALSE;
+    jpeg_dma2d_dec_evt_t dec_evt = {
+        .jpgd_status = 0,
+        .dma_evt = 0,
+    };
+    jpeg_decoder_handle_t decoder_engine = (jpeg_decoder_handle_t) user_data;
+    dec_evt.dma_evt = JPEG_DMA2D_RX_DONE;
+    xQueueSendFromISR(decoder_engine->evt_queue, &dec_evt, &higher_priority_task_awoken);
+
+    return higher_priority_task_awoken;
+}
+
 static void jpeg_dec_config_dma_csc(jpeg_decoder_handle_t decoder_engine, dma2d_channel_handle_t rx_chan)
 {
 
@@ -538,11 +745,15 @@ static bool jpeg_dec_transaction_on_picked(uint32_t channel_num, const dma2d_tra
     dma2d_rx_event_callbacks_t jpeg_dec_cbs = {
         .on_recv_eof = jpeg_rx_eof,
     };
+    if (decoder_engine->band_decode_mode) {
+        // In band decode mode, every finished rx descriptor hands one band to the processing task
+        jpeg_dec_cbs.on_desc_done = jpeg_rx_band_done;
+    }
 
     dma2d_register_rx_event_callbacks(rx_chan, &jpeg_dec_cbs, decoder_engine);
 
     dma2d_set_desc_addr(tx_chan, (intptr_t)decoder_engine->txlink);
-    dma2d_set_desc_addr(rx_chan, (intptr_t)decoder_engine->rxlink);
+    dma2d_set_desc_addr(rx_chan, decoder_engine->band_decode_mode ? (intptr_t)decoder_engine->band_rxlink : (intptr_t)decoder_engine->rxlink);
     dma2d_start(tx_chan);
     dma2d_start(rx_chan);
     jpeg_ll_process_start(hal->dev);
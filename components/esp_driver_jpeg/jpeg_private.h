@@ -100,14 +100,18 @@ struct jpeg_decoder_t {
     bool no_color_conversion;                    // No color conversion, directly output based on compressed format
     uint8_t bit_per_pixel;                       // bit size per pixel
     QueueHandle_t evt_queue;                     // jpeg event from 2DDMA and JPEG engine
+    uint32_t evt_queue_depth;                    // depth of evt_queue
     uint8_t *decoded_buf;                        // pointer to the rx buffer.
     uint32_t total_size;                         // jpeg picture origin size (in bytes)
     TickType_t timeout_tick;                     // timeout value for jpeg decoder (in cpu tick).
+    bool band_decode_mode;                       // whether the on-going transaction decodes into row bands
     jpeg_isr_handler_t *intr_handle;             // jpeg decoder interrupt handler
     //dma handles
     dma2d_pool_handle_t dma2d_group_handle;      // 2D-DMA group handle
     dma2d_descriptor_t *rxlink;                  // Pointer to 2D-DMA rx descriptor
     dma2d_descriptor_t *txlink;                  // Pointer to 2D-DMA tx descriptor
+    dma2d_descriptor_t *band_rxlink;             // Array of 2D-DMA rx descriptors used in band decode mode
+    uint32_t band_desc_count;                    // Number of descriptors allocated in band_rxlink
     uint32_t dma_desc_size;                      // tx and rx linker alignment
     dma2d_channel_handle_t dma2d_rx_channel;     // DMA2D RX channel handle
     dma2d_channel_handle_t dma2d_tx_channel;     // DMA2D TX channel handle
@@ -541,6 +541,55 @@ esp_err_t ledc_fade_stop(ledc_mode_t speed_mode, ledc_channel_t channel);
  */
 esp_err_t ledc_set_duty_and_update(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t duty, uint32_t hpoint);
 
+/**
+ * @brief A thread-safe API to set the duty of multiple LEDC channels and commit them together.
+ *
+ *        All selected channels are staged and updated within one critical section, the update
+ *        triggers are fired back to back, so the outputs change within the same PWM cycle
+ *        instead of requiring one locked register transaction per channel.
+ *
+ * @note  Call ledc_fade_func_install() once, before calling this function.
+ * @note  For ESP32, hardware does not support any duty change while a fade operation is running in progress on that channel.
+ *        Other duty operations will have to wait until the fade operation has finished.
+ *
+ * @param speed_mode Select the LEDC channel group with specified speed mode. Note that not all targets support high speed mode.
+ * @param channel_mask Bit mask of the LEDC channels to update, bit n selects channel n
+ * @param duties Array of at least LEDC_CHANNEL_MAX entries, duties[n] is applied to channel n, the range of duty setting is [0, (2**duty_resolution)]
+ *
+ * @return
+ *      - ESP_OK Success
+ *      - ESP_ERR_INVALID_STATE Channel not initialized
+ *      - ESP_ERR_INVALID_ARG Parameter error
+ *      - ESP_FAIL Fade function init error
+ */
+esp_err_t ledc_set_duty_and_update_batch(ledc_mode_t speed_mode, uint32_t channel_mask, const uint32_t *duties);
+
+/**
+ * @brief A thread-safe API to queue a hardware fade stage on a channel for chained fading.
+ *
+ *        If no fade is in progress, the stage starts immediately (non-blocking). Otherwise it is
+ *        held in a small per-channel queue and preloaded into the hardware by the fade ISR as soon
+ *        as the running fade reaches its target, so a multi-stage animation runs without per-stage
+ *        task involvement. The fade-end callback is only invoked once the last queued stage has
+ *        completed. ledc_fade_stop() cancels the running fade together with any queued stages.
+ *
+ * @note  Call ledc_fade_func_install() once before calling this function.
+ *
+ * @param speed_mode Select the LEDC channel group with specified speed mode. Note that not all targets support high speed mode.
+ * @param channel LEDC channel index (0 - LEDC_CHANNEL_MAX-1), select from ledc_channel_t
+ * @param target_duty Target duty of fading [0, (2**duty_resolution)]
+ * @param scale Controls the increase or decrease step scale.
+ * @param cycle_num increase or decrease the duty every cycle_num cycles
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ *     - ESP_ERR_INVALID_STATE Channel not initialized
+ *     - ESP_ERR_NO_MEM Fade stage queue is full
+ *     - ESP_FAIL Fade function init error
+ */
+esp_err_t ledc_fade_chain_with_step(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t target_duty, uint32_t scale, uint32_t cycle_num);
+
 /**
  * @brief A thread-safe API to set and start LEDC fade function, with a limited time.
  *
@@ -73,6 +73,14 @@ typedef enum {
     LEDC_FSM_KILLED_PENDING,
 } ledc_fade_fsm_t;
 
+#define LEDC_FADE_CHAIN_DEPTH (4)   // Queued fade stages per channel for hardware fade chaining
+
+typedef struct {
+    uint32_t target_duty;
+    int scale;
+    int cycle_num;
+} ledc_fade_stage_t;
+
 typedef struct {
     ledc_mode_t speed_mode;
     ledc_duty_direction_t direction;
@@ -85,6 +93,9 @@ typedef struct {
     ledc_cb_t ledc_fade_callback;
     void *cb_user_arg;
     volatile ledc_fade_fsm_t fsm;
+    ledc_fade_stage_t chain[LEDC_FADE_CHAIN_DEPTH];  // Pending fade stages, preloaded by the fade ISR when the running fade ends
+    uint8_t chain_head;
+    uint8_t chain_len;
 } ledc_fade_t;
 
 typedef struct {
@@ -1241,12 +1252,50 @@ static void IRAM_ATTR ledc_fade_isr(void *arg)
 
             bool finished = false;
             portENTER_CRITICAL_ISR(&ledc_spinlock);
-            state = s_ledc_fade_rec[speed_mode][channel]->fsm;
+            ledc_fade_t *fade = s_ledc_fade_rec[speed_mode][channel];
+            state = fade->fsm;
             assert(state != LEDC_FSM_IDLE && state != LEDC_FSM_HW_FADE);
-            if (set_to_idle || state == LEDC_FSM_KILLED_PENDING) {
-                // Either fade has completed or has been killed, skip HW duty config
+            if (state == LEDC_FSM_KILLED_PENDING) {
+                // Fade has been killed, drop any queued stages and skip HW duty config
+                finished = true;
+                fade->chain_len = 0;
+                fade->fsm = LEDC_FSM_IDLE;
+            } else if (set_to_idle && fade->chain_len > 0) {
+                // Fade has completed, preload the next queued stage without releasing the hardware
+                ledc_fade_stage_t stage = fade->chain[fade->chain_head];
+                fade->chain_head = (fade->chain_head + 1) % LEDC_FADE_CHAIN_DEPTH;
+                fade->chain_len--;
+                int stage_delta = (duty_cur > stage.target_duty) ? (duty_cur - stage.target_duty) : (stage.target_duty - duty_cur);
+                fade->direction = (duty_cur > stage.target_duty) ? LEDC_DUTY_DIR_DECREASE : LEDC_DUTY_DIR_INCREASE;
+                fade->target_duty = stage.target_duty;
+                fade->cycle_num = stage.cycle_num;
+                fade->scale = stage.scale;
+                if (stage.scale > 0 && stage_delta > stage.scale) {
+                    next_duty = duty_cur;
+                    step = (stage_delta / stage.scale > LEDC_DUTY_NUM_MAX) ? LEDC_DUTY_NUM_MAX : (stage_delta / stage.scale);
+                    cycle = stage.cycle_num;
+                    scale = stage.scale;
+                } else {
+                    next_duty = stage.target_duty;
+                    step = 1;
+                    cycle = 1;
+                    scale = 0;
+                }
+                ledc_duty_config(speed_mode,
+                                 channel,
+                                 LEDC_VAL_NO_CHANGE,
+                                 next_duty,
+                                 fade->direction,
+                                 step,
+                                 cycle,
+                                 scale);
+                fade->fsm = LEDC_FSM_HW_FADE;
+                ledc_hal_set_duty_start(&(p_ledc_obj[speed_mode]->ledc_hal), channel, true);
+                ledc_ls_channel_update(speed_mode, channel);
+            } else if (set_to_idle) {
+                // Fade has completed, skip HW duty config
                 finished = true;
-                s_ledc_fade_rec[speed_mode][channel]->fsm = LEDC_FSM_IDLE;
+                fade->fsm = LEDC_FSM_IDLE;
             } else if (state == LEDC_FSM_ISR_CAL) {
                 // Loading new fade to start
                 ledc_duty_config(speed_mode,
@@ -1490,6 +1539,8 @@ esp_err_t ledc_fade_stop(ledc_mode_t speed_mode, ledc_channel_t channel)
     }
     // Fade state is either HW_FADE or ISR_CAL (there is a fade in process)
     portENTER_CRITICAL(&ledc_spinlock);
+    // Queued fade stages are cancelled together with the running fade
+    fade->chain_len = 0;
     // Disable ledc channel interrupt first
     ledc_enable_intr_type(speed_mode, channel, LEDC_INTR_DISABLE);
     // Config duty to the duty cycle at this moment
@@ -1584,6 +1635,84 @@ esp_err_t ledc_set_duty_and_update(ledc_mode_t speed_mode, ledc_channel_t channe
     return ESP_OK;
 }
 
+esp_err_t ledc_set_duty_and_update_batch(ledc_mode_t speed_mode, uint32_t channel_mask, const uint32_t *duties)
+{
+    LEDC_ARG_CHECK(speed_mode < LEDC_SPEED_MODE_MAX, "speed_mode");
+    LEDC_ARG_CHECK(channel_mask != 0 && channel_mask < (1U << LEDC_CHANNEL_MAX), "channel_mask");
+    LEDC_ARG_CHECK(duties != NULL, "duties");
+    LEDC_CHECK(p_ledc_obj[speed_mode] != NULL, LEDC_NOT_INIT, ESP_ERR_INVALID_STATE);
+    for (int channel = 0; channel < LEDC_CHANNEL_MAX; channel++) {
+        if (channel_mask & (1 << channel)) {
+            LEDC_ARG_CHECK(duties[channel] <= ledc_get_max_duty(speed_mode, channel), "duty");
+            LEDC_CHECK(ledc_fade_channel_init_check(speed_mode, channel) == ESP_OK, LEDC_FADE_INIT_ERROR_STR, ESP_FAIL);
+        }
+    }
+    // Acquire the fade hardware of every selected channel first, so a running fade cannot be trampled
+    for (int channel = 0; channel < LEDC_CHANNEL_MAX; channel++) {
+        if (channel_mask & (1 << channel)) {
+            _ledc_fade_hw_acquire(speed_mode, channel);
+        }
+    }
+    portENTER_CRITICAL(&ledc_spinlock);
+    for (int channel = 0; channel < LEDC_CHANNEL_MAX; channel++) {
+        if (channel_mask & (1 << channel)) {
+            ledc_duty_config(speed_mode, channel, LEDC_VAL_NO_CHANGE, duties[channel], 1, 1, 1, 0);
+        }
+    }
+    // All duties are staged, fire the update triggers back to back so the outputs change within the same PWM cycle
+    for (int channel = 0; channel < LEDC_CHANNEL_MAX; channel++) {
+        if (channel_mask & (1 << channel)) {
+            _ledc_update_duty(speed_mode, channel);
+        }
+    }
+    portEXIT_CRITICAL(&ledc_spinlock);
+    for (int channel = 0; channel < LEDC_CHANNEL_MAX; channel++) {
+        if (channel_mask & (1 << channel)) {
+            _ledc_fade_hw_release(speed_mode, channel);
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t ledc_fade_chain_with_step(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t target_duty, uint32_t scale, uint32_t cycle_num)
+{
+    LEDC_ARG_CHECK(speed_mode < LEDC_SPEED_MODE_MAX, "speed_mode");
+    LEDC_ARG_CHECK(channel < LEDC_CHANNEL_MAX, "channel");
+    LEDC_ARG_CHECK((scale > 0) && (scale <= LEDC_LL_DUTY_SCALE_MAX), "fade scale");
+    LEDC_ARG_CHECK((cycle_num > 0) && (cycle_num <= LEDC_LL_DUTY_CYCLE_MAX), "cycle_num");
+    LEDC_ARG_CHECK(target_duty <= ledc_get_max_duty(speed_mode, channel), "target_duty");
+    LEDC_CHECK(p_ledc_obj[speed_mode] != NULL, LEDC_NOT_INIT, ESP_ERR_INVALID_STATE);
+    LEDC_CHECK(ledc_fade_channel_init_check(speed_mode, channel) == ESP_OK, LEDC_FADE_INIT_ERROR_STR, ESP_FAIL);
+
+    ledc_fade_t *fade = s_ledc_fade_rec[speed_mode][channel];
+    esp_err_t ret = ESP_OK;
+    bool start_now = false;
+    _ledc_op_lock_acquire(speed_mode, channel);
+    portENTER_CRITICAL(&ledc_spinlock);
+    if (fade->fsm == LEDC_FSM_IDLE) {
+        // No fade in progress, this stage starts immediately
+        start_now = true;
+    } else if (fade->chain_len < LEDC_FADE_CHAIN_DEPTH) {
+        // A fade is running, queue the stage for the fade ISR to preload on fade end
+        fade->chain[(fade->chain_head + fade->chain_len) % LEDC_FADE_CHAIN_DEPTH] = (ledc_fade_stage_t) {
+            .target_duty = target_duty,
+            .scale = scale,
+            .cycle_num = cycle_num,
+        };
+        fade->chain_len++;
+    } else {
+        ret = ESP_ERR_NO_MEM;
+    }
+    portEXIT_CRITICAL(&ledc_spinlock);
+    if (start_now) {
+        _ledc_fade_hw_acquire(speed_mode, channel);
+        _ledc_set_fade_with_step(speed_mode, channel, target_duty, scale, cycle_num);
+        _ledc_fade_start(speed_mode, channel, LEDC_FADE_NO_WAIT);
+    }
+    _ledc_op_lock_release(speed_mode, channel);
+    return ret;
+}
+
 esp_err_t ledc_set_fade_time_and_start(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t target_duty, uint32_t max_fade_time_ms, ledc_fade_mode_t fade_mode)
 {
     LEDC_ARG_CHECK(speed_mode < LEDC_SPEED_MODE_MAX, "speed_mode");
@@ -252,6 +252,48 @@ TEST_CASE("LEDC fade with step", "[ledc]")
     ledc_fade_func_uninstall();
 }
 
+TEST_CASE("LEDC chained fade with step", "[ledc]")
+{
+    const ledc_mode_t test_speed_mode = TEST_SPEED_MODE;
+    fade_setup();
+
+    // First stage starts immediately, the next two are queued and preloaded by the fade ISR
+    TEST_ESP_OK(ledc_fade_chain_with_step(test_speed_mode, LEDC_CHANNEL_0, 4000, 4, 1));
+    TEST_ASSERT_LESS_THAN(4000, ledc_get_duty(test_speed_mode, LEDC_CHANNEL_0));
+    TEST_ESP_OK(ledc_fade_chain_with_step(test_speed_mode, LEDC_CHANNEL_0, 1000, 4, 1));
+    TEST_ESP_OK(ledc_fade_chain_with_step(test_speed_mode, LEDC_CHANNEL_0, 2000, 4, 1));
+    // 0->4000->1000->2000 with scale 4 every cycle at TEST_PWM_FREQ (2kHz) takes about 1s in total
+    vTaskDelay(1100 / portTICK_PERIOD_MS);
+    TEST_ASSERT_EQUAL_INT32(2000, ledc_get_duty(test_speed_mode, LEDC_CHANNEL_0));
+
+    //deinitialize fade service
+    ledc_fade_func_uninstall();
+}
+
+TEST_CASE("LEDC batch duty update", "[ledc]")
+{
+    const ledc_mode_t test_speed_mode = TEST_SPEED_MODE;
+    fade_setup();
+
+    // Bind a second channel to the same timer and commit both duties in one call
+    ledc_channel_config_t ledc_ch_config = initialize_channel_config();
+    ledc_ch_config.channel = LEDC_CHANNEL_1;
+    ledc_ch_config.duty = 0;
+    TEST_ESP_OK(ledc_channel_config(&ledc_ch_config));
+
+    uint32_t duties[LEDC_CHANNEL_MAX] = {
+        [LEDC_CHANNEL_0] = 1000,
+        [LEDC_CHANNEL_1] = 3000,
+    };
+    TEST_ESP_OK(ledc_set_duty_and_update_batch(test_speed_mode, BIT(LEDC_CHANNEL_0) | BIT(LEDC_CHANNEL_1), duties));
+    vTaskDelay(5 / portTICK_PERIOD_MS);
+    TEST_ASSERT_EQUAL_INT32(1000, ledc_get_duty(test_speed_mode, LEDC_CHANNEL_0));
+    TEST_ASSERT_EQUAL_INT32(3000, ledc_get_duty(test_speed_mode, LEDC_CHANNEL_1));
+
+    //deinitialize fade service
+    ledc_fade_func_uninstall();
+}
+
 TEST_CASE("LEDC fast switching duty with fade_wait_done", "[ledc]")
 {
     const ledc_mode_t test_speed_mode = TEST_SPEED_MODE;
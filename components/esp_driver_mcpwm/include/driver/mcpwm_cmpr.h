@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "esp_err.h"
 #include "driver/mcpwm_types.h"
 
@@ -113,6 +114,33 @@ esp_err_t mcpwm_comparator_register_event_callbacks(mcpwm_cmpr_handle_t cmpr, co
  */
 esp_err_t mcpwm_comparator_set_compare_value(mcpwm_cmpr_handle_t cmpr, uint32_t cmp_ticks);
 
+/**
+ * @brief Set the compare values of multiple MCPWM comparators in one batch commit
+ *
+ * @note All shadow registers are written with the shadow-to-active transfer frozen,
+ *       so the active compare values always change as one set: either all comparators
+ *       still hold their old values or all hold the new ones in any given PWM cycle,
+ *       even if a timer update event (e.g. tez) occurs in the middle of the batch.
+ *       The new values take effect together on the next update event of the comparators
+ *       (see `mcpwm_comparator_config_t::flags`). For the values to land in the same PWM cycle,
+ *       the operators must be connected to the same timer, or to timers that are phase-locked
+ *       by the sync submodule.
+ * @note All comparators must be allocated from operators of the same MCPWM group.
+ * @note This function is allowed to run within ISR context, it is cheap enough to be called
+ *       from a high frequency control loop ISR (e.g. FOC), and can be placed in IRAM by
+ *       enabling `CONFIG_MCPWM_CTRL_FUNC_IN_IRAM`.
+ *
+ * @param[in] cmprs Array of MCPWM comparator handles, allocated by `mcpwm_new_comparator()`
+ * @param[in] cmp_ticks Array of new compare values, one per comparator
+ * @param[in] num_cmprs Number of comparators in the batch
+ * @return
+ *      - ESP_OK: Set MCPWM compare values successfully
+ *      - ESP_ERR_INVALID_ARG: Set MCPWM compare values failed because of invalid argument (e.g. a compare value is out of range)
+ *      - ESP_ERR_INVALID_STATE: Set MCPWM compare values failed because an operator doesn't have a timer connected
+ *      - ESP_FAIL: Set MCPWM compare values failed because of other error
+ */
+esp_err_t mcpwm_comparator_set_compare_values(mcpwm_cmpr_handle_t *cmprs, const uint32_t *cmp_ticks, size_t num_cmprs);
+
 #ifdef __cplusplus
 }
 #endif
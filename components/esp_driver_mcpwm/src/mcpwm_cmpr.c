@@ -228,6 +228,40 @@ esp_err_t mcpwm_comparator_set_compare_value(mcpwm_cmpr_handle_t cmpr, uint32_t
     return ESP_OK;
 }
 
+esp_err_t mcpwm_comparator_set_compare_values(mcpwm_cmpr_handle_t *cmprs, const uint32_t *cmp_ticks, size_t num_cmprs)
+{
+    ESP_RETURN_ON_FALSE_ISR(cmprs && cmp_ticks && num_cmprs, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    mcpwm_group_t *group = cmprs[0]->oper->group;
+    for (size_t i = 0; i < num_cmprs; i++) {
+        mcpwm_cmpr_t *cmpr = cmprs[i];
+        ESP_RETURN_ON_FALSE_ISR(cmpr, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+        // only operator comparators own a shadow register whose transfer can be frozen
+        ESP_RETURN_ON_FALSE_ISR(cmpr->type == MCPWM_OPERATOR_COMPARATOR, ESP_ERR_INVALID_ARG, TAG, "only operator comparator supports batch commit");
+        ESP_RETURN_ON_FALSE_ISR(cmpr->oper->group == group, ESP_ERR_INVALID_ARG, TAG, "comparators not in the same group");
+        mcpwm_timer_t *timer = cmpr->oper->timer;
+        ESP_RETURN_ON_FALSE_ISR(timer, ESP_ERR_INVALID_STATE, TAG, "timer and operator are not connected");
+        ESP_RETURN_ON_FALSE_ISR(cmp_ticks[i] <= timer->peak_ticks, ESP_ERR_INVALID_ARG, TAG, "compare value out of range");
+    }
+
+    portENTER_CRITICAL_SAFE(&group->spinlock);
+    // Freeze the shadow-to-active transfer first, so that an update event occurring in the
+    // middle of the batch can never latch a partial set of compare values
+    for (size_t i = 0; i < num_cmprs; i++) {
+        mcpwm_ll_operator_stop_update_compare(group->hal.dev, cmprs[i]->oper->oper_id, cmprs[i]->cmpr_id, true);
+    }
+    for (size_t i = 0; i < num_cmprs; i++) {
+        mcpwm_ll_operator_set_compare_value(group->hal.dev, cmprs[i]->oper->oper_id, cmprs[i]->cmpr_id, cmp_ticks[i]);
+        cmprs[i]->compare_ticks = cmp_ticks[i];
+    }
+    // Unfreeze, the whole set takes effect together on the next update event
+    for (size_t i = 0; i < num_cmprs; i++) {
+        mcpwm_ll_operator_stop_update_compare(group->hal.dev, cmprs[i]->oper->oper_id, cmprs[i]->cmpr_id, false);
+    }
+    portEXIT_CRITICAL_SAFE(&group->spinlock);
+
+    return ESP_OK;
+}
+
 esp_err_t mcpwm_comparator_register_event_callbacks(mcpwm_cmpr_handle_t cmpr, const mcpwm_comparator_event_callbacks_t *cbs, void *user_data)
 {
     ESP_RETURN_ON_FALSE(cmpr && cbs, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/parlio_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief GPIO pattern streaming engine built on the Parallel IO TX unit
+ *
+ * The engine compiles multi-pin toggle sequences into bit-packed sample
+ * buffers and streams them out of memory through the PARLIO DMA path, so
+ * waveforms on up to PARLIO_TX_UNIT_MAX_DATA_WIDTH pins run at MHz sample
+ * rates without any CPU involvement. Compiled patterns can be chained and
+ * looped; the chain is refilled from the trans-done interrupt, one queue
+ * slot per completed pattern, so the DMA pipeline stays full.
+ */
+
+typedef struct parlio_pattern_engine_t *parlio_pattern_engine_handle_t;
+typedef struct parlio_pattern_t *parlio_pattern_handle_t;
+
+/**
+ * @brief Pattern engine configuration
+ */
+typedef struct {
+    uint32_t sample_rate_hz;    /*!< Output sample rate; each pattern step duration is a multiple of one sample period */
+    size_t data_width;          /*!< Number of output pins, must be a power of two not larger than PARLIO_TX_UNIT_MAX_DATA_WIDTH */
+    gpio_num_t data_gpio_nums[PARLIO_TX_UNIT_MAX_DATA_WIDTH]; /*!< Output GPIO numbers, data_width entries are used */
+    size_t max_pattern_samples; /*!< Longest compiled pattern in samples, decides the DMA sizing; 0 defaults to 4096 */
+    size_t trans_queue_depth;   /*!< Number of patterns that can be pending in the DMA queue; 0 defaults to 8 */
+} parlio_pattern_engine_config_t;
+
+/**
+ * @brief One step of a toggle sequence before compilation
+ */
+typedef struct {
+    uint32_t levels;    /*!< Output levels during this step, bit i drives data_gpio_nums[i] */
+    uint32_t duration;  /*!< Step duration in sample periods, must be at least 1 */
+} parlio_pattern_step_t;
+
+/**
+ * @brief One entry of a pattern chain
+ */
+typedef struct {
+    parlio_pattern_handle_t pattern;    /*!< Compiled pattern to play */
+    uint32_t iterations;                /*!< How often to repeat this pattern before advancing, must be at least 1 */
+} parlio_pattern_chain_step_t;
+
+/**
+ * @brief Create a pattern streaming engine
+ *
+ * Allocates a PARLIO TX unit clocked at the requested sample rate. The pins
+ * idle at the last transmitted level between and after patterns.
+ *
+ * @param[in] config Engine configuration
+ * @param[out] ret_engine Returned engine handle
+ * @return
+ *      - ESP_OK: Create pattern engine successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid configuration
+ *      - ESP_ERR_NO_MEM: Out of memory
+ *      - ESP_ERR_NOT_FOUND: No free PARLIO TX unit
+ */
+esp_err_t parlio_new_pattern_engine(const parlio_pattern_engine_config_t *config, parlio_pattern_engine_handle_t *ret_engine);
+
+/**
+ * @brief Delete a pattern engine
+ *
+ * All patterns compiled on the engine must be deleted first.
+ *
+ * @param[in] engine Engine handle created by `parlio_new_pattern_engine`
+ * @return
+ *      - ESP_OK: Delete pattern engine successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_INVALID_STATE: Engine is still running or patterns still exist
+ */
+esp_err_t parlio_del_pattern_engine(parlio_pattern_engine_handle_t engine);
+
+/**
+ * @brief Compile a toggle sequence into a DMA-ready pattern
+ *
+ * Expands the steps into a bit-packed sample buffer in DMA-capable memory.
+ * The total sample count is padded up to the next multiple of 64 bits of
+ * payload by extending the final level, so very short patterns come out
+ * slightly longer than specified.
+ *
+ * @param[in] engine Engine the pattern will be played on
+ * @param[in] steps Toggle sequence
+ * @param[in] num_steps Number of steps
+ * @param[out] ret_pattern Returned compiled pattern handle
+ * @return
+ *      - ESP_OK: Compile pattern successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid steps (zero duration, level beyond data width)
+ *      - ESP_ERR_INVALID_SIZE: Total sample count exceeds max_pattern_samples
+ *      - ESP_ERR_NO_MEM: Out of DMA-capable memory
+ */
+esp_err_t parlio_pattern_compile(parlio_pattern_engine_handle_t engine, const parlio_pattern_step_t *steps,
+                                 size_t num_steps, parlio_pattern_handle_t *ret_pattern);
+
+/**
+ * @brief Delete a compiled pattern
+ *
+ * Must not be called while the pattern is part of a running chain.
+ *
+ * @param[in] pattern Pattern handle created by `parlio_pattern_compile`
+ * @return
+ *      - ESP_OK: Delete pattern successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ */
+esp_err_t parlio_pattern_delete(parlio_pattern_handle_t pattern);
+
+/**
+ * @brief Start playing a chain of compiled patterns
+ *
+ * The chain entries are played in order, each repeated `iterations` times;
+ * the whole chain is repeated `loop_count` times, or indefinitely when
+ * `loop_count` is 0. The chain array is copied, but the referenced patterns
+ * must stay valid until the engine is stopped or done.
+ *
+ * @param[in] engine Engine handle
+ * @param[in] chain Chain entries
+ * @param[in] chain_len Number of chain entries
+ * @param[in] loop_count Number of chain repetitions, 0 to loop forever
+ * @return
+ *      - ESP_OK: Start pattern chain successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_INVALID_STATE: Engine is already running
+ *      - ESP_ERR_NO_MEM: Out of memory for the chain copy
+ */
+esp_err_t parlio_pattern_engine_start(parlio_pattern_engine_handle_t engine, const parlio_pattern_chain_step_t *chain,
+                                      size_t chain_len, uint32_t loop_count);
+
+/**
+ * @brief Stop the engine at the next pattern boundary
+ *
+ * Stops refilling the DMA queue, waits for the already-queued patterns to
+ * finish and disables the TX unit. The pins hold the last transmitted level.
+ *
+ * @param[in] engine Engine handle
+ * @return
+ *      - ESP_OK: Stop engine successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ */
+esp_err_t parlio_pattern_engine_stop(parlio_pattern_engine_handle_t engine);
+
+/**
+ * @brief Wait until a finite chain has finished playing
+ *
+ * @param[in] engine Engine handle
+ * @param[in] timeout_ms Timeout in milliseconds, -1 to wait forever
+ * @return
+ *      - ESP_OK: Chain finished
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_TIMEOUT: Chain still running after the timeout
+ */
+esp_err_t parlio_pattern_engine_wait_done(parlio_pattern_engine_handle_t engine, int timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif
@@ -331,6 +331,90 @@ typedef struct {
  */
 esp_err_t parlio_rx_unit_register_event_callbacks(parlio_rx_unit_handle_t rx_unit, const parlio_rx_event_callbacks_t *cbs, void *user_data);
 
+/**
+ * @brief Configuration of the continuous ring capture
+ */
+typedef struct {
+    parlio_rx_delimiter_handle_t delimiter;         /*!< The delimiter of the ring capture */
+    void                        *buffer;            /*!< The application-owned ring buffer that the DMA writes directly.
+                                                         It can locate in the external RAM if the DMA of the target is able to access it.
+                                                         Both the buffer address and the slice size have to align with the cache line size
+                                                         when the buffer is cached (e.g., allocated in the external RAM) */
+    size_t                      buffer_size;        /*!< The total size of the ring buffer, in bytes, should be the multiple of `slice_size` */
+    size_t                      slice_size;         /*!< The bytes one DMA descriptor carries, which is also the granularity that
+                                                         the write index advances and the `on_partial_receive` callback is invoked */
+} parlio_rx_ring_capture_config_t;
+
+/**
+ * @brief Status of the continuous ring capture
+ */
+typedef struct {
+    size_t                      head;               /*!< Index of the slice that the DMA will write next */
+    size_t                      tail;               /*!< Index of the oldest valid slice that has not been consumed */
+    size_t                      filled_slices;      /*!< Number of the valid slices that are pending to be consumed */
+    uint32_t                    dropped_slices;     /*!< Number of the slices that were overwritten before being consumed */
+} parlio_rx_ring_capture_status_t;
+
+/**
+ * @brief Start the continuous capture into an application-owned ring buffer
+ * @note  Different from the infinite transaction of `parlio_rx_unit_receive`, the ring capture mounts the
+ *        user buffer to a circular DMA descriptor chain directly, no data is copied in the interrupt,
+ *        so it can sustain high sample rates, especially when the ring locates in the external RAM.
+ * @note  The driver only moves the read/write indices and counts the overwritten slices, the data in the ring
+ *        is consumed by polling `parlio_rx_unit_ring_capture_get_status` (or via the `on_partial_receive` callback)
+ *        and acknowledged by `parlio_rx_unit_ring_capture_consume`. When the consumer lags behind,
+ *        the DMA keeps running and the oldest slices are overwritten and counted as dropped.
+ * @note  The rx unit has to be enabled and idle (no other transaction on going) before starting the ring capture
+ *
+ * @param[in]  rx_unit       Parallel IO RX unit handle that created by `parlio_new_rx_unit`
+ * @param[in]  config        The configuration of the ring capture
+ * @return
+ *      - ESP_ERR_INVALID_ARG       Invalid arguments in the parameter list or the ring capture configuration
+ *      - ESP_ERR_NOT_SUPPORTED     The ring buffer locates in the external RAM but the DMA can't access it on this target
+ *      - ESP_ERR_INVALID_STATE     The rx unit is not enabled, or is busy with other transactions
+ *      - ESP_ERR_NO_MEM            No memory for the DMA descriptor chain
+ *      - ESP_OK                    Success to start the ring capture
+ */
+esp_err_t parlio_rx_unit_ring_capture_start(parlio_rx_unit_handle_t rx_unit, const parlio_rx_ring_capture_config_t *config);
+
+/**
+ * @brief Stop the continuous ring capture
+ * @note  The DMA and the RX engine stop immediately, the data that already received in the ring is still
+ *        readable until the next `parlio_rx_unit_ring_capture_start`
+ *
+ * @param[in]  rx_unit       Parallel IO RX unit handle that created by `parlio_new_rx_unit`
+ * @return
+ *      - ESP_ERR_INVALID_ARG       The input rx_unit is NULL
+ *      - ESP_ERR_INVALID_STATE     The ring capture has not started
+ *      - ESP_OK                    Success to stop the ring capture
+ */
+esp_err_t parlio_rx_unit_ring_capture_stop(parlio_rx_unit_handle_t rx_unit);
+
+/**
+ * @brief Get the current status of the ring capture
+ * @note  This function is allowed to be called in the ISR context
+ *
+ * @param[in]  rx_unit       Parallel IO RX unit handle that created by `parlio_new_rx_unit`
+ * @param[out] status        The snapshot of the ring indices and the drop counter
+ * @return
+ *      - ESP_ERR_INVALID_ARG       The input rx_unit or status is NULL
+ *      - ESP_OK                    Success to get the ring capture status
+ */
+esp_err_t parlio_rx_unit_ring_capture_get_status(parlio_rx_unit_handle_t rx_unit, parlio_rx_ring_capture_status_t *status);
+
+/**
+ * @brief Consume the received slices, i.e., advance the read index of the ring
+ * @note  This function is allowed to be called in the ISR context
+ *
+ * @param[in]  rx_unit       Parallel IO RX unit handle that created by `parlio_new_rx_unit`
+ * @param[in]  num_slices    The number of the slices that the consumer has finished processing
+ * @param[out] consumed_slices The number of the slices that are actually consumed, can be NULL if not needed
+ * @return
+ *      - ESP_ERR_INVALID_ARG       The input rx_unit is NULL
+ *      - ESP_OK                    Success to consume the slices
+ */
+esp_err_t parlio_rx_unit_ring_capture_consume(parlio_rx_unit_handle_t rx_unit, size_t num_slices, size_t *consumed_slices);
+
 #ifdef __cplusplus
 }
 #endif
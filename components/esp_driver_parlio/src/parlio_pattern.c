@@ -0,0 +1,383 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+#if CONFIG_PARLIO_ENABLE_DEBUG_LOG
+// The local log level must be defined before including esp_log.h
+// Set the maximum log level for this source file
+#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#endif
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "driver/parlio_tx.h"
+#include "driver/parlio_pattern.h"
+
+static const char *TAG = "parlio-pattern";
+
+#define PATTERN_DEFAULT_MAX_SAMPLES   4096
+#define PATTERN_DEFAULT_QUEUE_DEPTH   8
+// Compiled payloads are padded to this many bits so any DMA/bus width
+// alignment requirement of the TX path is met
+#define PATTERN_PAYLOAD_ALIGN_BITS    64
+
+// Refill task: woken once per completed pattern, submits the next one.
+// Runs near the top priority so a queue of several patterns is never drained
+// faster than it is refilled.
+#define PATTERN_TASK_STACK_SIZE       2560
+#define PATTERN_TASK_PRIORITY         (configMAX_PRIORITIES - 2)
+
+struct parlio_pattern_t {
+    parlio_pattern_engine_handle_t engine;  // engine the pattern was compiled for
+    uint8_t *buf;                           // bit-packed samples in DMA-capable memory
+    size_t payload_bits;                    // length of buf in bits
+    uint32_t idle_value;                    // level of the final sample, held after the pattern
+};
+
+struct parlio_pattern_engine_t {
+    parlio_tx_unit_handle_t tx_unit;
+    size_t data_width;
+    size_t max_samples;
+    size_t queue_depth;
+    size_t pattern_count;           // live patterns compiled on this engine
+    TaskHandle_t refill_task;
+    SemaphoreHandle_t done_sem;     // given when a finite chain has fully played out
+    portMUX_TYPE lock;              // protects the chain iterator state below
+    parlio_pattern_chain_step_t *chain;
+    size_t chain_len;
+    size_t chain_pos;
+    uint32_t iter_left;             // iterations left of the current chain entry
+    uint32_t loops_left;            // chain repetitions left, unused when infinite
+    bool infinite;
+    volatile bool running;          // chain iterator has more patterns to hand out
+    volatile bool enabled;          // TX unit is enabled
+    size_t inflight;                // patterns queued or transmitting
+};
+
+/* Hand out the next pattern of the chain and advance the iterator.
+   Called with the engine lock held. Returns NULL when the chain is done. */
+static struct parlio_pattern_t *pattern_chain_next(struct parlio_pattern_engine_t *engine)
+{
+    if (!engine->running || engine->chain_pos >= engine->chain_len) {
+        return NULL;
+    }
+    struct parlio_pattern_t *pattern = engine->chain[engine->chain_pos].pattern;
+    if (--engine->iter_left == 0) {
+        engine->chain_pos++;
+        if (engine->chain_pos >= engine->chain_len) {
+            if (engine->infinite || --engine->loops_left > 0) {
+                engine->chain_pos = 0;
+                engine->iter_left = engine->chain[0].iterations;
+            }
+            // otherwise leave chain_pos at chain_len: iterator exhausted
+        } else {
+            engine->iter_left = engine->chain[engine->chain_pos].iterations;
+        }
+    }
+    return pattern;
+}
+
+/* Pull the next pattern from the chain and queue it on the TX unit.
+   Returns false when the chain is exhausted. */
+static bool pattern_submit_next(struct parlio_pattern_engine_t *engine)
+{
+    portENTER_CRITICAL(&engine->lock);
+    struct parlio_pattern_t *pattern = pattern_chain_next(engine);
+    if (pattern) {
+        engine->inflight++;
+    }
+    portEXIT_CRITICAL(&engine->lock);
+    if (!pattern) {
+        return false;
+    }
+
+    parlio_transmit_config_t transmit_config = {
+        .idle_value = pattern->idle_value,
+        // one queue slot is known to be free per refill wakeup, and the
+        // refill task must never block on the queue
+        .flags.queue_nonblocking = true,
+    };
+    esp_err_t err = parlio_tx_unit_transmit(engine->tx_unit, pattern->buf, pattern->payload_bits, &transmit_config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "pattern submit failed (%d), chain stops early", err);
+        portENTER_CRITICAL(&engine->lock);
+        engine->inflight--;
+        engine->running = false;
+        portEXIT_CRITICAL(&engine->lock);
+        return false;
+    }
+    return true;
+}
+
+static bool pattern_engine_on_trans_done(parlio_tx_unit_handle_t tx_unit, const parlio_tx_done_event_data_t *edata, void *user_ctx)
+{
+    struct parlio_pattern_engine_t *engine = user_ctx;
+    BaseType_t high_task_woken = pdFALSE;
+
+    portENTER_CRITICAL_ISR(&engine->lock);
+    engine->inflight--;
+    bool more = engine->running && engine->chain_pos < engine->chain_len;
+    bool finished = engine->running && !more && engine->inflight == 0;
+    if (finished) {
+        engine->running = false;
+    }
+    portEXIT_CRITICAL_ISR(&engine->lock);
+
+    if (more) {
+        // wake the refill task, one wakeup per freed queue slot
+        vTaskNotifyGiveFromISR(engine->refill_task, &high_task_woken);
+    } else if (finished) {
+        xSemaphoreGiveFromISR(engine->done_sem, &high_task_woken);
+    }
+    return high_task_woken == pdTRUE;
+}
+
+static void pattern_refill_task(void *arg)
+{
+    struct parlio_pattern_engine_t *engine = arg;
+    for (;;) {
+        uint32_t wakeups = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (wakeups--) {
+            if (!pattern_submit_next(engine)) {
+                break;
+            }
+        }
+    }
+}
+
+esp_err_t parlio_new_pattern_engine(const parlio_pattern_engine_config_t *config, parlio_pattern_engine_handle_t *ret_engine)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(config && ret_engine, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(config->sample_rate_hz, ESP_ERR_INVALID_ARG, TAG, "invalid sample rate");
+    ESP_RETURN_ON_FALSE(config->data_width && config->data_width <= PARLIO_TX_UNIT_MAX_DATA_WIDTH &&
+                        (config->data_width & (config->data_width - 1)) == 0,
+                        ESP_ERR_INVALID_ARG, TAG, "invalid data width");
+
+    struct parlio_pattern_engine_t *engine = heap_caps_calloc(1, sizeof(struct parlio_pattern_engine_t),
+                                                              MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_RETURN_ON_FALSE(engine, ESP_ERR_NO_MEM, TAG, "no mem for engine");
+    engine->data_width = config->data_width;
+    engine->max_samples = config->max_pattern_samples ? config->max_pattern_samples : PATTERN_DEFAULT_MAX_SAMPLES;
+    engine->queue_depth = config->trans_queue_depth ? config->trans_queue_depth : PATTERN_DEFAULT_QUEUE_DEPTH;
+    portMUX_INITIALIZE(&engine->lock);
+
+    engine->done_sem = xSemaphoreCreateBinary();
+    ESP_GOTO_ON_FALSE(engine->done_sem, ESP_ERR_NO_MEM, err, TAG, "no mem for semaphore");
+
+    parlio_tx_unit_config_t tx_config = {
+        .clk_src = PARLIO_CLK_SRC_DEFAULT,
+        .clk_in_gpio_num = -1,
+        .output_clk_freq_hz = config->sample_rate_hz,
+        .data_width = config->data_width,
+        .clk_out_gpio_num = -1,
+        .valid_gpio_num = -1,
+        .trans_queue_depth = engine->queue_depth,
+        .max_transfer_size = (engine->max_samples * config->data_width + 7) / 8,
+        .dma_burst_size = 64,
+        .sample_edge = PARLIO_SAMPLE_EDGE_POS,
+        .bit_pack_order = PARLIO_BIT_PACK_ORDER_LSB,
+    };
+    memcpy(tx_config.data_gpio_nums, config->data_gpio_nums, sizeof(tx_config.data_gpio_nums));
+    ESP_GOTO_ON_ERROR(parlio_new_tx_unit(&tx_config, &engine->tx_unit), err, TAG, "create TX unit failed");
+
+    parlio_tx_event_callbacks_t cbs = {
+        .on_trans_done = pattern_engine_on_trans_done,
+    };
+    ESP_GOTO_ON_ERROR(parlio_tx_unit_register_event_callbacks(engine->tx_unit, &cbs, engine), err, TAG,
+                      "register callbacks failed");
+
+    ESP_GOTO_ON_FALSE(xTaskCreate(pattern_refill_task, "parlio_pat", PATTERN_TASK_STACK_SIZE, engine,
+                                  PATTERN_TASK_PRIORITY, &engine->refill_task) == pdPASS,
+                      ESP_ERR_NO_MEM, err, TAG, "create refill task failed");
+
+    *ret_engine = engine;
+    return ESP_OK;
+
+err:
+    if (engine->tx_unit) {
+        parlio_del_tx_unit(engine->tx_unit);
+    }
+    if (engine->done_sem) {
+        vSemaphoreDelete(engine->done_sem);
+    }
+    free(engine);
+    return ret;
+}
+
+esp_err_t parlio_del_pattern_engine(parlio_pattern_engine_handle_t engine)
+{
+    ESP_RETURN_ON_FALSE(engine, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(!engine->running && !engine->enabled, ESP_ERR_INVALID_STATE, TAG, "engine still running");
+    ESP_RETURN_ON_FALSE(engine->pattern_count == 0, ESP_ERR_INVALID_STATE, TAG, "patterns still exist");
+
+    // with the unit disabled no trans-done callbacks fire, so the refill
+    // task sits blocked on its notification and can be deleted safely
+    vTaskDelete(engine->refill_task);
+
+    ESP_RETURN_ON_ERROR(parlio_del_tx_unit(engine->tx_unit), TAG, "delete TX unit failed");
+    vSemaphoreDelete(engine->done_sem);
+    free(engine->chain);
+    free(engine);
+    return ESP_OK;
+}
+
+esp_err_t parlio_pattern_compile(parlio_pattern_engine_handle_t engine, const parlio_pattern_step_t *steps,
+                                 size_t num_steps, parlio_pattern_handle_t *ret_pattern)
+{
+    ESP_RETURN_ON_FALSE(engine && steps && num_steps && ret_pattern, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    size_t width = engine->data_width;
+    uint32_t level_mask = (width < 32) ? ((1UL << width) - 1) : UINT32_MAX;
+    size_t total_samples = 0;
+    for (size_t i = 0; i < num_steps; i++) {
+        ESP_RETURN_ON_FALSE(steps[i].duration, ESP_ERR_INVALID_ARG, TAG, "step %d has zero duration", (int)i);
+        ESP_RETURN_ON_FALSE((steps[i].levels & ~level_mask) == 0, ESP_ERR_INVALID_ARG,
+                            TAG, "step %d level beyond data width", (int)i);
+        total_samples += steps[i].duration;
+    }
+    // pad with the final level so the payload meets the TX alignment rules
+    size_t align_samples = PATTERN_PAYLOAD_ALIGN_BITS / width;
+    size_t padded_samples = (total_samples + align_samples - 1) / align_samples * align_samples;
+    ESP_RETURN_ON_FALSE(padded_samples <= engine->max_samples, ESP_ERR_INVALID_SIZE, TAG,
+                        "pattern longer than max_pattern_samples");
+
+    struct parlio_pattern_t *pattern = heap_caps_calloc(1, sizeof(struct parlio_pattern_t),
+                                                        MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_RETURN_ON_FALSE(pattern, ESP_ERR_NO_MEM, TAG, "no mem for pattern");
+    size_t buf_size = padded_samples * width / 8;
+    pattern->buf = heap_caps_aligned_calloc(64, 1, buf_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+    if (!pattern->buf) {
+        free(pattern);
+        ESP_LOGE(TAG, "no mem for sample buffer");
+        return ESP_ERR_NO_MEM;
+    }
+
+    // expand the steps into bit-packed samples, LSB-first within each byte
+    size_t sample = 0;
+    uint32_t last_levels = 0;
+    for (size_t i = 0; i < num_steps; i++) {
+        for (uint32_t d = 0; d < steps[i].duration; d++, sample++) {
+            size_t bit_base = sample * width;
+            for (size_t b = 0; b < width; b++) {
+                if (steps[i].levels & (1UL << b)) {
+                    pattern->buf[(bit_base + b) / 8] |= 1 << ((bit_base + b) % 8);
+                }
+            }
+        }
+        last_levels = steps[i].levels;
+    }
+    for (; sample < padded_samples; sample++) {
+        size_t bit_base = sample * width;
+        for (size_t b = 0; b < width; b++) {
+            if (last_levels & (1UL << b)) {
+                pattern->buf[(bit_base + b) / 8] |= 1 << ((bit_base + b) % 8);
+            }
+        }
+    }
+
+    pattern->engine = engine;
+    pattern->payload_bits = padded_samples * width;
+    pattern->idle_value = last_levels;
+
+    portENTER_CRITICAL(&engine->lock);
+    engine->pattern_count++;
+    portEXIT_CRITICAL(&engine->lock);
+    *ret_pattern = pattern;
+    return ESP_OK;
+}
+
+esp_err_t parlio_pattern_delete(parlio_pattern_handle_t pattern)
+{
+    ESP_RETURN_ON_FALSE(pattern, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    struct parlio_pattern_engine_t *engine = pattern->engine;
+    portENTER_CRITICAL(&engine->lock);
+    engine->pattern_count--;
+    portEXIT_CRITICAL(&engine->lock);
+    free(pattern->buf);
+    free(pattern);
+    return ESP_OK;
+}
+
+esp_err_t parlio_pattern_engine_start(parlio_pattern_engine_handle_t engine, const parlio_pattern_chain_step_t *chain,
+                                      size_t chain_len, uint32_t loop_count)
+{
+    ESP_RETURN_ON_FALSE(engine && chain && chain_len, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(!engine->running, ESP_ERR_INVALID_STATE, TAG, "engine already running");
+    for (size_t i = 0; i < chain_len; i++) {
+        ESP_RETURN_ON_FALSE(chain[i].pattern && chain[i].pattern->engine == engine && chain[i].iterations,
+                            ESP_ERR_INVALID_ARG, TAG, "invalid chain entry %d", (int)i);
+    }
+
+    parlio_pattern_chain_step_t *chain_copy = heap_caps_malloc(chain_len * sizeof(parlio_pattern_chain_step_t),
+                                                               MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_RETURN_ON_FALSE(chain_copy, ESP_ERR_NO_MEM, TAG, "no mem for chain");
+    memcpy(chain_copy, chain, chain_len * sizeof(parlio_pattern_chain_step_t));
+
+    // start from a disabled unit so the prefill below is the only submitter;
+    // after a finished chain the unit is still enabled but idle
+    if (engine->enabled) {
+        ESP_RETURN_ON_ERROR(parlio_tx_unit_disable(engine->tx_unit), TAG, "disable TX unit failed");
+        engine->enabled = false;
+    }
+
+    free(engine->chain);
+    engine->chain = chain_copy;
+    engine->chain_len = chain_len;
+    engine->chain_pos = 0;
+    engine->iter_left = chain_copy[0].iterations;
+    engine->loops_left = loop_count;
+    engine->infinite = (loop_count == 0);
+    engine->inflight = 0;
+    engine->running = true;
+    xSemaphoreTake(engine->done_sem, 0);    // clear a stale completion
+
+    // fill the transaction queue while the unit is disabled, the refill task
+    // takes over once transmissions complete
+    for (size_t i = 0; i < engine->queue_depth; i++) {
+        if (!pattern_submit_next(engine)) {
+            break;
+        }
+    }
+
+    esp_err_t err = parlio_tx_unit_enable(engine->tx_unit);
+    if (err != ESP_OK) {
+        engine->running = false;
+        return err;
+    }
+    engine->enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t parlio_pattern_engine_stop(parlio_pattern_engine_handle_t engine)
+{
+    ESP_RETURN_ON_FALSE(engine, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    if (!engine->enabled) {
+        return ESP_OK;
+    }
+    portENTER_CRITICAL(&engine->lock);
+    engine->running = false;    // stop handing out patterns
+    portEXIT_CRITICAL(&engine->lock);
+    ESP_RETURN_ON_ERROR(parlio_tx_unit_wait_all_done(engine->tx_unit, -1), TAG, "wait for queued patterns failed");
+    ESP_RETURN_ON_ERROR(parlio_tx_unit_disable(engine->tx_unit), TAG, "disable TX unit failed");
+    engine->enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t parlio_pattern_engine_wait_done(parlio_pattern_engine_handle_t engine, int timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(engine, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    if (!engine->running) {
+        return ESP_OK;
+    }
+    TickType_t ticks = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    ESP_RETURN_ON_FALSE(xSemaphoreTake(engine->done_sem, ticks) == pdTRUE, ESP_ERR_TIMEOUT, TAG, "chain still running");
+    return ESP_OK;
+}
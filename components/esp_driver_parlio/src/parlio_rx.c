@@ -39,6 +39,14 @@
 
 static const char *TAG = "parlio-rx";
 
+/* Whether the DMA that serves parlio RX is able to write the external RAM */
+#if (defined(SOC_GDMA_BUS_AXI) && (SOC_GDMA_TRIG_PERIPH_PARLIO0_BUS == SOC_GDMA_BUS_AXI) && SOC_AXI_GDMA_SUPPORT_PSRAM) || \
+    (defined(SOC_GDMA_BUS_AHB) && (SOC_GDMA_TRIG_PERIPH_PARLIO0_BUS == SOC_GDMA_BUS_AHB) && SOC_AHB_GDMA_SUPPORT_PSRAM)
+#define PARLIO_RX_DMA_SUPPORT_PSRAM     1
+#else
+#define PARLIO_RX_DMA_SUPPORT_PSRAM     0
+#endif
+
 /**
  * @brief Parlio RX transaction
  */
@@ -89,6 +97,19 @@ typedef struct parlio_rx_unit_t {
     void                            *usr_recv_buf;          /*!< The pointe to the user's receiving buffer */
     /* Infinite transaction specific */
     void                            *dma_buf;               /*!< Additional internal DMA buffer only for infinite transactions */
+    /* Ring capture specific */
+    struct {
+        parlio_dma_desc_t           **descs;                /*!< Dedicated DMA descriptor chain, one descriptor per ring slice */
+        uint8_t                     *buffer;                /*!< Application-owned ring buffer base address */
+        size_t                      slice_size;             /*!< Bytes per slice, i.e. per DMA descriptor */
+        size_t                      num_slices;             /*!< Number of slices in the ring */
+        volatile size_t             head;                   /*!< Index of the slice that the DMA writes next, updated in ISR */
+        volatile size_t             tail;                   /*!< Index of the oldest valid slice, advanced by the consumer */
+        volatile size_t             filled;                 /*!< Number of valid slices between tail and head */
+        volatile uint32_t           dropped;                /*!< Count of the slices that were overwritten before being consumed */
+        bool                        cache_sync;             /*!< Whether the finished slices need to be invalidated from the cache */
+        volatile bool               active;                 /*!< Whether the ring capture is running */
+    } ring;
 
     /* Callback */
     parlio_rx_event_callbacks_t     cbs;                    /*!< The group of callback function pointers */
@@ -385,6 +406,38 @@ static IRAM_ATTR bool s_parlio_rx_default_eof_callback(gdma_channel_handle_t dma
     return need_yield;
 }
 
+static IRAM_ATTR bool s_parlio_rx_ring_desc_done(parlio_rx_unit_handle_t rx_unit)
+{
+    bool need_yield = false;
+    size_t slice = rx_unit->ring.head;
+    uint8_t *slice_buf = rx_unit->ring.buffer + slice * rx_unit->ring.slice_size;
+
+    /* The DMA has written the slice behind the cache, invalidate it so the consumer reads the fresh data */
+    if (rx_unit->ring.cache_sync) {
+        esp_cache_msync(slice_buf, rx_unit->ring.slice_size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+    }
+    portENTER_CRITICAL_ISR(&s_rx_spinlock);
+    rx_unit->ring.head = (slice + 1) % rx_unit->ring.num_slices;
+    if (rx_unit->ring.filled < rx_unit->ring.num_slices) {
+        rx_unit->ring.filled++;
+    } else {
+        /* The consumer lags behind, the oldest slice has been overwritten, count it as dropped */
+        rx_unit->ring.dropped++;
+        rx_unit->ring.tail = (rx_unit->ring.tail + 1) % rx_unit->ring.num_slices;
+    }
+    portEXIT_CRITICAL_ISR(&s_rx_spinlock);
+
+    if (rx_unit->cbs.on_partial_receive) {
+        parlio_rx_event_data_t evt_data = {
+            .delimiter = rx_unit->curr_trans.delimiter,
+            .data = slice_buf,
+            .recv_bytes = rx_unit->ring.slice_size,
+        };
+        need_yield |= rx_unit->cbs.on_partial_receive(rx_unit, &evt_data, rx_unit->user_data);
+    }
+    return need_yield;
+}
+
 static IRAM_ATTR bool s_parlio_rx_default_desc_done_callback(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data)
 {
     parlio_rx_unit_handle_t rx_unit = (parlio_rx_unit_handle_t)user_data;
@@ -393,6 +446,10 @@ static IRAM_ATTR bool s_parlio_rx_default_desc_done_callback(gdma_channel_handle
     if (event_data->flags.abnormal_eof) {
         return false;
     }
+    /* The ring capture maintains its own descriptor chain and read/write indices */
+    if (rx_unit->ring.active) {
+        return s_parlio_rx_ring_desc_done(rx_unit);
+    }
 
     /* Get the finished descriptor from the current descriptor */
     parlio_dma_desc_t *finished_desc = rx_unit->curr_desc;
@@ -487,6 +544,14 @@ static esp_err_t s_parlio_rx_unit_init_dma(parlio_rx_unit_handle_t rx_unit)
     };
     gdma_apply_strategy(rx_unit->dma_chan, &gdma_strategy_conf);
 
+    /* Configure the DMA transfer parameters, allow to access the external memory
+     * so that the ring capture can write the PSRAM directly */
+    gdma_transfer_config_t trans_cfg = {
+        .max_data_burst_size = 16,
+        .access_ext_mem = true,
+    };
+    ESP_RETURN_ON_ERROR(gdma_config_transfer(rx_unit->dma_chan, &trans_cfg), TAG, "config DMA transfer failed");
+
     /* Register callbacks */
     gdma_rx_event_callbacks_t cbs = {
         .on_recv_eof = s_parlio_rx_default_eof_callback,
@@ -764,6 +829,24 @@ err:
     return ret;
 }
 
+static void s_parlio_rx_ring_release(parlio_rx_unit_handle_t rx_unit)
+{
+    rx_unit->ring.active = false;
+    if (rx_unit->ring.descs) {
+        for (size_t i = 0; i < rx_unit->ring.num_slices; i++) {
+            if (rx_unit->ring.descs[i]) {
+                free(rx_unit->ring.descs[i]);
+            }
+        }
+        free(rx_unit->ring.descs);
+        rx_unit->ring.descs = NULL;
+    }
+    rx_unit->ring.buffer = NULL;
+    rx_unit->ring.head = 0;
+    rx_unit->ring.tail = 0;
+    rx_unit->ring.filled = 0;
+}
+
 esp_err_t parlio_rx_unit_disable(parlio_rx_unit_handle_t rx_unit)
 {
     ESP_RETURN_ON_FALSE(rx_unit, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
@@ -792,6 +875,10 @@ esp_err_t parlio_rx_unit_disable(parlio_rx_unit_handle_t rx_unit)
         free(rx_unit->dma_buf);
         rx_unit->dma_buf = NULL;
     }
+    /* Stop the ring capture if it is still running */
+    if (rx_unit->ring.active) {
+        s_parlio_rx_ring_release(rx_unit);
+    }
     /* release power management lock */
     if (rx_unit->pm_lock) {
         esp_pm_lock_release(rx_unit->pm_lock);
@@ -1057,3 +1144,180 @@ err:
     xSemaphoreGive(rx_unit->mutex);
     return ret;
 }
+
+esp_err_t parlio_rx_unit_ring_capture_start(parlio_rx_unit_handle_t rx_unit, const parlio_rx_ring_capture_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(rx_unit && config, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(config->delimiter && config->buffer && config->slice_size && config->buffer_size,
+                        ESP_ERR_INVALID_ARG, TAG, "invalid ring capture configuration");
+    ESP_RETURN_ON_FALSE(config->slice_size <= PARLIO_MAX_ALIGNED_DMA_BUF_SIZE, ESP_ERR_INVALID_ARG,
+                        TAG, "slice size exceeds the max DMA buffer size %d", PARLIO_MAX_ALIGNED_DMA_BUF_SIZE);
+    ESP_RETURN_ON_FALSE(config->buffer_size % config->slice_size == 0, ESP_ERR_INVALID_ARG,
+                        TAG, "buffer size should be the multiple of slice size");
+    size_t num_slices = config->buffer_size / config->slice_size;
+    ESP_RETURN_ON_FALSE(num_slices >= 2, ESP_ERR_INVALID_ARG, TAG, "the ring should contain at least 2 slices");
+    bool in_ext_mem = esp_ptr_external_ram(config->buffer);
+#if !PARLIO_RX_DMA_SUPPORT_PSRAM
+    ESP_RETURN_ON_FALSE(!in_ext_mem, ESP_ERR_NOT_SUPPORTED, TAG, "the DMA of this target can't access the external RAM");
+#endif
+    /* The DMA writes the slices behind the cache, so both the base address and the slice size
+     * have to align with the cache line, otherwise the invalidation may corrupt the neighbour data */
+    uint32_t alignment = rx_unit->base.group->dma_align;
+    if (in_ext_mem) {
+        alignment = MAX(alignment, cache_hal_get_cache_line_size(CACHE_LL_LEVEL_EXT_MEM, CACHE_TYPE_DATA));
+    }
+    ESP_RETURN_ON_FALSE(((uintptr_t)config->buffer % alignment == 0) && (config->slice_size % alignment == 0),
+                        ESP_ERR_INVALID_ARG, TAG, "buffer address or slice size not aligned to %"PRIu32, alignment);
+    if (config->delimiter->mode != PARLIO_RX_SOFT_MODE) {
+        ESP_RETURN_ON_FALSE(rx_unit->cfg.valid_gpio_num >= 0, ESP_ERR_INVALID_ARG, TAG, "The validate gpio of this unit is not set");
+        ESP_RETURN_ON_FALSE(config->delimiter->valid_sig_line_id >= rx_unit->cfg.data_width,
+                            ESP_ERR_INVALID_ARG, TAG, "the valid_sig_line_id of this delimiter is conflict with rx unit data width");
+        config->delimiter->valid_sig = parlio_periph_signals.groups[rx_unit->base.group->group_id].
+                                       rx_units[rx_unit->base.unit_id].
+                                       data_sigs[config->delimiter->valid_sig_line_id];
+    }
+
+    esp_err_t ret = ESP_OK;
+    parlio_hal_context_t *hal = &rx_unit->base.group->hal;
+
+    xSemaphoreTake(rx_unit->mutex, portMAX_DELAY);
+    ESP_GOTO_ON_FALSE(rx_unit->is_enabled, ESP_ERR_INVALID_STATE, err, TAG, "the unit has not enabled");
+    ESP_GOTO_ON_FALSE(!rx_unit->ring.active, ESP_ERR_INVALID_STATE, err, TAG, "the ring capture has started");
+    portENTER_CRITICAL(&s_rx_spinlock);
+    bool is_idle = rx_unit->curr_trans.delimiter == NULL;
+    portEXIT_CRITICAL(&s_rx_spinlock);
+    ESP_GOTO_ON_FALSE(is_idle, ESP_ERR_INVALID_STATE, err, TAG, "the unit is on receiving");
+
+    /* Build a dedicated circular descriptor chain that covers the whole ring, one descriptor per slice */
+    rx_unit->ring.descs = heap_caps_calloc(num_slices, sizeof(parlio_dma_desc_t *), PARLIO_MEM_ALLOC_CAPS);
+    ESP_GOTO_ON_FALSE(rx_unit->ring.descs, ESP_ERR_NO_MEM, err, TAG, "no memory for ring DMA descriptor array");
+    rx_unit->ring.num_slices = num_slices;
+    uint32_t cache_line_size = cache_hal_get_cache_line_size(CACHE_LL_LEVEL_INT_MEM, CACHE_TYPE_DATA);
+    size_t desc_alignment = MAX(cache_line_size, PARLIO_DMA_DESC_ALIGNMENT);
+    for (size_t i = 0; i < num_slices; i++) {
+        rx_unit->ring.descs[i] = heap_caps_aligned_calloc(desc_alignment, 1, rx_unit->desc_size, PARLIO_DMA_MEM_ALLOC_CAPS);
+        ESP_GOTO_ON_FALSE(rx_unit->ring.descs[i], ESP_ERR_NO_MEM, err_free, TAG, "no memory for ring DMA descriptors");
+    }
+    for (size_t i = 0; i < num_slices; i++) {
+        parlio_dma_desc_t *desc = rx_unit->ring.descs[i];
+        desc->buffer = (uint8_t *)config->buffer + i * config->slice_size;
+        desc->dw0.size = config->slice_size;
+        desc->dw0.length = config->slice_size;
+        desc->dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+        /* Link the descriptors as a ring so the DMA never stops on its own */
+        desc->next = rx_unit->ring.descs[(i + 1) % num_slices];
+#if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
+        esp_cache_msync(desc, rx_unit->desc_size, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+#endif
+    }
+    rx_unit->ring.buffer = config->buffer;
+    rx_unit->ring.slice_size = config->slice_size;
+    rx_unit->ring.head = 0;
+    rx_unit->ring.tail = 0;
+    rx_unit->ring.filled = 0;
+    rx_unit->ring.dropped = 0;
+    rx_unit->ring.cache_sync = in_ext_mem;
+#if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
+    rx_unit->ring.cache_sync = true;
+#endif
+    if (rx_unit->ring.cache_sync) {
+        /* Write back the dirty lines of the ring, the DMA is going to own the whole buffer */
+        esp_cache_msync(config->buffer, config->buffer_size, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+    }
+
+    /* Configure the delimiter and start the capture, same sequence as starting an infinite transaction */
+    if (rx_unit->cfg.flags.free_clk) {
+        PARLIO_CLOCK_SRC_ATOMIC() {
+            parlio_ll_rx_enable_clock(hal->regs, false);
+        }
+    }
+    s_parlio_set_delimiter_config(rx_unit, config->delimiter);
+    /* Register the ring capture as the current transaction, so the normal receive path knows the bus is busy */
+    portENTER_CRITICAL(&s_rx_spinlock);
+    rx_unit->curr_trans = (parlio_rx_transaction_t) {
+        .delimiter = config->delimiter,
+        .payload = config->buffer,
+        .size = config->buffer_size,
+        .flags.infinite = true,
+    };
+    config->delimiter->under_using = true;
+    rx_unit->ring.active = true;
+    portEXIT_CRITICAL(&s_rx_spinlock);
+    rx_unit->usr_recv_buf = config->buffer;
+    xSemaphoreTake(rx_unit->trans_sem, 0);
+    gdma_start(rx_unit->dma_chan, (intptr_t)rx_unit->ring.descs[0]);
+    if (rx_unit->cfg.flags.free_clk) {
+        parlio_ll_rx_start(hal->regs, true);
+        PARLIO_CLOCK_SRC_ATOMIC() {
+            parlio_ll_rx_enable_clock(hal->regs, true);
+        }
+    }
+    xSemaphoreGive(rx_unit->mutex);
+    return ESP_OK;
+
+err_free:
+    s_parlio_rx_ring_release(rx_unit);
+err:
+    xSemaphoreGive(rx_unit->mutex);
+    return ret;
+}
+
+esp_err_t parlio_rx_unit_ring_capture_stop(parlio_rx_unit_handle_t rx_unit)
+{
+    ESP_RETURN_ON_FALSE(rx_unit, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    esp_err_t ret = ESP_OK;
+    parlio_hal_context_t *hal = &rx_unit->base.group->hal;
+
+    xSemaphoreTake(rx_unit->mutex, portMAX_DELAY);
+    ESP_GOTO_ON_FALSE(rx_unit->ring.active, ESP_ERR_INVALID_STATE, err, TAG, "the ring capture has not started");
+    /* Stop the DMA and the RX engine first, so the descriptor chain can be freed safely */
+    gdma_stop(rx_unit->dma_chan);
+    PARLIO_CLOCK_SRC_ATOMIC() {
+        parlio_ll_rx_enable_clock(hal->regs, false);
+    }
+    parlio_ll_rx_start(hal->regs, false);
+    portENTER_CRITICAL(&s_rx_spinlock);
+    rx_unit->ring.active = false;
+    if (rx_unit->curr_trans.delimiter) {
+        rx_unit->curr_trans.delimiter->under_using = false;
+    }
+    memset(&rx_unit->curr_trans, 0, sizeof(parlio_rx_transaction_t));
+    portEXIT_CRITICAL(&s_rx_spinlock);
+    xSemaphoreGive(rx_unit->trans_sem);
+    s_parlio_rx_ring_release(rx_unit);
+err:
+    xSemaphoreGive(rx_unit->mutex);
+    return ret;
+}
+
+esp_err_t parlio_rx_unit_ring_capture_get_status(parlio_rx_unit_handle_t rx_unit, parlio_rx_ring_capture_status_t *status)
+{
+    ESP_RETURN_ON_FALSE(rx_unit && status, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    /* Take a coherent snapshot of the indices, they are updated together in the ISR */
+    portENTER_CRITICAL_SAFE(&s_rx_spinlock);
+    status->head = rx_unit->ring.head;
+    status->tail = rx_unit->ring.tail;
+    status->filled_slices = rx_unit->ring.filled;
+    status->dropped_slices = rx_unit->ring.dropped;
+    portEXIT_CRITICAL_SAFE(&s_rx_spinlock);
+    return ESP_OK;
+}
+
+esp_err_t parlio_rx_unit_ring_capture_consume(parlio_rx_unit_handle_t rx_unit, size_t num_slices, size_t *consumed_slices)
+{
+    ESP_RETURN_ON_FALSE(rx_unit, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    portENTER_CRITICAL_SAFE(&s_rx_spinlock);
+    size_t can_consume = MIN(num_slices, rx_unit->ring.filled);
+    if (can_consume) {
+        rx_unit->ring.tail = (rx_unit->ring.tail + can_consume) % rx_unit->ring.num_slices;
+        rx_unit->ring.filled -= can_consume;
+    }
+    portEXIT_CRITICAL_SAFE(&s_rx_spinlock);
+    if (consumed_slices) {
+        *consumed_slices = can_consume;
+    }
+    return ESP_OK;
+}
@@ -270,6 +270,25 @@ esp_err_t pcnt_unit_clear_count(pcnt_unit_handle_t unit);
  */
 esp_err_t pcnt_unit_get_count(pcnt_unit_handle_t unit, int *value);
 
+/**
+ * @brief Get the count values of multiple PCNT units in one coherent snapshot
+ *
+ * @note All the units must come from the same PCNT group. The counters are read back-to-back within a single critical section,
+ *       so the returned values are not skewed by the per-call locking overhead of `pcnt_unit_get_count()`.
+ *       This is useful for e.g. multi-axis odometry, where the decoded positions must belong to the same instant.
+ * @note This function is allowed to run within ISR context
+ * @note This function will be placed into IRAM if `CONFIG_PCNT_CTRL_FUNC_IN_IRAM`, so that it's allowed to be executed when Cache is disabled
+ *
+ * @param[in] units Array of PCNT unit handles created by `pcnt_new_unit()`, all belonging to the same group
+ * @param[in] num_units Number of unit handles in the `units` array
+ * @param[out] counts Returned count values, one slot per unit handle
+ * @return
+ *      - ESP_OK: Get PCNT snapshot successfully
+ *      - ESP_ERR_INVALID_ARG: Get PCNT snapshot failed because of invalid argument (e.g. units from different groups)
+ *      - ESP_FAIL: Get PCNT snapshot failed because of other error
+ */
+esp_err_t pcnt_group_snapshot(pcnt_unit_handle_t *units, size_t num_units, int *counts);
+
 /**
  * @brief Set event callbacks for PCNT unit
  *
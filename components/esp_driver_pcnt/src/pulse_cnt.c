@@ -495,6 +495,30 @@ esp_err_t pcnt_unit_get_count(pcnt_unit_handle_t unit, int *value)
     return ESP_OK;
 }
 
+esp_err_t pcnt_group_snapshot(pcnt_unit_handle_t *units, size_t num_units, int *counts)
+{
+    pcnt_group_t *group = NULL;
+    ESP_RETURN_ON_FALSE_ISR(units && counts && num_units, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    for (size_t i = 0; i < num_units; i++) {
+        ESP_RETURN_ON_FALSE_ISR(units[i], ESP_ERR_INVALID_ARG, TAG, "invalid unit handle");
+        ESP_RETURN_ON_FALSE_ISR(!group || units[i]->group == group, ESP_ERR_INVALID_ARG, TAG, "units not in the same group");
+        group = units[i]->group;
+    }
+
+    // latch all counters in one critical section, so the values are read back-to-back without skew from lock churn
+    portENTER_CRITICAL_SAFE(&group->spinlock);
+    for (size_t i = 0; i < num_units; i++) {
+        pcnt_unit_t *unit = units[i];
+        // the accum_value is also accessed by the ISR, nest the unit's spinlock to keep it coherent with the hardware counter
+        portENTER_CRITICAL_SAFE(&unit->spinlock);
+        counts[i] = pcnt_ll_get_count(group->hal.dev, unit->unit_id) + unit->accum_value;
+        portEXIT_CRITICAL_SAFE(&unit->spinlock);
+    }
+    portEXIT_CRITICAL_SAFE(&group->spinlock);
+
+    return ESP_OK;
+}
+
 esp_err_t pcnt_unit_register_event_callbacks(pcnt_unit_handle_t unit, const pcnt_event_callbacks_t *cbs, void *user_data)
 {
     ESP_RETURN_ON_FALSE(unit && cbs, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
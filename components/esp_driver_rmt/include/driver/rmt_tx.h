@@ -42,6 +42,12 @@ typedef struct {
     struct {
         uint32_t invert_out: 1;   /*!< Whether to invert the RMT channel signal before output to GPIO pad */
         uint32_t with_dma: 1;     /*!< If set, the driver will allocate an RMT channel with DMA capability */
+        uint32_t dma_precode: 1;  /*!< If set (only valid together with `with_dma`), each transaction is fully encoded into
+                                       its own frame buffer inside `rmt_transmit()`, and the DMA consumes the ready-made frame
+                                       through a complete descriptor chain. There is no encoder refill during the transfer,
+                                       so a delayed interrupt can't underrun the transmission anymore.
+                                       `mem_block_symbols` sets the frame buffer capacity of each queued transaction;
+                                       the frame buffers are allocated from PSRAM when the DMA is able to access it. */
         uint32_t io_loop_back: 1; /*!< The signal output from the GPIO will be fed to the input path as well */
         uint32_t io_od_mode: 1;   /*!< Configure the GPIO as open-drain mode */
         uint32_t allow_pd: 1;     /*!< If set, driver allows the power domain to be powered off when system enters sleep mode.
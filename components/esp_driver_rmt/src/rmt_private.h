@@ -153,6 +153,8 @@ typedef struct {
     int loop_count;                // transaction can be continued in a loop for specific times
     int remain_loop_count;         // user required loop count may exceed hardware limitation, the driver will transfer them in batches
     size_t transmitted_symbol_num; // track the number of transmitted symbols
+    rmt_symbol_word_t *precode_buf; // frame buffer bound to this transaction (precode DMA mode only)
+    size_t precode_symbols;        // number of symbols that are pre-encoded in `precode_buf`, including the EOF marker
     struct {
         uint32_t eot_level : 1;    // Set the output level for the "End Of Transmission"
         uint32_t encoding_done: 1; // Indicate whether the encoding has finished (not the encoding of transmission)
@@ -175,6 +177,11 @@ struct rmt_tx_channel_t {
     rmt_tx_done_callback_t on_trans_done; // callback, invoked on trans done
     rmt_dma_descriptor_t *dma_nodes;    // DMA descriptor nodes
     rmt_dma_descriptor_t *dma_nodes_nc; // DMA descriptor nodes accessed in non-cached way
+    rmt_dma_descriptor_t *stream_nodes;    // descriptor chain covering a whole pre-encoded frame (precode DMA mode only)
+    rmt_dma_descriptor_t *stream_nodes_nc; // `stream_nodes` accessed in non-cached way
+    size_t num_stream_nodes;   // number of descriptors in `stream_nodes`
+    size_t precode_capacity;   // frame buffer capacity in symbols, non-zero marks a precode DMA channel
+    size_t precode_cache_line; // cache line size of the frame buffer location, 0 means no cache sync needed
     rmt_tx_trans_desc_t trans_desc_pool[];   // transfer descriptor pool
 };
 
@@ -59,8 +59,13 @@ static esp_err_t rmt_tx_init_dma_link(rmt_tx_channel_t *tx_channel, const rmt_tx
         .owner_check = true,
     };
     gdma_apply_strategy(tx_channel->base.dma_chan, &gdma_strategy_conf);
+    bool frame_bufs_in_psram = false;
+#if CONFIG_SPIRAM && SOC_AHB_GDMA_SUPPORT_PSRAM
+    // the pre-encoded frames are only fetched by the DMA, they can live in the slower external memory
+    frame_bufs_in_psram = config->flags.dma_precode;
+#endif
     gdma_transfer_config_t transfer_cfg = {
-        .access_ext_mem = false, // for performance, we don't use external memory as the DMA buffer
+        .access_ext_mem = frame_bufs_in_psram, // for performance, we don't use external memory as the ping-pong DMA buffer
         .max_data_burst_size = 32,
     };
     ESP_RETURN_ON_ERROR(gdma_config_transfer(tx_channel->base.dma_chan, &transfer_cfg), TAG, "config DMA transfer failed");
@@ -71,10 +76,31 @@ static esp_err_t rmt_tx_init_dma_link(rmt_tx_channel_t *tx_channel, const rmt_tx
     ESP_RETURN_ON_ERROR(gdma_register_tx_event_callbacks(tx_channel->base.dma_chan, &cbs, tx_channel), TAG, "register DMA callbacks failed");
 
     size_t int_alignment = 0;
+    size_t ext_alignment = 0;
     // get the alignment requirement from DMA
-    gdma_get_alignment_constraints(tx_channel->base.dma_chan, &int_alignment, NULL);
+    gdma_get_alignment_constraints(tx_channel->base.dma_chan, &int_alignment, &ext_alignment);
     // apply RMT hardware alignment requirement
     int_alignment = MAX(int_alignment, sizeof(rmt_symbol_word_t));
+
+    if (config->flags.dma_precode) {
+        // precode mode: one frame buffer per queued transaction, the whole frame is encoded up front
+        // and consumed by a complete descriptor chain, so there's no refill deadline during the transfer
+        size_t alignment = MAX(frame_bufs_in_psram ? ext_alignment : int_alignment, sizeof(rmt_symbol_word_t));
+        uint32_t frame_caps = MALLOC_CAP_8BIT;
+        frame_caps |= frame_bufs_in_psram ? MALLOC_CAP_SPIRAM : (MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        size_t capacity_bytes = ALIGN_UP(config->mem_block_symbols * sizeof(rmt_symbol_word_t), alignment);
+        for (size_t i = 0; i < tx_channel->queue_size; i++) {
+            rmt_symbol_word_t *frame_buf = heap_caps_aligned_calloc(alignment, 1, capacity_bytes, frame_caps);
+            ESP_RETURN_ON_FALSE(frame_buf, ESP_ERR_NO_MEM, TAG, "no mem for precode frame buffer");
+            tx_channel->trans_desc_pool[i].precode_buf = frame_buf;
+        }
+        tx_channel->precode_cache_line = cache_hal_get_cache_line_size(frame_bufs_in_psram ? CACHE_LL_LEVEL_EXT_MEM : CACHE_LL_LEVEL_INT_MEM, CACHE_TYPE_DATA);
+        tx_channel->precode_capacity = config->mem_block_symbols;
+        // the encoders use the ping-pong boundary for their internal bookkeeping, stretch it over the whole frame buffer;
+        // the ping-pong nodes are only used as encoder scratch in this mode, they are never handed to the hardware
+        tx_channel->ping_pong_symbols = config->mem_block_symbols / 2;
+        return ESP_OK;
+    }
     // the memory returned by `heap_caps_aligned_calloc` also meets the cache alignment requirement (both address and size)
     rmt_symbol_word_t *dma_mem_base = heap_caps_aligned_calloc(int_alignment, sizeof(rmt_symbol_word_t), config->mem_block_symbols,
                                                                RMT_MEM_ALLOC_CAPS | MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
@@ -234,6 +260,11 @@ static esp_err_t rmt_tx_destroy(rmt_tx_channel_t *tx_channel)
     if (tx_channel->dma_mem_base) {
         free(tx_channel->dma_mem_base);
     }
+    for (size_t i = 0; i < tx_channel->queue_size; i++) {
+        if (tx_channel->trans_desc_pool[i].precode_buf) {
+            free(tx_channel->trans_desc_pool[i].precode_buf);
+        }
+    }
     if (tx_channel->base.group) {
         // de-register channel from RMT group
         rmt_tx_unregister_from_group(&tx_channel->base, tx_channel->base.group);
@@ -264,6 +295,7 @@ esp_err_t rmt_new_tx_channel(const rmt_tx_channel_config_t *config, rmt_channel_
 #if !SOC_RMT_SUPPORT_DMA
     ESP_RETURN_ON_FALSE(config->flags.with_dma == 0, ESP_ERR_NOT_SUPPORTED, TAG, "DMA not supported");
 #endif
+    ESP_RETURN_ON_FALSE(!config->flags.dma_precode || config->flags.with_dma, ESP_ERR_INVALID_ARG, TAG, "dma_precode requires with_dma");
 
 #if !SOC_RMT_SUPPORT_SLEEP_RETENTION
     ESP_RETURN_ON_FALSE(config->flags.allow_pd == 0, ESP_ERR_NOT_SUPPORTED, TAG, "not able to power down in light sleep");
@@ -279,18 +311,30 @@ esp_err_t rmt_new_tx_channel(const rmt_tx_channel_config_t *config, rmt_channel_
     if (config->flags.with_dma) {
         // DMA descriptors must be placed in internal SRAM
         mem_caps |= MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA;
-        rmt_dma_descriptor_t *dma_nodes = heap_caps_aligned_calloc(RMT_DMA_DESC_ALIGN, RMT_DMA_NODES_PING_PONG, sizeof(rmt_dma_descriptor_t), mem_caps);
+        size_t num_dma_nodes = RMT_DMA_NODES_PING_PONG;
+        if (config->flags.dma_precode) {
+            // besides the ping-pong nodes (encoder scratch in this mode), we need a descriptor chain
+            // that can cover a whole pre-encoded frame
+            tx_channel->num_stream_nodes = (config->mem_block_symbols * sizeof(rmt_symbol_word_t) + DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED - 1)
+                                           / DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED;
+            num_dma_nodes += tx_channel->num_stream_nodes;
+        }
+        rmt_dma_descriptor_t *dma_nodes = heap_caps_aligned_calloc(RMT_DMA_DESC_ALIGN, num_dma_nodes, sizeof(rmt_dma_descriptor_t), mem_caps);
         ESP_GOTO_ON_FALSE(dma_nodes, ESP_ERR_NO_MEM, err, TAG, "no mem for tx DMA nodes");
         tx_channel->dma_nodes = dma_nodes;
         // write back and then invalidate the cached dma_nodes, because later the DMA nodes are accessed by non-cacheable address
         uint32_t data_cache_line_size = cache_hal_get_cache_line_size(CACHE_LL_LEVEL_INT_MEM, CACHE_TYPE_DATA);
         if (data_cache_line_size) {
-            ESP_GOTO_ON_ERROR(esp_cache_msync(dma_nodes, RMT_DMA_NODES_PING_PONG * sizeof(rmt_dma_descriptor_t),
+            ESP_GOTO_ON_ERROR(esp_cache_msync(dma_nodes, num_dma_nodes * sizeof(rmt_dma_descriptor_t),
                                               ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_INVALIDATE | ESP_CACHE_MSYNC_FLAG_UNALIGNED),
                               err, TAG, "cache sync failed");
         }
         // we will use the non-cached address to manipulate the DMA descriptor, for simplicity
         tx_channel->dma_nodes_nc = (rmt_dma_descriptor_t *)RMT_GET_NON_CACHE_ADDR(dma_nodes);
+        if (config->flags.dma_precode) {
+            tx_channel->stream_nodes = dma_nodes + RMT_DMA_NODES_PING_PONG;
+            tx_channel->stream_nodes_nc = tx_channel->dma_nodes_nc + RMT_DMA_NODES_PING_PONG;
+        }
     }
     // create transaction queues
     ESP_GOTO_ON_ERROR(rmt_tx_create_trans_queue(tx_channel, config), err, TAG, "install trans queues failed");
@@ -344,7 +388,8 @@ esp_err_t rmt_new_tx_channel(const rmt_tx_channel_config_t *config, rmt_channel_
 
     rmt_ll_tx_set_mem_blocks(hal->regs, channel_id, tx_channel->base.mem_block_num);
     // set limit threshold, after transmit ping_pong_symbols size, an interrupt event would be generated
-    rmt_ll_tx_set_limit(hal->regs, channel_id, tx_channel->ping_pong_symbols);
+    // for precode channels ping_pong_symbols covers the frame buffer, keep the hardware threshold on the real memory block
+    rmt_ll_tx_set_limit(hal->regs, channel_id, config->flags.dma_precode ? SOC_RMT_MEM_WORDS_PER_CHANNEL / 2 : tx_channel->ping_pong_symbols);
     // disable carrier modulation by default, can re-enable by `rmt_apply_carrier()`
     rmt_ll_tx_enable_carrier_modulation(hal->regs, channel_id, false);
     // idle level is determined by register value
@@ -542,6 +587,43 @@ esp_err_t rmt_tx_register_event_callbacks(rmt_channel_handle_t channel, const rm
     return ESP_OK;
 }
 
+#if SOC_RMT_SUPPORT_DMA
+static esp_err_t rmt_tx_precode_trans(rmt_tx_channel_t *tx_chan, rmt_tx_trans_desc_t *t)
+{
+    // the encoders run in this (task) context and target the transaction's own frame buffer;
+    // the ping-pong nodes they mark along the way are scratch only and never handed to the hardware.
+    // Note: the frame buffer is written through the cached address, it's synced to the memory below
+    tx_chan->dma_mem_base_nc = t->precode_buf;
+    tx_chan->mem_off = 0;
+    tx_chan->mem_end = tx_chan->precode_capacity;
+    rmt_encode_state_t state = RMT_ENCODING_RESET;
+    size_t encoded_symbols = t->encoder->encode(t->encoder, &tx_chan->base, t->payload, t->payload_bytes, &state);
+    if (!(state & RMT_ENCODING_COMPLETE) || (state & RMT_ENCODING_MEM_FULL)) {
+        // the frame (plus the EOF marker) doesn't fit into the frame buffer
+        rmt_encoder_reset(t->encoder);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    t->flags.encoding_done = true;
+    // a RMT word whose duration is zero means a "stop" pattern
+    t->precode_buf[tx_chan->mem_off++] = (rmt_symbol_word_t) {
+        .duration0 = 0,
+        .level0 = t->flags.eot_level,
+        .duration1 = 0,
+        .level1 = t->flags.eot_level,
+    };
+    encoded_symbols += 1;
+    t->transmitted_symbol_num = encoded_symbols;
+    t->precode_symbols = tx_chan->mem_off;
+    if (tx_chan->precode_cache_line) {
+        // write the encoded frame back to the memory, where the DMA fetches it from
+        ESP_RETURN_ON_ERROR(esp_cache_msync(t->precode_buf, t->precode_symbols * sizeof(rmt_symbol_word_t),
+                                            ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED),
+                            TAG, "cache sync failed");
+    }
+    return ESP_OK;
+}
+#endif // SOC_RMT_SUPPORT_DMA
+
 esp_err_t rmt_transmit(rmt_channel_handle_t channel, rmt_encoder_t *encoder, const void *payload, size_t payload_bytes, const rmt_transmit_config_t *config)
 {
     ESP_RETURN_ON_FALSE(channel && encoder && payload && payload_bytes && config, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
@@ -558,6 +640,11 @@ esp_err_t rmt_transmit(rmt_channel_handle_t channel, rmt_encoder_t *encoder, con
         queue_wait_ticks = 0;
     }
     rmt_tx_channel_t *tx_chan = __containerof(channel, rmt_tx_channel_t, base);
+#if SOC_RMT_SUPPORT_DMA
+    // on a precode channel the whole frame must fit into the frame buffer, a loop transaction can't
+    ESP_RETURN_ON_FALSE(!tx_chan->precode_capacity || config->loop_count == 0, ESP_ERR_NOT_SUPPORTED,
+                        TAG, "loop transmission not supported on precode channels");
+#endif
     rmt_tx_trans_desc_t *t = NULL;
     // acquire one transaction description from ready queue or complete queue
     if (xQueueReceive(tx_chan->trans_queues[RMT_TX_QUEUE_READY], &t, 0) != pdTRUE) {
@@ -568,7 +655,9 @@ esp_err_t rmt_transmit(rmt_channel_handle_t channel, rmt_encoder_t *encoder, con
     ESP_RETURN_ON_FALSE(t, ESP_ERR_INVALID_STATE, TAG, "no free transaction descriptor, please consider increasing trans_queue_depth");
 
     // fill in the transaction descriptor
+    rmt_symbol_word_t *precode_buf = t->precode_buf; // the frame buffer is bound to the descriptor, it survives the reset
     memset(t, 0, sizeof(rmt_tx_trans_desc_t));
+    t->precode_buf = precode_buf;
     t->encoder = encoder;
     t->payload = payload;
     t->payload_bytes = payload_bytes;
@@ -576,6 +665,18 @@ esp_err_t rmt_transmit(rmt_channel_handle_t channel, rmt_encoder_t *encoder, con
     t->remain_loop_count = t->loop_count;
     t->flags.eot_level = config->flags.eot_level;
 
+#if SOC_RMT_SUPPORT_DMA
+    if (tx_chan->precode_capacity) {
+        // expand the whole frame right now, in task context, there's no deadline on this work
+        esp_err_t err = rmt_tx_precode_trans(tx_chan, t);
+        if (err != ESP_OK) {
+            // the transaction didn't make it into the frame buffer, recycle its descriptor
+            xQueueSend(tx_chan->trans_queues[RMT_TX_QUEUE_READY], &t, 0);
+            ESP_RETURN_ON_ERROR(err, TAG, "frame doesn't fit, please increase mem_block_symbols");
+        }
+    }
+#endif
+
     // send the transaction descriptor to queue
     if (xQueueSend(tx_chan->trans_queues[RMT_TX_QUEUE_PROGRESS], &t, 0) == pdTRUE) {
         tx_chan->num_trans_inflight++;
@@ -699,12 +800,33 @@ static void IRAM_ATTR rmt_tx_do_transaction(rmt_tx_channel_t *tx_chan, rmt_tx_tr
 #if SOC_RMT_SUPPORT_DMA
     if (channel->dma_chan) {
         gdma_reset(channel->dma_chan);
-        // chain the descriptors into a ring, and will break it in `rmt_encode_eof()`
-        for (int i = 0; i < RMT_DMA_NODES_PING_PONG; i++) {
-            tx_chan->dma_nodes_nc[i].next = &tx_chan->dma_nodes[i + 1]; // note, we must use the cache address for the next pointer
-            tx_chan->dma_nodes_nc[i].dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_CPU;
+        if (tx_chan->precode_capacity) {
+            // mount the pre-encoded frame on the full descriptor chain, nothing is refilled during the transfer
+            size_t remain = t->precode_symbols * sizeof(rmt_symbol_word_t);
+            uint8_t *buf = (uint8_t *)t->precode_buf;
+            int node_index = 0;
+            while (remain) {
+                size_t len = MIN(remain, DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED);
+                tx_chan->stream_nodes_nc[node_index].buffer = buf;
+                tx_chan->stream_nodes_nc[node_index].dw0.size = len;
+                tx_chan->stream_nodes_nc[node_index].dw0.length = len;
+                tx_chan->stream_nodes_nc[node_index].dw0.suc_eof = 0;
+                tx_chan->stream_nodes_nc[node_index].dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+                tx_chan->stream_nodes_nc[node_index].next = &tx_chan->stream_nodes[node_index + 1]; // note, we must use the cache address for the next pointer
+                buf += len;
+                remain -= len;
+                node_index++;
+            }
+            tx_chan->stream_nodes_nc[node_index - 1].dw0.suc_eof = 1;
+            tx_chan->stream_nodes_nc[node_index - 1].next = NULL;
+        } else {
+            // chain the descriptors into a ring, and will break it in `rmt_encode_eof()`
+            for (int i = 0; i < RMT_DMA_NODES_PING_PONG; i++) {
+                tx_chan->dma_nodes_nc[i].next = &tx_chan->dma_nodes[i + 1]; // note, we must use the cache address for the next pointer
+                tx_chan->dma_nodes_nc[i].dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_CPU;
+            }
+            tx_chan->dma_nodes_nc[RMT_DMA_NODES_PING_PONG - 1].next = &tx_chan->dma_nodes[0];
         }
-        tx_chan->dma_nodes_nc[RMT_DMA_NODES_PING_PONG - 1].next = &tx_chan->dma_nodes[0];
     }
 #endif // SOC_RMT_SUPPORT_DMA
 
@@ -744,23 +866,33 @@ static void IRAM_ATTR rmt_tx_do_transaction(rmt_tx_channel_t *tx_chan, rmt_tx_tr
     rmt_ll_enable_interrupt(hal->regs, RMT_LL_EVENT_TX_DONE(channel_id), t->loop_count == 0);
     portEXIT_CRITICAL_SAFE(&group->spinlock);
 
-    // at the beginning of a new transaction, encoding memory offset should start from zero.
-    // It will increase in the encode function e.g. `rmt_encode_copy()`
-    tx_chan->mem_off = 0;
-    // use the full memory block for the beginning encoding session
-    tx_chan->mem_end = tx_chan->ping_pong_symbols * 2;
-    // perform the encoding session, return the number of encoded symbols
-    t->transmitted_symbol_num = rmt_encode_check_result(tx_chan, t);
-    // we're going to perform ping-pong operation, so the next encoding end position is the middle
-    tx_chan->mem_end = tx_chan->ping_pong_symbols;
-
 #if SOC_RMT_SUPPORT_DMA
-    if (channel->dma_chan) {
-        gdma_start(channel->dma_chan, (intptr_t)tx_chan->dma_nodes); // note, we must use the cached descriptor address to start the DMA
+    if (channel->dma_chan && tx_chan->precode_capacity) {
+        // the transaction was fully encoded in `rmt_transmit()` already, no encoding session here
+        gdma_start(channel->dma_chan, (intptr_t)tx_chan->stream_nodes); // note, we must use the cached descriptor address to start the DMA
         // delay a while, wait for DMA data going to RMT memory block
         esp_rom_delay_us(1);
-    }
+    } else
 #endif
+    {
+        // at the beginning of a new transaction, encoding memory offset should start from zero.
+        // It will increase in the encode function e.g. `rmt_encode_copy()`
+        tx_chan->mem_off = 0;
+        // use the full memory block for the beginning encoding session
+        tx_chan->mem_end = tx_chan->ping_pong_symbols * 2;
+        // perform the encoding session, return the number of encoded symbols
+        t->transmitted_symbol_num = rmt_encode_check_result(tx_chan, t);
+        // we're going to perform ping-pong operation, so the next encoding end position is the middle
+        tx_chan->mem_end = tx_chan->ping_pong_symbols;
+
+#if SOC_RMT_SUPPORT_DMA
+        if (channel->dma_chan) {
+            gdma_start(channel->dma_chan, (intptr_t)tx_chan->dma_nodes); // note, we must use the cached descriptor address to start the DMA
+            // delay a while, wait for DMA data going to RMT memory block
+            esp_rom_delay_us(1);
+        }
+#endif
+    }
     // turn on the TX machine
     portENTER_CRITICAL_SAFE(&channel->spinlock);
     rmt_ll_tx_fix_idle_level(hal->regs, channel_id, t->flags.eot_level, true);
@@ -966,6 +966,11 @@ void sdmmc_host_dma_resume(void)
     sdmmc_ll_poll_demand(s_host_ctx.hal.dev);
 }
 
+void sdmmc_host_dma_done_int_enable(bool enable)
+{
+    sdmmc_ll_enable_idmac_transfer_interrupt(s_host_ctx.hal.dev, enable);
+}
+
 bool sdmmc_host_card_busy(void)
 {
     return sdmmc_ll_is_card_data_busy(s_host_ctx.hal.dev);
@@ -34,6 +34,8 @@ void sdmmc_host_dma_stop(void);
 
 void sdmmc_host_dma_resume(void);
 
+void sdmmc_host_dma_done_int_enable(bool enable);
+
 bool sdmmc_host_card_busy(void);
 
 esp_err_t sdmmc_host_transaction_handler_init(void);
@@ -161,6 +161,14 @@ esp_err_t sdmmc_host_do_transaction(int slot, sdmmc_command_t* cmdinfo)
         s_cur_transfer.size_remaining = cmdinfo->datalen;
         s_cur_transfer.next_desc = 0;
         s_cur_transfer.desc_remaining = (cmdinfo->datalen + SDMMC_DMA_MAX_BUF_LEN - 1) / SDMMC_DMA_MAX_BUF_LEN;
+        /* When the whole transfer fits into the descriptor chain, the per-descriptor
+         * IDMAC interrupts only wake up the task for bookkeeping that the DATA_OVER
+         * event covers anyway (the ISR delivers the accumulated IDMAC status with
+         * every interrupt). Keep them masked in that case to avoid several task
+         * wakeups per transfer; they are only needed to refill descriptors on the
+         * fly for longer transfers.
+         */
+        sdmmc_host_dma_done_int_enable(s_cur_transfer.desc_remaining > SDMMC_DMA_DESC_CNT);
         // prepare descriptors
         fill_dma_descriptors(SDMMC_DMA_DESC_CNT);
         // write transfer info into hardware
@@ -20,6 +20,71 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Handle to a prepared SPI transaction
+ *
+ * A prepared transaction is validated and gets its DMA descriptor chains built once, at prepare
+ * time. Re-submitting the handle afterwards skips the per-transaction validation and descriptor
+ * setup, which matters for pipelines re-sending the same buffers over and over.
+ */
+typedef struct spi_prepared_trans_t spi_prepared_trans_t;
+typedef spi_prepared_trans_t *spi_prepared_trans_handle_t;
+
+/**
+ * @brief Validate a transaction and pre-build its DMA descriptor chains for repeated submission
+ *
+ * The TX/RX buffers have to be DMA-capable and aligned to the bus requirements (see
+ * `SPI_TRANS_DMA_BUFFER_ALIGN_MANUAL`), since re-submitting must not depend on refilling a
+ * temporary bounce buffer. `SPI_TRANS_USE_TXDATA/_RXDATA` are not supported.
+ *
+ * The buffer contents may be changed in place between submissions, the driver syncs the cache on
+ * every submit. `trans_desc`, as well as the buffers, must stay valid until the prepared handle is
+ * released with `spi_device_release_prepared_trans`.
+ *
+ * @param handle           Device handle obtained using spi_host_add_dev
+ * @param trans_desc       Transaction to prepare
+ * @param[out] out_prepared Returned prepared transaction handle
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_ARG:   Invalid arguments, e.g.: buffers not DMA-capable or not aligned
+ *        - ESP_ERR_INVALID_STATE: DMA isn't enabled on this bus
+ *        - ESP_ERR_NO_MEM:        No enough memory for the descriptor chains
+ */
+esp_err_t spi_device_prepare_trans(spi_device_handle_t handle, spi_transaction_t *trans_desc, spi_prepared_trans_handle_t *out_prepared);
+
+/**
+ * @brief Queue a prepared transaction for interrupt transaction execution
+ *
+ * Behaves like `spi_device_queue_trans`, but with constant cost: the transaction was validated at
+ * prepare time and the pre-built descriptor chains are only re-armed, not rebuilt. The result is
+ * returned through `spi_device_get_trans_result` as usual (with the original `spi_transaction_t`
+ * pointer). A prepared handle must not be re-submitted while still in flight.
+ *
+ * @param prepared      Prepared transaction handle obtained from `spi_device_prepare_trans`
+ * @param ticks_to_wait Ticks to wait until there's room in the queue; use portMAX_DELAY to never time out.
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_ARG:   Invalid arguments
+ *        - ESP_ERR_INVALID_STATE: Invalid states, e.g.: a polling transaction is ongoing
+ *        - ESP_ERR_TIMEOUT:       Timeout, the transaction isn't queued successfully
+ */
+esp_err_t spi_device_queue_prepared_trans(spi_prepared_trans_handle_t prepared, TickType_t ticks_to_wait);
+
+/**
+ * @brief Release a prepared transaction and free its descriptor chains
+ *
+ * Must only be called when the prepared transaction is not queued or in flight.
+ *
+ * @param prepared Prepared transaction handle obtained from `spi_device_prepare_trans`
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_ARG:   Invalid arguments
+ */
+esp_err_t spi_device_release_prepared_trans(spi_prepared_trans_handle_t prepared);
+
 #if SOC_SPI_SCT_SUPPORTED
 /**
  * @Backgrounds: `SCT Mode`
@@ -115,6 +180,39 @@ esp_err_t spi_device_queue_multi_trans(spi_device_handle_t handle, spi_multi_tra
  *        - ESP_ERR_TIMEOUT:       Timeout, didn't get a completed SCT transaction
  */
 esp_err_t spi_device_get_multi_trans_result(spi_device_handle_t handle, spi_multi_transaction_t **seg_trans_desc, TickType_t ticks_to_wait);
+
+/**
+ * @brief Queue a chain of ordinary SPI transactions as one SCT transaction.
+ *
+ * Convenience wrapper around `spi_device_queue_multi_trans` for pipelines which already build
+ * plain `spi_transaction_t` descriptors (e.g. a display driver queueing tens of small transfers
+ * per frame). The whole chain is covered by one pre-built DMA descriptor link and finishes with
+ * a single completion interrupt, instead of one ISR round-trip per transaction.
+ *
+ * Each chain element runs as one SCT segment: the CS is deasserted between elements for at least
+ * `gap_clocks` SPI clocks (the hardware does not support keeping CS asserted across segments, use
+ * a single transaction with `SPI_TRANS_CS_KEEP_ACTIVE` for that). Transactions with the
+ * `SPI_TRANS_VARIABLE_CMD/_ADDR/_DUMMY` flags (i.e. `spi_transaction_ext_t`) keep their custom
+ * phase lengths. `SPI_TRANS_USE_TXDATA/_RXDATA` are not supported, the data always goes via DMA.
+ *
+ * @note `chain_buf` is filled by this function and used as the queued SCT list: it, as well as all
+ *       TX/RX buffers, must stay valid until the chain is returned by `spi_device_get_multi_trans_result`
+ *       (which will return the `chain_buf` pointer).
+ *
+ * @param handle        Device handle obtained using spi_host_add_dev
+ * @param trans_array   Array of `trans_num` pointers to the transactions to chain
+ * @param chain_buf     Caller-provided array of `trans_num` SCT descriptors used as workspace
+ * @param trans_num     Number of transactions in the chain
+ * @param gap_clocks    CS inactive time between chain elements, in SPI clocks
+ * @param ticks_to_wait Ticks to wait until there's room in the queue; use portMAX_DELAY to never time out.
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_ARG:   Invalid arguments
+ *        - ESP_ERR_INVALID_STATE: Invalid states, e.g.: SCT mode isn't enabled, DMA descriptors not enough, etc.
+ *        - ESP_ERR_TIMEOUT:       Timeout, this SCT transaction isn't queued successfully
+ */
+esp_err_t spi_device_queue_trans_chain(spi_device_handle_t handle, spi_transaction_t *const trans_array[], spi_multi_transaction_t *chain_buf, uint32_t trans_num, uint32_t gap_clocks, TickType_t ticks_to_wait);
 #endif  //#if SOC_SPI_SCT_SUPPORTED
 
 #ifdef __cplusplus
@@ -162,9 +162,9 @@ typedef struct {
     const uint32_t *buffer_to_send;    //equals to tx_data, if SPI_TRANS_USE_RXDATA is applied; otherwise if original buffer wasn't in DMA-capable memory, this gets the address of a temporary buffer that is;
     //otherwise sets to the original buffer or NULL if no buffer is assigned.
     uint32_t *buffer_to_rcv;           //similar to buffer_to_send
-#if SOC_SPI_SCT_SUPPORTED
-    uint32_t reserved[2];              //As we create the queue when in init, to use sct mode private descriptor as a queue item (when in sct mode), we need to add a dummy member here to keep the same size with `spi_sct_trans_priv_t`.
-#endif
+    //As we create the queue when in init, to use sct mode private descriptor as a queue item (when in sct mode), these members also keep the same size with `spi_sct_trans_priv_t`.
+    spi_dma_desc_t *prep_tx_desc;      //pre-built private TX descriptor chain of a prepared transaction, NULL to build the shared chain per transaction
+    spi_dma_desc_t *prep_rx_desc;      //similar to prep_tx_desc
 } spi_trans_priv_t;
 
 #if SOC_SPI_SCT_SUPPORTED
@@ -688,11 +688,15 @@ static void SPI_MASTER_ISR_ATTR s_spi_dma_prepare_data(spi_host_t *host, spi_hal
     const spi_dma_ctx_t *dma_ctx = host->dma_ctx;
 
     if (trans->rcv_buffer) {
-        spicommon_dma_desc_setup_link(dma_ctx->dmadesc_rx, trans->rcv_buffer, ((trans->rx_bitlen + 7) / 8), true);
+        spi_dma_desc_t *rx_desc = host->cur_trans_buf.prep_rx_desc;
+        if (rx_desc == NULL) {
+            rx_desc = dma_ctx->dmadesc_rx;
+            spicommon_dma_desc_setup_link(rx_desc, trans->rcv_buffer, ((trans->rx_bitlen + 7) / 8), true);
+        }
 
         spi_dma_reset(dma_ctx->rx_dma_chan);
         spi_hal_hw_prepare_rx(hal->hw);
-        spi_dma_start(dma_ctx->rx_dma_chan, dma_ctx->dmadesc_rx);
+        spi_dma_start(dma_ctx->rx_dma_chan, rx_desc);
     }
 #if CONFIG_IDF_TARGET_ESP32
     else if (!dev->half_duplex) {
@@ -702,11 +706,15 @@ static void SPI_MASTER_ISR_ATTR s_spi_dma_prepare_data(spi_host_t *host, spi_hal
     }
 #endif
     if (trans->send_buffer) {
-        spicommon_dma_desc_setup_link(dma_ctx->dmadesc_tx, trans->send_buffer, (trans->tx_bitlen + 7) / 8, false);
+        spi_dma_desc_t *tx_desc = host->cur_trans_buf.prep_tx_desc;
+        if (tx_desc == NULL) {
+            tx_desc = dma_ctx->dmadesc_tx;
+            spicommon_dma_desc_setup_link(tx_desc, trans->send_buffer, (trans->tx_bitlen + 7) / 8, false);
+        }
 
         spi_dma_reset(dma_ctx->tx_dma_chan);
         spi_hal_hw_prepare_tx(hal->hw);
-        spi_dma_start(dma_ctx->tx_dma_chan, dma_ctx->dmadesc_tx);
+        spi_dma_start(dma_ctx->tx_dma_chan, tx_desc);
     }
 }
 
@@ -1266,6 +1274,138 @@ esp_err_t SPI_MASTER_ATTR spi_device_get_trans_result(spi_device_handle_t handle
     return ESP_OK;
 }
 
+/// Prepared transaction: validation and DMA descriptor chains are built once, then reused on every submit
+struct spi_prepared_trans_t {
+    spi_trans_priv_t priv;          //validated transaction, queued by value on every submit
+    spi_device_handle_t dev;        //device this transaction was prepared for
+    uint16_t tx_desc_num;           //number of descriptors in the private TX chain
+    uint16_t rx_desc_num;           //number of descriptors in the private RX chain
+};
+
+esp_err_t SPI_MASTER_ATTR spi_device_prepare_trans(spi_device_handle_t handle, spi_transaction_t *trans_desc, spi_prepared_trans_handle_t *out_prepared)
+{
+    esp_err_t ret = check_trans_valid(handle, trans_desc);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    SPI_CHECK(out_prepared != NULL, "invalid arguments", ESP_ERR_INVALID_ARG);
+    spi_host_t *host = handle->host;
+    SPI_CHECK(host->bus_attr->dma_enabled, "prepared transactions are only available when DMA is enabled", ESP_ERR_INVALID_STATE);
+    //The internal tx_data/rx_data words would need a per-submit copy, which defeats the purpose of preparing
+    SPI_CHECK((trans_desc->flags & (SPI_TRANS_USE_TXDATA | SPI_TRANS_USE_RXDATA)) == 0, "SPI_TRANS_USE_TXDATA/RXDATA not supported for prepared transactions", ESP_ERR_INVALID_ARG);
+
+    spi_trans_priv_t trans_buf = { .trans = trans_desc, };
+    ret = setup_priv_desc(host, &trans_buf);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    //Re-submitting must not depend on refilling a temporary bounce buffer, so the original buffers have to be DMA-capable and aligned
+    if (trans_buf.buffer_to_send != (uint32_t *)trans_desc->tx_buffer || trans_buf.buffer_to_rcv != trans_desc->rx_buffer) {
+        uninstall_priv_desc(&trans_buf);
+        SPI_CHECK(false, "TX/RX buffers must be DMA-capable and aligned for prepared transactions", ESP_ERR_INVALID_ARG);
+    }
+
+    spi_prepared_trans_t *prepared = heap_caps_calloc(1, sizeof(spi_prepared_trans_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    SPI_CHECK(prepared, "No enough memory", ESP_ERR_NO_MEM);
+    prepared->priv = trans_buf;
+    prepared->dev = handle;
+
+    if (trans_buf.buffer_to_send) {
+        uint32_t tx_byte_len = (trans_desc->length + 7) / 8;
+        prepared->tx_desc_num = (tx_byte_len + DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED - 1) / DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED;
+        prepared->priv.prep_tx_desc = heap_caps_aligned_calloc(DMA_DESC_MEM_ALIGN_SIZE, 1, sizeof(spi_dma_desc_t) * prepared->tx_desc_num, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (prepared->priv.prep_tx_desc == NULL) {
+            goto nomem;
+        }
+        spicommon_dma_desc_setup_link(prepared->priv.prep_tx_desc, trans_buf.buffer_to_send, tx_byte_len, false);
+    }
+    if (trans_buf.buffer_to_rcv) {
+        uint32_t rx_byte_len = (trans_desc->rxlength + 7) / 8;
+        prepared->rx_desc_num = (rx_byte_len + DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED - 1) / DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED;
+        prepared->priv.prep_rx_desc = heap_caps_aligned_calloc(DMA_DESC_MEM_ALIGN_SIZE, 1, sizeof(spi_dma_desc_t) * prepared->rx_desc_num, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (prepared->priv.prep_rx_desc == NULL) {
+            goto nomem;
+        }
+        spicommon_dma_desc_setup_link(prepared->priv.prep_rx_desc, trans_buf.buffer_to_rcv, rx_byte_len, true);
+    }
+
+    *out_prepared = prepared;
+    return ESP_OK;
+
+nomem:
+    free(prepared->priv.prep_tx_desc);
+    free(prepared);
+    return ESP_ERR_NO_MEM;
+}
+
+//Give the descriptors of a prepared transaction back to the hardware after the previous run cleared their owner bits
+static void SPI_MASTER_ATTR s_prepared_desc_rearm(spi_dma_desc_t *dmadesc, uint32_t desc_num)
+{
+    dmadesc = ADDR_DMA_2_CPU(dmadesc);
+    for (int i = 0; i < desc_num; i++) {
+        dmadesc[i].dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+    }
+}
+
+esp_err_t SPI_MASTER_ATTR spi_device_queue_prepared_trans(spi_prepared_trans_handle_t prepared, TickType_t ticks_to_wait)
+{
+    SPI_CHECK(prepared != NULL, "invalid prepared handle", ESP_ERR_INVALID_ARG);
+    spi_device_handle_t handle = prepared->dev;
+    spi_host_t *host = handle->host;
+    spi_transaction_t *trans_desc = prepared->priv.trans;
+
+    SPI_CHECK(!spi_bus_device_is_polling(handle), "Cannot queue new transaction while previous polling transaction is not terminated.", ESP_ERR_INVALID_STATE);
+
+    /* Even when using interrupt transfer, the CS can only be kept activated if the bus has been
+     * acquired with `spi_device_acquire_bus()` first. */
+    if (host->device_acquiring_lock != handle && (trans_desc->flags & SPI_TRANS_CS_KEEP_ACTIVE)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (prepared->priv.prep_tx_desc) {
+        s_prepared_desc_rearm(prepared->priv.prep_tx_desc, prepared->tx_desc_num);
+#if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
+        //the TX buffer may have been updated in place since the last run
+        esp_err_t err = esp_cache_msync((void *)prepared->priv.buffer_to_send, (trans_desc->length + 7) / 8, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+        assert(err == ESP_OK);
+#endif
+    }
+    if (prepared->priv.prep_rx_desc) {
+        s_prepared_desc_rearm(prepared->priv.prep_rx_desc, prepared->rx_desc_num);
+#if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
+        // do invalid here to hold on cache status to avoid hardware auto write back during dma transaction
+        esp_err_t err = esp_cache_msync((void *)prepared->priv.buffer_to_rcv, (trans_desc->rxlength + 7) / 8, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+        assert(err == ESP_OK);
+#endif
+    }
+
+#ifdef CONFIG_PM_ENABLE
+    esp_pm_lock_acquire(host->bus_attr->pm_lock);
+#endif
+    //Send to queue and invoke the ISR.
+
+    BaseType_t r = xQueueSend(handle->trans_queue, (void *)&prepared->priv, ticks_to_wait);
+    if (!r) {
+#ifdef CONFIG_PM_ENABLE
+        //Release APB frequency lock
+        esp_pm_lock_release(host->bus_attr->pm_lock);
+#endif
+        return ESP_ERR_TIMEOUT;
+    }
+
+    // The ISR will be invoked at correct time by the lock with `spi_bus_intr_enable`.
+    return spi_bus_lock_bg_request(handle->dev_lock);
+}
+
+esp_err_t spi_device_release_prepared_trans(spi_prepared_trans_handle_t prepared)
+{
+    SPI_CHECK(prepared != NULL, "invalid prepared handle", ESP_ERR_INVALID_ARG);
+    free(prepared->priv.prep_tx_desc);
+    free(prepared->priv.prep_rx_desc);
+    free(prepared);
+    return ESP_OK;
+}
+
 //Porcelain to do one blocking transmission.
 esp_err_t SPI_MASTER_ATTR spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans_desc)
 {
@@ -1877,6 +2017,37 @@ esp_err_t SPI_MASTER_ATTR spi_device_queue_multi_trans(spi_device_handle_t handl
     return ESP_OK;
 }
 
+esp_err_t SPI_MASTER_ATTR spi_device_queue_trans_chain(spi_device_handle_t handle, spi_transaction_t *const trans_array[], spi_multi_transaction_t *chain_buf, uint32_t trans_num, uint32_t gap_clocks, TickType_t ticks_to_wait)
+{
+    SPI_CHECK(handle && trans_array && chain_buf && trans_num, "Invalid arguments.", ESP_ERR_INVALID_ARG);
+
+    for (int i = 0; i < trans_num; i++) {
+        spi_transaction_t *trans = trans_array[i];
+        SPI_CHECK(trans, "Invalid arguments.", ESP_ERR_INVALID_ARG);
+        //The conf buffer describes DMA-driven segments only, there is no FIFO path for the internal tx_data/rx_data words
+        SPI_CHECK((trans->flags & (SPI_TRANS_USE_TXDATA | SPI_TRANS_USE_RXDATA)) == 0, "SPI_TRANS_USE_TXDATA/RXDATA not supported in a transaction chain", ESP_ERR_INVALID_ARG);
+
+        chain_buf[i] = (spi_multi_transaction_t) {
+            .base = *trans,
+            .sct_gap_len = gap_clocks,
+        };
+        if (trans->flags & SPI_TRANS_VARIABLE_CMD) {
+            chain_buf[i].command_bits = ((spi_transaction_ext_t *)trans)->command_bits;
+            chain_buf[i].seg_trans_flags |= SPI_MULTI_TRANS_CMD_LEN_UPDATED;
+        }
+        if (trans->flags & SPI_TRANS_VARIABLE_ADDR) {
+            chain_buf[i].address_bits = ((spi_transaction_ext_t *)trans)->address_bits;
+            chain_buf[i].seg_trans_flags |= SPI_MULTI_TRANS_ADDR_LEN_UPDATED;
+        }
+        if (trans->flags & SPI_TRANS_VARIABLE_DUMMY) {
+            chain_buf[i].dummy_bits = ((spi_transaction_ext_t *)trans)->dummy_bits;
+            chain_buf[i].seg_trans_flags |= SPI_MULTI_TRANS_DUMMY_LEN_UPDATED;
+        }
+    }
+
+    return spi_device_queue_multi_trans(handle, chain_buf, trans_num, ticks_to_wait);
+}
+
 esp_err_t SPI_MASTER_ATTR spi_device_get_multi_trans_result(spi_device_handle_t handle, spi_multi_transaction_t **seg_trans_desc, TickType_t ticks_to_wait)
 {
     SPI_CHECK(handle, "Invalid arguments.", ESP_ERR_INVALID_ARG);
@@ -85,6 +85,13 @@ struct touch_sensor_s {
     bool                    immersion_proof;            /*!< Flag to indicate whether to disable scanning when the guard ring is triggered */
     bool                    proximity_en;               /*!< Flag to indicate whether the proximity sensing feature is enabled */
     bool                    timeout_en;                 /*!< Flag to indicate whether the measurement timeout feature (hardware timeout) is enabled */
+
+    bool                    snapshot_en;                /*!< Flag to indicate whether the panel snapshot mode is enabled */
+    touch_chan_data_type_t  snapshot_data_type;         /*!< The data type captured into the panel snapshot */
+    int64_t                 snapshot_prev_us;           /*!< Timestamp of the previous scan done event, 0 if no scan finished yet,
+                                                         *   used to derive the scan duration of each snapshot
+                                                         */
+    touch_panel_snapshot_event_data_t snapshot;         /*!< Panel snapshot buffer, filled in the ISR and passed to the `on_panel_snapshot` callback */
 };
 
 /**
@@ -288,6 +288,16 @@ typedef struct {
                                                                                */
 } touch_proximity_config_t;
 
+/**
+ * @brief Touch sensor panel snapshot configurations
+ *
+ */
+typedef struct {
+    touch_chan_data_type_t          data_type;      /*!< The data type captured into the snapshot,
+                                                     *   only `TOUCH_CHAN_DATA_TYPE_SMOOTH` and `TOUCH_CHAN_DATA_TYPE_BENCHMARK` are supported
+                                                     */
+} touch_panel_snapshot_config_t;
+
 /**
  * @brief Base event structure used in touch event queue
  */
@@ -343,6 +353,27 @@ typedef touch_base_event_data_t touch_prox_done_event_data_t;
  */
 typedef touch_base_event_data_t touch_timeout_event_data_t;
 
+/**
+ * @brief Panel snapshot event data
+ * @note  A coherent full-panel snapshot captured when the hardware FSM finished
+ *        sequencing all the enabled channels in one scan round
+ */
+typedef struct {
+    int64_t                 timestamp_us;           /*!< Timestamp of the snapshot, in microseconds since boot */
+    uint32_t                scan_duration_us;       /*!< Duration of the scan round that produced this snapshot,
+                                                     *   measured between the previous and the current scan done event.
+                                                     *   It is 0 for the first snapshot after the scanning started.
+                                                     */
+    uint32_t                scan_count;             /*!< Sequence number of the snapshot, incremented on every scan round */
+    uint32_t                active_mask;            /*!< The channel active status at the time of the snapshot,
+                                                     *   if the bit is set, the corresponding channel is active
+                                                     */
+    uint32_t                chan_data[TOUCH_TOTAL_CHAN_NUM];  /*!< The data of each touch channel, indexed by the channel id.
+                                                     *   Only the first sample configuration is captured,
+                                                     *   the data of unregistered channels is 0.
+                                                     */
+} touch_panel_snapshot_event_data_t;
+
 /**
  * @brief Touch sensor callbacks
  * @note  Set NULL for the used callbacks.
@@ -409,6 +440,18 @@ typedef struct {
      * @return Whether a high priority task has been waken up by this callback function
      */
     bool (*on_proximity_meas_done)(touch_sensor_handle_t sens_handle, const touch_prox_done_event_data_t *event, void *user_ctx);
+    /**
+     * @brief Touch sensor on panel snapshot event callback.
+     *        Callback when a full-panel snapshot is captured, see `touch_sensor_config_panel_snapshot()`.
+     *        All enabled channels are delivered in one coherent, timestamped snapshot,
+     *        so the receiver does not need to reassemble the panel state from per-channel events.
+     * @param[in] sens_handle    Touch sensor controller handle, created from `touch_sensor_new_controller()`
+     * @param[in] event     Touch sensor panel snapshot event data
+     * @param[in] user_ctx  User registered context, passed from `touch_sensor_register_callbacks()`
+     *
+     * @return Whether a high priority task has been waken up by this callback function
+     */
+    bool (*on_panel_snapshot)(touch_sensor_handle_t sens_handle, const touch_panel_snapshot_event_data_t *event, void *user_ctx);
 } touch_event_callbacks_t;
 
 /**
@@ -23,6 +23,7 @@
 #include "esp_private/periph_ctrl.h"
 #include "esp_clk_tree.h"
 #include "esp_sleep.h"
+#include "esp_timer.h"
 #include "../../common/touch_sens_private.h"
 #if CONFIG_TOUCH_ENABLE_DEBUG_LOG
 // The local log level must be defined before including esp_log.h
@@ -79,6 +80,28 @@ void IRAM_ATTR touch_priv_default_intr_handler(void *arg)
         if (g_touch->cbs.on_scan_done) {
             need_yield |= g_touch->cbs.on_scan_done(g_touch, &data, g_touch->user_ctx);
         }
+        if (g_touch->snapshot_en) {
+            /* The FSM has sequenced all the enabled channels, capture a coherent
+             * full-panel snapshot so that the receiver doesn't need to reassemble
+             * the panel state from the per-channel events */
+            int64_t now_us = esp_timer_get_time();
+            uint32_t read_type = (g_touch->snapshot_data_type == TOUCH_CHAN_DATA_TYPE_BENCHMARK) ?
+                                 TOUCH_LL_READ_BENCHMARK : TOUCH_LL_READ_SMOOTH;
+            g_touch->snapshot.timestamp_us = now_us;
+            g_touch->snapshot.scan_duration_us = g_touch->snapshot_prev_us ?
+                                                 (uint32_t)(now_us - g_touch->snapshot_prev_us) : 0;
+            g_touch->snapshot_prev_us = now_us;
+            g_touch->snapshot.scan_count++;
+            g_touch->snapshot.active_mask = data.status_mask;
+            FOR_EACH_TOUCH_CHANNEL(i) {
+                if (g_touch->ch[i]) {
+                    touch_ll_read_chan_data(i, 0, read_type, &g_touch->snapshot.chan_data[i]);
+                }
+            }
+            if (g_touch->cbs.on_panel_snapshot) {
+                need_yield |= g_touch->cbs.on_panel_snapshot(g_touch, &g_touch->snapshot, g_touch->user_ctx);
+            }
+        }
     }
     if (status & TOUCH_LL_INTR_MASK_PROX_DONE) {
         data.chan->prox_cnt++;
@@ -311,6 +334,34 @@ esp_err_t touch_sensor_config_filter(touch_sensor_handle_t sens_handle, const to
     return ret;
 }
 
+esp_err_t touch_sensor_config_panel_snapshot(touch_sensor_handle_t sens_handle, const touch_panel_snapshot_config_t *snap_cfg)
+{
+    TOUCH_NULL_POINTER_CHECK(sens_handle);
+    if (snap_cfg) {
+        ESP_RETURN_ON_FALSE(snap_cfg->data_type == TOUCH_CHAN_DATA_TYPE_SMOOTH || snap_cfg->data_type == TOUCH_CHAN_DATA_TYPE_BENCHMARK,
+                            ESP_ERR_INVALID_ARG, TAG, "only smooth and benchmark data can be captured into the snapshot");
+    }
+
+    esp_err_t ret = ESP_OK;
+    xSemaphoreTake(sens_handle->mutex, portMAX_DELAY);
+    ESP_GOTO_ON_FALSE(!sens_handle->is_enabled, ESP_ERR_INVALID_STATE, err, TAG, "Please disable the touch sensor first");
+
+    TOUCH_ENTER_CRITICAL(TOUCH_PERIPH_LOCK);
+    if (snap_cfg) {
+        sens_handle->snapshot_data_type = snap_cfg->data_type;
+        memset(&sens_handle->snapshot, 0, sizeof(sens_handle->snapshot));
+        sens_handle->snapshot_prev_us = 0;
+        sens_handle->snapshot_en = true;
+    } else {
+        sens_handle->snapshot_en = false;
+    }
+    TOUCH_EXIT_CRITICAL(TOUCH_PERIPH_LOCK);
+
+err:
+    xSemaphoreGive(sens_handle->mutex);
+    return ret;
+}
+
 esp_err_t touch_sensor_config_sleep_wakeup(touch_sensor_handle_t sens_handle, const touch_sleep_config_t *sleep_cfg)
 {
     TOUCH_NULL_POINTER_CHECK(sens_handle);
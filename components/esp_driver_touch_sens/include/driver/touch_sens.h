@@ -240,6 +240,25 @@ esp_err_t touch_channel_config_benchmark(touch_channel_handle_t chan_handle, con
  */
 esp_err_t touch_channel_read_data(touch_channel_handle_t chan_handle, touch_chan_data_type_t type, uint32_t *data);
 
+/**
+ * @brief Configure the touch sensor panel snapshot mode
+ * @note  This function can be called when the touch sensor controller is NOT enabled (i.e. INIT state).
+ * @note  Once the panel snapshot mode is enabled, every time the hardware FSM finished sequencing
+ *        all the enabled channels, the driver captures the data of every registered channel into
+ *        one timestamped snapshot and delivers it via the `on_panel_snapshot` callback,
+ *        together with the scan duration of the round for benchmarking.
+ *        Compared to assembling the panel state from the per-channel callbacks,
+ *        the snapshot is coherent within one scan round and needs no locking on the receiver side.
+ *
+ * @param[in]  sens_handle      Touch sensor controller handle
+ * @param[in]  snap_cfg         Panel snapshot configurations, set NULL to disable the panel snapshot mode
+ * @return
+ *      - ESP_OK:                   Configure the panel snapshot mode success
+ *      - ESP_ERR_INVALID_ARG:      Invalid argument or NULL pointer
+ *      - ESP_ERR_INVALID_STATE:    The touch sensor is enabled
+ */
+esp_err_t touch_sensor_config_panel_snapshot(touch_sensor_handle_t sens_handle, const touch_panel_snapshot_config_t *snap_cfg);
+
 #if SOC_TOUCH_SUPPORT_WATERPROOF
 /**
  * @brief Configure the touch sensor water proof channels
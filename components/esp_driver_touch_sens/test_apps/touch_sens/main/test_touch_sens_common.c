@@ -196,3 +196,73 @@ TEST_CASE("touch_sens_active_inactive_test", "[touch]")
     TEST_ASSERT_EQUAL_INT32(touch_cnt, cb_data.active_count);
     TEST_ASSERT_EQUAL_INT32(touch_cnt, cb_data.inactive_count);
 }
+
+typedef struct {
+    volatile int snapshot_count;
+    volatile uint32_t last_scan_count;
+    volatile uint32_t last_duration_us;
+    volatile uint32_t chan_data_sum;
+} test_touch_snap_data_t;
+
+static bool TEST_TCH_IRAM_ATTR s_test_touch_on_panel_snapshot_callback(touch_sensor_handle_t sens_handle, const touch_panel_snapshot_event_data_t *event, void *user_ctx)
+{
+    test_touch_snap_data_t *snap_data = (test_touch_snap_data_t *)user_ctx;
+    snap_data->snapshot_count++;
+    snap_data->last_scan_count = event->scan_count;
+    snap_data->last_duration_us = event->scan_duration_us;
+    for (int i = 0; i < TOUCH_TOTAL_CHAN_NUM; i++) {
+        snap_data->chan_data_sum += event->chan_data[i];
+    }
+    return false;
+}
+
+#define TEST_SNAPSHOT_CHAN_NUM  3
+
+TEST_CASE("touch_sens_panel_snapshot_test", "[touch]")
+{
+    touch_sensor_handle_t touch = NULL;
+    touch_channel_handle_t touch_chan[TEST_SNAPSHOT_CHAN_NUM] = {NULL};
+
+    touch_sensor_config_t sens_cfg = TOUCH_SENSOR_DEFAULT_BASIC_CONFIG(TOUCH_SAMPLE_CFG_NUM, s_sample_cfg);
+    TEST_ESP_OK(touch_sensor_new_controller(&sens_cfg, &touch));
+    touch_sensor_filter_config_t filter_cfg = TOUCH_SENSOR_DEFAULT_FILTER_CONFIG();
+    TEST_ESP_OK(touch_sensor_config_filter(touch, &filter_cfg));
+    for (int i = 0; i < TEST_SNAPSHOT_CHAN_NUM; i++) {
+        TEST_ESP_OK(touch_sensor_new_channel(touch, i, &s_chan_cfg, &touch_chan[i]));
+    }
+    touch_ll_enable_internal_capacitor(true);
+
+    touch_panel_snapshot_config_t snap_cfg = {
+        .data_type = TOUCH_CHAN_DATA_TYPE_SMOOTH,
+    };
+    TEST_ESP_OK(touch_sensor_config_panel_snapshot(touch, &snap_cfg));
+
+    touch_event_callbacks_t callbacks = {
+        .on_panel_snapshot = s_test_touch_on_panel_snapshot_callback,
+    };
+    test_touch_snap_data_t snap_data = {};
+    TEST_ESP_OK(touch_sensor_register_callbacks(touch, &callbacks, &snap_data));
+
+    TEST_ESP_OK(touch_sensor_enable(touch));
+    /* Snapshot mode can't be re-configured while the controller is enabled */
+    TEST_ASSERT(touch_sensor_config_panel_snapshot(touch, NULL) == ESP_ERR_INVALID_STATE);
+    TEST_ESP_OK(touch_sensor_start_continuous_scanning(touch));
+    vTaskDelay(pdMS_TO_TICKS(100));
+    TEST_ESP_OK(touch_sensor_stop_continuous_scanning(touch));
+    TEST_ESP_OK(touch_sensor_disable(touch));
+
+    printf("snapshots: %d, last scan duration: %"PRIu32" us\n",
+           snap_data.snapshot_count, snap_data.last_duration_us);
+    /* One snapshot per scan round, scan count in sync with the delivered snapshots */
+    TEST_ASSERT_GREATER_THAN_INT32(1, snap_data.snapshot_count);
+    TEST_ASSERT_EQUAL_UINT32(snap_data.snapshot_count, snap_data.last_scan_count);
+    /* Scan duration telemetry and channel data should be populated */
+    TEST_ASSERT_NOT_EQUAL(0, snap_data.last_duration_us);
+    TEST_ASSERT_NOT_EQUAL(0, snap_data.chan_data_sum);
+
+    TEST_ESP_OK(touch_sensor_config_panel_snapshot(touch, NULL));
+    for (int i = 0; i < TEST_SNAPSHOT_CHAN_NUM; i++) {
+        TEST_ESP_OK(touch_sensor_del_channel(touch_chan[i]));
+    }
+    TEST_ESP_OK(touch_sensor_del_controller(touch));
+}
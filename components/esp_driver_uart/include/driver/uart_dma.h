@@ -0,0 +1,207 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "hal/uart_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Type of UART DMA (UHCI) controller handle
+ */
+typedef struct uart_dma_t *uart_dma_handle_t;
+
+/**
+ * @brief UART DMA controller configurations
+ *
+ * The UART DMA controller attaches the UHCI engine to an HP UART port, so that the serial data
+ * moves between memory and the UART FIFO via GDMA, with one interrupt per DMA buffer instead of
+ * one interrupt per FIFO watermark. The UART port itself (baud rate, word format, pins) must be
+ * configured beforehand with `uart_param_config` and `uart_set_pin`; the UART interrupt driven
+ * driver (`uart_driver_install`) must NOT be installed on that port, as the FIFO is taken over
+ * by the UHCI engine.
+ */
+typedef struct {
+    uart_port_t uart_port;    /*!< HP UART port to attach to (UART_NUM_0 or UART_NUM_1) */
+    size_t rx_buffer_size;    /*!< Size of each RX ring buffer, in bytes, must be a multiple of 4 */
+    size_t rx_buffer_count;   /*!< Number of RX ring buffers, at least 2 */
+    size_t tx_queue_depth;    /*!< Maximum number of TX transactions that can be pending at the same time */
+    size_t max_transmit_size; /*!< Maximum number of bytes moved by one TX transaction */
+    size_t dma_burst_size;    /*!< DMA burst size, in bytes, must be power of 2, set 0 to disable the burst */
+} uart_dma_config_t;
+
+/**
+ * @brief Event data of the `on_rx_data` callback
+ */
+typedef struct {
+    const uint8_t *data; /*!< Received data, points into an internal RX ring buffer.
+                              Only valid during the callback, copy it out if needed later */
+    size_t size;         /*!< Number of valid bytes in `data` */
+    struct {
+        uint32_t idle_eof: 1; /*!< Set when this buffer was closed by an RX idle timeout
+                                  (i.e. it ends a frame), cleared when the buffer simply ran full */
+    } flags;             /*!< Extra information about this chunk of data */
+} uart_dma_rx_event_data_t;
+
+/**
+ * @brief Event data of the `on_tx_done` callback
+ */
+typedef struct {
+    const uint8_t *buffer; /*!< First buffer of the completed TX transaction */
+    size_t size;           /*!< Total number of bytes sent by the completed TX transaction */
+} uart_dma_tx_done_event_data_t;
+
+/**
+ * @brief UART DMA callback signature
+ *
+ * @param[in] handle UART DMA controller handle
+ * @param[in] edata Event data, `uart_dma_rx_event_data_t` or `uart_dma_tx_done_event_data_t`,
+ *                  only valid during the callback
+ * @param[in] user_ctx User data, set in `uart_dma_register_event_callbacks`
+ *
+ * @return Whether a high priority task has been waken up by this callback
+ */
+typedef bool (*uart_dma_rx_done_callback_t)(uart_dma_handle_t handle, const uart_dma_rx_event_data_t *edata, void *user_ctx);
+typedef bool (*uart_dma_tx_done_callback_t)(uart_dma_handle_t handle, const uart_dma_tx_done_event_data_t *edata, void *user_ctx);
+
+/**
+ * @brief Group of UART DMA callbacks
+ *
+ * @note The callbacks are all running under ISR context
+ * @note When CONFIG_UART_ISR_IN_IRAM is enabled, the callbacks and the memory they touch
+ *       should be placed in IRAM / internal RAM, in case the cache is disabled.
+ */
+typedef struct {
+    uart_dma_rx_done_callback_t on_rx_data; /*!< Invoked for each RX ring buffer that got closed,
+                                                 either by an RX idle timeout or by running full */
+    uart_dma_tx_done_callback_t on_tx_done; /*!< Invoked when a queued TX transaction has been fully
+                                                 pushed out of the UART FIFO */
+} uart_dma_event_callbacks_t;
+
+/**
+ * @brief One element of a scatter-gather TX transaction
+ */
+typedef struct {
+    const void *buffer; /*!< Buffer to transmit, must be in DMA capable memory */
+    size_t size;        /*!< Number of bytes to transmit from `buffer` */
+} uart_dma_tx_vec_t;
+
+/**
+ * @brief Create a UART DMA controller and attach it to a UART port
+ *
+ * @param[in] config UART DMA controller configurations
+ * @param[out] ret_handle Returned UART DMA controller handle
+ *
+ * @return
+ *      - ESP_OK:                Create the controller successfully
+ *      - ESP_ERR_INVALID_ARG:   Invalid arguments
+ *      - ESP_ERR_NOT_FOUND:     The UHCI engine is already occupied
+ *      - ESP_ERR_NO_MEM:        No enough memory for the controller and its DMA buffers
+ */
+esp_err_t uart_dma_new_controller(const uart_dma_config_t *config, uart_dma_handle_t *ret_handle);
+
+/**
+ * @brief Register event callbacks for the UART DMA controller
+ *
+ * @note Must be called before `uart_dma_enable`
+ *
+ * @param[in] handle UART DMA controller handle
+ * @param[in] cbs Group of callback functions, NULL entries de-register the corresponding callback
+ * @param[in] user_ctx User data, passed to the callbacks directly
+ *
+ * @return
+ *      - ESP_OK:                Register the callbacks successfully
+ *      - ESP_ERR_INVALID_ARG:   Invalid arguments
+ *      - ESP_ERR_INVALID_STATE: The controller is already enabled
+ */
+esp_err_t uart_dma_register_event_callbacks(uart_dma_handle_t handle, const uart_dma_event_callbacks_t *cbs, void *user_ctx);
+
+/**
+ * @brief Enable the UART DMA controller and start receiving into the RX ring
+ *
+ * @param[in] handle UART DMA controller handle
+ *
+ * @return
+ *      - ESP_OK:                Enable the controller successfully
+ *      - ESP_ERR_INVALID_ARG:   Invalid arguments
+ *      - ESP_ERR_INVALID_STATE: The controller is already enabled
+ */
+esp_err_t uart_dma_enable(uart_dma_handle_t handle);
+
+/**
+ * @brief Disable the UART DMA controller and stop both DMA engines
+ *
+ * @note Pending TX transactions are dropped, their `on_tx_done` callbacks won't be invoked
+ *
+ * @param[in] handle UART DMA controller handle
+ *
+ * @return
+ *      - ESP_OK:                Disable the controller successfully
+ *      - ESP_ERR_INVALID_ARG:   Invalid arguments
+ *      - ESP_ERR_INVALID_STATE: The controller is not enabled yet
+ */
+esp_err_t uart_dma_disable(uart_dma_handle_t handle);
+
+/**
+ * @brief Queue a scatter-gather TX transaction
+ *
+ * The buffers of all vector elements are sent back to back as one transaction, without being
+ * copied: they must stay valid (and unchanged) until the `on_tx_done` callback reports the
+ * transaction as finished. This function doesn't block; when `tx_queue_depth` transactions are
+ * already pending it returns `ESP_ERR_INVALID_STATE` instead of waiting for room.
+ *
+ * @param[in] handle UART DMA controller handle
+ * @param[in] vec Array of buffers to transmit
+ * @param[in] num_vec Number of elements in `vec`, at most 8
+ *
+ * @return
+ *      - ESP_OK:                Queue the TX transaction successfully
+ *      - ESP_ERR_INVALID_ARG:   Invalid arguments, e.g.: buffers not DMA capable, total size exceeds `max_transmit_size`
+ *      - ESP_ERR_INVALID_STATE: The controller is not enabled, or the TX queue is full
+ */
+esp_err_t uart_dma_transmit_vectored(uart_dma_handle_t handle, const uart_dma_tx_vec_t *vec, size_t num_vec);
+
+/**
+ * @brief Queue a single-buffer TX transaction
+ *
+ * Equivalent to `uart_dma_transmit_vectored` with one vector element, see its description for
+ * the buffer lifetime and queueing semantics.
+ *
+ * @param[in] handle UART DMA controller handle
+ * @param[in] buffer Buffer to transmit, must be in DMA capable memory
+ * @param[in] size Number of bytes to transmit from `buffer`
+ *
+ * @return
+ *      - ESP_OK:                Queue the TX transaction successfully
+ *      - ESP_ERR_INVALID_ARG:   Invalid arguments
+ *      - ESP_ERR_INVALID_STATE: The controller is not enabled, or the TX queue is full
+ */
+esp_err_t uart_dma_transmit(uart_dma_handle_t handle, const void *buffer, size_t size);
+
+/**
+ * @brief Delete the UART DMA controller and free all its resources
+ *
+ * @note The controller must be disabled by `uart_dma_disable` before being deleted
+ *
+ * @param[in] handle UART DMA controller handle
+ *
+ * @return
+ *      - ESP_OK:                Delete the controller successfully
+ *      - ESP_ERR_INVALID_ARG:   Invalid arguments
+ *      - ESP_ERR_INVALID_STATE: The controller is still enabled
+ */
+esp_err_t uart_dma_del_controller(uart_dma_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,428 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/param.h>
+#include "sdkconfig.h"
+#include "esp_types.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "soc/soc_caps.h"
+#include "soc/periph_defs.h"
+#include "hal/uhci_ll.h"
+#include "hal/dma_types.h"
+#include "esp_private/periph_ctrl.h"
+#include "esp_private/gdma.h"
+#include "driver/uart.h"
+#include "driver/uart_dma.h"
+
+static const char *TAG = "uart_dma";
+
+#ifdef CONFIG_UART_ISR_IN_IRAM
+#define UART_DMA_ISR_ATTR     IRAM_ATTR
+#define UART_DMA_MALLOC_CAPS  (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#else
+#define UART_DMA_ISR_ATTR
+#define UART_DMA_MALLOC_CAPS  MALLOC_CAP_DEFAULT
+#endif
+
+// DMA descriptors and ring buffers are accessed by the GDMA engine, they always live in internal DMA memory
+#define UART_DMA_DESC_MEM_CAPS  (MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT)
+
+#define UART_DMA_TX_MAX_VECS    8   // upper bound of scatter-gather elements per TX transaction
+
+typedef struct uart_dma_t uart_dma_t;
+
+typedef struct {
+    dma_descriptor_t *descs;   // descriptor chain of this transaction, capacity is `tx_desc_per_trans`
+    const uint8_t *buffer;     // first buffer of the transaction, reported in the tx done event
+    size_t total_size;         // total bytes moved by the transaction
+} uart_dma_tx_trans_t;
+
+struct uart_dma_t {
+    uhci_dev_t *uhci_hw;              // UHCI hardware instance
+    uart_port_t uart_port;            // UART port the UHCI engine is attached to
+    gdma_channel_handle_t tx_chan;    // GDMA TX channel
+    gdma_channel_handle_t rx_chan;    // GDMA RX channel
+    // RX ring
+    dma_descriptor_t *rx_descs;       // circular descriptor chain, one descriptor per ring buffer
+    uint8_t *rx_buf;                  // backing storage of the ring buffers, one slab
+    size_t rx_buffer_count;
+    size_t rx_buffer_size;
+    int rx_cursor;                    // index of the next ring buffer to be consumed, only used in ISR
+    // TX
+    uart_dma_tx_trans_t *trans_pool;  // `tx_queue_depth` preallocated transactions
+    size_t tx_queue_depth;
+    size_t tx_desc_per_trans;         // descriptor capacity of each transaction
+    size_t max_transmit_size;
+    QueueHandle_t tx_free_q;          // transactions ready to be reused (uart_dma_tx_trans_t *)
+    QueueHandle_t tx_pend_q;          // transactions queued behind the one in flight
+    uart_dma_tx_trans_t *tx_cur;      // transaction currently owned by the DMA engine
+    portMUX_TYPE spinlock;
+    uart_dma_event_callbacks_t cbs;
+    void *user_ctx;
+    bool enabled;
+};
+
+// There's only one UHCI engine on the supported targets, so the controller is a singleton
+static portMUX_TYPE s_uart_dma_platform_lock = portMUX_INITIALIZER_UNLOCKED;
+static uart_dma_t *s_uart_dma_ctlr = NULL;
+
+static bool UART_DMA_ISR_ATTR uart_dma_rx_eof_callback(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data)
+{
+    uart_dma_t *ctlr = (uart_dma_t *)user_data;
+    dma_descriptor_t *eof_desc = (dma_descriptor_t *)event_data->rx_eof_desc_addr;
+    bool need_yield = false;
+    dma_descriptor_t *desc;
+    do {
+        desc = &ctlr->rx_descs[ctlr->rx_cursor];
+        if (desc->dw0.owner == DMA_DESCRIPTOR_BUFFER_OWNER_DMA) {
+            // this descriptor (and thus the EOF one) was already handled by a previous event
+            break;
+        }
+        if (ctlr->cbs.on_rx_data) {
+            uart_dma_rx_event_data_t edata = {
+                .data = desc->buffer,
+                .size = desc->dw0.length,
+                .flags.idle_eof = desc->dw0.suc_eof,
+            };
+            need_yield |= ctlr->cbs.on_rx_data(ctlr, &edata, ctlr->user_ctx);
+        }
+        // hand the ring buffer back to the DMA engine
+        desc->dw0.length = 0;
+        desc->dw0.suc_eof = 0;
+        desc->dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+        ctlr->rx_cursor = (ctlr->rx_cursor + 1) % ctlr->rx_buffer_count;
+    } while (desc != eof_desc);
+    // in case the engine stalled on a buffer the CPU still owned (ring overrun), let it move on
+    gdma_append(ctlr->rx_chan);
+    return need_yield;
+}
+
+static bool UART_DMA_ISR_ATTR uart_dma_tx_eof_callback(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data)
+{
+    uart_dma_t *ctlr = (uart_dma_t *)user_data;
+    BaseType_t high_task_woken = pdFALSE;
+    bool need_yield = false;
+    uart_dma_tx_trans_t *finished = NULL;
+    uart_dma_tx_trans_t *next = NULL;
+    portENTER_CRITICAL_ISR(&ctlr->spinlock);
+    finished = ctlr->tx_cur;
+    if (xQueueReceiveFromISR(ctlr->tx_pend_q, &next, &high_task_woken) == pdTRUE) {
+        ctlr->tx_cur = next;
+        gdma_reset(ctlr->tx_chan);
+        gdma_start(ctlr->tx_chan, (intptr_t)next->descs);
+    } else {
+        ctlr->tx_cur = NULL;
+    }
+    portEXIT_CRITICAL_ISR(&ctlr->spinlock);
+    if (finished) {
+        if (ctlr->cbs.on_tx_done) {
+            uart_dma_tx_done_event_data_t edata = {
+                .buffer = finished->buffer,
+                .size = finished->total_size,
+            };
+            need_yield |= ctlr->cbs.on_tx_done(ctlr, &edata, ctlr->user_ctx);
+        }
+        xQueueSendFromISR(ctlr->tx_free_q, &finished, &high_task_woken);
+    }
+    return need_yield || (high_task_woken == pdTRUE);
+}
+
+static void uart_dma_rx_ring_reset(uart_dma_t *ctlr)
+{
+    for (size_t i = 0; i < ctlr->rx_buffer_count; i++) {
+        dma_descriptor_t *desc = &ctlr->rx_descs[i];
+        desc->buffer = ctlr->rx_buf + i * ctlr->rx_buffer_size;
+        desc->dw0.size = ctlr->rx_buffer_size;
+        desc->dw0.length = 0;
+        desc->dw0.suc_eof = 0;
+        desc->dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+        desc->next = &ctlr->rx_descs[(i + 1) % ctlr->rx_buffer_count];
+    }
+    ctlr->rx_cursor = 0;
+}
+
+static void uart_dma_destroy_controller(uart_dma_t *ctlr)
+{
+    if (ctlr->rx_chan) {
+        gdma_disconnect(ctlr->rx_chan);
+        gdma_del_channel(ctlr->rx_chan);
+    }
+    if (ctlr->tx_chan) {
+        gdma_disconnect(ctlr->tx_chan);
+        gdma_del_channel(ctlr->tx_chan);
+    }
+    if (ctlr->tx_free_q) {
+        vQueueDelete(ctlr->tx_free_q);
+    }
+    if (ctlr->tx_pend_q) {
+        vQueueDelete(ctlr->tx_pend_q);
+    }
+    if (ctlr->trans_pool) {
+        for (size_t i = 0; i < ctlr->tx_queue_depth; i++) {
+            if (ctlr->trans_pool[i].descs) {
+                free(ctlr->trans_pool[i].descs);
+            }
+        }
+        free(ctlr->trans_pool);
+    }
+    if (ctlr->rx_descs) {
+        free(ctlr->rx_descs);
+    }
+    if (ctlr->rx_buf) {
+        free(ctlr->rx_buf);
+    }
+    periph_module_disable(PERIPH_UHCI0_MODULE);
+    free(ctlr);
+}
+
+esp_err_t uart_dma_new_controller(const uart_dma_config_t *config, uart_dma_handle_t *ret_handle)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(config && ret_handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    // the UHCI engine can only be attached to the HP UART ports
+    ESP_RETURN_ON_FALSE(config->uart_port >= UART_NUM_0 && config->uart_port < SOC_UART_HP_NUM, ESP_ERR_INVALID_ARG, TAG, "invalid uart port");
+    ESP_RETURN_ON_FALSE(config->rx_buffer_count >= 2, ESP_ERR_INVALID_ARG, TAG, "at least 2 RX ring buffers");
+    ESP_RETURN_ON_FALSE(config->rx_buffer_size && (config->rx_buffer_size % 4) == 0 && config->rx_buffer_size <= DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED,
+                        ESP_ERR_INVALID_ARG, TAG, "invalid RX buffer size");
+    ESP_RETURN_ON_FALSE(config->tx_queue_depth && config->max_transmit_size, ESP_ERR_INVALID_ARG, TAG, "invalid TX queue configuration");
+    ESP_RETURN_ON_FALSE(!uart_is_driver_installed(config->uart_port), ESP_ERR_INVALID_STATE, TAG, "uart driver installed on the port");
+
+    uart_dma_t *ctlr = heap_caps_calloc(1, sizeof(uart_dma_t), UART_DMA_MALLOC_CAPS);
+    ESP_RETURN_ON_FALSE(ctlr, ESP_ERR_NO_MEM, TAG, "no mem for controller");
+
+    // claim the (single) UHCI engine
+    bool claimed = false;
+    portENTER_CRITICAL(&s_uart_dma_platform_lock);
+    if (!s_uart_dma_ctlr) {
+        s_uart_dma_ctlr = ctlr;
+        claimed = true;
+    }
+    portEXIT_CRITICAL(&s_uart_dma_platform_lock);
+    if (!claimed) {
+        free(ctlr);
+        ESP_RETURN_ON_FALSE(false, ESP_ERR_NOT_FOUND, TAG, "UHCI engine occupied");
+    }
+
+    ctlr->uart_port = config->uart_port;
+    ctlr->rx_buffer_count = config->rx_buffer_count;
+    ctlr->rx_buffer_size = config->rx_buffer_size;
+    ctlr->tx_queue_depth = config->tx_queue_depth;
+    ctlr->max_transmit_size = config->max_transmit_size;
+    // worst case: every vector element wastes one partially filled descriptor
+    ctlr->tx_desc_per_trans = (config->max_transmit_size + DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED - 1) / DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED
+                              + UART_DMA_TX_MAX_VECS - 1;
+    ctlr->spinlock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+    ctlr->uhci_hw = UHCI_LL_GET_HW(0);
+
+    periph_module_enable(PERIPH_UHCI0_MODULE);
+    periph_module_reset(PERIPH_UHCI0_MODULE);
+    uhci_ll_init(ctlr->uhci_hw);
+    uhci_ll_attach_uart_port(ctlr->uhci_hw, config->uart_port);
+    // plain byte stream: no separator character escaping in either direction
+    uhci_seper_chr_t seper_chr = {
+        .sub_chr_en = 0,
+    };
+    uhci_ll_set_seper_chr(ctlr->uhci_hw, &seper_chr);
+    // close an RX descriptor when the line goes idle, so one DMA buffer carries one frame
+    uhci_ll_set_eof_mode(ctlr->uhci_hw, UHCI_RX_IDLE_EOF);
+
+    // allocate the GDMA channels on the same pair and bind them to the UHCI engine
+    gdma_channel_alloc_config_t tx_alloc_config = {
+        .direction = GDMA_CHANNEL_DIRECTION_TX,
+        .flags.reserve_sibling = 1,
+    };
+    ESP_GOTO_ON_ERROR(gdma_new_ahb_channel(&tx_alloc_config, &ctlr->tx_chan), err, TAG, "alloc TX DMA channel failed");
+    gdma_channel_alloc_config_t rx_alloc_config = {
+        .direction = GDMA_CHANNEL_DIRECTION_RX,
+        .sibling_chan = ctlr->tx_chan,
+    };
+    ESP_GOTO_ON_ERROR(gdma_new_ahb_channel(&rx_alloc_config, &ctlr->rx_chan), err, TAG, "alloc RX DMA channel failed");
+    ESP_GOTO_ON_ERROR(gdma_connect(ctlr->tx_chan, GDMA_MAKE_TRIGGER(GDMA_TRIG_PERIPH_UHCI, 0)), err, TAG, "connect TX DMA channel failed");
+    ESP_GOTO_ON_ERROR(gdma_connect(ctlr->rx_chan, GDMA_MAKE_TRIGGER(GDMA_TRIG_PERIPH_UHCI, 0)), err, TAG, "connect RX DMA channel failed");
+
+    gdma_transfer_config_t transfer_config = {
+        .max_data_burst_size = config->dma_burst_size,
+        .access_ext_mem = false,
+    };
+    ESP_GOTO_ON_ERROR(gdma_config_transfer(ctlr->tx_chan, &transfer_config), err, TAG, "config TX DMA transfer failed");
+    ESP_GOTO_ON_ERROR(gdma_config_transfer(ctlr->rx_chan, &transfer_config), err, TAG, "config RX DMA transfer failed");
+    gdma_strategy_config_t tx_strategy = {
+        .owner_check = true,
+        .auto_update_desc = true,
+        // report the TX EOF only when the data left the DMA FIFO, so the buffers can be recycled right away
+        .eof_till_data_popped = true,
+    };
+    ESP_GOTO_ON_ERROR(gdma_apply_strategy(ctlr->tx_chan, &tx_strategy), err, TAG, "apply TX DMA strategy failed");
+    gdma_strategy_config_t rx_strategy = {
+        .owner_check = true,
+    };
+    ESP_GOTO_ON_ERROR(gdma_apply_strategy(ctlr->rx_chan, &rx_strategy), err, TAG, "apply RX DMA strategy failed");
+    gdma_tx_event_callbacks_t tx_cbs = {
+        .on_trans_eof = uart_dma_tx_eof_callback,
+    };
+    ESP_GOTO_ON_ERROR(gdma_register_tx_event_callbacks(ctlr->tx_chan, &tx_cbs, ctlr), err, TAG, "register TX DMA callbacks failed");
+    gdma_rx_event_callbacks_t rx_cbs = {
+        .on_recv_eof = uart_dma_rx_eof_callback,
+    };
+    ESP_GOTO_ON_ERROR(gdma_register_rx_event_callbacks(ctlr->rx_chan, &rx_cbs, ctlr), err, TAG, "register RX DMA callbacks failed");
+
+    // RX ring: one descriptor per buffer, backed by a single slab
+    ctlr->rx_descs = heap_caps_calloc(config->rx_buffer_count, sizeof(dma_descriptor_t), UART_DMA_DESC_MEM_CAPS);
+    ESP_GOTO_ON_FALSE(ctlr->rx_descs, ESP_ERR_NO_MEM, err, TAG, "no mem for RX descriptors");
+    ctlr->rx_buf = heap_caps_calloc(1, config->rx_buffer_count * config->rx_buffer_size, UART_DMA_DESC_MEM_CAPS);
+    ESP_GOTO_ON_FALSE(ctlr->rx_buf, ESP_ERR_NO_MEM, err, TAG, "no mem for RX ring buffers");
+
+    // TX transaction pool and queues
+    ctlr->trans_pool = heap_caps_calloc(config->tx_queue_depth, sizeof(uart_dma_tx_trans_t), UART_DMA_MALLOC_CAPS);
+    ESP_GOTO_ON_FALSE(ctlr->trans_pool, ESP_ERR_NO_MEM, err, TAG, "no mem for TX transactions");
+    for (size_t i = 0; i < config->tx_queue_depth; i++) {
+        ctlr->trans_pool[i].descs = heap_caps_calloc(ctlr->tx_desc_per_trans, sizeof(dma_descriptor_t), UART_DMA_DESC_MEM_CAPS);
+        ESP_GOTO_ON_FALSE(ctlr->trans_pool[i].descs, ESP_ERR_NO_MEM, err, TAG, "no mem for TX descriptors");
+    }
+    ctlr->tx_free_q = xQueueCreate(config->tx_queue_depth, sizeof(uart_dma_tx_trans_t *));
+    ctlr->tx_pend_q = xQueueCreate(config->tx_queue_depth, sizeof(uart_dma_tx_trans_t *));
+    ESP_GOTO_ON_FALSE(ctlr->tx_free_q && ctlr->tx_pend_q, ESP_ERR_NO_MEM, err, TAG, "no mem for TX queues");
+    for (size_t i = 0; i < config->tx_queue_depth; i++) {
+        uart_dma_tx_trans_t *trans = &ctlr->trans_pool[i];
+        xQueueSend(ctlr->tx_free_q, &trans, 0);
+    }
+
+    *ret_handle = ctlr;
+    return ESP_OK;
+
+err:
+    uart_dma_destroy_controller(ctlr);
+    s_uart_dma_ctlr = NULL;
+    return ret;
+}
+
+esp_err_t uart_dma_register_event_callbacks(uart_dma_handle_t handle, const uart_dma_event_callbacks_t *cbs, void *user_ctx)
+{
+    ESP_RETURN_ON_FALSE(handle && cbs, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(!handle->enabled, ESP_ERR_INVALID_STATE, TAG, "controller already enabled");
+#if CONFIG_UART_ISR_IN_IRAM
+    if (cbs->on_rx_data) {
+        ESP_RETURN_ON_FALSE(esp_ptr_in_iram(cbs->on_rx_data), ESP_ERR_INVALID_ARG, TAG, "on_rx_data callback not in IRAM");
+    }
+    if (cbs->on_tx_done) {
+        ESP_RETURN_ON_FALSE(esp_ptr_in_iram(cbs->on_tx_done), ESP_ERR_INVALID_ARG, TAG, "on_tx_done callback not in IRAM");
+    }
+#endif
+    handle->cbs = *cbs;
+    handle->user_ctx = user_ctx;
+    return ESP_OK;
+}
+
+esp_err_t uart_dma_enable(uart_dma_handle_t handle)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(!handle->enabled, ESP_ERR_INVALID_STATE, TAG, "controller already enabled");
+    uart_dma_rx_ring_reset(handle);
+    gdma_reset(handle->rx_chan);
+    ESP_RETURN_ON_ERROR(gdma_start(handle->rx_chan, (intptr_t)handle->rx_descs), TAG, "start RX DMA failed");
+    handle->enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t uart_dma_disable(uart_dma_handle_t handle)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(handle->enabled, ESP_ERR_INVALID_STATE, TAG, "controller not enabled");
+    gdma_stop(handle->tx_chan);
+    gdma_stop(handle->rx_chan);
+    // recycle the in-flight and the pending TX transactions, their data is dropped
+    portENTER_CRITICAL(&handle->spinlock);
+    uart_dma_tx_trans_t *trans = handle->tx_cur;
+    handle->tx_cur = NULL;
+    portEXIT_CRITICAL(&handle->spinlock);
+    if (trans) {
+        xQueueSend(handle->tx_free_q, &trans, 0);
+    }
+    while (xQueueReceive(handle->tx_pend_q, &trans, 0) == pdTRUE) {
+        xQueueSend(handle->tx_free_q, &trans, 0);
+    }
+    handle->enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t uart_dma_transmit_vectored(uart_dma_handle_t handle, const uart_dma_tx_vec_t *vec, size_t num_vec)
+{
+    ESP_RETURN_ON_FALSE(handle && vec && num_vec && num_vec <= UART_DMA_TX_MAX_VECS, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(handle->enabled, ESP_ERR_INVALID_STATE, TAG, "controller not enabled");
+    size_t total_size = 0;
+    for (size_t i = 0; i < num_vec; i++) {
+        ESP_RETURN_ON_FALSE(vec[i].buffer && vec[i].size, ESP_ERR_INVALID_ARG, TAG, "invalid vector element");
+        ESP_RETURN_ON_FALSE(esp_ptr_dma_capable(vec[i].buffer), ESP_ERR_INVALID_ARG, TAG, "TX buffer not DMA capable");
+        total_size += vec[i].size;
+    }
+    ESP_RETURN_ON_FALSE(total_size <= handle->max_transmit_size, ESP_ERR_INVALID_ARG, TAG, "transaction exceeds max_transmit_size");
+    uart_dma_tx_trans_t *trans = NULL;
+    ESP_RETURN_ON_FALSE(xQueueReceive(handle->tx_free_q, &trans, 0) == pdTRUE, ESP_ERR_INVALID_STATE, TAG, "TX queue full");
+
+    // chop the vectors into one descriptor chain; `total_size <= max_transmit_size` together with
+    // `num_vec <= UART_DMA_TX_MAX_VECS` guarantees the chain fits into `tx_desc_per_trans`
+    dma_descriptor_t *desc = trans->descs;
+    for (size_t i = 0; i < num_vec; i++) {
+        const uint8_t *buf = vec[i].buffer;
+        size_t remain = vec[i].size;
+        while (remain) {
+            size_t len = MIN(remain, DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED);
+            desc->buffer = (void *)buf;
+            desc->dw0.size = len;
+            desc->dw0.length = len;
+            desc->dw0.suc_eof = 0;
+            desc->dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+            desc->next = desc + 1;
+            buf += len;
+            remain -= len;
+            desc++;
+        }
+    }
+    desc[-1].dw0.suc_eof = 1;
+    desc[-1].next = NULL;
+    trans->buffer = vec[0].buffer;
+    trans->total_size = total_size;
+
+    portENTER_CRITICAL(&handle->spinlock);
+    if (handle->tx_cur) {
+        // the TX EOF ISR picks it up; the send can't fail because the transaction
+        // itself came from the free pool of the same depth
+        xQueueSend(handle->tx_pend_q, &trans, 0);
+    } else {
+        handle->tx_cur = trans;
+        gdma_reset(handle->tx_chan);
+        gdma_start(handle->tx_chan, (intptr_t)trans->descs);
+    }
+    portEXIT_CRITICAL(&handle->spinlock);
+    return ESP_OK;
+}
+
+esp_err_t uart_dma_transmit(uart_dma_handle_t handle, const void *buffer, size_t size)
+{
+    uart_dma_tx_vec_t vec = {
+        .buffer = buffer,
+        .size = size,
+    };
+    return uart_dma_transmit_vectored(handle, &vec, 1);
+}
+
+esp_err_t uart_dma_del_controller(uart_dma_handle_t handle)
+{
+    ESP_RETURN_ON_FALSE(handle, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(!handle->enabled, ESP_ERR_INVALID_STATE, TAG, "controller still enabled");
+    uart_dma_destroy_controller(handle);
+    portENTER_CRITICAL(&s_uart_dma_platform_lock);
+    s_uart_dma_ctlr = NULL;
+    portEXIT_CRITICAL(&s_uart_dma_platform_lock);
+    return ESP_OK;
+}
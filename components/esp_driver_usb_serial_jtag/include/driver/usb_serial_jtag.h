@@ -91,6 +91,91 @@ esp_err_t usb_serial_jtag_wait_tx_done(TickType_t ticks_to_wait);
  */
 esp_err_t usb_serial_jtag_driver_uninstall(void);
 
+/**
+ * @brief Callback invoked from the ISR when the free space in the zero-copy TX ring
+ *        rises above the configured watermark
+ *
+ * @param arg        User argument passed to usb_serial_jtag_tx_ring_install()
+ * @param task_woken Set to pdTRUE if the callback unblocked a higher-priority task
+ */
+typedef void (*usb_serial_jtag_tx_ring_space_cb_t)(void *arg, BaseType_t *task_woken);
+
+/**
+ * @brief Install a zero-copy TX ring on top of the USB-SERIAL-JTAG driver
+ *
+ * The zero-copy TX path avoids the copy into the driver's TX ring buffer that
+ * usb_serial_jtag_write_bytes() performs: the application acquires a contiguous
+ * segment of the ring with usb_serial_jtag_tx_ring_acquire(), produces data
+ * directly into it, and commits it with usb_serial_jtag_tx_ring_commit(). The
+ * ISR then feeds the TX FIFO straight from the ring memory. This is intended
+ * for high-rate streaming (e.g. telemetry) where the per-byte copy cost of the
+ * regular write path matters.
+ *
+ * Data committed to the zero-copy ring is sent after any data queued with
+ * usb_serial_jtag_write_bytes(). The ring supports a single producer task;
+ * concurrent acquire/commit calls from multiple tasks must be serialized by
+ * the caller.
+ *
+ * @param ring_size Size of the ring in bytes, must be larger than 64. One byte
+ *                  of the ring is reserved for bookkeeping.
+ * @param watermark Free-space threshold (in bytes) above which the callback is
+ *                  invoked, or 0 to disable the callback
+ * @param space_cb  Callback invoked from the ISR when free space crosses the
+ *                  watermark from below, or NULL
+ * @param cb_arg    User argument for the callback
+ *
+ * @return
+ *     - ESP_OK                Success
+ *     - ESP_ERR_INVALID_STATE Driver not installed, or a TX ring is already installed
+ *     - ESP_ERR_INVALID_ARG   Invalid ring size or watermark
+ *     - ESP_ERR_NO_MEM        Ring allocation failed
+ */
+esp_err_t usb_serial_jtag_tx_ring_install(size_t ring_size, size_t watermark, usb_serial_jtag_tx_ring_space_cb_t space_cb, void *cb_arg);
+
+/**
+ * @brief Uninstall the zero-copy TX ring
+ *
+ * Any data committed but not yet sent is discarded.
+ *
+ * @return
+ *     - ESP_OK                Success
+ *     - ESP_ERR_INVALID_STATE No TX ring installed
+ */
+esp_err_t usb_serial_jtag_tx_ring_uninstall(void);
+
+/**
+ * @brief Acquire a contiguous segment of the zero-copy TX ring to write into
+ *
+ * Returns a pointer to the largest contiguous free segment of the ring, capped
+ * at max_size. The returned size can be smaller than max_size (including 0 when
+ * the ring is full); the caller writes up to that many bytes into the segment
+ * and then commits them with usb_serial_jtag_tx_ring_commit(). This function
+ * does not block; use the watermark callback to wait for space.
+ *
+ * @param[out] out_seg  Pointer to the start of the writable segment
+ * @param[out] out_size Number of bytes that can be written to the segment
+ * @param max_size      Maximum segment size the caller is interested in
+ *
+ * @return
+ *     - ESP_OK                Success
+ *     - ESP_ERR_INVALID_STATE No TX ring installed
+ *     - ESP_ERR_INVALID_ARG   out_seg or out_size is NULL
+ */
+esp_err_t usb_serial_jtag_tx_ring_acquire(void **out_seg, size_t *out_size, size_t max_size);
+
+/**
+ * @brief Commit bytes written to a previously acquired segment for transmission
+ *
+ * @param size Number of bytes written to the segment, must not exceed the size
+ *             returned by usb_serial_jtag_tx_ring_acquire()
+ *
+ * @return
+ *     - ESP_OK                Success
+ *     - ESP_ERR_INVALID_STATE No TX ring installed
+ *     - ESP_ERR_INVALID_ARG   size exceeds the acquired segment
+ */
+esp_err_t usb_serial_jtag_tx_ring_commit(size_t size);
+
 /**
  * @brief Check if the USB Serial/JTAG port is connected to the host
  *
@@ -36,6 +36,17 @@
 #define USB_SER_JTAG_ENDP_SIZE          (64)
 #define USB_SER_JTAG_RX_MAX_SIZE        (USB_SER_JTAG_ENDP_SIZE)
 
+typedef struct {
+    uint8_t *buf;                       /*!< Ring memory, NULL if no zero-copy TX ring is installed */
+    size_t size;                        /*!< Ring size in bytes; one byte is kept free to tell full from empty */
+    volatile size_t head;               /*!< Next byte to be written by the producer. Only advanced by commit */
+    volatile size_t tail;               /*!< Next byte to be sent. Only advanced by the ISR */
+    size_t acquired;                    /*!< Size of the currently acquired (not yet committed) segment */
+    size_t watermark;                   /*!< Free-space threshold for the space callback, 0 if disabled */
+    usb_serial_jtag_tx_ring_space_cb_t space_cb;   /*!< Callback invoked when free space crosses the watermark */
+    void *space_cb_arg;                 /*!< User argument for space_cb */
+} usb_serial_jtag_tx_ring_t;
+
 typedef struct {
     intr_handle_t intr_handle;          /*!< USB-SERIAL-JTAG interrupt handler */
 
@@ -46,6 +57,7 @@ typedef struct {
     RingbufHandle_t tx_ring_buf;        /*!< TX ring buffer handler */
     uint8_t tx_stash_buf[USB_SER_JTAG_ENDP_SIZE];  /*!< Data buffer to stash TX FIFO data */
     size_t tx_stash_cnt;                           /*!< Number of stashed TX FIFO bytes */
+    usb_serial_jtag_tx_ring_t tx_zc_ring;          /*!< Optional zero-copy TX ring */
 
     //Synchronization stuff, only used for flush for now
     SemaphoreHandle_t tx_mux;
@@ -58,6 +70,12 @@ static usb_serial_jtag_obj_t *p_usb_serial_jtag_obj = NULL;
 
 static const char* USB_SERIAL_JTAG_TAG = "usb_serial_jtag";
 
+// Number of bytes committed to the zero-copy TX ring but not yet sent
+static inline size_t usb_serial_jtag_tx_ring_used(const usb_serial_jtag_tx_ring_t *ring)
+{
+    return (ring->head - ring->tail + ring->size) % ring->size;
+}
+
 static void usb_serial_jtag_isr_handler_default(void *arg)
 {
     BaseType_t xTaskWoken = 0;
@@ -74,9 +92,11 @@ static void usb_serial_jtag_isr_handler_default(void *arg)
         // (ROM print routines?) have snuck in a full buffer before we got here. In that case,
         // we simply ignore the interrupt, a new one will come if the buffer is empty again.
         if (usb_serial_jtag_ll_txfifo_writable() == 1) {
-            // Retrieve data from either the stash buffer or, if that's empty, from the ring buffer.
-            size_t queued_size;
+            // Retrieve data from the stash buffer or, if that's empty, from the ring buffer or,
+            // if that's also empty, from the zero-copy TX ring.
+            size_t queued_size = 0;
             uint8_t *queued_buf = NULL;
+            bool from_zc_ring = false;
             if (p_usb_serial_jtag_obj->tx_stash_cnt != 0) {
                 // Send stashed tx bytes before reading bytes from ring buffer
                 queued_buf = p_usb_serial_jtag_obj->tx_stash_buf;
@@ -84,6 +104,17 @@ static void usb_serial_jtag_isr_handler_default(void *arg)
             } else {
                 // Max 64 data payload size in a single EndPoint
                 queued_buf = (uint8_t *)xRingbufferReceiveUpToFromISR(p_usb_serial_jtag_obj->tx_ring_buf, &queued_size, USB_SER_JTAG_ENDP_SIZE);
+                if (queued_buf == NULL && p_usb_serial_jtag_obj->tx_zc_ring.buf != NULL) {
+                    // Transmit directly from the zero-copy ring memory; no copy, no item to return.
+                    usb_serial_jtag_tx_ring_t *ring = &p_usb_serial_jtag_obj->tx_zc_ring;
+                    size_t head = ring->head;
+                    if (head != ring->tail) {
+                        size_t contig = (head > ring->tail) ? (head - ring->tail) : (ring->size - ring->tail);
+                        queued_size = (contig > USB_SER_JTAG_ENDP_SIZE) ? USB_SER_JTAG_ENDP_SIZE : contig;
+                        queued_buf = &ring->buf[ring->tail];
+                        from_zc_ring = true;
+                    }
+                }
             }
 
             if (queued_buf != NULL && queued_size > 0) {
@@ -91,26 +122,37 @@ static void usb_serial_jtag_isr_handler_default(void *arg)
                 uint32_t sent_size = usb_serial_jtag_ll_write_txfifo(queued_buf, queued_size);
                 usb_serial_jtag_ll_txfifo_flush();
 
-                // Check if we were able to send everything.
-                if (sent_size < queued_size) {
-                    // Not all bytes could be sent at once; stash the unwritten bytes in a buffer
-                    // This will happen if e.g. the rom output functions manage to sneak a few bytes into the
-                    // TX FIFO before this interrupt triggers. Note stash_size will not larger than
-                    // USB_SER_JTAG_ENDP_SIZE because queued_size is obtained from xRingbufferReceiveUpToFromISR.
-                    size_t stash_size = queued_size - sent_size;
-                    memcpy(p_usb_serial_jtag_obj->tx_stash_buf, &queued_buf[sent_size], stash_size);
-                    p_usb_serial_jtag_obj->tx_stash_cnt = stash_size;
+                if (from_zc_ring) {
+                    // Unsent bytes simply stay in the ring; just advance the tail past what was sent.
+                    usb_serial_jtag_tx_ring_t *ring = &p_usb_serial_jtag_obj->tx_zc_ring;
+                    size_t free_before = ring->size - 1 - usb_serial_jtag_tx_ring_used(ring);
+                    ring->tail = (ring->tail + sent_size) % ring->size;
+                    if (ring->space_cb != NULL && ring->watermark != 0 &&
+                            free_before < ring->watermark && free_before + sent_size >= ring->watermark) {
+                        ring->space_cb(ring->space_cb_arg, &xTaskWoken);
+                    }
                 } else {
-                    p_usb_serial_jtag_obj->tx_stash_cnt = 0;
-                }
-                // Return the buffer if we got it from the ring buffer.
-                if (queued_buf != p_usb_serial_jtag_obj->tx_stash_buf) {
-                    vRingbufferReturnItemFromISR(p_usb_serial_jtag_obj->tx_ring_buf, queued_buf, &xTaskWoken);
-
-                    // We just moved items out of the TX ring buffer, the driver is considered write ready, since
-                    // the TX ring buffer is assured to be not full.
-                    if (p_usb_serial_jtag_obj->usj_select_notif_callback) {
-                        p_usb_serial_jtag_obj->usj_select_notif_callback(USJ_SELECT_WRITE_NOTIF, &xTaskWoken);
+                    // Check if we were able to send everything.
+                    if (sent_size < queued_size) {
+                        // Not all bytes could be sent at once; stash the unwritten bytes in a buffer
+                        // This will happen if e.g. the rom output functions manage to sneak a few bytes into the
+                        // TX FIFO before this interrupt triggers. Note stash_size will not larger than
+                        // USB_SER_JTAG_ENDP_SIZE because queued_size is obtained from xRingbufferReceiveUpToFromISR.
+                        size_t stash_size = queued_size - sent_size;
+                        memcpy(p_usb_serial_jtag_obj->tx_stash_buf, &queued_buf[sent_size], stash_size);
+                        p_usb_serial_jtag_obj->tx_stash_cnt = stash_size;
+                    } else {
+                        p_usb_serial_jtag_obj->tx_stash_cnt = 0;
+                    }
+                    // Return the buffer if we got it from the ring buffer.
+                    if (queued_buf != p_usb_serial_jtag_obj->tx_stash_buf) {
+                        vRingbufferReturnItemFromISR(p_usb_serial_jtag_obj->tx_ring_buf, queued_buf, &xTaskWoken);
+
+                        // We just moved items out of the TX ring buffer, the driver is considered write ready, since
+                        // the TX ring buffer is assured to be not full.
+                        if (p_usb_serial_jtag_obj->usj_select_notif_callback) {
+                            p_usb_serial_jtag_obj->usj_select_notif_callback(USJ_SELECT_WRITE_NOTIF, &xTaskWoken);
+                        }
                     }
                 }
             } else {
@@ -130,6 +172,9 @@ static void usb_serial_jtag_isr_handler_default(void *arg)
                 // transmitted anymore. Check for that case.
                 UBaseType_t bytes_waiting;
                 vRingbufferGetInfo(p_usb_serial_jtag_obj->tx_ring_buf, NULL, NULL, NULL, NULL, &bytes_waiting);
+                if (p_usb_serial_jtag_obj->tx_zc_ring.buf != NULL) {
+                    bytes_waiting += usb_serial_jtag_tx_ring_used(&p_usb_serial_jtag_obj->tx_zc_ring);
+                }
                 if (bytes_waiting) {
                     // Uh-oh, it happened. Re-enable interrupts so we can process the data the next run.
                     usb_serial_jtag_ll_ena_intr_mask(USB_SERIAL_JTAG_INTR_SERIAL_IN_EMPTY);
@@ -318,6 +363,91 @@ esp_err_t usb_serial_jtag_wait_tx_done(TickType_t ticks_to_wait)
     return r ? ESP_OK : ESP_ERR_TIMEOUT;
 }
 
+esp_err_t usb_serial_jtag_tx_ring_install(size_t ring_size, size_t watermark, usb_serial_jtag_tx_ring_space_cb_t space_cb, void *cb_arg)
+{
+    ESP_RETURN_ON_FALSE(p_usb_serial_jtag_obj != NULL, ESP_ERR_INVALID_STATE, USB_SERIAL_JTAG_TAG, "The driver hasn't been initialized");
+    ESP_RETURN_ON_FALSE(p_usb_serial_jtag_obj->tx_zc_ring.buf == NULL, ESP_ERR_INVALID_STATE, USB_SERIAL_JTAG_TAG, "TX ring already installed");
+    ESP_RETURN_ON_FALSE(ring_size > USB_SER_JTAG_ENDP_SIZE, ESP_ERR_INVALID_ARG, USB_SERIAL_JTAG_TAG, "ring size should be larger than 64");
+    ESP_RETURN_ON_FALSE(watermark < ring_size, ESP_ERR_INVALID_ARG, USB_SERIAL_JTAG_TAG, "watermark should be smaller than the ring size");
+
+    usb_serial_jtag_tx_ring_t *ring = &p_usb_serial_jtag_obj->tx_zc_ring;
+    uint8_t *buf = heap_caps_malloc(ring_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_RETURN_ON_FALSE(buf != NULL, ESP_ERR_NO_MEM, USB_SERIAL_JTAG_TAG, "no memory for TX ring");
+    ring->size = ring_size;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->acquired = 0;
+    ring->watermark = watermark;
+    ring->space_cb = space_cb;
+    ring->space_cb_arg = cb_arg;
+    // Publish the buffer last; the ISR uses it as the "ring installed" flag.
+    ring->buf = buf;
+    return ESP_OK;
+}
+
+esp_err_t usb_serial_jtag_tx_ring_uninstall(void)
+{
+    ESP_RETURN_ON_FALSE(p_usb_serial_jtag_obj != NULL && p_usb_serial_jtag_obj->tx_zc_ring.buf != NULL,
+                        ESP_ERR_INVALID_STATE, USB_SERIAL_JTAG_TAG, "No TX ring installed");
+    usb_serial_jtag_tx_ring_t *ring = &p_usb_serial_jtag_obj->tx_zc_ring;
+    uint8_t *buf = ring->buf;
+    // Unpublish the buffer first so the ISR stops looking at the ring, then free the memory.
+    ring->buf = NULL;
+    ring->head = 0;
+    ring->tail = 0;
+    heap_caps_free(buf);
+    return ESP_OK;
+}
+
+esp_err_t usb_serial_jtag_tx_ring_acquire(void **out_seg, size_t *out_size, size_t max_size)
+{
+    ESP_RETURN_ON_FALSE(out_seg != NULL && out_size != NULL, ESP_ERR_INVALID_ARG, USB_SERIAL_JTAG_TAG, "Invalid argument");
+    ESP_RETURN_ON_FALSE(p_usb_serial_jtag_obj != NULL && p_usb_serial_jtag_obj->tx_zc_ring.buf != NULL,
+                        ESP_ERR_INVALID_STATE, USB_SERIAL_JTAG_TAG, "No TX ring installed");
+
+    usb_serial_jtag_tx_ring_t *ring = &p_usb_serial_jtag_obj->tx_zc_ring;
+    size_t head = ring->head;
+    size_t tail = ring->tail;
+    // Contiguous free space at the head. One byte of the ring stays unused so that
+    // head == tail always means "empty".
+    size_t contig;
+    if (tail > head) {
+        contig = tail - head - 1;
+    } else {
+        contig = ring->size - head;
+        if (tail == 0) {
+            contig -= 1;
+        }
+    }
+    if (contig > max_size) {
+        contig = max_size;
+    }
+    ring->acquired = contig;
+    *out_seg = &ring->buf[head];
+    *out_size = contig;
+    return ESP_OK;
+}
+
+esp_err_t usb_serial_jtag_tx_ring_commit(size_t size)
+{
+    ESP_RETURN_ON_FALSE(p_usb_serial_jtag_obj != NULL && p_usb_serial_jtag_obj->tx_zc_ring.buf != NULL,
+                        ESP_ERR_INVALID_STATE, USB_SERIAL_JTAG_TAG, "No TX ring installed");
+    usb_serial_jtag_tx_ring_t *ring = &p_usb_serial_jtag_obj->tx_zc_ring;
+    ESP_RETURN_ON_FALSE(size <= ring->acquired, ESP_ERR_INVALID_ARG, USB_SERIAL_JTAG_TAG, "commit exceeds acquired segment");
+    if (size == 0) {
+        ring->acquired = 0;
+        return ESP_OK;
+    }
+    ring->acquired = 0;
+    ring->head = (ring->head + size) % ring->size;
+
+    // Mark TX as not idle so the flush function knows to wait (see usb_serial_jtag_write_bytes)
+    xSemaphoreTake(p_usb_serial_jtag_obj->tx_idle_sem, 0);
+    // Re-enable the TX interrupt so the ISR starts draining the ring
+    usb_serial_jtag_ll_ena_intr_mask(USB_SERIAL_JTAG_INTR_SERIAL_IN_EMPTY);
+    return ESP_OK;
+}
+
 //Note that this is also called when usb_serial_jtag_driver_install errors out and as such should
 //work on a half-initialized driver as well.
 esp_err_t usb_serial_jtag_driver_uninstall(void)
@@ -342,6 +472,10 @@ esp_err_t usb_serial_jtag_driver_uninstall(void)
         vRingbufferDelete(p_usb_serial_jtag_obj->tx_ring_buf);
         p_usb_serial_jtag_obj->tx_ring_buf = NULL;
     }
+    if (p_usb_serial_jtag_obj->tx_zc_ring.buf) {
+        heap_caps_free(p_usb_serial_jtag_obj->tx_zc_ring.buf);
+        p_usb_serial_jtag_obj->tx_zc_ring.buf = NULL;
+    }
     if (p_usb_serial_jtag_obj->tx_idle_sem) {
         vSemaphoreDelete(p_usb_serial_jtag_obj->tx_idle_sem);
         p_usb_serial_jtag_obj->tx_idle_sem  = NULL;
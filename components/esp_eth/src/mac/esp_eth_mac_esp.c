@@ -364,6 +364,14 @@ static void emac_esp32_rx_task(void *arg)
             } else if ((emac->free_rx_descriptor > emac->flow_control_high_water_mark) || !emac->frames_remain) {
                 emac_hal_send_pause_frame(&emac->hal, false);
             }
+#endif
+#if CONFIG_ETH_EMAC_RX_INTR_MITIGATION
+            if (!emac->frames_remain) {
+                /* ring drained: unmask the RX interrupt first, then look once more
+                   to close the race against frames that landed in between */
+                emac_hal_enable_corresponding_intr(&emac->hal, EMAC_LL_INTR_RECEIVE_ENABLE);
+                emac_esp_dma_get_remain_frames(emac->emac_dma_hndl, &emac->frames_remain, &emac->free_rx_descriptor);
+            }
 #endif
         } while (emac->frames_remain);
     }
@@ -430,6 +438,10 @@ static esp_err_t emac_esp32_init(esp_eth_mac_t *mac)
     /* init dma registers with selected EMAC-DMA configuration */
     emac_hal_dma_config_t dma_config = { .dma_burst_len = emac->dma_burst_len };
     emac_hal_init_dma_default(&emac->hal, &dma_config);
+#if CONFIG_ETH_EMAC_CHECKSUM_OFFLOAD
+    /* let the checksum engine insert IP header and TCP/UDP/ICMP checksums (incl. pseudo-header) on transmit */
+    emac_esp_dma_set_tdes0_ctrl_bits(emac->emac_dma_hndl, EMAC_HAL_TDES0_IP_CRC_INSERT_HDR_PAYLOAD_PSEUDO);
+#endif
     /* get emac address from efuse */
     ESP_GOTO_ON_ERROR(esp_read_mac(emac->addr, ESP_MAC_ETH), err, TAG, "fetch ethernet mac address failed");
     /* set MAC address to emac register */
@@ -503,6 +515,10 @@ IRAM_ATTR void emac_isr_default_handler(void *args)
     if (intr_stat & EMAC_LL_DMA_RECEIVE_FINISH_INTR) {
         emac_esp32_t *emac = __containerof(hal, emac_esp32_t, hal);
         BaseType_t high_task_wakeup = pdFALSE;
+#if CONFIG_ETH_EMAC_RX_INTR_MITIGATION
+        /* mask RX interrupts until the receive task has drained the ring */
+        emac_hal_disable_corresponding_intr(hal, EMAC_LL_INTR_RECEIVE_ENABLE);
+#endif
         /* notify receive task */
         vTaskNotifyGiveFromISR(emac->rx_task_hdl, &high_task_wakeup);
         if (high_task_wakeup == pdTRUE) {
@@ -293,6 +293,16 @@ static esp_err_t emac_esp_dma_get_valid_recv_len(emac_esp_dma_handle_t emac_esp_
                 *ret_len = 0;
                 return ESP_FAIL;
             }
+#if CONFIG_ETH_EMAC_CHECKSUM_OFFLOAD
+            /* The Rx FIFO runs in threshold mode so the DMA cannot drop frames the checksum
+               engine flagged as invalid - filter them here. Timestamping is not enabled by
+               this driver, so the bit unambiguously reports a checksum error or giant frame. */
+            if (desc_iter->RDES0.TSAvailIPChecksumErrGiantFrame) {
+                emac_esp_dma_flush_recv_frame(emac_esp_dma);
+                *ret_len = 0;
+                return ESP_FAIL;
+            }
+#endif
             /* Get the Frame Length of the received packet: substruct 4 bytes of the CRC */
             *ret_len = desc_iter->RDES0.FrameLength - ETH_CRC_LENGTH;
             break;
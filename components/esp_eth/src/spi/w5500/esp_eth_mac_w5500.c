@@ -6,6 +6,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <sys/cdefs.h>
+#include <sys/param.h>
 #include <inttypes.h>
 #include "esp_eth_mac_spi.h"
 #include "driver/gpio.h"
@@ -64,6 +65,12 @@ typedef struct {
     uint8_t addr[6];
     bool packets_remain;
     uint8_t *rx_buffer;
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+    uint8_t *burst_buffer;
+    uint16_t tx_wr_offset;
+    bool tx_wr_valid;
+    bool tx_in_flight;
+#endif
 } emac_w5500_t;
 
 static void *w5500_spi_init(const void *spi_config)
@@ -374,6 +381,11 @@ static esp_err_t emac_w5500_start(esp_eth_mac_t *mac)
     uint8_t reg_value = 0;
     /* open SOCK0 */
     ESP_GOTO_ON_ERROR(w5500_send_command(emac, W5500_SCR_OPEN, 100), err, TAG, "issue OPEN command failed");
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+    /* opening the socket reset the buffer pointers */
+    emac->tx_wr_valid = false;
+    emac->tx_in_flight = false;
+#endif
     /* enable interrupt for SOCK0 */
     reg_value = W5500_SIMR_SOCK0;
     ESP_GOTO_ON_ERROR(w5500_write(emac, W5500_REG_SIMR, &reg_value, sizeof(reg_value)), err, TAG, "write SIMR failed");
@@ -391,6 +403,10 @@ static esp_err_t emac_w5500_stop(esp_eth_mac_t *mac)
     ESP_GOTO_ON_ERROR(w5500_write(emac, W5500_REG_SIMR, &reg_value, sizeof(reg_value)), err, TAG, "write SIMR failed");
     /* close SOCK0 */
     ESP_GOTO_ON_ERROR(w5500_send_command(emac, W5500_SCR_CLOSE, 100), err, TAG, "issue CLOSE command failed");
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+    emac->tx_wr_valid = false;
+    emac->tx_in_flight = false;
+#endif
 
 err:
     return ret;
@@ -564,6 +580,32 @@ static inline bool is_w5500_sane_for_rxtx(emac_w5500_t *emac)
    return false;
 }
 
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+// Wait for the previously issued SEND command to finish and clear its event bit
+static esp_err_t emac_w5500_finish_pending_send(emac_w5500_t *emac)
+{
+    esp_err_t ret = ESP_OK;
+    if (!emac->tx_in_flight) {
+        return ESP_OK;
+    }
+    emac->tx_in_flight = false;
+    int retry = 0;
+    uint8_t status = 0;
+    while (!(status & W5500_SIR_SEND)) {
+        ESP_GOTO_ON_ERROR(w5500_read(emac, W5500_REG_SOCK_IR(0), &status, sizeof(status)), err, TAG, "read SOCK0 IR failed");
+        if ((retry++ > 3 && !is_w5500_sane_for_rxtx(emac)) || retry > 10) {
+            return ESP_FAIL;
+        }
+    }
+    // clear the event bit
+    status = W5500_SIR_SEND;
+    ESP_GOTO_ON_ERROR(w5500_write(emac, W5500_REG_SOCK_IR(0), &status, sizeof(status)), err, TAG, "write SOCK0 IR failed");
+
+err:
+    return ret;
+}
+#endif // CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+
 static esp_err_t emac_w5500_transmit(esp_eth_mac_t *mac, uint8_t *buf, uint32_t length)
 {
     esp_err_t ret = ESP_OK;
@@ -572,22 +614,44 @@ static esp_err_t emac_w5500_transmit(esp_eth_mac_t *mac, uint8_t *buf, uint32_t
 
     ESP_GOTO_ON_FALSE(length <= ETH_MAX_PACKET_SIZE, ESP_ERR_INVALID_ARG, err,
                         TAG, "frame size is too big (actual %" PRIu32 ", maximum %u)", length, ETH_MAX_PACKET_SIZE);
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+    // finish the in-flight SEND first, so copying the previous frame overlapped its wire time
+    ESP_GOTO_ON_ERROR(emac_w5500_finish_pending_send(emac), err, TAG, "previous SEND failed");
+#endif
     // check if there're free memory to store this packet
     uint16_t free_size = 0;
     ESP_GOTO_ON_ERROR(w5500_get_tx_free_size(emac, &free_size), err, TAG, "get free size failed");
     ESP_GOTO_ON_FALSE(length <= free_size, ESP_ERR_NO_MEM, err, TAG, "free size (%" PRIu16 ") < send length (%" PRIu32 ")", free_size, length);
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+    // get current write pointer, from the chip only once after the socket was (re)opened
+    if (!emac->tx_wr_valid) {
+        ESP_GOTO_ON_ERROR(w5500_read(emac, W5500_REG_SOCK_TX_WR(0), &offset, sizeof(offset)), err, TAG, "read TX WR failed");
+        offset = __builtin_bswap16(offset);
+        emac->tx_wr_valid = true;
+    } else {
+        offset = emac->tx_wr_offset;
+    }
+#else
     // get current write pointer
     ESP_GOTO_ON_ERROR(w5500_read(emac, W5500_REG_SOCK_TX_WR(0), &offset, sizeof(offset)), err, TAG, "read TX WR failed");
     offset = __builtin_bswap16(offset);
+#endif
     // copy data to tx memory
     ESP_GOTO_ON_ERROR(w5500_write_buffer(emac, buf, length, offset), err, TAG, "write frame failed");
     // update write pointer
     offset += length;
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+    emac->tx_wr_offset = offset;
+#endif
     offset = __builtin_bswap16(offset);
     ESP_GOTO_ON_ERROR(w5500_write(emac, W5500_REG_SOCK_TX_WR(0), &offset, sizeof(offset)), err, TAG, "write TX WR failed");
     // issue SEND command
     ESP_GOTO_ON_ERROR(w5500_send_command(emac, W5500_SCR_SEND, 100), err, TAG, "issue SEND command failed");
 
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+    // don't wait for the TX done event here: the next transmit (or a socket close) reaps it
+    emac->tx_in_flight = true;
+#else
     // pooling the TX done event
     int retry = 0;
     uint8_t status = 0;
@@ -600,11 +664,13 @@ static esp_err_t emac_w5500_transmit(esp_eth_mac_t *mac, uint8_t *buf, uint32_t
     // clear the event bit
     status  = W5500_SIR_SEND;
     ESP_GOTO_ON_ERROR(w5500_write(emac, W5500_REG_SOCK_IR(0), &status, sizeof(status)), err, TAG, "write SOCK0 IR failed");
+#endif
 
 err:
     return ret;
 }
 
+#if !CONFIG_ETH_SPI_ETHERNET_W5500_BURST
 static esp_err_t emac_w5500_alloc_recv_buf(emac_w5500_t *emac, uint8_t **buf, uint32_t *length)
 {
     esp_err_t ret = ESP_OK;
@@ -642,6 +708,7 @@ err:
     *length = rx_len;
     return ret;
 }
+#endif // !CONFIG_ETH_SPI_ETHERNET_W5500_BURST
 
 static esp_err_t emac_w5500_receive(esp_eth_mac_t *mac, uint8_t *buf, uint32_t *length)
 {
@@ -697,6 +764,7 @@ err:
     return ret;
 }
 
+#if !CONFIG_ETH_SPI_ETHERNET_W5500_BURST
 static esp_err_t emac_w5500_flush_recv_frame(emac_w5500_t *emac)
 {
     esp_err_t ret = ESP_OK;
@@ -726,6 +794,84 @@ static esp_err_t emac_w5500_flush_recv_frame(emac_w5500_t *emac)
 err:
     return ret;
 }
+#endif // !CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+/**
+ * Service every pending RX frame with as few SPI transactions as possible: the RX ring state is
+ * read once, then the whole pending window is pulled in large burst reads and split into frames
+ * locally; the read pointer update and the RECV command are issued once at the end.
+ */
+static esp_err_t emac_w5500_receive_burst(emac_w5500_t *emac)
+{
+    esp_err_t ret = ESP_OK;
+    uint16_t remain_bytes = 0;
+    uint16_t offset = 0;
+    uint16_t consumed = 0;
+
+    ESP_GOTO_ON_ERROR(w5500_get_rx_received_size(emac, &remain_bytes), err, TAG, "get RX received size failed");
+    if (remain_bytes == 0) {
+        return ESP_OK;
+    }
+    // get current read pointer, once for the whole batch
+    ESP_GOTO_ON_ERROR(w5500_read(emac, W5500_REG_SOCK_RX_RD(0), &offset, sizeof(offset)), err, TAG, "read RX RD failed");
+    offset = __builtin_bswap16(offset);
+
+    while (remain_bytes > consumed) {
+        uint16_t burst_len = MIN(remain_bytes - consumed, CONFIG_ETH_SPI_ETHERNET_W5500_BURST_RX_BUF_SIZE);
+        ESP_GOTO_ON_ERROR(w5500_read_buffer(emac, emac->burst_buffer, burst_len, offset + consumed), err,
+                          TAG, "read RX burst failed, len=%" PRIu16 ", offset=%" PRIu16, burst_len, (uint16_t)(offset + consumed));
+        uint16_t parsed = 0;
+        while (parsed + 2 <= burst_len) {
+            uint16_t rx_len = ((uint16_t)emac->burst_buffer[parsed] << 8) | emac->burst_buffer[parsed + 1];
+            // rx_len includes the 2 byte header itself
+            if (rx_len < 2 + ETH_MIN_PACKET_SIZE - ETH_CRC_LEN || rx_len > 2 + ETH_MAX_PACKET_SIZE) {
+                // corrupted over SPI: the frame boundaries are lost, drop everything pending
+                ESP_LOGE(TAG, "invalid frame length %" PRIu16 ", flushing RX memory", rx_len);
+                consumed = remain_bytes;
+                ret = ESP_ERR_INVALID_SIZE;
+                goto flush;
+            }
+            if (rx_len > remain_bytes - consumed - parsed) {
+                // frame not fully received at the time the RSR snapshot was taken, next IRQ gets it
+                break;
+            }
+            if (parsed + rx_len > burst_len) {
+                // frame crosses the end of the burst buffer, re-read starting from its header
+                break;
+            }
+            uint16_t frame_len = rx_len - 2;
+            uint8_t *frame = malloc(frame_len);
+            if (frame != NULL) {
+                memcpy(frame, emac->burst_buffer + parsed + 2, frame_len);
+                ESP_LOGD(TAG, "receive len=%" PRIu16, frame_len);
+                /* pass the buffer to stack (e.g. TCP/IP layer) */
+                emac->eth->stack_input(emac->eth, frame, frame_len);
+            } else {
+                // out of memory: the frame is consumed from the W5500 anyway so RX can make progress
+                ESP_LOGE(TAG, "no mem for receive buffer");
+            }
+            parsed += rx_len;
+        }
+        if (parsed == 0) {
+            // a frame waiting for its tail, nothing consumable in this burst
+            break;
+        }
+        consumed += parsed;
+    }
+
+flush:
+    if (consumed != 0) {
+        // update read pointer and issue RECV, once for the whole batch
+        uint16_t new_rd = __builtin_bswap16((uint16_t)(offset + consumed));
+        ESP_GOTO_ON_ERROR(w5500_write(emac, W5500_REG_SOCK_RX_RD(0), &new_rd, sizeof(new_rd)), err, TAG, "write RX RD failed");
+        ESP_GOTO_ON_ERROR(w5500_send_command(emac, W5500_SCR_RECV, 100), err, TAG, "issue RECV command failed");
+    }
+
+err:
+    return ret;
+}
+#endif // CONFIG_ETH_SPI_ETHERNET_W5500_BURST
 
 IRAM_ATTR static void w5500_isr_handler(void *arg)
 {
@@ -748,10 +894,12 @@ static void emac_w5500_task(void *arg)
 {
     emac_w5500_t *emac = (emac_w5500_t *)arg;
     uint8_t status = 0;
+#if !CONFIG_ETH_SPI_ETHERNET_W5500_BURST
     uint8_t *buffer = NULL;
     uint32_t frame_len = 0;
     uint32_t buf_len = 0;
     esp_err_t ret;
+#endif
     while (1) {
         /* check if the task receives any notification */
         if (emac->int_gpio_num >= 0) {                                   // if in interrupt mode
@@ -769,6 +917,9 @@ static void emac_w5500_task(void *arg)
             status = W5500_SIR_RECV;
             /* clear interrupt status */
             w5500_write(emac, W5500_REG_SOCK_IR(0), &status, sizeof(status));
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+            emac_w5500_receive_burst(emac);
+#else
             do {
                 /* define max expected frame len */
                 frame_len = ETH_MAX_PACKET_SIZE;
@@ -801,6 +952,7 @@ static void emac_w5500_task(void *arg)
                     ESP_LOGE(TAG, "unexpected error 0x%x", ret);
                 }
             } while (emac->packets_remain);
+#endif // CONFIG_ETH_SPI_ETHERNET_W5500_BURST
         }
     }
     vTaskDelete(NULL);
@@ -861,6 +1013,9 @@ static esp_err_t emac_w5500_del(esp_eth_mac_t *mac)
     vTaskDelete(emac->rx_task_hdl);
     emac->spi.deinit(emac->spi.ctx);
     heap_caps_free(emac->rx_buffer);
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+    heap_caps_free(emac->burst_buffer);
+#endif
     free(emac);
     return ESP_OK;
 }
@@ -926,6 +1081,10 @@ esp_eth_mac_t *esp_eth_mac_new_w5500(const eth_w5500_config_t *w5500_config, con
 
     emac->rx_buffer = heap_caps_malloc(ETH_MAX_PACKET_SIZE, MALLOC_CAP_DMA);
     ESP_GOTO_ON_FALSE(emac->rx_buffer, NULL, err, TAG, "RX buffer allocation failed");
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+    emac->burst_buffer = heap_caps_malloc(CONFIG_ETH_SPI_ETHERNET_W5500_BURST_RX_BUF_SIZE, MALLOC_CAP_DMA);
+    ESP_GOTO_ON_FALSE(emac->burst_buffer, NULL, err, TAG, "burst RX buffer allocation failed");
+#endif
 
     if (emac->int_gpio_num < 0) {
         const esp_timer_create_args_t poll_timer_args = {
@@ -951,6 +1110,9 @@ err:
             emac->spi.deinit(emac->spi.ctx);
         }
         heap_caps_free(emac->rx_buffer);
+#if CONFIG_ETH_SPI_ETHERNET_W5500_BURST
+        heap_caps_free(emac->burst_buffer);
+#endif
         free(emac);
     }
     return ret;
@@ -94,6 +94,7 @@ static int esp_event_dump_prepare(void)
 }
 #endif
 
+#if !CONFIG_ESP_EVENT_USE_WORK_POOL
 static void esp_event_loop_run_task(void* args)
 {
     esp_err_t err;
@@ -111,6 +112,50 @@ static void esp_event_loop_run_task(void* args)
     ESP_LOGE(TAG, "suspended task for loop %p", event_loop);
     vTaskSuspend(NULL);
 }
+#endif // !CONFIG_ESP_EVENT_USE_WORK_POOL
+
+#if CONFIG_ESP_EVENT_USE_WORK_POOL
+static void event_loop_pool_job(void* args);
+
+// Queue a dispatch job for the loop unless one is already queued or running
+static void event_loop_pool_schedule(esp_event_loop_instance_t* loop)
+{
+    bool expected = false;
+    if (loop->pool_shutdown || !atomic_compare_exchange_strong(&loop->job_pending, &expected, true)) {
+        return;
+    }
+    if (esp_work_pool_post(event_loop_pool_job, loop, loop->pool_lane, loop->pool_core) != ESP_OK) {
+        // Pool ring is full; the next successful post to the loop retries
+        atomic_store(&loop->job_pending, false);
+    }
+}
+
+static void event_loop_pool_job(void* args)
+{
+    esp_event_loop_instance_t* loop = (esp_event_loop_instance_t*) args;
+
+    esp_event_loop_run((esp_event_loop_handle_t) loop, 0);
+    atomic_store(&loop->job_pending, false);
+    // Events posted between draining the queue and clearing the flag would
+    // otherwise be stranded until the next post
+    if (uxQueueMessagesWaiting(loop->queue) > 0) {
+        event_loop_pool_schedule(loop);
+    }
+}
+
+#if CONFIG_ESP_EVENT_POST_FROM_ISR
+static void event_loop_pool_schedule_from_isr(esp_event_loop_instance_t* loop, BaseType_t* task_unblocked)
+{
+    bool expected = false;
+    if (loop->pool_shutdown || !atomic_compare_exchange_strong(&loop->job_pending, &expected, true)) {
+        return;
+    }
+    if (esp_work_pool_post_from_isr(event_loop_pool_job, loop, loop->pool_lane, task_unblocked) != ESP_OK) {
+        atomic_store(&loop->job_pending, false);
+    }
+}
+#endif // CONFIG_ESP_EVENT_POST_FROM_ISR
+#endif // CONFIG_ESP_EVENT_USE_WORK_POOL
 
 static void handler_execute(esp_event_loop_instance_t* loop, esp_event_handler_node_t *handler, esp_event_post_instance_t post)
 {
@@ -437,6 +482,47 @@ static void inline __attribute__((always_inline)) post_instance_delete(esp_event
     memset(post, 0, sizeof(*post));
 }
 
+#if CONFIG_ESP_EVENT_PRIORITY_LANES
+// Queued in place of an event to wake the loop when the priority lane has
+// entries; recognized by pointer comparison and never dispatched.
+static const char s_lane_wake_token[] = "lane_wake";
+
+static bool lane_ring_push(esp_event_loop_instance_t* loop, const esp_event_post_instance_t* post)
+{
+    bool pushed = false;
+    portENTER_CRITICAL_SAFE(&loop->lane_lock);
+    if (loop->lane_head - loop->lane_tail < CONFIG_ESP_EVENT_PRIORITY_LANE_SIZE) {
+        loop->lane_ring[loop->lane_head % CONFIG_ESP_EVENT_PRIORITY_LANE_SIZE] = *post;
+        loop->lane_head++;
+        pushed = true;
+    }
+    portEXIT_CRITICAL_SAFE(&loop->lane_lock);
+    return pushed;
+}
+
+static bool lane_ring_pop(esp_event_loop_instance_t* loop, esp_event_post_instance_t* post)
+{
+    bool popped = false;
+    portENTER_CRITICAL(&loop->lane_lock);
+    if (loop->lane_head != loop->lane_tail) {
+        *post = loop->lane_ring[loop->lane_tail % CONFIG_ESP_EVENT_PRIORITY_LANE_SIZE];
+        loop->lane_tail++;
+        popped = true;
+    }
+    portEXIT_CRITICAL(&loop->lane_lock);
+    return popped;
+}
+
+static void handle_dropped_post(esp_event_loop_instance_t* loop, const esp_event_post_instance_t* post, bool critical)
+{
+    atomic_fetch_add(critical ? &loop->lane_dropped : &loop->queue_dropped, 1);
+    esp_event_drop_cb_t drop_cb = loop->drop_cb;
+    if (drop_cb != NULL) {
+        drop_cb(post->base, post->id, critical, loop->drop_cb_arg);
+    }
+}
+#endif // CONFIG_ESP_EVENT_PRIORITY_LANES
+
 /* ---------------------------- Public API --------------------------------- */
 
 esp_err_t esp_event_loop_create(const esp_event_loop_args_t* event_loop_args, esp_event_loop_handle_t* event_loop)
@@ -482,8 +568,39 @@ esp_err_t esp_event_loop_create(const esp_event_loop_args_t* event_loop_args, es
 
     SLIST_INIT(&(loop->loop_nodes));
 
+#ifdef CONFIG_ESP_EVENT_DIRECT_DISPATCH
+    portMUX_INITIALIZE(&loop->direct_lock);
+#endif
+
+#ifdef CONFIG_ESP_EVENT_PRIORITY_LANES
+    portMUX_INITIALIZE(&loop->lane_lock);
+    atomic_init(&loop->lane_dropped, 0);
+    atomic_init(&loop->queue_dropped, 0);
+#endif
+
     // Create the loop task if requested
     if (event_loop_args->task_name != NULL) {
+#if CONFIG_ESP_EVENT_USE_WORK_POOL
+        // The loop is dispatched by the shared worker pool instead of a dedicated task
+        err = esp_work_pool_init();
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "start worker pool for loop failed");
+            goto on_err;
+        }
+
+        loop->task = NULL;
+        loop->use_work_pool = true;
+        atomic_init(&loop->job_pending, false);
+        // Loops configured above the worker priority keep precedence through the high lane
+        loop->pool_lane = (event_loop_args->task_priority >= CONFIG_ESP_WORK_POOL_TASK_PRIORITY) ?
+                          ESP_WORK_LANE_HIGH : ESP_WORK_LANE_LOW;
+        loop->pool_core = (event_loop_args->task_core_id >= 0 &&
+                           event_loop_args->task_core_id < CONFIG_FREERTOS_NUMBER_OF_CORES) ?
+                          event_loop_args->task_core_id : ESP_WORK_POOL_NO_AFFINITY;
+        loop->name = event_loop_args->task_name;
+
+        ESP_LOGD(TAG, "loop %p dispatched through worker pool", loop);
+#else
         BaseType_t task_created = xTaskCreatePinnedToCore(esp_event_loop_run_task, event_loop_args->task_name,
                                                           event_loop_args->task_stack_size, (void*) loop,
                                                           event_loop_args->task_priority, &(loop->task), event_loop_args->task_core_id);
@@ -497,6 +614,7 @@ esp_err_t esp_event_loop_create(const esp_event_loop_args_t* event_loop_args, es
         loop->name = event_loop_args->task_name;
 
         ESP_LOGD(TAG, "created task for loop %p", loop);
+#endif // CONFIG_ESP_EVENT_USE_WORK_POOL
     } else {
         loop->name = "";
         loop->task = NULL;
@@ -536,6 +654,66 @@ on_err:
     return err;
 }
 
+// Run the registered handlers of one dequeued event and delete its instance
+static void dispatch_event(esp_event_loop_instance_t* loop, esp_event_post_instance_t* post)
+{
+    // The event has already been unqueued, so ensure it gets executed.
+    xSemaphoreTakeRecursive(loop->mutex, portMAX_DELAY);
+
+    loop->running_task = xTaskGetCurrentTaskHandle();
+
+    bool exec = false;
+
+    esp_event_handler_node_t *handler, *temp_handler;
+    esp_event_loop_node_t *loop_node, *temp_node;
+    esp_event_base_node_t *base_node, *temp_base;
+    esp_event_id_node_t *id_node, *temp_id_node;
+
+    SLIST_FOREACH_SAFE(loop_node, &(loop->loop_nodes), next, temp_node) {
+        // Execute loop level handlers
+        SLIST_FOREACH_SAFE(handler, &(loop_node->handlers), next, temp_handler) {
+            handler_execute(loop, handler, *post);
+            exec |= true;
+        }
+
+        SLIST_FOREACH_SAFE(base_node, &(loop_node->base_nodes), next, temp_base) {
+            if (base_node->base == post->base) {
+                // Execute base level handlers
+                SLIST_FOREACH_SAFE(handler, &(base_node->handlers), next, temp_handler) {
+                    handler_execute(loop, handler, *post);
+                    exec |= true;
+                }
+
+                SLIST_FOREACH_SAFE(id_node, &(base_node->id_nodes), next, temp_id_node) {
+                    if (id_node->id == post->id) {
+                        // Execute id level handlers
+                        SLIST_FOREACH_SAFE(handler, &(id_node->handlers), next, temp_handler) {
+                            handler_execute(loop, handler, *post);
+                            exec |= true;
+                        }
+                        // Skip to next base node
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    esp_event_base_t base = post->base;
+    int32_t id = post->id;
+
+    post_instance_delete(post);
+
+    loop->running_task = NULL;
+
+    xSemaphoreGiveRecursive(loop->mutex);
+
+    if (!exec) {
+        // No handlers were registered, not even loop/base level handlers
+        ESP_LOGD(TAG, "no handlers have been registered for event %s:%"PRIu32" posted to loop %p", base, id, (void*) loop);
+    }
+}
+
 // On event lookup performance: The library implements the event list as a linked list, which results to O(n)
 // lookup time. The test comparing this implementation to the O(lg n) performance of rbtrees
 // (https://github.com/freebsd/freebsd/blob/master/sys/sys/tree.h)
@@ -557,74 +735,37 @@ esp_err_t esp_event_loop_run(esp_event_loop_handle_t event_loop, TickType_t tick
     int64_t remaining_ticks = ticks_to_run;
 #endif
 
-    while (xQueueReceive(loop->queue, &post, ticks_to_run) == pdTRUE) {
-        // The event has already been unqueued, so ensure it gets executed.
-        xSemaphoreTakeRecursive(loop->mutex, portMAX_DELAY);
-
-        loop->running_task = xTaskGetCurrentTaskHandle();
-
-        bool exec = false;
-
-        esp_event_handler_node_t *handler, *temp_handler;
-        esp_event_loop_node_t *loop_node, *temp_node;
-        esp_event_base_node_t *base_node, *temp_base;
-        esp_event_id_node_t *id_node, *temp_id_node;
-
-        SLIST_FOREACH_SAFE(loop_node, &(loop->loop_nodes), next, temp_node) {
-            // Execute loop level handlers
-            SLIST_FOREACH_SAFE(handler, &(loop_node->handlers), next, temp_handler) {
-                handler_execute(loop, handler, post);
-                exec |= true;
+    while (true) {
+#if CONFIG_ESP_EVENT_PRIORITY_LANES
+        // Critical events bypass the queue and are always dispatched first
+        bool from_lane = lane_ring_pop(loop, &post);
+        if (!from_lane)
+#endif
+        {
+            if (xQueueReceive(loop->queue, &post, ticks_to_run) != pdTRUE) {
+                break;
             }
-
-            SLIST_FOREACH_SAFE(base_node, &(loop_node->base_nodes), next, temp_base) {
-                if (base_node->base == post.base) {
-                    // Execute base level handlers
-                    SLIST_FOREACH_SAFE(handler, &(base_node->handlers), next, temp_handler) {
-                        handler_execute(loop, handler, post);
-                        exec |= true;
-                    }
-
-                    SLIST_FOREACH_SAFE(id_node, &(base_node->id_nodes), next, temp_id_node) {
-                        if (id_node->id == post.id) {
-                            // Execute id level handlers
-                            SLIST_FOREACH_SAFE(handler, &(id_node->handlers), next, temp_handler) {
-                                handler_execute(loop, handler, post);
-                                exec |= true;
-                            }
-                            // Skip to next base node
-                            break;
-                        }
-                    }
-                }
+#if CONFIG_ESP_EVENT_PRIORITY_LANES
+            if (post.base == s_lane_wake_token) {
+                // Not an event, just a wakeup for the lane; drained above on
+                // the next iteration
+                continue;
             }
+#endif
         }
 
-        esp_event_base_t base = post.base;
-        int32_t id = post.id;
-
-        post_instance_delete(&post);
+        dispatch_event(loop, &post);
 
         if (ticks_to_run != portMAX_DELAY) {
             end = xTaskGetTickCount();
             remaining_ticks -= end - marker;
             // If the ticks to run expired, return to the caller
             if (remaining_ticks <= 0) {
-                xSemaphoreGiveRecursive(loop->mutex);
                 break;
             } else {
                 marker = end;
             }
         }
-
-        loop->running_task = NULL;
-
-        xSemaphoreGiveRecursive(loop->mutex);
-
-        if (!exec) {
-            // No handlers were registered, not even loop/base level handlers
-            ESP_LOGD(TAG, "no handlers have been registered for event %s:%"PRIu32" posted to loop %p", base, id, event_loop);
-        }
     }
 
     return ESP_OK;
@@ -641,6 +782,17 @@ esp_err_t esp_event_loop_delete(esp_event_loop_handle_t event_loop)
     SemaphoreHandle_t loop_profiling_mutex = loop->profiling_mutex;
 #endif
 
+#if CONFIG_ESP_EVENT_USE_WORK_POOL
+    if (loop->use_work_pool) {
+        // Stop scheduling new dispatch jobs and wait out the one in flight. This must
+        // happen before taking the mutex, as the job takes it while running handlers.
+        loop->pool_shutdown = true;
+        while (atomic_load(&loop->job_pending)) {
+            vTaskDelay(1);
+        }
+    }
+#endif
+
     xSemaphoreTakeRecursive(loop->mutex, portMAX_DELAY);
 
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
@@ -669,6 +821,13 @@ esp_err_t esp_event_loop_delete(esp_event_loop_handle_t event_loop)
         post_instance_delete(&post);
     }
 
+#if CONFIG_ESP_EVENT_PRIORITY_LANES
+    // Drop critical posts still sitting on the lane ring
+    while (lane_ring_pop(loop, &post)) {
+        post_instance_delete(&post);
+    }
+#endif
+
     // Cleanup loop
     vQueueDelete(loop->queue);
     free(loop);
@@ -683,6 +842,69 @@ esp_err_t esp_event_loop_delete(esp_event_loop_handle_t event_loop)
     return ESP_OK;
 }
 
+#if CONFIG_ESP_EVENT_DIRECT_DISPATCH
+esp_err_t esp_event_handler_register_with_internal(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
+                                                   int32_t event_id, esp_event_handler_t event_handler, void* event_handler_arg,
+                                                   esp_event_handler_instance_context_t** handler_ctx_arg, bool legacy);
+
+// Check whether any generic handler registered on the loop matches the given event.
+// The loop mutex must be held.
+static bool loop_has_matching_handler(esp_event_loop_instance_t* loop, esp_event_base_t event_base, int32_t event_id)
+{
+    esp_event_loop_node_t* loop_node;
+    esp_event_base_node_t* base_node;
+    esp_event_id_node_t* id_node;
+
+    SLIST_FOREACH(loop_node, &(loop->loop_nodes), next) {
+        if (!SLIST_EMPTY(&(loop_node->handlers))) {
+            return true;    // Loop-level wildcard handler
+        }
+        SLIST_FOREACH(base_node, &(loop_node->base_nodes), next) {
+            if (base_node->base == event_base) {
+                if (!SLIST_EMPTY(&(base_node->handlers))) {
+                    return true;    // Base-level wildcard handler
+                }
+                SLIST_FOREACH(id_node, &(base_node->id_nodes), next) {
+                    if (id_node->id == event_id && !SLIST_EMPTY(&(id_node->handlers))) {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+// Move direct subscriptions covered by a new generic registration onto the generic handler
+// list, so that the fast path cannot skip the new handler. The loop mutex must be held.
+static void direct_subs_demote(esp_event_loop_instance_t* loop, esp_event_base_t event_base, int32_t event_id)
+{
+    for (int i = 0; i < CONFIG_ESP_EVENT_DIRECT_DISPATCH_MAX_SUBS; i++) {
+        esp_event_direct_sub_t sub;
+        bool covered;
+
+        portENTER_CRITICAL(&loop->direct_lock);
+        sub = loop->direct_subs[i];
+        covered = (sub.handler != NULL) &&
+                  (event_base == esp_event_any_base ||
+                   (sub.base == event_base && (event_id == ESP_EVENT_ANY_ID || sub.id == event_id)));
+        if (covered) {
+            loop->direct_subs[i].handler = NULL;
+        }
+        portEXIT_CRITICAL(&loop->direct_lock);
+
+        if (covered) {
+            ESP_LOGD(TAG, "moving direct handler for %s:%"PRIi32" to the generic path", sub.base, sub.id);
+            esp_err_t err = esp_event_handler_register_with_internal((esp_event_loop_handle_t) loop, sub.base,
+                                                                     sub.id, sub.handler, sub.arg, NULL, true);
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "moving direct handler for %s:%"PRIi32" to the generic path failed", sub.base, sub.id);
+            }
+        }
+    }
+}
+#endif // CONFIG_ESP_EVENT_DIRECT_DISPATCH
+
 esp_err_t esp_event_handler_register_with_internal(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
                                                    int32_t event_id, esp_event_handler_t event_handler, void* event_handler_arg,
                                                    esp_event_handler_instance_context_t** handler_ctx_arg, bool legacy)
@@ -741,6 +963,14 @@ esp_err_t esp_event_handler_register_with_internal(esp_event_loop_handle_t event
         err = loop_node_add_handler(last_loop_node, event_base, event_id, event_handler, event_handler_arg, handler_ctx_arg, legacy);
     }
 
+#if CONFIG_ESP_EVENT_DIRECT_DISPATCH
+    if (err == ESP_OK) {
+        // The event now has more than one subscriber if it had a direct one, fall
+        // back to the generic path for all of them
+        direct_subs_demote(loop, event_base, event_id);
+    }
+#endif
+
 on_err:
     xSemaphoreGiveRecursive(loop->mutex);
     return err;
@@ -805,6 +1035,101 @@ esp_err_t esp_event_handler_unregister_with(esp_event_loop_handle_t event_loop,
     return esp_event_handler_unregister_with_internal(event_loop, event_base, event_id, &local_handler_ctx, true);
 }
 
+#if CONFIG_ESP_EVENT_DIRECT_DISPATCH
+esp_err_t esp_event_handler_register_direct(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
+                                            int32_t event_id, esp_event_handler_t event_handler, void* event_handler_arg)
+{
+    if (event_loop == NULL || event_handler == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (event_base == ESP_EVENT_ANY_BASE || event_id == ESP_EVENT_ANY_ID) {
+        ESP_LOGE(TAG, "direct dispatch registration requires a specific base and id");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_event_loop_instance_t* loop = (esp_event_loop_instance_t*) event_loop;
+    esp_err_t err = ESP_OK;
+
+    xSemaphoreTakeRecursive(loop->mutex, portMAX_DELAY);
+
+    // The fast path would skip other subscribers of the event, so fall back to a
+    // generic registration when the event already has one, or no slot is free
+    bool fallback = loop_has_matching_handler(loop, event_base, event_id);
+
+    if (!fallback) {
+        int free_slot = -1;
+        portENTER_CRITICAL(&loop->direct_lock);
+        for (int i = 0; i < CONFIG_ESP_EVENT_DIRECT_DISPATCH_MAX_SUBS; i++) {
+            esp_event_direct_sub_t* sub = &loop->direct_subs[i];
+            if (sub->handler == NULL) {
+                if (free_slot < 0) {
+                    free_slot = i;
+                }
+            } else if (sub->base == event_base && sub->id == event_id) {
+                fallback = true;    // Second subscriber of this event
+                break;
+            }
+        }
+        if (!fallback && free_slot >= 0) {
+            loop->direct_subs[free_slot].base = event_base;
+            loop->direct_subs[free_slot].id = event_id;
+            loop->direct_subs[free_slot].arg = event_handler_arg;
+            loop->direct_subs[free_slot].handler = event_handler;
+        } else {
+            fallback = true;
+        }
+        portEXIT_CRITICAL(&loop->direct_lock);
+    }
+
+    if (fallback) {
+        // This also demotes an existing direct subscription of the same event
+        err = esp_event_handler_register_with_internal(event_loop, event_base, event_id,
+                                                       event_handler, event_handler_arg, NULL, true);
+    } else {
+        ESP_LOGD(TAG, "registered direct handler for %s:%"PRIi32" on loop %p", event_base, event_id, loop);
+    }
+
+    xSemaphoreGiveRecursive(loop->mutex);
+
+    return err;
+}
+
+esp_err_t esp_event_handler_unregister_direct(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
+                                              int32_t event_id, esp_event_handler_t event_handler)
+{
+    if (event_loop == NULL || event_handler == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_event_loop_instance_t* loop = (esp_event_loop_instance_t*) event_loop;
+    bool removed = false;
+    esp_err_t err = ESP_OK;
+
+    xSemaphoreTakeRecursive(loop->mutex, portMAX_DELAY);
+
+    portENTER_CRITICAL(&loop->direct_lock);
+    for (int i = 0; i < CONFIG_ESP_EVENT_DIRECT_DISPATCH_MAX_SUBS; i++) {
+        esp_event_direct_sub_t* sub = &loop->direct_subs[i];
+        if (sub->handler == event_handler && sub->base == event_base && sub->id == event_id) {
+            sub->handler = NULL;
+            removed = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&loop->direct_lock);
+
+    if (!removed) {
+        // The registration may have been moved onto the generic handler list
+        err = esp_event_handler_unregister_with(event_loop, event_base, event_id, event_handler);
+    }
+
+    xSemaphoreGiveRecursive(loop->mutex);
+
+    return err;
+}
+#endif // CONFIG_ESP_EVENT_DIRECT_DISPATCH
+
 esp_err_t esp_event_handler_instance_unregister_with(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
                                                      int32_t event_id, esp_event_handler_instance_t handler_ctx_arg)
 {
@@ -826,6 +1151,29 @@ esp_err_t esp_event_post_to(esp_event_loop_handle_t event_loop, esp_event_base_t
 
     esp_event_loop_instance_t* loop = (esp_event_loop_instance_t*) event_loop;
 
+#if CONFIG_ESP_EVENT_DIRECT_DISPATCH
+    // Fast path: the sole subscriber of this event is a direct handler. Invoke it in this
+    // task's context, skipping the data copy, the queue hop and the handler-list walk.
+    esp_event_handler_t direct_handler = NULL;
+    void* direct_arg = NULL;
+
+    portENTER_CRITICAL(&loop->direct_lock);
+    for (int i = 0; i < CONFIG_ESP_EVENT_DIRECT_DISPATCH_MAX_SUBS; i++) {
+        if (loop->direct_subs[i].handler != NULL &&
+                loop->direct_subs[i].base == event_base && loop->direct_subs[i].id == event_id) {
+            direct_handler = loop->direct_subs[i].handler;
+            direct_arg = loop->direct_subs[i].arg;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&loop->direct_lock);
+
+    if (direct_handler != NULL) {
+        direct_handler(direct_arg, event_base, event_id, (void*) event_data);
+        return ESP_OK;
+    }
+#endif
+
     esp_event_post_instance_t post;
     memset((void*)(&post), 0, sizeof(post));
 
@@ -876,6 +1224,9 @@ esp_err_t esp_event_post_to(esp_event_loop_handle_t event_loop, esp_event_base_t
     }
 
     if (result != pdTRUE) {
+#if CONFIG_ESP_EVENT_PRIORITY_LANES
+        handle_dropped_post(loop, &post, false);
+#endif
         post_instance_delete(&post);
 
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
@@ -888,6 +1239,12 @@ esp_err_t esp_event_post_to(esp_event_loop_handle_t event_loop, esp_event_base_t
     atomic_fetch_add(&loop->events_recieved, 1);
 #endif
 
+#if CONFIG_ESP_EVENT_USE_WORK_POOL
+    if (loop->use_work_pool) {
+        event_loop_pool_schedule(loop);
+    }
+#endif
+
     return ESP_OK;
 }
 
@@ -924,6 +1281,9 @@ esp_err_t esp_event_isr_post_to(esp_event_loop_handle_t event_loop, esp_event_ba
     result = xQueueSendToBackFromISR(loop->queue, &post, task_unblocked);
 
     if (result != pdTRUE) {
+#if CONFIG_ESP_EVENT_PRIORITY_LANES
+        handle_dropped_post(loop, &post, false);
+#endif
         post_instance_delete(&post);
 
 #ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
@@ -936,6 +1296,102 @@ esp_err_t esp_event_isr_post_to(esp_event_loop_handle_t event_loop, esp_event_ba
     atomic_fetch_add(&loop->events_recieved, 1);
 #endif
 
+#if CONFIG_ESP_EVENT_USE_WORK_POOL
+    if (loop->use_work_pool) {
+        event_loop_pool_schedule_from_isr(loop, task_unblocked);
+    }
+#endif
+
+    return ESP_OK;
+}
+#endif
+
+#if CONFIG_ESP_EVENT_PRIORITY_LANES
+esp_err_t esp_event_isr_post_critical_to(esp_event_loop_handle_t event_loop, esp_event_base_t event_base, int32_t event_id,
+                                         const void* event_data, size_t event_data_size, BaseType_t* task_unblocked)
+{
+    assert(event_loop);
+
+    if (event_base == ESP_EVENT_ANY_BASE || event_id == ESP_EVENT_ANY_ID) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_event_loop_instance_t* loop = (esp_event_loop_instance_t*) event_loop;
+
+    esp_event_post_instance_t post;
+    memset((void*)(&post), 0, sizeof(post));
+
+    if (event_data_size > sizeof(post.data.val)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (event_data != NULL && event_data_size != 0) {
+        memcpy((void*)(&(post.data.val)), event_data, event_data_size);
+        post.data_allocated = false;
+        post.data_set = true;
+    }
+    post.base = event_base;
+    post.id = event_id;
+
+    if (!lane_ring_push(loop, &post)) {
+        handle_dropped_post(loop, &post, true);
+
+#ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
+        atomic_fetch_add(&loop->events_dropped, 1);
+#endif
+        return ESP_FAIL;
+    }
+
+    // Wake the loop in case it is blocked on an empty queue. The token carries no
+    // event; the lane ring is drained before every queue receive. If the queue is
+    // full the send may fail, which is harmless: a non-empty queue means the loop
+    // is (or will be) running and drains the ring before each queued event anyway.
+    esp_event_post_instance_t token;
+    memset((void*)(&token), 0, sizeof(token));
+    token.base = s_lane_wake_token;
+    xQueueSendToFrontFromISR(loop->queue, &token, task_unblocked);
+
+#ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
+    atomic_fetch_add(&loop->events_recieved, 1);
+#endif
+
+#if CONFIG_ESP_EVENT_USE_WORK_POOL
+    if (loop->use_work_pool) {
+        event_loop_pool_schedule_from_isr(loop, task_unblocked);
+    }
+#endif
+
+    return ESP_OK;
+}
+
+esp_err_t esp_event_loop_set_drop_cb(esp_event_loop_handle_t event_loop, esp_event_drop_cb_t drop_cb, void* arg)
+{
+    assert(event_loop);
+
+    esp_event_loop_instance_t* loop = (esp_event_loop_instance_t*) event_loop;
+
+    // Uninstall first so a concurrent drop never sees the new callback with the old argument
+    loop->drop_cb = NULL;
+    loop->drop_cb_arg = arg;
+    loop->drop_cb = drop_cb;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_event_loop_get_drop_counts(esp_event_loop_handle_t event_loop, uint32_t* queue_dropped, uint32_t* lane_dropped)
+{
+    assert(event_loop);
+
+    esp_event_loop_instance_t* loop = (esp_event_loop_instance_t*) event_loop;
+
+    if (queue_dropped != NULL) {
+        *queue_dropped = atomic_load(&loop->queue_dropped);
+    }
+
+    if (lane_dropped != NULL) {
+        *lane_dropped = atomic_load(&loop->lane_dropped);
+    }
+
     return ESP_OK;
 }
 #endif
@@ -342,6 +342,64 @@ esp_err_t esp_event_handler_instance_unregister(esp_event_base_t event_base,
                                                 int32_t event_id,
                                                 esp_event_handler_instance_t instance);
 
+#if CONFIG_ESP_EVENT_DIRECT_DISPATCH || __DOXYGEN__
+/**
+ * @brief Register a direct-dispatch handler for a single-subscriber event.
+ *
+ * As long as the given handler is the sole subscriber of the event, esp_event_post_to() dispatches
+ * it on a fast path: the handler is invoked synchronously in the posting task's context, skipping
+ * the event queue, the loop task wakeup and the handler-list walk. As soon as any other handler
+ * matching the same event registers (including wildcard registrations), the direct registration is
+ * transparently moved onto the generic handler list and all handlers run through the normal queued
+ * path again. If a matching handler already exists, or no direct slot is free, this function
+ * registers the handler generically right away.
+ *
+ * Because the handler may run in the posting task's context, it must tolerate the posting task's
+ * priority and stack, must not block for long, and must not assume it runs in the loop task. The
+ * event data pointer passed to the handler refers to the poster's buffer and is only valid for the
+ * duration of the call. Events dispatched directly do not preserve ordering relative to events
+ * queued on the loop.
+ *
+ * @param[in] event_loop the event loop to register this handler function to, must not be NULL
+ * @param[in] event_base the base ID of the event to register the handler for, wildcards not allowed
+ * @param[in] event_id the ID of the event to register the handler for, wildcards not allowed
+ * @param[in] event_handler the handler function which gets called when the event is dispatched
+ * @param[in] event_handler_arg data, aside from event data, that is passed to the handler when it is called
+ *
+ * @return
+ *  - ESP_OK: Success
+ *  - ESP_ERR_INVALID_ARG: Invalid argument or wildcard base/ID
+ *  - ESP_ERR_NO_MEM: Cannot allocate memory for the registration
+ *  - Others: Fail
+ */
+esp_err_t esp_event_handler_register_direct(esp_event_loop_handle_t event_loop,
+                                            esp_event_base_t event_base,
+                                            int32_t event_id,
+                                            esp_event_handler_t event_handler,
+                                            void *event_handler_arg);
+
+/**
+ * @brief Unregister a handler registered with esp_event_handler_register_direct().
+ *
+ * Also handles registrations that were transparently moved onto the generic handler list because
+ * further subscribers appeared.
+ *
+ * @param[in] event_loop the event loop the handler was registered to, must not be NULL
+ * @param[in] event_base the base of the event the handler was registered for
+ * @param[in] event_id the ID of the event the handler was registered for
+ * @param[in] event_handler the handler to unregister
+ *
+ * @return
+ *  - ESP_OK: Success
+ *  - ESP_ERR_INVALID_ARG: Invalid argument
+ *  - Others: Fail
+ */
+esp_err_t esp_event_handler_unregister_direct(esp_event_loop_handle_t event_loop,
+                                              esp_event_base_t event_base,
+                                              int32_t event_id,
+                                              esp_event_handler_t event_handler);
+#endif // CONFIG_ESP_EVENT_DIRECT_DISPATCH || __DOXYGEN__
+
 /**
  * @brief Posts an event to the system default event loop. The event loop library keeps a copy of event_data and manages
  * the copy's lifetime automatically (allocation + deletion); this ensures that the data the
@@ -455,6 +513,87 @@ esp_err_t esp_event_isr_post_to(esp_event_loop_handle_t event_loop,
                                 BaseType_t *task_unblocked);
 #endif
 
+#if CONFIG_ESP_EVENT_PRIORITY_LANES || __DOXYGEN__
+/**
+ * @brief Callback invoked when a posted event is dropped
+ *
+ * Called in the context the failing post was made from, which can be an
+ * interrupt handler, so the callback must be ISR-safe and short.
+ *
+ * @param[in] event_base the event base of the dropped event
+ * @param[in] event_id the event ID of the dropped event
+ * @param[in] critical true if the event was dropped from the priority lane,
+ *                     false if it was dropped from the ordinary loop queue
+ * @param[in] arg as passed to esp_event_loop_set_drop_cb
+ */
+typedef void (*esp_event_drop_cb_t)(esp_event_base_t event_base, int32_t event_id, bool critical, void *arg);
+
+/**
+ * @brief Variant of esp_event_isr_post_to delivering through the loop's priority lane
+ *
+ * The event is placed in a small fixed ring separate from the loop queue and
+ * dispatched before any queued event, so delivery latency stays bounded even
+ * when bulk events flood the ordinary queue. Only the lane itself (depth
+ * CONFIG_ESP_EVENT_PRIORITY_LANE_SIZE) can overflow, in which case the drop
+ * callback is invoked and the drop counter incremented.
+ *
+ * @param[in] event_loop the event loop to post to, must not be NULL
+ * @param[in] event_base the event base that identifies the event
+ * @param[in] event_id the event ID that identifies the event
+ * @param[in] event_data the data, specific to the event occurrence, that gets passed to the handler; max is 4 bytes
+ * @param[in] event_data_size the size of the event data
+ * @param[out] task_unblocked an optional parameter (can be NULL) which indicates that an event task with
+ *                            higher priority than currently running task has been unblocked by the posted event;
+ *                            a context switch should be requested before the interrupt is existed.
+ *
+ * @note this function is only available when CONFIG_ESP_EVENT_PRIORITY_LANES is enabled
+ *
+ * @return
+ *  - ESP_OK: Success
+ *  - ESP_FAIL: Priority lane of the loop full
+ *  - ESP_ERR_INVALID_ARG: Invalid combination of event base and event ID,
+ *                          data size of more than 4 bytes
+ *  - Others: Fail
+ */
+esp_err_t esp_event_isr_post_critical_to(esp_event_loop_handle_t event_loop,
+                                         esp_event_base_t event_base,
+                                         int32_t event_id,
+                                         const void *event_data,
+                                         size_t event_data_size,
+                                         BaseType_t *task_unblocked);
+
+/**
+ * @brief Install a drop callback on an event loop
+ *
+ * The callback is invoked whenever a post to the loop is dropped, from
+ * either the priority lane or the ordinary queue being full.
+ *
+ * @param[in] event_loop the event loop, must not be NULL
+ * @param[in] drop_cb callback to invoke on a dropped event, NULL to uninstall
+ * @param[in] arg passed through to the callback
+ *
+ * @return
+ *  - ESP_OK: Success
+ */
+esp_err_t esp_event_loop_set_drop_cb(esp_event_loop_handle_t event_loop,
+                                     esp_event_drop_cb_t drop_cb,
+                                     void *arg);
+
+/**
+ * @brief Read the drop counters of an event loop
+ *
+ * @param[in] event_loop the event loop, must not be NULL
+ * @param[out] queue_dropped events dropped from the ordinary queue, can be NULL
+ * @param[out] lane_dropped critical events dropped from the priority lane, can be NULL
+ *
+ * @return
+ *  - ESP_OK: Success
+ */
+esp_err_t esp_event_loop_get_drop_counts(esp_event_loop_handle_t event_loop,
+                                         uint32_t *queue_dropped,
+                                         uint32_t *lane_dropped);
+#endif // CONFIG_ESP_EVENT_PRIORITY_LANES || __DOXYGEN__
+
 /**
  * @brief Dumps statistics of all event loops.
  *
@@ -11,6 +11,9 @@
 #include <stdbool.h>
 #include "esp_event.h"
 #include "stdatomic.h"
+#ifdef CONFIG_ESP_EVENT_USE_WORK_POOL
+#include "esp_work_pool.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -65,23 +68,16 @@ typedef struct esp_event_loop_node {
 
 typedef SLIST_HEAD(esp_event_loop_nodes, esp_event_loop_node) esp_event_loop_nodes_t;
 
-/// Event loop
-typedef struct esp_event_loop_instance {
-    const char* name;                                               /**< name of this event loop */
-    QueueHandle_t queue;                                            /**< event queue */
-    TaskHandle_t task;                                              /**< task that consumes the event queue */
-    TaskHandle_t running_task;                                      /**< for loops with no dedicated task, the
-                                                                            task that consumes the queue */
-    SemaphoreHandle_t mutex;                                        /**< mutex for updating the events linked list */
-    esp_event_loop_nodes_t loop_nodes;                              /**< set of linked lists containing the
-                                                                            registered handlers for the loop */
-#ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
-    atomic_uint_least32_t events_recieved;                          /**< number of events successfully posted to the loop */
-    atomic_uint_least32_t events_dropped;                           /**< number of events dropped due to queue being full */
-    SemaphoreHandle_t profiling_mutex;                              /**< mutex used for profiliing */
-    SLIST_ENTRY(esp_event_loop_instance) next;                      /**< next event loop in the list */
+#ifdef CONFIG_ESP_EVENT_DIRECT_DISPATCH
+/// Direct-dispatch subscription of a single-subscriber event
+typedef struct esp_event_direct_sub {
+    esp_event_base_t base;                                          /**< base identifier of the event, no wildcards */
+    int32_t id;                                                     /**< id of the event, no wildcards */
+    esp_event_handler_t handler;                                    /**< handler invoked in the poster's context,
+                                                                            NULL when the slot is free */
+    void* arg;                                                      /**< argument passed to the handler */
+} esp_event_direct_sub_t;
 #endif
-} esp_event_loop_instance_t;
 
 #if CONFIG_ESP_EVENT_POST_FROM_ISR
 typedef union esp_event_post_data {
@@ -103,6 +99,47 @@ typedef struct esp_event_post_instance {
     esp_event_post_data_t data;                                      /**< data associated with the event */
 } esp_event_post_instance_t;
 
+/// Event loop
+typedef struct esp_event_loop_instance {
+    const char* name;                                               /**< name of this event loop */
+    QueueHandle_t queue;                                            /**< event queue */
+    TaskHandle_t task;                                              /**< task that consumes the event queue */
+    TaskHandle_t running_task;                                      /**< for loops with no dedicated task, the
+                                                                            task that consumes the queue */
+    SemaphoreHandle_t mutex;                                        /**< mutex for updating the events linked list */
+    esp_event_loop_nodes_t loop_nodes;                              /**< set of linked lists containing the
+                                                                            registered handlers for the loop */
+#ifdef CONFIG_ESP_EVENT_USE_WORK_POOL
+    bool use_work_pool;                                             /**< loop is dispatched by the shared worker pool
+                                                                            instead of a dedicated task */
+    volatile bool pool_shutdown;                                    /**< loop is being deleted, do not schedule jobs */
+    atomic_bool job_pending;                                        /**< a dispatch job is queued or running */
+    esp_work_lane_t pool_lane;                                      /**< worker pool lane the dispatch job uses */
+    int pool_core;                                                  /**< core the dispatch job is posted to */
+#endif
+#ifdef CONFIG_ESP_EVENT_DIRECT_DISPATCH
+    esp_event_direct_sub_t direct_subs[CONFIG_ESP_EVENT_DIRECT_DISPATCH_MAX_SUBS];  /**< direct-dispatch subscriptions */
+    portMUX_TYPE direct_lock;                                       /**< guards direct_subs against concurrent posts */
+#endif
+#ifdef CONFIG_ESP_EVENT_PRIORITY_LANES
+    esp_event_post_instance_t lane_ring[CONFIG_ESP_EVENT_PRIORITY_LANE_SIZE]; /**< fixed ring for critical
+                                                                            ISR-posted events, drained before the queue */
+    uint32_t lane_head;                                             /**< lane ring write index, grows monotonically */
+    uint32_t lane_tail;                                             /**< lane ring read index, grows monotonically */
+    portMUX_TYPE lane_lock;                                         /**< guards the lane ring against concurrent posts */
+    esp_event_drop_cb_t drop_cb;                                    /**< invoked when a post is dropped */
+    void* drop_cb_arg;                                              /**< argument of drop_cb */
+    atomic_uint_least32_t lane_dropped;                             /**< critical events dropped, lane ring full */
+    atomic_uint_least32_t queue_dropped;                            /**< events dropped, loop queue full */
+#endif
+#ifdef CONFIG_ESP_EVENT_LOOP_PROFILING
+    atomic_uint_least32_t events_recieved;                          /**< number of events successfully posted to the loop */
+    atomic_uint_least32_t events_dropped;                           /**< number of events dropped due to queue being full */
+    SemaphoreHandle_t profiling_mutex;                              /**< mutex used for profiliing */
+    SLIST_ENTRY(esp_event_loop_instance) next;                      /**< next event loop in the list */
+#endif
+} esp_event_loop_instance_t;
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -395,6 +395,80 @@ esp_err_t esp_hidh_dev_reports_get(esp_hidh_dev_t *dev, size_t *num_reports, esp
  */
 esp_err_t esp_hidh_dev_report_maps_get(esp_hidh_dev_t *dev, size_t *num_maps, esp_hid_raw_report_map_t **maps);
 
+/**
+ * Maximum payload of a single raw input sample. Reports longer than this are
+ * truncated on the raw path (the full report is still available through
+ * ESP_HIDH_INPUT_EVENT unless the raw path is configured to bypass it).
+ */
+#define ESP_HIDH_RAW_INPUT_MAX_LEN 64
+
+/**
+ * @brief One input report captured on the raw (low latency) path
+ */
+typedef struct {
+    esp_hidh_dev_t *dev;        /*!< device that sent the report */
+    esp_hid_usage_t usage;      /*!< hid usage of the report */
+    int64_t timestamp_us;       /*!< esp_timer time when the transport delivered the report */
+    uint16_t report_id;         /*!< report id */
+    uint16_t length;            /*!< number of valid bytes in data */
+    uint8_t map_index;          /*!< index of the report map the report belongs to */
+    uint8_t data[ESP_HIDH_RAW_INPUT_MAX_LEN];   /*!< report payload */
+} esp_hidh_raw_input_t;
+
+/**
+ * @brief Raw input path configuration
+ */
+typedef struct {
+    size_t queue_depth;         /*!< number of reports the ring can hold. 0 for the default of 16 */
+    bool coalesce_by_report;    /*!< keep only the newest queued sample per (device, report id) */
+    bool bypass_events;         /*!< do not additionally post ESP_HIDH_INPUT_EVENT for input reports */
+} esp_hidh_raw_input_config_t;
+
+/**
+ * @brief Enable the raw input report path
+ *
+ * Input reports are timestamped and queued directly from the transport
+ * callback, bypassing the shared event loop, so a reader blocked in
+ * esp_hidh_raw_input_read() wakes with bounded latency even when the event
+ * loop is busy. When the ring is full the oldest sample is dropped, and with
+ * coalesce_by_report a newer sample of the same report replaces the queued
+ * one, so a slow consumer always sees the freshest device state.
+ *
+ * @param config : raw input path configuration. NULL for the defaults
+ *
+ * @return: ESP_OK on success, ESP_ERR_INVALID_STATE if already enabled
+ */
+esp_err_t esp_hidh_raw_input_enable(const esp_hidh_raw_input_config_t *config);
+
+/**
+ * @brief Disable the raw input report path and free its ring
+ *
+ * Must not be called while another task is blocked in esp_hidh_raw_input_read().
+ *
+ * @return: ESP_OK on success, ESP_ERR_INVALID_STATE if not enabled
+ */
+esp_err_t esp_hidh_raw_input_disable(void);
+
+/**
+ * @brief Read the next input report from the raw path
+ * @param report     : location the report is copied to
+ * @param timeout_ms : how long to wait for a report. 0 to poll
+ *
+ * @return: ESP_OK on success, ESP_ERR_TIMEOUT if no report arrived in time,
+ *          ESP_ERR_INVALID_STATE if the raw path is not enabled
+ */
+esp_err_t esp_hidh_raw_input_read(esp_hidh_raw_input_t *report, uint32_t timeout_ms);
+
+/**
+ * @brief Get the number of reports dropped from the raw input ring
+ *
+ * Counts samples overwritten because the ring was full. Coalesced samples are
+ * not counted as drops.
+ *
+ * @return: number of dropped reports since the raw path was enabled
+ */
+uint32_t esp_hidh_raw_input_dropped_count(void);
+
 #include "esp_hidh_transport.h"
 
 #ifdef __cplusplus
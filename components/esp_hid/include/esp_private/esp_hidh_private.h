@@ -158,6 +158,14 @@ void esp_hidh_preprocess_event_handler(void *event_handler_arg, esp_event_base_t
                                        void *event_data);
 void esp_hidh_postprocess_event_handler(void *event_handler_arg, esp_event_base_t event_base, int32_t event_id,
                                         void *event_data);
+/**
+ * Feed an input report to the raw (low latency) path. Called by the
+ * transports in their callback context, before the report is posted to the
+ * event loop. Returns true when the report was consumed exclusively and the
+ * ESP_HIDH_INPUT_EVENT post should be skipped.
+ */
+bool esp_hidh_dev_input_received(esp_hidh_dev_t *dev, esp_hid_usage_t usage, uint8_t map_index, uint16_t report_id,
+                                 const uint8_t *data, uint16_t length);
 void esp_hidh_dev_lock(esp_hidh_dev_t *dev);
 void esp_hidh_dev_unlock(esp_hidh_dev_t *dev);
 void esp_hidh_dev_wait(esp_hidh_dev_t *dev);
@@ -494,13 +494,16 @@ void esp_hidh_gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gatt
                         p_param->feature.data = p_data->notify.value;
                         esp_event_post_to(event_loop_handle, ESP_HIDH_EVENTS, ESP_HIDH_FEATURE_EVENT, p_param, event_data_size, portMAX_DELAY);
                     } else {
-                        p_param->input.dev = dev;
-                        p_param->input.map_index = report->map_index;
-                        p_param->input.report_id = report->report_id;
-                        p_param->input.usage = report->usage;
-                        p_param->input.length = p_data->notify.value_len;
-                        p_param->input.data = p_data->notify.value;
-                        esp_event_post_to(event_loop_handle, ESP_HIDH_EVENTS, ESP_HIDH_INPUT_EVENT, p_param, event_data_size, portMAX_DELAY);
+                        if (!esp_hidh_dev_input_received(dev, report->usage, report->map_index, report->report_id,
+                                                         p_data->notify.value, p_data->notify.value_len)) {
+                            p_param->input.dev = dev;
+                            p_param->input.map_index = report->map_index;
+                            p_param->input.report_id = report->report_id;
+                            p_param->input.usage = report->usage;
+                            p_param->input.length = p_data->notify.value_len;
+                            p_param->input.data = p_data->notify.value;
+                            esp_event_post_to(event_loop_handle, ESP_HIDH_EVENTS, ESP_HIDH_INPUT_EVENT, p_param, event_data_size, portMAX_DELAY);
+                        }
                     }
 
                     if (p_param) {
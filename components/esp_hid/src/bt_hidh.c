@@ -710,8 +710,11 @@ static void esp_hh_cb(esp_hidh_cb_event_t event, esp_hidh_cb_param_t *param)
             p_param->input.length = data_len;
             p_param->input.data = p_data;
             esp_hidh_dev_unlock(dev);
-            esp_event_post_to(hidh_local_param.event_loop_handle, ESP_HIDH_EVENTS, ESP_HIDH_INPUT_EVENT, p_param,
-                              event_data_size, portMAX_DELAY);
+            if (!esp_hidh_dev_input_received(dev, _usage, p_param->input.map_index, p_param->input.report_id,
+                                             p_data, data_len)) {
+                esp_event_post_to(hidh_local_param.event_loop_handle, ESP_HIDH_EVENTS, ESP_HIDH_INPUT_EVENT, p_param,
+                                  event_data_size, portMAX_DELAY);
+            }
         }
         break;
     }
@@ -531,6 +531,150 @@ esp_err_t esp_hidh_dev_report_maps_get(esp_hidh_dev_t *dev, size_t *num_maps, es
     return ESP_OK;
 }
 
+/*
+ * Raw (low latency) input path
+ *
+ * A fixed ring of samples filled directly from the transport callbacks and
+ * drained by the application, so input reports do not have to ride the shared
+ * event loop. The ring is protected by a spinlock because the producers run
+ * in the Bluetooth stack tasks; the reader blocks on a counting semaphore.
+ * */
+
+typedef struct {
+    esp_hidh_raw_input_t *entries;
+    size_t depth;
+    size_t head;        //next slot to write
+    size_t tail;        //next slot to read
+    size_t count;
+    bool coalesce;
+    bool bypass;
+    uint32_t dropped;
+    SemaphoreHandle_t items;
+} esp_hidh_raw_input_ring_t;
+
+static esp_hidh_raw_input_ring_t s_raw_input;
+static portMUX_TYPE s_raw_input_lock = portMUX_INITIALIZER_UNLOCKED;
+
+esp_err_t esp_hidh_raw_input_enable(const esp_hidh_raw_input_config_t *config)
+{
+    if (s_raw_input.entries != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    size_t depth = (config && config->queue_depth) ? config->queue_depth : 16;
+    esp_hidh_raw_input_t *entries = (esp_hidh_raw_input_t *)calloc(depth, sizeof(esp_hidh_raw_input_t));
+    if (entries == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    SemaphoreHandle_t items = xSemaphoreCreateCounting(depth, 0);
+    if (items == NULL) {
+        free(entries);
+        return ESP_ERR_NO_MEM;
+    }
+    portENTER_CRITICAL(&s_raw_input_lock);
+    s_raw_input.depth = depth;
+    s_raw_input.head = 0;
+    s_raw_input.tail = 0;
+    s_raw_input.count = 0;
+    s_raw_input.coalesce = config ? config->coalesce_by_report : false;
+    s_raw_input.bypass = config ? config->bypass_events : false;
+    s_raw_input.dropped = 0;
+    s_raw_input.items = items;
+    s_raw_input.entries = entries;
+    portEXIT_CRITICAL(&s_raw_input_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_hidh_raw_input_disable(void)
+{
+    portENTER_CRITICAL(&s_raw_input_lock);
+    esp_hidh_raw_input_t *entries = s_raw_input.entries;
+    SemaphoreHandle_t items = s_raw_input.items;
+    memset(&s_raw_input, 0, sizeof(s_raw_input));
+    portEXIT_CRITICAL(&s_raw_input_lock);
+    if (entries == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    vSemaphoreDelete(items);
+    free(entries);
+    return ESP_OK;
+}
+
+esp_err_t esp_hidh_raw_input_read(esp_hidh_raw_input_t *report, uint32_t timeout_ms)
+{
+    if (report == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_raw_input.entries == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (xSemaphoreTake(s_raw_input.items, pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    portENTER_CRITICAL(&s_raw_input_lock);
+    if (s_raw_input.entries == NULL || s_raw_input.count == 0) {
+        portEXIT_CRITICAL(&s_raw_input_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    memcpy(report, &s_raw_input.entries[s_raw_input.tail], sizeof(esp_hidh_raw_input_t));
+    s_raw_input.tail = (s_raw_input.tail + 1) % s_raw_input.depth;
+    s_raw_input.count--;
+    portEXIT_CRITICAL(&s_raw_input_lock);
+    return ESP_OK;
+}
+
+uint32_t esp_hidh_raw_input_dropped_count(void)
+{
+    return s_raw_input.dropped;
+}
+
+bool esp_hidh_dev_input_received(esp_hidh_dev_t *dev, esp_hid_usage_t usage, uint8_t map_index, uint16_t report_id,
+                                 const uint8_t *data, uint16_t length)
+{
+    if (s_raw_input.entries == NULL) {
+        return false;
+    }
+    int64_t now = esp_timer_get_time();
+    bool queued = false;
+    portENTER_CRITICAL(&s_raw_input_lock);
+    if (s_raw_input.entries != NULL) {
+        esp_hidh_raw_input_t *slot = NULL;
+        if (s_raw_input.coalesce) {
+            //replace a still queued sample of the same report with the fresh one
+            for (size_t i = 0, idx = s_raw_input.tail; i < s_raw_input.count; i++, idx = (idx + 1) % s_raw_input.depth) {
+                if (s_raw_input.entries[idx].dev == dev && s_raw_input.entries[idx].report_id == report_id) {
+                    slot = &s_raw_input.entries[idx];
+                    break;
+                }
+            }
+        }
+        if (slot == NULL) {
+            if (s_raw_input.count == s_raw_input.depth) {
+                //full: drop the oldest sample so the reader keeps up with the device
+                s_raw_input.tail = (s_raw_input.tail + 1) % s_raw_input.depth;
+                s_raw_input.count--;
+                s_raw_input.dropped++;
+                xSemaphoreTake(s_raw_input.items, 0);
+            }
+            slot = &s_raw_input.entries[s_raw_input.head];
+            s_raw_input.head = (s_raw_input.head + 1) % s_raw_input.depth;
+            s_raw_input.count++;
+            queued = true;
+        }
+        slot->dev = dev;
+        slot->usage = usage;
+        slot->timestamp_us = now;
+        slot->report_id = report_id;
+        slot->length = (length > ESP_HIDH_RAW_INPUT_MAX_LEN) ? ESP_HIDH_RAW_INPUT_MAX_LEN : length;
+        slot->map_index = map_index;
+        memcpy(slot->data, data, slot->length);
+    }
+    portEXIT_CRITICAL(&s_raw_input_lock);
+    if (queued) {
+        xSemaphoreGive(s_raw_input.items);
+    }
+    return s_raw_input.bypass;
+}
+
 /*
  * Private Functions
  * */
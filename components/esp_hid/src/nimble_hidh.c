@@ -765,13 +765,17 @@ esp_hidh_gattc_event_handler(struct ble_gap_event *event, void *arg)
                         p_param->feature.data = ((uint8_t *)p_param) + sizeof(esp_hidh_event_data_t);
                         esp_event_post_to(event_loop_handle, ESP_HIDH_EVENTS, ESP_HIDH_FEATURE_EVENT, p_param, event_data_size, portMAX_DELAY);
                     } else {
-                        p_param->input.dev = dev;
-                        p_param->input.map_index = report->map_index;
-                        p_param->input.report_id = report->report_id;
-                        p_param->input.usage = report->usage;
-                        p_param->input.length = OS_MBUF_PKTLEN(event->notify_rx.om);
-                        p_param->input.data = ((uint8_t *)p_param) + sizeof(esp_hidh_event_data_t);
-                        esp_event_post_to(event_loop_handle, ESP_HIDH_EVENTS, ESP_HIDH_INPUT_EVENT, p_param, event_data_size, portMAX_DELAY);
+                        if (!esp_hidh_dev_input_received(dev, report->usage, report->map_index, report->report_id,
+                                                         ((uint8_t *)p_param) + sizeof(esp_hidh_event_data_t),
+                                                         OS_MBUF_PKTLEN(event->notify_rx.om))) {
+                            p_param->input.dev = dev;
+                            p_param->input.map_index = report->map_index;
+                            p_param->input.report_id = report->report_id;
+                            p_param->input.usage = report->usage;
+                            p_param->input.length = OS_MBUF_PKTLEN(event->notify_rx.om);
+                            p_param->input.data = ((uint8_t *)p_param) + sizeof(esp_hidh_event_data_t);
+                            esp_event_post_to(event_loop_handle, ESP_HIDH_EVENTS, ESP_HIDH_INPUT_EVENT, p_param, event_data_size, portMAX_DELAY);
+                        }
                     }
 
                     if (p_param) {
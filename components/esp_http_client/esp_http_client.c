@@ -100,6 +100,95 @@ typedef enum {
     SESSION_TICKET_SAVED,
 } session_ticket_state_t;
 
+#if CONFIG_ESP_HTTP_CLIENT_TLS_SESSION_CACHE
+/**
+ * Global cache of TLS client sessions keyed by host:port, shared by all
+ * client handles. Sessions are checked out (removed) for the duration of a
+ * handshake, so one is never used by two concurrent connects, and a fresh
+ * session is checked back in after every successful https connection.
+ */
+typedef struct {
+    char                     *host;         /*!< Peer hostname, NULL if the entry is unused */
+    int                      port;          /*!< Peer port */
+    esp_tls_client_session_t *session;      /*!< Cached session, NULL while checked out */
+    uint32_t                 use_counter;   /*!< Global counter value at last use, for LRU eviction */
+} tls_session_cache_entry_t;
+
+static tls_session_cache_entry_t s_tls_session_cache[CONFIG_ESP_HTTP_CLIENT_TLS_SESSION_CACHE_SIZE];
+static uint32_t s_tls_session_use_counter;
+static portMUX_TYPE s_tls_session_cache_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static esp_tls_client_session_t *tls_session_cache_checkout(const char *host, int port)
+{
+    esp_tls_client_session_t *session = NULL;
+
+    portENTER_CRITICAL(&s_tls_session_cache_lock);
+    for (int i = 0; i < CONFIG_ESP_HTTP_CLIENT_TLS_SESSION_CACHE_SIZE; i++) {
+        tls_session_cache_entry_t *entry = &s_tls_session_cache[i];
+        if (entry->host && entry->session && entry->port == port && strcasecmp(entry->host, host) == 0) {
+            session = entry->session;
+            entry->session = NULL;
+            entry->use_counter = ++s_tls_session_use_counter;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_tls_session_cache_lock);
+    return session;
+}
+
+static void tls_session_cache_checkin(const char *host, int port, esp_tls_client_session_t *session)
+{
+    /* Prepared outside the critical section; only consumed when a new entry is claimed */
+    char *host_copy = strdup(host);
+    if (!host_copy) {
+        /* Allocation failed; drop the session instead of caching it */
+        esp_tls_free_client_session(session);
+        return;
+    }
+    esp_tls_client_session_t *displaced_session = NULL;
+    char *displaced_host = NULL;
+
+    portENTER_CRITICAL(&s_tls_session_cache_lock);
+    tls_session_cache_entry_t *match = NULL;
+    tls_session_cache_entry_t *free_slot = NULL;
+    tls_session_cache_entry_t *lru = NULL;
+    for (int i = 0; i < CONFIG_ESP_HTTP_CLIENT_TLS_SESSION_CACHE_SIZE; i++) {
+        tls_session_cache_entry_t *entry = &s_tls_session_cache[i];
+        if (entry->host == NULL) {
+            if (free_slot == NULL) {
+                free_slot = entry;
+            }
+        } else if (entry->port == port && strcasecmp(entry->host, host) == 0) {
+            match = entry;
+            break;
+        } else if (lru == NULL || entry->use_counter < lru->use_counter) {
+            lru = entry;
+        }
+    }
+    if (match) {
+        /* Same peer: replace its session in place */
+        displaced_session = match->session;
+        match->session = session;
+        match->use_counter = ++s_tls_session_use_counter;
+    } else {
+        /* Claim a free slot, or evict the least recently used entry */
+        tls_session_cache_entry_t *target = free_slot ? free_slot : lru;
+        displaced_session = target->session;
+        displaced_host = target->host;
+        target->host = host_copy;
+        host_copy = NULL;
+        target->port = port;
+        target->session = session;
+        target->use_counter = ++s_tls_session_use_counter;
+    }
+    portEXIT_CRITICAL(&s_tls_session_cache_lock);
+
+    esp_tls_free_client_session(displaced_session);
+    free(displaced_host);
+    free(host_copy);
+}
+#endif // CONFIG_ESP_HTTP_CLIENT_TLS_SESSION_CACHE
+
 /**
  * HTTP client class
  */
@@ -122,6 +211,8 @@ struct esp_http_client {
     char                        *current_header_key;
     char                        *current_header_value;
     int                         post_len;
+    esp_http_client_body_provider_cb_t body_provider_cb;
+    void                        *body_provider_data;
     connection_info_t           connection_info;
     bool                        is_chunk_complete;
     esp_http_state_t            state;
@@ -1478,9 +1569,33 @@ static esp_err_t esp_http_client_connect(esp_http_client_handle_t client)
 #endif
             return ESP_ERR_HTTP_INVALID_TRANSPORT;
         }
+#if CONFIG_ESP_HTTP_CLIENT_TLS_SESSION_CACHE
+        /* Try to resume a TLS session cached by any client handle for this
+         * host:port. Skipped for handles that manage their own session via
+         * `save_client_session`, and in async mode, where the session would
+         * have to stay valid across multiple connect calls. */
+        esp_tls_client_session_t *cached_session = NULL;
+        bool use_session_cache = (strcasecmp(client->connection_info.scheme, "https") == 0) &&
+                                 !client->is_async &&
+                                 (client->session_ticket_state == SESSION_TICKET_UNUSED);
+        if (use_session_cache) {
+            cached_session = tls_session_cache_checkout(client->connection_info.host, client->connection_info.port);
+            if (cached_session) {
+                ESP_LOGD(TAG, "Resuming TLS session for %s:%d", client->connection_info.host, client->connection_info.port);
+                esp_transport_ssl_set_client_session(client->transport, cached_session);
+            }
+        }
+#endif
         if (!client->is_async) {
             if (esp_transport_connect(client->transport, client->connection_info.host, client->connection_info.port, client->timeout_ms) < 0) {
                 ESP_LOGE(TAG, "Connection failed, sock < 0");
+#if CONFIG_ESP_HTTP_CLIENT_TLS_SESSION_CACHE
+                if (cached_session) {
+                    /* Session tickets are single-use; drop the failed one */
+                    esp_transport_ssl_set_client_session(client->transport, NULL);
+                    esp_tls_free_client_session(cached_session);
+                }
+#endif
                 return ESP_ERR_HTTP_CONNECT;
             }
         } else {
@@ -1506,6 +1621,18 @@ static esp_err_t esp_http_client_connect(esp_http_client_handle_t client)
             client->session_ticket_state = SESSION_TICKET_SAVED;
         }
 #endif
+#if CONFIG_ESP_HTTP_CLIENT_TLS_SESSION_CACHE
+        if (use_session_cache) {
+            /* The checked-out ticket was consumed by the handshake; deposit
+             * a fresh session for the next connection to this peer */
+            esp_transport_ssl_set_client_session(client->transport, NULL);
+            esp_tls_free_client_session(cached_session);
+            esp_tls_client_session_t *fresh_session = esp_transport_ssl_get_client_session(client->transport);
+            if (fresh_session) {
+                tls_session_cache_checkin(client->connection_info.host, client->connection_info.port, fresh_session);
+            }
+        }
+#endif
 
     }
     return ESP_OK;
@@ -1616,12 +1743,69 @@ static esp_err_t esp_http_client_request_send(esp_http_client_handle_t client, i
     return ESP_OK;
 }
 
+static esp_err_t esp_http_client_send_provided_body(esp_http_client_handle_t client)
+{
+    const bool chunked = (client->post_len < 0);
+    int body_left = client->post_len;
+
+    while (true) {
+        const char *buf = NULL;
+        int len = client->body_provider_cb(client, &buf, client->body_provider_data);
+        if (len < 0 || (len > 0 && buf == NULL)) {
+            ESP_LOGE(TAG, "Body provider returned an error");
+            return ESP_ERR_HTTP_WRITE_DATA;
+        }
+        if (len == 0) {
+            break;
+        }
+        if (chunked) {
+            char chunk_hdr[16];
+            int hdr_len = snprintf(chunk_hdr, sizeof(chunk_hdr), "%x\r\n", len);
+            if (esp_http_client_write(client, chunk_hdr, hdr_len) < hdr_len) {
+                ESP_LOGE(TAG, "Error write chunk header");
+                return ESP_ERR_HTTP_WRITE_DATA;
+            }
+        } else {
+            if (len > body_left) {
+                ESP_LOGE(TAG, "Body provider exceeded the announced Content-Length");
+                return ESP_ERR_HTTP_WRITE_DATA;
+            }
+            body_left -= len;
+        }
+        /* The provided block is written straight from the caller's buffer */
+        if (esp_http_client_write(client, buf, len) < len) {
+            ESP_LOGE(TAG, "Error write body data");
+            return ESP_ERR_HTTP_WRITE_DATA;
+        }
+        if (chunked && esp_http_client_write(client, "\r\n", 2) < 2) {
+            ESP_LOGE(TAG, "Error write chunk trailer");
+            return ESP_ERR_HTTP_WRITE_DATA;
+        }
+    }
+
+    if (chunked) {
+        if (esp_http_client_write(client, "0\r\n\r\n", 5) < 5) {
+            ESP_LOGE(TAG, "Error write last chunk");
+            return ESP_ERR_HTTP_WRITE_DATA;
+        }
+    } else if (body_left > 0) {
+        ESP_LOGE(TAG, "Body provider ended %d bytes short of Content-Length", body_left);
+        return ESP_ERR_HTTP_WRITE_DATA;
+    }
+
+    client->state = HTTP_STATE_REQ_COMPLETE_DATA;
+    return ESP_OK;
+}
+
 static esp_err_t esp_http_client_send_post_data(esp_http_client_handle_t client)
 {
     if (client->state != HTTP_STATE_REQ_COMPLETE_HEADER) {
         ESP_LOGE(TAG, "Invalid state");
         return ESP_ERR_INVALID_STATE;
     }
+    if (client->body_provider_cb) {
+        return esp_http_client_send_provided_body(client);
+    }
     if (!(client->post_data && client->post_len)) {
         goto success;
     }
@@ -1722,6 +1906,24 @@ int esp_http_client_get_post_field(esp_http_client_handle_t client, char **data)
     return 0;
 }
 
+esp_err_t esp_http_client_set_body_provider(esp_http_client_handle_t client, esp_http_client_body_provider_cb_t body_cb, void *user_data, int len)
+{
+    if (client == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (body_cb && client->is_async) {
+        ESP_LOGE(TAG, "Body provider is not supported with is_async enabled");
+        return ESP_ERR_INVALID_ARG;
+    }
+    client->body_provider_cb = body_cb;
+    client->body_provider_data = user_data;
+    if (body_cb) {
+        client->post_len = len;
+        ESP_LOGD(TAG, "set body provider, length = %d", len);
+    }
+    return ESP_OK;
+}
+
 int esp_http_client_get_status_code(esp_http_client_handle_t client)
 {
     return client->response->status_code;
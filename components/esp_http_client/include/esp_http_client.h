@@ -314,6 +314,51 @@ esp_err_t esp_http_client_set_post_field(esp_http_client_handle_t client, const
  */
 int esp_http_client_get_post_field(esp_http_client_handle_t client, char **data);
 
+/**
+ * @brief      Request body provider callback, see esp_http_client_set_body_provider()
+ *
+ *             Called repeatedly while the request body is being sent. On each call the
+ *             callback sets `*buf` to the next block of body data and returns its length.
+ *             The block is written to the socket directly from the caller's memory - it is
+ *             not copied - so it must remain valid until the callback is invoked again.
+ *             Return 0 when the body is complete, or -1 to abort the request. After the
+ *             callback has returned 0, the next invocation starts the body of a new
+ *             request (e.g. after a redirect or an authorization retry).
+ *
+ * @param[in]  client     The esp_http_client handle
+ * @param[out] buf        Set this to the next block of body data
+ * @param[in]  user_data  Context pointer given to esp_http_client_set_body_provider()
+ *
+ * @return     Length of the block at `*buf`, 0 at end of body, -1 on error
+ */
+typedef int (*esp_http_client_body_provider_cb_t)(esp_http_client_handle_t client, const char **buf, void *user_data);
+
+/**
+ * @brief      Stream the request body from caller owned buffers, this function must be called before `esp_http_client_perform`.
+ *
+ *             Instead of assembling the body into a single buffer for
+ *             esp_http_client_set_post_field(), the body is pulled block by block from the
+ *             callback during `esp_http_client_perform` and each block is written to the
+ *             socket without an intermediate copy. If `len` is negative the total body
+ *             length is unknown and the request is sent with chunked transfer encoding,
+ *             framing each provided block as one chunk; otherwise a Content-Length header
+ *             is sent and the callback must provide exactly `len` bytes. When set, the
+ *             provider takes precedence over a post field set with
+ *             esp_http_client_set_post_field(). Pass a NULL callback to remove the
+ *             provider. Not supported together with `is_async` enabled in the client
+ *             configuration.
+ *
+ * @param[in]  client     The esp_http_client handle
+ * @param[in]  body_cb    Body provider callback, or NULL to remove a previously set one
+ * @param[in]  user_data  Context pointer passed to every callback invocation
+ * @param[in]  len        Total body length in bytes, or -1 if unknown (chunked encoding)
+ *
+ * @return
+ *  - ESP_OK
+ *  - ESP_ERR_INVALID_ARG
+ */
+esp_err_t esp_http_client_set_body_provider(esp_http_client_handle_t client, esp_http_client_body_provider_cb_t body_cb, void *user_data, int len);
+
 /**
  * @brief      Set http request header, this function must be called after esp_http_client_init and before any
  *             perform function
@@ -9,6 +9,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <sys/types.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <http_parser.h>
@@ -16,6 +17,9 @@
 #include <esp_err.h>
 #include <esp_event.h>
 #include <esp_event_base.h>
+#if __has_include("esp_partition.h")
+#include "esp_partition.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -76,7 +80,9 @@ initializer that should be kept in sync
         .keep_alive_count = 0,                          \
         .open_fn = NULL,                                \
         .close_fn = NULL,                               \
-        .uri_match_fn = NULL                            \
+        .uri_match_fn = NULL,                           \
+        .req_arena_size = 0,                            \
+        .req_arena_caps = (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) \
 }
 
 #define ESP_ERR_HTTPD_BASE              (0xb000)                    /*!< Starting number of HTTPD error codes */
@@ -277,6 +283,22 @@ typedef struct httpd_config {
      * of the `httpd_uri_match_func_t` function prototype)
      */
     httpd_uri_match_func_t uri_match_fn;
+
+    /**
+     * Size in bytes of the optional per-request memory arena.
+     *
+     * When non-zero, the server creates an arena of this size at startup and
+     * URI handlers can draw request-scoped scratch memory from it with
+     * httpd_req_arena_alloc(). The arena is reset automatically when the
+     * request completes. Set to 0 (default) to disable.
+     */
+    size_t req_arena_size;
+
+    /**
+     * Memory capabilities for the per-request arena, see MALLOC_CAP_*.
+     * Only used when req_arena_size is non-zero.
+     */
+    uint32_t req_arena_caps;
 } httpd_config_t;
 
 /**
@@ -456,6 +478,25 @@ typedef struct httpd_uri {
      */
     const char *supported_subprotocol;
 #endif
+
+#ifdef CONFIG_HTTPD_URI_CACHE
+    /**
+     * Flag for enabling the response cache for this URI.
+     * The complete response the handler sends with httpd_resp_send() is kept
+     * together with an ETag, and further GET requests arriving within
+     * cache_ttl_ms are answered from the cached buffer without invoking the
+     * handler (or with a bodiless 304 when the client's If-None-Match header
+     * matches). Only complete "200 OK" responses are cached; chunked
+     * responses always run the handler.
+     */
+    bool cache_response;
+
+    /**
+     * Lifetime of a cached response in milliseconds. After expiry the next
+     * request runs the handler again and refreshes the cache.
+     */
+    uint32_t cache_ttl_ms;
+#endif
 } httpd_uri_t;
 
 /**
@@ -542,6 +583,57 @@ esp_err_t httpd_unregister_uri_handler(httpd_handle_t handle,
  */
 esp_err_t httpd_unregister_uri(httpd_handle_t handle, const char* uri);
 
+#ifdef CONFIG_HTTPD_URI_CACHE
+/**
+ * @brief   Pin static content into the response cache of a URI
+ *
+ * Installs an externally owned buffer as the cached response of a URI that was
+ * registered with the cache_response flag. The buffer is served zero-copy, so
+ * it may live in flash (e.g. memory-mapped with esp_partition_mmap() or an
+ * embedded file), and it never expires; the registered handler is only invoked
+ * again after httpd_uri_cache_invalidate() or when the handler is
+ * unregistered. The buffer and content type string must stay valid until then.
+ *
+ * @note    Must not be called while the server may be serving the URI from
+ *          another task; call it before the handler is reachable or from the
+ *          server context (e.g. via httpd_queue_work()).
+ *
+ * @param[in] handle        Handle to HTTPD server instance
+ * @param[in] uri           URI string of a handler registered with cache_response
+ * @param[in] content_type  Content type to serve the buffer with
+ * @param[in] buf           Response body, must remain valid while cached
+ * @param[in] buf_len       Length of the response body
+ *
+ * @return
+ *  - ESP_OK : On successfully priming the cache entry
+ *  - ESP_ERR_INVALID_ARG : Null arguments or zero length
+ *  - ESP_ERR_NOT_FOUND   : No cache-enabled handler registered for the URI
+ *  - ESP_ERR_HTTPD_ALLOC_MEM : Failed to allocate the cache entry
+ */
+esp_err_t httpd_uri_cache_prime(httpd_handle_t handle, const char *uri,
+                                const char *content_type, const char *buf, size_t buf_len);
+
+/**
+ * @brief   Drop cached responses so the next request runs the handler again
+ *
+ * Use this when the state behind a cached URI changes before its TTL expires,
+ * or to release a buffer pinned with httpd_uri_cache_prime().
+ *
+ * @note    Must not be called while the server may be serving the URI from
+ *          another task; call it from the server context (e.g. via
+ *          httpd_queue_work()).
+ *
+ * @param[in] handle    Handle to HTTPD server instance
+ * @param[in] uri       URI string, or NULL to invalidate all cached responses
+ *
+ * @return
+ *  - ESP_OK : On success (also when NULL uri matched no entries)
+ *  - ESP_ERR_INVALID_ARG : Null handle
+ *  - ESP_ERR_NOT_FOUND   : No cached response for the specified URI
+ */
+esp_err_t httpd_uri_cache_invalidate(httpd_handle_t handle, const char *uri);
+#endif
+
 /** End of URI Handlers
  * @}
  */
@@ -853,6 +945,39 @@ esp_err_t httpd_req_async_handler_begin(httpd_req_t *r, httpd_req_t **out);
  */
 esp_err_t httpd_req_async_handler_complete(httpd_req_t *r);
 
+#if defined CONFIG_HTTPD_WORKER_POOL || defined __DOXYGEN__
+/**
+ * @brief   Dispatch a request to the server's worker task pool
+ *
+ * Creates an async copy of the request (see httpd_req_async_handler_begin())
+ * and queues it for one of the CONFIG_HTTPD_WORKER_POOL_TASKS worker tasks,
+ * so the main server task can continue serving other sessions while the
+ * handler runs. The worker invokes the given handler with the request copy
+ * and marks the request as completed once the handler returns.
+ *
+ * Per-session serialization is preserved: the server will not process
+ * further data on the session until the dispatched handler finishes, so
+ * requests of a single client never run concurrently with each other.
+ *
+ * @note
+ * - On success, the calling URI handler must return ESP_OK immediately
+ *   without accessing `r` any further.
+ * - If the dispatched handler returns an error, the session is closed,
+ *   same as when a URI handler fails on the server task.
+ *
+ * @param[in] r       The request to dispatch
+ * @param[in] handler Function invoked on a worker task with the request copy
+ *
+ * @return
+ *  - ESP_OK : request queued for the worker pool
+ *  - ESP_ERR_INVALID_ARG : null argument
+ *  - ESP_ERR_NO_MEM : failed to allocate the async request copy
+ *  - ESP_FAIL : no space in the worker queue (another request of this
+ *               session has already been dispatched)
+ */
+esp_err_t httpd_req_dispatch_to_worker(httpd_req_t *r, esp_err_t (*handler)(httpd_req_t *r));
+#endif /* CONFIG_HTTPD_WORKER_POOL */
+
 /**
  * @brief   Get the Socket Descriptor from the HTTP request
  *
@@ -1042,6 +1167,27 @@ esp_err_t httpd_query_key_value(const char *qry, const char *key, char *val, siz
  */
 esp_err_t httpd_req_get_cookie_val(httpd_req_t *req, const char *cookie_name, char *val, size_t *val_size);
 
+/**
+ * @brief   Allocate request-scoped scratch memory from the server's arena
+ *
+ * Hands out memory from the per-request arena configured through the
+ * req_arena_size field of httpd_config_t. Allocation is a pointer bump with
+ * no heap locking, and the memory is released automatically (in one step)
+ * when the request completes, so it must not be freed by the caller and must
+ * not be used after the URI handler returns.
+ *
+ * @note    This API is supposed to be called only from the context of
+ *          a URI handler where httpd_req_t* request pointer is valid
+ *
+ * @param[in] r     The request being responded to
+ * @param[in] size  Number of bytes to allocate
+ *
+ * @return
+ *  - Pointer to the allocated memory
+ *  - NULL : If the arena is disabled, exhausted, or the request pointer is invalid
+ */
+void *httpd_req_arena_alloc(httpd_req_t *r, size_t size);
+
 /**
  * @brief Test if a URI matches the given wildcard template.
  *
@@ -1186,10 +1332,71 @@ static inline esp_err_t httpd_resp_sendstr_chunk(httpd_req_t *r, const char *str
     return httpd_resp_send_chunk(r, str, (str == NULL) ? 0 : HTTPD_RESP_USE_STRLEN);
 }
 
+/**
+ * @brief   API to send the contents of an open file as HTTP response.
+ *
+ * This API streams len bytes of the file, starting at offset, directly from
+ * the VFS into the socket using an internal DMA-capable bounce buffer of
+ * CONFIG_HTTPD_SENDFILE_BUF_LEN bytes. The response is sent with a
+ * Content-Length header, avoiding the per-chunk length framing and the
+ * handler-side read buffer of a httpd_resp_send_chunk() loop.
+ *
+ * The status, content type and additional headers set on the request are
+ * applied the same way as for httpd_resp_send().
+ *
+ * @note
+ *  - This API is supposed to be called only from the context of
+ *    a URI handler where httpd_req_t* request pointer is valid.
+ *  - Once this API is called, the request has been responded to.
+ *  - The file descriptor remains owned by the caller and is not closed.
+ *
+ * @param[in] r       The request being responded to
+ * @param[in] fd      Open file descriptor to read the content from
+ * @param[in] offset  Offset in the file to start sending from, or -1 to
+ *                    send from the current file position
+ * @param[in] len     Number of bytes to send; must match the Content-Length
+ *                    announced to the client, so the file must be at least
+ *                    offset + len bytes long
+ *
+ * @return
+ *  - ESP_OK : On successfully sending the response
+ *  - ESP_ERR_INVALID_ARG : Null request pointer or invalid fd/offset
+ *  - ESP_ERR_NO_MEM : Failed to allocate the bounce buffer
+ *  - ESP_ERR_HTTPD_RESP_HDR    : Essential headers are too large for internal buffer
+ *  - ESP_ERR_HTTPD_RESP_SEND   : Error in raw send or short file read
+ *  - ESP_ERR_HTTPD_INVALID_REQ : Invalid request
+ */
+esp_err_t httpd_resp_sendfile(httpd_req_t *r, int fd, off_t offset, size_t len);
+
+#if __has_include("esp_partition.h") || defined __DOXYGEN__
+/**
+ * @brief   API to send flash partition contents as HTTP response.
+ *
+ * Variant of httpd_resp_sendfile() for content stored in a flash partition.
+ * The requested range is memory mapped and sent directly from the mapped
+ * flash cache region, so no copy into RAM is made at all.
+ *
+ * @param[in] r          The request being responded to
+ * @param[in] partition  Partition holding the content
+ * @param[in] offset     Offset of the content within the partition
+ * @param[in] len        Number of bytes to send
+ *
+ * @return
+ *  - ESP_OK : On successfully sending the response
+ *  - ESP_ERR_INVALID_ARG : Null request/partition pointer or range outside the partition
+ *  - ESP_ERR_NO_MEM : Not enough free MMU pages to map the range
+ *  - ESP_ERR_HTTPD_RESP_HDR    : Essential headers are too large for internal buffer
+ *  - ESP_ERR_HTTPD_RESP_SEND   : Error in raw send
+ *  - ESP_ERR_HTTPD_INVALID_REQ : Invalid request
+ */
+esp_err_t httpd_resp_send_partition(httpd_req_t *r, const esp_partition_t *partition, size_t offset, size_t len);
+#endif
+
 /* Some commonly used status codes */
 #define HTTPD_200      "200 OK"                     /*!< HTTP Response 200 */
 #define HTTPD_204      "204 No Content"             /*!< HTTP Response 204 */
 #define HTTPD_207      "207 Multi-Status"           /*!< HTTP Response 207 */
+#define HTTPD_304      "304 Not Modified"           /*!< HTTP Response 304 */
 #define HTTPD_400      "400 Bad Request"            /*!< HTTP Response 400 */
 #define HTTPD_404      "404 Not Found"              /*!< HTTP Response 404 */
 #define HTTPD_408      "408 Request Timeout"        /*!< HTTP Response 408 */
@@ -1762,6 +1969,25 @@ esp_err_t httpd_ws_send_frame(httpd_req_t *req, httpd_ws_frame_t *pkt);
  */
 esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frame);
 
+/**
+ * @brief Low level send of multiple WebSocket frames out of the scope of current request
+ * using internally configured httpd send function
+ *
+ * Consecutive small frames are coalesced into a single TCP write, so sending a burst
+ * of frames (e.g. periodic telemetry fan-out) costs far fewer syscalls and TCP segments
+ * than calling httpd_ws_send_frame_async() per frame.
+ *
+ * @param[in] hd      Server instance data
+ * @param[in] fd      Socket descriptor for sending data
+ * @param[in] frames  Array of WebSocket frames
+ * @param[in] nframes Number of frames in the array
+ * @return
+ *  - ESP_OK                    : On successful
+ *  - ESP_FAIL                  : When socket errors occurs
+ *  - ESP_ERR_INVALID_ARG       : Argument is invalid (null or non-WebSocket)
+ */
+esp_err_t httpd_ws_send_frames_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frames, size_t nframes);
+
 /**
  * @brief Checks the supplied socket descriptor if it belongs to any active client
  * of this server instance and if the websoket protocol is active
@@ -16,8 +16,14 @@
 #include <esp_err.h>
 
 #include <esp_http_server.h>
+#include <esp_arena.h>
 #include "osal.h"
 
+#if CONFIG_HTTPD_WORKER_POOL
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -79,9 +85,28 @@ struct sock_db {
     esp_err_t (*ws_handler)(httpd_req_t *r);   /*!< WebSocket handler, leave to null if it's not WebSocket */
     bool ws_control_frames;                         /*!< WebSocket flag indicating that control frames should be passed to user handlers */
     void *ws_user_ctx;                         /*!< Pointer to user context data which will be available to handler for websocket*/
+#if CONFIG_HTTPD_WS_DEFLATE
+    bool ws_deflate_enabled;                /*!< True if permessage-deflate was negotiated during handshake */
+#endif
 #endif
 };
 
+#if CONFIG_HTTPD_URI_CACHE
+/**
+ * @brief   Cached response of a URI handler registered with cache_response
+ */
+struct httpd_cache_entry {
+    const httpd_uri_t *owner;       /*!< Internal copy of the URI handler this entry belongs to */
+    char *buf;                      /*!< Response body, NULL while the entry holds no response */
+    size_t len;                     /*!< Length of the response body */
+    const char *content_type;       /*!< Content type the response was sent with */
+    bool owned;                     /*!< True if buf and content_type were allocated by the cache */
+    char etag[16];                  /*!< Quoted entity tag of the body, e.g. "\"1a2b3c4d\"" */
+    int64_t expiry_us;              /*!< Timestamp after which the entry is stale, INT64_MAX for primed entries */
+    struct httpd_cache_entry *next; /*!< Next entry of this server instance */
+};
+#endif
+
 /**
  * @brief   Auxiliary data structure for use during reception and processing
  *          of requests and temporarily keeping responses
@@ -100,11 +125,17 @@ struct httpd_req_aux {
         const char *value;
     } *resp_hdrs;                                   /*!< Additional headers in response packet */
     struct http_parser_url url_parse_res;           /*!< URL parsing result, used for retrieving URL elements */
+#if CONFIG_HTTPD_URI_CACHE
+    struct httpd_cache_entry *cache_entry;          /*!< Entry to fill from the next httpd_resp_send(), NULL when not capturing */
+#endif
 #ifdef CONFIG_HTTPD_WS_SUPPORT
     bool ws_handshake_detect;                       /*!< WebSocket handshake detection flag */
     httpd_ws_type_t ws_type;                        /*!< WebSocket frame type */
     bool ws_final;                                  /*!< WebSocket FIN bit (final frame or not) */
     uint8_t mask_key[4];                            /*!< WebSocket mask key for this payload */
+#if CONFIG_HTTPD_WS_DEFLATE
+    bool ws_deflated;                               /*!< WebSocket RSV1 bit (payload is deflated) */
+#endif
 #endif
 };
 
@@ -126,6 +157,14 @@ struct httpd_data {
     httpd_uri_t **hd_calls;                 /*!< Registered URI handlers */
     struct httpd_req hd_req;                /*!< The current HTTPD request */
     struct httpd_req_aux hd_req_aux;        /*!< Additional data about the HTTPD request kept unexposed */
+    esp_arena_t *req_arena;                 /*!< Optional per-request scratch arena, NULL when disabled */
+#if CONFIG_HTTPD_URI_CACHE
+    struct httpd_cache_entry *cache_entries; /*!< Cached URI handler responses, see CONFIG_HTTPD_URI_CACHE */
+#endif
+#if CONFIG_HTTPD_WORKER_POOL
+    QueueHandle_t worker_queue;             /*!< Queue of requests dispatched to the worker pool */
+    SemaphoreHandle_t worker_exit_sem;      /*!< Counting semaphore used to join worker tasks on stop */
+#endif
     uint64_t lru_counter;                   /*!< LRU counter */
 
     /* Array of registered error handler functions */
@@ -333,6 +372,70 @@ void httpd_unregister_all_uri_handlers(struct httpd_data *hd);
  */
 bool httpd_validate_req_ptr(httpd_req_t *r);
 
+#if CONFIG_HTTPD_URI_CACHE
+/**
+ * @brief   Look up the cache entry of a URI handler, creating it on first use
+ *
+ * @param[in] hd   Server instance data
+ * @param[in] uri  Internal copy of the registered URI handler
+ *
+ * @return Cache entry, or NULL if allocation failed
+ */
+struct httpd_cache_entry *httpd_cache_entry_get(struct httpd_data *hd, const httpd_uri_t *uri);
+
+/**
+ * @brief   Check whether a cache entry holds a response that has not expired
+ *
+ * @param[in] entry Cache entry
+ *
+ * @return True if the entry can be served
+ */
+bool httpd_cache_entry_fresh(const struct httpd_cache_entry *entry);
+
+/**
+ * @brief   Serve a request straight from a cache entry
+ *
+ * Sends the cached body with its stored content type and ETag, or a bodiless
+ * 304 when the request carries a matching If-None-Match header.
+ *
+ * @param[in] r     The request to respond to
+ * @param[in] entry Fresh cache entry to serve
+ *
+ * @return
+ *  - ESP_OK    : on successfully sending the response
+ *  - ESP_FAIL  : otherwise
+ */
+esp_err_t httpd_cache_serve(httpd_req_t *r, struct httpd_cache_entry *entry);
+
+/**
+ * @brief   Capture a handler response into the entry armed in the request aux
+ *
+ * Called from httpd_resp_send() before the response is staged, so the
+ * computed ETag header is included in this first response as well. Failures
+ * are not fatal: the response is sent regardless and the entry stays stale.
+ *
+ * @param[in] r       The request being responded to
+ * @param[in] buf     Response body
+ * @param[in] buf_len Length of the response body
+ */
+void httpd_cache_store(httpd_req_t *r, const char *buf, size_t buf_len);
+
+/**
+ * @brief   Free the cache entry of a URI handler about to be unregistered
+ *
+ * @param[in] hd  Server instance data
+ * @param[in] uri Internal copy of the registered URI handler
+ */
+void httpd_cache_drop(struct httpd_data *hd, const httpd_uri_t *uri);
+
+/**
+ * @brief   Free all cache entries of a server instance
+ *
+ * @param[in] hd  Server instance data
+ */
+void httpd_cache_purge(struct httpd_data *hd);
+#endif
+
 /* httpd_validate_req_ptr() adds some overhead to frequently used APIs,
  * and is useful mostly for debugging, so it's preferable to disable
  * the check by default and enable it only if necessary */
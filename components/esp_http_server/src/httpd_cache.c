@@ -0,0 +1,227 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <esp_log.h>
+#include <esp_err.h>
+
+#include <esp_http_server.h>
+#include "esp_httpd_priv.h"
+
+#ifdef CONFIG_HTTPD_URI_CACHE
+
+#include <esp_rom_crc.h>
+
+static const char *TAG = "httpd_cache";
+
+/* Release the response held by an entry, keeping the entry itself
+ * registered so it can be refilled by the next handler execution */
+static void httpd_cache_entry_release(struct httpd_cache_entry *entry)
+{
+    if (entry->owned) {
+        free(entry->buf);
+        free((char *)entry->content_type);
+    }
+    entry->buf = NULL;
+    entry->content_type = NULL;
+    entry->len = 0;
+    entry->owned = false;
+    entry->expiry_us = 0;
+}
+
+static void httpd_cache_set_etag(struct httpd_cache_entry *entry)
+{
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t *)entry->buf, entry->len);
+    snprintf(entry->etag, sizeof(entry->etag), "\"%08" PRIx32 "\"", crc);
+}
+
+struct httpd_cache_entry *httpd_cache_entry_get(struct httpd_data *hd, const httpd_uri_t *uri)
+{
+    struct httpd_cache_entry *entry;
+    for (entry = hd->cache_entries; entry != NULL; entry = entry->next) {
+        if (entry->owner == uri) {
+            return entry;
+        }
+    }
+
+    entry = calloc(1, sizeof(struct httpd_cache_entry));
+    if (entry == NULL) {
+        ESP_LOGW(TAG, LOG_FMT("no memory for cache entry of %s"), uri->uri);
+        return NULL;
+    }
+    entry->owner = uri;
+    entry->next = hd->cache_entries;
+    hd->cache_entries = entry;
+    return entry;
+}
+
+bool httpd_cache_entry_fresh(const struct httpd_cache_entry *entry)
+{
+    return entry->buf != NULL && esp_timer_get_time() < entry->expiry_us;
+}
+
+esp_err_t httpd_cache_serve(httpd_req_t *r, struct httpd_cache_entry *entry)
+{
+    httpd_resp_set_type(r, entry->content_type);
+    httpd_resp_set_hdr(r, "ETag", entry->etag);
+
+    /* A client revalidating with the tag we handed out earlier only
+     * needs to learn that its copy is still current */
+    char match[sizeof(entry->etag)];
+    if (httpd_req_get_hdr_value_str(r, "If-None-Match", match, sizeof(match)) == ESP_OK &&
+        strcmp(match, entry->etag) == 0) {
+        ESP_LOGD(TAG, LOG_FMT("ETag match for %s, responding 304"), r->uri);
+        httpd_resp_set_status(r, HTTPD_304);
+        return httpd_resp_send(r, NULL, 0);
+    }
+
+    ESP_LOGD(TAG, LOG_FMT("serving %s from cache"), r->uri);
+    return httpd_resp_send(r, entry->buf, entry->len);
+}
+
+void httpd_cache_store(httpd_req_t *r, const char *buf, size_t buf_len)
+{
+    struct httpd_req_aux *ra = r->aux;
+    struct httpd_data *hd = (struct httpd_data *) r->handle;
+    struct httpd_cache_entry *entry = ra->cache_entry;
+
+    /* One response per request, whether captured or not */
+    ra->cache_entry = NULL;
+
+    /* When the handler was dispatched to a worker task or finishes an
+     * asynchronous request, this runs concurrently with the server task
+     * possibly serving the entry. Skip the update; the entry stays stale
+     * and a later response sent from the server task refreshes it. */
+    if (httpd_os_thread_handle() != hd->hd_td.handle) {
+        return;
+    }
+
+    /* Only complete 200 responses are worth replaying to other clients */
+    if (strcmp(ra->status, HTTPD_200) != 0 || buf == NULL || buf_len == 0) {
+        return;
+    }
+
+    /* An expired primed entry can only appear through a race with
+     * httpd_uri_cache_prime(); leave the external buffer alone */
+    if (entry->buf != NULL && !entry->owned) {
+        return;
+    }
+
+    char *body = malloc(buf_len);
+    char *type = strdup(ra->content_type);
+    if (body == NULL || type == NULL) {
+        ESP_LOGW(TAG, LOG_FMT("no memory to cache response of %s"), r->uri);
+        free(body);
+        free(type);
+        return;
+    }
+    memcpy(body, buf, buf_len);
+
+    httpd_cache_entry_release(entry);
+    entry->buf = body;
+    entry->len = buf_len;
+    entry->content_type = type;
+    entry->owned = true;
+    httpd_cache_set_etag(entry);
+    entry->expiry_us = esp_timer_get_time() + (int64_t) entry->owner->cache_ttl_ms * 1000;
+
+    /* Let this first response carry the tag too, so pollers can revalidate */
+    httpd_resp_set_hdr(r, "ETag", entry->etag);
+}
+
+void httpd_cache_drop(struct httpd_data *hd, const httpd_uri_t *uri)
+{
+    struct httpd_cache_entry **it = &hd->cache_entries;
+    while (*it != NULL) {
+        if ((*it)->owner == uri) {
+            struct httpd_cache_entry *entry = *it;
+            *it = entry->next;
+            httpd_cache_entry_release(entry);
+            free(entry);
+            return;
+        }
+        it = &(*it)->next;
+    }
+}
+
+void httpd_cache_purge(struct httpd_data *hd)
+{
+    while (hd->cache_entries != NULL) {
+        struct httpd_cache_entry *entry = hd->cache_entries;
+        hd->cache_entries = entry->next;
+        httpd_cache_entry_release(entry);
+        free(entry);
+    }
+}
+
+esp_err_t httpd_uri_cache_prime(httpd_handle_t handle, const char *uri,
+                                const char *content_type, const char *buf, size_t buf_len)
+{
+    if (handle == NULL || uri == NULL || content_type == NULL || buf == NULL || buf_len == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct httpd_data *hd = (struct httpd_data *) handle;
+
+    /* The serve path only looks up entries of cache-enabled handlers, so
+     * priming anything else would just leak the entry */
+    httpd_uri_t *owner = NULL;
+    for (int i = 0; i < hd->config.max_uri_handlers; i++) {
+        if (!hd->hd_calls[i]) {
+            break;
+        }
+        if (hd->hd_calls[i]->cache_response &&
+            strcmp(hd->hd_calls[i]->uri, uri) == 0) {
+            owner = hd->hd_calls[i];
+            break;
+        }
+    }
+    if (owner == NULL) {
+        ESP_LOGW(TAG, LOG_FMT("no cache-enabled handler for URI %s"), uri);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    struct httpd_cache_entry *entry = httpd_cache_entry_get(hd, owner);
+    if (entry == NULL) {
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+
+    httpd_cache_entry_release(entry);
+    entry->buf = (char *) buf;
+    entry->len = buf_len;
+    entry->content_type = content_type;
+    entry->owned = false;
+    httpd_cache_set_etag(entry);
+    entry->expiry_us = INT64_MAX;
+    ESP_LOGD(TAG, LOG_FMT("primed %s with %" NEWLIB_NANO_COMPAT_FORMAT " bytes"),
+             uri, NEWLIB_NANO_COMPAT_CAST(buf_len));
+    return ESP_OK;
+}
+
+esp_err_t httpd_uri_cache_invalidate(httpd_handle_t handle, const char *uri)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct httpd_data *hd = (struct httpd_data *) handle;
+    bool found = false;
+    for (struct httpd_cache_entry *entry = hd->cache_entries; entry != NULL; entry = entry->next) {
+        if (uri == NULL || strcmp(entry->owner->uri, uri) == 0) {
+            httpd_cache_entry_release(entry);
+            found = true;
+        }
+    }
+    if (uri != NULL && !found) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    return ESP_OK;
+}
+
+#endif /* CONFIG_HTTPD_URI_CACHE */
@@ -19,6 +19,10 @@
 #if CONFIG_HTTPD_QUEUE_WORK_BLOCKING
 #include "freertos/semphr.h"
 #endif
+#if CONFIG_HTTPD_WORKER_POOL
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#endif
 
 #if defined(CONFIG_LWIP_MAX_SOCKETS)
 #define HTTPD_MAX_SOCKETS CONFIG_LWIP_MAX_SOCKETS
@@ -34,6 +38,7 @@ static const int DEFAULT_KEEP_ALIVE_COUNT= 3;
 typedef struct {
     fd_set *fdset;
     struct httpd_data *hd;
+    bool found_pending;
 } process_session_context_t;
 
 static const char *TAG = "httpd";
@@ -121,6 +126,17 @@ static esp_err_t httpd_accept_conn(struct httpd_data *hd, int listen_fd)
         }
 #endif // __APPLE__
     }
+#if CONFIG_HTTPD_CONN_TCP_NODELAY
+    /* Disable Nagle's algorithm for the whole session, so that responses
+     * (coalesced into single writes by httpd_txrx) are not held back
+     * waiting for the ACK of the previous response. This cuts a round trip
+     * for clients issuing frequent keep-alive requests. */
+    int nodelay = 1;
+    if (setsockopt(new_fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay)) < 0) {
+        /* If failed to turn on TCP_NODELAY, throw warning and continue */
+        ESP_LOGW(TAG, LOG_FMT("error in setsockopt TCP_NODELAY (%d)"), errno);
+    }
+#endif
     if (ESP_OK != httpd_sess_new(hd, new_fd)) {
         ESP_LOGE(TAG, LOG_FMT("session creation failed"));
         goto exit;
@@ -271,6 +287,21 @@ static int httpd_process_session(struct sock_db *session, void *context)
     return 1;
 }
 
+// Called for each session from httpd_server to check for buffered data
+static int httpd_find_pending_session(struct sock_db *session, void *context)
+{
+    process_session_context_t *ctx = (process_session_context_t *)context;
+
+    if ((!session) || (session->fd < 0) || (session->for_async_req)) {
+        return 1;
+    }
+    if (httpd_sess_pending(ctx->hd, session)) {
+        ctx->found_pending = true;
+        return 0;
+    }
+    return 1;
+}
+
 /* Manage in-coming connection or data requests */
 static esp_err_t httpd_server(struct httpd_data *hd)
 {
@@ -290,8 +321,19 @@ static esp_err_t httpd_server(struct httpd_data *hd)
     tmp_max_fd = maxfd;
     maxfd = MAX(hd->ctrl_fd, tmp_max_fd);
 
+    /* If a session has buffered data left over from a previous read (e.g.
+     * a pipelined keep-alive request received back-to-back with the last
+     * one), do not block in select: poll once and fall through, so the
+     * buffered request is parsed without waiting for new socket activity */
+    process_session_context_t pending_context = {
+        .hd = hd
+    };
+    httpd_sess_enum(hd, httpd_find_pending_session, &pending_context);
+    struct timeval poll_tv = {};
+
     ESP_LOGD(TAG, LOG_FMT("doing select maxfd+1 = %d"), maxfd + 1);
-    int active_cnt = select(maxfd + 1, &read_set, NULL, NULL, NULL);
+    int active_cnt = select(maxfd + 1, &read_set, NULL, NULL,
+                            pending_context.found_pending ? &poll_tv : NULL);
     if (active_cnt < 0) {
         ESP_LOGE(TAG, LOG_FMT("error in select (%d)"), errno);
         httpd_sess_delete_invalid(hd);
@@ -422,6 +464,121 @@ static esp_err_t httpd_server_init(struct httpd_data *hd)
     return ESP_OK;
 }
 
+#if CONFIG_HTTPD_WORKER_POOL
+struct httpd_worker_item {
+    httpd_req_t *req;                       /* Async request copy, NULL instructs the worker to exit */
+    esp_err_t (*handler)(httpd_req_t *r);   /* Handler to run with the request copy */
+};
+
+static void httpd_worker_thread(void *arg)
+{
+    struct httpd_data *hd = (struct httpd_data *) arg;
+    struct httpd_worker_item item;
+
+    while (1) {
+        if (xQueueReceive(hd->worker_queue, &item, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (item.req == NULL) {
+            /* Exit item queued by httpd_worker_pool_stop() */
+            break;
+        }
+        int fd = httpd_req_to_sockfd(item.req);
+        esp_err_t ret = item.handler(item.req);
+        httpd_req_async_handler_complete(item.req);
+        if (ret != ESP_OK) {
+            /* Session deletion must happen on the server task, so only
+             * queue the closure from here. This matches the main task's
+             * handling of a URI handler that returns failure. */
+            ESP_LOGD(TAG, LOG_FMT("worker handler failed, closing session %d"), fd);
+            httpd_sess_trigger_close(hd, fd);
+        }
+    }
+    xSemaphoreGive(hd->worker_exit_sem);
+    httpd_os_thread_delete();
+}
+
+static void httpd_worker_pool_join(struct httpd_data *hd, int count)
+{
+    struct httpd_worker_item exit_item = { .req = NULL, .handler = NULL };
+    for (int i = 0; i < count; i++) {
+        xQueueSend(hd->worker_queue, &exit_item, portMAX_DELAY);
+    }
+    /* Workers drain queued requests in front of the exit items before
+     * signalling, so all dispatched work is completed by this point */
+    for (int i = 0; i < count; i++) {
+        xSemaphoreTake(hd->worker_exit_sem, portMAX_DELAY);
+    }
+}
+
+static void httpd_worker_pool_stop(struct httpd_data *hd)
+{
+    if (hd->worker_queue == NULL) {
+        return;
+    }
+    httpd_worker_pool_join(hd, CONFIG_HTTPD_WORKER_POOL_TASKS);
+    vQueueDelete(hd->worker_queue);
+    vSemaphoreDelete(hd->worker_exit_sem);
+    hd->worker_queue = NULL;
+    hd->worker_exit_sem = NULL;
+}
+
+static esp_err_t httpd_worker_pool_start(struct httpd_data *hd)
+{
+    /* Each session can have at most one dispatched request in flight
+     * (the server skips sessions with for_async_req set), so a queue of
+     * max_open_sockets items can never overflow */
+    hd->worker_queue = xQueueCreate(hd->config.max_open_sockets, sizeof(struct httpd_worker_item));
+    if (hd->worker_queue == NULL) {
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+    hd->worker_exit_sem = xSemaphoreCreateCounting(CONFIG_HTTPD_WORKER_POOL_TASKS, 0);
+    if (hd->worker_exit_sem == NULL) {
+        vQueueDelete(hd->worker_queue);
+        hd->worker_queue = NULL;
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+    for (int i = 0; i < CONFIG_HTTPD_WORKER_POOL_TASKS; i++) {
+        othread_t worker;
+        if (httpd_os_thread_create(&worker, "httpd_wrk",
+                                   hd->config.stack_size,
+                                   hd->config.task_priority,
+                                   httpd_worker_thread, hd,
+                                   hd->config.core_id,
+                                   hd->config.task_caps) != ESP_OK) {
+            ESP_LOGE(TAG, LOG_FMT("Failed to create worker task"));
+            httpd_worker_pool_join(hd, i);
+            vQueueDelete(hd->worker_queue);
+            vSemaphoreDelete(hd->worker_exit_sem);
+            hd->worker_queue = NULL;
+            hd->worker_exit_sem = NULL;
+            return ESP_ERR_HTTPD_TASK;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_req_dispatch_to_worker(httpd_req_t *r, esp_err_t (*handler)(httpd_req_t *r))
+{
+    if (r == NULL || handler == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct httpd_data *hd = (struct httpd_data *) r->handle;
+    struct httpd_worker_item item = { .handler = handler };
+    esp_err_t ret = httpd_req_async_handler_begin(r, &item.req);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (xQueueSend(hd->worker_queue, &item, 0) != pdTRUE) {
+        /* Only possible if a single session dispatches more than one
+         * request at a time, which the caller must not do */
+        httpd_req_async_handler_complete(item.req);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+#endif /* CONFIG_HTTPD_WORKER_POOL */
+
 static struct httpd_data *httpd_create(const httpd_config_t *config)
 {
     /* Allocate memory for httpd instance data */
@@ -461,6 +618,18 @@ static struct httpd_data *httpd_create(const httpd_config_t *config)
         free(hd);
         return NULL;
     }
+    if (config->req_arena_size) {
+        hd->req_arena = esp_arena_create(config->req_arena_size, config->req_arena_caps);
+        if (!hd->req_arena) {
+            ESP_LOGE(TAG, LOG_FMT("Failed to allocate memory for HTTP request arena"));
+            free(hd->err_handler_fns);
+            free(ra->resp_hdrs);
+            free(hd->hd_sd);
+            free(hd->hd_calls);
+            free(hd);
+            return NULL;
+        }
+    }
     /* Save the configuration for this instance */
     hd->config = *config;
     return hd;
@@ -470,6 +639,7 @@ static void httpd_delete(struct httpd_data *hd)
 {
     struct httpd_req_aux *ra = &hd->hd_req_aux;
     /* Free memory of httpd instance data */
+    esp_arena_destroy(hd->req_arena);
     free(hd->err_handler_fns);
     free(ra->resp_hdrs);
     free(hd->hd_sd);
@@ -521,7 +691,18 @@ esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config)
     }
 #endif
 
+#if CONFIG_HTTPD_WORKER_POOL
+    esp_err_t pool_err = httpd_worker_pool_start(hd);
+    if (pool_err != ESP_OK) {
+        httpd_delete(hd);
+        return pool_err;
+    }
+#endif
+
     if (httpd_server_init(hd) != ESP_OK) {
+#if CONFIG_HTTPD_WORKER_POOL
+        httpd_worker_pool_stop(hd);
+#endif
         httpd_delete(hd);
         return ESP_FAIL;
     }
@@ -534,6 +715,9 @@ esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config)
                                hd->config.core_id,
                                hd->config.task_caps) != ESP_OK) {
         /* Failed to launch task */
+#if CONFIG_HTTPD_WORKER_POOL
+        httpd_worker_pool_stop(hd);
+#endif
         httpd_delete(hd);
         return ESP_ERR_HTTPD_TASK;
     }
@@ -551,6 +735,12 @@ esp_err_t httpd_stop(httpd_handle_t handle)
         return ESP_ERR_INVALID_ARG;
     }
 
+#if CONFIG_HTTPD_WORKER_POOL
+    /* Stop the workers while the server task is still running, as in-flight
+     * handlers need live sessions and the control socket to finish */
+    httpd_worker_pool_stop(hd);
+#endif
+
     struct httpd_ctrl_data msg;
     memset(&msg, 0, sizeof(msg));
     msg.hc_msg = HTTPD_CTRL_SHUTDOWN;
@@ -686,6 +686,9 @@ static void init_req_aux(struct httpd_req_aux *ra, httpd_config_t *config)
     ra->first_chunk_sent = 0;
     ra->req_hdrs_count = 0;
     ra->resp_hdrs_count = 0;
+#if CONFIG_HTTPD_URI_CACHE
+    ra->cache_entry = NULL;
+#endif
 #if CONFIG_HTTPD_WS_SUPPORT
     ra->ws_handshake_detect = false;
 #endif
@@ -714,6 +717,9 @@ static void httpd_req_cleanup(httpd_req_t *r)
     ra->sd->free_ctx = r->free_ctx;
     ra->sd->ignore_sess_ctx_changes = r->ignore_sess_ctx_changes;
 
+    /* Recycle all request-scoped arena allocations in one step */
+    esp_arena_reset(((struct httpd_data *)r->handle)->req_arena);
+
     /* Clear out the request and request_aux structures */
     ra->sd = NULL;
     r->handle = NULL;
@@ -830,6 +836,17 @@ esp_err_t httpd_req_delete(struct httpd_data *hd)
     return ESP_OK;
 }
 
+void *httpd_req_arena_alloc(httpd_req_t *r, size_t size)
+{
+    if (r == NULL || !httpd_valid_req(r)) {
+        return NULL;
+    }
+
+    struct httpd_data *hd = (struct httpd_data *) r->handle;
+    /* esp_arena_alloc() handles the disabled (NULL arena) case */
+    return esp_arena_alloc(hd->req_arena, size);
+}
+
 /* Validates the request to prevent users from calling APIs, that are to
  * be called only inside URI handler, outside the handler context
  */
@@ -6,12 +6,16 @@
 
 
 #include <errno.h>
+#include <unistd.h>
 #include <esp_log.h>
 #include <esp_err.h>
 
 #include <esp_http_server.h>
 #include "esp_httpd_priv.h"
 #include <netinet/tcp.h>
+#if !CONFIG_IDF_TARGET_LINUX
+#include <esp_heap_caps.h>
+#endif
 
 static const char *TAG = "httpd_txrx";
 
@@ -225,6 +229,70 @@ esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type)
     return ESP_OK;
 }
 
+/* Flush response bytes staged in the scratch buffer to the socket */
+static esp_err_t httpd_resp_flush_staged(httpd_req_t *r, size_t *staged_len)
+{
+    struct httpd_req_aux *ra = r->aux;
+    if (*staged_len == 0) {
+        return ESP_OK;
+    }
+    if (httpd_send_all(r, ra->scratch, *staged_len) != ESP_OK) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    *staged_len = 0;
+    return ESP_OK;
+}
+
+/* Stage response bytes in the scratch buffer so that the status line,
+ * headers and small bodies coalesce into a single socket write, instead
+ * of producing one small TCP segment per header fragment. Buffers that
+ * do not fit the scratch buffer bypass staging and go to the socket
+ * directly, after flushing whatever was staged before them. */
+static esp_err_t httpd_resp_stage(httpd_req_t *r, size_t *staged_len, const char *buf, size_t buf_len)
+{
+    struct httpd_req_aux *ra = r->aux;
+    if (buf_len >= sizeof(ra->scratch)) {
+        esp_err_t ret = httpd_resp_flush_staged(r, staged_len);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        if (httpd_send_all(r, buf, buf_len) != ESP_OK) {
+            return ESP_ERR_HTTPD_RESP_SEND;
+        }
+        return ESP_OK;
+    }
+    if (buf_len > sizeof(ra->scratch) - *staged_len) {
+        esp_err_t ret = httpd_resp_flush_staged(r, staged_len);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    memcpy(ra->scratch + *staged_len, buf, buf_len);
+    *staged_len += buf_len;
+    return ESP_OK;
+}
+
+/* Stage the additional headers set with httpd_resp_set_hdr(), followed by
+ * the blank line terminating the header section */
+static esp_err_t httpd_resp_stage_addl_hdrs(httpd_req_t *r, size_t *staged_len)
+{
+    struct httpd_req_aux *ra = r->aux;
+    const char *colon_separator = ": ";
+    const char *cr_lf_seperator = "\r\n";
+
+    for (unsigned i = 0; i < ra->resp_hdrs_count; i++) {
+        if (httpd_resp_stage(r, staged_len, ra->resp_hdrs[i].field, strlen(ra->resp_hdrs[i].field)) != ESP_OK ||
+                httpd_resp_stage(r, staged_len, colon_separator, strlen(colon_separator)) != ESP_OK ||
+                httpd_resp_stage(r, staged_len, ra->resp_hdrs[i].value, strlen(ra->resp_hdrs[i].value)) != ESP_OK ||
+                httpd_resp_stage(r, staged_len, cr_lf_seperator, strlen(cr_lf_seperator)) != ESP_OK) {
+            return ESP_ERR_HTTPD_RESP_SEND;
+        }
+    }
+
+    /* End header section */
+    return httpd_resp_stage(r, staged_len, cr_lf_seperator, strlen(cr_lf_seperator));
+}
+
 esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len)
 {
     if (r == NULL) {
@@ -237,13 +305,19 @@ esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len)
 
     struct httpd_req_aux *ra = r->aux;
     const char *httpd_hdr_str = "HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %d\r\n";
-    const char *colon_separator = ": ";
-    const char *cr_lf_seperator = "\r\n";
 
     if (buf_len == HTTPD_RESP_USE_STRLEN) {
         buf_len = strlen(buf);
     }
 
+#ifdef CONFIG_HTTPD_URI_CACHE
+    /* Capture the response of a cache-enabled URI handler before staging,
+     * so the computed ETag header is part of this response as well */
+    if (ra->cache_entry) {
+        httpd_cache_store(r, buf, buf_len);
+    }
+#endif
+
     /* Request headers are no longer available */
     ra->req_hdrs_count = 0;
 
@@ -252,44 +326,25 @@ esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len)
                  ra->status, ra->content_type, buf_len) >= sizeof(ra->scratch)) {
         return ESP_ERR_HTTPD_RESP_HDR;
     }
+    size_t staged_len = strlen(ra->scratch);
 
-    /* Sending essential headers */
-    if (httpd_send_all(r, ra->scratch, strlen(ra->scratch)) != ESP_OK) {
+    /* Stage additional headers based on set_header */
+    if (httpd_resp_stage_addl_hdrs(r, &staged_len) != ESP_OK) {
         return ESP_ERR_HTTPD_RESP_SEND;
     }
 
-    /* Sending additional headers based on set_header */
-    for (unsigned i = 0; i < ra->resp_hdrs_count; i++) {
-        /* Send header field */
-        if (httpd_send_all(r, ra->resp_hdrs[i].field, strlen(ra->resp_hdrs[i].field)) != ESP_OK) {
-            return ESP_ERR_HTTPD_RESP_SEND;
-        }
-        /* Send ': ' */
-        if (httpd_send_all(r, colon_separator, strlen(colon_separator)) != ESP_OK) {
-            return ESP_ERR_HTTPD_RESP_SEND;
-        }
-        /* Send header value */
-        if (httpd_send_all(r, ra->resp_hdrs[i].value, strlen(ra->resp_hdrs[i].value)) != ESP_OK) {
-            return ESP_ERR_HTTPD_RESP_SEND;
-        }
-        /* Send CR + LF */
-        if (httpd_send_all(r, cr_lf_seperator, strlen(cr_lf_seperator)) != ESP_OK) {
+    /* Stage content behind the headers, so that small responses leave
+     * in a single TCP segment */
+    if (buf && buf_len) {
+        if (httpd_resp_stage(r, &staged_len, buf, buf_len) != ESP_OK) {
             return ESP_ERR_HTTPD_RESP_SEND;
         }
     }
-
-    /* End header section */
-    if (httpd_send_all(r, cr_lf_seperator, strlen(cr_lf_seperator)) != ESP_OK) {
+    if (httpd_resp_flush_staged(r, &staged_len) != ESP_OK) {
         return ESP_ERR_HTTPD_RESP_SEND;
     }
     esp_http_server_dispatch_event(HTTP_SERVER_EVENT_HEADERS_SENT, &(ra->sd->fd), sizeof(int));
 
-    /* Sending content */
-    if (buf && buf_len) {
-        if (httpd_send_all(r, buf, buf_len) != ESP_OK) {
-            return ESP_ERR_HTTPD_RESP_SEND;
-        }
-    }
     esp_http_server_event_data evt_data = {
         .fd = ra->sd->fd,
         .data_len = buf_len,
@@ -314,66 +369,43 @@ esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len
 
     struct httpd_req_aux *ra = r->aux;
     const char *httpd_chunked_hdr_str = "HTTP/1.1 %s\r\nContent-Type: %s\r\nTransfer-Encoding: chunked\r\n";
-    const char *colon_separator = ": ";
-    const char *cr_lf_seperator = "\r\n";
 
     /* Request headers are no longer available */
     ra->req_hdrs_count = 0;
 
+    size_t staged_len = 0;
     if (!ra->first_chunk_sent) {
         /* Size of essential headers is limited by scratch buffer size */
         if (snprintf(ra->scratch, sizeof(ra->scratch), httpd_chunked_hdr_str,
                      ra->status, ra->content_type) >= sizeof(ra->scratch)) {
             return ESP_ERR_HTTPD_RESP_HDR;
         }
+        staged_len = strlen(ra->scratch);
 
-        /* Sending essential headers */
-        if (httpd_send_all(r, ra->scratch, strlen(ra->scratch)) != ESP_OK) {
-            return ESP_ERR_HTTPD_RESP_SEND;
-        }
-
-        /* Sending additional headers based on set_header */
-        for (unsigned i = 0; i < ra->resp_hdrs_count; i++) {
-            /* Send header field */
-            if (httpd_send_all(r, ra->resp_hdrs[i].field, strlen(ra->resp_hdrs[i].field)) != ESP_OK) {
-                return ESP_ERR_HTTPD_RESP_SEND;
-            }
-            /* Send ': ' */
-            if (httpd_send_all(r, colon_separator, strlen(colon_separator)) != ESP_OK) {
-                return ESP_ERR_HTTPD_RESP_SEND;
-            }
-            /* Send header value */
-            if (httpd_send_all(r, ra->resp_hdrs[i].value, strlen(ra->resp_hdrs[i].value)) != ESP_OK) {
-                return ESP_ERR_HTTPD_RESP_SEND;
-            }
-            /* Send CR + LF */
-            if (httpd_send_all(r, cr_lf_seperator, strlen(cr_lf_seperator)) != ESP_OK) {
-                return ESP_ERR_HTTPD_RESP_SEND;
-            }
-        }
-
-        /* End header section */
-        if (httpd_send_all(r, cr_lf_seperator, strlen(cr_lf_seperator)) != ESP_OK) {
+        /* Stage additional headers based on set_header */
+        if (httpd_resp_stage_addl_hdrs(r, &staged_len) != ESP_OK) {
             return ESP_ERR_HTTPD_RESP_SEND;
         }
         ra->first_chunk_sent = true;
     }
 
-    /* Sending chunked content */
+    /* Stage chunked content behind the headers, so that the chunk length
+     * line, payload and trailing CRLF leave in a single socket write */
     char len_str[10];
     snprintf(len_str, sizeof(len_str), "%lx\r\n", (long)buf_len);
-    if (httpd_send_all(r, len_str, strlen(len_str)) != ESP_OK) {
+    if (httpd_resp_stage(r, &staged_len, len_str, strlen(len_str)) != ESP_OK) {
         return ESP_ERR_HTTPD_RESP_SEND;
     }
 
     if (buf) {
-        if (httpd_send_all(r, buf, (size_t) buf_len) != ESP_OK) {
+        if (httpd_resp_stage(r, &staged_len, buf, (size_t) buf_len) != ESP_OK) {
             return ESP_ERR_HTTPD_RESP_SEND;
         }
     }
 
     /* Indicate end of chunk */
-    if (httpd_send_all(r, "\r\n", strlen("\r\n")) != ESP_OK) {
+    if (httpd_resp_stage(r, &staged_len, "\r\n", strlen("\r\n")) != ESP_OK ||
+            httpd_resp_flush_staged(r, &staged_len) != ESP_OK) {
         return ESP_ERR_HTTPD_RESP_SEND;
     }
     esp_http_server_event_data evt_data = {
@@ -385,6 +417,119 @@ esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len
     return ESP_OK;
 }
 
+/* Send the status line, essential and additional headers of a fixed length
+ * response, shared by httpd_resp_sendfile() and httpd_resp_send_partition() */
+static esp_err_t httpd_resp_send_fixed_len_hdrs(httpd_req_t *r, size_t content_len)
+{
+    struct httpd_req_aux *ra = r->aux;
+    const char *httpd_hdr_str = "HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %d\r\n";
+
+    /* Request headers are no longer available */
+    ra->req_hdrs_count = 0;
+
+    /* Size of essential headers is limited by scratch buffer size */
+    if (snprintf(ra->scratch, sizeof(ra->scratch), httpd_hdr_str,
+                 ra->status, ra->content_type, (int) content_len) >= sizeof(ra->scratch)) {
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    size_t staged_len = strlen(ra->scratch);
+
+    /* Stage additional headers based on set_header and flush the complete
+     * header section as a single socket write */
+    if (httpd_resp_stage_addl_hdrs(r, &staged_len) != ESP_OK ||
+            httpd_resp_flush_staged(r, &staged_len) != ESP_OK) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    esp_http_server_dispatch_event(HTTP_SERVER_EVENT_HEADERS_SENT, &(ra->sd->fd), sizeof(int));
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_sendfile(httpd_req_t *r, int fd, off_t offset, size_t len)
+{
+    if (r == NULL || fd < 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (!httpd_valid_req(r)) {
+        return ESP_ERR_HTTPD_INVALID_REQ;
+    }
+
+    if (offset >= 0 && lseek(fd, offset, SEEK_SET) != offset) {
+        ESP_LOGW(TAG, LOG_FMT("failed to seek file"));
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    /* The bounce buffer is allocated per call rather than per session, so the
+     * memory is only held while a file is actually being served */
+#if CONFIG_IDF_TARGET_LINUX
+    char *buf = malloc(CONFIG_HTTPD_SENDFILE_BUF_LEN);
+#else
+    char *buf = heap_caps_malloc(CONFIG_HTTPD_SENDFILE_BUF_LEN, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+#endif
+    if (buf == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = httpd_resp_send_fixed_len_hdrs(r, len);
+
+    size_t remaining = len;
+    while (ret == ESP_OK && remaining > 0) {
+        ssize_t read_len = read(fd, buf, MIN(remaining, CONFIG_HTTPD_SENDFILE_BUF_LEN));
+        if (read_len <= 0) {
+            /* The Content-Length has been announced; a short read leaves the
+             * response truncated and the connection must be torn down */
+            ESP_LOGW(TAG, LOG_FMT("file read failed or short (errno = %d)"), errno);
+            ret = ESP_ERR_HTTPD_RESP_SEND;
+            break;
+        }
+        if (httpd_send_all(r, buf, read_len) != ESP_OK) {
+            ret = ESP_ERR_HTTPD_RESP_SEND;
+            break;
+        }
+        remaining -= read_len;
+    }
+    free(buf);
+
+    if (ret == ESP_OK) {
+        struct httpd_req_aux *ra = r->aux;
+        esp_http_server_event_data evt_data = {
+            .fd = ra->sd->fd,
+            .data_len = len,
+        };
+        esp_http_server_dispatch_event(HTTP_SERVER_EVENT_SENT_DATA, &evt_data, sizeof(esp_http_server_event_data));
+    }
+    return ret;
+}
+
+#if __has_include("esp_partition.h")
+esp_err_t httpd_resp_send_partition(httpd_req_t *r, const esp_partition_t *partition, size_t offset, size_t len)
+{
+    if (r == NULL || partition == NULL ||
+            offset > partition->size || len > partition->size - offset) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (!httpd_valid_req(r)) {
+        return ESP_ERR_HTTPD_INVALID_REQ;
+    }
+
+    /* Map the range into the flash cache and send straight from it; the
+     * socket layer reads the data out of the mapped region, so no copy into
+     * RAM is made here at all */
+    const void *map_ptr;
+    esp_partition_mmap_handle_t map_handle;
+    esp_err_t ret = esp_partition_mmap(partition, offset, len, ESP_PARTITION_MMAP_DATA, &map_ptr, &map_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, LOG_FMT("partition mmap failed (0x%x)"), ret);
+        return ret;
+    }
+
+    ret = httpd_resp_send(r, map_ptr, len);
+    esp_partition_munmap(map_handle);
+    return ret;
+}
+#endif // __has_include("esp_partition.h")
+
 esp_err_t httpd_resp_send_err(httpd_req_t *req, httpd_err_code_t error, const char *usr_msg)
 {
     esp_err_t ret;
@@ -454,7 +599,9 @@ esp_err_t httpd_resp_send_err(httpd_req_t *req, httpd_err_code_t error, const ch
     httpd_resp_set_status(req, status);
     httpd_resp_set_type(req, HTTPD_TYPE_TEXT);
 
-#ifdef CONFIG_HTTPD_ERR_RESP_NO_DELAY
+/* With CONFIG_HTTPD_CONN_TCP_NODELAY the option is already set on the
+ * session socket, so skip toggling it around the error response */
+#if CONFIG_HTTPD_ERR_RESP_NO_DELAY && !CONFIG_HTTPD_CONN_TCP_NODELAY
     /* Use TCP_NODELAY option to force socket to send data in buffer
      * This ensures that the error message is sent before the socket
      * is closed */
@@ -470,7 +617,7 @@ esp_err_t httpd_resp_send_err(httpd_req_t *req, httpd_err_code_t error, const ch
     /* Send HTTP error message */
     ret = httpd_resp_send(req, msg, HTTPD_RESP_USE_STRLEN);
 
-#ifdef CONFIG_HTTPD_ERR_RESP_NO_DELAY
+#if CONFIG_HTTPD_ERR_RESP_NO_DELAY && !CONFIG_HTTPD_CONN_TCP_NODELAY
     /* If TCP_NODELAY was set successfully above, time to disable it */
     if (nodelay == 1) {
         nodelay = 0;
@@ -495,7 +642,9 @@ esp_err_t httpd_resp_send_custom_err(httpd_req_t *req, const char *status, const
     httpd_resp_set_status(req, status);
     httpd_resp_set_type(req, HTTPD_TYPE_TEXT);
 
-#ifdef CONFIG_HTTPD_ERR_RESP_NO_DELAY
+/* With CONFIG_HTTPD_CONN_TCP_NODELAY the option is already set on the
+ * session socket, so skip toggling it around the error response */
+#if CONFIG_HTTPD_ERR_RESP_NO_DELAY && !CONFIG_HTTPD_CONN_TCP_NODELAY
     /* Use TCP_NODELAY option to force socket to send data in buffer
      * This ensures that the error message is sent before the socket
      * is closed */
@@ -511,7 +660,7 @@ esp_err_t httpd_resp_send_custom_err(httpd_req_t *req, const char *status, const
     /* Send HTTP error message */
     esp_err_t ret = httpd_resp_send(req, msg, HTTPD_RESP_USE_STRLEN);
 
-#ifdef CONFIG_HTTPD_ERR_RESP_NO_DELAY
+#if CONFIG_HTTPD_ERR_RESP_NO_DELAY && !CONFIG_HTTPD_CONN_TCP_NODELAY
     /* If TCP_NODELAY was set successfully above, time to disable it */
     if (nodelay == 1) {
         nodelay = 0;
@@ -174,6 +174,10 @@ esp_err_t httpd_register_uri_handler(httpd_handle_t handle,
             } else {
                 hd->hd_calls[i]->supported_subprotocol = NULL;
             }
+#endif
+#ifdef CONFIG_HTTPD_URI_CACHE
+            hd->hd_calls[i]->cache_response = uri_handler->cache_response;
+            hd->hd_calls[i]->cache_ttl_ms  = uri_handler->cache_ttl_ms;
 #endif
             ESP_LOGD(TAG, LOG_FMT("[%d] installed %s"), i, uri_handler->uri);
             return ESP_OK;
@@ -200,6 +204,9 @@ esp_err_t httpd_unregister_uri_handler(httpd_handle_t handle,
             (strcmp(hd->hd_calls[i]->uri, uri) == 0)) {  // Then match URI string
             ESP_LOGD(TAG, LOG_FMT("[%d] removing %s"), i, hd->hd_calls[i]->uri);
 
+#ifdef CONFIG_HTTPD_URI_CACHE
+            httpd_cache_drop(hd, hd->hd_calls[i]);
+#endif
             free((char*)hd->hd_calls[i]->uri);
             free(hd->hd_calls[i]);
             hd->hd_calls[i] = NULL;
@@ -238,6 +245,9 @@ esp_err_t httpd_unregister_uri(httpd_handle_t handle, const char *uri)
         if (strcmp(hd->hd_calls[i]->uri, uri) == 0) {   // Match URI strings
             ESP_LOGD(TAG, LOG_FMT("[%d] removing %s"), i, uri);
 
+#ifdef CONFIG_HTTPD_URI_CACHE
+            httpd_cache_drop(hd, hd->hd_calls[i]);
+#endif
             free((char*)hd->hd_calls[i]->uri);
             free(hd->hd_calls[i]);
             hd->hd_calls[i] = NULL;
@@ -263,6 +273,9 @@ esp_err_t httpd_unregister_uri(httpd_handle_t handle, const char *uri)
 
 void httpd_unregister_all_uri_handlers(struct httpd_data *hd)
 {
+#ifdef CONFIG_HTTPD_URI_CACHE
+    httpd_cache_purge(hd);
+#endif
     for (unsigned i = 0; i < hd->config.max_uri_handlers; i++) {
         if (!hd->hd_calls[i]) {
             break;
@@ -310,6 +323,21 @@ esp_err_t httpd_uri(struct httpd_data *hd)
     /* Attach user context data (passed during URI registration) into request */
     req->user_ctx = uri->user_ctx;
 
+#ifdef CONFIG_HTTPD_URI_CACHE
+    /* Serve straight from the response cache while a fresh entry exists,
+     * otherwise arm the entry so httpd_resp_send() captures the handler's
+     * response on the way out */
+    if (uri->cache_response && req->method == HTTP_GET) {
+        struct httpd_cache_entry *entry = httpd_cache_entry_get(hd, uri);
+        if (entry) {
+            if (httpd_cache_entry_fresh(entry)) {
+                return httpd_cache_serve(req, entry);
+            }
+            ((struct httpd_req_aux *)req->aux)->cache_entry = entry;
+        }
+    }
+#endif
+
     /* Final step for a WebSocket handshake verification */
 #ifdef CONFIG_HTTPD_WS_SUPPORT
     struct httpd_req_aux   *aux = req->aux;
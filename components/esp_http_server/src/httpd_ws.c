@@ -17,6 +17,9 @@
 #include <esp_http_server.h>
 #include "esp_httpd_priv.h"
 #include "freertos/event_groups.h"
+#if CONFIG_HTTPD_WS_DEFLATE
+#include "miniz.h"
+#endif
 
 #ifdef CONFIG_HTTPD_WS_SUPPORT
 
@@ -41,10 +44,15 @@ static const char *TAG="httpd_ws";
  */
 #define HTTPD_WS_CONTINUE       0x00U
 #define HTTPD_WS_FIN_BIT        0x80U
+#define HTTPD_WS_RSV1_BIT       0x40U
 #define HTTPD_WS_OPCODE_BITS    0x0fU
 #define HTTPD_WS_MASK_BIT       0x80U
 #define HTTPD_WS_LENGTH_BITS    0x7fU
 
+/* Size of the on-stack staging buffer used by httpd_ws_send_frames_async()
+ * to coalesce consecutive small frames into a single TCP write */
+#define HTTPD_WS_BATCH_BUF_LEN  256
+
 /*
  * The magic GUID string used for handshake
  * Please refer to RFC6455 Section 1.3 for more details.
@@ -156,9 +164,22 @@ esp_err_t httpd_ws_respond_server_handshake(httpd_req_t *req, const char *suppor
         ESP_LOGW(TAG, "Sec-WebSocket-Protocol length exceeded buffer size of %"NEWLIB_NANO_COMPAT_FORMAT", was trunctated", NEWLIB_NANO_COMPAT_CAST(sizeof(subprotocol)));
     }
 
+#if CONFIG_HTTPD_WS_DEFLATE
+    /* Accept permessage-deflate when offered by the client. Context takeover
+     * is declined on both sides, so every message is compressed independently
+     * and no per-session sliding window needs to be retained.
+     * Please refer to RFC7692 Section 7 for more details. */
+    bool deflate_negotiated = false;
+    char extensions[128] = { '\0' };
+    esp_err_t ext_ret = httpd_req_get_hdr_value_str(req, "Sec-WebSocket-Extensions", extensions, sizeof(extensions) - 1);
+    if ((ext_ret == ESP_OK || ext_ret == ESP_ERR_HTTPD_RESULT_TRUNC) &&
+            strstr(extensions, "permessage-deflate") != NULL) {
+        deflate_negotiated = true;
+    }
+#endif
 
     /* Prepare the Switching Protocol response */
-    char tx_buf[192] = { '\0' };
+    char tx_buf[288] = { '\0' };
     int fmt_len = snprintf(tx_buf, sizeof(tx_buf),
                            "HTTP/1.1 101 Switching Protocols\r\n"
                            "Upgrade: websocket\r\n"
@@ -188,6 +209,27 @@ esp_err_t httpd_ws_respond_server_handshake(httpd_req_t *req, const char *suppor
         }
     }
 
+#if CONFIG_HTTPD_WS_DEFLATE
+    if (deflate_negotiated) {
+        int e = snprintf(tx_buf + fmt_len, sizeof(tx_buf) - fmt_len,
+                         "Sec-WebSocket-Extensions: permessage-deflate; "
+                         "server_no_context_takeover; client_no_context_takeover\r\n");
+        if (e <= 0) {
+            ESP_LOGE(TAG, "Error in response generation"
+                          "(snprintf of extensions returned %d, buffer size: %"NEWLIB_NANO_COMPAT_FORMAT, e, NEWLIB_NANO_COMPAT_CAST(sizeof(tx_buf)));
+            return ESP_FAIL;
+        }
+
+        fmt_len += e;
+
+        if (fmt_len >= sizeof(tx_buf)) {
+            ESP_LOGE(TAG, "Error in response generation"
+                          "(snprintf of extensions returned %d, desired response len: %d, buffer size: %"NEWLIB_NANO_COMPAT_FORMAT, e, fmt_len, NEWLIB_NANO_COMPAT_CAST(sizeof(tx_buf)));
+            return ESP_FAIL;
+        }
+    }
+#endif
+
     int r = snprintf(tx_buf + fmt_len, sizeof(tx_buf) - fmt_len, "\r\n");
     if (r <= 0) {
         ESP_LOGE(TAG, "Error in response generation"
@@ -207,6 +249,10 @@ esp_err_t httpd_ws_respond_server_handshake(httpd_req_t *req, const char *suppor
         return ESP_FAIL;
     }
 
+#if CONFIG_HTTPD_WS_DEFLATE
+    req_aux->sd->ws_deflate_enabled = deflate_negotiated;
+#endif
+
     return ESP_OK;
 }
 
@@ -235,7 +281,31 @@ static esp_err_t httpd_ws_unmask_payload(uint8_t *payload, size_t len, const uin
         return ESP_ERR_INVALID_ARG;
     }
 
-    for (size_t idx = 0; idx < len; idx++) {
+    size_t idx = 0;
+
+    /* Align to a word boundary byte-by-byte, then XOR word-wide with the
+     * mask key rotated to match the alignment offset. Only the remainder
+     * shorter than a word is processed byte-at-a-time again. */
+    while (idx < len && ((uintptr_t)(payload + idx) & (sizeof(uint32_t) - 1))) {
+        payload[idx] = (payload[idx] ^ mask_key[idx % 4]);
+        idx++;
+    }
+
+    if (len - idx >= sizeof(uint32_t)) {
+        uint8_t mask_rot[4];
+        for (size_t i = 0; i < sizeof(mask_rot); i++) {
+            mask_rot[i] = mask_key[(idx + i) % 4];
+        }
+        uint32_t mask_word;
+        memcpy(&mask_word, mask_rot, sizeof(mask_word));
+
+        uint32_t *payload_word = (uint32_t *)(payload + idx);
+        for (; len - idx >= sizeof(uint32_t); idx += sizeof(uint32_t)) {
+            *payload_word++ ^= mask_word;
+        }
+    }
+
+    for (; idx < len; idx++) {
         payload[idx] = (payload[idx] ^ mask_key[idx % 4]);
     }
 
@@ -360,6 +430,31 @@ esp_err_t httpd_ws_recv_frame(httpd_req_t *req, httpd_ws_frame_t *frame, size_t
     /* Unmask payload */
     httpd_ws_unmask_payload(frame->payload, frame->len, aux->mask_key);
 
+#if CONFIG_HTTPD_WS_DEFLATE
+    if (aux->ws_deflated) {
+        /* Reattach the trailing bytes the sender stripped off and inflate
+         * into the user buffer. Note that frame->len up to this point was
+         * the compressed on-wire length; the inflated message still has to
+         * fit into max_len. Please refer to RFC7692 Section 7.2.2. */
+        uint8_t *deflated = malloc(frame->len + 4);
+        if (deflated == NULL) {
+            ESP_LOGW(TAG, LOG_FMT("Failed to allocate inflate buffer"));
+            return ESP_ERR_NO_MEM;
+        }
+        memcpy(deflated, frame->payload, frame->len);
+        memcpy(deflated + frame->len, "\x00\x00\xff\xff", 4);
+
+        size_t inflated_len = tinfl_decompress_mem_to_mem(frame->payload, max_len,
+                                                          deflated, frame->len + 4, 0);
+        free(deflated);
+        if (inflated_len == TINFL_DECOMPRESS_MEM_TO_MEM_FAILED) {
+            ESP_LOGW(TAG, LOG_FMT("Failed to inflate WS payload"));
+            return ESP_ERR_INVALID_SIZE;
+        }
+        frame->len = inflated_len;
+    }
+#endif
+
     return ESP_OK;
 }
 
@@ -372,33 +467,34 @@ esp_err_t httpd_ws_send_frame(httpd_req_t *req, httpd_ws_frame_t *frame)
     return httpd_ws_send_frame_async(req->handle, httpd_req_to_sockfd(req), frame);
 }
 
-esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frame)
+/* Build a frame header - maximum length is 10, which includes 2 bytes header and 8 bytes length.
+ * Returns the header length. */
+static uint8_t httpd_ws_make_header(const httpd_ws_frame_t *frame, size_t payload_len,
+                                    bool deflated, uint8_t *header_buf)
 {
-    if (!frame) {
-        ESP_LOGW(TAG, LOG_FMT("Argument is invalid"));
-        return ESP_ERR_INVALID_ARG;
-    }
-
-    /* Prepare Tx buffer - maximum length is 14, which includes 2 bytes header, 8 bytes length, 4 bytes mask key */
     uint8_t tx_len = 0;
-    uint8_t header_buf[10] = {0 };
     /* Set the `FIN` bit by default if message is not fragmented. Else, set it as per the `final` field */
     header_buf[0] |= (!frame->fragmented) ? HTTPD_WS_FIN_BIT : (frame->final? HTTPD_WS_FIN_BIT: HTTPD_WS_CONTINUE);
     header_buf[0] |= frame->type; /* Type (opcode): 4 bits */
+#if CONFIG_HTTPD_WS_DEFLATE
+    if (deflated) {
+        header_buf[0] |= HTTPD_WS_RSV1_BIT; /* RSV1: payload is deflated (RFC7692) */
+    }
+#endif
 
-    if (frame->len <= 125) {
-        header_buf[1] = frame->len & 0x7fU; /* Length for 7 bits */
+    if (payload_len <= 125) {
+        header_buf[1] = payload_len & 0x7fU; /* Length for 7 bits */
         tx_len = 2;
-    } else if (frame->len > 125 && frame->len < UINT16_MAX) {
+    } else if (payload_len > 125 && payload_len < UINT16_MAX) {
         header_buf[1] = 126;                /* Length for 16 bits */
-        header_buf[2] = (frame->len >> 8U) & 0xffU;
-        header_buf[3] = frame->len & 0xffU;
+        header_buf[2] = (payload_len >> 8U) & 0xffU;
+        header_buf[3] = payload_len & 0xffU;
         tx_len = 4;
     } else {
         header_buf[1] = 127;                /* Length for 64 bits */
         uint8_t shift_idx = sizeof(uint64_t) - 1; /* Shift index starts at 7 */
-        uint64_t len64 = frame->len; /* Raise variable size to make sure we won't shift by more bits
-                                      * than the length has (to avoid undefined behaviour) */
+        uint64_t len64 = payload_len; /* Raise variable size to make sure we won't shift by more bits
+                                       * than the length has (to avoid undefined behaviour) */
         for (int8_t idx = 2; idx <= 9; idx++) {
             /* Now do shifting (be careful of endianness, i.e. when buffer index is 2, frame length shift index is 7) */
             header_buf[idx] = (len64 >> (shift_idx * 8)) & 0xffU;
@@ -409,27 +505,132 @@ esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t
 
     /* WebSocket server does not required to mask response payload, so leave the MASK bit as 0. */
     header_buf[1] &= (~HTTPD_WS_MASK_BIT);
+    return tx_len;
+}
+
+#if CONFIG_HTTPD_WS_DEFLATE
+/* Compress a frame payload with raw deflate. Returns a malloc'd buffer
+ * holding the compressed payload, or NULL if the payload is below the
+ * compression threshold, did not shrink, or allocation failed - in which
+ * case the frame is sent uncompressed. */
+static uint8_t *httpd_ws_deflate_payload(const httpd_ws_frame_t *frame, size_t *deflated_len)
+{
+    if (frame->len < CONFIG_HTTPD_WS_DEFLATE_MIN_LEN) {
+        return NULL;
+    }
+    uint8_t *deflated = malloc(frame->len);
+    if (deflated == NULL) {
+        return NULL;
+    }
+    /* No TDEFL_WRITE_ZLIB_HEADER: permessage-deflate carries raw deflate
+     * data. The stream ends with a BFINAL block, which RFC7692 permits in
+     * place of an empty sync flush. */
+    size_t clen = tdefl_compress_mem_to_mem(deflated, frame->len, frame->payload, frame->len,
+                                            TDEFL_DEFAULT_MAX_PROBES);
+    if (clen == 0 || clen >= frame->len) {
+        free(deflated);
+        return NULL;
+    }
+    *deflated_len = clen;
+    return deflated;
+}
+#endif
+
+/* Send off staged frames and reset the staging buffer */
+static esp_err_t httpd_ws_flush_batch(httpd_handle_t hd, int fd, struct sock_db *sess,
+                                      const uint8_t *batch_buf, size_t *batch_len)
+{
+    if (*batch_len == 0) {
+        return ESP_OK;
+    }
+    if (sess->send_fn(hd, fd, (const char *)batch_buf, *batch_len, 0) < 0) {
+        ESP_LOGW(TAG, LOG_FMT("Failed to send WS frame batch"));
+        return ESP_FAIL;
+    }
+    *batch_len = 0;
+    return ESP_OK;
+}
+
+esp_err_t httpd_ws_send_frames_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frames, size_t nframes)
+{
+    if (!frames || nframes == 0) {
+        ESP_LOGW(TAG, LOG_FMT("Argument is invalid"));
+        return ESP_ERR_INVALID_ARG;
+    }
 
     struct sock_db *sess = httpd_sess_get(hd, fd);
     if (!sess) {
         return ESP_ERR_INVALID_ARG;
     }
 
-    /* Send off header */
-    if (sess->send_fn(hd, fd, (const char *)header_buf, tx_len, 0) < 0) {
-        ESP_LOGW(TAG, LOG_FMT("Failed to send WS header"));
-        return ESP_FAIL;
-    }
+    /* Coalesce consecutive small frames into a single TCP write, so a
+     * burst of telemetry frames does not cost one syscall and one segment
+     * per frame. Frames that do not fit go to the socket directly. */
+    uint8_t batch_buf[HTTPD_WS_BATCH_BUF_LEN];
+    size_t batch_len = 0;
+    esp_err_t ret = ESP_OK;
+
+    for (size_t i = 0; (i < nframes) && (ret == ESP_OK); i++) {
+        httpd_ws_frame_t *frame = &frames[i];
+        const uint8_t *payload = frame->payload;
+        size_t payload_len = frame->len;
+        bool deflated = false;
+
+#if CONFIG_HTTPD_WS_DEFLATE
+        uint8_t *deflate_buf = NULL;
+        if (sess->ws_deflate_enabled && payload != NULL && !frame->fragmented &&
+                (frame->type == HTTPD_WS_TYPE_TEXT || frame->type == HTTPD_WS_TYPE_BINARY)) {
+            deflate_buf = httpd_ws_deflate_payload(frame, &payload_len);
+            if (deflate_buf) {
+                payload = deflate_buf;
+                deflated = true;
+            } else {
+                payload_len = frame->len;
+            }
+        }
+#endif
 
-    /* Send off payload */
-    if(frame->len > 0 && frame->payload != NULL) {
-        if (sess->send_fn(hd, fd, (const char *)frame->payload, frame->len, 0) < 0) {
-            ESP_LOGW(TAG, LOG_FMT("Failed to send WS payload"));
-            return ESP_FAIL;
+        uint8_t header_buf[10] = { 0 };
+        uint8_t header_len = httpd_ws_make_header(frame, payload_len, deflated, header_buf);
+
+        if (header_len + payload_len > sizeof(batch_buf) - batch_len) {
+            ret = httpd_ws_flush_batch(hd, fd, sess, batch_buf, &batch_len);
+        }
+        if (ret == ESP_OK) {
+            if (header_len + payload_len <= sizeof(batch_buf)) {
+                memcpy(batch_buf + batch_len, header_buf, header_len);
+                batch_len += header_len;
+                if (payload && payload_len > 0) {
+                    memcpy(batch_buf + batch_len, payload, payload_len);
+                    batch_len += payload_len;
+                }
+            } else {
+                /* Frame larger than the staging buffer */
+                if (sess->send_fn(hd, fd, (const char *)header_buf, header_len, 0) < 0) {
+                    ESP_LOGW(TAG, LOG_FMT("Failed to send WS header"));
+                    ret = ESP_FAIL;
+                } else if (payload && payload_len > 0 &&
+                           sess->send_fn(hd, fd, (const char *)payload, payload_len, 0) < 0) {
+                    ESP_LOGW(TAG, LOG_FMT("Failed to send WS payload"));
+                    ret = ESP_FAIL;
+                }
+            }
         }
+
+#if CONFIG_HTTPD_WS_DEFLATE
+        free(deflate_buf);
+#endif
     }
 
-    return ESP_OK;
+    if (ret == ESP_OK) {
+        ret = httpd_ws_flush_batch(hd, fd, sess, batch_buf, &batch_len);
+    }
+    return ret;
+}
+
+esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frame)
+{
+    return httpd_ws_send_frames_async(hd, fd, frame, 1);
 }
 
 esp_err_t httpd_ws_get_frame_type(httpd_req_t *req)
@@ -468,6 +669,10 @@ esp_err_t httpd_ws_get_frame_type(httpd_req_t *req)
     /* Decode the FIN flag and Opcode from the byte */
     aux->ws_final = (first_byte & HTTPD_WS_FIN_BIT) != 0;
     aux->ws_type = (first_byte & HTTPD_WS_OPCODE_BITS);
+#if CONFIG_HTTPD_WS_DEFLATE
+    /* RSV1 set means the sender compressed the payload (RFC7692) */
+    aux->ws_deflated = sd->ws_deflate_enabled && ((first_byte & HTTPD_WS_RSV1_BIT) != 0);
+#endif
 
     /* If userspace requests control frames, do not deal with the control frames */
     if (!sd->ws_control_frames) {
@@ -68,6 +68,9 @@ typedef struct {
     void *decrypt_user_ctx;                        /*!< User context for external decryption layer */
     uint16_t enc_img_header_size;                  /*!< Header size of pre-encrypted ota image header */
 #endif
+#if CONFIG_ESP_HTTPS_OTA_DELTA || __DOXYGEN__
+    bool delta_update;                             /*!< Treat the downloaded data as a binary patch against the running partition, generated with tools/esp_delta_ota_gen.py */
+#endif
 } esp_https_ota_config_t;
 
 #define ESP_ERR_HTTPS_OTA_BASE            (0x9000)
@@ -13,6 +13,9 @@
 #include <errno.h>
 #include <sys/param.h>
 #include <inttypes.h>
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+#include "esp_https_ota_delta.h"
+#endif
 
 ESP_EVENT_DEFINE_BASE(ESP_HTTPS_OTA_EVENT);
 
@@ -55,6 +58,9 @@ struct esp_https_ota_handle {
     void *decrypt_user_ctx;
     uint16_t enc_img_header_size;
 #endif
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+    esp_https_ota_delta_t *delta;
+#endif
 };
 
 typedef struct esp_https_ota_handle esp_https_ota_t;
@@ -251,6 +257,21 @@ static esp_err_t _ota_write(esp_https_ota_t *https_ota_handle, const void *buffe
     return err;
 }
 
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+/* Sink of the delta patcher: receives the reconstructed image in stream order.
+   handle->binary_file_len keeps counting *downloaded* bytes so that the partial
+   HTTP download logic stays consistent, the write progress is tracked here. */
+static esp_err_t _delta_ota_write(void *ctx, const void *buffer, size_t buf_len)
+{
+    esp_https_ota_t *https_ota_handle = (esp_https_ota_t *)ctx;
+    esp_err_t err = esp_ota_write(https_ota_handle->update_handle, buffer, buf_len);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error: esp_ota_write failed! err=0x%x", err);
+    }
+    return err;
+}
+#endif // CONFIG_ESP_HTTPS_OTA_DELTA
+
 static bool is_server_verification_enabled(const esp_https_ota_config_t *ota_config) {
     return  (ota_config->http_config->cert_pem
             || ota_config->http_config->use_global_ca_store
@@ -398,6 +419,17 @@ esp_err_t esp_https_ota_begin(const esp_https_ota_config_t *ota_config, esp_http
     https_ota_handle->decrypt_cb = ota_config->decrypt_cb;
     https_ota_handle->decrypt_user_ctx = ota_config->decrypt_user_ctx;
     https_ota_handle->enc_img_header_size = ota_config->enc_img_header_size;
+#endif
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+    if (ota_config->delta_update) {
+        const esp_partition_t *running = esp_ota_get_running_partition();
+        err = esp_https_ota_delta_init(running, _delta_ota_write, https_ota_handle, &https_ota_handle->delta);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to initialise delta patcher");
+            goto http_cleanup;
+        }
+        ESP_LOGI(TAG, "Delta update: patching against <%s> partition", running->label);
+    }
 #endif
     https_ota_handle->ota_upgrade_buf_size = alloc_size;
     https_ota_handle->bulk_flash_erase = ota_config->bulk_flash_erase;
@@ -468,6 +500,12 @@ esp_err_t esp_https_ota_get_img_desc(esp_https_ota_handle_t https_ota_handle, es
         ESP_LOGE(TAG, "esp_https_ota_get_img_desc: Invalid state");
         return ESP_ERR_INVALID_STATE;
     }
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+    if (handle->delta) {
+        // The downloaded stream is a patch, the image headers only exist in the reconstructed output
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+#endif
     if (read_header(handle) != ESP_OK) {
         return ESP_FAIL;
     }
@@ -518,6 +556,15 @@ esp_err_t esp_https_ota_perform(esp_https_ota_handle_t https_ota_handle)
                 return err;
             }
             handle->state = ESP_HTTPS_OTA_IN_PROGRESS;
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+            if (handle->delta) {
+                /* The stream is a patch, not an image: there are no image headers to
+                   pre-read here. The chip id and image structure of the reconstructed
+                   output are validated by esp_ota_end(). */
+                handle->binary_file_len = 0;
+                return ESP_ERR_HTTPS_OTA_IN_PROGRESS;
+            }
+#endif
             /* In case `esp_https_ota_get_img_desc` was invoked first,
                then the image data read there should be written to OTA partition
                */
@@ -584,6 +631,20 @@ esp_err_t esp_https_ota_perform(esp_https_ota_handle_t https_ota_handle)
                     return err;
                 }
 #endif // CONFIG_ESP_HTTPS_OTA_DECRYPT_CB
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+                if (handle->delta) {
+                    err = esp_https_ota_delta_feed(handle->delta, data_buf, data_len);
+#if CONFIG_ESP_HTTPS_OTA_DECRYPT_CB
+                    esp_https_ota_decrypt_cb_free_buf((void *) data_buf);
+#endif
+                    if (err != ESP_OK) {
+                        return err;
+                    }
+                    handle->binary_file_len += data_read;
+                    esp_https_ota_dispatch_event(ESP_HTTPS_OTA_WRITE_FLASH, (void *)(&handle->binary_file_len), sizeof(int));
+                    return ESP_ERR_HTTPS_OTA_IN_PROGRESS;
+                }
+#endif // CONFIG_ESP_HTTPS_OTA_DELTA
                 return _ota_write(handle, data_buf, data_len);
             } else {
                 if (data_read == -ESP_ERR_HTTP_EAGAIN) {
@@ -659,6 +720,13 @@ esp_err_t esp_https_ota_finish(esp_https_ota_handle_t https_ota_handle)
     switch (handle->state) {
         case ESP_HTTPS_OTA_SUCCESS:
         case ESP_HTTPS_OTA_IN_PROGRESS:
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+            if (handle->delta && !esp_https_ota_delta_is_complete(handle->delta)) {
+                ESP_LOGE(TAG, "Patch stream ended before the whole image was produced");
+                err = ESP_FAIL;
+                esp_ota_abort(handle->update_handle);
+            } else
+#endif
             err = esp_ota_end(handle->update_handle);
             /* falls through */
         case ESP_HTTPS_OTA_BEGIN:
@@ -674,6 +742,9 @@ esp_err_t esp_https_ota_finish(esp_https_ota_handle_t https_ota_handle)
             break;
     }
 
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+    esp_https_ota_delta_deinit(handle->delta);
+#endif
     if ((err == ESP_OK) && (handle->state == ESP_HTTPS_OTA_SUCCESS)) {
         err = esp_ota_set_boot_partition(handle->update_partition);
         if (err != ESP_OK) {
@@ -720,6 +791,9 @@ esp_err_t esp_https_ota_abort(esp_https_ota_handle_t https_ota_handle)
             ESP_LOGE(TAG, "Invalid ESP HTTPS OTA State");
             break;
     }
+#if CONFIG_ESP_HTTPS_OTA_DELTA
+    esp_https_ota_delta_deinit(handle->delta);
+#endif
     free(handle);
     return err;
 }
@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include <inttypes.h>
+#include <esp_log.h>
+#include "esp_https_ota_delta.h"
+
+#define DELTA_MAGIC         0x31504445  // "EDP1"
+#define DELTA_HEADER_SIZE   16
+#define DELTA_OP_COPY       0xC0
+#define DELTA_OP_ADD        0xAD
+
+static const char *TAG = "esp_https_ota_delta";
+
+typedef enum {
+    DELTA_STATE_HEADER,     // accumulating the 16 byte patch header
+    DELTA_STATE_OPCODE,     // expecting the next opcode byte
+    DELTA_STATE_FIELDS,     // accumulating the fixed-size operation arguments
+    DELTA_STATE_ADD_DATA,   // passing literal data through to the sink
+    DELTA_STATE_DONE,       // target_len bytes produced
+} delta_state_t;
+
+struct esp_https_ota_delta {
+    const uint8_t *src;                     // memory mapped source partition
+    esp_partition_mmap_handle_t map_handle;
+    uint32_t src_len;                       // source length declared by the patch
+    uint32_t src_part_size;
+    uint32_t target_len;
+    uint32_t produced;
+    delta_state_t state;
+    uint8_t opcode;
+    uint8_t field[DELTA_HEADER_SIZE];       // accumulator for header/arguments
+    uint8_t field_len;
+    uint8_t field_need;
+    uint32_t add_remaining;                 // literal bytes left in the current ADD op
+    esp_https_ota_delta_write_cb_t write_cb;
+    void *write_ctx;
+};
+
+static inline uint32_t delta_le32(const uint8_t *p)
+{
+    return ((uint32_t)p[0]) | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+esp_err_t esp_https_ota_delta_init(const esp_partition_t *src_part, esp_https_ota_delta_write_cb_t write_cb, void *write_ctx, esp_https_ota_delta_t **out_patch)
+{
+    if (src_part == NULL || write_cb == NULL || out_patch == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_https_ota_delta_t *patch = calloc(1, sizeof(esp_https_ota_delta_t));
+    if (patch == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t err = esp_partition_mmap(src_part, 0, src_part->size, ESP_PARTITION_MMAP_DATA,
+                                       (const void **)&patch->src, &patch->map_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "mmap of source partition failed (%s)", esp_err_to_name(err));
+        free(patch);
+        return err;
+    }
+    patch->src_part_size = src_part->size;
+    patch->state = DELTA_STATE_HEADER;
+    patch->field_need = DELTA_HEADER_SIZE;
+    patch->write_cb = write_cb;
+    patch->write_ctx = write_ctx;
+    *out_patch = patch;
+    return ESP_OK;
+}
+
+static esp_err_t delta_process_header(esp_https_ota_delta_t *patch)
+{
+    if (delta_le32(&patch->field[0]) != DELTA_MAGIC) {
+        ESP_LOGE(TAG, "Stream is not a delta patch (bad magic)");
+        return ESP_ERR_INVALID_VERSION;
+    }
+    patch->target_len = delta_le32(&patch->field[4]);
+    patch->src_len = delta_le32(&patch->field[8]);
+    if (patch->target_len == 0 || patch->src_len > patch->src_part_size) {
+        ESP_LOGE(TAG, "Patch source length 0x%"PRIx32" exceeds source partition (0x%"PRIx32")",
+                 patch->src_len, patch->src_part_size);
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t delta_emit(esp_https_ota_delta_t *patch, const void *buf, uint32_t len)
+{
+    if (len > patch->target_len - patch->produced) {
+        ESP_LOGE(TAG, "Patch produces more than the declared target length");
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = patch->write_cb(patch->write_ctx, buf, len);
+    if (err != ESP_OK) {
+        return err;
+    }
+    patch->produced += len;
+    if (patch->produced == patch->target_len) {
+        patch->state = DELTA_STATE_DONE;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t delta_process_op(esp_https_ota_delta_t *patch)
+{
+    if (patch->opcode == DELTA_OP_COPY) {
+        uint32_t src_off = delta_le32(&patch->field[0]);
+        uint32_t len = delta_le32(&patch->field[4]);
+        if (len > patch->src_len || src_off > patch->src_len - len) {
+            ESP_LOGE(TAG, "COPY 0x%"PRIx32"+0x%"PRIx32" out of source bounds", src_off, len);
+            return ESP_ERR_INVALID_ARG;
+        }
+        // The flash driver stages writes from mapped flash through internal RAM itself
+        return delta_emit(patch, patch->src + src_off, len);
+    }
+    // DELTA_OP_ADD: literal data follows in the stream
+    patch->add_remaining = delta_le32(&patch->field[0]);
+    if (patch->add_remaining == 0) {
+        ESP_LOGE(TAG, "Empty ADD operation");
+        return ESP_ERR_INVALID_ARG;
+    }
+    patch->state = DELTA_STATE_ADD_DATA;
+    return ESP_OK;
+}
+
+esp_err_t esp_https_ota_delta_feed(esp_https_ota_delta_t *patch, const void *data, size_t len)
+{
+    if (patch == NULL || (data == NULL && len > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const uint8_t *in = (const uint8_t *)data;
+    esp_err_t err;
+
+    while (len > 0) {
+        switch (patch->state) {
+        case DELTA_STATE_HEADER:
+        case DELTA_STATE_FIELDS: {
+            size_t take = MIN(len, (size_t)(patch->field_need - patch->field_len));
+            memcpy(&patch->field[patch->field_len], in, take);
+            patch->field_len += take;
+            in += take;
+            len -= take;
+            if (patch->field_len < patch->field_need) {
+                break; // wait for more stream data
+            }
+            if (patch->state == DELTA_STATE_HEADER) {
+                err = delta_process_header(patch);
+            } else {
+                err = delta_process_op(patch);
+            }
+            if (err != ESP_OK) {
+                return err;
+            }
+            if (patch->state == DELTA_STATE_HEADER || patch->state == DELTA_STATE_FIELDS) {
+                patch->state = DELTA_STATE_OPCODE;
+            }
+            break;
+        }
+        case DELTA_STATE_OPCODE:
+            patch->opcode = *in++;
+            len--;
+            if (patch->opcode == DELTA_OP_COPY) {
+                patch->field_need = 8; // src_offset + len
+            } else if (patch->opcode == DELTA_OP_ADD) {
+                patch->field_need = 4; // len
+            } else {
+                ESP_LOGE(TAG, "Unknown patch opcode 0x%02x", patch->opcode);
+                return ESP_ERR_INVALID_ARG;
+            }
+            patch->field_len = 0;
+            patch->state = DELTA_STATE_FIELDS;
+            break;
+        case DELTA_STATE_ADD_DATA: {
+            uint32_t take = MIN((uint32_t)len, patch->add_remaining);
+            err = delta_emit(patch, in, take);
+            if (err != ESP_OK) {
+                return err;
+            }
+            patch->add_remaining -= take;
+            in += take;
+            len -= take;
+            if (patch->add_remaining == 0 && patch->state != DELTA_STATE_DONE) {
+                patch->state = DELTA_STATE_OPCODE;
+            }
+            break;
+        }
+        case DELTA_STATE_DONE:
+            ESP_LOGE(TAG, "Trailing data after the end of the patch");
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    return ESP_OK;
+}
+
+bool esp_https_ota_delta_is_complete(const esp_https_ota_delta_t *patch)
+{
+    return patch != NULL && patch->state == DELTA_STATE_DONE;
+}
+
+void esp_https_ota_delta_deinit(esp_https_ota_delta_t *patch)
+{
+    if (patch == NULL) {
+        return;
+    }
+    esp_partition_munmap(patch->map_handle);
+    free(patch);
+}
@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Streamed delta patcher used by esp_https_ota when `delta_update` is enabled.
+ *
+ * Patch stream format ("EDP1", all integers little-endian):
+ *
+ *   header:  magic "EDP1" (u32) | target_len (u32) | source_len (u32) | reserved (u32)
+ *   ops:     0xC0 src_offset (u32) len (u32)       copy `len` bytes from the source partition
+ *            0xAD len (u32) followed by `len` bytes append literal data
+ *
+ * The stream ends once `target_len` output bytes have been produced. Patches are
+ * generated on the host with tools/esp_delta_ota_gen.py.
+ */
+
+typedef struct esp_https_ota_delta esp_https_ota_delta_t;
+
+/**
+ * @brief Prototype of the patcher output sink, receives the reconstructed image in stream order
+ */
+typedef esp_err_t (*esp_https_ota_delta_write_cb_t)(void *ctx, const void *buffer, size_t len);
+
+/**
+ * @brief Create a delta patcher reading its source data from `src_part` (memory mapped)
+ *
+ * @param[in] src_part   Partition holding the source (running) image
+ * @param[in] write_cb   Sink invoked with the reconstructed image data
+ * @param[in] write_ctx  User context passed to `write_cb`
+ * @param[out] out_patch Created patcher instance
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_NO_MEM, or the error returned by `esp_partition_mmap`
+ */
+esp_err_t esp_https_ota_delta_init(const esp_partition_t *src_part, esp_https_ota_delta_write_cb_t write_cb, void *write_ctx, esp_https_ota_delta_t **out_patch);
+
+/**
+ * @brief Feed a chunk of the downloaded patch stream, in order
+ *
+ * Emits reconstructed image data through the sink as complete patch operations
+ * become available. Chunks may split patch operations at any byte boundary.
+ *
+ * @param[in] patch Patcher instance
+ * @param[in] data  Patch stream data
+ * @param[in] len   Length of `data`, in bytes
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_VERSION if the stream does not start with the patch magic
+ *      - ESP_ERR_INVALID_ARG if an operation is malformed or out of bounds
+ *      - the error returned by the sink, if it fails
+ */
+esp_err_t esp_https_ota_delta_feed(esp_https_ota_delta_t *patch, const void *data, size_t len);
+
+/**
+ * @brief Whether the whole target image has been produced
+ *
+ * @param[in] patch Patcher instance
+ * @return true once `target_len` bytes have been written to the sink
+ */
+bool esp_https_ota_delta_is_complete(const esp_https_ota_delta_t *patch);
+
+/**
+ * @brief Delete the patcher and unmap the source partition
+ *
+ * @param[in] patch Patcher instance, NULL is allowed
+ */
+void esp_https_ota_delta_deinit(esp_https_ota_delta_t *patch);
+
+#ifdef __cplusplus
+}
+#endif
@@ -169,7 +169,9 @@ typedef struct httpd_ssl_config httpd_ssl_config_t;
         .keep_alive_count = 0,                    \
         .open_fn = NULL,                          \
         .close_fn = NULL,                         \
-        .uri_match_fn = NULL                      \
+        .uri_match_fn = NULL,                     \
+        .req_arena_size = 0,                      \
+        .req_arena_caps = (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT), \
     },                                            \
     .servercert = NULL,                           \
     .servercert_len = 0,                          \
@@ -42,6 +42,12 @@ typedef dma_descriptor_align4_t mcp_dma_descriptor_t;
 #error "Unsupported GDMA type"
 #endif
 
+/// @brief A contiguous memory span, produced by merging adjacent regions of a batched copy request
+typedef struct {
+    uint8_t *start; // span start address
+    size_t len;     // span length, in bytes
+} mcp_gdma_span_t;
+
 /// @brief Transaction object for async memcpy
 /// @note - GDMA requires the DMA descriptors to be 4 or 8 bytes aligned
 /// @note - The DMA descriptor link list is allocated dynamically from DMA-able memory
@@ -56,6 +62,8 @@ typedef struct async_memcpy_transaction_t {
     intptr_t rx_start_desc_addr; // RX start descriptor address
     void *memcpy_dst_addr;       // memcpy destination address
     size_t memcpy_size;          // memcpy size
+    mcp_gdma_span_t *dst_spans;  // merged destination spans of a batched transaction, used for cache invalidate on completion
+    uint32_t num_dst_spans;      // number of merged destination spans
     async_memcpy_isr_cb_t cb;    // user callback
     void *cb_args;               // user callback args
     STAILQ_ENTRY(async_memcpy_transaction_t) idle_queue_entry;  // Entry for the idle queue
@@ -86,6 +94,7 @@ typedef struct {
 static bool mcp_gdma_rx_eof_callback(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data);
 static esp_err_t mcp_gdma_del(async_memcpy_context_t *ctx);
 static esp_err_t mcp_gdma_memcpy(async_memcpy_context_t *ctx, void *dst, void *src, size_t n, async_memcpy_isr_cb_t cb_isr, void *cb_args);
+static esp_err_t mcp_gdma_memcpy_batch(async_memcpy_context_t *ctx, const async_memcpy_region_t *regions, size_t num_regions, async_memcpy_isr_cb_t cb_isr, void *cb_args);
 #if SOC_GDMA_SUPPORT_ETM
 static esp_err_t mcp_new_etm_event(async_memcpy_context_t *ctx, async_memcpy_etm_event_t event_type, esp_etm_event_handle_t *out_event);
 #endif // SOC_GDMA_SUPPORT_ETM
@@ -179,6 +188,7 @@ static esp_err_t esp_async_memcpy_install_gdma_template(const async_memcpy_confi
     mcp_gdma->max_single_dma_buffer = ALIGN_DOWN(DMA_DESCRIPTOR_BUFFER_MAX_SIZE, buf_align);
     mcp_gdma->parent.del = mcp_gdma_del;
     mcp_gdma->parent.memcpy = mcp_gdma_memcpy;
+    mcp_gdma->parent.memcpy_batch = mcp_gdma_memcpy_batch;
 #if SOC_GDMA_SUPPORT_ETM
     mcp_gdma->parent.new_etm_event = mcp_new_etm_event;
 #endif
@@ -449,6 +459,215 @@ err:
     return ret;
 }
 
+/// @brief merge adjacent regions of a batched copy request into contiguous spans on one side (source or destination)
+static size_t mcp_gdma_merge_regions(const async_memcpy_region_t *regions, size_t num_regions, bool src_side, mcp_gdma_span_t *out_spans)
+{
+    size_t num_spans = 0;
+    for (size_t i = 0; i < num_regions; i++) {
+        uint8_t *start = src_side ? (uint8_t *)regions[i].src : (uint8_t *)regions[i].dst;
+        if (num_spans && (out_spans[num_spans - 1].start + out_spans[num_spans - 1].len == start)) {
+            out_spans[num_spans - 1].len += regions[i].size;
+        } else {
+            out_spans[num_spans].start = start;
+            out_spans[num_spans].len = regions[i].size;
+            num_spans++;
+        }
+    }
+    return num_spans;
+}
+
+/// @brief count how many DMA descriptors are needed to cover the spans
+static size_t mcp_gdma_count_desc(const mcp_gdma_span_t *spans, size_t num_spans, size_t max_single_dma_buffer)
+{
+    size_t num_desc = 0;
+    for (size_t i = 0; i < num_spans; i++) {
+        num_desc += (spans[i].len + max_single_dma_buffer - 1) / max_single_dma_buffer;
+    }
+    return num_desc;
+}
+
+static void mount_tx_spans_to_dma(async_memcpy_transaction_t *trans, const mcp_gdma_span_t *spans, size_t num_spans,
+                                  size_t num_desc, size_t max_single_dma_buffer)
+{
+    mcp_dma_descriptor_t *desc_array = trans->tx_desc_link;
+    mcp_dma_descriptor_t *desc_nc = trans->tx_desc_nc;
+    size_t di = 0;
+    for (size_t i = 0; i < num_spans; i++) {
+        uint8_t *buf = spans[i].start;
+        size_t len = spans[i].len;
+        while (len) {
+            size_t chunk = MIN(len, max_single_dma_buffer);
+            desc_nc[di].buffer = buf;
+            desc_nc[di].dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+            // only the very last descriptor carries the EOF flag, so the batch raises a single interrupt
+            desc_nc[di].dw0.suc_eof = (di == num_desc - 1);
+            desc_nc[di].dw0.size = chunk;
+            desc_nc[di].dw0.length = chunk;
+            desc_nc[di].next = (di == num_desc - 1) ? NULL : &desc_array[di + 1];
+            buf += chunk;
+            len -= chunk;
+            di++;
+        }
+    }
+}
+
+static void mount_rx_spans_to_dma(async_memcpy_transaction_t *trans, const mcp_gdma_span_t *spans, size_t num_spans,
+                                  size_t num_desc, size_t max_single_dma_buffer)
+{
+    mcp_dma_descriptor_t *desc_array = trans->rx_desc_link;
+    mcp_dma_descriptor_t *desc_nc = trans->rx_desc_nc;
+    mcp_dma_descriptor_t *eof_nc = (mcp_dma_descriptor_t *)MCP_GET_NON_CACHE_ADDR(&trans->eof_node);
+    size_t di = 0;
+    for (size_t i = 0; i < num_spans; i++) {
+        uint8_t *buf = spans[i].start;
+        size_t len = spans[i].len;
+        while (len) {
+            size_t chunk = MIN(len, max_single_dma_buffer);
+            // the last chunk goes into trans->eof_node, so the EOF callback can find the transaction back
+            mcp_dma_descriptor_t *desc = (di == num_desc - 1) ? eof_nc : &desc_nc[di];
+            desc->buffer = buf;
+            desc->dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+            desc->dw0.size = chunk;
+            desc->dw0.length = chunk;
+            if (di == num_desc - 1) {
+                desc->next = NULL;
+            } else if (di == num_desc - 2) {
+                desc->next = &trans->eof_node;
+            } else {
+                desc->next = &desc_array[di + 1];
+            }
+            buf += chunk;
+            len -= chunk;
+            di++;
+        }
+    }
+}
+
+static esp_err_t mcp_gdma_memcpy_batch(async_memcpy_context_t *ctx, const async_memcpy_region_t *regions, size_t num_regions, async_memcpy_isr_cb_t cb_isr, void *cb_args)
+{
+    esp_err_t ret = ESP_OK;
+    async_memcpy_gdma_context_t *mcp_gdma = __containerof(ctx, async_memcpy_gdma_context_t, parent);
+    mcp_gdma_span_t *src_spans = NULL;
+    mcp_gdma_span_t *dst_spans = NULL;
+    async_memcpy_transaction_t *trans = NULL;
+
+    for (size_t i = 0; i < num_regions; i++) {
+        void *src = regions[i].src;
+        void *dst = regions[i].dst;
+        size_t n = regions[i].size;
+        ESP_RETURN_ON_FALSE(src && dst && n, ESP_ERR_INVALID_ARG, TAG, "invalid copy region[%zu]", i);
+        // buffer location check
+#if SOC_AHB_GDMA_SUPPORTED && !SOC_AHB_GDMA_SUPPORT_PSRAM
+        if (mcp_gdma->gdma_bus_id == SOC_GDMA_BUS_AHB) {
+            ESP_RETURN_ON_FALSE(esp_ptr_internal(src) && esp_ptr_internal(dst), ESP_ERR_INVALID_ARG, TAG, "AHB GDMA can only access SRAM");
+        }
+#endif // SOC_AHB_GDMA_SUPPORTED && !SOC_AHB_GDMA_SUPPORT_PSRAM
+#if SOC_AXI_GDMA_SUPPORTED && !SOC_AXI_GDMA_SUPPORT_PSRAM
+        if (mcp_gdma->gdma_bus_id == SOC_GDMA_BUS_AXI) {
+            ESP_RETURN_ON_FALSE(esp_ptr_internal(src) && esp_ptr_internal(dst), ESP_ERR_INVALID_ARG, TAG, "AXI DMA can only access SRAM");
+        }
+#endif // SOC_AXI_GDMA_SUPPORTED && !SOC_AXI_GDMA_SUPPORT_PSRAM
+        // alignment check
+        ESP_RETURN_ON_FALSE(check_buffer_alignment(mcp_gdma, src, dst, n), ESP_ERR_INVALID_ARG, TAG, "buffer not aligned: %p -> %p, sz=%zu", src, dst, n);
+    }
+
+    // pick one transaction node from idle queue, the whole batch shares it
+    trans = try_pop_trans_from_idle_queue(mcp_gdma);
+    ESP_RETURN_ON_FALSE(trans, ESP_ERR_INVALID_STATE, TAG, "no free node in the idle queue");
+
+    // merge adjacent regions, so contiguous copies share descriptors and cache sync calls
+    src_spans = heap_caps_malloc(num_regions * sizeof(mcp_gdma_span_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    dst_spans = heap_caps_malloc(num_regions * sizeof(mcp_gdma_span_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    ESP_GOTO_ON_FALSE(src_spans && dst_spans, ESP_ERR_NO_MEM, err, TAG, "no mem for span list");
+    size_t num_src_spans = mcp_gdma_merge_regions(regions, num_regions, true, src_spans);
+    size_t num_dst_spans = mcp_gdma_merge_regions(regions, num_regions, false, dst_spans);
+
+    // calculate how many descriptors we want
+    size_t max_single_dma_buffer = mcp_gdma->max_single_dma_buffer;
+    size_t num_tx_desc = mcp_gdma_count_desc(src_spans, num_src_spans, max_single_dma_buffer);
+    size_t num_rx_desc = mcp_gdma_count_desc(dst_spans, num_dst_spans, max_single_dma_buffer);
+    // allocate DMA descriptors from internal memory
+    trans->tx_desc_link = heap_caps_aligned_calloc(MCP_DMA_DESC_ALIGN, num_tx_desc, sizeof(mcp_dma_descriptor_t),
+                                                   MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT | MALLOC_CAP_DMA);
+    ESP_GOTO_ON_FALSE(trans->tx_desc_link, ESP_ERR_NO_MEM, err, TAG, "no mem for DMA descriptors");
+    trans->tx_desc_nc = (mcp_dma_descriptor_t *)MCP_GET_NON_CACHE_ADDR(trans->tx_desc_link);
+    // don't have to allocate the EOF descriptor, we will use trans->eof_node as the RX EOF descriptor
+    if (num_rx_desc > 1) {
+        trans->rx_desc_link = heap_caps_aligned_calloc(MCP_DMA_DESC_ALIGN, num_rx_desc - 1, sizeof(mcp_dma_descriptor_t),
+                                                       MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT | MALLOC_CAP_DMA);
+        ESP_GOTO_ON_FALSE(trans->rx_desc_link, ESP_ERR_NO_MEM, err, TAG, "no mem for DMA descriptors");
+        trans->rx_desc_nc = (mcp_dma_descriptor_t *)MCP_GET_NON_CACHE_ADDR(trans->rx_desc_link);
+    } else {
+        // small copy batch, use the trans->eof_node is sufficient
+        trans->rx_desc_link = NULL;
+        trans->rx_desc_nc = NULL;
+    }
+
+    // (preload) mount the merged spans to the TX/RX descriptor chains
+    mount_tx_spans_to_dma(trans, src_spans, num_src_spans, num_tx_desc, max_single_dma_buffer);
+    mount_rx_spans_to_dma(trans, dst_spans, num_dst_spans, num_rx_desc, max_single_dma_buffer);
+
+    // if the source data is in the cache, write back per merged span, then DMA can see the latest data
+    for (size_t i = 0; i < num_src_spans; i++) {
+        bool need_write_back = false;
+        if (esp_ptr_external_ram(src_spans[i].start)) {
+            need_write_back = true;
+        } else if (esp_ptr_internal(src_spans[i].start)) {
+#if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
+            need_write_back = true;
+#endif
+        }
+        if (need_write_back) {
+            esp_cache_msync(src_spans[i].start, src_spans[i].len, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+        }
+    }
+    free(src_spans); // source spans are no longer needed once synced and mounted
+    src_spans = NULL;
+
+    // save other transaction context
+    trans->cb = cb_isr;
+    trans->cb_args = cb_args;
+    trans->memcpy_size = 0;
+    trans->memcpy_dst_addr = NULL;
+    trans->dst_spans = dst_spans; // retained until completion, for the cache invalidate
+    trans->num_dst_spans = num_dst_spans;
+    trans->tx_start_desc_addr = (intptr_t)trans->tx_desc_link;
+    trans->rx_start_desc_addr = trans->rx_desc_link ? (intptr_t)trans->rx_desc_link : (intptr_t)&trans->eof_node;
+
+    portENTER_CRITICAL(&mcp_gdma->spin_lock);
+    // insert the trans to ready queue
+    STAILQ_INSERT_TAIL(&mcp_gdma->ready_queue_head, trans, ready_queue_entry);
+    portEXIT_CRITICAL(&mcp_gdma->spin_lock);
+
+    // check driver state, if there's no running transaction, start a new one
+    try_start_pending_transaction(mcp_gdma);
+
+    return ESP_OK;
+
+err:
+    if (src_spans) {
+        free(src_spans);
+    }
+    if (dst_spans) {
+        free(dst_spans);
+    }
+    if (trans) {
+        if (trans->tx_desc_link) {
+            free(trans->tx_desc_link);
+            trans->tx_desc_link = NULL;
+        }
+        if (trans->rx_desc_link) {
+            free(trans->rx_desc_link);
+            trans->rx_desc_link = NULL;
+        }
+        // return back the trans to idle queue
+        portENTER_CRITICAL(&mcp_gdma->spin_lock);
+        STAILQ_INSERT_TAIL(&mcp_gdma->idle_queue_head, trans, idle_queue_entry);
+        portEXIT_CRITICAL(&mcp_gdma->spin_lock);
+    }
+    return ret;
+}
+
 static bool mcp_gdma_rx_eof_callback(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data)
 {
     bool need_yield = false;
@@ -460,18 +679,37 @@ static bool mcp_gdma_rx_eof_callback(gdma_channel_handle_t dma_chan, gdma_event_
     // switch driver state from RUN to IDLE
     async_memcpy_fsm_t expected_fsm = MCP_FSM_RUN;
     if (atomic_compare_exchange_strong(&mcp_gdma->fsm, &expected_fsm, MCP_FSM_IDLE_WAIT)) {
-        void *dst = trans->memcpy_dst_addr;
         // if the data is in the cache, invalidate, then CPU can see the latest data
-        bool need_invalidate = false;
-        if (esp_ptr_external_ram(dst)) {
-            need_invalidate = true;
-        } else if (esp_ptr_internal(dst)) {
+        if (trans->dst_spans) {
+            // batched transaction: invalidate per merged destination span
+            for (uint32_t i = 0; i < trans->num_dst_spans; i++) {
+                bool need_invalidate = false;
+                if (esp_ptr_external_ram(trans->dst_spans[i].start)) {
+                    need_invalidate = true;
+                } else if (esp_ptr_internal(trans->dst_spans[i].start)) {
 #if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
-            need_invalidate = true;
+                    need_invalidate = true;
 #endif
-        }
-        if (need_invalidate) {
-            esp_cache_msync(dst, trans->memcpy_size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+                }
+                if (need_invalidate) {
+                    esp_cache_msync(trans->dst_spans[i].start, trans->dst_spans[i].len, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+                }
+            }
+            free(trans->dst_spans);
+            trans->dst_spans = NULL;
+        } else {
+            void *dst = trans->memcpy_dst_addr;
+            bool need_invalidate = false;
+            if (esp_ptr_external_ram(dst)) {
+                need_invalidate = true;
+            } else if (esp_ptr_internal(dst)) {
+#if SOC_CACHE_INTERNAL_MEM_VIA_L1CACHE
+                need_invalidate = true;
+#endif
+            }
+            if (need_invalidate) {
+                esp_cache_msync(dst, trans->memcpy_size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+            }
         }
 
         // invoked callback registered by user
@@ -22,6 +22,13 @@ esp_err_t esp_async_memcpy(async_memcpy_handle_t asmcp, void *dst, void *src, si
     return asmcp->memcpy(asmcp, dst, src, n, cb_isr, cb_args);
 }
 
+esp_err_t esp_async_memcpy_batch(async_memcpy_handle_t asmcp, const async_memcpy_region_t *regions, size_t num_regions, async_memcpy_isr_cb_t cb_isr, void *cb_args)
+{
+    ESP_RETURN_ON_FALSE(asmcp && regions && num_regions, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(asmcp->memcpy_batch, ESP_ERR_NOT_SUPPORTED, TAG, "batch copy not supported by the backend");
+    return asmcp->memcpy_batch(asmcp, regions, num_regions, cb_isr, cb_args);
+}
+
 #if SOC_ETM_SUPPORTED
 esp_err_t esp_async_memcpy_new_etm_event(async_memcpy_handle_t asmcp, async_memcpy_etm_event_t event_type, esp_etm_event_handle_t *out_event)
 {
@@ -33,6 +33,8 @@ typedef struct async_memcpy_context_t async_memcpy_context_t;
 struct async_memcpy_context_t {
     /// @brief Start a new async memcpy transaction
     esp_err_t (*memcpy)(async_memcpy_context_t *ctx, void *dst, void *src, size_t n, async_memcpy_isr_cb_t cb_isr, void *cb_args);
+    /// @brief Start a batch of copy regions as one transaction (optional, can be NULL if the backend doesn't support it)
+    esp_err_t (*memcpy_batch)(async_memcpy_context_t *ctx, const async_memcpy_region_t *regions, size_t num_regions, async_memcpy_isr_cb_t cb_isr, void *cb_args);
 #if SOC_ETM_SUPPORTED
     /// @brief Create ETM event handle of specific event type
     esp_err_t (*new_etm_event)(async_memcpy_context_t *ctx, async_memcpy_etm_event_t event_type, esp_etm_event_handle_t *out_event);
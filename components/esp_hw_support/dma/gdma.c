@@ -248,6 +248,11 @@ esp_err_t gdma_del_channel(gdma_channel_handle_t dma_chan)
     gdma_group_t *group = pair->group;
     gdma_hal_context_t *hal = &group->hal;
 
+    // release the bandwidth reservation, in case the user forgot to
+    if (dma_chan->flags.bandwidth_reserved) {
+        gdma_reserve_bandwidth(dma_chan, false);
+    }
+
     // reset the channel priority to default
     gdma_hal_set_priority(hal, pair->pair_id, dma_chan->direction, 0);
 
@@ -442,8 +447,77 @@ esp_err_t gdma_set_priority(gdma_channel_handle_t dma_chan, uint32_t priority)
     gdma_pair_t *pair = dma_chan->pair;
     gdma_group_t *group = pair->group;
     gdma_hal_context_t *hal = &group->hal;
+    uint32_t *reserved_mask = (dma_chan->direction == GDMA_CHANNEL_DIRECTION_TX) ? &group->tx_bw_reserved_mask : &group->rx_bw_reserved_mask;
+    bool conflict = false;
+
+    portENTER_CRITICAL(&group->spinlock);
+    if (dma_chan->flags.bandwidth_reserved) {
+        // priority of a bandwidth reserved channel is pinned to the top
+        conflict = true;
+    } else if (*reserved_mask && priority == GDMA_LL_CHANNEL_MAX_PRIORITY) {
+        // the top priority belongs to the reservation holder exclusively
+        conflict = true;
+    }
+    if (!conflict) {
+        gdma_hal_set_priority(hal, pair->pair_id, dma_chan->direction, priority);
+    }
+    portEXIT_CRITICAL(&group->spinlock);
+    ESP_RETURN_ON_FALSE(!conflict, ESP_ERR_INVALID_STATE, TAG, "priority %"PRIu32" conflicts with bandwidth reservation", priority);
+
+    return ESP_OK;
+}
+
+esp_err_t gdma_reserve_bandwidth(gdma_channel_handle_t dma_chan, bool reserve)
+{
+    ESP_RETURN_ON_FALSE(dma_chan, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    gdma_pair_t *pair = dma_chan->pair;
+    gdma_group_t *group = pair->group;
+    gdma_hal_context_t *hal = &group->hal;
+    uint32_t *reserved_mask = (dma_chan->direction == GDMA_CHANNEL_DIRECTION_TX) ? &group->tx_bw_reserved_mask : &group->rx_bw_reserved_mask;
+    bool conflict = false;
+
+    portENTER_CRITICAL(&group->spinlock);
+    if (reserve) {
+        if (*reserved_mask && !dma_chan->flags.bandwidth_reserved) {
+            conflict = true; // another channel already holds the reservation
+        } else {
+            *reserved_mask |= 1 << pair->pair_id;
+            dma_chan->flags.bandwidth_reserved = true;
+            gdma_hal_set_priority(hal, pair->pair_id, dma_chan->direction, GDMA_LL_CHANNEL_MAX_PRIORITY);
+        }
+    } else {
+        if (!dma_chan->flags.bandwidth_reserved) {
+            conflict = true; // channel doesn't hold a reservation
+        } else {
+            *reserved_mask &= ~(1 << pair->pair_id);
+            dma_chan->flags.bandwidth_reserved = false;
+            gdma_hal_set_priority(hal, pair->pair_id, dma_chan->direction, 0);
+        }
+    }
+    portEXIT_CRITICAL(&group->spinlock);
+    ESP_RETURN_ON_FALSE(!conflict, ESP_ERR_INVALID_STATE, TAG, "bandwidth reservation conflict");
+
+    return ESP_OK;
+}
 
-    gdma_hal_set_priority(hal, pair->pair_id, dma_chan->direction, priority);
+esp_err_t gdma_get_statistics(gdma_channel_handle_t dma_chan, gdma_channel_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE_ISR(dma_chan && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    portENTER_CRITICAL_SAFE(&dma_chan->spinlock);
+    *stats = dma_chan->stats;
+    portEXIT_CRITICAL_SAFE(&dma_chan->spinlock);
+
+    return ESP_OK;
+}
+
+esp_err_t gdma_reset_statistics(gdma_channel_handle_t dma_chan)
+{
+    ESP_RETURN_ON_FALSE_ISR(dma_chan, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    portENTER_CRITICAL_SAFE(&dma_chan->spinlock);
+    memset(&dma_chan->stats, 0, sizeof(dma_chan->stats));
+    portEXIT_CRITICAL_SAFE(&dma_chan->spinlock);
 
     return ESP_OK;
 }
@@ -803,10 +877,15 @@ void gdma_default_rx_isr(void *args)
     if (intr_status & GDMA_LL_EVENT_RX_SUC_EOF) {
         eof_addr = gdma_hal_get_eof_desc_addr(&group->hal, pair->pair_id, GDMA_CHANNEL_DIRECTION_RX, true);
         normal_eof = true;
+        rx_chan->base.stats.eof_count++;
     }
     if (intr_status & GDMA_LL_EVENT_RX_ERR_EOF) {
         eof_addr = gdma_hal_get_eof_desc_addr(&group->hal, pair->pair_id, GDMA_CHANNEL_DIRECTION_RX, false);
         abnormal_eof = true;
+        rx_chan->base.stats.abnormal_eof_count++;
+    }
+    if (intr_status & GDMA_LL_EVENT_RX_DESC_ERROR) {
+        rx_chan->base.stats.desc_error_count++;
     }
     gdma_event_data_t edata = {
         .rx_eof_desc_addr = eof_addr,
@@ -847,6 +926,12 @@ void gdma_default_tx_isr(void *args)
     uint32_t intr_status = gdma_hal_read_intr_status(hal, pair_id, GDMA_CHANNEL_DIRECTION_TX, false);
     gdma_hal_clear_intr(hal, pair_id, GDMA_CHANNEL_DIRECTION_TX, intr_status);
 
+    if (intr_status & GDMA_LL_EVENT_TX_EOF) {
+        tx_chan->base.stats.eof_count++;
+    }
+    if (intr_status & GDMA_LL_EVENT_TX_DESC_ERROR) {
+        tx_chan->base.stats.desc_error_count++;
+    }
     if ((intr_status & GDMA_LL_EVENT_TX_EOF) && tx_chan->cbs.on_trans_eof) {
         uint32_t eof_addr = gdma_hal_get_eof_desc_addr(hal, pair_id, GDMA_CHANNEL_DIRECTION_TX, true);
         gdma_event_data_t edata = {
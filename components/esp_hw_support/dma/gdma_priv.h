@@ -50,6 +50,8 @@ typedef struct gdma_group_t {
     portMUX_TYPE spinlock;  // group level spinlock, protect group level stuffs, e.g. hal object, pair handle slots and reference count of each pair
     uint32_t tx_periph_in_use_mask; // each bit indicates which peripheral (TX direction) has been occupied
     uint32_t rx_periph_in_use_mask; // each bit indicates which peripheral (RX direction) has been occupied
+    uint32_t tx_bw_reserved_mask;   // each bit indicates which pair holds a bandwidth reservation in the TX direction
+    uint32_t rx_bw_reserved_mask;   // each bit indicates which pair holds a bandwidth reservation in the RX direction
     gdma_pair_t *pairs[SOC_GDMA_PAIRS_PER_GROUP_MAX];  // handles of GDMA pairs
     int pair_ref_counts[SOC_GDMA_PAIRS_PER_GROUP_MAX]; // reference count used to protect pair install/uninstall
 } gdma_group_t;
@@ -72,8 +74,10 @@ struct gdma_channel_t {
     size_t int_mem_alignment; // alignment for memory in internal memory
     size_t ext_mem_alignment; // alignment for memory in external memory
     esp_err_t (*del)(gdma_channel_t *channel); // channel deletion function, it's polymorphic, see `gdma_del_tx_channel` or `gdma_del_rx_channel`
+    gdma_channel_stats_t stats; // channel event statistics, updated by the default ISR
     struct {
         uint32_t start_stop_by_etm: 1; // whether the channel is started/stopped by ETM
+        uint32_t bandwidth_reserved: 1; // whether the channel holds the bandwidth reservation of its group+direction
     } flags;
 };
 
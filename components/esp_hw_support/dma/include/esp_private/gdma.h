@@ -109,6 +109,17 @@ typedef struct {
     bool eof_till_data_popped;   /*!< If set / clear, DMA channel out_eof event is triggered on out / in DMA hardware fifo */
 } gdma_strategy_config_t;
 
+/**
+ * @brief GDMA channel event statistics
+ * @note The counters are maintained by the driver's default interrupt handler,
+ *       so an event is only counted when its interrupt is enabled (i.e. the corresponding callback is registered).
+ */
+typedef struct {
+    uint32_t eof_count;          /*!< Number of transfers that finished with a normal EOF */
+    uint32_t abnormal_eof_count; /*!< Number of transfers that finished with an abnormal/error EOF (RX channel only) */
+    uint32_t desc_error_count;   /*!< Number of descriptor errors detected by the DMA engine */
+} gdma_channel_stats_t;
+
 /**
  * @brief Create AHB-GDMA channel
  * @note This API won't install interrupt service for the allocated channel.
@@ -236,6 +247,53 @@ esp_err_t gdma_apply_strategy(gdma_channel_handle_t dma_chan, const gdma_strateg
  */
 esp_err_t gdma_set_priority(gdma_channel_handle_t dma_chan, uint32_t priority);
 
+/**
+ * @brief Reserve the arbitration bandwidth of a GDMA group for one channel
+ *
+ * @note The reservation raises the channel to the highest arbitration priority and pins it there;
+ *       as long as the reservation is held, no other channel of the same group and direction can be
+ *       promoted to the top priority, so the reserved channel always wins the bus arbitration.
+ *       Only one channel per group and direction can hold a reservation, which makes the guarantee
+ *       meaningful for latency sensitive consumers, e.g. an LCD refresh stream.
+ * @note The reservation is released automatically when the channel is deleted.
+ *
+ * @param[in] dma_chan GDMA channel handle, allocated by `gdma_new_channel`
+ * @param[in] reserve True to acquire the bandwidth reservation, false to release it
+ * @return
+ *      - ESP_OK: Update bandwidth reservation successfully
+ *      - ESP_ERR_INVALID_ARG: Update bandwidth reservation failed because of invalid argument
+ *      - ESP_ERR_INVALID_STATE: Update bandwidth reservation failed because another channel already holds it, or the channel doesn't hold one
+ *      - ESP_FAIL: Update bandwidth reservation failed because of other error
+ */
+esp_err_t gdma_reserve_bandwidth(gdma_channel_handle_t dma_chan, bool reserve);
+
+/**
+ * @brief Get the event statistics of a GDMA channel
+ *
+ * @note This function is allowed to run within ISR context
+ *
+ * @param[in] dma_chan GDMA channel handle, allocated by `gdma_new_channel`
+ * @param[out] stats Returned channel statistics
+ * @return
+ *      - ESP_OK: Get channel statistics successfully
+ *      - ESP_ERR_INVALID_ARG: Get channel statistics failed because of invalid argument
+ *      - ESP_FAIL: Get channel statistics failed because of other error
+ */
+esp_err_t gdma_get_statistics(gdma_channel_handle_t dma_chan, gdma_channel_stats_t *stats);
+
+/**
+ * @brief Reset the event statistics of a GDMA channel back to zero
+ *
+ * @note This function is allowed to run within ISR context
+ *
+ * @param[in] dma_chan GDMA channel handle, allocated by `gdma_new_channel`
+ * @return
+ *      - ESP_OK: Reset channel statistics successfully
+ *      - ESP_ERR_INVALID_ARG: Reset channel statistics failed because of invalid argument
+ *      - ESP_FAIL: Reset channel statistics failed because of other error
+ */
+esp_err_t gdma_reset_statistics(gdma_channel_handle_t dma_chan);
+
 /**
  * @brief Delete GDMA channel
  * @note If you call `gdma_new_channel` several times for a same peripheral, make sure you call this API the same times.
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include "soc/soc_caps.h"
+#include "esp_private/gdma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SOC_GDMA_SUPPORT_CRC || __DOXYGEN__
+
+/**
+ * @brief gdma_config_crc_calculator() preset for the standard CRC-32 (ISO-HDLC)
+ *
+ * With this preset the GDMA CRC engine accumulates the same checksum that
+ * esp_crc32_le() computes, concurrently with a transfer the application is
+ * doing anyway. The engine's raw result still needs the reflect-out and
+ * xor-out steps of the algorithm, see gdma_crc32_finalize().
+ *
+ * Usage:
+ *     gdma_config_crc_calculator(chan, &(gdma_crc_calculator_config_t)GDMA_CRC32_CALCULATOR_CONFIG());
+ *     // ... run the transfer, wait for completion ...
+ *     gdma_crc_get_result(chan, &raw);
+ *     uint32_t crc = gdma_crc32_finalize(raw); // equals esp_crc32_le(0, data, len)
+ *
+ * Frames split over several transfers are stitched together with
+ * esp_crc32_le_combine().
+ */
+#define GDMA_CRC32_CALCULATOR_CONFIG() \
+    {                                  \
+        .crc_bit_width = 32,           \
+        .poly_hex = 0x04C11DB7,        \
+        .init_value = 0xFFFFFFFF,      \
+        .reverse_data_mask = true,     \
+    }
+
+/**
+ * @brief Convert the GDMA CRC engine's raw accumulator into a standard CRC-32
+ *
+ * Applies the reflect-out and xor-out steps of CRC-32/ISO-HDLC, making the
+ * result comparable with esp_crc32_le() and usable with esp_crc32_le_combine().
+ *
+ * @param raw_result Raw result read with gdma_crc_get_result()
+ * @return Standard CRC-32 of the transferred data
+ */
+static inline uint32_t gdma_crc32_finalize(uint32_t raw_result)
+{
+    uint32_t reflected = 0;
+    for (int i = 0; i < 32; i++) {
+        reflected = (reflected << 1) | (raw_result & 1);
+        raw_result >>= 1;
+    }
+    return reflected ^ 0xFFFFFFFF;
+}
+
+#endif // SOC_GDMA_SUPPORT_CRC || __DOXYGEN__
+
+#ifdef __cplusplus
+}
+#endif
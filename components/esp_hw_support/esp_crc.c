@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdint.h>
+#include "esp_crc.h"
+
+// Reflected form of the CRC-32 polynomial used by esp_crc32_le
+#define CRC32_LE_POLY_REFLECTED 0xEDB88320
+
+// Multiply a GF(2) 32x32 matrix by a vector
+static uint32_t gf2_matrix_times(const uint32_t *mat, uint32_t vec)
+{
+    uint32_t sum = 0;
+    while (vec) {
+        if (vec & 1) {
+            sum ^= *mat;
+        }
+        vec >>= 1;
+        mat++;
+    }
+    return sum;
+}
+
+// Square a GF(2) 32x32 matrix
+static void gf2_matrix_square(uint32_t *square, const uint32_t *mat)
+{
+    for (int n = 0; n < 32; n++) {
+        square[n] = gf2_matrix_times(mat, mat[n]);
+    }
+}
+
+uint32_t esp_crc32_le_combine(uint32_t crc1, uint32_t crc2, uint32_t len2)
+{
+    uint32_t even[32];  // even-power-of-two zero operator
+    uint32_t odd[32];   // odd-power-of-two zero operator
+
+    if (len2 == 0) {
+        return crc1;
+    }
+
+    // operator for one zero bit: the CRC shift with the reflected polynomial
+    odd[0] = CRC32_LE_POLY_REFLECTED;
+    uint32_t row = 1;
+    for (int n = 1; n < 32; n++) {
+        odd[n] = row;
+        row <<= 1;
+    }
+    // operator for two zero bits, then four (one zero byte)
+    gf2_matrix_square(even, odd);
+    gf2_matrix_square(odd, even);
+
+    // apply len2 zero bytes to crc1, squaring the operator for each bit of len2
+    do {
+        gf2_matrix_square(even, odd);
+        if (len2 & 1) {
+            crc1 = gf2_matrix_times(even, crc1);
+        }
+        len2 >>= 1;
+        if (len2 == 0) {
+            break;
+        }
+        gf2_matrix_square(odd, even);
+        if (len2 & 1) {
+            crc1 = gf2_matrix_times(odd, crc1);
+        }
+        len2 >>= 1;
+    } while (len2 != 0);
+
+    return crc1 ^ crc2;
+}
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_private/esp_wide_copy.h"
+
+/* Wide memory fill/copy, see esp_private/esp_wide_copy.h.
+ *
+ * The vector path uses the 128-bit PIE instructions of the ESP32-S3. The PIE
+ * register file is coprocessor 3 ("cop_ai") and is lazily saved/restored by
+ * the FreeRTOS port on first use per task, so clobbering q0/q1 here is safe
+ * in task context. Interrupt handlers must not touch coprocessors, hence the
+ * runtime fallback below.
+ */
+
+#if CONFIG_IDF_TARGET_ESP32S3 && CONFIG_ESP_WIDE_COPY_PIE
+#define WIDE_COPY_HAVE_PIE 1
+#else
+#define WIDE_COPY_HAVE_PIE 0
+#endif
+
+/* Below this size the setup cost outweighs the vector stores */
+#define WIDE_COPY_PIE_MIN_BYTES 128
+
+/* Fill/copy word-by-word, unrolled; tails handled by the byte loop */
+static void wide_memset_words(uint8_t *dst, uint8_t c, size_t n)
+{
+    uint32_t pattern = 0x01010101UL * c;
+
+    if (((uintptr_t)dst & 3) == 0) {
+        uint32_t *dw = (uint32_t *)dst;
+        while (n >= 16) {
+            dw[0] = pattern;
+            dw[1] = pattern;
+            dw[2] = pattern;
+            dw[3] = pattern;
+            dw += 4;
+            n -= 16;
+        }
+        while (n >= 4) {
+            *dw++ = pattern;
+            n -= 4;
+        }
+        dst = (uint8_t *)dw;
+    }
+    while (n--) {
+        *dst++ = c;
+    }
+}
+
+static void wide_memcpy_words(uint8_t *dst, const uint8_t *src, size_t n)
+{
+    if ((((uintptr_t)dst | (uintptr_t)src) & 3) == 0) {
+        uint32_t *dw = (uint32_t *)dst;
+        const uint32_t *sw = (const uint32_t *)src;
+        while (n >= 16) {
+            dw[0] = sw[0];
+            dw[1] = sw[1];
+            dw[2] = sw[2];
+            dw[3] = sw[3];
+            dw += 4;
+            sw += 4;
+            n -= 16;
+        }
+        while (n >= 4) {
+            *dw++ = *sw++;
+            n -= 4;
+        }
+        dst = (uint8_t *)dw;
+        src = (const uint8_t *)sw;
+    }
+    while (n--) {
+        *dst++ = *src++;
+    }
+}
+
+#if WIDE_COPY_HAVE_PIE
+/* Coprocessor use is only permitted in a running task */
+static inline bool wide_copy_vector_usable(void)
+{
+    return !xPortInIsrContext() && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING;
+}
+#endif
+
+void esp_wide_memset(void *dst, uint8_t c, size_t n)
+{
+    uint8_t *d = (uint8_t *)dst;
+
+#if WIDE_COPY_HAVE_PIE
+    if (n >= WIDE_COPY_PIE_MIN_BYTES && wide_copy_vector_usable()) {
+        /* Head: advance to 16-byte alignment */
+        size_t head = (16 - (uintptr_t)d) & 15;
+        wide_memset_words(d, c, head);
+        d += head;
+        n -= head;
+
+        uint32_t pattern[4] __attribute__((aligned(16))) = {
+            0x01010101UL * c, 0x01010101UL * c, 0x01010101UL * c, 0x01010101UL * c
+        };
+        const uint32_t *pat = pattern;
+        asm volatile ("ee.vld.128.ip q0, %0, 0" : : "r" (pat) : "memory");
+        while (n >= 64) {
+            asm volatile ("ee.vst.128.ip q0, %0, 16\n"
+                          "ee.vst.128.ip q0, %0, 16\n"
+                          "ee.vst.128.ip q0, %0, 16\n"
+                          "ee.vst.128.ip q0, %0, 16\n"
+                          : "+r" (d) : : "memory");
+            n -= 64;
+        }
+        while (n >= 16) {
+            asm volatile ("ee.vst.128.ip q0, %0, 16" : "+r" (d) : : "memory");
+            n -= 16;
+        }
+    }
+#endif // WIDE_COPY_HAVE_PIE
+
+    wide_memset_words(d, c, n);
+}
+
+void esp_wide_memcpy(void *dst, const void *src, size_t n)
+{
+    uint8_t *d = (uint8_t *)dst;
+    const uint8_t *s = (const uint8_t *)src;
+
+#if WIDE_COPY_HAVE_PIE
+    /* The aligned vector loads/stores require both pointers to reach 16-byte
+       alignment at the same point */
+    if (n >= WIDE_COPY_PIE_MIN_BYTES &&
+            (((uintptr_t)d ^ (uintptr_t)s) & 15) == 0 &&
+            wide_copy_vector_usable()) {
+        size_t head = (16 - (uintptr_t)d) & 15;
+        wide_memcpy_words(d, s, head);
+        d += head;
+        s += head;
+        n -= head;
+
+        while (n >= 32) {
+            asm volatile ("ee.vld.128.ip q0, %0, 16\n"
+                          "ee.vld.128.ip q1, %0, 16\n"
+                          "ee.vst.128.ip q0, %1, 16\n"
+                          "ee.vst.128.ip q1, %1, 16\n"
+                          : "+r" (s), "+r" (d) : : "memory");
+            n -= 32;
+        }
+        while (n >= 16) {
+            asm volatile ("ee.vld.128.ip q0, %0, 16\n"
+                          "ee.vst.128.ip q0, %1, 16\n"
+                          : "+r" (s), "+r" (d) : : "memory");
+            n -= 16;
+        }
+    }
+#endif // WIDE_COPY_HAVE_PIE
+
+    wide_memcpy_words(d, s, n);
+}
@@ -161,6 +161,37 @@ esp_err_t esp_async_memcpy_uninstall(async_memcpy_handle_t mcp);
  */
 esp_err_t esp_async_memcpy(async_memcpy_handle_t mcp, void *dst, void *src, size_t n, async_memcpy_isr_cb_t cb_isr, void *cb_args);
 
+/**
+ * @brief One copy region inside a batched memory copy request
+ */
+typedef struct {
+    void *dst;   /*!< Destination address (copy to) */
+    void *src;   /*!< Source address (copy from) */
+    size_t size; /*!< Number of bytes to copy */
+} async_memcpy_region_t;
+
+/**
+ * @brief Send a batch of memory copy requests that complete with a single callback
+ *
+ * @note The whole batch is chained into one DMA transaction: the callback is invoked once, after the last region
+ *       has been copied. Regions whose source (or destination) buffers are contiguous in memory are merged into
+ *       a single DMA descriptor, and the cache synchronization is planned per merged region, so submitting many
+ *       small copies in one batch is much cheaper than issuing them one by one.
+ * @note The callback function is invoked in interrupt context, never do blocking jobs in the callback.
+ *
+ * @param[in] mcp Handle of async memcpy driver that returned from `esp_async_memcpy_install`
+ * @param[in] regions Array of copy regions, only needs to be valid during this function call
+ * @param[in] num_regions Number of copy regions in the `regions` array
+ * @param[in] cb_isr Callback function, which got invoked in interrupt context when the whole batch is finished. Set to NULL can bypass the callback.
+ * @param[in] cb_args User defined argument to be passed to the callback function
+ * @return
+ *      - ESP_OK: Send batched memory copy request successfully
+ *      - ESP_ERR_INVALID_ARG: Send batched memory copy request failed because of invalid argument
+ *      - ESP_ERR_NOT_SUPPORTED: Send batched memory copy request failed because the DMA backend doesn't support it
+ *      - ESP_FAIL: Send batched memory copy request failed because of other error
+ */
+esp_err_t esp_async_memcpy_batch(async_memcpy_handle_t mcp, const async_memcpy_region_t *regions, size_t num_regions, async_memcpy_isr_cb_t cb_isr, void *cb_args);
+
 #if SOC_ETM_SUPPORTED
 /**
  * @brief Async memory copy specific events that supported by the ETM module
@@ -92,6 +92,22 @@ static inline uint8_t esp_crc8_be(uint8_t crc, uint8_t const *buf, uint32_t len)
     return esp_rom_crc8_be(crc, buf, len);
 }
 
+/**
+* @brief Combine two CRC32 values as if their data had been one buffer.
+*
+* Given crc1 = esp_crc32_le(0, buf1, len1) and crc2 = esp_crc32_le(0, buf2, len2),
+* returns esp_crc32_le(0, buf1 || buf2, len1 + len2) without touching the data.
+* This allows chunks to be checksummed independently (e.g. by the GDMA CRC engine
+* during transfers, by another core, or out of order) and stitched together in
+* O(log len2) time.
+*
+* @param crc1: CRC32 of the first chunk
+* @param crc2: CRC32 of the second chunk
+* @param len2: Length of the second chunk in bytes
+* @return CRC32 of the concatenated chunks
+*/
+uint32_t esp_crc32_le_combine(uint32_t crc1, uint32_t crc2, uint32_t len2);
+
 #ifdef __cplusplus
 }
 #endif
@@ -186,6 +186,66 @@ esp_err_t esp_intr_alloc(int source, int flags, intr_handler_t handler, void *ar
 esp_err_t esp_intr_alloc_intrstatus(int source, int flags, uint32_t intrstatusreg, uint32_t intrstatusmask, intr_handler_t handler, void *arg, intr_handle_t *ret_handle);
 
 
+/**
+ * @brief Allocate an interrupt with the given parameters on a specific CPU core.
+ *
+ * Behaves like esp_intr_alloc, except that the interrupt is connected to the given
+ * core instead of the core the calling task happens to run on. Drivers usually
+ * initialize from core 0, which piles every peripheral interrupt onto it; use this
+ * function (or esp_intr_set_affinity afterwards) to steer interrupt load to another
+ * core deliberately.
+ *
+ * When the target core differs from the calling core, the allocation is performed
+ * through a blocking IPC call, so this function must not be called from an ISR, a
+ * critical section, or an IPC callback once the scheduler is running. Before the
+ * scheduler is started, only the calling core may be targeted.
+ *
+ * @param source The interrupt source, see esp_intr_alloc
+ * @param flags An ORred mask of the ESP_INTR_FLAG_* defines
+ * @param handler The interrupt handler
+ * @param arg Optional argument for passed to the interrupt handler
+ * @param cpu The CPU core to connect the interrupt to
+ * @param ret_handle Pointer to an intr_handle_t to store a handle that can later be
+ *               used to request details or free the interrupt. Can be NULL if no handle
+ *               is required.
+ *
+ * @return ESP_ERR_INVALID_ARG if the combination of arguments is invalid, or cpu is out of range.
+ *         ESP_ERR_INVALID_STATE the scheduler is not running yet and cpu is not the calling core
+ *         ESP_ERR_NOT_FOUND No free interrupt found with the specified flags on the given core
+ *         ESP_OK otherwise
+ */
+esp_err_t esp_intr_alloc_on_cpu(int source, int flags, intr_handler_t handler, void *arg, uint32_t cpu, intr_handle_t *ret_handle);
+
+
+/**
+ * @brief Move an allocated interrupt to another CPU core.
+ *
+ * Frees the interrupt on its current core and re-allocates it with the original
+ * parameters on the given core, re-routing the source in the interrupt matrix. The
+ * handle stays valid and keeps referring to the interrupt afterwards. While the
+ * migration is in flight, the source is disconnected: level-triggered sources
+ * re-assert once the new vector is connected, edge-triggered pulses arriving in
+ * that window are lost.
+ *
+ * If no suitable interrupt input is free on the target core, the interrupt is
+ * restored on its original core and an error is returned. The interrupt comes back
+ * enabled unless it was allocated with ESP_INTR_FLAG_INTRDISABLED.
+ *
+ * This function uses blocking IPC calls and must not be called from an ISR, a
+ * critical section, or an IPC callback.
+ *
+ * @param handle The handle, as obtained by esp_intr_alloc or esp_intr_alloc_intrstatus
+ * @param cpu The CPU core to move the interrupt to
+ *
+ * @return ESP_ERR_INVALID_ARG if the handle is NULL or cpu is out of range
+ *         ESP_ERR_NOT_SUPPORTED the interrupt uses a per-CPU internal source that cannot be re-routed
+ *         ESP_ERR_INVALID_STATE the scheduler is not running yet
+ *         ESP_ERR_NOT_FOUND No free interrupt input on the target core (interrupt restored on the original core)
+ *         ESP_OK otherwise
+ */
+esp_err_t esp_intr_set_affinity(intr_handle_t handle, uint32_t cpu);
+
+
 /**
  * @brief Disable and free an interrupt.
  *
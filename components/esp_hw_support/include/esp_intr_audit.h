@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_ESP_INTR_AUDIT || __DOXYGEN__
+
+/**
+ * @brief Set the per-ISR execution budget used by the interrupt auditor
+ *
+ * Handler runs longer than this are counted per source and recorded in the
+ * over-budget event log together with the ISR they preempted, if any. The
+ * initial value is CONFIG_ESP_INTR_AUDIT_BUDGET_US.
+ *
+ * @param budget_us Budget in microseconds, must be non-zero
+ */
+void esp_intr_audit_set_budget(uint32_t budget_us);
+
+/**
+ * @brief Clear all statistics and the over-budget event log
+ */
+void esp_intr_audit_reset(void);
+
+/**
+ * @brief Dump the interrupt audit statistics
+ *
+ * Prints one line per interrupt source that has fired since the last reset:
+ * invocation count, maximum and average handler duration, the number of runs
+ * exceeding the budget, and a log2 histogram of handler durations. A handler
+ * that overruns its budget delays every equal- or lower-priority interrupt
+ * pending behind it, so the over-budget column points directly at latency
+ * culprits. The most recent over-budget runs are listed afterwards, each with
+ * the source that was already executing when the offender started (if any).
+ *
+ * @param stream The stream to dump to, if NULL then stdout is used
+ * @return ESP_OK on success
+ */
+esp_err_t esp_intr_audit_dump(FILE *stream);
+
+/**
+ * @brief Get the total ISR cycles spent on a CPU core since the last reset
+ *
+ * Together with esp_intr_set_affinity this allows steering interrupt load
+ * between the cores: compare the per-core totals, then move heavy sources
+ * (the top entries of esp_intr_audit_dump) to the idler core.
+ *
+ * @param cpu CPU core number
+ * @return Accumulated handler cycles on that core, 0 if cpu is out of range
+ */
+uint64_t esp_intr_audit_get_cpu_cycles(uint32_t cpu);
+
+#endif // CONFIG_ESP_INTR_AUDIT || __DOXYGEN__
+
+#ifdef __cplusplus
+}
+#endif
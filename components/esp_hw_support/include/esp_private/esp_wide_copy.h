@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Fill a buffer, using the widest store path available on the target
+ *
+ * Semantically equivalent to memset(). On targets with the 128-bit processor
+ * instruction extensions (ESP32-S3) large aligned runs are written with
+ * 128-bit vector stores, which significantly raises the fill bandwidth to
+ * external (PSRAM) memory compared to the word loop of the ROM memset.
+ * On other targets, and for small or unaligned buffers, an unrolled word
+ * loop is used.
+ *
+ * @note May only be called from task context: the vector path uses
+ *       coprocessor registers which are lazily saved by the scheduler and
+ *       are not available in interrupt handlers. The implementation falls
+ *       back to the word loop when called from an ISR or before the
+ *       scheduler is started.
+ *
+ * @param dst Buffer to fill
+ * @param c   Fill byte
+ * @param n   Number of bytes to fill
+ */
+void esp_wide_memset(void *dst, uint8_t c, size_t n);
+
+/**
+ * @brief Copy a buffer, using the widest load/store path available
+ *
+ * Semantically equivalent to memcpy() for non-overlapping buffers; the same
+ * target and context restrictions as for esp_wide_memset() apply. The vector
+ * path requires source and destination to be mutually 16-byte alignable,
+ * otherwise the word loop is used.
+ *
+ * @param dst Destination buffer, must not overlap src
+ * @param src Source buffer
+ * @param n   Number of bytes to copy
+ */
+void esp_wide_memcpy(void *dst, const void *src, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
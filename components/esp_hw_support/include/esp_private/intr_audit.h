@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_ESP_INTR_AUDIT
+
+/**
+ * Per-invocation bookkeeping kept on the wrapper's stack between the
+ * enter and exit hooks.
+ */
+typedef struct {
+    uint32_t start_cycles;  // CPU cycle count at handler entry
+    int16_t prev_source;    // source already executing on this CPU, or -1
+} intr_audit_frame_t;
+
+/**
+ * @brief Stamp ISR entry for the given interrupt source
+ *
+ * Called by the intr_alloc dispatch wrappers immediately before invoking
+ * the handler. Must be paired with esp_intr_audit_isr_exit().
+ */
+void esp_intr_audit_isr_enter(int source, intr_audit_frame_t *frame);
+
+/**
+ * @brief Stamp ISR exit and update the statistics for the given source
+ */
+void esp_intr_audit_isr_exit(int source, intr_audit_frame_t *frame);
+
+#endif // CONFIG_ESP_INTR_AUDIT
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief
+ * This file is for the temperature-aware MSPI timing re-tuning service, private APIs
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief MSPI re-tuning service configuration
+ */
+typedef struct {
+    uint32_t poll_interval_ms;      /*!< Die temperature poll interval, in ms. 0 to use the default (5000 ms) */
+    int band_width_celsius;         /*!< Width of one temperature band, in celsius degree. The delay-line settings are
+                                         re-applied each time the filtered die temperature moves into a new band.
+                                         0 to use the default (20 celsius degree) */
+    int hysteresis_celsius;         /*!< Extra margin the temperature needs to move beyond a band edge before a
+                                         re-tune is triggered, to avoid oscillating on a boundary.
+                                         0 to use the default (3 celsius degree) */
+} mspi_timing_retune_config_t;
+
+/**
+ * @brief MSPI re-tuning service runtime info
+ */
+typedef struct {
+    int last_temperature;           /*!< Last filtered die temperature, in celsius degree */
+    int current_band;               /*!< Band the service currently considers active. Band 0 contains the
+                                         temperature measured when the service was started */
+    uint32_t retune_count;          /*!< Number of re-tunes done since the service was started */
+} mspi_timing_retune_info_t;
+
+/**
+ * @brief Start the MSPI temperature re-tuning service
+ *
+ * The service periodically samples the on-chip temperature sensor and, whenever the die temperature
+ * crosses into a new configured band, briefly switches MSPI into low speed mode and back
+ * (`mspi_timing_change_speed_mode_cache_safe`), re-applying the tuned delay-line / dummy settings at
+ * the current temperature corner. This avoids having to derate the MSPI clocks for the worst-case
+ * temperature on boards that see large swings at runtime.
+ *
+ * @note On targets without MSPI timing tuning or without a temperature sensor this returns
+ *       `ESP_ERR_NOT_SUPPORTED`.
+ * @note Mutually exclusive with `CONFIG_SPIRAM_TIMING_TUNING_POINT_VIA_TEMPERATURE_SENSOR`, which
+ *       already adjusts the PSRAM timing point from its own temperature monitor task.
+ *
+ * @param config Service configuration, fields left 0 take default values
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_ARG:   Null configuration
+ *        - ESP_ERR_INVALID_STATE: Service already started, or another temperature adjustment scheme is active
+ *        - ESP_ERR_NOT_SUPPORTED: Target has no tunable MSPI timing or no temperature sensor
+ *        - ESP_ERR_NO_MEM:        Out of memory
+ */
+esp_err_t mspi_timing_retune_start(const mspi_timing_retune_config_t *config);
+
+/**
+ * @brief Stop the MSPI temperature re-tuning service
+ *
+ * The delay-line settings applied by the last re-tune are kept.
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_STATE: Service not started
+ */
+esp_err_t mspi_timing_retune_stop(void);
+
+/**
+ * @brief Force a re-tune now, regardless of the band the current temperature is in
+ *
+ * The band tracking is re-based on the temperature measured during this call.
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_STATE: Service not started
+ */
+esp_err_t mspi_timing_retune_force(void);
+
+/**
+ * @brief Get re-tuning service runtime info
+ *
+ * @param[out] out_info Runtime info
+ *
+ * @return
+ *        - ESP_OK:                On success
+ *        - ESP_ERR_INVALID_ARG:   Null pointer
+ *        - ESP_ERR_INVALID_STATE: Service not started
+ */
+esp_err_t mspi_timing_retune_get_info(mspi_timing_retune_info_t *out_info);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_ESP_SPINLOCK_CONTENTION_STATS || __DOXYGEN__
+
+/**
+ * @brief Dump the spinlock contention statistics
+ *
+ * Prints one line per spinlock that has been contended since boot (or the
+ * last reset): the lock's address, the return address of the most recent
+ * contended acquisition (resolvable to a symbol with addr2line), the number
+ * of contended acquisitions and the total, average and maximum number of
+ * microseconds spent spinning for it. Locks that are only ever taken
+ * uncontended never appear: the fast path of spinlock_acquire() is not
+ * instrumented and keeps its normal cost.
+ *
+ * @param stream The stream to dump to, if NULL then stdout is used
+ * @return ESP_OK on success
+ */
+esp_err_t esp_spinlock_dump_contention(FILE *stream);
+
+/**
+ * @brief Reset the contention counters of all tracked spinlocks
+ */
+void esp_spinlock_reset_contention(void);
+
+#endif // CONFIG_ESP_SPINLOCK_CONTENTION_STATS || __DOXYGEN__
+
+#ifdef __cplusplus
+}
+#endif
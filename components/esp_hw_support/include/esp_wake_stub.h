@@ -35,6 +35,84 @@ extern "C" {
  */
 void esp_wake_stub_sleep(esp_deep_sleep_wake_stub_fn_t new_stub);
 
+/**
+ * @brief Reason why the wake stub event filter let a wakeup continue to full boot
+ */
+typedef enum {
+    ESP_WAKE_STUB_FILTER_WAKE_NONE = 0,     /*!< No full wake has been triggered by the filter yet */
+    ESP_WAKE_STUB_FILTER_WAKE_THRESHOLD,    /*!< Accumulated event count reached the threshold */
+    ESP_WAKE_STUB_FILTER_WAKE_TIMEOUT,      /*!< Oldest pending event got older than max_defer_us */
+    ESP_WAKE_STUB_FILTER_WAKE_CAUSE,        /*!< Wakeup cause matched full_wake_cause_mask */
+} esp_wake_stub_filter_wake_reason_t;
+
+/**
+ * @brief Wake stub event filter configuration
+ */
+typedef struct {
+    uint32_t threshold_count;       /*!< Continue to full boot once this many wake events have accumulated.
+                                         Must be at least 1. 1 disables the filtering (every wake is a full wake) */
+    uint64_t max_defer_us;          /*!< Continue to full boot once the oldest pending event is this old, even if
+                                         the threshold has not been reached. 0 means events are never aged out */
+    uint32_t full_wake_cause_mask;  /*!< Hardware wakeup causes (as returned by `esp_wake_stub_get_wakeup_cause`)
+                                         which always continue to full boot, e.g. the sleep timer. 0 to filter all causes */
+} esp_wake_stub_filter_config_t;
+
+/**
+ * @brief Batch of wake events accumulated by the wake stub event filter
+ */
+typedef struct {
+    uint32_t count;                               /*!< Number of wake events accumulated since the last full wake */
+    uint32_t cause_mask;                          /*!< OR of the hardware wakeup causes of the accumulated events */
+    uint64_t first_event_time_us;                 /*!< RTC time of the first accumulated event, in us */
+    uint64_t last_event_time_us;                  /*!< RTC time of the most recent accumulated event, in us */
+    esp_wake_stub_filter_wake_reason_t wake_reason; /*!< Why the last wakeup continued to full boot */
+} esp_wake_stub_filter_batch_t;
+
+/**
+ * @brief Wake stub installed by `esp_wake_stub_filter_enable()`, resident in RTC memory
+ */
+void esp_wake_stub_filter_entry(void);
+
+/**
+ * @brief Enable the wake stub event filter
+ *
+ * Installs a wake stub that tallies wake events in RTC memory and puts the chip straight back into
+ * deep sleep, within a few microseconds and without running the bootloader, until the configured
+ * threshold is reached, the oldest pending event ages out, or a wakeup cause from
+ * `full_wake_cause_mask` fires. The accumulated batch is then available to the application through
+ * `esp_wake_stub_filter_get_batch()` after the full wake.
+ *
+ * This must be called before each `esp_deep_sleep_start()` the filter should cover, as a full wake
+ * leaves the default wake stub installed again.
+ *
+ * @param config Filter configuration
+ *
+ * @return
+ *        - ESP_OK:              On success
+ *        - ESP_ERR_INVALID_ARG: Null config, or threshold_count is 0
+ */
+esp_err_t esp_wake_stub_filter_enable(const esp_wake_stub_filter_config_t *config);
+
+/**
+ * @brief Disable the wake stub event filter
+ *
+ * Any wake event accumulated so far stays readable through `esp_wake_stub_filter_get_batch()`.
+ */
+void esp_wake_stub_filter_disable(void);
+
+/**
+ * @brief Get (and clear) the batch of wake events accumulated by the wake stub event filter
+ *
+ * Call this after a full wake to learn how many filtered wake events happened during deep sleep.
+ *
+ * @param[out] out_batch Accumulated event batch
+ *
+ * @return
+ *        - ESP_OK:              On success
+ *        - ESP_ERR_INVALID_ARG: Null pointer
+ */
+esp_err_t esp_wake_stub_filter_get_batch(esp_wake_stub_filter_batch_t *out_batch);
+
 /**
  * @brief Wait while uart transmission is in progress
  *
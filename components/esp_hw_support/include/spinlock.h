@@ -44,6 +44,17 @@ typedef struct {
     NEED_VOLATILE_MUX uint32_t count;
 } spinlock_t;
 
+#if CONFIG_ESP_SPINLOCK_CONTENTION_STATS
+/**
+ * @brief Record a contended spinlock acquisition (implemented in spinlock_stats.c)
+ *
+ * Called by spinlock_acquire() whenever taking a lock required spinning,
+ * i.e. only on the slow path. Dump the collected statistics with
+ * esp_spinlock_dump_contention() (esp_spinlock_stats.h).
+ */
+void spinlock_profile_record(spinlock_t *lock, void *caller, uint32_t spin_cycles);
+#endif
+
 /**
  * @brief Initialize a lock to its default state - unlocked
  * @param lock - spinlock object to initialize
@@ -136,6 +147,11 @@ static inline bool __attribute__((always_inline)) spinlock_acquire(spinlock_t *l
         // Keep looping if we are waiting forever, or check if we have timed out
     } while ((timeout == SPINLOCK_WAIT_FOREVER) || (esp_cpu_get_cycle_count() - start_count) <= (esp_cpu_cycle_count_t)timeout);
 
+#if CONFIG_ESP_SPINLOCK_CONTENTION_STATS
+    spinlock_profile_record(lock, __builtin_return_address(0),
+                            (uint32_t)(esp_cpu_get_cycle_count() - start_count));
+#endif
+
 exit:
     if (lock_set) {
         assert(lock->owner == core_owner_id);
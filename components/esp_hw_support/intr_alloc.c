@@ -30,6 +30,10 @@
 #include "esp_ipc.h"
 #endif
 
+#if CONFIG_ESP_INTR_AUDIT
+#include "esp_private/intr_audit.h"
+#endif
+
 /* For targets that uses a CLIC as their interrupt controller, CPU_INT_LINES_COUNT represents the external interrupts count */
 #define CPU_INT_LINES_COUNT 32
 
@@ -87,6 +91,16 @@ struct vector_desc_t {
 typedef struct intr_handle_data_t {
     vector_desc_t *vector_desc;
     shared_vector_desc_t *shared_vector_desc;
+#if !CONFIG_FREERTOS_UNICORE
+    //Original allocation parameters, so esp_intr_set_affinity can re-allocate
+    //the interrupt on another core.
+    int source;
+    int flags;
+    uint32_t intrstatusreg;
+    uint32_t intrstatusmask;
+    intr_handler_t handler;
+    void *handler_arg;
+#endif
 } intr_handle_data_t;
 
 typedef struct non_shared_isr_arg_t non_shared_isr_arg_t;
@@ -442,7 +456,14 @@ static void IRAM_ATTR shared_intr_isr(void *arg)
         if (!sh_vec->disabled) {
             if ((sh_vec->statusreg == NULL) || (*sh_vec->statusreg & sh_vec->statusmask)) {
                 traceISR_ENTER(sh_vec->source + ETS_INTERNAL_INTR_SOURCE_OFF);
+#if CONFIG_ESP_INTR_AUDIT
+                intr_audit_frame_t audit_frame;
+                esp_intr_audit_isr_enter(sh_vec->source, &audit_frame);
+#endif
                 sh_vec->isr(sh_vec->arg);
+#if CONFIG_ESP_INTR_AUDIT
+                esp_intr_audit_isr_exit(sh_vec->source, &audit_frame);
+#endif
                 // check if we will return to scheduler or to interrupted task after ISR
                 if (!os_task_switch_is_pended(esp_cpu_get_core_id())) {
                     traceISR_EXIT();
@@ -454,21 +475,32 @@ static void IRAM_ATTR shared_intr_isr(void *arg)
     portEXIT_CRITICAL_ISR(&spinlock);
 }
 
-#if CONFIG_APPTRACE_SV_ENABLE
+#if CONFIG_APPTRACE_SV_ENABLE || CONFIG_ESP_INTR_AUDIT
 //Common non-shared isr handler wrapper.
 static void IRAM_ATTR non_shared_intr_isr(void *arg)
 {
     non_shared_isr_arg_t *ns_isr_arg = (non_shared_isr_arg_t*)arg;
+#if CONFIG_ESP_INTR_AUDIT
+    intr_audit_frame_t audit_frame;
+    esp_intr_audit_isr_enter(ns_isr_arg->source, &audit_frame);
+#endif
+#if CONFIG_APPTRACE_SV_ENABLE
     portENTER_CRITICAL_ISR(&spinlock);
     traceISR_ENTER(ns_isr_arg->source + ETS_INTERNAL_INTR_SOURCE_OFF);
     // FIXME: can we call ISR and check os_task_switch_is_pended() after releasing spinlock?
     // when CONFIG_APPTRACE_SV_ENABLE = 0 ISRs for non-shared IRQs are called without spinlock
+#endif
     ns_isr_arg->isr(ns_isr_arg->isr_arg);
+#if CONFIG_APPTRACE_SV_ENABLE
     // check if we will return to scheduler or to interrupted task after ISR
     if (!os_task_switch_is_pended(esp_cpu_get_core_id())) {
         traceISR_EXIT();
     }
     portEXIT_CRITICAL_ISR(&spinlock);
+#endif
+#if CONFIG_ESP_INTR_AUDIT
+    esp_intr_audit_isr_exit(ns_isr_arg->source, &audit_frame);
+#endif
 }
 #endif
 
@@ -591,7 +623,7 @@ esp_err_t esp_intr_alloc_intrstatus(int source, int flags, uint32_t intrstatusre
         //Mark as unusable for other interrupt sources. This is ours now!
         vd->flags = VECDESC_FL_NONSHARED;
         if (handler) {
-#if CONFIG_APPTRACE_SV_ENABLE
+#if CONFIG_APPTRACE_SV_ENABLE || CONFIG_ESP_INTR_AUDIT
             non_shared_isr_arg_t *ns_isr_arg = heap_caps_malloc(sizeof(non_shared_isr_arg_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
             if (!ns_isr_arg) {
                 portEXIT_CRITICAL(&spinlock);
@@ -627,6 +659,14 @@ esp_err_t esp_intr_alloc_intrstatus(int source, int flags, uint32_t intrstatusre
     //Fill return handle data.
     ret->vector_desc = vd;
     ret->shared_vector_desc = vd->shared_vec_info;
+#if !CONFIG_FREERTOS_UNICORE
+    ret->source = source;
+    ret->flags = flags;
+    ret->intrstatusreg = intrstatusreg;
+    ret->intrstatusmask = intrstatusmask;
+    ret->handler = handler;
+    ret->handler_arg = arg;
+#endif
 
     //Enable int at CPU-level;
     ESP_INTR_ENABLE(intr);
@@ -677,6 +717,121 @@ esp_err_t esp_intr_alloc(int source, int flags, intr_handler_t handler, void *ar
     return esp_intr_alloc_intrstatus(source, flags, 0, 0, handler, arg, ret_handle);
 }
 
+#if !CONFIG_FREERTOS_UNICORE
+typedef struct {
+    int source;
+    int flags;
+    uint32_t intrstatusreg;
+    uint32_t intrstatusmask;
+    intr_handler_t handler;
+    void *arg;
+    intr_handle_t *ret_handle;
+    esp_err_t ret;
+} intr_alloc_ipc_arg_t;
+
+static void intr_alloc_for_other_cpu(void *arg)
+{
+    intr_alloc_ipc_arg_t *ipc_arg = (intr_alloc_ipc_arg_t *)arg;
+    ipc_arg->ret = esp_intr_alloc_intrstatus(ipc_arg->source, ipc_arg->flags, ipc_arg->intrstatusreg,
+                                             ipc_arg->intrstatusmask, ipc_arg->handler, ipc_arg->arg,
+                                             ipc_arg->ret_handle);
+}
+
+static esp_err_t intr_alloc_intrstatus_on_cpu(int source, int flags, uint32_t intrstatusreg, uint32_t intrstatusmask,
+                                              intr_handler_t handler, void *arg, uint32_t cpu, intr_handle_t *ret_handle)
+{
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) {
+        //No IPC tasks yet; early startup code runs on a known core anyway.
+        if (cpu != esp_cpu_get_core_id()) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        return esp_intr_alloc_intrstatus(source, flags, intrstatusreg, intrstatusmask, handler, arg, ret_handle);
+    }
+    //Run the allocation on the target core through the IPC call, so the "allocate on
+    //the calling core" behaviour of esp_intr_alloc_intrstatus lands it where we want it.
+    intr_alloc_ipc_arg_t ipc_arg = {
+        .source = source,
+        .flags = flags,
+        .intrstatusreg = intrstatusreg,
+        .intrstatusmask = intrstatusmask,
+        .handler = handler,
+        .arg = arg,
+        .ret_handle = ret_handle,
+        .ret = ESP_FAIL,
+    };
+    esp_err_t err = esp_ipc_call_blocking(cpu, &intr_alloc_for_other_cpu, &ipc_arg);
+    return (err == ESP_OK) ? ipc_arg.ret : ESP_FAIL;
+}
+#endif //!CONFIG_FREERTOS_UNICORE
+
+esp_err_t esp_intr_alloc_on_cpu(int source, int flags, intr_handler_t handler, void *arg, uint32_t cpu, intr_handle_t *ret_handle)
+{
+    if (cpu >= SOC_CPU_CORES_NUM) {
+        return ESP_ERR_INVALID_ARG;
+    }
+#if CONFIG_FREERTOS_UNICORE
+    return esp_intr_alloc_intrstatus(source, flags, 0, 0, handler, arg, ret_handle);
+#else
+    return intr_alloc_intrstatus_on_cpu(source, flags, 0, 0, handler, arg, cpu, ret_handle);
+#endif
+}
+
+esp_err_t esp_intr_set_affinity(intr_handle_t handle, uint32_t cpu)
+{
+    if (!handle || cpu >= SOC_CPU_CORES_NUM) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (handle->vector_desc->cpu == cpu) {
+        return ESP_OK;
+    }
+#if CONFIG_FREERTOS_UNICORE
+    return ESP_ERR_INVALID_ARG;
+#else
+    //Per-CPU internal sources are tied to their core and cannot be re-routed.
+    if (handle->source < 0) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    //Keep a copy of the allocation record, then release the old vector first: the
+    //source must never be serviced on two cores at once. The source is masked in
+    //the interrupt matrix in between, level-triggered sources re-assert once the
+    //new vector is connected.
+    intr_handle_data_t record = *handle;
+    intr_handle_t tmp = heap_caps_malloc(sizeof(intr_handle_data_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (tmp == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    *tmp = record;
+    esp_err_t ret = esp_intr_free(tmp);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    intr_handle_t new_handle = NULL;
+    ret = intr_alloc_intrstatus_on_cpu(record.source, record.flags, record.intrstatusreg, record.intrstatusmask,
+                                       record.handler, record.handler_arg, cpu, &new_handle);
+    if (ret != ESP_OK) {
+        //Try to restore the interrupt on the core it came from, so a failed
+        //migration doesn't leave the source disconnected.
+        esp_err_t restore = intr_alloc_intrstatus_on_cpu(record.source, record.flags, record.intrstatusreg,
+                                                         record.intrstatusmask, record.handler, record.handler_arg,
+                                                         record.vector_desc->cpu, &new_handle);
+        if (restore != ESP_OK) {
+            ESP_LOGE(TAG, "failed to restore %s on cpu %d after failed migration",
+                     esp_isr_names[record.source], record.vector_desc->cpu);
+            return restore;
+        }
+    }
+    //The caller keeps its handle pointer, move the new allocation into it.
+    *handle = *new_handle;
+    free(new_handle);
+    return ret;
+#endif //!CONFIG_FREERTOS_UNICORE
+}
+
 esp_err_t IRAM_ATTR esp_intr_set_in_iram(intr_handle_t handle, bool is_in_iram)
 {
     if (!handle) {
@@ -772,7 +927,7 @@ static esp_err_t intr_free_for_current_cpu(intr_handle_t handle)
 
     if ((handle->vector_desc->flags & VECDESC_FL_NONSHARED) || free_shared_vector) {
         ESP_EARLY_LOGV(TAG, "esp_intr_free: Disabling int, killing handler");
-#if CONFIG_APPTRACE_SV_ENABLE
+#if CONFIG_APPTRACE_SV_ENABLE || CONFIG_ESP_INTR_AUDIT
         if (!free_shared_vector) {
             void *isr_arg = esp_cpu_intr_get_handler_arg(handle->vector_desc->intno);
             if (isr_arg) {
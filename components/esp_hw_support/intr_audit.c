@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <inttypes.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "soc/interrupts.h"
+#include "soc/soc_caps.h"
+#include "esp_intr_audit.h"
+#include "esp_private/intr_audit.h"
+
+/*
+ * Handler durations are bucketed by log2 of the duration in microseconds:
+ * <1us, 1us, 2-3us, 4-7us, 8-15us, 16-31us, 32-63us, >=64us.
+ */
+#define INTR_AUDIT_HIST_BUCKETS 8
+
+// Number of most recent over-budget handler runs kept for the dump
+#define INTR_AUDIT_EVENT_COUNT  16
+
+typedef struct {
+    uint32_t count;                             // handler invocations
+    uint32_t max_cycles;                        // longest handler run
+    uint64_t total_cycles;                      // sum over all runs
+    uint32_t over_budget;                       // runs exceeding the budget
+    uint32_t hist[INTR_AUDIT_HIST_BUCKETS];     // log2(us) duration histogram
+} intr_audit_stats_t;
+
+typedef struct {
+    int16_t source;         // source that overran the budget
+    int16_t preempted;      // source it had preempted, or -1
+    uint32_t cycles;        // handler duration
+} intr_audit_event_t;
+
+// An interrupt source is routed to a single CPU, so each stats entry has a
+// single writer and needs no locking on the hot path.
+static intr_audit_stats_t s_stats[ETS_MAX_INTR_SOURCE];
+
+// Source currently executing per CPU, stored as source + 1 so that the
+// zero-initialized state means "none".
+static volatile int16_t s_active_source[SOC_CPU_CORES_NUM];
+
+// Total handler cycles per CPU; single writer per entry (the CPU itself).
+// Nested handlers are counted in full on both levels, same as total_cycles.
+static uint64_t s_cpu_cycles[SOC_CPU_CORES_NUM];
+
+// Over-budget event ring, shared between cores; rare enough to take a lock for
+static intr_audit_event_t s_events[INTR_AUDIT_EVENT_COUNT];
+static uint32_t s_event_next;
+static portMUX_TYPE s_audit_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Computed lazily on the first ISR entry so no init hook is needed
+static uint32_t s_budget_cycles;
+static uint32_t s_ticks_per_us;
+
+void IRAM_ATTR esp_intr_audit_isr_enter(int source, intr_audit_frame_t *frame)
+{
+    if (s_budget_cycles == 0) {
+        s_ticks_per_us = esp_rom_get_cpu_ticks_per_us();
+        s_budget_cycles = CONFIG_ESP_INTR_AUDIT_BUDGET_US * s_ticks_per_us;
+    }
+    uint32_t cpu = esp_cpu_get_core_id();
+    frame->prev_source = s_active_source[cpu] - 1;
+    s_active_source[cpu] = source + 1;
+    frame->start_cycles = esp_cpu_get_cycle_count();
+}
+
+void IRAM_ATTR esp_intr_audit_isr_exit(int source, intr_audit_frame_t *frame)
+{
+    uint32_t cycles = esp_cpu_get_cycle_count() - frame->start_cycles;
+    uint32_t cpu = esp_cpu_get_core_id();
+    s_active_source[cpu] = frame->prev_source + 1;
+    s_cpu_cycles[cpu] += cycles;
+
+    intr_audit_stats_t *stats = &s_stats[source];
+    stats->count++;
+    stats->total_cycles += cycles;
+    if (cycles > stats->max_cycles) {
+        stats->max_cycles = cycles;
+    }
+    uint32_t us = cycles / s_ticks_per_us;
+    int bucket = (us == 0) ? 0 : (32 - __builtin_clz(us));
+    if (bucket >= INTR_AUDIT_HIST_BUCKETS) {
+        bucket = INTR_AUDIT_HIST_BUCKETS - 1;
+    }
+    stats->hist[bucket]++;
+
+    if (cycles > s_budget_cycles) {
+        stats->over_budget++;
+        portENTER_CRITICAL_ISR(&s_audit_lock);
+        intr_audit_event_t *ev = &s_events[s_event_next % INTR_AUDIT_EVENT_COUNT];
+        ev->source = source;
+        ev->preempted = frame->prev_source;
+        ev->cycles = cycles;
+        s_event_next++;
+        portEXIT_CRITICAL_ISR(&s_audit_lock);
+    }
+}
+
+void esp_intr_audit_set_budget(uint32_t budget_us)
+{
+    if (budget_us == 0) {
+        return;
+    }
+    s_ticks_per_us = esp_rom_get_cpu_ticks_per_us();
+    s_budget_cycles = budget_us * s_ticks_per_us;
+}
+
+void esp_intr_audit_reset(void)
+{
+    portENTER_CRITICAL(&s_audit_lock);
+    memset(s_stats, 0, sizeof(s_stats));
+    memset(s_events, 0, sizeof(s_events));
+    memset((void *)s_cpu_cycles, 0, sizeof(s_cpu_cycles));
+    s_event_next = 0;
+    portEXIT_CRITICAL(&s_audit_lock);
+}
+
+esp_err_t esp_intr_audit_dump(FILE *stream)
+{
+    if (stream == NULL) {
+        stream = stdout;
+    }
+    uint32_t ticks_per_us = esp_rom_get_cpu_ticks_per_us();
+    uint32_t budget_cycles = s_budget_cycles ? s_budget_cycles : CONFIG_ESP_INTR_AUDIT_BUDGET_US * ticks_per_us;
+
+    fprintf(stream, "Interrupt audit, budget %" PRIu32 " us:\n", budget_cycles / ticks_per_us);
+    for (int cpu = 0; cpu < SOC_CPU_CORES_NUM; cpu++) {
+        fprintf(stream, " CPU%d ISR load: %" PRIu64 " cycles (%" PRIu64 " us)\n",
+                cpu, s_cpu_cycles[cpu], s_cpu_cycles[cpu] / ticks_per_us);
+    }
+    fprintf(stream, " Source                Count    Max(us)    Avg(us)  >Budget  <1us 1 2 4 8 16 32 64+\n");
+    for (int source = 0; source < ETS_MAX_INTR_SOURCE; source++) {
+        const intr_audit_stats_t *stats = &s_stats[source];
+        if (stats->count == 0) {
+            continue;
+        }
+        fprintf(stream, " %-20s %6" PRIu32 " %10" PRIu32 " %10" PRIu32 " %8" PRIu32 " ",
+                esp_isr_names[source], stats->count,
+                stats->max_cycles / ticks_per_us,
+                (uint32_t)(stats->total_cycles / stats->count / ticks_per_us),
+                stats->over_budget);
+        for (int b = 0; b < INTR_AUDIT_HIST_BUCKETS; b++) {
+            fprintf(stream, " %" PRIu32, stats->hist[b]);
+        }
+        fprintf(stream, "\n");
+    }
+
+    portENTER_CRITICAL(&s_audit_lock);
+    intr_audit_event_t events[INTR_AUDIT_EVENT_COUNT];
+    memcpy(events, s_events, sizeof(events));
+    uint32_t next = s_event_next;
+    portEXIT_CRITICAL(&s_audit_lock);
+
+    if (next != 0) {
+        fprintf(stream, "Most recent over-budget handler runs:\n");
+        uint32_t depth = next < INTR_AUDIT_EVENT_COUNT ? next : INTR_AUDIT_EVENT_COUNT;
+        for (uint32_t i = 0; i < depth; i++) {
+            const intr_audit_event_t *ev = &events[(next - 1 - i) % INTR_AUDIT_EVENT_COUNT];
+            fprintf(stream, " %s: %" PRIu32 " us", esp_isr_names[ev->source], ev->cycles / ticks_per_us);
+            if (ev->preempted >= 0) {
+                fprintf(stream, " (preempted %s)", esp_isr_names[ev->preempted]);
+            }
+            fprintf(stream, "\n");
+        }
+    }
+    return ESP_OK;
+}
+
+uint64_t esp_intr_audit_get_cpu_cycles(uint32_t cpu)
+{
+    if (cpu >= SOC_CPU_CORES_NUM) {
+        return 0;
+    }
+    return s_cpu_cycles[cpu];
+}
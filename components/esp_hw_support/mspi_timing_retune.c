@@ -0,0 +1,249 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief
+ *
+ * This file contains the temperature-aware MSPI timing re-tuning service.
+ *
+ * The MSPI delay-line / dummy settings selected during start-up tuning are only guaranteed at the
+ * temperature the chip booted at. On boards that run across a wide temperature range the timing
+ * margin shrinks towards the corners. This service monitors the die temperature and re-applies the
+ * timing configuration (via a low-speed / high-speed mode cycle, which is cache safe) whenever the
+ * temperature moves into a new band, so the MSPI clocks don't need to be derated for the worst case.
+ */
+
+#include <stdlib.h>
+#include <inttypes.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "soc/soc_caps.h"
+#include "esp_private/mspi_timing_retune.h"
+
+#if (SOC_MEMSPI_TIMING_TUNING_BY_MSPI_DELAY || SOC_MEMSPI_TIMING_TUNING_BY_DQS) && SOC_TEMP_SENSOR_SUPPORTED
+#define MSPI_TIMING_RETUNE_SUPPORTED    1
+#endif
+
+#if MSPI_TIMING_RETUNE_SUPPORTED
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_private/mspi_timing_tuning.h"
+#include "esp_private/sar_periph_ctrl.h"
+#endif
+
+static const char *TAG = "mspi_retune";
+
+#define MSPI_TIMING_RETUNE_DEFAULT_INTERVAL_MS    5000
+#define MSPI_TIMING_RETUNE_DEFAULT_BAND_CELSIUS   20
+#define MSPI_TIMING_RETUNE_DEFAULT_HYST_CELSIUS   3
+
+#if MSPI_TIMING_RETUNE_SUPPORTED
+
+#define MSPI_TIMING_RETUNE_TASK_STACK    3072
+#define MSPI_TIMING_RETUNE_TASK_PRIO     (configMAX_PRIORITIES - 2)
+// Trimmed-mean filter: sample n times, drop the min and max readings
+#define MSPI_TIMING_RETUNE_FILTER_LEN    7
+
+typedef struct {
+    TaskHandle_t task;
+    SemaphoreHandle_t lock;
+    volatile bool stop_requested;
+    uint32_t poll_interval_ms;
+    int band_width;
+    int hysteresis;
+    int ref_temperature;    // temperature at service start, centre of band 0
+    int current_band;
+    int last_temperature;
+    uint32_t retune_count;
+} retune_ctx_t;
+
+static retune_ctx_t *s_ctx = NULL;
+
+static int s_get_temperature_filtered(void)
+{
+    int16_t samples[MSPI_TIMING_RETUNE_FILTER_LEN];
+    int sum = 0;
+    int min_idx = 0;
+    int max_idx = 0;
+
+    for (int i = 0; i < MSPI_TIMING_RETUNE_FILTER_LEN; i++) {
+        samples[i] = temp_sensor_get_raw_value(NULL);
+        if (samples[i] < samples[min_idx]) {
+            min_idx = i;
+        }
+        if (samples[i] > samples[max_idx]) {
+            max_idx = i;
+        }
+        sum += samples[i];
+    }
+    sum -= samples[min_idx];
+    sum -= samples[max_idx];
+    return sum / (MSPI_TIMING_RETUNE_FILTER_LEN - 2);
+}
+
+static void s_do_retune(void)
+{
+    /**
+     * Cycling through low speed mode re-applies the clock configuration and the tuned delay-line /
+     * dummy registers. Both calls freeze the caches internally, so no flash / PSRAM access can hit
+     * the bus while the settings change.
+     */
+    mspi_timing_change_speed_mode_cache_safe(true);
+    mspi_timing_change_speed_mode_cache_safe(false);
+    s_ctx->retune_count++;
+}
+
+static void s_retune_task(void *arg)
+{
+    retune_ctx_t *ctx = (retune_ctx_t *)arg;
+
+    while (!ctx->stop_requested) {
+        vTaskDelay(pdMS_TO_TICKS(ctx->poll_interval_ms));
+        if (ctx->stop_requested) {
+            break;
+        }
+
+        xSemaphoreTake(ctx->lock, portMAX_DELAY);
+        int temperature = s_get_temperature_filtered();
+        ctx->last_temperature = temperature;
+
+        /**
+         * Band n covers [ref + (n - 0.5) * width, ref + (n + 0.5) * width). A re-tune only fires
+         * once the temperature is `hysteresis` degrees past the edge of the current band, so a
+         * reading sitting right on a boundary cannot toggle back and forth.
+         */
+        int delta = temperature - ctx->ref_temperature;
+        int band = (delta >= 0) ? ((delta + ctx->band_width / 2) / ctx->band_width)
+                   : -((-delta + ctx->band_width / 2) / ctx->band_width);
+        if (band != ctx->current_band) {
+            int edge = ctx->ref_temperature + ctx->current_band * ctx->band_width +
+                       ((band > ctx->current_band) ? (ctx->band_width / 2 + ctx->hysteresis)
+                        : -(ctx->band_width / 2 + ctx->hysteresis));
+            bool crossed = (band > ctx->current_band) ? (temperature >= edge) : (temperature <= edge);
+            if (crossed) {
+                ESP_LOGD(TAG, "temperature %d, band %d -> %d, re-tuning", temperature, ctx->current_band, band);
+                s_do_retune();
+                ctx->current_band = band;
+            }
+        }
+        xSemaphoreGive(ctx->lock);
+    }
+
+    temperature_sensor_power_release();
+    vTaskDelete(NULL);
+}
+
+esp_err_t mspi_timing_retune_start(const mspi_timing_retune_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(config, ESP_ERR_INVALID_ARG, TAG, "null configuration");
+    ESP_RETURN_ON_FALSE(!s_ctx, ESP_ERR_INVALID_STATE, TAG, "service already started");
+#if CONFIG_SPIRAM_TIMING_TUNING_POINT_VIA_TEMPERATURE_SENSOR
+    // The PSRAM timing point monitor task already adjusts the timing registers with temperature,
+    // two independent writers would fight over the same registers
+    ESP_RETURN_ON_FALSE(false, ESP_ERR_INVALID_STATE, TAG, "PSRAM timing point adjustment scheme is active");
+#endif
+
+    retune_ctx_t *ctx = calloc(1, sizeof(retune_ctx_t));
+    ESP_RETURN_ON_FALSE(ctx, ESP_ERR_NO_MEM, TAG, "no mem for service context");
+
+    ctx->poll_interval_ms = config->poll_interval_ms ? config->poll_interval_ms : MSPI_TIMING_RETUNE_DEFAULT_INTERVAL_MS;
+    ctx->band_width = config->band_width_celsius ? config->band_width_celsius : MSPI_TIMING_RETUNE_DEFAULT_BAND_CELSIUS;
+    ctx->hysteresis = config->hysteresis_celsius ? config->hysteresis_celsius : MSPI_TIMING_RETUNE_DEFAULT_HYST_CELSIUS;
+    ctx->lock = xSemaphoreCreateMutex();
+    if (!ctx->lock) {
+        free(ctx);
+        return ESP_ERR_NO_MEM;
+    }
+
+    temperature_sensor_power_acquire();
+    ctx->ref_temperature = s_get_temperature_filtered();
+    ctx->last_temperature = ctx->ref_temperature;
+
+    BaseType_t created = xTaskCreate(s_retune_task, "mspi_retune", MSPI_TIMING_RETUNE_TASK_STACK,
+                                     ctx, MSPI_TIMING_RETUNE_TASK_PRIO, &ctx->task);
+    if (created != pdTRUE) {
+        temperature_sensor_power_release();
+        vSemaphoreDelete(ctx->lock);
+        free(ctx);
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_ctx = ctx;
+    ESP_LOGI(TAG, "re-tuning service started, reference %d celsius, band width %d, interval %" PRIu32 " ms",
+             ctx->ref_temperature, ctx->band_width, ctx->poll_interval_ms);
+    return ESP_OK;
+}
+
+esp_err_t mspi_timing_retune_stop(void)
+{
+    ESP_RETURN_ON_FALSE(s_ctx, ESP_ERR_INVALID_STATE, TAG, "service not started");
+
+    retune_ctx_t *ctx = s_ctx;
+    s_ctx = NULL;
+    // The task releases the temperature sensor power and deletes itself on its next wakeup
+    ctx->stop_requested = true;
+    xSemaphoreTake(ctx->lock, portMAX_DELAY);
+    xSemaphoreGive(ctx->lock);
+    vSemaphoreDelete(ctx->lock);
+    free(ctx);
+    return ESP_OK;
+}
+
+esp_err_t mspi_timing_retune_force(void)
+{
+    ESP_RETURN_ON_FALSE(s_ctx, ESP_ERR_INVALID_STATE, TAG, "service not started");
+
+    xSemaphoreTake(s_ctx->lock, portMAX_DELAY);
+    s_ctx->ref_temperature = s_get_temperature_filtered();
+    s_ctx->last_temperature = s_ctx->ref_temperature;
+    s_ctx->current_band = 0;
+    s_do_retune();
+    xSemaphoreGive(s_ctx->lock);
+    return ESP_OK;
+}
+
+esp_err_t mspi_timing_retune_get_info(mspi_timing_retune_info_t *out_info)
+{
+    ESP_RETURN_ON_FALSE(out_info, ESP_ERR_INVALID_ARG, TAG, "null pointer");
+    ESP_RETURN_ON_FALSE(s_ctx, ESP_ERR_INVALID_STATE, TAG, "service not started");
+
+    xSemaphoreTake(s_ctx->lock, portMAX_DELAY);
+    out_info->last_temperature = s_ctx->last_temperature;
+    out_info->current_band = s_ctx->current_band;
+    out_info->retune_count = s_ctx->retune_count;
+    xSemaphoreGive(s_ctx->lock);
+    return ESP_OK;
+}
+
+#else //MSPI_TIMING_RETUNE_SUPPORTED
+
+esp_err_t mspi_timing_retune_start(const mspi_timing_retune_config_t *config)
+{
+    (void)config;
+    ESP_LOGE(TAG, "target has no tunable MSPI timing or no temperature sensor");
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t mspi_timing_retune_stop(void)
+{
+    return ESP_ERR_INVALID_STATE;
+}
+
+esp_err_t mspi_timing_retune_force(void)
+{
+    return ESP_ERR_INVALID_STATE;
+}
+
+esp_err_t mspi_timing_retune_get_info(mspi_timing_retune_info_t *out_info)
+{
+    (void)out_info;
+    return ESP_ERR_INVALID_STATE;
+}
+
+#endif //MSPI_TIMING_RETUNE_SUPPORTED
@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Wake stub event filter.
+ *
+ * High-rate wake sources (e.g. a vibration sensor on an RTC GPIO) can wake the chip hundreds of
+ * times an hour, and each wake normally pays for the full bootloader + app startup path. The filter
+ * installs a wake stub that only tallies the event in RTC memory and re-enters deep sleep within
+ * microseconds; the application gets one full wake with the whole accumulated batch once a
+ * threshold, age limit or privileged wakeup cause is hit.
+ *
+ * The stub code and its state must live in RTC memory and may only call ROM or RTC-resident
+ * functions, see the wake stub rules in docs and `sleep_wake_stub.c`.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "esp_attr.h"
+#include "esp_err.h"
+#include "esp_sleep.h"
+#include "esp_wake_stub.h"
+
+#include "soc/soc.h"
+#include "soc/rtc.h"
+#include "soc/soc_caps.h"
+#include "hal/clk_tree_ll.h"
+
+#if SOC_LP_TIMER_SUPPORTED
+#include "hal/lp_timer_ll.h"
+#else
+#include "hal/rtc_cntl_ll.h"
+#endif
+
+#include "sdkconfig.h"
+
+typedef struct {
+    // Configuration, written by the application before sleeping
+    uint32_t enabled;
+    uint32_t threshold_count;
+    uint64_t max_defer_ticks;       // max_defer_us converted to RTC slow clock ticks
+    uint32_t full_wake_cause_mask;
+    // Accumulated state, written by the wake stub
+    uint32_t count;
+    uint32_t cause_mask;
+    uint64_t first_event_ticks;
+    uint64_t last_event_ticks;
+    uint32_t wake_reason;
+} wake_stub_filter_state_t;
+
+static RTC_DATA_ATTR wake_stub_filter_state_t s_filter;
+
+static uint64_t RTC_IRAM_ATTR s_rtc_count(void)
+{
+#if SOC_LP_TIMER_SUPPORTED
+    lp_timer_ll_counter_snapshot(&LP_TIMER);
+    uint32_t lo = lp_timer_ll_get_counter_value_low(&LP_TIMER, 0);
+    uint32_t hi = lp_timer_ll_get_counter_value_high(&LP_TIMER, 0);
+    return (uint64_t)hi << 32 | lo;
+#else
+    return rtc_cntl_ll_get_rtc_time();
+#endif
+}
+
+void RTC_IRAM_ATTR esp_wake_stub_filter_entry(void)
+{
+    if (!s_filter.enabled) {
+        // Filter got disabled without clearing the stub, behave like the default stub
+        esp_default_wake_deep_sleep();
+        return;
+    }
+
+    uint32_t cause = esp_wake_stub_get_wakeup_cause();
+    uint64_t now = s_rtc_count();
+
+    if (s_filter.count == 0) {
+        s_filter.first_event_ticks = now;
+    }
+    s_filter.count++;
+    s_filter.last_event_ticks = now;
+    s_filter.cause_mask |= cause;
+
+    uint32_t reason = ESP_WAKE_STUB_FILTER_WAKE_NONE;
+    if (cause & s_filter.full_wake_cause_mask) {
+        reason = ESP_WAKE_STUB_FILTER_WAKE_CAUSE;
+    } else if (s_filter.count >= s_filter.threshold_count) {
+        reason = ESP_WAKE_STUB_FILTER_WAKE_THRESHOLD;
+    } else if (s_filter.max_defer_ticks != 0 && (now - s_filter.first_event_ticks) >= s_filter.max_defer_ticks) {
+        reason = ESP_WAKE_STUB_FILTER_WAKE_TIMEOUT;
+    }
+
+    if (reason != ESP_WAKE_STUB_FILTER_WAKE_NONE) {
+        // Threshold hit: hand over to the default stub and continue with the normal boot flow.
+        // The application re-arms the filter before the next esp_deep_sleep_start().
+        s_filter.wake_reason = reason;
+        s_filter.enabled = 0;
+        esp_default_wake_deep_sleep();
+        return;
+    }
+
+    // Just a tally: back to sleep right away, keeping ourselves installed as the wake stub
+    esp_wake_stub_sleep(&esp_wake_stub_filter_entry);
+}
+
+esp_err_t esp_wake_stub_filter_enable(const esp_wake_stub_filter_config_t *config)
+{
+    if (config == NULL || config->threshold_count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s_filter.enabled = 0;   // keep the stub passive while the fields are rewritten
+    s_filter.threshold_count = config->threshold_count;
+    s_filter.full_wake_cause_mask = config->full_wake_cause_mask;
+    // Same us <-> RTC slow tick conversion as esp_wake_stub_set_wakeup_time(), done here once
+    // so the stub itself doesn't need to touch the calibration value
+    s_filter.max_defer_ticks = config->max_defer_us * (1 << RTC_CLK_CAL_FRACT) / clk_ll_rtc_slow_load_cal();
+    s_filter.count = 0;
+    s_filter.cause_mask = 0;
+    s_filter.first_event_ticks = 0;
+    s_filter.last_event_ticks = 0;
+    s_filter.wake_reason = ESP_WAKE_STUB_FILTER_WAKE_NONE;
+    s_filter.enabled = 1;
+
+    esp_set_deep_sleep_wake_stub(&esp_wake_stub_filter_entry);
+    return ESP_OK;
+}
+
+void esp_wake_stub_filter_disable(void)
+{
+    s_filter.enabled = 0;
+}
+
+esp_err_t esp_wake_stub_filter_get_batch(esp_wake_stub_filter_batch_t *out_batch)
+{
+    if (out_batch == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t cal = clk_ll_rtc_slow_load_cal();
+    out_batch->count = s_filter.count;
+    out_batch->cause_mask = s_filter.cause_mask;
+    out_batch->first_event_time_us = (s_filter.first_event_ticks * cal) >> RTC_CLK_CAL_FRACT;
+    out_batch->last_event_time_us = (s_filter.last_event_ticks * cal) >> RTC_CLK_CAL_FRACT;
+    out_batch->wake_reason = (esp_wake_stub_filter_wake_reason_t)s_filter.wake_reason;
+
+    s_filter.count = 0;
+    s_filter.cause_mask = 0;
+    s_filter.first_event_ticks = 0;
+    s_filter.last_event_ticks = 0;
+    s_filter.wake_reason = ESP_WAKE_STUB_FILTER_WAKE_NONE;
+    return ESP_OK;
+}
@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <inttypes.h>
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "spinlock.h"
+#include "esp_spinlock_stats.h"
+
+// Tracked locks; linear-probed hash table keyed by lock address
+#define SPINLOCK_STATS_ENTRIES 32
+
+typedef struct {
+    volatile uint32_t lock_addr;    // address of the spinlock, 0 if the slot is free
+    void *last_caller;              // return address of the most recent contended acquire
+    uint32_t count;                 // contended acquisitions
+    uint64_t total_cycles;          // cycles spent spinning, summed
+    uint32_t max_cycles;            // longest single spin
+} spinlock_stats_entry_t;
+
+/*
+ * The table is updated from both cores with interrupts masked, so it cannot
+ * be protected by a lock of its own. Slots are claimed atomically by their
+ * key; the counters themselves are updated without synchronization, which can
+ * lose an occasional increment under a cross-core race. For profiling
+ * purposes the resulting error is negligible.
+ */
+static spinlock_stats_entry_t s_stats[SPINLOCK_STATS_ENTRIES];
+static uint32_t s_untracked;    // contended acquires dropped because the table was full
+
+void IRAM_ATTR spinlock_profile_record(spinlock_t *lock, void *caller, uint32_t spin_cycles)
+{
+    uint32_t lock_addr = (uint32_t)lock;
+    uint32_t slot = (lock_addr >> 2) % SPINLOCK_STATS_ENTRIES;
+
+    for (int probe = 0; probe < SPINLOCK_STATS_ENTRIES; probe++) {
+        spinlock_stats_entry_t *entry = &s_stats[slot];
+        if (entry->lock_addr == 0) {
+            // Free slot: try to claim it; on a lost race fall through and
+            // re-examine the slot, the winner may have claimed it for us
+            esp_cpu_compare_and_set(&entry->lock_addr, 0, lock_addr);
+        }
+        if (entry->lock_addr == lock_addr) {
+            entry->last_caller = caller;
+            entry->count++;
+            entry->total_cycles += spin_cycles;
+            if (spin_cycles > entry->max_cycles) {
+                entry->max_cycles = spin_cycles;
+            }
+            return;
+        }
+        slot = (slot + 1) % SPINLOCK_STATS_ENTRIES;
+    }
+    s_untracked++;
+}
+
+esp_err_t esp_spinlock_dump_contention(FILE *stream)
+{
+    if (stream == NULL) {
+        stream = stdout;
+    }
+    uint32_t ticks_per_us = esp_rom_get_cpu_ticks_per_us();
+
+    fprintf(stream, "Spinlock contention:\n");
+    fprintf(stream, " Lock        Last caller   Count  Total(us)    Avg(us)    Max(us)\n");
+    for (int i = 0; i < SPINLOCK_STATS_ENTRIES; i++) {
+        const spinlock_stats_entry_t *entry = &s_stats[i];
+        if (entry->lock_addr == 0 || entry->count == 0) {
+            continue;
+        }
+        fprintf(stream, " 0x%08" PRIx32 "  %p  %6" PRIu32 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32 "\n",
+                entry->lock_addr, entry->last_caller, entry->count,
+                (uint32_t)(entry->total_cycles / ticks_per_us),
+                (uint32_t)(entry->total_cycles / entry->count / ticks_per_us),
+                entry->max_cycles / ticks_per_us);
+    }
+    if (s_untracked != 0) {
+        fprintf(stream, " %" PRIu32 " contended acquisitions not tracked (table full)\n", s_untracked);
+    }
+    return ESP_OK;
+}
+
+void esp_spinlock_reset_contention(void)
+{
+    // Keep the claimed keys so no slot-claim race with a concurrent
+    // spinlock_profile_record() is possible; only the counters are cleared
+    for (int i = 0; i < SPINLOCK_STATS_ENTRIES; i++) {
+        s_stats[i].count = 0;
+        s_stats[i].total_cycles = 0;
+        s_stats[i].max_cycles = 0;
+    }
+    s_untracked = 0;
+}
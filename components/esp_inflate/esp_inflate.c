@@ -0,0 +1,252 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_crc.h"
+#include "miniz.h"
+#include "esp_inflate.h"
+
+static const char *TAG = "esp_inflate";
+
+#define ESP_INFLATE_DEFAULT_IN_CHUNK    4096
+
+// gzip (RFC 1952) member header flags
+#define GZIP_FLG_FHCRC      0x02
+#define GZIP_FLG_FEXTRA     0x04
+#define GZIP_FLG_FNAME      0x08
+#define GZIP_FLG_FCOMMENT   0x10
+
+typedef struct {
+    const esp_inflate_config_t *cfg;
+    uint8_t *in_buf;
+    size_t in_cap;
+    size_t in_len;      // valid bytes in in_buf
+    size_t in_pos;      // consumed bytes in in_buf
+    bool in_eof;
+} inflate_ctx_t;
+
+// Refill the input buffer when it has been fully consumed. Returns ESP_FAIL on a read_cb error.
+static esp_err_t s_refill(inflate_ctx_t *ctx)
+{
+    if (ctx->in_pos < ctx->in_len || ctx->in_eof) {
+        return ESP_OK;
+    }
+    int got = ctx->cfg->read_cb(ctx->cfg->read_arg, ctx->in_buf, ctx->in_cap);
+    if (got < 0) {
+        ESP_LOGE(TAG, "input callback failed (%d)", got);
+        return ESP_FAIL;
+    }
+    ctx->in_len = got;
+    ctx->in_pos = 0;
+    ctx->in_eof = (got == 0);
+    return ESP_OK;
+}
+
+static esp_err_t s_read_byte(inflate_ctx_t *ctx, uint8_t *out_byte)
+{
+    esp_err_t ret = s_refill(ctx);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (ctx->in_eof) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    *out_byte = ctx->in_buf[ctx->in_pos++];
+    return ESP_OK;
+}
+
+static esp_err_t s_skip(inflate_ctx_t *ctx, size_t len)
+{
+    uint8_t byte;
+    while (len--) {
+        esp_err_t ret = s_read_byte(ctx, &byte);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    return ESP_OK;
+}
+
+// Parse the gzip member header up to the start of the deflate data
+static esp_err_t s_parse_gzip_header(inflate_ctx_t *ctx)
+{
+    uint8_t fixed[10];
+    for (size_t i = 0; i < sizeof(fixed); i++) {
+        esp_err_t ret = s_read_byte(ctx, &fixed[i]);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    if (fixed[0] != 0x1f || fixed[1] != 0x8b) {
+        ESP_LOGE(TAG, "bad gzip magic 0x%02x%02x", fixed[0], fixed[1]);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (fixed[2] != 8) {    // CM: only deflate exists in practice
+        ESP_LOGE(TAG, "unsupported gzip compression method %d", fixed[2]);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    uint8_t flg = fixed[3];
+
+    esp_err_t ret = ESP_OK;
+    if (flg & GZIP_FLG_FEXTRA) {
+        uint8_t lo = 0, hi = 0;
+        if ((ret = s_read_byte(ctx, &lo)) != ESP_OK || (ret = s_read_byte(ctx, &hi)) != ESP_OK) {
+            return ret;
+        }
+        if ((ret = s_skip(ctx, (size_t)lo | ((size_t)hi << 8))) != ESP_OK) {
+            return ret;
+        }
+    }
+    for (int field = 0; field < 2; field++) {
+        uint8_t want = (field == 0) ? GZIP_FLG_FNAME : GZIP_FLG_FCOMMENT;
+        if (flg & want) {
+            uint8_t byte;
+            do {
+                if ((ret = s_read_byte(ctx, &byte)) != ESP_OK) {
+                    return ret;
+                }
+            } while (byte != 0);
+        }
+    }
+    if (flg & GZIP_FLG_FHCRC) {
+        ret = s_skip(ctx, 2);
+    }
+    return ret;
+}
+
+// Read the 8-byte gzip trailer (CRC-32 + ISIZE, both little endian)
+static esp_err_t s_read_gzip_trailer(inflate_ctx_t *ctx, uint32_t *out_crc, uint32_t *out_isize)
+{
+    uint8_t trailer[8];
+    for (size_t i = 0; i < sizeof(trailer); i++) {
+        esp_err_t ret = s_read_byte(ctx, &trailer[i]);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    *out_crc = (uint32_t)trailer[0] | ((uint32_t)trailer[1] << 8) | ((uint32_t)trailer[2] << 16) | ((uint32_t)trailer[3] << 24);
+    *out_isize = (uint32_t)trailer[4] | ((uint32_t)trailer[5] << 8) | ((uint32_t)trailer[6] << 16) | ((uint32_t)trailer[7] << 24);
+    return ESP_OK;
+}
+
+esp_err_t esp_inflate_run(const esp_inflate_config_t *config, size_t *out_written)
+{
+    if (config == NULL || config->read_cb == NULL || config->write_cb == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_OK;
+    inflate_ctx_t ctx = {
+        .cfg = config,
+        .in_cap = config->in_chunk_size ? config->in_chunk_size : ESP_INFLATE_DEFAULT_IN_CHUNK,
+    };
+
+    tinfl_decompressor *decomp = malloc(sizeof(tinfl_decompressor));
+    ctx.in_buf = malloc(ctx.in_cap);
+    // The LZ window only sees sequential byte accesses, so PSRAM latency barely shows; prefer it
+    // there when the caller asks, with internal RAM as the fallback
+    uint8_t *dict = config->window_in_psram
+                    ? heap_caps_malloc_prefer(TINFL_LZ_DICT_SIZE, 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, MALLOC_CAP_8BIT)
+                    : malloc(TINFL_LZ_DICT_SIZE);
+    if (decomp == NULL || ctx.in_buf == NULL || dict == NULL) {
+        ret = ESP_ERR_NO_MEM;
+        goto out;
+    }
+
+    if (config->format == ESP_INFLATE_FORMAT_GZIP) {
+        ret = s_parse_gzip_header(&ctx);
+        if (ret != ESP_OK) {
+            goto out;
+        }
+    }
+
+    mz_uint32 base_flags = 0;
+    if (config->format == ESP_INFLATE_FORMAT_ZLIB) {
+        base_flags |= TINFL_FLAG_PARSE_ZLIB_HEADER;
+        if (config->verify_checksum) {
+            base_flags |= TINFL_FLAG_COMPUTE_ADLER32;
+        }
+    }
+
+    tinfl_init(decomp);
+    size_t dict_ofs = 0;
+    size_t total_out = 0;
+    uint32_t crc = 0;
+    tinfl_status status;
+
+    do {
+        ret = s_refill(&ctx);
+        if (ret != ESP_OK) {
+            goto out;
+        }
+        size_t in_bytes = ctx.in_len - ctx.in_pos;
+        size_t out_bytes = TINFL_LZ_DICT_SIZE - dict_ofs;
+        status = tinfl_decompress(decomp, ctx.in_buf + ctx.in_pos, &in_bytes,
+                                  dict, dict + dict_ofs, &out_bytes,
+                                  base_flags | (ctx.in_eof ? 0 : TINFL_FLAG_HAS_MORE_INPUT));
+        ctx.in_pos += in_bytes;
+
+        if (out_bytes != 0) {
+            int written = config->write_cb(config->write_arg, dict + dict_ofs, out_bytes);
+            if (written < 0 || (size_t)written != out_bytes) {
+                ESP_LOGE(TAG, "output callback failed (%d)", written);
+                ret = ESP_FAIL;
+                goto out;
+            }
+            if (config->format == ESP_INFLATE_FORMAT_GZIP && config->verify_checksum) {
+                crc = esp_crc32_le(crc, dict + dict_ofs, out_bytes);
+            }
+            total_out += out_bytes;
+            dict_ofs = (dict_ofs + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
+        }
+
+        if (status == TINFL_STATUS_NEEDS_MORE_INPUT && ctx.in_eof && ctx.in_pos == ctx.in_len) {
+            ESP_LOGE(TAG, "input ended mid-stream after %u bytes out", (unsigned)total_out);
+            ret = ESP_ERR_INVALID_SIZE;
+            goto out;
+        }
+        if (status == TINFL_STATUS_ADLER32_MISMATCH) {
+            ret = ESP_ERR_INVALID_CRC;
+            goto out;
+        }
+        if (status < TINFL_STATUS_DONE) {
+            ESP_LOGE(TAG, "corrupt deflate stream (status %d)", status);
+            ret = ESP_FAIL;
+            goto out;
+        }
+    } while (status != TINFL_STATUS_DONE);
+
+    if (config->format == ESP_INFLATE_FORMAT_GZIP) {
+        uint32_t want_crc = 0;
+        uint32_t want_isize = 0;
+        ret = s_read_gzip_trailer(&ctx, &want_crc, &want_isize);
+        if (ret != ESP_OK) {
+            goto out;
+        }
+        if (config->verify_checksum &&
+                (want_crc != crc || want_isize != (uint32_t)total_out)) {
+            ESP_LOGE(TAG, "gzip checksum mismatch: crc 0x%08x vs 0x%08x, isize %u vs %u",
+                     (unsigned)want_crc, (unsigned)crc, (unsigned)want_isize, (unsigned)total_out);
+            ret = ESP_ERR_INVALID_CRC;
+            goto out;
+        }
+    }
+
+    if (out_written != NULL) {
+        *out_written = total_out;
+    }
+
+out:
+    free(dict);
+    free(ctx.in_buf);
+    free(decomp);
+    return ret;
+}
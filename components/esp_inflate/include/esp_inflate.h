@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Compressed stream framing understood by the inflater
+ */
+typedef enum {
+    ESP_INFLATE_FORMAT_GZIP,    /*!< RFC 1952 gzip stream, CRC-32 + size trailer can be verified */
+    ESP_INFLATE_FORMAT_ZLIB,    /*!< RFC 1950 zlib stream, adler-32 verified by the decompressor */
+    ESP_INFLATE_FORMAT_RAW,     /*!< Raw RFC 1951 deflate stream, no framing, no checksum */
+} esp_inflate_format_t;
+
+/**
+ * @brief Input callback: refill `buf` with up to `len` bytes of compressed data
+ *
+ * @return Number of bytes placed in `buf`, 0 on end of stream, or a negative value on error
+ *         (aborts the inflate with ESP_FAIL)
+ */
+typedef int (*esp_inflate_read_cb_t)(void *arg, void *buf, size_t len);
+
+/**
+ * @brief Output callback: consume `len` bytes of decompressed data
+ *
+ * Decompressed data is handed out in stream order, so the callback can feed e.g. `esp_ota_write()`
+ * directly. Returning a negative value aborts the inflate with ESP_FAIL.
+ *
+ * @return `len` on success, or a negative value on error
+ */
+typedef int (*esp_inflate_write_cb_t)(void *arg, const void *buf, size_t len);
+
+/**
+ * @brief Streaming inflate configuration
+ */
+typedef struct {
+    esp_inflate_format_t format;    /*!< Framing of the compressed input stream */
+    esp_inflate_read_cb_t read_cb;  /*!< Compressed data source, mandatory */
+    void *read_arg;                 /*!< Passed to read_cb */
+    esp_inflate_write_cb_t write_cb; /*!< Decompressed data sink, mandatory */
+    void *write_arg;                /*!< Passed to write_cb */
+    size_t in_chunk_size;           /*!< Size of the internal compressed-input buffer, i.e. the largest
+                                         read_cb request. 0 for the default (4096 bytes) */
+    bool window_in_psram;           /*!< Prefer external RAM for the 32KB LZ window (falls back to
+                                         internal RAM when PSRAM is absent or full) */
+    bool verify_checksum;           /*!< Verify the stream checksum: the CRC-32 trailer for gzip
+                                         (computed through esp_crc32_le), the adler-32 for zlib.
+                                         Ignored for raw deflate streams */
+} esp_inflate_config_t;
+
+/**
+ * @brief Decompress a complete deflate/zlib/gzip stream through callbacks
+ *
+ * Pulls compressed data from `read_cb` in `in_chunk_size` pieces and pushes decompressed data to
+ * `write_cb`, using the inflate code in ROM (miniz). Peak memory use is the decompressor state
+ * (~11KB), the input buffer and the 32KB LZ window, which can live in PSRAM — no decompressed-size
+ * buffer is ever allocated, so multi-megabyte OTA images can be inflated straight into
+ * `esp_ota_write()`.
+ *
+ * @param config           Stream configuration
+ * @param[out] out_written Total number of decompressed bytes produced, can be NULL
+ *
+ * @return
+ *        - ESP_OK:                  Stream fully decompressed (and checksum verified, if requested)
+ *        - ESP_ERR_INVALID_ARG:     Null config or missing callback
+ *        - ESP_ERR_NO_MEM:          Buffer allocation failed
+ *        - ESP_ERR_NOT_SUPPORTED:   Input is not a supported stream (bad magic / compression method)
+ *        - ESP_ERR_INVALID_SIZE:    Input ended before the stream was complete
+ *        - ESP_ERR_INVALID_CRC:     Decompressed data does not match the stream checksum
+ *        - ESP_FAIL:                Corrupt deflate data, or a callback reported an error
+ */
+esp_err_t esp_inflate_run(const esp_inflate_config_t *config, size_t *out_written);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "driver/ppa.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Type of LCD compositor handle
+ */
+typedef struct esp_lcd_compositor_t *esp_lcd_compositor_handle_t;
+
+/**
+ * @brief LCD compositor configuration
+ */
+typedef struct {
+    void *frame_buffer;        /*!< Target frame buffer that the layers are composed into,
+                                    e.g. obtained from `esp_lcd_rgb_panel_get_frame_buffer`.
+                                    Must meet the PPA output buffer alignment requirements */
+    uint32_t frame_buffer_size; /*!< Size of the target frame buffer, in bytes */
+    uint32_t h_res;            /*!< Horizontal resolution of the target frame buffer, in pixels */
+    uint32_t v_res;            /*!< Vertical resolution of the target frame buffer, in pixels */
+    ppa_blend_color_mode_t color_mode; /*!< Color mode of the target frame buffer */
+    uint32_t max_pending_trans_num;    /*!< Maximum number of composition operations that can be queued on the
+                                            hardware at the same time, defaults to 4 */
+    struct {
+        uint32_t scratch_in_psram: 1;  /*!< Allocate the internal scratch buffer (used to hold the intermediate
+                                            result of scale/rotate stages) from PSRAM instead of internal memory */
+    } flags;                   /*!< Extra compositor flags */
+} esp_lcd_compositor_config_t;
+
+/**
+ * @brief Description of one layer to be composed into the frame buffer
+ *
+ * @note Supported layer color modes are ARGB8888, RGB888 and RGB565 (set via `in.srm_cm` or
+ *       `in.blend_cm`, the two fields share the same storage and encoding for these modes).
+ */
+typedef struct {
+    ppa_in_pic_blk_config_t in;     /*!< Input picture of the layer and the source block inside it */
+    uint32_t dest_x;                /*!< X offset in the frame buffer where the (transformed) block lands, in pixels */
+    uint32_t dest_y;                /*!< Y offset in the frame buffer where the (transformed) block lands, in pixels */
+    ppa_srm_rotation_angle_t rotation_angle; /*!< Rotation (counter-clockwise) applied to the block */
+    float scale_x;                  /*!< Scaling factor in the x direction, 0 means 1.0 (no scaling) */
+    float scale_y;                  /*!< Scaling factor in the y direction, 0 means 1.0 (no scaling) */
+    bool mirror_x;                  /*!< Whether to mirror the block in the x direction */
+    bool mirror_y;                  /*!< Whether to mirror the block in the y direction */
+    ppa_alpha_update_mode_t alpha_update_mode; /*!< Select whether the alpha channel of the layer needs update */
+    union {
+        uint32_t alpha_fix_val;     /*!< New alpha value when `PPA_ALPHA_FIX_VALUE` mode is selected, range [0, 255] */
+        float alpha_scale_ratio;    /*!< Multiplier to the alpha value when `PPA_ALPHA_SCALE` mode is selected, range (0, 1) */
+    };
+} esp_lcd_compose_layer_t;
+
+/**
+ * @brief Create an LCD compositor backed by the PPA hardware
+ *
+ * The compositor offloads the blend/scale/rotate work of multi-layer UI composition from the CPU to
+ * the Pixel Processing Accelerator. Layers that need a geometric transform first pass through the PPA
+ * SRM engine into an internal scratch buffer and are then alpha-blended into the frame buffer; layers
+ * that land 1:1 are blended directly. Cache coherence between the CPU, the PPA and the LCD DMA is
+ * handled by the PPA driver.
+ *
+ * @param[in] config Compositor configuration
+ * @param[out] ret_compositor Returned compositor handle
+ * @return
+ *      - ESP_ERR_INVALID_ARG: Create compositor failed because of invalid argument
+ *      - ESP_ERR_NO_MEM: Create compositor failed because out of memory
+ *      - ESP_OK: Create compositor successfully
+ */
+esp_err_t esp_lcd_new_compositor(const esp_lcd_compositor_config_t *config, esp_lcd_compositor_handle_t *ret_compositor);
+
+/**
+ * @brief Delete an LCD compositor and free its resources
+ *
+ * @param[in] compositor Compositor handle, returned from `esp_lcd_new_compositor`
+ * @return
+ *      - ESP_ERR_INVALID_ARG: Delete compositor failed because of invalid argument
+ *      - ESP_ERR_INVALID_STATE: Delete compositor failed because there are unfinished composition operations
+ *      - ESP_OK: Delete compositor successfully
+ */
+esp_err_t esp_lcd_del_compositor(esp_lcd_compositor_handle_t compositor);
+
+/**
+ * @brief Compose a list of layers into the frame buffer, bottom-most layer first
+ *
+ * Layers without a geometric transform are queued on the blend engine without blocking; layers that
+ * need the SRM stage block until their scratch result has been blended, because the next layer reuses
+ * the scratch buffer. Call `esp_lcd_compositor_wait_all_done` before reading or re-rendering the
+ * frame buffer.
+ *
+ * @param[in] compositor Compositor handle, returned from `esp_lcd_new_compositor`
+ * @param[in] layers Array of layer descriptions
+ * @param[in] num_layers Number of layers in the array
+ * @return
+ *      - ESP_ERR_INVALID_ARG: Compose layers failed because of invalid argument (e.g. a layer exceeds the frame buffer boundary)
+ *      - ESP_OK: Compose layers queued successfully
+ */
+esp_err_t esp_lcd_compositor_draw_layers(esp_lcd_compositor_handle_t compositor, const esp_lcd_compose_layer_t *layers, size_t num_layers);
+
+/**
+ * @brief Wait until all queued composition operations have finished
+ *
+ * @param[in] compositor Compositor handle, returned from `esp_lcd_new_compositor`
+ * @param[in] timeout_ms Timeout of the wait, in milliseconds. Set to `-1` to wait forever
+ * @return
+ *      - ESP_ERR_INVALID_ARG: Wait failed because of invalid argument
+ *      - ESP_ERR_TIMEOUT: Wait failed because of timeout
+ *      - ESP_OK: All composition operations finished
+ */
+esp_err_t esp_lcd_compositor_wait_all_done(esp_lcd_compositor_handle_t compositor, int timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif
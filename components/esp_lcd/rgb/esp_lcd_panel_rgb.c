@@ -135,6 +135,11 @@ struct esp_rgb_panel_t {
     portMUX_TYPE spinlock;          // to protect panel specific resource from concurrent access (e.g. between task and ISR)
     int lcd_clk_flags;              // LCD clock calculation flags
     int rotate_mask;                // panel rotate_mask mask, Or'ed of `panel_rotate_mask_t`
+    int dirty_x_start;              // left edge of the coalesced dirty region (inclusive)
+    int dirty_y_start;              // top edge of the coalesced dirty region (inclusive)
+    int dirty_x_end;                // right edge of the coalesced dirty region (exclusive)
+    int dirty_y_end;                // bottom edge of the coalesced dirty region (exclusive)
+    TaskHandle_t vsync_waiter;      // task blocked in `esp_lcd_rgb_panel_wait_vsync`, woken up from the VSYNC ISR
     struct {
         uint32_t disp_en_level: 1;       // The level which can turn on the screen by `disp_gpio_num`
         uint32_t stream_mode: 1;         // If set, the LCD transfers data continuously, otherwise, it stops refreshing the LCD when transaction done
@@ -143,6 +148,7 @@ struct esp_rgb_panel_t {
         uint32_t need_restart: 1;        // Whether to restart the LCD controller and the DMA
         uint32_t fb_behind_cache: 1;     // Whether the frame buffer is behind the cache
         uint32_t bb_behind_cache: 1;     // Whether the bounce buffer is behind the cache
+        uint32_t has_dirty: 1;           // Whether a dirty region has been accumulated via `esp_lcd_rgb_panel_mark_dirty`
     } flags;
 };
 
@@ -469,6 +475,93 @@ esp_err_t esp_lcd_rgb_panel_refresh(esp_lcd_panel_handle_t panel)
     return ESP_OK;
 }
 
+esp_err_t esp_lcd_rgb_panel_mark_dirty(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end)
+{
+    ESP_RETURN_ON_FALSE_ISR(panel && (x_start < x_end) && (y_start < y_end), ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    esp_rgb_panel_t *rgb_panel = __containerof(panel, esp_rgb_panel_t, base);
+    portENTER_CRITICAL_SAFE(&rgb_panel->spinlock);
+    if (rgb_panel->flags.has_dirty) {
+        // coalesce with the already accumulated region into one bounding box
+        rgb_panel->dirty_x_start = MIN(rgb_panel->dirty_x_start, x_start);
+        rgb_panel->dirty_y_start = MIN(rgb_panel->dirty_y_start, y_start);
+        rgb_panel->dirty_x_end = MAX(rgb_panel->dirty_x_end, x_end);
+        rgb_panel->dirty_y_end = MAX(rgb_panel->dirty_y_end, y_end);
+    } else {
+        rgb_panel->dirty_x_start = x_start;
+        rgb_panel->dirty_y_start = y_start;
+        rgb_panel->dirty_x_end = x_end;
+        rgb_panel->dirty_y_end = y_end;
+        rgb_panel->flags.has_dirty = 1;
+    }
+    portEXIT_CRITICAL_SAFE(&rgb_panel->spinlock);
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_rgb_panel_flush_dirty(esp_lcd_panel_handle_t panel)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    esp_rgb_panel_t *rgb_panel = __containerof(panel, esp_rgb_panel_t, base);
+    ESP_RETURN_ON_FALSE(rgb_panel->num_fbs > 0, ESP_ERR_NOT_SUPPORTED, TAG, "no frame buffer installed");
+
+    portENTER_CRITICAL(&rgb_panel->spinlock);
+    bool has_dirty = rgb_panel->flags.has_dirty;
+    int y_start = rgb_panel->dirty_y_start;
+    int y_end = rgb_panel->dirty_y_end;
+    rgb_panel->flags.has_dirty = 0;
+    portEXIT_CRITICAL(&rgb_panel->spinlock);
+    if (!has_dirty) {
+        return ESP_OK;
+    }
+    y_start = MAX(y_start, 0);
+    y_end = MIN(y_end, (int)rgb_panel->timings.v_res);
+    if (y_start >= y_end) {
+        return ESP_OK;
+    }
+
+    // the cache is synchronized at whole-line granularity: neighboring pixels of a dirty line
+    // share cache lines with the dirty columns anyway, while the unchanged lines are skipped,
+    // which is where the memory bandwidth saving comes from
+    if (!rgb_panel->bb_size && rgb_panel->flags.fb_behind_cache) {
+        int bytes_per_pixel = rgb_panel->fb_bits_per_pixel / 8;
+        uint32_t bytes_per_line = bytes_per_pixel * rgb_panel->timings.h_res;
+        uint8_t *sync_start = rgb_panel->fbs[rgb_panel->cur_fb_index] + y_start * bytes_per_line;
+        esp_cache_msync(sync_start, (y_end - y_start) * bytes_per_line, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+    }
+    // in bounce buffer mode, the bounce buffer is filled from the frame buffer through the cache,
+    // so the new content is picked up automatically on the next frame
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_rgb_panel_wait_vsync(esp_lcd_panel_handle_t panel, int timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    esp_rgb_panel_t *rgb_panel = __containerof(panel, esp_rgb_panel_t, base);
+    ESP_RETURN_ON_FALSE(rgb_panel->flags.stream_mode, ESP_ERR_INVALID_STATE, TAG, "not in stream mode");
+
+    portENTER_CRITICAL(&rgb_panel->spinlock);
+    if (rgb_panel->vsync_waiter != NULL) {
+        portEXIT_CRITICAL(&rgb_panel->spinlock);
+        ESP_RETURN_ON_FALSE(false, ESP_ERR_INVALID_STATE, TAG, "another task is already waiting for VSYNC");
+    }
+    rgb_panel->vsync_waiter = xTaskGetCurrentTaskHandle();
+    portEXIT_CRITICAL(&rgb_panel->spinlock);
+
+    TickType_t ticks_to_wait = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    if (ulTaskNotifyTake(pdTRUE, ticks_to_wait) == 0) {
+        // timed out, withdraw the waiter so the ISR doesn't notify a task that's no longer waiting
+        portENTER_CRITICAL(&rgb_panel->spinlock);
+        bool consumed_by_isr = (rgb_panel->vsync_waiter == NULL);
+        rgb_panel->vsync_waiter = NULL;
+        portEXIT_CRITICAL(&rgb_panel->spinlock);
+        if (!consumed_by_isr) {
+            return ESP_ERR_TIMEOUT;
+        }
+        // the VSYNC arrived between the timeout and the withdrawal, drain the pending notification
+        ulTaskNotifyTake(pdTRUE, 0);
+    }
+    return ESP_OK;
+}
+
 esp_err_t esp_lcd_rgb_panel_set_yuv_conversion(esp_lcd_panel_handle_t panel, const esp_lcd_yuv_conv_config_t *config)
 {
     ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
@@ -636,6 +729,12 @@ static esp_err_t rgb_panel_draw_bitmap(esp_lcd_panel_t *panel, int x_start, int
         uint8_t *fb = rgb_panel->fbs[rgb_panel->cur_fb_index];
         size_t bytes_to_flush = v_res * bytes_per_line;
         uint8_t *flush_ptr = fb;
+        if (rgb_panel->rotate_mask == 0) {
+            // without software rotation, the copy below only touches the lines inside the flush
+            // window, so the cache writeback can be restricted to those lines as well
+            bytes_to_flush = (y_end - y_start) * bytes_per_line;
+            flush_ptr = fb + y_start * bytes_per_line;
+        }
 
         const uint8_t *from = (const uint8_t *)color_data;
         uint32_t copy_bytes_per_line = (x_end - x_start) * bytes_per_pixel;
@@ -1139,6 +1238,17 @@ IRAM_ATTR static void rgb_lcd_default_isr_handler(void *args)
             }
         }
 
+        // wake up the task blocked in `esp_lcd_rgb_panel_wait_vsync`, if any
+        TaskHandle_t vsync_waiter = rgb_panel->vsync_waiter;
+        if (vsync_waiter) {
+            rgb_panel->vsync_waiter = NULL;
+            BaseType_t high_task_woken = pdFALSE;
+            vTaskNotifyGiveFromISR(vsync_waiter, &high_task_woken);
+            if (high_task_woken == pdTRUE) {
+                need_yield = true;
+            }
+        }
+
         // check whether to update the PCLK frequency, it should be safe to update the PCLK frequency in the VSYNC interrupt
         lcd_rgb_panel_try_update_pclk(rgb_panel);
 
@@ -261,6 +261,62 @@ esp_err_t esp_lcd_rgb_panel_get_frame_buffer(esp_lcd_panel_handle_t panel, uint3
  */
 esp_err_t esp_lcd_rgb_panel_refresh(esp_lcd_panel_handle_t panel);
 
+/**
+ * @brief Accumulate a dirty rectangle on the RGB panel
+ *
+ * @note This function is intended for applications that render directly into a frame buffer
+ *       obtained from `esp_lcd_rgb_panel_get_frame_buffer`. Instead of calling `esp_lcd_panel_draw_bitmap`
+ *       once per updated widget, the application can mark each updated region as dirty and later
+ *       call `esp_lcd_rgb_panel_flush_dirty` once per frame. The driver coalesces the rectangles
+ *       into one bounding box internally.
+ * @note This function can be called from an ISR context.
+ *
+ * @param[in] panel LCD panel handle, returned from `esp_lcd_new_rgb_panel`
+ * @param[in] x_start Start index on x-axis (x_start included)
+ * @param[in] y_start Start index on y-axis (y_start included)
+ * @param[in] x_end End index on x-axis (x_end not included)
+ * @param[in] y_end End index on y-axis (y_end not included)
+ * @return
+ *      - ESP_ERR_INVALID_ARG: Mark dirty rectangle failed because of invalid argument
+ *      - ESP_OK: Mark dirty rectangle successfully
+ */
+esp_err_t esp_lcd_rgb_panel_mark_dirty(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end);
+
+/**
+ * @brief Flush the accumulated dirty region to the LCD panel
+ *
+ * @note Only the lines covered by the coalesced dirty rectangles are synchronized from the cache to
+ *       the physical frame buffer memory, which cuts the memory bandwidth spent per frame by the
+ *       unchanged fraction of the screen. The dirty region is cleared on return.
+ * @note Calling this function with no accumulated dirty region is a no-op and returns `ESP_OK`.
+ *
+ * @param[in] panel LCD panel handle, returned from `esp_lcd_new_rgb_panel`
+ * @return
+ *      - ESP_ERR_INVALID_ARG: Flush dirty region failed because of invalid argument
+ *      - ESP_ERR_NOT_SUPPORTED: Flush dirty region failed because no frame buffer is installed
+ *      - ESP_OK: Flush dirty region successfully
+ */
+esp_err_t esp_lcd_rgb_panel_flush_dirty(esp_lcd_panel_handle_t panel);
+
+/**
+ * @brief Block until the next VSYNC event of the RGB panel
+ *
+ * @note This function provides a simple frame pacing mechanism: render and flush the dirty region,
+ *       then wait for the next VSYNC before starting the next frame, so the frame buffer is never
+ *       updated in the middle of a scan-out (which shows up as tearing). For a callback-based
+ *       alternative, register the `on_vsync` event callback instead.
+ * @note Only one task can wait for the VSYNC event at the same time.
+ *
+ * @param[in] panel LCD panel handle, returned from `esp_lcd_new_rgb_panel`
+ * @param[in] timeout_ms Timeout of the wait, in milliseconds. Set to `-1` to wait forever
+ * @return
+ *      - ESP_ERR_INVALID_ARG: Wait for VSYNC failed because of invalid argument
+ *      - ESP_ERR_INVALID_STATE: Wait for VSYNC failed because another task is already waiting, or the panel is not in stream mode
+ *      - ESP_ERR_TIMEOUT: Wait for VSYNC failed because of timeout
+ *      - ESP_OK: VSYNC event arrived successfully
+ */
+esp_err_t esp_lcd_rgb_panel_wait_vsync(esp_lcd_panel_handle_t panel, int timeout_ms);
+
 /**
  * @brief LCD color conversion profile
  */
@@ -0,0 +1,248 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_lcd_compose.h"
+#include "hal/color_hal.h"
+#include "hal/cache_hal.h"
+#include "hal/cache_ll.h"
+
+#define ALIGN_UP(num, align)    (((num) + ((align) - 1)) & ~((align) - 1))
+
+static const char *TAG = "lcd_compose";
+
+struct esp_lcd_compositor_t {
+    ppa_client_handle_t srm_client;     // PPA client for the scale-rotate-mirror stage
+    ppa_client_handle_t blend_client;   // PPA client for the blend stage
+    void *frame_buffer;                 // target frame buffer
+    uint32_t frame_buffer_size;         // size of the target frame buffer, in bytes
+    uint32_t h_res;                     // horizontal resolution of the target frame buffer
+    uint32_t v_res;                     // vertical resolution of the target frame buffer
+    ppa_blend_color_mode_t color_mode;  // color mode of the target frame buffer
+    uint8_t *scratch;                   // scratch buffer holding the intermediate result of the SRM stage
+    uint32_t scratch_size;              // size of the scratch buffer, in bytes
+    SemaphoreHandle_t done_sem;         // given from the blend done callback, taken in wait_all_done
+    portMUX_TYPE spinlock;              // protects pending_trans against the PPA done callback
+    size_t pending_trans;               // number of blend operations queued but not yet finished
+};
+
+static bool compositor_on_blend_done(ppa_client_handle_t ppa_client, ppa_event_data_t *event_data, void *user_data)
+{
+    esp_lcd_compositor_handle_t compositor = (esp_lcd_compositor_handle_t)user_data;
+    BaseType_t high_task_woken = pdFALSE;
+    portENTER_CRITICAL_ISR(&compositor->spinlock);
+    compositor->pending_trans--;
+    portEXIT_CRITICAL_ISR(&compositor->spinlock);
+    xSemaphoreGiveFromISR(compositor->done_sem, &high_task_woken);
+    return high_task_woken == pdTRUE;
+}
+
+esp_err_t esp_lcd_new_compositor(const esp_lcd_compositor_config_t *config, esp_lcd_compositor_handle_t *ret_compositor)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(config && ret_compositor, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(config->frame_buffer && config->h_res && config->v_res, ESP_ERR_INVALID_ARG, TAG, "invalid frame buffer description");
+    color_space_pixel_format_t pixel_format = {
+        .color_type_id = config->color_mode,
+    };
+    uint32_t bytes_per_pixel = color_hal_pixel_format_get_bit_depth(pixel_format) / 8;
+    ESP_RETURN_ON_FALSE(config->frame_buffer_size >= config->h_res * config->v_res * bytes_per_pixel,
+                        ESP_ERR_INVALID_ARG, TAG, "frame buffer size mismatch with resolution");
+
+    esp_lcd_compositor_handle_t compositor = heap_caps_calloc(1, sizeof(struct esp_lcd_compositor_t), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(compositor, ESP_ERR_NO_MEM, TAG, "no mem for compositor");
+    compositor->frame_buffer = config->frame_buffer;
+    compositor->frame_buffer_size = config->frame_buffer_size;
+    compositor->h_res = config->h_res;
+    compositor->v_res = config->v_res;
+    compositor->color_mode = config->color_mode;
+    compositor->spinlock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+
+    // the scratch buffer must satisfy the PPA output buffer alignment, which is the data cache line size
+    uint32_t int_mem_cache_line_size = cache_hal_get_cache_line_size(CACHE_LL_LEVEL_INT_MEM, CACHE_TYPE_DATA);
+    uint32_t ext_mem_cache_line_size = cache_hal_get_cache_line_size(CACHE_LL_LEVEL_EXT_MEM, CACHE_TYPE_DATA);
+    uint32_t scratch_align = MAX(MAX(int_mem_cache_line_size, ext_mem_cache_line_size), 4);
+    uint32_t scratch_caps = config->flags.scratch_in_psram ? (MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA | MALLOC_CAP_8BIT)
+                            : (MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+    compositor->scratch_size = ALIGN_UP(config->h_res * config->v_res * bytes_per_pixel, scratch_align);
+    compositor->scratch = heap_caps_aligned_calloc(scratch_align, 1, compositor->scratch_size, scratch_caps);
+    ESP_GOTO_ON_FALSE(compositor->scratch, ESP_ERR_NO_MEM, err, TAG, "no mem for scratch buffer");
+
+    compositor->done_sem = xSemaphoreCreateCounting(config->max_pending_trans_num ? config->max_pending_trans_num : 4, 0);
+    ESP_GOTO_ON_FALSE(compositor->done_sem, ESP_ERR_NO_MEM, err, TAG, "no mem for semaphore");
+
+    ppa_client_config_t srm_client_config = {
+        .oper_type = PPA_OPERATION_SRM,
+        .max_pending_trans_num = 1, // the SRM stage always runs in blocking mode
+    };
+    ESP_GOTO_ON_ERROR(ppa_register_client(&srm_client_config, &compositor->srm_client), err, TAG, "register SRM client failed");
+    ppa_client_config_t blend_client_config = {
+        .oper_type = PPA_OPERATION_BLEND,
+        .max_pending_trans_num = config->max_pending_trans_num ? config->max_pending_trans_num : 4,
+    };
+    ESP_GOTO_ON_ERROR(ppa_register_client(&blend_client_config, &compositor->blend_client), err, TAG, "register blend client failed");
+    ppa_event_callbacks_t cbs = {
+        .on_trans_done = compositor_on_blend_done,
+    };
+    ESP_GOTO_ON_ERROR(ppa_client_register_event_callbacks(compositor->blend_client, &cbs), err, TAG, "register blend callback failed");
+
+    *ret_compositor = compositor;
+    return ESP_OK;
+
+err:
+    esp_lcd_del_compositor(compositor);
+    return ret;
+}
+
+esp_err_t esp_lcd_del_compositor(esp_lcd_compositor_handle_t compositor)
+{
+    ESP_RETURN_ON_FALSE(compositor, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(compositor->pending_trans == 0, ESP_ERR_INVALID_STATE, TAG, "composition operations still pending");
+    if (compositor->srm_client) {
+        ESP_RETURN_ON_ERROR(ppa_unregister_client(compositor->srm_client), TAG, "unregister SRM client failed");
+    }
+    if (compositor->blend_client) {
+        ESP_RETURN_ON_ERROR(ppa_unregister_client(compositor->blend_client), TAG, "unregister blend client failed");
+    }
+    if (compositor->done_sem) {
+        vSemaphoreDelete(compositor->done_sem);
+    }
+    free(compositor->scratch);
+    free(compositor);
+    return ESP_OK;
+}
+
+static esp_err_t compositor_draw_one_layer(esp_lcd_compositor_handle_t compositor, const esp_lcd_compose_layer_t *layer)
+{
+    float scale_x = (layer->scale_x == 0) ? 1.0f : layer->scale_x;
+    float scale_y = (layer->scale_y == 0) ? 1.0f : layer->scale_y;
+    bool needs_srm = (scale_x != 1.0f) || (scale_y != 1.0f) || (layer->rotation_angle != PPA_SRM_ROTATION_ANGLE_0) ||
+                     layer->mirror_x || layer->mirror_y;
+
+    // size of the block after the geometric transform
+    uint32_t out_block_w = (uint32_t)(layer->in.block_w * scale_x);
+    uint32_t out_block_h = (uint32_t)(layer->in.block_h * scale_y);
+    if (layer->rotation_angle == PPA_SRM_ROTATION_ANGLE_90 || layer->rotation_angle == PPA_SRM_ROTATION_ANGLE_270) {
+        uint32_t tmp = out_block_w;
+        out_block_w = out_block_h;
+        out_block_h = tmp;
+    }
+    ESP_RETURN_ON_FALSE(out_block_w && out_block_h, ESP_ERR_INVALID_ARG, TAG, "layer scales to zero size");
+    ESP_RETURN_ON_FALSE(layer->dest_x + out_block_w <= compositor->h_res && layer->dest_y + out_block_h <= compositor->v_res,
+                        ESP_ERR_INVALID_ARG, TAG, "layer exceeds the frame buffer boundary");
+
+    ppa_in_pic_blk_config_t blend_fg = layer->in;
+    ppa_alpha_update_mode_t blend_fg_alpha_mode = layer->alpha_update_mode;
+    uint32_t blend_fg_alpha_fix_val = layer->alpha_fix_val;
+    if (needs_srm) {
+        // run the SRM stage into the scratch buffer, converting to the frame buffer color mode on the way;
+        // this stage must block because the scratch result feeds the blend below and the next layer reuses it
+        ppa_srm_oper_config_t srm_config = {
+            .in = layer->in,
+            .out = {
+                .buffer = compositor->scratch,
+                .buffer_size = compositor->scratch_size,
+                .pic_w = out_block_w,
+                .pic_h = out_block_h,
+                .srm_cm = (ppa_srm_color_mode_t)compositor->color_mode,
+            },
+            .rotation_angle = layer->rotation_angle,
+            .scale_x = scale_x,
+            .scale_y = scale_y,
+            .mirror_x = layer->mirror_x,
+            .mirror_y = layer->mirror_y,
+            .alpha_update_mode = layer->alpha_update_mode,
+            .alpha_fix_val = layer->alpha_fix_val,
+            .mode = PPA_TRANS_MODE_BLOCKING,
+        };
+        ESP_RETURN_ON_ERROR(ppa_do_scale_rotate_mirror(compositor->srm_client, &srm_config), TAG, "SRM stage failed");
+        blend_fg = (ppa_in_pic_blk_config_t) {
+            .buffer = compositor->scratch,
+            .pic_w = out_block_w,
+            .pic_h = out_block_h,
+            .block_w = out_block_w,
+            .block_h = out_block_h,
+            .blend_cm = compositor->color_mode,
+        };
+        blend_fg_alpha_mode = PPA_ALPHA_NO_CHANGE; // already applied at the SRM stage
+        blend_fg_alpha_fix_val = 0;
+    }
+
+    ppa_blend_oper_config_t blend_config = {
+        .in_bg = {
+            .buffer = compositor->frame_buffer,
+            .pic_w = compositor->h_res,
+            .pic_h = compositor->v_res,
+            .block_w = out_block_w,
+            .block_h = out_block_h,
+            .block_offset_x = layer->dest_x,
+            .block_offset_y = layer->dest_y,
+            .blend_cm = compositor->color_mode,
+        },
+        .in_fg = blend_fg,
+        .out = {
+            .buffer = compositor->frame_buffer,
+            .buffer_size = compositor->frame_buffer_size,
+            .pic_w = compositor->h_res,
+            .pic_h = compositor->v_res,
+            .block_offset_x = layer->dest_x,
+            .block_offset_y = layer->dest_y,
+            .blend_cm = compositor->color_mode,
+        },
+        .bg_alpha_update_mode = PPA_ALPHA_NO_CHANGE,
+        .fg_alpha_update_mode = blend_fg_alpha_mode,
+        .fg_alpha_fix_val = blend_fg_alpha_fix_val,
+        // a transformed layer must be blended before the next layer overwrites the scratch buffer,
+        // an untransformed layer can stay queued on the blend engine, which keeps the pipeline busy
+        .mode = needs_srm ? PPA_TRANS_MODE_BLOCKING : PPA_TRANS_MODE_NON_BLOCKING,
+        .user_data = compositor,
+    };
+    if (blend_config.mode == PPA_TRANS_MODE_NON_BLOCKING) {
+        portENTER_CRITICAL(&compositor->spinlock);
+        compositor->pending_trans++;
+        portEXIT_CRITICAL(&compositor->spinlock);
+    }
+    esp_err_t ret = ppa_do_blend(compositor->blend_client, &blend_config);
+    if (ret != ESP_OK && blend_config.mode == PPA_TRANS_MODE_NON_BLOCKING) {
+        portENTER_CRITICAL(&compositor->spinlock);
+        compositor->pending_trans--;
+        portEXIT_CRITICAL(&compositor->spinlock);
+    }
+    return ret;
+}
+
+esp_err_t esp_lcd_compositor_draw_layers(esp_lcd_compositor_handle_t compositor, const esp_lcd_compose_layer_t *layers, size_t num_layers)
+{
+    ESP_RETURN_ON_FALSE(compositor && layers && num_layers, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    for (size_t i = 0; i < num_layers; i++) {
+        ESP_RETURN_ON_ERROR(compositor_draw_one_layer(compositor, &layers[i]), TAG, "compose layer %zu failed", i);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_compositor_wait_all_done(esp_lcd_compositor_handle_t compositor, int timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(compositor, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    TickType_t ticks_to_wait = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    while (true) {
+        portENTER_CRITICAL(&compositor->spinlock);
+        size_t pending = compositor->pending_trans;
+        portEXIT_CRITICAL(&compositor->spinlock);
+        if (pending == 0) {
+            return ESP_OK;
+        }
+        if (xSemaphoreTake(compositor->done_sem, ticks_to_wait) != pdTRUE) {
+            return ESP_ERR_TIMEOUT;
+        }
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esp_cache.h"
+
+#if CONFIG_IDF_TARGET_ESP32S2
+#include "esp32s2/rom/cache.h"
+#define CACHE_LOCK_SUPPORTED        1
+#define cache_lock_addr(a, s)       Cache_Lock_Addr((a), (s))
+#define cache_unlock_addr(a, s)     Cache_Unlock_Addr((a), (s))
+#elif CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/cache.h"
+#define CACHE_LOCK_SUPPORTED        1
+#define cache_lock_addr(a, s)       Cache_Lock_Addr((a), (s))
+#define cache_unlock_addr(a, s)     Cache_Unlock_Addr((a), (s))
+#elif CONFIG_IDF_TARGET_ESP32P4
+#include "esp32p4/rom/cache.h"
+#define CACHE_LOCK_SUPPORTED        1
+#define cache_lock_addr(a, s)       Cache_Lock_Addr(CACHE_MAP_L2_CACHE, (a), (s))
+#define cache_unlock_addr(a, s)     Cache_Unlock_Addr(CACHE_MAP_L2_CACHE, (a), (s))
+#else
+#define CACHE_LOCK_SUPPORTED        0
+#endif
+
+static const char *TAG = "cache_lock";
+
+esp_err_t esp_cache_lock_region(const void *addr, size_t size)
+{
+#if CACHE_LOCK_SUPPORTED
+    ESP_RETURN_ON_FALSE(addr && size > 0, ESP_ERR_INVALID_ARG, TAG, "null pointer or zero size");
+    int ret = cache_lock_addr((uint32_t)addr, size);
+    return (ret == 0) ? ESP_OK : ESP_ERR_INVALID_ARG;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t esp_cache_unlock_region(const void *addr, size_t size)
+{
+#if CACHE_LOCK_SUPPORTED
+    ESP_RETURN_ON_FALSE(addr && size > 0, ESP_ERR_INVALID_ARG, TAG, "null pointer or zero size");
+    int ret = cache_unlock_addr((uint32_t)addr, size);
+    return (ret == 0) ? ESP_OK : ESP_ERR_INVALID_ARG;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <sys/param.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esp_cache.h"
+
+static const char *TAG = "cache_scope";
+
+/* Fill in the default direction / type the same way esp_cache_msync does, so
+ * that e.g. `0` and `ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_TYPE_DATA`
+ * land in the same merge bucket */
+static int s_normalise_flags(int flags)
+{
+    if ((flags & (ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_DIR_M2C)) == 0) {
+        flags |= ESP_CACHE_MSYNC_FLAG_DIR_C2M;
+    }
+    if ((flags & (ESP_CACHE_MSYNC_FLAG_TYPE_DATA | ESP_CACHE_MSYNC_FLAG_TYPE_INST)) == 0) {
+        flags |= ESP_CACHE_MSYNC_FLAG_TYPE_DATA;
+    }
+    return flags;
+}
+
+static void s_account_range(esp_cache_msync_scope_stats_t *stats, uint32_t start, uint32_t end, int flags)
+{
+    size_t size = end - start;
+    if (flags & ESP_CACHE_MSYNC_FLAG_DIR_M2C) {
+        stats->invalidate_bytes += size;
+    } else {
+        stats->writeback_bytes += size;
+        if (flags & ESP_CACHE_MSYNC_FLAG_INVALIDATE) {
+            stats->invalidate_bytes += size;
+        }
+    }
+    stats->msync_calls++;
+}
+
+esp_err_t esp_cache_msync_scope_begin(esp_cache_msync_scope_t *scope)
+{
+    ESP_RETURN_ON_FALSE(scope, ESP_ERR_INVALID_ARG, TAG, "null pointer");
+
+    memset(scope, 0, sizeof(esp_cache_msync_scope_t));
+    return ESP_OK;
+}
+
+esp_err_t esp_cache_msync_scope_sync(esp_cache_msync_scope_t *scope, void *addr, size_t size, int flags)
+{
+    ESP_RETURN_ON_FALSE(scope && addr, ESP_ERR_INVALID_ARG, TAG, "null pointer");
+    if (size == 0) {
+        return ESP_OK;
+    }
+
+    uint32_t start = (uint32_t)addr;
+    uint32_t end = 0;
+    bool ovf = __builtin_add_overflow(start, size, &end);
+    ESP_RETURN_ON_FALSE(!ovf, ESP_ERR_INVALID_ARG, TAG, "wrong size, total size overflow");
+    flags = s_normalise_flags(flags);
+
+    //try to absorb the new range into an already pending one with the same flags
+    for (size_t i = 0; i < scope->num_ranges; i++) {
+        if (scope->ranges[i].flags != flags) {
+            continue;
+        }
+        if (start <= scope->ranges[i].end && end >= scope->ranges[i].start) {
+            scope->ranges[i].start = MIN(scope->ranges[i].start, start);
+            scope->ranges[i].end = MAX(scope->ranges[i].end, end);
+            scope->stats.merged_ranges++;
+            return ESP_OK;
+        }
+    }
+
+    if (scope->num_ranges == ESP_CACHE_MSYNC_SCOPE_MAX_RANGES) {
+        //no free slot, don't defer this range, issue it right away
+        ESP_LOGD(TAG, "scope full, issuing range immediately");
+        esp_err_t ret = esp_cache_msync(addr, size, flags);
+        if (ret == ESP_OK) {
+            s_account_range(&scope->stats, start, end, flags);
+        }
+        return ret;
+    }
+
+    scope->ranges[scope->num_ranges].start = start;
+    scope->ranges[scope->num_ranges].end = end;
+    scope->ranges[scope->num_ranges].flags = flags;
+    scope->num_ranges++;
+    return ESP_OK;
+}
+
+esp_err_t esp_cache_msync_scope_end(esp_cache_msync_scope_t *scope, esp_cache_msync_scope_stats_t *out_stats)
+{
+    ESP_RETURN_ON_FALSE(scope, ESP_ERR_INVALID_ARG, TAG, "null pointer");
+
+    esp_err_t ret = ESP_OK;
+
+    /* Ranges pushed in `start` order can leave mergeable pairs behind (A and C
+     * pending, then B bridges them but only merges into one). Do a last
+     * pairwise merge pass before issuing anything */
+    for (size_t i = 0; i < scope->num_ranges; i++) {
+        for (size_t j = i + 1; j < scope->num_ranges; j++) {
+            if (scope->ranges[i].flags != scope->ranges[j].flags) {
+                continue;
+            }
+            if (scope->ranges[j].start <= scope->ranges[i].end && scope->ranges[j].end >= scope->ranges[i].start) {
+                scope->ranges[i].start = MIN(scope->ranges[i].start, scope->ranges[j].start);
+                scope->ranges[i].end = MAX(scope->ranges[i].end, scope->ranges[j].end);
+                scope->ranges[j] = scope->ranges[scope->num_ranges - 1];
+                scope->num_ranges--;
+                scope->stats.merged_ranges++;
+                //the merged range may now bridge into yet another one, rescan
+                j = i;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < scope->num_ranges; i++) {
+        uint32_t start = scope->ranges[i].start;
+        uint32_t end = scope->ranges[i].end;
+        int flags = scope->ranges[i].flags;
+        esp_err_t err = esp_cache_msync((void *)start, end - start, flags);
+        if (err != ESP_OK) {
+            //sync what we can, report the first failure
+            ret = (ret == ESP_OK) ? err : ret;
+            continue;
+        }
+        s_account_range(&scope->stats, start, end, flags);
+    }
+
+    if (out_stats) {
+        *out_stats = scope->stats;
+    }
+    scope->num_ranges = 0;
+    memset(&scope->stats, 0, sizeof(scope->stats));
+    return ret;
+}
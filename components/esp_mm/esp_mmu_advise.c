@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <sys/param.h>
+
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esp_mmu_map.h"
+
+#if CONFIG_IDF_TARGET_ESP32S2
+#include "esp32s2/rom/cache.h"
+#define ADVISE_PRELOAD_SUPPORTED      1
+#define advise_start_preload(a, s)    Cache_Start_DCache_Preload((a), (s), 0)
+#elif CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/cache.h"
+#define ADVISE_PRELOAD_SUPPORTED      1
+#define advise_start_preload(a, s)    Cache_Start_DCache_Preload((a), (s), 0)
+#elif CONFIG_IDF_TARGET_ESP32P4
+#include "esp32p4/rom/cache.h"
+#define ADVISE_PRELOAD_SUPPORTED      1
+#define advise_start_preload(a, s)    Cache_Start_L2_Cache_Preload((a), (s), 0)
+#else
+#define ADVISE_PRELOAD_SUPPORTED      0
+#endif
+
+static const char *TAG = "mmu_advise";
+
+esp_err_t esp_mmu_map_advise(const void *ptr, size_t len, esp_mmu_advice_t advice)
+{
+    ESP_RETURN_ON_FALSE(ptr && len > 0, ESP_ERR_INVALID_ARG, TAG, "null pointer or zero length");
+
+    esp_paddr_t paddr = 0;
+    mmu_target_t target = MMU_TARGET_FLASH0;
+    ESP_RETURN_ON_ERROR(esp_mmu_vaddr_to_paddr((void *)ptr, &paddr, &target), TAG, "not a mapped address");
+
+    if (advice == ESP_MMU_ADVICE_NORMAL) {
+        // Nothing persistent to tear down: preloads are one-shot
+        return ESP_OK;
+    }
+
+#if ADVISE_PRELOAD_SUPPORTED
+    // Preload a bounded window ahead of the cursor; a new call simply
+    // restarts the engine at the new position, so there is no completion
+    // tracking to do here.
+    size_t window = MIN(len, (size_t)CONFIG_ESP_MM_ADVISE_PRELOAD_WINDOW);
+    advise_start_preload((uint32_t)ptr, window);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
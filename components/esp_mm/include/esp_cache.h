@@ -79,6 +79,135 @@ extern "C" {
  */
 esp_err_t esp_cache_msync(void *addr, size_t size, int flags);
 
+/**
+ * @brief Maximum number of pending ranges a msync scope can hold
+ *
+ * Ranges pushed beyond this limit are not lost: the scope falls back to an
+ * immediate `esp_cache_msync` for the extra range.
+ */
+#define ESP_CACHE_MSYNC_SCOPE_MAX_RANGES    8
+
+/**
+ * @brief Statistics of a completed msync scope, see `esp_cache_msync_scope_end`
+ */
+typedef struct {
+    size_t writeback_bytes;     ///< Bytes written back to memory (C2M direction)
+    size_t invalidate_bytes;    ///< Bytes invalidated (M2C direction, plus C2M with ESP_CACHE_MSYNC_FLAG_INVALIDATE)
+    size_t msync_calls;         ///< Number of cache operations actually issued
+    size_t merged_ranges;       ///< Number of pushed ranges that were absorbed by merging
+} esp_cache_msync_scope_stats_t;
+
+/**
+ * @brief A batch of deferred msync operations
+ *
+ * Allocate on the stack and treat as opaque, the fields are managed by the
+ * `esp_cache_msync_scope_x` APIs
+ */
+typedef struct {
+    struct {
+        uint32_t start;         ///< Range start address
+        uint32_t end;           ///< Range end address (exclusive)
+        int flags;              ///< Normalised msync flags of this range
+    } ranges[ESP_CACHE_MSYNC_SCOPE_MAX_RANGES];
+    size_t num_ranges;          ///< Number of valid entries in `ranges`
+    esp_cache_msync_scope_stats_t stats;    ///< Accumulated since `esp_cache_msync_scope_begin`
+} esp_cache_msync_scope_t;
+
+/**
+ * @brief Start collecting msync operations into a scope
+ *
+ * A scope batches the cache maintenance of a multi-buffer pipeline (e.g. one
+ * camera - 2D-DMA - LCD frame): instead of each driver issuing its own
+ * `esp_cache_msync`, the ranges are registered with
+ * `esp_cache_msync_scope_sync` and flushed together by
+ * `esp_cache_msync_scope_end`, which first merges overlapping and adjacent
+ * ranges that use the same flags. Regions that several stages touch are then
+ * written back or invalidated once per scope instead of once per stage.
+ *
+ * The scope is caller-allocated and not thread-safe: a scope must be used
+ * from a single task. The underlying cache operations keep the
+ * `esp_cache_msync` guarantees.
+ *
+ * @param[out] scope  Scope to initialise
+ *
+ * @return
+ *        - ESP_OK: Scope started
+ *        - ESP_ERR_INVALID_ARG: Null pointer
+ */
+esp_err_t esp_cache_msync_scope_begin(esp_cache_msync_scope_t *scope);
+
+/**
+ * @brief Register a msync operation with a scope
+ *
+ * Same arguments as `esp_cache_msync`, but the cache operation is deferred
+ * until `esp_cache_msync_scope_end`. If the scope already holds
+ * `ESP_CACHE_MSYNC_SCOPE_MAX_RANGES` ranges that cannot be merged, the new
+ * range is issued immediately instead (still counted in the statistics).
+ *
+ * @param[in] scope  Scope started with `esp_cache_msync_scope_begin`
+ * @param[in] addr   Starting address to do the msync
+ * @param[in] size   Size to do the msync
+ * @param[in] flags  Flags, see `ESP_CACHE_MSYNC_FLAG_x`
+ *
+ * @return
+ *        - ESP_OK: Range registered (or issued, on overflow)
+ *        - ESP_ERR_INVALID_ARG: Invalid argument, see `esp_cache_msync`
+ */
+esp_err_t esp_cache_msync_scope_sync(esp_cache_msync_scope_t *scope, void *addr, size_t size, int flags);
+
+/**
+ * @brief Flush a scope, issuing the minimal set of cache operations
+ *
+ * Merges overlapping and adjacent pending ranges with identical flags, issues
+ * one `esp_cache_msync` per merged range and resets the scope so it can be
+ * reused for the next iteration of the pipeline.
+ *
+ * @param[in]  scope      Scope to flush
+ * @param[out] out_stats  Statistics accumulated since `esp_cache_msync_scope_begin`, can be NULL
+ *
+ * @return
+ *        - ESP_OK: All pending ranges synced
+ *        - ESP_ERR_INVALID_ARG: Null scope, or a pending range failed `esp_cache_msync` validation
+ */
+esp_err_t esp_cache_msync_scope_end(esp_cache_msync_scope_t *scope, esp_cache_msync_scope_stats_t *out_stats);
+
+/**
+ * @brief Lock a cache-backed region into the cache
+ *
+ * Lines covering the region are pinned and no longer considered for eviction,
+ * so hot code or data keeps its hit rate even while other tasks stream large
+ * amounts of data through the same cache (e.g. flash-heavy scans). The region
+ * must be a cache supported address (mapped flash or external RAM).
+ *
+ * Locked lines reduce the capacity available to everything else: keep locked
+ * regions small (well below half of the cache size) or the streaming workload
+ * will thrash in the remaining ways.
+ *
+ * This API is thread-safe
+ *
+ * @param[in] addr   Starting address of the region to lock
+ * @param[in] size   Size of the region, in bytes
+ *
+ * @return
+ *        - ESP_OK: Region locked
+ *        - ESP_ERR_INVALID_ARG: Null pointer, zero size, or not a cache supported addr
+ *        - ESP_ERR_NOT_SUPPORTED: This chip has no cache locking hardware
+ */
+esp_err_t esp_cache_lock_region(const void *addr, size_t size);
+
+/**
+ * @brief Unlock a region previously locked with esp_cache_lock_region()
+ *
+ * @param[in] addr   Starting address passed to esp_cache_lock_region()
+ * @param[in] size   Size passed to esp_cache_lock_region()
+ *
+ * @return
+ *        - ESP_OK: Region unlocked
+ *        - ESP_ERR_INVALID_ARG: Null pointer, zero size, or not a cache supported addr
+ *        - ESP_ERR_NOT_SUPPORTED: This chip has no cache locking hardware
+ */
+esp_err_t esp_cache_unlock_region(const void *addr, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
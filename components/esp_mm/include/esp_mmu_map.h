@@ -170,6 +170,38 @@ esp_err_t esp_mmu_paddr_to_vaddr(esp_paddr_t paddr, mmu_target_t target, mmu_vad
  */
 esp_err_t esp_mmu_paddr_find_caps(const esp_paddr_t paddr, mmu_mem_caps_t *out_caps);
 
+/**
+ * Access pattern hints for esp_mmu_map_advise()
+ */
+typedef enum {
+    ESP_MMU_ADVICE_NORMAL,      ///< No special access pattern, drop any previous advice on the region
+    ESP_MMU_ADVICE_SEQUENTIAL,  ///< Region will be scanned sequentially from `ptr` upwards
+} esp_mmu_advice_t;
+
+/**
+ * @brief Advise the driver about the expected access pattern of a mapped region
+ *
+ * For `ESP_MMU_ADVICE_SEQUENTIAL`, the driver starts a hardware cache preload
+ * of a window ahead of `ptr`, so cache misses on a sequential scan are
+ * overlapped with useful work. Call this again with an advanced `ptr` as the
+ * scan proceeds to keep the preload window ahead of the read cursor; each call
+ * restarts the preload at the new position.
+ *
+ * The window size is controlled by CONFIG_ESP_MM_ADVISE_PRELOAD_WINDOW. The
+ * call never blocks on preload completion.
+ *
+ * @param[in] ptr     Start of the region the advice applies to. Must be a
+ *                    cache-backed (mapped) address
+ * @param[in] len     Length of the region, in bytes
+ * @param[in] advice  Expected access pattern
+ *
+ * @return
+ *      - ESP_OK: Advice accepted
+ *      - ESP_ERR_INVALID_ARG: Null pointer, zero length, or `ptr` not a mapped address
+ *      - ESP_ERR_NOT_SUPPORTED: This target has no cache preload hardware
+ */
+esp_err_t esp_mmu_map_advise(const void *ptr, size_t len, esp_mmu_advice_t advice);
+
 #ifdef __cplusplus
 }
 #endif
@@ -215,3 +215,31 @@ TEST_CASE("test cache msync unaligned flag not work with M2C direction", "[cache
 {
     TEST_ASSERT(esp_cache_msync((void *)TEST_SYNC_START, 0x8000, ESP_CACHE_MSYNC_FLAG_UNALIGNED | ESP_CACHE_MSYNC_FLAG_DIR_M2C) == ESP_ERR_INVALID_ARG);
 }
+
+TEST_CASE("test cache msync scope merges overlapping ranges", "[cache]")
+{
+    esp_cache_msync_scope_t scope;
+    esp_cache_msync_scope_stats_t stats;
+    TEST_ESP_OK(esp_cache_msync_scope_begin(&scope));
+
+    int flags = ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED;
+    //three overlapping ranges plus one adjacent one, all collapsing into [0, 0x5000)
+    TEST_ESP_OK(esp_cache_msync_scope_sync(&scope, (void *)TEST_SYNC_START, 0x2000, flags));
+    TEST_ESP_OK(esp_cache_msync_scope_sync(&scope, (void *)(TEST_SYNC_START + 0x1000), 0x2000, flags));
+    TEST_ESP_OK(esp_cache_msync_scope_sync(&scope, (void *)(TEST_SYNC_START + 0x1800), 0x1000, flags));
+    TEST_ESP_OK(esp_cache_msync_scope_sync(&scope, (void *)(TEST_SYNC_START + 0x3000), 0x2000, flags));
+    //a disjoint range with different flags stays separate
+    TEST_ESP_OK(esp_cache_msync_scope_sync(&scope, (void *)(TEST_SYNC_START + 0x8000), 0x1000, ESP_CACHE_MSYNC_FLAG_DIR_M2C));
+
+    TEST_ESP_OK(esp_cache_msync_scope_end(&scope, &stats));
+    TEST_ASSERT_EQUAL(2, stats.msync_calls);
+    TEST_ASSERT_EQUAL(3, stats.merged_ranges);
+    TEST_ASSERT_EQUAL(0x5000, stats.writeback_bytes);
+    TEST_ASSERT_EQUAL(0x1000, stats.invalidate_bytes);
+
+    //the scope is reusable after esp_cache_msync_scope_end
+    TEST_ESP_OK(esp_cache_msync_scope_sync(&scope, (void *)TEST_SYNC_START, 0x1000, flags));
+    TEST_ESP_OK(esp_cache_msync_scope_end(&scope, &stats));
+    TEST_ASSERT_EQUAL(1, stats.msync_calls);
+    TEST_ASSERT_EQUAL(0, stats.merged_ranges);
+}
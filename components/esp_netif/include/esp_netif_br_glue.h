@@ -45,6 +45,51 @@ esp_err_t esp_netif_br_glue_add_port(esp_netif_br_glue_handle_t netif_br_glue, e
  */
 esp_err_t esp_netif_br_glue_add_wifi_port(esp_netif_br_glue_handle_t netif_br_glue, esp_netif_t *esp_netif_port);
 
+/**
+ * @brief Configuration of bridge-to-Wi-Fi pacing, see esp_netif_br_glue_enable_wifi_pacing()
+ */
+typedef struct {
+    uint32_t backoff_ms;        /*!< Initial drop window after the Wi-Fi TX queue reports full */
+    uint32_t max_backoff_ms;    /*!< Upper limit of the drop window while congestion persists */
+} esp_netif_br_pacing_config_t;
+
+/**
+ * @brief Enable coex-aware pacing of bridge traffic towards the Wi-Fi port
+ *
+ * When the Wi-Fi driver rejects a forwarded frame because its TX queue is full, further
+ * forwarding towards Wi-Fi is dropped early for backoff_ms (doubling up to max_backoff_ms
+ * while the congestion persists) instead of pushing every frame through the whole Wi-Fi
+ * TX path just to be rejected. A saturated Wi-Fi link then degrades by dropping its own
+ * excess traffic, and the Ethernet side of the bridge keeps the lwIP thread and the
+ * shared buffer pools. Locally originated traffic of the Wi-Fi AP interface is paced
+ * too, as in a bridging setup it shares the same bottleneck queue.
+ *
+ * @note Only available with CONFIG_ESP_NETIF_BRIDGE_WIFI_PACING enabled. Call after the
+ *       Wi-Fi port was added with esp_netif_br_glue_add_wifi_port() and its io driver
+ *       is attached. Only one bridge instance can have pacing enabled.
+ *
+ * @param netif_br_glue bridge netif glue
+ * @param config pacing configuration
+ * @return - ESP_OK on success
+ *         - ESP_ERR_INVALID_ARG invalid handle or configuration
+ *         - ESP_ERR_INVALID_STATE Wi-Fi port not registered/attached, or pacing already enabled
+ *         - ESP_ERR_NOT_SUPPORTED CONFIG_ESP_NETIF_BRIDGE_WIFI_PACING is disabled
+ */
+esp_err_t esp_netif_br_glue_enable_wifi_pacing(esp_netif_br_glue_handle_t netif_br_glue, const esp_netif_br_pacing_config_t *config);
+
+/**
+ * @brief Get the forwarded/dropped frame counters of bridge-to-Wi-Fi pacing
+ *
+ * @param netif_br_glue bridge netif glue
+ * @param[out] forwarded Number of frames accepted by the Wi-Fi driver, can be NULL
+ * @param[out] dropped Number of frames dropped by the pacing backoff, can be NULL
+ * @return - ESP_OK on success
+ *         - ESP_ERR_INVALID_ARG invalid handle
+ *         - ESP_ERR_INVALID_STATE pacing is not enabled
+ *         - ESP_ERR_NOT_SUPPORTED CONFIG_ESP_NETIF_BRIDGE_WIFI_PACING is disabled
+ */
+esp_err_t esp_netif_br_glue_get_pacing_stats(esp_netif_br_glue_handle_t netif_br_glue, uint32_t *forwarded, uint32_t *dropped);
+
 /**
  * @brief Delete netif glue of bridge
  *
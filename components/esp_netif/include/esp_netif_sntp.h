@@ -45,6 +45,7 @@ typedef void (*esp_sntp_time_cb_t)(struct timeval *tv);
  */
 #define ESP_NETIF_SNTP_DEFAULT_CONFIG_MULTIPLE(servers_in_list, list_of_servers)   {   \
             .smooth_sync = false,                       \
+            .fast_converge = false,                     \
             .server_from_dhcp = false,                  \
             .wait_for_sync = true,                      \
             .start = true,                              \
@@ -67,6 +68,11 @@ typedef void (*esp_sntp_time_cb_t)(struct timeval *tv);
  */
 typedef struct esp_sntp_config {
     bool smooth_sync;              ///< set to true if smooth sync required
+    bool fast_converge;            ///< set to true to send a short burst of SNTP requests after start (similar to ntpd's iburst),
+                                   ///< average the collected offsets with the extreme samples rejected and apply the result
+                                   ///< through adjtime(), then fall back to the configured poll interval. This converges to a
+                                   ///< jitter-free time estimate in a few seconds instead of waiting several poll periods.
+                                   ///< The sync event (sync_cb and esp_netif_sntp_sync_wait()) fires once the burst completes.
     bool server_from_dhcp;         ///< set to true to request NTP server config from DHCP
     bool wait_for_sync;            ///< if true, we create a semaphore to signal time sync event
     bool start;                    ///< set to true to automatically start the SNTP service
@@ -11,6 +11,10 @@
 #include "esp_event.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#if CONFIG_ESP_NETIF_BRIDGE_WIFI_PACING
+#include "esp_timer.h"
+#include "esp_netif_lwip_internal.h"
+#endif
 
 #if CONFIG_ESP_NETIF_BRIDGE_EN
 
@@ -350,6 +354,141 @@ fail_ret:
     return ret;
 }
 
+#if CONFIG_ESP_NETIF_BRIDGE_WIFI_PACING
+
+#if CONFIG_ESP_COEX_SW_COEXIST_ENABLE
+// the radio shares airtime with BT, a full TX queue drains even slower
+#define BR_PACING_COEX_SCALE 2
+#else
+#define BR_PACING_COEX_SCALE 1
+#endif
+
+typedef struct {
+    esp_err_t (*orig_transmit)(void *h, void *buffer, size_t len);
+    esp_err_t (*orig_transmit_wrap)(void *h, void *buffer, size_t len, void *netstack_buf);
+    esp_netif_br_pacing_config_t config;
+    int64_t congested_until_us;
+    int64_t last_congest_us;
+    uint32_t cur_backoff_ms;
+    uint32_t forwarded;
+    uint32_t dropped;
+    bool active;
+} br_wifi_pacing_t;
+
+// Only one bridge instance can pace its Wi-Fi port; all accesses run in the
+// lwIP thread (transmit path) so no locking is needed.
+static br_wifi_pacing_t s_pacing;
+
+static bool br_wifi_pacing_should_drop(void)
+{
+    if (esp_timer_get_time() < s_pacing.congested_until_us) {
+        s_pacing.dropped++;
+        return true;
+    }
+    return false;
+}
+
+static esp_err_t br_wifi_pacing_filter(esp_err_t ret)
+{
+    if (ret == ESP_ERR_NO_MEM) {
+        // Wi-Fi TX queue is full: stop forwarding towards Wi-Fi for a backoff
+        // window, doubling it while the congestion persists
+        int64_t now = esp_timer_get_time();
+        if (now < s_pacing.last_congest_us + 2 * (int64_t)s_pacing.cur_backoff_ms * 1000) {
+            uint32_t doubled = s_pacing.cur_backoff_ms * 2;
+            s_pacing.cur_backoff_ms = doubled < s_pacing.config.max_backoff_ms ? doubled : s_pacing.config.max_backoff_ms;
+        } else {
+            s_pacing.cur_backoff_ms = s_pacing.config.backoff_ms;
+        }
+        s_pacing.last_congest_us = now;
+        s_pacing.congested_until_us = now + (int64_t)s_pacing.cur_backoff_ms * 1000 * BR_PACING_COEX_SCALE;
+        s_pacing.dropped++;
+        // the frame is dropped; don't propagate the error into the bridge
+        return ESP_OK;
+    }
+    if (ret == ESP_OK) {
+        s_pacing.forwarded++;
+    }
+    return ret;
+}
+
+static esp_err_t br_wifi_pacing_transmit(void *h, void *buffer, size_t len)
+{
+    if (br_wifi_pacing_should_drop()) {
+        return ESP_OK;
+    }
+    return br_wifi_pacing_filter(s_pacing.orig_transmit(h, buffer, len));
+}
+
+static esp_err_t br_wifi_pacing_transmit_wrap(void *h, void *buffer, size_t len, void *netstack_buf)
+{
+    if (br_wifi_pacing_should_drop()) {
+        return ESP_OK;
+    }
+    return br_wifi_pacing_filter(s_pacing.orig_transmit_wrap(h, buffer, len, netstack_buf));
+}
+
+esp_err_t esp_netif_br_glue_enable_wifi_pacing(esp_netif_br_glue_handle_t netif_br_glue, const esp_netif_br_pacing_config_t *config)
+{
+    ESP_RETURN_ON_FALSE(netif_br_glue && config, ESP_ERR_INVALID_ARG, TAG, "esp_netif_br_glue handle and config can't be null");
+    ESP_RETURN_ON_FALSE(config->backoff_ms > 0 && config->max_backoff_ms >= config->backoff_ms,
+                        ESP_ERR_INVALID_ARG, TAG, "invalid backoff configuration");
+    ESP_RETURN_ON_FALSE(netif_br_glue->wifi_esp_netif, ESP_ERR_INVALID_STATE, TAG, "WiFi port esp_netif isn't registered");
+    ESP_RETURN_ON_FALSE(!s_pacing.active, ESP_ERR_INVALID_STATE, TAG, "pacing is already enabled");
+
+    esp_netif_t *wifi_netif = netif_br_glue->wifi_esp_netif;
+    ESP_RETURN_ON_FALSE(wifi_netif->driver_transmit, ESP_ERR_INVALID_STATE, TAG, "WiFi port io driver isn't attached");
+
+    memset(&s_pacing, 0, sizeof(s_pacing));
+    s_pacing.config = *config;
+    s_pacing.cur_backoff_ms = config->backoff_ms;
+    s_pacing.orig_transmit = wifi_netif->driver_transmit;
+    s_pacing.orig_transmit_wrap = wifi_netif->driver_transmit_wrap;
+    wifi_netif->driver_transmit = br_wifi_pacing_transmit;
+    if (wifi_netif->driver_transmit_wrap) {
+        wifi_netif->driver_transmit_wrap = br_wifi_pacing_transmit_wrap;
+    }
+    s_pacing.active = true;
+    ESP_LOGI(TAG, "Wi-Fi port pacing enabled, backoff %" PRIu32 "-%" PRIu32 " ms", config->backoff_ms, config->max_backoff_ms);
+    return ESP_OK;
+}
+
+esp_err_t esp_netif_br_glue_get_pacing_stats(esp_netif_br_glue_handle_t netif_br_glue, uint32_t *forwarded, uint32_t *dropped)
+{
+    ESP_RETURN_ON_FALSE(netif_br_glue, ESP_ERR_INVALID_ARG, TAG, "esp_netif_br_glue handle can't be null");
+    ESP_RETURN_ON_FALSE(s_pacing.active, ESP_ERR_INVALID_STATE, TAG, "pacing is not enabled");
+    if (forwarded) {
+        *forwarded = s_pacing.forwarded;
+    }
+    if (dropped) {
+        *dropped = s_pacing.dropped;
+    }
+    return ESP_OK;
+}
+
+static void br_wifi_pacing_disable(esp_netif_br_glue_handle_t netif_br_glue)
+{
+    if (s_pacing.active && netif_br_glue->wifi_esp_netif) {
+        netif_br_glue->wifi_esp_netif->driver_transmit = s_pacing.orig_transmit;
+        netif_br_glue->wifi_esp_netif->driver_transmit_wrap = s_pacing.orig_transmit_wrap;
+        s_pacing.active = false;
+    }
+}
+
+#else // !CONFIG_ESP_NETIF_BRIDGE_WIFI_PACING
+
+esp_err_t esp_netif_br_glue_enable_wifi_pacing(esp_netif_br_glue_handle_t netif_br_glue, const esp_netif_br_pacing_config_t *config)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_netif_br_glue_get_pacing_stats(esp_netif_br_glue_handle_t netif_br_glue, uint32_t *forwarded, uint32_t *dropped)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif // CONFIG_ESP_NETIF_BRIDGE_WIFI_PACING
+
 esp_netif_br_glue_handle_t esp_netif_br_glue_new(void)
 {
     esp_netif_br_glue_t *netif_glue = calloc(1, sizeof(esp_netif_br_glue_t));
@@ -371,6 +510,9 @@ esp_netif_br_glue_handle_t esp_netif_br_glue_new(void)
 esp_err_t esp_netif_br_glue_del(esp_netif_br_glue_handle_t netif_br_glue)
 {
     stop_br_if_started(netif_br_glue);
+#if CONFIG_ESP_NETIF_BRIDGE_WIFI_PACING
+    br_wifi_pacing_disable(netif_br_glue);
+#endif
     esp_netif_br_glue_clear_instance_handlers(netif_br_glue);
     if (netif_br_glue->wifi_esp_netif != NULL) {
         esp_netif_br_glue_clear_instance_handlers_wifi(netif_br_glue);
@@ -0,0 +1,356 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_netif.h"
+#include "esp_netif_net_stack.h"
+#include "lwip/opt.h"
+#include "lwip/sys.h"
+#include "lwip/pbuf.h"
+#include "lwip/prot/ethernet.h"
+#include "lwip/prot/ip.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/tcp.h"
+#include "esp_netif_flow_cache.h"
+
+/** Number of cached flows (direct mapped) */
+#define FLOW_CACHE_SIZE             16
+/** Number of in-flight learn candidates */
+#define FLOW_CACHE_PENDING_SIZE     8
+/** How often a cached flow is punted to the slow path so that the
+ *  forwarding/NAPT state in lwIP it shortcuts does not time out */
+#define FLOW_CACHE_REFRESH_MS       2000
+
+/* Byte offsets within an Ethernet II + IPv4 frame. The IP header starts at a
+ * 2-byte boundary, so all header fields are read and written as 16-bit words
+ * regardless of the buffer alignment the driver provides. */
+#define FLOW_OFF_ETH_TYPE           12
+#define FLOW_OFF_IP                 SIZEOF_ETH_HDR
+#define FLOW_OFF_IP_VHL             (FLOW_OFF_IP + 0)
+#define FLOW_OFF_IP_ID              (FLOW_OFF_IP + 4)
+#define FLOW_OFF_IP_FRAG            (FLOW_OFF_IP + 6)
+#define FLOW_OFF_IP_TTL_PROTO       (FLOW_OFF_IP + 8)
+#define FLOW_OFF_IP_CHKSUM          (FLOW_OFF_IP + 10)
+#define FLOW_OFF_IP_SRC             (FLOW_OFF_IP + 12)
+#define FLOW_OFF_IP_DST             (FLOW_OFF_IP + 16)
+#define FLOW_OFF_L4                 (FLOW_OFF_IP + IP_HLEN)
+#define FLOW_OFF_L4_SPORT           (FLOW_OFF_L4 + 0)
+#define FLOW_OFF_L4_DPORT           (FLOW_OFF_L4 + 2)
+#define FLOW_OFF_TCP_SEQ            (FLOW_OFF_L4 + 4)
+#define FLOW_OFF_TCP_FLAGS          (FLOW_OFF_L4 + 13)
+#define FLOW_OFF_TCP_CHKSUM        (FLOW_OFF_L4 + 16)
+#define FLOW_OFF_UDP_CHKSUM        (FLOW_OFF_L4 + 6)
+
+/** Minimum frame length the fast path will touch: eth + IPv4 + 8 bytes of L4
+ *  (covers the UDP header and the TCP fields we key on are checked separately) */
+#define FLOW_CACHE_MIN_FRAME_LEN    (SIZEOF_ETH_HDR + IP_HLEN + 8)
+#define FLOW_CACHE_MIN_TCP_LEN      (SIZEOF_ETH_HDR + IP_HLEN + TCP_HLEN)
+
+/** IPv4 5-tuple identifying a flow, all fields in network byte order */
+typedef struct flow_key {
+    u32_t src_ip;
+    u32_t dst_ip;
+    u16_t src_port;
+    u16_t dst_port;
+    u8_t proto;
+} flow_key_t;
+
+/** Learned header rewrite for a cached flow */
+typedef struct flow_entry {
+    bool valid;
+    flow_key_t key;             /*!< tuple of the frame as received */
+    u32_t new_src_ip;           /*!< addresses/ports after forwarding (NAPT) */
+    u32_t new_dst_ip;
+    u16_t new_src_port;
+    u16_t new_dst_port;
+    u8_t eth_hdr[SIZEOF_ETH_HDR]; /*!< ethernet header of the forwarded frame */
+    esp_netif_t *in_netif;
+    esp_netif_t *out_netif;
+    u32_t last_slow_ms;         /*!< last time this flow took the slow path */
+} flow_entry_t;
+
+/** Frame noted on input, waiting to be matched against the link output */
+typedef struct flow_pending {
+    struct pbuf *p;             /*!< matched by pointer identity only */
+    flow_key_t key;
+    esp_netif_t *in_netif;
+    u16_t ip_id;
+    u32_t tcp_seq;              /*!< 0 for UDP */
+    u8_t ttl;
+} flow_pending_t;
+
+static flow_entry_t s_flow_table[FLOW_CACHE_SIZE];
+static flow_pending_t s_flow_pending[FLOW_CACHE_PENDING_SIZE];
+static unsigned s_flow_pending_next;
+static portMUX_TYPE s_flow_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static inline u16_t flow_get16(const u8_t *frame, unsigned off)
+{
+    u16_t v;
+    memcpy(&v, frame + off, sizeof(v));
+    return v;
+}
+
+static inline void flow_put16(u8_t *frame, unsigned off, u16_t v)
+{
+    memcpy(frame + off, &v, sizeof(v));
+}
+
+static inline u32_t flow_get32(const u8_t *frame, unsigned off)
+{
+    u32_t v;
+    memcpy(&v, frame + off, sizeof(v));
+    return v;
+}
+
+/**
+ * RFC 1624 incremental checksum update for one changed 16-bit word.
+ * All words are raw network-order values; the one's complement sum is
+ * byte-order independent, so no conversion is needed.
+ */
+static inline void flow_chksum_update(u8_t *frame, unsigned sum_off, u16_t old_w, u16_t new_w)
+{
+    u32_t acc = (u16_t)~flow_get16(frame, sum_off);
+    acc += (u16_t)~old_w;
+    acc += new_w;
+    acc = (acc & 0xFFFF) + (acc >> 16);
+    acc = (acc & 0xFFFF) + (acc >> 16);
+    flow_put16(frame, sum_off, (u16_t)~acc);
+}
+
+static inline unsigned flow_hash(const flow_key_t *key)
+{
+    u32_t h = key->src_ip ^ key->dst_ip;
+    h ^= ((u32_t)key->src_port << 16) | key->dst_port;
+    h ^= key->proto;
+    h ^= h >> 16;
+    h ^= h >> 8;
+    return h % FLOW_CACHE_SIZE;
+}
+
+static inline bool flow_key_equal(const flow_key_t *a, const flow_key_t *b)
+{
+    return a->src_ip == b->src_ip && a->dst_ip == b->dst_ip &&
+           a->src_port == b->src_port && a->dst_port == b->dst_port &&
+           a->proto == b->proto;
+}
+
+/**
+ * Extract the flow key of an Ethernet II + IPv4 TCP/UDP frame.
+ *
+ * Returns false for anything the fast path must not touch: non-IPv4 frames,
+ * IP options, fragments, expiring TTL, multicast link destinations and
+ * protocols other than TCP/UDP. TCP segments carrying SYN/FIN/RST are also
+ * rejected so connection setup and teardown always reach the stack.
+ */
+static bool flow_parse(const u8_t *frame, u16_t len, flow_key_t *key)
+{
+    if (len < FLOW_CACHE_MIN_FRAME_LEN) {
+        return false;
+    }
+    if (frame[0] & 0x01) { /* multicast/broadcast destination */
+        return false;
+    }
+    if (flow_get16(frame, FLOW_OFF_ETH_TYPE) != PP_HTONS(ETHTYPE_IP)) {
+        return false;
+    }
+    if (frame[FLOW_OFF_IP_VHL] != 0x45) { /* IPv4, no options */
+        return false;
+    }
+    /* no fragments: MF flag or nonzero offset */
+    if (flow_get16(frame, FLOW_OFF_IP_FRAG) & PP_HTONS(IP_MF | IP_OFFMASK)) {
+        return false;
+    }
+    u8_t ttl = frame[FLOW_OFF_IP_TTL_PROTO];
+    if (ttl <= 1) {
+        return false;
+    }
+    u8_t proto = frame[FLOW_OFF_IP_TTL_PROTO + 1];
+    if (proto == IP_PROTO_TCP) {
+        if (len < FLOW_CACHE_MIN_TCP_LEN) {
+            return false;
+        }
+        if (frame[FLOW_OFF_TCP_FLAGS] & (TCP_SYN | TCP_FIN | TCP_RST)) {
+            return false;
+        }
+    } else if (proto != IP_PROTO_UDP) {
+        return false;
+    }
+    key->src_ip = flow_get32(frame, FLOW_OFF_IP_SRC);
+    key->dst_ip = flow_get32(frame, FLOW_OFF_IP_DST);
+    key->src_port = flow_get16(frame, FLOW_OFF_L4_SPORT);
+    key->dst_port = flow_get16(frame, FLOW_OFF_L4_DPORT);
+    key->proto = proto;
+    return true;
+}
+
+bool esp_netif_flow_cache_input(esp_netif_t *esp_netif, void *buffer, uint16_t len)
+{
+    u8_t *frame = buffer;
+    flow_key_t key;
+    flow_entry_t entry;
+
+    if (!flow_parse(frame, len, &key)) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&s_flow_lock);
+    flow_entry_t *slot = &s_flow_table[flow_hash(&key)];
+    if (!slot->valid || slot->in_netif != esp_netif || !flow_key_equal(&slot->key, &key)) {
+        portEXIT_CRITICAL(&s_flow_lock);
+        return false;
+    }
+    u32_t now = sys_now();
+    if ((u32_t)(now - slot->last_slow_ms) > FLOW_CACHE_REFRESH_MS) {
+        /* keep lwIP's forwarding/NAPT state for this flow alive */
+        slot->last_slow_ms = now;
+        portEXIT_CRITICAL(&s_flow_lock);
+        return false;
+    }
+    entry = *slot;
+    portEXIT_CRITICAL(&s_flow_lock);
+
+    /* Rewrite the frame in place: link header, translated addresses/ports
+     * and TTL, with incremental IP and L4 checksum updates */
+    memcpy(frame, entry.eth_hdr, SIZEOF_ETH_HDR);
+
+    unsigned l4_sum_off = 0;
+    if (key.proto == IP_PROTO_TCP) {
+        l4_sum_off = FLOW_OFF_TCP_CHKSUM;
+    } else if (flow_get16(frame, FLOW_OFF_UDP_CHKSUM) != 0) {
+        l4_sum_off = FLOW_OFF_UDP_CHKSUM; /* UDP checksum 0 = not used */
+    }
+
+    for (unsigned i = 0; i < 2; i++) {
+        unsigned off = FLOW_OFF_IP_SRC + 2 * i;
+        u16_t old_w = flow_get16(frame, off);
+        u16_t new_w = (u16_t)(entry.new_src_ip >> (16 * i));
+        if (old_w != new_w) {
+            flow_chksum_update(frame, FLOW_OFF_IP_CHKSUM, old_w, new_w);
+            if (l4_sum_off) {
+                flow_chksum_update(frame, l4_sum_off, old_w, new_w);
+            }
+            flow_put16(frame, off, new_w);
+        }
+        off = FLOW_OFF_IP_DST + 2 * i;
+        old_w = flow_get16(frame, off);
+        new_w = (u16_t)(entry.new_dst_ip >> (16 * i));
+        if (old_w != new_w) {
+            flow_chksum_update(frame, FLOW_OFF_IP_CHKSUM, old_w, new_w);
+            if (l4_sum_off) {
+                flow_chksum_update(frame, l4_sum_off, old_w, new_w);
+            }
+            flow_put16(frame, off, new_w);
+        }
+    }
+    u16_t old_ports = flow_get16(frame, FLOW_OFF_L4_SPORT);
+    if (old_ports != entry.new_src_port) {
+        if (l4_sum_off) {
+            flow_chksum_update(frame, l4_sum_off, old_ports, entry.new_src_port);
+        }
+        flow_put16(frame, FLOW_OFF_L4_SPORT, entry.new_src_port);
+    }
+    old_ports = flow_get16(frame, FLOW_OFF_L4_DPORT);
+    if (old_ports != entry.new_dst_port) {
+        if (l4_sum_off) {
+            flow_chksum_update(frame, l4_sum_off, old_ports, entry.new_dst_port);
+        }
+        flow_put16(frame, FLOW_OFF_L4_DPORT, entry.new_dst_port);
+    }
+    /* TTL and protocol share one word */
+    u16_t old_ttl_proto = flow_get16(frame, FLOW_OFF_IP_TTL_PROTO);
+    frame[FLOW_OFF_IP_TTL_PROTO]--;
+    flow_chksum_update(frame, FLOW_OFF_IP_CHKSUM, old_ttl_proto,
+                       flow_get16(frame, FLOW_OFF_IP_TTL_PROTO));
+
+    /* Transmit failure (e.g. out of DMA buffers) drops the frame, exactly as
+     * the slow path would when the output queue is exhausted */
+    esp_netif_transmit(entry.out_netif, frame, len);
+    return true;
+}
+
+void esp_netif_flow_cache_note_input(esp_netif_t *esp_netif, struct pbuf *p)
+{
+    flow_key_t key;
+
+    if (p->next != NULL || !flow_parse(p->payload, p->len, &key)) {
+        return;
+    }
+    const u8_t *frame = p->payload;
+
+    portENTER_CRITICAL(&s_flow_lock);
+    flow_pending_t *pending = &s_flow_pending[s_flow_pending_next];
+    s_flow_pending_next = (s_flow_pending_next + 1) % FLOW_CACHE_PENDING_SIZE;
+    pending->p = p;
+    pending->key = key;
+    pending->in_netif = esp_netif;
+    pending->ip_id = flow_get16(frame, FLOW_OFF_IP_ID);
+    pending->tcp_seq = (key.proto == IP_PROTO_TCP) ? flow_get32(frame, FLOW_OFF_TCP_SEQ) : 0;
+    pending->ttl = frame[FLOW_OFF_IP_TTL_PROTO];
+    portEXIT_CRITICAL(&s_flow_lock);
+}
+
+void esp_netif_flow_cache_learn(esp_netif_t *esp_netif, struct pbuf *p)
+{
+    flow_key_t key;
+
+    if (p->next != NULL || !flow_parse(p->payload, p->len, &key)) {
+        return;
+    }
+    const u8_t *frame = p->payload;
+
+    portENTER_CRITICAL(&s_flow_lock);
+    for (unsigned i = 0; i < FLOW_CACHE_PENDING_SIZE; i++) {
+        flow_pending_t *pending = &s_flow_pending[i];
+        if (pending->p != p) {
+            continue;
+        }
+        pending->p = NULL;
+        /* Same pbuf forwarded to another interface: verify it is still the
+         * same packet (pbufs are recycled) via the immutable header fields,
+         * and that exactly one hop was taken */
+        if (pending->in_netif == esp_netif ||
+            pending->key.proto != key.proto ||
+            pending->ip_id != flow_get16(frame, FLOW_OFF_IP_ID) ||
+            (u8_t)(pending->ttl - 1) != frame[FLOW_OFF_IP_TTL_PROTO] ||
+            (key.proto == IP_PROTO_TCP && pending->tcp_seq != flow_get32(frame, FLOW_OFF_TCP_SEQ))) {
+            break;
+        }
+        flow_entry_t *slot = &s_flow_table[flow_hash(&pending->key)];
+        slot->valid = true;
+        slot->key = pending->key;
+        slot->new_src_ip = flow_get32(frame, FLOW_OFF_IP_SRC);
+        slot->new_dst_ip = flow_get32(frame, FLOW_OFF_IP_DST);
+        slot->new_src_port = flow_get16(frame, FLOW_OFF_L4_SPORT);
+        slot->new_dst_port = flow_get16(frame, FLOW_OFF_L4_DPORT);
+        memcpy(slot->eth_hdr, frame, SIZEOF_ETH_HDR);
+        slot->in_netif = pending->in_netif;
+        slot->out_netif = esp_netif;
+        slot->last_slow_ms = sys_now();
+        break;
+    }
+    portEXIT_CRITICAL(&s_flow_lock);
+}
+
+void esp_netif_flow_cache_flush(esp_netif_t *esp_netif)
+{
+    portENTER_CRITICAL(&s_flow_lock);
+    for (unsigned i = 0; i < FLOW_CACHE_SIZE; i++) {
+        flow_entry_t *slot = &s_flow_table[i];
+        if (slot->valid && (esp_netif == NULL ||
+                            slot->in_netif == esp_netif || slot->out_netif == esp_netif)) {
+            slot->valid = false;
+        }
+    }
+    for (unsigned i = 0; i < FLOW_CACHE_PENDING_SIZE; i++) {
+        if (esp_netif == NULL || s_flow_pending[i].in_netif == esp_netif) {
+            s_flow_pending[i].p = NULL;
+        }
+    }
+    portEXIT_CRITICAL(&s_flow_lock);
+}
@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _ESP_NETIF_FLOW_CACHE_H_
+#define _ESP_NETIF_FLOW_CACHE_H_
+
+#include <stdbool.h>
+#include "esp_netif.h"
+#include "lwip/pbuf.h"
+
+/**
+ * @brief Forwarding fast path for established NAT/forwarded flows
+ *
+ * The cache maps the 5-tuple of recently forwarded IPv4 TCP/UDP flows to the
+ * header rewrite lwIP's forwarding (and NAPT) applied to them. Cached flows
+ * are patched and transmitted directly in the driver's receive context,
+ * skipping the tcpip mailbox and the full IP input path.
+ *
+ * Entries are learned by correlation: the receive path notes the original
+ * tuple of every candidate packet and the link output compares the (possibly
+ * translated) packet it is handed in the tcpip thread against those notes.
+ * Cached flows are periodically pushed through the slow path again so that
+ * NAPT and TCP state in lwIP does not time out under them.
+ */
+
+/**
+ * @brief Try to forward a received frame on the fast path
+ *
+ * Called in the driver receive context before the frame enters lwIP.
+ *
+ * @return true if the frame matched a cached flow and has been transmitted
+ *         (the caller only needs to release the RX buffer), false if the
+ *         frame must take the regular input path
+ */
+bool esp_netif_flow_cache_input(esp_netif_t *esp_netif, void *buffer, uint16_t len);
+
+/**
+ * @brief Note a frame entering the regular input path as a learn candidate
+ */
+void esp_netif_flow_cache_note_input(esp_netif_t *esp_netif, struct pbuf *p);
+
+/**
+ * @brief Learn a flow from a frame handed to the link output
+ *
+ * Called from the netif linkoutput function (tcpip thread). If the frame is a
+ * noted input packet forwarded to a different interface, a cache entry with
+ * the observed header rewrite is installed.
+ */
+void esp_netif_flow_cache_learn(esp_netif_t *esp_netif, struct pbuf *p);
+
+/**
+ * @brief Drop cached flows and learn candidates of an interface
+ *
+ * Called when an interface goes down or is removed. Passing NULL flushes
+ * the whole cache.
+ */
+void esp_netif_flow_cache_flush(esp_netif_t *esp_netif);
+
+#endif // _ESP_NETIF_FLOW_CACHE_H_
@@ -53,6 +53,9 @@
 #if IP_NAPT
 #include "lwip/lwip_napt.h"
 #endif
+#if CONFIG_ESP_NETIF_FLOW_CACHE
+#include "esp_netif_flow_cache.h"
+#endif
 
 
 //
@@ -855,6 +858,9 @@ esp_netif_t *esp_netif_find_if(esp_netif_find_predicate_t fn, void *ctx)
 
 static void esp_netif_lwip_remove(esp_netif_t *esp_netif)
 {
+#if CONFIG_ESP_NETIF_FLOW_CACHE
+    esp_netif_flow_cache_flush(esp_netif);
+#endif
     if (esp_netif->lwip_netif) {
         if (netif_is_up(esp_netif->lwip_netif)) {
             netif_set_down(esp_netif->lwip_netif);
@@ -1788,6 +1794,10 @@ static esp_err_t esp_netif_down_api(esp_netif_api_msg_t *msg)
     netif_set_down(lwip_netif);
     netif_set_link_down(lwip_netif);
 
+#if CONFIG_ESP_NETIF_FLOW_CACHE
+    esp_netif_flow_cache_flush(esp_netif);
+#endif
+
     if (esp_netif->flags & ESP_NETIF_DHCP_CLIENT) {
 #if CONFIG_LWIP_IPV4
         esp_netif_start_ip_lost_timer(esp_netif);
@@ -4,11 +4,13 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <sys/time.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
 #include "esp_event.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_timer.h"
 #include "esp_netif.h"
 #include "esp_netif_sntp.h"
 #include "esp_sntp.h"
@@ -19,10 +21,22 @@
 
 static const char *TAG = "esp_netif_sntp";
 
+// Fast converge mode: number of burst samples and their spacing.
+// 2s spacing follows ntpd's iburst convention; the one-time burst is exempt
+// from the 15s minimum that applies to the periodic poll interval.
+#define SNTP_FAST_CONVERGE_SAMPLES      6
+#define SNTP_FAST_CONVERGE_INTERVAL_MS  2000
+
 typedef struct sntp_storage {
     esp_sntp_time_cb_t sync_cb;
     SemaphoreHandle_t sync_sem;
     ip_event_t ip_event_to_renew;
+    bool smooth_sync;
+    bool fast_converge;
+    uint8_t burst_left;
+    uint8_t burst_count;
+    int64_t burst_samples[SNTP_FAST_CONVERGE_SAMPLES];
+    esp_timer_handle_t burst_timer;
     size_t index_of_first_server;
     size_t num_of_servers;
     char* servers[];
@@ -30,13 +44,65 @@ typedef struct sntp_storage {
 
 static sntp_storage_t *s_storage = NULL;
 
+static void burst_timer_cb(void *arg)
+{
+    sntp_restart();
+}
+
+// Average the burst offsets with the extreme samples rejected: with the
+// clock slewing (not stepping) during the burst, each sample is dominated
+// by the network jitter of its own round trip, so dropping the min/max and
+// averaging the rest suppresses delayed-packet outliers.
+static int64_t burst_offset_average(int64_t *samples, size_t count)
+{
+    for (size_t i = 1; i < count; i++) {
+        int64_t key = samples[i];
+        size_t j = i;
+        while (j > 0 && samples[j - 1] > key) {
+            samples[j] = samples[j - 1];
+            j--;
+        }
+        samples[j] = key;
+    }
+    int64_t sum = 0;
+    for (size_t i = 1; i < count - 1; i++) {
+        sum += samples[i];
+    }
+    return sum / (int64_t)(count - 2);
+}
+
 static void sync_time_cb(struct timeval *tv)
 {
-    if (s_storage && s_storage->sync_sem) {
-        xSemaphoreGive(s_storage->sync_sem);
+    sntp_storage_t *storage = s_storage;
+    if (storage == NULL) {
+        return;
+    }
+    if (storage->burst_left > 0) {
+        // burst runs in smooth mode, so lwip has just handed this sample to
+        // adjtime() (or stepped the clock if the error was too large for a
+        // slew); the pending correction is the offset this sample measured
+        struct timeval outdelta = { 0 };
+        adjtime(NULL, &outdelta);
+        storage->burst_samples[storage->burst_count++] = (int64_t)outdelta.tv_sec * 1000000L + outdelta.tv_usec;
+        if (--storage->burst_left > 0) {
+            esp_timer_start_once(storage->burst_timer, SNTP_FAST_CONVERGE_INTERVAL_MS * 1000LL);
+            return; // sync is signalled once the burst completes
+        }
+        // burst complete: replace the last single-sample correction with the
+        // outlier-rejected average and return to the configured sync mode
+        int64_t offset = burst_offset_average(storage->burst_samples, storage->burst_count);
+        struct timeval avg = { .tv_sec = offset / 1000000L, .tv_usec = offset % 1000000L };
+        adjtime(&avg, NULL);
+        ESP_LOGD(TAG, "fast converge complete, residual offset %lld us", (long long)offset);
+        if (!storage->smooth_sync) {
+            sntp_set_sync_mode(SNTP_SYNC_MODE_IMMED);
+        }
+    }
+    if (storage->sync_sem) {
+        xSemaphoreGive(storage->sync_sem);
     }
-    if (s_storage && s_storage->sync_cb) {
-        s_storage->sync_cb(tv);
+    if (storage->sync_cb) {
+        storage->sync_cb(tv);
     }
 }
 
@@ -62,7 +128,9 @@ static esp_err_t sntp_init_api(void *ctx)
 #endif
     }
 
-    if (config->smooth_sync) {
+    if (config->smooth_sync || config->fast_converge) {
+        // fast converge collects its burst in smooth mode, so the samples are
+        // slewed rather than stepped and stay comparable to each other
         sntp_set_sync_mode(SNTP_SYNC_MODE_SMOOTH);
     }
 
@@ -115,6 +183,16 @@ esp_err_t esp_netif_sntp_init(const esp_sntp_config_t * config)
     if (config->sync_cb) {
         s_storage->sync_cb = config->sync_cb;
     }
+    s_storage->smooth_sync = config->smooth_sync;
+    if (config->fast_converge) {
+        const esp_timer_create_args_t timer_args = {
+            .callback = burst_timer_cb,
+            .name = "sntp_burst",
+        };
+        ESP_GOTO_ON_ERROR(esp_timer_create(&timer_args, &s_storage->burst_timer), err, TAG, "Failed to create SNTP burst timer");
+        s_storage->fast_converge = true;
+        s_storage->burst_left = SNTP_FAST_CONVERGE_SAMPLES;
+    }
 
     ESP_GOTO_ON_ERROR(esp_netif_tcpip_exec(sntp_init_api, (void*)config), err, TAG, "Failed initialize SNTP service");
 
@@ -138,6 +216,10 @@ void esp_netif_sntp_deinit(void)
         s_storage = NULL;
         sntp_set_time_sync_notification_cb(NULL);
         esp_netif_tcpip_exec(sntp_stop_api, NULL);
+        if (storage->burst_timer) {
+            esp_timer_stop(storage->burst_timer);
+            esp_timer_delete(storage->burst_timer);
+        }
         if (storage->num_of_servers) {
             for (int i = 0; i < storage->num_of_servers; ++i) {
                 free(storage->servers[i]);
@@ -176,6 +258,13 @@ static esp_err_t sntp_start_api(void* ctx)
 
 esp_err_t esp_netif_sntp_start(void)
 {
+    if (s_storage && s_storage->fast_converge) {
+        // re-arm the converge burst, e.g. after wake from sleep
+        esp_timer_stop(s_storage->burst_timer);
+        s_storage->burst_left = SNTP_FAST_CONVERGE_SAMPLES;
+        s_storage->burst_count = 0;
+        sntp_set_sync_mode(SNTP_SYNC_MODE_SMOOTH);
+    }
     return esp_netif_tcpip_exec(sntp_start_api, NULL);
 }
 
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: 2021-2022 Espressif Systems (Shanghai) CO LTD
+ * SPDX-FileCopyrightText: 2021-2025 Espressif Systems (Shanghai) CO LTD
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -12,6 +12,7 @@
 #include "lwip/mem.h"
 #include "lwip/esp_pbuf_ref.h"
 #include "esp_netif_net_stack.h"
+#include "freertos/FreeRTOS.h"
 
 /**
  * @brief Specific pbuf structure for pbufs allocated by ESP netif
@@ -22,8 +23,22 @@ typedef struct esp_custom_pbuf
     struct pbuf_custom p;
     esp_netif_t *esp_netif;
     void* l2_buf;
+    struct esp_custom_pbuf *next_free;  /*!< next entry while cached on the free list */
 } esp_custom_pbuf_t;
 
+/**
+ * Freed wrappers are kept on a small free list instead of being returned to
+ * the heap, so that the steady-state receive path (one wrapper allocated per
+ * frame, freed once the socket layer consumed it) does not pay for a
+ * mem_malloc()/mem_free() pair per packet. The list is bounded, anything
+ * beyond the cap goes back to the heap.
+ */
+#define ESP_PBUF_CACHE_MAX_LEN  16
+
+static esp_custom_pbuf_t *s_esp_pbuf_cache;
+static uint32_t s_esp_pbuf_cache_len;
+static portMUX_TYPE s_esp_pbuf_cache_lock = portMUX_INITIALIZER_UNLOCKED;
+
 /**
  * @brief Free custom pbuf containing the L2 layer buffer allocated in the driver
  *
@@ -34,7 +49,17 @@ static void esp_pbuf_free(struct pbuf *pbuf)
 {
     esp_custom_pbuf_t* esp_pbuf = (esp_custom_pbuf_t*)pbuf;
     esp_netif_free_rx_buffer(esp_pbuf->esp_netif, esp_pbuf->l2_buf);
-    mem_free(pbuf);
+    portENTER_CRITICAL(&s_esp_pbuf_cache_lock);
+    if (s_esp_pbuf_cache_len < ESP_PBUF_CACHE_MAX_LEN) {
+        esp_pbuf->next_free = s_esp_pbuf_cache;
+        s_esp_pbuf_cache = esp_pbuf;
+        s_esp_pbuf_cache_len++;
+        esp_pbuf = NULL;
+    }
+    portEXIT_CRITICAL(&s_esp_pbuf_cache_lock);
+    if (esp_pbuf) {
+        mem_free(esp_pbuf);
+    }
 }
 
 /**
@@ -49,9 +74,18 @@ struct pbuf* esp_pbuf_allocate(esp_netif_t *esp_netif, void *buffer, size_t len,
 {
     struct pbuf *p;
 
-    esp_custom_pbuf_t* esp_pbuf  = mem_malloc(sizeof(esp_custom_pbuf_t));
+    portENTER_CRITICAL(&s_esp_pbuf_cache_lock);
+    esp_custom_pbuf_t* esp_pbuf = s_esp_pbuf_cache;
+    if (esp_pbuf) {
+        s_esp_pbuf_cache = esp_pbuf->next_free;
+        s_esp_pbuf_cache_len--;
+    }
+    portEXIT_CRITICAL(&s_esp_pbuf_cache_lock);
     if (esp_pbuf == NULL) {
-        return NULL;
+        esp_pbuf = mem_malloc(sizeof(esp_custom_pbuf_t));
+        if (esp_pbuf == NULL) {
+            return NULL;
+        }
     }
     esp_pbuf->p.custom_free_function = esp_pbuf_free;
     esp_pbuf->esp_netif = esp_netif;
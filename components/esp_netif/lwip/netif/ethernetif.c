@@ -23,6 +23,12 @@
 #include "esp_netif_net_stack.h"
 #include "lwip/esp_netif_net_stack.h"
 #include "lwip/esp_pbuf_ref.h"
+#if CONFIG_ESP_NETIF_FLOW_CACHE
+#include "esp_netif_flow_cache.h"
+#endif
+#if CONFIG_LWIP_RX_PREPROCESS
+#include "esp_rx_preprocess.h"
+#endif
 
 /* Define those to better describe your network interface. */
 #define IFNAME0 'e'
@@ -57,6 +63,16 @@ static void ethernet_low_level_init(struct netif *netif)
     netif->flags |= NETIF_FLAG_MLD6;
 #endif
 #endif
+
+#if CONFIG_ETH_EMAC_CHECKSUM_OFFLOAD && LWIP_CHECKSUM_CTRL_PER_NETIF
+    /* The EMAC inserts IP/TCP/UDP/ICMP checksums on transmit and drops received
+     * frames whose checksums are invalid, so software checksums for these
+     * protocols are redundant on this interface. ICMPv6 stays in software. */
+    NETIF_SET_CHECKSUM_CTRL(netif, NETIF_CHECKSUM_ENABLE_ALL &
+            ~(NETIF_CHECKSUM_GEN_IP | NETIF_CHECKSUM_GEN_UDP | NETIF_CHECKSUM_GEN_TCP |
+              NETIF_CHECKSUM_GEN_ICMP | NETIF_CHECKSUM_CHECK_IP | NETIF_CHECKSUM_CHECK_UDP |
+              NETIF_CHECKSUM_CHECK_TCP | NETIF_CHECKSUM_CHECK_ICMP));
+#endif
 }
 
 /**
@@ -81,6 +97,9 @@ static err_t ethernet_low_level_output(struct netif *netif, struct pbuf *p)
     }
 
     if (q->next == NULL) {
+#if CONFIG_ESP_NETIF_FLOW_CACHE
+        esp_netif_flow_cache_learn(esp_netif, q);
+#endif
         ret = esp_netif_transmit(esp_netif, q->payload, q->len);
     } else {
         LWIP_DEBUGF(PBUF_DEBUG, ("low_level_output: pbuf is a list, application may has bug"));
@@ -129,14 +148,29 @@ esp_netif_recv_ret_t ethernetif_input(void *h, void *buffer, size_t len, void *l
         return ESP_NETIF_OPTIONAL_RETURN_CODE(ESP_FAIL);
     }
 
+#if CONFIG_ESP_NETIF_FLOW_CACHE
+    if (esp_netif_flow_cache_input(esp_netif, buffer, len)) {
+        /* forwarded on the fast path, the frame never enters lwIP */
+        esp_netif_free_rx_buffer(esp_netif, buffer);
+        return ESP_NETIF_OPTIONAL_RETURN_CODE(ESP_OK);
+    }
+#endif
+
     /* allocate custom pbuf to hold  */
     p = esp_pbuf_allocate(esp_netif, buffer, len, buffer);
     if (p == NULL) {
         esp_netif_free_rx_buffer(esp_netif, buffer);
         return ESP_NETIF_OPTIONAL_RETURN_CODE(ESP_ERR_NO_MEM);
     }
+#if CONFIG_ESP_NETIF_FLOW_CACHE
+    esp_netif_flow_cache_note_input(esp_netif, p);
+#endif
     /* full packet send to tcpip_thread to process */
+#if CONFIG_LWIP_RX_PREPROCESS
+    if (unlikely(esp_rx_preprocess_input(p, netif) != ERR_OK)) {
+#else
     if (unlikely(netif->input(p, netif) != ERR_OK)) {
+#endif
         LWIP_DEBUGF(NETIF_DEBUG, ("ethernetif_input: IP input error\n"));
         pbuf_free(p);
         return ESP_NETIF_OPTIONAL_RETURN_CODE(ESP_FAIL);
@@ -25,6 +25,12 @@
 #include "esp_compiler.h"
 #include "lwip/esp_pbuf_ref.h"
 #include "esp_netif_types.h"
+#if CONFIG_ESP_NETIF_FLOW_CACHE
+#include "esp_netif_flow_cache.h"
+#endif
+#if CONFIG_LWIP_RX_PREPROCESS
+#include "esp_rx_preprocess.h"
+#endif
 
 /**
  * In this function, the hardware should be initialized.
@@ -89,6 +95,9 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
     err_t ret = ERR_IF;
 
     if(q->next == NULL) {
+#if CONFIG_ESP_NETIF_FLOW_CACHE
+        esp_netif_flow_cache_learn(esp_netif, q);
+#endif
         netif_ret = esp_netif_transmit_wrap(esp_netif, q->payload, q->len, q);
 
     } else {
@@ -156,6 +165,14 @@ esp_netif_recv_ret_t wlanif_input(void *h, void *buffer, size_t len, void* l2_bu
         return ESP_NETIF_OPTIONAL_RETURN_CODE(ESP_FAIL);
     }
 
+#if CONFIG_ESP_NETIF_FLOW_CACHE
+    if (esp_netif_flow_cache_input(esp_netif, buffer, len)) {
+        /* forwarded on the fast path, the frame never enters lwIP */
+        esp_netif_free_rx_buffer(esp_netif, l2_buff);
+        return ESP_NETIF_OPTIONAL_RETURN_CODE(ESP_OK);
+    }
+#endif
+
 #ifdef CONFIG_LWIP_L2_TO_L3_COPY
     p = pbuf_alloc(PBUF_RAW, len, PBUF_RAM);
     if (p == NULL) {
@@ -173,8 +190,16 @@ esp_netif_recv_ret_t wlanif_input(void *h, void *buffer, size_t len, void* l2_bu
 
 #endif
 
+#if CONFIG_ESP_NETIF_FLOW_CACHE
+    esp_netif_flow_cache_note_input(esp_netif, p);
+#endif
+
     /* full packet send to tcpip_thread to process */
+#if CONFIG_LWIP_RX_PREPROCESS
+    if (unlikely(esp_rx_preprocess_input(p, netif) != ERR_OK)) {
+#else
     if (unlikely(netif->input(p, netif) != ERR_OK)) {
+#endif
         LWIP_DEBUGF(NETIF_DEBUG, ("wlanif_input: IP input error\n"));
         pbuf_free(p);
         return ESP_NETIF_OPTIONAL_RETURN_CODE(ESP_FAIL);
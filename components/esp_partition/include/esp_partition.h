@@ -358,6 +358,44 @@ esp_err_t esp_partition_write_raw(const esp_partition_t* partition,
 esp_err_t esp_partition_erase_range(const esp_partition_t* partition,
                                     size_t offset, size_t size);
 
+/**
+ * @brief Completion callback of esp_partition_erase_range_async
+ *
+ * Invoked from the erase worker task (not from ISR context) once the whole
+ * range has been erased or the erase failed.
+ *
+ * @param err ESP_OK on success, otherwise the error of the failing sector erase
+ * @param arg User argument given to esp_partition_erase_range_async
+ */
+typedef void (*esp_partition_erase_cb_t)(esp_err_t err, void *arg);
+
+/**
+ * @brief Erase part of the partition in the background
+ *
+ * Queues the erase to a shared low-priority worker task and returns
+ * immediately. The worker erases the range one erase_size block at a time, so
+ * other flash users are not blocked for the duration of the whole range.
+ * Completion (or failure) is reported through the callback.
+ *
+ * Arguments and constraints are the same as for esp_partition_erase_range().
+ *
+ * @param partition Pointer to partition structure. Must be non-NULL.
+ * @param offset Offset from the beginning of partition where erase operation
+ *               should start. Must be aligned to partition->erase_size.
+ * @param size Size of the range which should be erased, in bytes.
+ *             Must be divisible by partition->erase_size.
+ * @param cb  Completion callback, may be NULL for fire-and-forget
+ * @param arg User argument passed to the callback
+ *
+ * @return ESP_OK, if the erase was queued successfully;
+ *         ESP_ERR_INVALID_ARG/ESP_ERR_INVALID_SIZE/ESP_ERR_NOT_ALLOWED for the
+ *         same conditions as esp_partition_erase_range();
+ *         ESP_ERR_NO_MEM, if the worker task or queue could not be created.
+ */
+esp_err_t esp_partition_erase_range_async(const esp_partition_t *partition,
+                                          size_t offset, size_t size,
+                                          esp_partition_erase_cb_t cb, void *arg);
+
 /**
  * @brief Configure MMU to map partition into data memory
  *
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file esp_partition_overlay.h
+ * @brief On-demand mapped const-data overlays
+ *
+ * On chips without PSRAM, the data-bus MMU window is too small to keep a whole
+ * asset partition mapped. The overlay manager maps fixed windows of a
+ * partition on demand, reference-counts them, and evicts the least recently
+ * used unreferenced window when the configured mapping budget is exceeded.
+ * Callers get plain const pointers and never copy asset data to RAM.
+ */
+
+/**
+ * @brief Opaque handle of an overlay manager
+ */
+typedef struct esp_partition_overlay_t *esp_partition_overlay_handle_t;
+
+/**
+ * @brief Create an overlay manager over a partition
+ *
+ * @param partition   Partition holding the const data (must stay valid while the manager exists)
+ * @param max_windows Maximum number of windows mapped at a time (>= 1)
+ * @param[out] out_handle Manager handle
+ *
+ * @return
+ *      - ESP_OK: success
+ *      - ESP_ERR_INVALID_ARG: null pointer or max_windows is 0
+ *      - ESP_ERR_NO_MEM: out of memory
+ */
+esp_err_t esp_partition_overlay_create(const esp_partition_t *partition, size_t max_windows,
+                                       esp_partition_overlay_handle_t *out_handle);
+
+/**
+ * @brief Acquire a pointer to a range of the partition
+ *
+ * Maps the containing window if it is not mapped yet, possibly evicting the
+ * least recently used unreferenced window first. The returned pointer stays
+ * valid until the matching esp_partition_overlay_release() call.
+ *
+ * @param handle  Manager handle
+ * @param offset  Offset of the range inside the partition
+ * @param size    Length of the range, in bytes
+ * @param[out] out_ptr Pointer to the mapped const data
+ *
+ * @return
+ *      - ESP_OK: success
+ *      - ESP_ERR_INVALID_ARG: null pointer or range outside the partition
+ *      - ESP_ERR_NO_MEM: all windows are referenced and no vaddr space is left
+ *      - or an error from the underlying esp_partition_mmap()
+ */
+esp_err_t esp_partition_overlay_acquire(esp_partition_overlay_handle_t handle,
+                                        size_t offset, size_t size, const void **out_ptr);
+
+/**
+ * @brief Release a pointer obtained from esp_partition_overlay_acquire()
+ *
+ * The window stays mapped until it is evicted to make room for another one.
+ *
+ * @param handle Manager handle
+ * @param ptr    Pointer previously returned by esp_partition_overlay_acquire()
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if ptr is not an acquired pointer
+ */
+esp_err_t esp_partition_overlay_release(esp_partition_overlay_handle_t handle, const void *ptr);
+
+/**
+ * @brief Delete an overlay manager, unmapping all windows
+ *
+ * All acquired pointers must have been released first.
+ *
+ * @param handle Manager handle
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if references are still held
+ */
+esp_err_t esp_partition_overlay_delete(esp_partition_overlay_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file esp_partition_stream.h
+ * @brief Double-buffered sequential partition reader
+ *
+ * The stream reader pipelines flash reads with the consumer: while the caller
+ * processes one chunk, a background filler task reads the next chunk into the
+ * second buffer. Chunks are handed to the caller by pointer, so the consumer
+ * side is zero-copy.
+ */
+
+/**
+ * @brief Opaque handle of a partition stream reader
+ */
+typedef struct esp_partition_stream_reader_t *esp_partition_stream_handle_t;
+
+/**
+ * @brief Configuration of a partition stream reader
+ */
+typedef struct {
+    size_t offset;          ///< Offset inside the partition to start reading at
+    size_t size;            ///< Total number of bytes to stream; 0 means "to the end of the partition"
+    size_t chunk_size;      ///< Size of each chunk handed to the caller; 0 selects the default (8 kB)
+    uint32_t task_priority; ///< Priority of the filler task; 0 selects one level above the caller
+} esp_partition_stream_config_t;
+
+/**
+ * @brief Open a stream reader over a partition
+ *
+ * Allocates two DMA-capable chunk buffers and starts the filler task, which
+ * immediately begins reading the first chunk.
+ *
+ * @param partition   Partition to read from (must stay valid while the stream is open)
+ * @param config      Stream configuration
+ * @param[out] out_handle  Handle to use with the other stream functions
+ *
+ * @return
+ *      - ESP_OK: success
+ *      - ESP_ERR_INVALID_ARG: null pointer, or offset/size beyond the partition
+ *      - ESP_ERR_NO_MEM: buffers or task could not be allocated
+ */
+esp_err_t esp_partition_stream_open(const esp_partition_t *partition,
+                                    const esp_partition_stream_config_t *config,
+                                    esp_partition_stream_handle_t *out_handle);
+
+/**
+ * @brief Get the next filled chunk
+ *
+ * Returns a pointer into an internal buffer holding the next `*out_len` bytes
+ * of the stream and releases the previously returned chunk for refill. The
+ * pointer stays valid until the next call on the same handle.
+ *
+ * @param handle      Stream handle
+ * @param[out] out_chunk  Filled with the chunk pointer
+ * @param[out] out_len    Filled with the chunk length; the final chunk may be short
+ *
+ * @return
+ *      - ESP_OK: a chunk is available
+ *      - ESP_ERR_NOT_FOUND: end of stream reached
+ *      - or an error code propagated from the underlying esp_partition_read()
+ */
+esp_err_t esp_partition_stream_read_next(esp_partition_stream_handle_t handle,
+                                         const void **out_chunk, size_t *out_len);
+
+/**
+ * @brief Close a stream reader and free its resources
+ *
+ * May be called at any point; an in-flight chunk read is completed first.
+ *
+ * @param handle Stream handle
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if handle is NULL
+ */
+esp_err_t esp_partition_stream_close(esp_partition_stream_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
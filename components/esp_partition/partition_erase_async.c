@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/lock.h>
+#include <sys/param.h>
+
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_partition.h"
+
+#define ERASE_WORKER_STACK_SIZE     3072
+#define ERASE_WORKER_PRIORITY       (tskIDLE_PRIORITY + 1)
+#define ERASE_WORKER_QUEUE_LEN      4
+
+static const char *TAG = "partition_async";
+
+typedef struct {
+    const esp_partition_t *partition;
+    size_t offset;
+    size_t size;
+    esp_partition_erase_cb_t cb;
+    void *arg;
+} erase_job_t;
+
+static QueueHandle_t s_erase_queue;
+static _lock_t s_erase_init_lock;
+
+static void s_erase_worker_task(void *arg)
+{
+    erase_job_t job;
+    while (true) {
+        xQueueReceive(s_erase_queue, &job, portMAX_DELAY);
+
+        // Erase one block at a time so other flash users can interleave
+        // between sector erases instead of waiting out the whole range.
+        esp_err_t err = ESP_OK;
+        size_t block = job.partition->erase_size;
+        for (size_t off = job.offset; off < job.offset + job.size && err == ESP_OK; off += block) {
+            err = esp_partition_erase_range(job.partition, off, block);
+        }
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "background erase of '%s' failed (0x%x)", job.partition->label, err);
+        }
+        if (job.cb) {
+            job.cb(err, job.arg);
+        }
+    }
+}
+
+static esp_err_t s_erase_worker_init(void)
+{
+    esp_err_t err = ESP_OK;
+    _lock_acquire(&s_erase_init_lock);
+    if (s_erase_queue == NULL) {
+        QueueHandle_t queue = xQueueCreate(ERASE_WORKER_QUEUE_LEN, sizeof(erase_job_t));
+        if (queue == NULL) {
+            err = ESP_ERR_NO_MEM;
+        } else if (xTaskCreate(s_erase_worker_task, "part_erase", ERASE_WORKER_STACK_SIZE,
+                               NULL, ERASE_WORKER_PRIORITY, NULL) != pdTRUE) {
+            vQueueDelete(queue);
+            err = ESP_ERR_NO_MEM;
+        } else {
+            s_erase_queue = queue;
+        }
+    }
+    _lock_release(&s_erase_init_lock);
+    return err;
+}
+
+esp_err_t esp_partition_erase_range_async(const esp_partition_t *partition,
+                                          size_t offset, size_t size,
+                                          esp_partition_erase_cb_t cb, void *arg)
+{
+    if (partition == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (offset > partition->size || offset % partition->erase_size != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (size > partition->size - offset || size % partition->erase_size != 0) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (partition->readonly) {
+        return ESP_ERR_NOT_ALLOWED;
+    }
+
+    esp_err_t err = s_erase_worker_init();
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    erase_job_t job = {
+        .partition = partition,
+        .offset = offset,
+        .size = size,
+        .cb = cb,
+        .arg = arg,
+    };
+    xQueueSend(s_erase_queue, &job, portMAX_DELAY);
+    return ESP_OK;
+}
@@ -20,6 +20,9 @@
 #include "esp_private/partition_linux.h"
 #include "esp_log.h"
 #include "spi_flash_mmap.h"
+#ifdef CONFIG_ESP_PARTITION_ENABLE_STATS
+#include "esp_linux_cost_model.h"
+#endif
 
 static const char *TAG = "linux_spiflash";
 
@@ -598,6 +601,7 @@ static void esp_partition_hook_read(const void *srcAddr, const size_t size)
     ++s_esp_partition_stat_read_ops;
     s_esp_partition_stat_read_bytes += size;
     s_esp_partition_stat_total_time += esp_partition_stat_time_interpolate((uint32_t) size, s_esp_partition_stat_read_times);
+    esp_linux_cost_model_charge("flash_read", size);
 }
 
 // Registers write access statistics of emulated SPI FLASH device (Linux host)
@@ -641,6 +645,7 @@ static bool esp_partition_hook_write(const void *dstAddr, size_t *size)
         ++s_esp_partition_stat_write_ops;
         s_esp_partition_stat_write_bytes += write_cycles * 4;
         s_esp_partition_stat_total_time += esp_partition_stat_time_interpolate((uint32_t) (*size), s_esp_partition_stat_write_times);
+        esp_linux_cost_model_charge("flash_write", *size);
     }
 
     return ret_val;
@@ -694,6 +699,7 @@ static bool esp_partition_hook_erase(const void *dstAddr, size_t *size)
         ++s_esp_partition_stat_erase_ops;
         s_esp_partition_stat_sector_erase_count[sector_index]++;
         s_esp_partition_stat_total_time += s_esp_partition_stat_block_erase_time;
+        esp_linux_cost_model_charge("flash_erase", ESP_PARTITION_EMULATED_SECTOR_SIZE);
     }
 
     return ret_val;
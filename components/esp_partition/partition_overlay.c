@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/lock.h>
+#include <sys/param.h>
+
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_partition_overlay.h"
+
+// Windows are aligned MMU-page-sized units, so evicting one frees exactly one
+// mapping worth of vaddr space.
+#define OVERLAY_WINDOW_SIZE     CONFIG_MMU_PAGE_SIZE
+
+static const char *TAG = "partition_overlay";
+
+typedef struct {
+    size_t window_idx;                  // partition offset / OVERLAY_WINDOW_SIZE
+    const void *ptr;                    // mapped vaddr of the window
+    esp_partition_mmap_handle_t mmap_handle;
+    int refs;                           // outstanding acquires
+    uint32_t last_use;                  // manager tick of the last acquire
+    bool mapped;
+} overlay_window_t;
+
+struct esp_partition_overlay_t {
+    const esp_partition_t *partition;
+    overlay_window_t *windows;          // max_windows entries
+    size_t max_windows;
+    uint32_t tick;                      // LRU clock
+    _lock_t lock;
+};
+
+esp_err_t esp_partition_overlay_create(const esp_partition_t *partition, size_t max_windows,
+                                       esp_partition_overlay_handle_t *out_handle)
+{
+    if (!partition || max_windows == 0 || !out_handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct esp_partition_overlay_t *mgr = calloc(1, sizeof(*mgr));
+    if (!mgr) {
+        return ESP_ERR_NO_MEM;
+    }
+    mgr->windows = calloc(max_windows, sizeof(overlay_window_t));
+    if (!mgr->windows) {
+        free(mgr);
+        return ESP_ERR_NO_MEM;
+    }
+    mgr->partition = partition;
+    mgr->max_windows = max_windows;
+
+    *out_handle = mgr;
+    return ESP_OK;
+}
+
+static esp_err_t s_window_map(struct esp_partition_overlay_t *mgr, overlay_window_t *win, size_t window_idx)
+{
+    size_t offset = window_idx * OVERLAY_WINDOW_SIZE;
+    size_t size = MIN((size_t)OVERLAY_WINDOW_SIZE, mgr->partition->size - offset);
+    esp_err_t err = esp_partition_mmap(mgr->partition, offset, size, ESP_PARTITION_MMAP_DATA,
+                                       &win->ptr, &win->mmap_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "mapping window %zu of '%s' failed (0x%x)", window_idx, mgr->partition->label, err);
+        return err;
+    }
+    win->window_idx = window_idx;
+    win->refs = 0;
+    win->mapped = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_overlay_acquire(esp_partition_overlay_handle_t mgr,
+                                        size_t offset, size_t size, const void **out_ptr)
+{
+    if (!mgr || !out_ptr || size == 0 || offset >= mgr->partition->size
+            || size > mgr->partition->size - offset) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    size_t window_idx = offset / OVERLAY_WINDOW_SIZE;
+    if (window_idx != (offset + size - 1) / OVERLAY_WINDOW_SIZE) {
+        // A range must fit one window; callers pack assets accordingly
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t err = ESP_OK;
+    _lock_acquire(&mgr->lock);
+    mgr->tick++;
+
+    // Hit on an already-mapped window?
+    overlay_window_t *victim = NULL;
+    overlay_window_t *win = NULL;
+    for (size_t i = 0; i < mgr->max_windows; i++) {
+        overlay_window_t *w = &mgr->windows[i];
+        if (w->mapped && w->window_idx == window_idx) {
+            win = w;
+            break;
+        }
+        if (!w->mapped) {
+            victim = w;                 // free slot, best victim
+        } else if (w->refs == 0 && (victim == NULL || (victim->mapped && w->last_use < victim->last_use))) {
+            victim = w;                 // LRU among unreferenced windows
+        }
+    }
+
+    if (win == NULL) {
+        if (victim == NULL) {
+            err = ESP_ERR_NO_MEM;       // every window is referenced
+            goto out;
+        }
+        if (victim->mapped) {
+            esp_partition_munmap(victim->mmap_handle);
+            victim->mapped = false;
+        }
+        err = s_window_map(mgr, victim, window_idx);
+        if (err != ESP_OK) {
+            goto out;
+        }
+        win = victim;
+    }
+
+    win->refs++;
+    win->last_use = mgr->tick;
+    *out_ptr = (const uint8_t *)win->ptr + (offset - window_idx * OVERLAY_WINDOW_SIZE);
+
+out:
+    _lock_release(&mgr->lock);
+    return err;
+}
+
+esp_err_t esp_partition_overlay_release(esp_partition_overlay_handle_t mgr, const void *ptr)
+{
+    if (!mgr || !ptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t err = ESP_ERR_INVALID_ARG;
+    _lock_acquire(&mgr->lock);
+    for (size_t i = 0; i < mgr->max_windows; i++) {
+        overlay_window_t *w = &mgr->windows[i];
+        if (w->mapped && w->refs > 0
+                && (const uint8_t *)ptr >= (const uint8_t *)w->ptr
+                && (const uint8_t *)ptr < (const uint8_t *)w->ptr + OVERLAY_WINDOW_SIZE) {
+            w->refs--;
+            err = ESP_OK;
+            break;
+        }
+    }
+    _lock_release(&mgr->lock);
+    return err;
+}
+
+esp_err_t esp_partition_overlay_delete(esp_partition_overlay_handle_t mgr)
+{
+    if (!mgr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    _lock_acquire(&mgr->lock);
+    for (size_t i = 0; i < mgr->max_windows; i++) {
+        if (mgr->windows[i].refs > 0) {
+            _lock_release(&mgr->lock);
+            return ESP_ERR_INVALID_STATE;
+        }
+    }
+    for (size_t i = 0; i < mgr->max_windows; i++) {
+        if (mgr->windows[i].mapped) {
+            esp_partition_munmap(mgr->windows[i].mmap_handle);
+        }
+    }
+    _lock_release(&mgr->lock);
+    _lock_close(&mgr->lock);
+    free(mgr->windows);
+    free(mgr);
+    return ESP_OK;
+}
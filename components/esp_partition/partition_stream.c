@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/param.h>
+
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_partition.h"
+#include "esp_partition_stream.h"
+
+#define STREAM_DEFAULT_CHUNK_SIZE   8192
+#define STREAM_FILLER_STACK_SIZE    3072
+
+static const char *TAG = "partition_stream";
+
+typedef struct {
+    uint8_t *data;          // DMA-capable chunk buffer
+    size_t len;             // valid bytes after a fill
+    esp_err_t err;          // result of the fill
+} stream_slot_t;
+
+struct esp_partition_stream_reader_t {
+    const esp_partition_t *partition;
+    size_t next_offset;     // partition offset of the next fill
+    size_t end_offset;      // offset one past the last byte to stream
+    size_t chunk_size;
+    stream_slot_t slots[2];
+    SemaphoreHandle_t slot_free;    // counting: slots the filler may write
+    SemaphoreHandle_t slot_ready;   // counting: slots the consumer may read
+    TaskHandle_t filler;
+    int fill_idx;           // next slot the filler writes
+    int read_idx;           // next slot the consumer reads
+    bool consumer_owns_slot;    // a chunk is currently handed out
+    volatile bool shutdown;
+    SemaphoreHandle_t filler_done;
+};
+
+static void s_stream_filler_task(void *arg)
+{
+    struct esp_partition_stream_reader_t *stream = arg;
+
+    while (true) {
+        xSemaphoreTake(stream->slot_free, portMAX_DELAY);
+        if (stream->shutdown || stream->next_offset >= stream->end_offset) {
+            break;
+        }
+        stream_slot_t *slot = &stream->slots[stream->fill_idx];
+        slot->len = MIN(stream->chunk_size, stream->end_offset - stream->next_offset);
+        slot->err = esp_partition_read(stream->partition, stream->next_offset, slot->data, slot->len);
+        stream->next_offset += slot->len;
+        stream->fill_idx ^= 1;
+        xSemaphoreGive(stream->slot_ready);
+    }
+
+    xSemaphoreGive(stream->filler_done);
+    vTaskDelete(NULL);
+}
+
+esp_err_t esp_partition_stream_open(const esp_partition_t *partition,
+                                    const esp_partition_stream_config_t *config,
+                                    esp_partition_stream_handle_t *out_handle)
+{
+    if (!partition || !config || !out_handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    size_t size = (config->size == 0) ? partition->size - config->offset : config->size;
+    if (config->offset >= partition->size || size > partition->size - config->offset) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct esp_partition_stream_reader_t *stream = calloc(1, sizeof(*stream));
+    if (!stream) {
+        return ESP_ERR_NO_MEM;
+    }
+    stream->partition = partition;
+    stream->next_offset = config->offset;
+    stream->end_offset = config->offset + size;
+    stream->chunk_size = (config->chunk_size == 0) ? STREAM_DEFAULT_CHUNK_SIZE : config->chunk_size;
+
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    for (int i = 0; i < 2; i++) {
+        stream->slots[i].data = heap_caps_malloc(stream->chunk_size, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+        if (!stream->slots[i].data) {
+            goto err;
+        }
+    }
+    stream->slot_free = xSemaphoreCreateCounting(2, 2);
+    stream->slot_ready = xSemaphoreCreateCounting(2, 0);
+    stream->filler_done = xSemaphoreCreateBinary();
+    if (!stream->slot_free || !stream->slot_ready || !stream->filler_done) {
+        goto err;
+    }
+
+    UBaseType_t prio = (config->task_priority != 0) ? config->task_priority
+                       : uxTaskPriorityGet(NULL) + 1;
+    if (xTaskCreate(s_stream_filler_task, "part_stream", STREAM_FILLER_STACK_SIZE,
+                    stream, prio, &stream->filler) != pdTRUE) {
+        goto err;
+    }
+
+    *out_handle = stream;
+    return ESP_OK;
+
+err:
+    for (int i = 0; i < 2; i++) {
+        free(stream->slots[i].data);
+    }
+    if (stream->slot_free) {
+        vSemaphoreDelete(stream->slot_free);
+    }
+    if (stream->slot_ready) {
+        vSemaphoreDelete(stream->slot_ready);
+    }
+    if (stream->filler_done) {
+        vSemaphoreDelete(stream->filler_done);
+    }
+    free(stream);
+    return ret;
+}
+
+esp_err_t esp_partition_stream_read_next(esp_partition_stream_handle_t stream,
+                                         const void **out_chunk, size_t *out_len)
+{
+    if (!stream || !out_chunk || !out_len) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (stream->consumer_owns_slot) {
+        // Hand the consumed slot back for refill before blocking on the next one
+        stream->consumer_owns_slot = false;
+        xSemaphoreGive(stream->slot_free);
+    }
+
+    // End of stream: the filler stops producing once next_offset hits the end,
+    // so don't block on slot_ready when nothing more is coming.
+    while (xSemaphoreTake(stream->slot_ready, 0) != pdTRUE) {
+        if (stream->next_offset >= stream->end_offset && uxSemaphoreGetCount(stream->slot_ready) == 0
+                && xSemaphoreTake(stream->slot_ready, pdMS_TO_TICKS(1)) != pdTRUE) {
+            return ESP_ERR_NOT_FOUND;
+        }
+    }
+
+    stream_slot_t *slot = &stream->slots[stream->read_idx];
+    stream->read_idx ^= 1;
+    if (slot->err != ESP_OK) {
+        ESP_LOGE(TAG, "chunk read failed (0x%x)", slot->err);
+        return slot->err;
+    }
+    stream->consumer_owns_slot = true;
+    *out_chunk = slot->data;
+    *out_len = slot->len;
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_stream_close(esp_partition_stream_handle_t stream)
+{
+    if (!stream) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    stream->shutdown = true;
+    xSemaphoreGive(stream->slot_free);      // wake the filler if it is blocked
+    xSemaphoreTake(stream->filler_done, portMAX_DELAY);
+
+    for (int i = 0; i < 2; i++) {
+        free(stream->slots[i].data);
+    }
+    vSemaphoreDelete(stream->slot_free);
+    vSemaphoreDelete(stream->slot_ready);
+    vSemaphoreDelete(stream->filler_done);
+    free(stream);
+    return ESP_OK;
+}
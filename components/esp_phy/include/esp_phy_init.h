@@ -192,6 +192,29 @@ void esp_btbb_enable(void);
  */
 void esp_btbb_disable(void);
 
+/**
+ * @brief Preload PHY calibration data from NVS ahead of PHY initialization
+ *
+ * Reading the calibration blob from NVS is the slowest part of
+ * esp_phy_load_cal_and_init(). Applications which care about time-to-first-packet
+ * can call this function during early boot (e.g. right after nvs_flash_init(),
+ * possibly from a core that is otherwise idle) so that the data is already in RAM
+ * by the time esp_wifi_init() initializes the PHY. esp_phy_load_cal_and_init()
+ * then consumes the preloaded copy instead of accessing NVS.
+ *
+ * Calling this function is optional; when it was not called (or failed), PHY
+ * initialization loads the calibration data from NVS as before.
+ *
+ * @return
+ *      - ESP_OK if the calibration data was preloaded
+ *      - ESP_ERR_NO_MEM if the preload buffer could not be allocated
+ *      - ESP_ERR_NOT_SUPPORTED if calibration data storage is disabled
+ *        (CONFIG_ESP_PHY_CALIBRATION_AND_DATA_STORAGE not set)
+ *      - others: NVS error while reading the stored calibration data; PHY
+ *        initialization will fall back to full calibration
+ */
+esp_err_t esp_phy_preload_cal(void);
+
 /**
  * @brief Load calibration data from NVS and initialize PHY and RF module
  */
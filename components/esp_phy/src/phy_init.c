@@ -803,6 +803,34 @@ static void __attribute((unused)) esp_phy_reduce_tx_power(esp_phy_init_data_t* i
 }
 #endif
 
+#ifdef CONFIG_ESP_PHY_CALIBRATION_AND_DATA_STORAGE
+// Calibration data read ahead of time by esp_phy_preload_cal(), consumed and
+// freed by esp_phy_load_cal_and_init()
+static esp_phy_calibration_data_t* s_preloaded_cal_data;
+static esp_err_t s_preloaded_cal_err;
+
+esp_err_t esp_phy_preload_cal(void)
+{
+    _lock_acquire(&s_phy_access_lock);
+    if (s_preloaded_cal_data == NULL) {
+        s_preloaded_cal_data = (esp_phy_calibration_data_t*) calloc(1, sizeof(esp_phy_calibration_data_t));
+        if (s_preloaded_cal_data == NULL) {
+            _lock_release(&s_phy_access_lock);
+            return ESP_ERR_NO_MEM;
+        }
+        s_preloaded_cal_err = esp_phy_load_cal_data_from_nvs(s_preloaded_cal_data);
+    }
+    esp_err_t err = s_preloaded_cal_err;
+    _lock_release(&s_phy_access_lock);
+    return err;
+}
+#else
+esp_err_t esp_phy_preload_cal(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+#endif
+
 void esp_phy_load_cal_and_init(void)
 {
     char * phy_version = get_phy_version_str();
@@ -860,7 +888,16 @@ void esp_phy_load_cal_and_init(void)
     if (esp_rom_get_reset_reason(0) == RESET_REASON_CORE_DEEP_SLEEP) {
         calibration_mode = PHY_RF_CAL_NONE;
     }
-    esp_err_t err = esp_phy_load_cal_data_from_nvs(cal_data);
+    esp_err_t err;
+    if (s_preloaded_cal_data != NULL) {
+        // Calibration data has already been read from NVS by esp_phy_preload_cal()
+        memcpy(cal_data, s_preloaded_cal_data, sizeof(*cal_data));
+        err = s_preloaded_cal_err;
+        free(s_preloaded_cal_data);
+        s_preloaded_cal_data = NULL;
+    } else {
+        err = esp_phy_load_cal_data_from_nvs(cal_data);
+    }
     if (err != ESP_OK) {
         ESP_LOGW(TAG, "failed to load RF calibration data (0x%x), falling back to full calibration", err);
         calibration_mode = PHY_RF_CAL_FULL;
@@ -177,6 +177,26 @@ esp_err_t esp_pm_lock_release(esp_pm_lock_handle_t handle);
  */
 esp_err_t esp_pm_lock_delete(esp_pm_lock_handle_t handle);
 
+/**
+ * @brief Set a CPU frequency floor applied while no lock demands maximum frequency
+ *
+ * The adaptive DFS governor (CONFIG_PM_ADAPTIVE_DFS) normally learns an
+ * intermediate frequency from the recent duty cycle of maximum-frequency
+ * demand. This function lets a task additionally pin an explicit floor: while
+ * set, the frequency used between bursts never goes below the given value,
+ * which avoids ramp-up latency for latency-sensitive periodic work without
+ * holding an ESP_PM_CPU_FREQ_MAX lock permanently.
+ *
+ * @param freq_mhz frequency floor in MHz (must be a frequency supported by the
+ *                 target and not above the configured maximum), or 0 to remove
+ *                 a previously set floor
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if the frequency is not supported
+ *      - ESP_ERR_NOT_SUPPORTED if CONFIG_PM_ADAPTIVE_DFS is not enabled in sdkconfig
+ */
+esp_err_t esp_pm_set_freq_floor(int freq_mhz);
+
 /**
  * Dump the list of all locks to stderr
  *
@@ -196,6 +216,53 @@ esp_err_t esp_pm_lock_delete(esp_pm_lock_handle_t handle);
  */
 esp_err_t esp_pm_dump_locks(FILE* stream);
 
+/**
+ * @brief Function prototype for the "lock held too long" callback
+ *
+ * @param handle  handle of the lock which exceeded the threshold
+ * @param name    name given to the lock in esp_pm_lock_create, may be NULL
+ * @param held_us how long the lock was held, in microseconds
+ * @param arg     user argument passed to esp_pm_lock_set_held_threshold
+ *
+ * @note The callback runs in the context which released the lock, which may be
+ *       an interrupt handler. It must not block.
+ */
+typedef void (*esp_pm_lock_held_cb_t)(esp_pm_lock_handle_t handle, const char* name, int64_t held_us, void* arg);
+
+/**
+ * Install a callback invoked whenever a PM lock is released after having been
+ * held longer than the given threshold
+ *
+ * Pass threshold_us == 0 or cb == NULL to remove a previously installed callback.
+ *
+ * @param threshold_us minimum hold duration which triggers the callback, in microseconds
+ * @param cb callback to invoke
+ * @param arg user argument passed to the callback
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_NOT_SUPPORTED if CONFIG_PM_TELEMETRY is not enabled in sdkconfig
+ */
+esp_err_t esp_pm_lock_set_held_threshold(int64_t threshold_us, esp_pm_lock_held_cb_t cb, void* arg);
+
+/**
+ * Dump the recorded PM lock telemetry in CSV form
+ *
+ * Prints the ring buffer of recent lock acquire/release events (one line per
+ * event: timestamp, lock name, lock type, operation, hold duration), followed
+ * by a per-lock summary including the cumulative time each lock was the last
+ * one preventing a transition to a lower power mode.
+ *
+ * This function must not be called from an ISR.
+ *
+ * @param stream stream to print information to; use stdout or stderr to print
+ *               to the console; use fmemopen/open_memstream to print to a
+ *               string buffer.
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_NOT_SUPPORTED if CONFIG_PM_TELEMETRY is not enabled in sdkconfig
+ */
+esp_err_t esp_pm_dump_telemetry(FILE* stream);
+
 #if CONFIG_PM_LIGHT_SLEEP_CALLBACKS
 /**
  * @brief Function prototype for light sleep callback functions (if CONFIG_FREERTOS_USE_TICKLESS_IDLE)
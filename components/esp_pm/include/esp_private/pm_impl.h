@@ -150,6 +150,15 @@ static inline pm_time_t IRAM_ATTR pm_get_time(void)
 {
     return esp_timer_get_time();
 }
+
+/**
+ * @brief Get the time of the most recent power mode change
+ *
+ * Used by the PM lock telemetry to attribute which lock kept the system in a
+ * higher power mode: when releasing a lock causes a mode change, the mode
+ * change time is updated to the release time.
+ */
+pm_time_t esp_pm_impl_get_mode_change_time(void);
 #endif // WITH_PROFILING
 
 #ifdef __cplusplus
@@ -169,6 +169,36 @@ static bool s_light_sleep_en = false;
  */
 static bool s_config_changed = false;
 
+#ifdef CONFIG_PM_ADAPTIVE_DFS
+/* Adaptive DFS governor state, protected by s_switch_lock.
+ *
+ * The governor watches how much of the time the system demands PM_MODE_CPU_MAX.
+ * When short bursts of maximum-frequency work recur quickly (e.g. periodic
+ * 1 kHz processing), dropping all the way to the minimum frequency between
+ * bursts just adds ramp-up latency on every burst. In that case the governor
+ * holds an intermediate frequency in the APB_MAX/APB_MIN modes instead.
+ */
+static pm_time_t s_dfs_burst_start;         // time PM_MODE_CPU_MAX was entered
+static pm_time_t s_dfs_last_burst_end;      // time PM_MODE_CPU_MAX was last left
+static uint32_t s_dfs_duty_ewma;            // EWMA of CPU_MAX duty cycle, Q16 fixed point
+static bool s_dfs_gov_floor_en;             // apply the learned intermediate frequency
+static rtc_cpu_freq_config_t s_dfs_mid_config;  // the intermediate frequency config
+static bool s_dfs_mid_valid;
+static rtc_cpu_freq_config_t s_dfs_user_floor_config;   // floor set with esp_pm_set_freq_floor
+static bool s_dfs_user_floor_en;
+static rtc_cpu_freq_config_t s_dfs_applied_config;  // frequency config currently applied by do_switch
+static bool s_dfs_applied_valid;
+
+/* Bursts recurring slower than this period do not feed the predictor (the work
+ * is not periodic enough to benefit from an intermediate frequency) */
+#define DFS_GOV_MAX_PERIOD_US   50000
+/* EWMA smoothing factor: 1/2^3 */
+#define DFS_GOV_EWMA_SHIFT      3
+/* Duty cycle thresholds (Q16) with hysteresis for raising/dropping the floor */
+#define DFS_GOV_DUTY_RAISE      (65536 / 4)
+#define DFS_GOV_DUTY_DROP       (65536 / 8)
+#endif // CONFIG_PM_ADAPTIVE_DFS
+
 #ifdef WITH_PROFILING
 /* Time, in microseconds, spent so far in each mode */
 static pm_time_t s_time_in_mode[PM_MODE_COUNT];
@@ -468,6 +498,22 @@ esp_err_t esp_pm_configure(const void* vconfig)
     assert(res);
     s_cpu_freq_by_mode[PM_MODE_LIGHT_SLEEP] = s_cpu_freq_by_mode[PM_MODE_APB_MIN];
 
+#ifdef CONFIG_PM_ADAPTIVE_DFS
+    /* Pick a supported intermediate frequency strictly between min and max for
+     * the governor to hold between bursts (e.g. 160 MHz for a 240/80 config) */
+    s_dfs_mid_valid = false;
+    const int mid_candidates_mhz[] = { max_freq_mhz / 2, 160, 80 };
+    for (size_t i = 0; i < sizeof(mid_candidates_mhz) / sizeof(mid_candidates_mhz[0]); i++) {
+        if (mid_candidates_mhz[i] > min_freq_mhz && mid_candidates_mhz[i] < max_freq_mhz &&
+                rtc_clk_cpu_freq_mhz_to_config(mid_candidates_mhz[i], &s_dfs_mid_config)) {
+            s_dfs_mid_valid = true;
+            break;
+        }
+    }
+    s_dfs_gov_floor_en = false;
+    s_dfs_duty_ewma = 0;
+#endif
+
     if (config->light_sleep_enable) {
         // Enable the wakeup source here because the `esp_sleep_disable_wakeup_source` in the `else`
         // branch must be called if corresponding wakeup source is already enabled.
@@ -485,6 +531,39 @@ esp_err_t esp_pm_configure(const void* vconfig)
     return ESP_OK;
 }
 
+#ifdef CONFIG_PM_ADAPTIVE_DFS
+esp_err_t esp_pm_set_freq_floor(int freq_mhz)
+{
+    rtc_cpu_freq_config_t floor_config;
+    if (freq_mhz != 0) {
+        if (!rtc_clk_cpu_freq_mhz_to_config(freq_mhz, &floor_config)) {
+            ESP_LOGW(TAG, "invalid frequency floor value (%d)", freq_mhz);
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (floor_config.freq_mhz > s_cpu_freq_by_mode[PM_MODE_CPU_MAX].freq_mhz) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    portENTER_CRITICAL(&s_switch_lock);
+    if (freq_mhz == 0) {
+        s_dfs_user_floor_en = false;
+    } else {
+        s_dfs_user_floor_config = floor_config;
+        s_dfs_user_floor_en = true;
+    }
+    s_config_changed = true;
+    pm_mode_t mode = s_mode;
+    portEXIT_CRITICAL(&s_switch_lock);
+    do_switch(mode);
+    return ESP_OK;
+}
+#else
+esp_err_t esp_pm_set_freq_floor(int freq_mhz)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+#endif // CONFIG_PM_ADAPTIVE_DFS
+
 esp_err_t esp_pm_get_configuration(void* vconfig)
 {
     if (vconfig == NULL) {
@@ -547,6 +626,25 @@ void IRAM_ATTR esp_pm_impl_switch_mode(pm_mode_t mode,
         }
         s_last_mode_change_time = now;
 #endif // WITH_PROFILING
+#ifdef CONFIG_PM_ADAPTIVE_DFS
+        if (s_mode != PM_MODE_CPU_MAX && new_mode == PM_MODE_CPU_MAX) {
+            s_dfs_burst_start = now;
+        } else if (s_mode == PM_MODE_CPU_MAX && new_mode != PM_MODE_CPU_MAX) {
+            pm_time_t period = now - s_dfs_last_burst_end;
+            if (period > 0 && period <= DFS_GOV_MAX_PERIOD_US) {
+                uint32_t duty = (uint32_t) MIN(((now - s_dfs_burst_start) << 16) / period, 65536);
+                s_dfs_duty_ewma += ((int32_t) duty - (int32_t) s_dfs_duty_ewma) >> DFS_GOV_EWMA_SHIFT;
+            } else {
+                s_dfs_duty_ewma -= s_dfs_duty_ewma >> DFS_GOV_EWMA_SHIFT;
+            }
+            if (!s_dfs_gov_floor_en && s_dfs_mid_valid && s_dfs_duty_ewma >= DFS_GOV_DUTY_RAISE) {
+                s_dfs_gov_floor_en = true;
+            } else if (s_dfs_gov_floor_en && s_dfs_duty_ewma < DFS_GOV_DUTY_DROP) {
+                s_dfs_gov_floor_en = false;
+            }
+            s_dfs_last_burst_end = now;
+        }
+#endif // CONFIG_PM_ADAPTIVE_DFS
     }
     portEXIT_CRITICAL_SAFE(&s_switch_lock);
     if (need_switch) {
@@ -554,6 +652,16 @@ void IRAM_ATTR esp_pm_impl_switch_mode(pm_mode_t mode,
     }
 }
 
+#ifdef WITH_PROFILING
+pm_time_t IRAM_ATTR esp_pm_impl_get_mode_change_time(void)
+{
+    portENTER_CRITICAL_SAFE(&s_switch_lock);
+    pm_time_t t = s_last_mode_change_time;
+    portEXIT_CRITICAL_SAFE(&s_switch_lock);
+    return t;
+}
+#endif // WITH_PROFILING
+
 /**
  * @brief Update clock dividers in esp_timer and FreeRTOS, and adjust CCOMPARE
  * values on both CPUs.
@@ -643,11 +751,29 @@ static void IRAM_ATTR do_switch(pm_mode_t new_mode)
     rtc_cpu_freq_config_t new_config = s_cpu_freq_by_mode[new_mode];
     rtc_cpu_freq_config_t old_config;
 
+#ifdef CONFIG_PM_ADAPTIVE_DFS
+    if (new_mode == PM_MODE_APB_MAX || new_mode == PM_MODE_APB_MIN) {
+        if (s_dfs_gov_floor_en && s_dfs_mid_valid && s_dfs_mid_config.freq_mhz > new_config.freq_mhz) {
+            new_config = s_dfs_mid_config;
+        }
+        if (s_dfs_user_floor_en && s_dfs_user_floor_config.freq_mhz > new_config.freq_mhz) {
+            new_config = s_dfs_user_floor_config;
+        }
+    }
+    /* The per-mode table no longer reflects the applied frequency exactly,
+     * so the previous frequency is tracked explicitly */
+    if (!config_changed && s_dfs_applied_valid) {
+        old_config = s_dfs_applied_config;
+    } else {
+        rtc_clk_cpu_freq_get_config(&old_config);
+    }
+#else
     if (!config_changed) {
         old_config = s_cpu_freq_by_mode[s_mode];
     } else {
         rtc_clk_cpu_freq_get_config(&old_config);
     }
+#endif // CONFIG_PM_ADAPTIVE_DFS
 
     if (new_config.freq_mhz != old_config.freq_mhz) {
         uint32_t old_ticks_per_us = old_config.freq_mhz;
@@ -679,6 +805,10 @@ static void IRAM_ATTR do_switch(pm_mode_t new_mode)
     portENTER_CRITICAL_ISR(&s_switch_lock);
     s_mode = new_mode;
     s_is_switching = false;
+#ifdef CONFIG_PM_ADAPTIVE_DFS
+    s_dfs_applied_config = new_config;
+    s_dfs_applied_valid = true;
+#endif
     portEXIT_CRITICAL_ISR(&s_switch_lock);
 }
 
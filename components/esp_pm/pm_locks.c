@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/lock.h>
+#include <sys/param.h>
 #include "esp_pm.h"
 #include "esp_system.h"
 #include "sys/queue.h"
@@ -30,6 +31,10 @@ typedef struct esp_pm_lock {
                                          If count > 0, this doesn't include the time since last_taken */
     size_t times_taken;             /*!< number of times the lock was ever taken */
 #endif
+#ifdef CONFIG_PM_TELEMETRY
+    pm_time_t time_blocking;        /*!< total time this lock was the last one preventing
+                                         a transition to a lower power mode */
+#endif
 } esp_pm_lock_t;
 
 
@@ -45,6 +50,42 @@ static SLIST_HEAD(esp_pm_locks_head, esp_pm_lock) s_list =
 /* Protects the above list */
 static _lock_t s_list_lock;
 
+#ifdef CONFIG_PM_TELEMETRY
+typedef struct {
+    pm_time_t time;                 /*!< time of the event */
+    pm_time_t held;                 /*!< hold duration, for release events */
+    const char* name;               /*!< lock name (may be NULL) */
+    uint8_t type;                   /*!< esp_pm_lock_type_t of the lock */
+    bool release;                   /*!< false: acquire, true: release */
+} pm_telemetry_event_t;
+
+/* Ring buffer of the most recent lock acquire/release events */
+static pm_telemetry_event_t s_telemetry_events[CONFIG_PM_TELEMETRY_EVENT_COUNT];
+static size_t s_telemetry_next;
+static bool s_telemetry_wrapped;
+static portMUX_TYPE s_telemetry_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static esp_pm_lock_held_cb_t s_held_cb;
+static void* s_held_cb_arg;
+static pm_time_t s_held_threshold_us;
+
+static void IRAM_ATTR pm_telemetry_record(const esp_pm_lock_t* lock, bool release, pm_time_t now, pm_time_t held)
+{
+    portENTER_CRITICAL_SAFE(&s_telemetry_mux);
+    pm_telemetry_event_t* evt = &s_telemetry_events[s_telemetry_next];
+    evt->time = now;
+    evt->held = held;
+    evt->name = lock->name;
+    evt->type = lock->type;
+    evt->release = release;
+    if (++s_telemetry_next == CONFIG_PM_TELEMETRY_EVENT_COUNT) {
+        s_telemetry_next = 0;
+        s_telemetry_wrapped = true;
+    }
+    portEXIT_CRITICAL_SAFE(&s_telemetry_mux);
+}
+#endif // CONFIG_PM_TELEMETRY
+
 
 esp_err_t esp_pm_lock_create(esp_pm_lock_type_t lock_type, int arg,
         const char* name, esp_pm_lock_handle_t* out_handle)
@@ -113,6 +154,9 @@ esp_err_t IRAM_ATTR esp_pm_lock_acquire(esp_pm_lock_handle_t handle)
 #ifdef WITH_PROFILING
         handle->last_taken = now;
         handle->times_taken++;
+#endif
+#ifdef CONFIG_PM_TELEMETRY
+        pm_telemetry_record(handle, false, now, 0);
 #endif
     }
     portEXIT_CRITICAL_SAFE(&handle->spinlock);
@@ -129,6 +173,9 @@ esp_err_t IRAM_ATTR esp_pm_lock_release(esp_pm_lock_handle_t handle)
         return ESP_ERR_INVALID_ARG;
     }
     esp_err_t ret = ESP_OK;
+#ifdef CONFIG_PM_TELEMETRY
+    pm_time_t held_us = -1;
+#endif
     portENTER_CRITICAL_SAFE(&handle->spinlock);
     if (handle->count == 0) {
         ret = ESP_ERR_INVALID_STATE;
@@ -139,11 +186,32 @@ esp_err_t IRAM_ATTR esp_pm_lock_release(esp_pm_lock_handle_t handle)
 #ifdef WITH_PROFILING
         now = pm_get_time();
         handle->time_held += now - handle->last_taken;
+#endif
+#ifdef CONFIG_PM_TELEMETRY
+        pm_time_t prev_change = esp_pm_impl_get_mode_change_time();
 #endif
         esp_pm_impl_switch_mode(handle->mode, MODE_UNLOCK, now);
+#ifdef CONFIG_PM_TELEMETRY
+        held_us = now - handle->last_taken;
+        if (esp_pm_impl_get_mode_change_time() == now) {
+            /* This release lowered the power mode, so since the later of
+             * (lock taken, mode entered) this lock was the only thing
+             * preventing the transition */
+            handle->time_blocking += now - MAX(prev_change, handle->last_taken);
+        }
+        pm_telemetry_record(handle, true, now, held_us);
+#endif
     }
 out:
     portEXIT_CRITICAL_SAFE(&handle->spinlock);
+#ifdef CONFIG_PM_TELEMETRY
+    if (ret == ESP_OK && held_us >= 0) {
+        esp_pm_lock_held_cb_t cb = s_held_cb;
+        if (cb != NULL && s_held_threshold_us > 0 && held_us >= s_held_threshold_us) {
+            (*cb)(handle, handle->name, held_us, s_held_cb_arg);
+        }
+    }
+#endif
     return ret;
 }
 
@@ -207,3 +275,81 @@ esp_err_t esp_pm_dump_locks(FILE* stream)
 #endif
     return ESP_OK;
 }
+
+#ifdef CONFIG_PM_TELEMETRY
+
+esp_err_t esp_pm_lock_set_held_threshold(int64_t threshold_us, esp_pm_lock_held_cb_t cb, void* arg)
+{
+    if (threshold_us < 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_telemetry_mux);
+    if (threshold_us == 0 || cb == NULL) {
+        s_held_cb = NULL;
+        s_held_cb_arg = NULL;
+        s_held_threshold_us = 0;
+    } else {
+        s_held_cb_arg = arg;
+        s_held_threshold_us = threshold_us;
+        s_held_cb = cb;
+    }
+    portEXIT_CRITICAL(&s_telemetry_mux);
+    return ESP_OK;
+}
+
+esp_err_t esp_pm_dump_telemetry(FILE* stream)
+{
+    /* Copy the ring buffer out under the lock, print without it */
+    static pm_telemetry_event_t events[CONFIG_PM_TELEMETRY_EVENT_COUNT];
+    portENTER_CRITICAL(&s_telemetry_mux);
+    size_t next = s_telemetry_next;
+    size_t count = s_telemetry_wrapped ? CONFIG_PM_TELEMETRY_EVENT_COUNT : next;
+    size_t first = s_telemetry_wrapped ? next : 0;
+    memcpy(events, s_telemetry_events, sizeof(events));
+    portEXIT_CRITICAL(&s_telemetry_mux);
+
+    fprintf(stream, "event,time_us,name,type,op,held_us\n");
+    for (size_t i = 0; i < count; i++) {
+        const pm_telemetry_event_t* evt = &events[(first + i) % CONFIG_PM_TELEMETRY_EVENT_COUNT];
+        fprintf(stream, "event,%lld,%s,%s,%s,%lld\n",
+                evt->time, evt->name ? evt->name : "-", s_lock_type_names[evt->type],
+                evt->release ? "release" : "acquire", evt->release ? evt->held : 0);
+    }
+
+    fprintf(stream, "lock,name,type,arg,times_taken,time_held_us,time_blocking_us\n");
+    _lock_acquire(&s_list_lock);
+    esp_pm_lock_t* it;
+    SLIST_FOREACH(it, &s_list, next) {
+        portENTER_CRITICAL(&it->spinlock);
+        size_t times_taken = it->times_taken;
+        pm_time_t time_held = it->time_held;
+        pm_time_t time_blocking = it->time_blocking;
+        if (it->count > 0) {
+            time_held += pm_get_time() - it->last_taken;
+        }
+        portEXIT_CRITICAL(&it->spinlock);
+        if (it->name != NULL) {
+            fprintf(stream, "lock,%s,", it->name);
+        } else {
+            fprintf(stream, "lock,lock@%p,", it);
+        }
+        fprintf(stream, "%s,%d,%d,%lld,%lld\n",
+                s_lock_type_names[it->type], it->arg, times_taken, time_held, time_blocking);
+    }
+    _lock_release(&s_list_lock);
+    return ESP_OK;
+}
+
+#else // CONFIG_PM_TELEMETRY
+
+esp_err_t esp_pm_lock_set_held_threshold(int64_t threshold_us, esp_pm_lock_held_cb_t cb, void* arg)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_pm_dump_telemetry(FILE* stream)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif // CONFIG_PM_TELEMETRY
@@ -0,0 +1,180 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_cpu.h"
+#include "esp_prof.h"
+#include "xtensa_perfmon_access.h"
+#include "sdkconfig.h"
+
+#if CONFIG_FREERTOS_NUMBER_OF_CORES > 1
+#include "esp_ipc.h"
+#endif
+
+typedef struct {
+    uint32_t count;
+    uint64_t cycles;
+    uint32_t cycles_min;
+    uint32_t cycles_max;
+    uint64_t pm[2];
+} prof_core_stats_t;
+
+typedef struct {
+    const char* name;
+    prof_core_stats_t core[CONFIG_FREERTOS_NUMBER_OF_CORES];
+} prof_region_t;
+
+static prof_region_t s_regions[CONFIG_ESP_PROF_MAX_REGIONS];
+static int s_region_count;
+static portMUX_TYPE s_registry_lock = portMUX_INITIALIZER_UNLOCKED;
+// one lock per core: exits only take the lock of the core they run on, so
+// the cores never contend with each other
+static portMUX_TYPE s_stats_lock[CONFIG_FREERTOS_NUMBER_OF_CORES] = {
+    [0 ... CONFIG_FREERTOS_NUMBER_OF_CORES - 1] = portMUX_INITIALIZER_UNLOCKED,
+};
+static volatile bool s_enabled;
+static esp_prof_config_t s_config;
+
+static void s_config_counters(void* arg)
+{
+    const esp_prof_config_t* config = (const esp_prof_config_t*) arg;
+    xtensa_perfmon_init(0, config->pm_select[0], config->pm_mask[0], 0, -1);
+    xtensa_perfmon_init(1, config->pm_select[1], config->pm_mask[1], 0, -1);
+    xtensa_perfmon_reset(0);
+    xtensa_perfmon_reset(1);
+    xtensa_perfmon_start();
+}
+
+esp_err_t esp_prof_init(const esp_prof_config_t* config)
+{
+    esp_prof_config_t default_config = ESP_PROF_DEFAULT_CONFIG();
+    s_config = (config != NULL) ? *config : default_config;
+    s_config_counters(&s_config);
+#if CONFIG_FREERTOS_NUMBER_OF_CORES > 1
+    for (int core = 0; core < CONFIG_FREERTOS_NUMBER_OF_CORES; ++core) {
+        if (core != esp_cpu_get_core_id()) {
+            esp_err_t err = esp_ipc_call_blocking(core, s_config_counters, &s_config);
+            if (err != ESP_OK) {
+                return err;
+            }
+        }
+    }
+#endif
+    s_enabled = true;
+    return ESP_OK;
+}
+
+void esp_prof_enable(void)
+{
+    s_enabled = true;
+}
+
+void esp_prof_disable(void)
+{
+    s_enabled = false;
+}
+
+void esp_prof_reset(void)
+{
+    portENTER_CRITICAL(&s_registry_lock);
+    for (int i = 0; i < s_region_count; ++i) {
+        memset(s_regions[i].core, 0, sizeof(s_regions[i].core));
+    }
+    portEXIT_CRITICAL(&s_registry_lock);
+}
+
+static int s_register_region(const char* name)
+{
+    int slot = -1;
+    portENTER_CRITICAL(&s_registry_lock);
+    for (int i = 0; i < s_region_count; ++i) {
+        if (s_regions[i].name == name || strcmp(s_regions[i].name, name) == 0) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0 && s_region_count < CONFIG_ESP_PROF_MAX_REGIONS) {
+        slot = s_region_count++;
+        s_regions[slot].name = name;
+    }
+    portEXIT_CRITICAL(&s_registry_lock);
+    return slot;
+}
+
+void esp_prof_enter(esp_prof_ctx_t* ctx, int* region_slot, const char* name)
+{
+    if (!s_enabled) {
+        ctx->region = -1;
+        return;
+    }
+    int slot = *region_slot;
+    if (slot < 0) {
+        slot = s_register_region(name);
+        *region_slot = slot;    // concurrent callers store the same value
+        if (slot < 0) {
+            ctx->region = -1;
+            return;
+        }
+    }
+    ctx->region = slot;
+    ctx->start_pm[0] = xtensa_perfmon_value(0);
+    ctx->start_pm[1] = xtensa_perfmon_value(1);
+    ctx->start_cycles = esp_cpu_get_cycle_count();
+}
+
+void esp_prof_exit(esp_prof_ctx_t* ctx)
+{
+    if (ctx->region < 0) {
+        return;
+    }
+    uint32_t cycles = esp_cpu_get_cycle_count() - ctx->start_cycles;
+    uint32_t pm0 = xtensa_perfmon_value(0) - ctx->start_pm[0];
+    uint32_t pm1 = xtensa_perfmon_value(1) - ctx->start_pm[1];
+    int core = esp_cpu_get_core_id();
+    prof_core_stats_t* stats = &s_regions[ctx->region].core[core];
+    portENTER_CRITICAL_SAFE(&s_stats_lock[core]);
+    stats->count++;
+    stats->cycles += cycles;
+    if (stats->count == 1 || cycles < stats->cycles_min) {
+        stats->cycles_min = cycles;
+    }
+    if (cycles > stats->cycles_max) {
+        stats->cycles_max = cycles;
+    }
+    stats->pm[0] += pm0;
+    stats->pm[1] += pm1;
+    portEXIT_CRITICAL_SAFE(&s_stats_lock[core]);
+}
+
+esp_err_t esp_prof_dump(FILE* stream)
+{
+    if (stream == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    fprintf(stream, "%-24s %4s %10s %12s %10s %10s %12s %12s\n",
+            "region", "core", "count", "cyc_avg", "cyc_min", "cyc_max",
+            "pm0_avg", "pm1_avg");
+    for (int i = 0; i < s_region_count; ++i) {
+        for (int core = 0; core < CONFIG_FREERTOS_NUMBER_OF_CORES; ++core) {
+            prof_core_stats_t stats;
+            portENTER_CRITICAL(&s_stats_lock[core]);
+            stats = s_regions[i].core[core];
+            portEXIT_CRITICAL(&s_stats_lock[core]);
+            if (stats.count == 0) {
+                continue;
+            }
+            fprintf(stream, "%-24s %4d %10" PRIu32 " %12llu %10" PRIu32 " %10" PRIu32 " %12llu %12llu\n",
+                    s_regions[i].name, core, stats.count,
+                    (unsigned long long) (stats.cycles / stats.count),
+                    stats.cycles_min, stats.cycles_max,
+                    (unsigned long long) (stats.pm[0] / stats.count),
+                    (unsigned long long) (stats.pm[1] / stats.count));
+        }
+    }
+    return ESP_OK;
+}
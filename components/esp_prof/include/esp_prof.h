@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include "esp_err.h"
+#include "xtensa/xt_perf_consts.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * Cycle-accurate region profiler built on the Xtensa performance monitor.
+ *
+ * ESP_PROF_SCOPE("name") records the CPU cycle count and two selectable PMU
+ * event counters (cache miss cycles and data stalls by default) on scope
+ * entry, and accumulates the deltas into a named-region statistics table on
+ * scope exit. Statistics are kept per core and updated under a per-core
+ * spinlock, so cores never contend with each other. While profiling is
+ * disabled with esp_prof_disable(), a scope costs a single branch.
+ */
+
+/**
+ * @brief Scope context, filled by esp_prof_enter() and consumed by esp_prof_exit()
+ */
+typedef struct {
+    int region;                 /*!< region table index, -1 if the scope is not recorded */
+    uint32_t start_cycles;      /*!< CPU cycle count at scope entry */
+    uint32_t start_pm[2];       /*!< PMU counter values at scope entry */
+} esp_prof_ctx_t;
+
+/**
+ * @brief Profiler configuration: the two PMU events recorded alongside cycles
+ */
+typedef struct {
+    uint16_t pm_select[2];      /*!< event selector per counter, XTPERF_CNT_* */
+    uint16_t pm_mask[2];        /*!< event mask per counter, XTPERF_MASK_* */
+} esp_prof_config_t;
+
+/**
+ * @brief Default configuration: data cache miss penalty and data stall cycles
+ */
+#define ESP_PROF_DEFAULT_CONFIG() { \
+    .pm_select = { XTPERF_CNT_DCACHE_MISSES, XTPERF_CNT_D_STALL }, \
+    .pm_mask = { XTPERF_MASK_DCACHE_MISSES, XTPERF_MASK_D_STALL_ALL }, \
+}
+
+/**
+ * @brief Profile the enclosing scope
+ *
+ * Records cycles and PMU events from this statement to the end of the
+ * enclosing block. The name should be a string literal. At most one
+ * ESP_PROF_SCOPE per block; nested blocks may each have their own.
+ */
+#define ESP_PROF_SCOPE(name) \
+    static int _esp_prof_slot = -1; \
+    __attribute__((cleanup(esp_prof_exit))) esp_prof_ctx_t _esp_prof_ctx; \
+    esp_prof_enter(&_esp_prof_ctx, &_esp_prof_slot, (name))
+
+/**
+ * @brief Initialize the profiler and configure the PMU counters
+ *
+ * Configures and starts PMU counters 0 and 1 on every core, and enables
+ * collection.
+ *
+ * @param config  events to record, or NULL for ESP_PROF_DEFAULT_CONFIG()
+ * @return
+ *      - ESP_OK on success
+ *      - one of the error codes from xtensa_perfmon_init()
+ */
+esp_err_t esp_prof_init(const esp_prof_config_t* config);
+
+/**
+ * @brief Resume collection after esp_prof_disable()
+ */
+void esp_prof_enable(void);
+
+/**
+ * @brief Pause collection; scopes reduce to a single branch
+ */
+void esp_prof_disable(void);
+
+/**
+ * @brief Clear the accumulated statistics of all regions
+ */
+void esp_prof_reset(void);
+
+/**
+ * @brief Enter a profiled region (used by ESP_PROF_SCOPE)
+ *
+ * @param ctx  scope context to fill
+ * @param region_slot  per-call-site cache of the region table index;
+ *                     initialize to -1
+ * @param name  region name, must outlive the profiler (string literal)
+ */
+void esp_prof_enter(esp_prof_ctx_t* ctx, int* region_slot, const char* name);
+
+/**
+ * @brief Leave a profiled region and accumulate the deltas (used by ESP_PROF_SCOPE)
+ *
+ * @param ctx  scope context filled by esp_prof_enter()
+ */
+void esp_prof_exit(esp_prof_ctx_t* ctx);
+
+/**
+ * @brief Print the per-region statistics to a stream
+ *
+ * One line per region and core: call count, average/min/max cycles and the
+ * two PMU event totals divided by the call count. The stream can be any
+ * VFS-backed FILE, including an app_trace file, so the data can leave the
+ * device without JTAG.
+ *
+ * @param stream  stream obtained using fopen or fdopen, or stdout
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if stream is NULL
+ */
+esp_err_t esp_prof_dump(FILE* stream);
+
+#ifdef __cplusplus
+}
+#endif
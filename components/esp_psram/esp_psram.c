@@ -15,12 +15,18 @@
 #include "sdkconfig.h"
 #include "esp_attr.h"
 #include "esp_err.h"
+#include "esp_check.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "esp_heap_caps_init.h"
 #include "hal/mmu_hal.h"
 #include "hal/mmu_ll.h"
 #include "hal/cache_ll.h"
+#include "hal/cache_hal.h"
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "soc/extmem_reg.h"
+#endif
 #include "soc/soc_caps.h"
 #include "esp_private/esp_psram_io.h"
 #include "esp_private/esp_psram_extram.h"
@@ -453,6 +459,41 @@ uint8_t esp_psram_io_get_cs_io(void)
     return esp_psram_impl_get_cs_io();
 }
 
+#if CONFIG_IDF_TARGET_ESP32S3
+/* Time when the cache access counters were last cleared */
+static int64_t s_bw_stats_clear_time;
+
+esp_err_t esp_psram_get_bw_stats(esp_psram_bw_stats_t *out_stats)
+{
+    ESP_RETURN_ON_FALSE(out_stats, ESP_ERR_INVALID_ARG, TAG, "null pointer");
+    out_stats->spiram_miss_count = REG_READ(EXTMEM_DBUS_ACS_SPIRAM_MISS_CNT_REG);
+    out_stats->dbus_access_count = REG_READ(EXTMEM_DBUS_ACS_CNT_REG);
+    /* Each miss fetches one data cache line from PSRAM */
+    uint32_t line_size = cache_hal_get_cache_line_size(CACHE_LL_LEVEL_EXT_MEM, CACHE_TYPE_DATA);
+    out_stats->spiram_bytes = (uint64_t)out_stats->spiram_miss_count * line_size;
+    out_stats->interval_us = esp_timer_get_time() - s_bw_stats_clear_time;
+    return ESP_OK;
+}
+
+esp_err_t esp_psram_clear_bw_stats(void)
+{
+    REG_WRITE(EXTMEM_CACHE_ACS_CNT_CLR_REG, EXTMEM_DCACHE_ACS_CNT_CLR | EXTMEM_ICACHE_ACS_CNT_CLR);
+    s_bw_stats_clear_time = esp_timer_get_time();
+    return ESP_OK;
+}
+#else
+esp_err_t esp_psram_get_bw_stats(esp_psram_bw_stats_t *out_stats)
+{
+    (void) out_stats;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t esp_psram_clear_bw_stats(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+#endif // CONFIG_IDF_TARGET_ESP32S3
+
 /*
  Simple RAM test. Writes a word every 32 bytes. Takes about a second to complete for 4MiB. Returns
  true when RAM seems OK, false when test fails. WARNING: Do not run this before the 2nd cpu has been
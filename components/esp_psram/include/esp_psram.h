@@ -41,6 +41,45 @@ bool esp_psram_is_initialized(void);
  */
 size_t esp_psram_get_size(void);
 
+/**
+ * @brief PSRAM bandwidth statistics, collected from the cache access counters
+ */
+typedef struct {
+    uint32_t spiram_miss_count;   /*!< Data cache misses served from PSRAM since the last clear */
+    uint64_t spiram_bytes;        /*!< Estimated bytes transferred from PSRAM (miss count * cache line size) */
+    uint32_t dbus_access_count;   /*!< Total data bus cache accesses since the last clear */
+    int64_t interval_us;          /*!< Time since the counters were last cleared, in microseconds */
+} esp_psram_bw_stats_t;
+
+/**
+ * @brief Read the PSRAM bandwidth statistics
+ *
+ * Samples the hardware cache access counters and reports how much traffic went
+ * to external RAM since the counters were last cleared, together with the
+ * elapsed time, so that average bandwidth can be computed
+ * (spiram_bytes / interval_us bytes per microsecond). Clear the counters with
+ * esp_psram_clear_bw_stats() at the start of the interval of interest.
+ *
+ * @note The hardware counters are 32 bit and wrap around; keep measurement
+ *       intervals short enough for the expected traffic.
+ *
+ * @param[out] out_stats Structure to fill with the statistics
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if out_stats is NULL
+ *      - ESP_ERR_NOT_SUPPORTED if the target has no cache access counters
+ */
+esp_err_t esp_psram_get_bw_stats(esp_psram_bw_stats_t *out_stats);
+
+/**
+ * @brief Clear the cache access counters used by esp_psram_get_bw_stats()
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_NOT_SUPPORTED if the target has no cache access counters
+ */
+esp_err_t esp_psram_clear_bw_stats(void);
+
 #ifdef __cplusplus
 }
 #endif
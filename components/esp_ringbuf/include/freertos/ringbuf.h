@@ -168,6 +168,39 @@ BaseType_t xRingbufferSendFromISR(RingbufHandle_t xRingbuffer,
                                   size_t xItemSize,
                                   BaseType_t *pxHigherPriorityTaskWoken);
 
+/**
+ * @brief   Descriptor of one item of a batched send, see xRingbufferSendBatchFromISR()
+ */
+typedef struct {
+    const void *pvItem;     /*!< Pointer to data to insert. NULL is allowed if xItemSize is 0 */
+    size_t xItemSize;       /*!< Size of data to insert */
+} RingbufferBatchItem_t;
+
+/**
+ * @brief       Insert multiple items into the ring buffer in an ISR under a single critical section
+ *
+ * Equivalent to calling xRingbufferSendFromISR() for each descriptor, but the
+ * spinlock is taken only once for the whole batch and waiting tasks (or the
+ * queue set) are notified only once, so the per-item locking and signalling
+ * overhead amortizes over the batch. Items are inserted in order until all
+ * are sent or one does not fit.
+ *
+ * @param[in]   xRingbuffer     Ring buffer to insert the items into
+ * @param[in]   pxItems         Array of item descriptors
+ * @param[in]   uxItemNum       Number of descriptors in pxItems
+ * @param[out]  puxItemsSent    Value pointed to is set to the number of items actually inserted. Can be NULL
+ * @param[out]  pxHigherPriorityTaskWoken   Value pointed to will be set to pdTRUE if the function woke up a higher priority task.
+ *
+ * @return
+ *      - pdTRUE if all items were inserted
+ *      - pdFALSE if the ring buffer ran out of space before the whole batch was inserted
+ */
+BaseType_t xRingbufferSendBatchFromISR(RingbufHandle_t xRingbuffer,
+                                       const RingbufferBatchItem_t *pxItems,
+                                       UBaseType_t uxItemNum,
+                                       UBaseType_t *puxItemsSent,
+                                       BaseType_t *pxHigherPriorityTaskWoken);
+
 /**
  * @brief Acquire memory from the ring buffer to be written to by an external
  *        source and to be sent later.
@@ -214,6 +247,52 @@ BaseType_t xRingbufferSendAcquire(RingbufHandle_t xRingbuffer, void **ppvItem, s
  */
 BaseType_t xRingbufferSendComplete(RingbufHandle_t xRingbuffer, void *pvItem);
 
+/**
+ * @brief   Acquire a region of a byte buffer for scatter-gather writing
+ *
+ * Reserves xSize bytes of a RINGBUF_TYPE_BYTEBUF buffer for direct writing by
+ * an external source (e.g. a DMA engine). Because the reservation may wrap
+ * around the end of the storage area it is returned as up to two contiguous
+ * regions. Once the data has been written, the reservation must be committed
+ * with xRingbufferSendCompleteBytes() before it becomes visible to readers.
+ * Only one reservation may be outstanding at a time, and no
+ * xRingbufferSend()/xRingbufferSendFromISR() calls may be made on the buffer
+ * while it is outstanding.
+ *
+ * @param[in]   xRingbuffer     Ring buffer of type RINGBUF_TYPE_BYTEBUF
+ * @param[out]  ppvHead         Set to the first contiguous region of the reservation
+ * @param[out]  pxHeadSize      Set to the size of the first region
+ * @param[out]  ppvTail         Set to the second (wrapped) region, or NULL if the reservation is contiguous
+ * @param[out]  pxTailSize      Set to the size of the second region, or 0
+ * @param[in]   xSize           Number of bytes to reserve
+ *
+ * @return
+ *      - pdTRUE if the reservation succeeded
+ *      - pdFALSE if the buffer does not currently have xSize bytes of free space
+ */
+BaseType_t xRingbufferSendAcquireBytes(RingbufHandle_t xRingbuffer,
+                                       void **ppvHead,
+                                       size_t *pxHeadSize,
+                                       void **ppvTail,
+                                       size_t *pxTailSize,
+                                       size_t xSize);
+
+/**
+ * @brief   Commit a reservation made with xRingbufferSendAcquireBytes()
+ *
+ * Makes the reserved bytes visible to readers and notifies a waiting reader
+ * (or the queue set) once.
+ *
+ * @param[in]   xRingbuffer     Ring buffer the reservation was made on
+ * @param[in]   xSize           Size of the reservation being committed. Must equal
+ *                              the xSize passed to xRingbufferSendAcquireBytes()
+ *
+ * @return
+ *      - pdTRUE if succeeded
+ *      - pdFALSE if xSize does not match the outstanding reservation
+ */
+BaseType_t xRingbufferSendCompleteBytes(RingbufHandle_t xRingbuffer, size_t xSize);
+
 /**
  * @brief   Retrieve an item from the ring buffer
  *
@@ -254,6 +333,30 @@ void *xRingbufferReceive(RingbufHandle_t xRingbuffer, size_t *pxItemSize, TickTy
  */
 void *xRingbufferReceiveFromISR(RingbufHandle_t xRingbuffer, size_t *pxItemSize);
 
+/**
+ * @brief   Retrieve multiple items from a no-split ring buffer under a single critical section
+ *
+ * Waits until at least one item is available (or the timeout expires), then
+ * retrieves as many further items as are immediately available, up to
+ * uxMaxItems, without releasing the spinlock in between. Each retrieved item
+ * must be returned individually with vRingbufferReturnItem() once processed.
+ *
+ * @note    This function is only applicable to buffers of type RINGBUF_TYPE_NOSPLIT
+ *
+ * @param[in]   xRingbuffer     Ring buffer to retrieve the items from
+ * @param[out]  pvItems         Array filled with pointers to the retrieved items
+ * @param[out]  pxItemSizes     Array filled with the sizes of the retrieved items
+ * @param[in]   uxMaxItems      Capacity of the pvItems/pxItemSizes arrays
+ * @param[in]   xTicksToWait    Ticks to wait for at least one item to become available
+ *
+ * @return Number of items retrieved, 0 on timeout
+ */
+UBaseType_t xRingbufferReceiveBatch(RingbufHandle_t xRingbuffer,
+                                    void **pvItems,
+                                    size_t *pxItemSizes,
+                                    UBaseType_t uxMaxItems,
+                                    TickType_t xTicksToWait);
+
 /**
  * @brief   Retrieve a split item from an allow-split ring buffer
  *
@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Single-producer single-consumer lock-free byte stream ring buffer
+ *
+ * Unlike the ring buffers of ringbuf.h, an SPSC ring buffer never takes a
+ * spinlock and never enters a critical section: the producer and the consumer
+ * each own one index and synchronize through C11 acquire/release atomics. The
+ * two indices live on separate cache lines so that cross-core streaming does
+ * not suffer from false sharing when the control block is placed in cached
+ * (external) memory.
+ *
+ * Restrictions compared to RINGBUF_TYPE_BYTEBUF:
+ *  - Exactly one producer context and one consumer context. The two may run
+ *    on different cores, and either side may be an ISR.
+ *  - No blocking calls and no queue set support. An optional wakeup is
+ *    provided through task notifications, see vRingbufferSPSCSetReceiveNotify().
+ *  - Data is a byte stream: send and receive sizes need not match.
+ */
+typedef struct RingbufferSPSCDefinition *RingbufSPSCHandle_t;
+
+/**
+ * @brief       Create an SPSC ring buffer
+ *
+ * The control block and the data buffer are allocated from internal memory.
+ * One byte of the buffer is reserved to distinguish full from empty, so the
+ * usable capacity is xBufferSize - 1 bytes.
+ *
+ * @param[in]   xBufferSize Size of the data buffer in bytes, must be >= 2
+ *
+ * @return  A handle to the created ring buffer, or NULL in case of error
+ */
+RingbufSPSCHandle_t xRingbufferSPSCCreate(size_t xBufferSize);
+
+/**
+ * @brief       Delete an SPSC ring buffer
+ *
+ * The buffer must not be in use by the producer or the consumer anymore.
+ *
+ * @param[in]   xRingbuffer Ring buffer to delete
+ */
+void vRingbufferSPSCDelete(RingbufSPSCHandle_t xRingbuffer);
+
+/**
+ * @brief       Write up to xSize bytes to the ring buffer (producer only)
+ *
+ * Copies as many bytes as currently fit. Never blocks.
+ *
+ * @param[in]   xRingbuffer Ring buffer to send to
+ * @param[in]   pvData      Bytes to copy
+ * @param[in]   xSize       Number of bytes to copy
+ *
+ * @return  Number of bytes actually copied, 0 when the buffer is full
+ */
+size_t xRingbufferSPSCSendUpTo(RingbufSPSCHandle_t xRingbuffer, const void *pvData, size_t xSize);
+
+/**
+ * @brief       Get the current contiguous writable region (producer only)
+ *
+ * Zero-copy variant of xRingbufferSPSCSendUpTo(): returns a pointer to the
+ * region the producer may fill directly (e.g. as a DMA target). Due to wrap
+ * around the region may be smaller than the total free space; commit and call
+ * again to use the remainder.
+ *
+ * @param[in]   xRingbuffer Ring buffer to write to
+ * @param[out]  ppvRegion   Set to the start of the writable region
+ *
+ * @return  Size of the writable region in bytes, 0 when the buffer is full
+ */
+size_t xRingbufferSPSCSendAcquire(RingbufSPSCHandle_t xRingbuffer, void **ppvRegion);
+
+/**
+ * @brief       Make bytes written into an acquired region visible (producer only)
+ *
+ * @param[in]   xRingbuffer Ring buffer written to
+ * @param[in]   xSize       Number of bytes filled, at most the region size
+ *                          returned by xRingbufferSPSCSendAcquire()
+ */
+void vRingbufferSPSCSendComplete(RingbufSPSCHandle_t xRingbuffer, size_t xSize);
+
+/**
+ * @brief       Read up to xSize bytes from the ring buffer (consumer only)
+ *
+ * Copies as many bytes as currently available. Never blocks; combine with
+ * vRingbufferSPSCSetReceiveNotify() and ulTaskNotifyTake() to wait for data
+ * without polling.
+ *
+ * @param[in]   xRingbuffer Ring buffer to receive from
+ * @param[out]  pvData      Destination buffer
+ * @param[in]   xSize       Destination buffer size in bytes
+ *
+ * @return  Number of bytes actually copied, 0 when the buffer is empty
+ */
+size_t xRingbufferSPSCReceiveUpTo(RingbufSPSCHandle_t xRingbuffer, void *pvData, size_t xSize);
+
+/**
+ * @brief       Get the current contiguous readable region (consumer only)
+ *
+ * Zero-copy variant of xRingbufferSPSCReceiveUpTo(). Due to wrap around the
+ * region may be smaller than the total number of pending bytes; return it and
+ * call again to read the remainder.
+ *
+ * @param[in]   xRingbuffer Ring buffer to read from
+ * @param[out]  ppvRegion   Set to the start of the readable region
+ *
+ * @return  Size of the readable region in bytes, 0 when the buffer is empty
+ */
+size_t xRingbufferSPSCReceiveAcquire(RingbufSPSCHandle_t xRingbuffer, void **ppvRegion);
+
+/**
+ * @brief       Return bytes of an acquired readable region (consumer only)
+ *
+ * @param[in]   xRingbuffer Ring buffer read from
+ * @param[in]   xSize       Number of bytes consumed, at most the region size
+ *                          returned by xRingbufferSPSCReceiveAcquire()
+ */
+void vRingbufferSPSCReceiveComplete(RingbufSPSCHandle_t xRingbuffer, size_t xSize);
+
+/**
+ * @brief       Register a task to notify when data arrives in an empty buffer
+ *
+ * When set, the producer gives a task notification (index 0, increment) each
+ * time a send makes the buffer transition from empty to non-empty. The
+ * consumer task can then wait with ulTaskNotifyTake() instead of polling. The
+ * notification is sent from the producer's context, so the producer side then
+ * does call into the scheduler on the empty-to-non-empty transitions only.
+ *
+ * @param[in]   xRingbuffer Ring buffer to configure
+ * @param[in]   xTask       Task to notify, or NULL to disable the wakeup
+ */
+void vRingbufferSPSCSetReceiveNotify(RingbufSPSCHandle_t xRingbuffer, TaskHandle_t xTask);
+
+/**
+ * @brief       Get the number of bytes currently stored (approximate)
+ *
+ * @param[in]   xRingbuffer Ring buffer to query
+ *
+ * @return  Number of bytes waiting to be received. Exact when called from the
+ *          consumer, a lower bound when called from the producer
+ */
+size_t xRingbufferSPSCGetWaiting(RingbufSPSCHandle_t xRingbuffer);
+
+/**
+ * @brief       Get the number of free bytes (approximate)
+ *
+ * @param[in]   xRingbuffer Ring buffer to query
+ *
+ * @return  Number of bytes that can currently be sent. Exact when called from
+ *          the producer, a lower bound when called from the consumer
+ */
+size_t xRingbufferSPSCGetFree(RingbufSPSCHandle_t xRingbuffer);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1090,6 +1090,171 @@ BaseType_t xRingbufferSendFromISR(RingbufHandle_t xRingbuffer,
     return xReturn;
 }
 
+BaseType_t xRingbufferSendBatchFromISR(RingbufHandle_t xRingbuffer,
+                                       const RingbufferBatchItem_t *pxItems,
+                                       UBaseType_t uxItemNum,
+                                       UBaseType_t *puxItemsSent,
+                                       BaseType_t *pxHigherPriorityTaskWoken)
+{
+    Ringbuffer_t *pxRingbuffer = (Ringbuffer_t *)xRingbuffer;
+    BaseType_t xNotifyQueueSet = pdFALSE;
+    UBaseType_t uxSent = 0;
+
+    //Check arguments
+    configASSERT(pxRingbuffer);
+    configASSERT(pxItems != NULL || uxItemNum == 0);
+
+    portENTER_CRITICAL_ISR(&pxRingbuffer->mux);
+    for (UBaseType_t i = 0; i < uxItemNum; i++) {
+        size_t xItemSize = pxItems[i].xItemSize;
+        configASSERT(pxItems[i].pvItem != NULL || xItemSize == 0);
+        if (xItemSize > pxRingbuffer->xMaxItemSize) {
+            break;      //This item will never ever fit
+        }
+        if ((pxRingbuffer->uxRingbufferFlags & rbBYTE_BUFFER_FLAG) && xItemSize == 0) {
+            uxSent++;   //Sending 0 bytes to byte buffer has no effect
+            continue;
+        }
+        if (pxRingbuffer->xCheckItemFits(pxRingbuffer, xItemSize) == pdFALSE) {
+            break;      //Out of space, stop here. Items are never inserted out of order
+        }
+        pxRingbuffer->vCopyItem(pxRingbuffer, pxItems[i].pvItem, xItemSize);
+        uxSent++;
+    }
+    //Notify once for the whole batch
+    if (uxSent > 0) {
+        if (pxRingbuffer->xQueueSet) {
+            //If ring buffer was added to a queue set, notify the queue set
+            xNotifyQueueSet = pdTRUE;
+        } else {
+            //If a task was waiting for data to arrive on the ring buffer, unblock it immediately.
+            if (listLIST_IS_EMPTY(&pxRingbuffer->xTasksWaitingToReceive) == pdFALSE) {
+                if (xTaskRemoveFromEventList(&pxRingbuffer->xTasksWaitingToReceive) == pdTRUE) {
+                    //The unblocked task will preempt us. Record that a context switch is required.
+                    if (pxHigherPriorityTaskWoken != NULL) {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+                }
+            }
+        }
+    }
+    portEXIT_CRITICAL_ISR(&pxRingbuffer->mux);
+    //Defer notifying the queue set until we are outside the critical section.
+    if (xNotifyQueueSet == pdTRUE) {
+        xQueueSendFromISR((QueueHandle_t)pxRingbuffer->xQueueSet, (QueueSetMemberHandle_t *)&pxRingbuffer, pxHigherPriorityTaskWoken);
+    }
+
+    if (puxItemsSent != NULL) {
+        *puxItemsSent = uxSent;
+    }
+    return (uxSent == uxItemNum) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xRingbufferSendAcquireBytes(RingbufHandle_t xRingbuffer,
+                                       void **ppvHead,
+                                       size_t *pxHeadSize,
+                                       void **ppvTail,
+                                       size_t *pxTailSize,
+                                       size_t xSize)
+{
+    Ringbuffer_t *pxRingbuffer = (Ringbuffer_t *)xRingbuffer;
+    BaseType_t xReturn = pdFALSE;
+
+    //Check arguments
+    configASSERT(pxRingbuffer && ppvHead && pxHeadSize && ppvTail && pxTailSize);
+    configASSERT(pxRingbuffer->uxRingbufferFlags & rbBYTE_BUFFER_FLAG);     //Only applicable to byte buffers
+
+    *ppvHead = NULL;
+    *ppvTail = NULL;
+    *pxHeadSize = 0;
+    *pxTailSize = 0;
+    if (xSize == 0 || xSize > pxRingbuffer->xSize) {
+        return pdFALSE;
+    }
+
+    portENTER_CRITICAL(&pxRingbuffer->mux);
+    /*
+     * Only one reservation may be outstanding: pucWrite tracking pucAcquire
+     * indicates that the previous reservation (if any) has been committed.
+     */
+    if (pxRingbuffer->pucWrite == pxRingbuffer->pucAcquire &&
+            prvCheckItemFitsByteBuffer(pxRingbuffer, xSize) == pdTRUE) {
+        size_t xRemLen = pxRingbuffer->pucTail - pxRingbuffer->pucAcquire;  //Length from pucAcquire until end of buffer
+        *ppvHead = pxRingbuffer->pucAcquire;
+        if (xRemLen >= xSize) {
+            //Reservation is contiguous
+            *pxHeadSize = xSize;
+            pxRingbuffer->pucAcquire += xSize;
+            //Wrap around pucAcquire if it reaches the end
+            if (pxRingbuffer->pucAcquire == pxRingbuffer->pucTail) {
+                pxRingbuffer->pucAcquire = pxRingbuffer->pucHead;
+            }
+        } else {
+            //Reservation wraps around, return it as two regions
+            *pxHeadSize = xRemLen;
+            *ppvTail = pxRingbuffer->pucHead;
+            *pxTailSize = xSize - xRemLen;
+            pxRingbuffer->pucAcquire = pxRingbuffer->pucHead + (xSize - xRemLen);
+        }
+        //Check if buffer is full
+        if (pxRingbuffer->pucAcquire == pxRingbuffer->pucFree) {
+            pxRingbuffer->uxRingbufferFlags |= rbBUFFER_FULL_FLAG;      //Mark the buffer as full to avoid confusion with an empty buffer
+        }
+        xReturn = pdTRUE;
+    }
+    portEXIT_CRITICAL(&pxRingbuffer->mux);
+    return xReturn;
+}
+
+BaseType_t xRingbufferSendCompleteBytes(RingbufHandle_t xRingbuffer, size_t xSize)
+{
+    Ringbuffer_t *pxRingbuffer = (Ringbuffer_t *)xRingbuffer;
+    BaseType_t xNotifyQueueSet = pdFALSE;
+    BaseType_t xReturn = pdFALSE;
+
+    //Check arguments
+    configASSERT(pxRingbuffer);
+    configASSERT(pxRingbuffer->uxRingbufferFlags & rbBYTE_BUFFER_FLAG);     //Only applicable to byte buffers
+
+    portENTER_CRITICAL(&pxRingbuffer->mux);
+    //Verify the commit matches the outstanding reservation
+    BaseType_t xDiff = pxRingbuffer->pucAcquire - pxRingbuffer->pucWrite;
+    BaseType_t xMatches;
+    if (xDiff != 0) {
+        size_t xOutstanding = (xDiff > 0) ? (size_t)xDiff : (size_t)(xDiff + pxRingbuffer->xSize);
+        xMatches = (xSize == xOutstanding) ? pdTRUE : pdFALSE;
+    } else {
+        //Reservation consumed all free space (buffer full flag set), or nothing is outstanding
+        xMatches = ((pxRingbuffer->uxRingbufferFlags & rbBUFFER_FULL_FLAG) && xSize > 0) || (xSize == 0);
+    }
+    if (xMatches == pdTRUE) {
+        //Make the reserved bytes visible to readers
+        pxRingbuffer->pucWrite = pxRingbuffer->pucAcquire;
+        pxRingbuffer->xItemsWaiting += xSize;
+        if (xSize > 0) {
+            if (pxRingbuffer->xQueueSet) {
+                //If ring buffer was added to a queue set, notify the queue set
+                xNotifyQueueSet = pdTRUE;
+            } else {
+                //If a task was waiting for data to arrive on the ring buffer, unblock it immediately.
+                if (listLIST_IS_EMPTY(&pxRingbuffer->xTasksWaitingToReceive) == pdFALSE) {
+                    if (xTaskRemoveFromEventList(&pxRingbuffer->xTasksWaitingToReceive) == pdTRUE) {
+                        //The unblocked task will preempt us. Trigger a yield here.
+                        portYIELD_WITHIN_API();
+                    }
+                }
+            }
+        }
+        xReturn = pdTRUE;
+    }
+    portEXIT_CRITICAL(&pxRingbuffer->mux);
+
+    if (xNotifyQueueSet == pdTRUE) {
+        xQueueSend((QueueHandle_t)pxRingbuffer->xQueueSet, (QueueSetMemberHandle_t *)&pxRingbuffer, 0);
+    }
+    return xReturn;
+}
+
 void *xRingbufferReceive(RingbufHandle_t xRingbuffer, size_t *pxItemSize, TickType_t xTicksToWait)
 {
     Ringbuffer_t *pxRingbuffer = (Ringbuffer_t *)xRingbuffer;
@@ -1122,6 +1287,65 @@ void *xRingbufferReceiveFromISR(RingbufHandle_t xRingbuffer, size_t *pxItemSize)
     }
 }
 
+UBaseType_t xRingbufferReceiveBatch(RingbufHandle_t xRingbuffer,
+                                    void **pvItems,
+                                    size_t *pxItemSizes,
+                                    UBaseType_t uxMaxItems,
+                                    TickType_t xTicksToWait)
+{
+    Ringbuffer_t *pxRingbuffer = (Ringbuffer_t *)xRingbuffer;
+    UBaseType_t uxReceived = 0;
+    BaseType_t xExitLoop = pdFALSE;
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+
+    //Check arguments
+    configASSERT(pxRingbuffer && pvItems && pxItemSizes);
+    //Only applicable to no-split buffers
+    configASSERT((pxRingbuffer->uxRingbufferFlags & (rbBYTE_BUFFER_FLAG | rbALLOW_SPLIT_FLAG)) == 0);
+
+    if (uxMaxItems == 0) {
+        return 0;
+    }
+
+    while (xExitLoop == pdFALSE) {
+        portENTER_CRITICAL(&pxRingbuffer->mux);
+        if (prvCheckItemAvail(pxRingbuffer) == pdTRUE) {
+            //At least one item is available. Retrieve all immediately available
+            //items without leaving the critical section.
+            BaseType_t xIsSplit = pdFALSE;
+            do {
+                pvItems[uxReceived] = pxRingbuffer->pvGetItem(pxRingbuffer, &xIsSplit, 0, &pxItemSizes[uxReceived]);
+                configASSERT(xIsSplit == pdFALSE);  //No-split buffers do not have split items
+                uxReceived++;
+            } while (uxReceived < uxMaxItems && prvCheckItemAvail(pxRingbuffer) == pdTRUE);
+            xExitLoop = pdTRUE;
+            goto loop_end;
+        } else if (xTicksToWait == (TickType_t) 0) {
+            //No block time. Return immediately.
+            xExitLoop = pdTRUE;
+            goto loop_end;
+        } else if (xEntryTimeSet == pdFALSE) {
+            //This is our first block. Set entry time
+            vTaskInternalSetTimeOutState(&xTimeOut);
+            xEntryTimeSet = pdTRUE;
+        }
+
+        if (xTaskCheckForTimeOut(&xTimeOut, &xTicksToWait) == pdFALSE) {
+            //Not timed out yet. Block the current task
+            vTaskPlaceOnEventList(&pxRingbuffer->xTasksWaitingToReceive, xTicksToWait);
+            portYIELD_WITHIN_API();
+        } else {
+            //We have timed out.
+            xExitLoop = pdTRUE;
+        }
+loop_end:
+        portEXIT_CRITICAL(&pxRingbuffer->mux);
+    }
+
+    return uxReceived;
+}
+
 BaseType_t xRingbufferReceiveSplit(RingbufHandle_t xRingbuffer,
                                    void **ppvHeadItem,
                                    void **ppvTailItem,
@@ -0,0 +1,264 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/ringbuf_spsc.h"
+#include "esp_heap_caps.h"
+
+// ------------------------------------------------- Macros and Types --------------------------------------------------
+
+/*
+ * The producer owns pucWriteIdx, the consumer owns pucReadIdx. Each side only
+ * ever stores to its own index (release) and loads the other side's index
+ * (acquire), so no lock is needed. The indices are kept on separate cache
+ * lines: when the control block ends up in cached memory, a producer store to
+ * its index must not invalidate the line holding the consumer's index.
+ */
+#define rbSPSC_CACHE_LINE_SIZE      32
+
+typedef struct RingbufferSPSCDefinition {
+    uint8_t *pucBuffer;                                             //Data buffer
+    size_t xSize;                                                   //Buffer size, usable capacity is xSize - 1
+    TaskHandle_t xReceiveNotifyTask;                                //Task notified on empty to non-empty transitions, or NULL
+    size_t xWriteIdx __attribute__((aligned(rbSPSC_CACHE_LINE_SIZE)));  //Next byte the producer will write, owned by the producer
+    size_t xReadIdx __attribute__((aligned(rbSPSC_CACHE_LINE_SIZE)));   //Next byte the consumer will read, owned by the consumer
+} RingbufferSPSC_t;
+
+// ------------------------------------------------ Static Functions ---------------------------------------------------
+
+static inline size_t prvSPSCNextIdx(const RingbufferSPSC_t *pxRingbuffer, size_t xIdx, size_t xOffset)
+{
+    xIdx += xOffset;
+    if (xIdx >= pxRingbuffer->xSize) {
+        xIdx -= pxRingbuffer->xSize;
+    }
+    return xIdx;
+}
+
+// ------------------------------------------------- Public Functions --------------------------------------------------
+
+RingbufSPSCHandle_t xRingbufferSPSCCreate(size_t xBufferSize)
+{
+    if (xBufferSize < 2) {
+        return NULL;
+    }
+
+    RingbufferSPSC_t *pxRingbuffer = heap_caps_calloc(1, sizeof(RingbufferSPSC_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (pxRingbuffer == NULL) {
+        return NULL;
+    }
+    pxRingbuffer->pucBuffer = heap_caps_malloc(xBufferSize, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (pxRingbuffer->pucBuffer == NULL) {
+        free(pxRingbuffer);
+        return NULL;
+    }
+    pxRingbuffer->xSize = xBufferSize;
+    return (RingbufSPSCHandle_t)pxRingbuffer;
+}
+
+void vRingbufferSPSCDelete(RingbufSPSCHandle_t xRingbuffer)
+{
+    RingbufferSPSC_t *pxRingbuffer = (RingbufferSPSC_t *)xRingbuffer;
+    if (pxRingbuffer != NULL) {
+        free(pxRingbuffer->pucBuffer);
+        free(pxRingbuffer);
+    }
+}
+
+size_t xRingbufferSPSCSendUpTo(RingbufSPSCHandle_t xRingbuffer, const void *pvData, size_t xSize)
+{
+    RingbufferSPSC_t *pxRingbuffer = (RingbufferSPSC_t *)xRingbuffer;
+    const uint8_t *pucData = (const uint8_t *)pvData;
+
+    configASSERT(pxRingbuffer && (pucData != NULL || xSize == 0));
+
+    size_t xWriteIdx = pxRingbuffer->xWriteIdx;     //Owned by us, plain load
+    size_t xReadIdx = __atomic_load_n(&pxRingbuffer->xReadIdx, __ATOMIC_ACQUIRE);
+
+    //Total free space, one byte is kept unused to distinguish full from empty
+    size_t xFree = (xReadIdx > xWriteIdx) ? (xReadIdx - xWriteIdx - 1)
+                   : (pxRingbuffer->xSize - xWriteIdx + xReadIdx - 1);
+    if (xSize > xFree) {
+        xSize = xFree;
+    }
+    if (xSize == 0) {
+        return 0;
+    }
+
+    //Copy in up to two parts due to wrap around
+    size_t xFirstPart = pxRingbuffer->xSize - xWriteIdx;
+    if (xFirstPart > xSize) {
+        xFirstPart = xSize;
+    }
+    memcpy(&pxRingbuffer->pucBuffer[xWriteIdx], pucData, xFirstPart);
+    if (xSize > xFirstPart) {
+        memcpy(pxRingbuffer->pucBuffer, pucData + xFirstPart, xSize - xFirstPart);
+    }
+    __atomic_store_n(&pxRingbuffer->xWriteIdx, prvSPSCNextIdx(pxRingbuffer, xWriteIdx, xSize), __ATOMIC_RELEASE);
+
+    //Wake the consumer if the buffer was empty and a wakeup was requested
+    if (pxRingbuffer->xReceiveNotifyTask != NULL && xReadIdx == xWriteIdx) {
+        if (xPortInIsrContext()) {
+            BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+            vTaskNotifyGiveFromISR(pxRingbuffer->xReceiveNotifyTask, &xHigherPriorityTaskWoken);
+            if (xHigherPriorityTaskWoken == pdTRUE) {
+                portYIELD_FROM_ISR();
+            }
+        } else {
+            xTaskNotifyGive(pxRingbuffer->xReceiveNotifyTask);
+        }
+    }
+    return xSize;
+}
+
+size_t xRingbufferSPSCSendAcquire(RingbufSPSCHandle_t xRingbuffer, void **ppvRegion)
+{
+    RingbufferSPSC_t *pxRingbuffer = (RingbufferSPSC_t *)xRingbuffer;
+
+    configASSERT(pxRingbuffer && ppvRegion);
+
+    size_t xWriteIdx = pxRingbuffer->xWriteIdx;
+    size_t xReadIdx = __atomic_load_n(&pxRingbuffer->xReadIdx, __ATOMIC_ACQUIRE);
+
+    size_t xRegionSize;
+    if (xReadIdx > xWriteIdx) {
+        //Free space is contiguous up to one byte before the read index
+        xRegionSize = xReadIdx - xWriteIdx - 1;
+    } else {
+        //Free space wraps around, return the part up to the end of the buffer
+        xRegionSize = pxRingbuffer->xSize - xWriteIdx;
+        if (xReadIdx == 0) {
+            xRegionSize -= 1;   //Must not advance the write index onto the read index
+        }
+    }
+    *ppvRegion = &pxRingbuffer->pucBuffer[xWriteIdx];
+    return xRegionSize;
+}
+
+void vRingbufferSPSCSendComplete(RingbufSPSCHandle_t xRingbuffer, size_t xSize)
+{
+    RingbufferSPSC_t *pxRingbuffer = (RingbufferSPSC_t *)xRingbuffer;
+
+    configASSERT(pxRingbuffer);
+    if (xSize == 0) {
+        return;
+    }
+
+    size_t xWriteIdx = pxRingbuffer->xWriteIdx;
+    size_t xReadIdx = __atomic_load_n(&pxRingbuffer->xReadIdx, __ATOMIC_ACQUIRE);
+    __atomic_store_n(&pxRingbuffer->xWriteIdx, prvSPSCNextIdx(pxRingbuffer, xWriteIdx, xSize), __ATOMIC_RELEASE);
+
+    if (pxRingbuffer->xReceiveNotifyTask != NULL && xReadIdx == xWriteIdx) {
+        if (xPortInIsrContext()) {
+            BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+            vTaskNotifyGiveFromISR(pxRingbuffer->xReceiveNotifyTask, &xHigherPriorityTaskWoken);
+            if (xHigherPriorityTaskWoken == pdTRUE) {
+                portYIELD_FROM_ISR();
+            }
+        } else {
+            xTaskNotifyGive(pxRingbuffer->xReceiveNotifyTask);
+        }
+    }
+}
+
+size_t xRingbufferSPSCReceiveUpTo(RingbufSPSCHandle_t xRingbuffer, void *pvData, size_t xSize)
+{
+    RingbufferSPSC_t *pxRingbuffer = (RingbufferSPSC_t *)xRingbuffer;
+    uint8_t *pucData = (uint8_t *)pvData;
+
+    configASSERT(pxRingbuffer && (pucData != NULL || xSize == 0));
+
+    size_t xReadIdx = pxRingbuffer->xReadIdx;       //Owned by us, plain load
+    size_t xWriteIdx = __atomic_load_n(&pxRingbuffer->xWriteIdx, __ATOMIC_ACQUIRE);
+
+    size_t xAvail = (xWriteIdx >= xReadIdx) ? (xWriteIdx - xReadIdx)
+                    : (pxRingbuffer->xSize - xReadIdx + xWriteIdx);
+    if (xSize > xAvail) {
+        xSize = xAvail;
+    }
+    if (xSize == 0) {
+        return 0;
+    }
+
+    //Copy out up to two parts due to wrap around
+    size_t xFirstPart = pxRingbuffer->xSize - xReadIdx;
+    if (xFirstPart > xSize) {
+        xFirstPart = xSize;
+    }
+    memcpy(pucData, &pxRingbuffer->pucBuffer[xReadIdx], xFirstPart);
+    if (xSize > xFirstPart) {
+        memcpy(pucData + xFirstPart, pxRingbuffer->pucBuffer, xSize - xFirstPart);
+    }
+    __atomic_store_n(&pxRingbuffer->xReadIdx, prvSPSCNextIdx(pxRingbuffer, xReadIdx, xSize), __ATOMIC_RELEASE);
+    return xSize;
+}
+
+size_t xRingbufferSPSCReceiveAcquire(RingbufSPSCHandle_t xRingbuffer, void **ppvRegion)
+{
+    RingbufferSPSC_t *pxRingbuffer = (RingbufferSPSC_t *)xRingbuffer;
+
+    configASSERT(pxRingbuffer && ppvRegion);
+
+    size_t xReadIdx = pxRingbuffer->xReadIdx;
+    size_t xWriteIdx = __atomic_load_n(&pxRingbuffer->xWriteIdx, __ATOMIC_ACQUIRE);
+
+    size_t xRegionSize;
+    if (xWriteIdx >= xReadIdx) {
+        //Pending data is contiguous
+        xRegionSize = xWriteIdx - xReadIdx;
+    } else {
+        //Pending data wraps around, return the part up to the end of the buffer
+        xRegionSize = pxRingbuffer->xSize - xReadIdx;
+    }
+    *ppvRegion = &pxRingbuffer->pucBuffer[xReadIdx];
+    return xRegionSize;
+}
+
+void vRingbufferSPSCReceiveComplete(RingbufSPSCHandle_t xRingbuffer, size_t xSize)
+{
+    RingbufferSPSC_t *pxRingbuffer = (RingbufferSPSC_t *)xRingbuffer;
+
+    configASSERT(pxRingbuffer);
+    if (xSize == 0) {
+        return;
+    }
+    __atomic_store_n(&pxRingbuffer->xReadIdx, prvSPSCNextIdx(pxRingbuffer, pxRingbuffer->xReadIdx, xSize), __ATOMIC_RELEASE);
+}
+
+void vRingbufferSPSCSetReceiveNotify(RingbufSPSCHandle_t xRingbuffer, TaskHandle_t xTask)
+{
+    RingbufferSPSC_t *pxRingbuffer = (RingbufferSPSC_t *)xRingbuffer;
+
+    configASSERT(pxRingbuffer);
+    pxRingbuffer->xReceiveNotifyTask = xTask;
+}
+
+size_t xRingbufferSPSCGetWaiting(RingbufSPSCHandle_t xRingbuffer)
+{
+    RingbufferSPSC_t *pxRingbuffer = (RingbufferSPSC_t *)xRingbuffer;
+
+    configASSERT(pxRingbuffer);
+
+    size_t xWriteIdx = __atomic_load_n(&pxRingbuffer->xWriteIdx, __ATOMIC_ACQUIRE);
+    size_t xReadIdx = __atomic_load_n(&pxRingbuffer->xReadIdx, __ATOMIC_ACQUIRE);
+    return (xWriteIdx >= xReadIdx) ? (xWriteIdx - xReadIdx)
+           : (pxRingbuffer->xSize - xReadIdx + xWriteIdx);
+}
+
+size_t xRingbufferSPSCGetFree(RingbufSPSCHandle_t xRingbuffer)
+{
+    RingbufferSPSC_t *pxRingbuffer = (RingbufferSPSC_t *)xRingbuffer;
+
+    configASSERT(pxRingbuffer);
+
+    size_t xWriteIdx = __atomic_load_n(&pxRingbuffer->xWriteIdx, __ATOMIC_ACQUIRE);
+    size_t xReadIdx = __atomic_load_n(&pxRingbuffer->xReadIdx, __ATOMIC_ACQUIRE);
+    return (xReadIdx > xWriteIdx) ? (xReadIdx - xWriteIdx - 1)
+           : (pxRingbuffer->xSize - xWriteIdx + xReadIdx - 1);
+}
@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file esp_simd.h
+ * @brief First-party vectorized math kernels with per-chip dispatch
+ *
+ * A small set of data-movement and DSP-style kernels that audio and imaging
+ * paths keep re-inventing. On chips with a SIMD-capable instruction set
+ * (currently the ESP32-S3 processor instruction extensions, PIE) the kernels
+ * use 128-bit vector loads and stores when the data permits; everywhere else,
+ * and for unaligned or short buffers, portable C implementations are used.
+ * The dispatch happens per call based on alignment and length, so the
+ * functions can be called unconditionally with any buffers.
+ *
+ * Vectorized paths are selected for 16-byte aligned data; place hot buffers
+ * with heap_caps_aligned_alloc(16, ...) or __attribute__((aligned(16))) to
+ * benefit.
+ */
+
+/**
+ * @brief Copy memory, vectorized when source and destination are 16-byte aligned
+ *
+ * Same contract as memcpy(): regions must not overlap.
+ *
+ * @return dst
+ */
+void *esp_simd_memcpy(void *dst, const void *src, size_t n);
+
+/**
+ * @brief Fill memory with a byte value, vectorized when dst is 16-byte aligned
+ *
+ * Same contract as memset().
+ *
+ * @return dst
+ */
+void *esp_simd_memset(void *dst, int c, size_t n);
+
+/**
+ * @brief Fill an int16 buffer with a value
+ *
+ * @param dst   Destination buffer
+ * @param value Value to store in every element
+ * @param len   Number of elements
+ */
+void esp_simd_fill_s16(int16_t *dst, int16_t value, size_t len);
+
+/**
+ * @brief Dot product of two int16 vectors
+ *
+ * Products are accumulated in an extended-precision accumulator, so
+ * intermediate overflow cannot occur for any practical length; the final sum
+ * is arithmetically shifted right before being returned.
+ *
+ * @param a     First vector
+ * @param b     Second vector
+ * @param len   Number of elements
+ * @param shift Right shift applied to the accumulated sum (0..31)
+ *
+ * @return (sum of a[i] * b[i]) >> shift
+ */
+int32_t esp_simd_dotprod_s16(const int16_t *a, const int16_t *b, size_t len, int shift);
+
+/**
+ * @brief Dot product of two float vectors
+ *
+ * @param a   First vector
+ * @param b   Second vector
+ * @param len Number of elements
+ *
+ * @return Sum of a[i] * b[i]
+ */
+float esp_simd_dotprod_f32(const float *a, const float *b, size_t len);
+
+/**
+ * @brief Element-wise saturating addition of two int16 vectors
+ *
+ * out[i] = saturate(a[i] + b[i]), clamped to [INT16_MIN, INT16_MAX].
+ * out may alias a or b.
+ *
+ * @param a   First vector
+ * @param b   Second vector
+ * @param out Result vector
+ * @param len Number of elements
+ */
+void esp_simd_add_sat_s16(const int16_t *a, const int16_t *b, int16_t *out, size_t len);
+
+/**
+ * @brief Rearrange bytes within consecutive fixed-size groups
+ *
+ * For every group g, out[g * group_size + i] = src[g * group_size + map[i]].
+ * Typical uses: RGBA channel reordering (group_size 4), endian swaps, and
+ * audio sample interleaving. src and out must not overlap.
+ *
+ * @param src        Source buffer, groups * group_size bytes
+ * @param out        Destination buffer, groups * group_size bytes
+ * @param map        Permutation table with group_size entries, each < group_size
+ * @param group_size Bytes per group (1..16)
+ * @param groups     Number of groups
+ */
+void esp_simd_swizzle_u8(const uint8_t *src, uint8_t *out, const uint8_t *map,
+                         size_t group_size, size_t groups);
+
+/**
+ * @brief Convert packed RGB888 pixels to RGB565
+ *
+ * @param src    Source pixels, 3 bytes per pixel in R, G, B order
+ * @param dst    Destination pixels, one little-endian uint16 per pixel
+ * @param pixels Number of pixels
+ */
+void esp_simd_rgb888_to_rgb565(const uint8_t *src, uint16_t *dst, size_t pixels);
+
+/**
+ * @brief Name of the kernel implementation used on this chip
+ *
+ * @return Short static string, e.g. "pie" or "ansi"
+ */
+const char *esp_simd_impl_name(void);
+
+#ifdef __cplusplus
+}
+#endif
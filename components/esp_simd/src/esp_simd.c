@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <limits.h>
+
+#include "sdkconfig.h"
+#include "esp_simd.h"
+
+#define PTR_ALIGNED_16(p)   ((((uintptr_t)(p)) & 0xF) == 0)
+
+#if CONFIG_IDF_TARGET_ESP32S3
+/* PIE kernels (esp_simd_aes3.S). Each processes whole 16-byte blocks; the C
+ * wrappers handle alignment checks and tails. */
+void esp_simd_memcpy_pie(void *dst, const void *src, uint32_t blocks);
+void esp_simd_fill_pie(void *dst, const void *pattern16, uint32_t blocks);
+int32_t esp_simd_dotprod_s16_pie(const int16_t *a, const int16_t *b, uint32_t blocks, uint32_t shift);
+#endif
+
+void *esp_simd_memcpy(void *dst, const void *src, size_t n)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    if (PTR_ALIGNED_16(dst) && PTR_ALIGNED_16(src) && n >= 16) {
+        uint32_t blocks = n / 16;
+        esp_simd_memcpy_pie(dst, src, blocks);
+        size_t done = (size_t)blocks * 16;
+        if (n != done) {
+            memcpy((uint8_t *)dst + done, (const uint8_t *)src + done, n - done);
+        }
+        return dst;
+    }
+#endif
+    return memcpy(dst, src, n);
+}
+
+void *esp_simd_memset(void *dst, int c, size_t n)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    if (PTR_ALIGNED_16(dst) && n >= 16) {
+        uint8_t pattern[16] __attribute__((aligned(16)));
+        memset(pattern, c, sizeof(pattern));
+        uint32_t blocks = n / 16;
+        esp_simd_fill_pie(dst, pattern, blocks);
+        size_t done = (size_t)blocks * 16;
+        if (n != done) {
+            memset((uint8_t *)dst + done, c, n - done);
+        }
+        return dst;
+    }
+#endif
+    return memset(dst, c, n);
+}
+
+void esp_simd_fill_s16(int16_t *dst, int16_t value, size_t len)
+{
+    size_t i = 0;
+#if CONFIG_IDF_TARGET_ESP32S3
+    if (PTR_ALIGNED_16(dst) && len >= 8) {
+        int16_t pattern[8] __attribute__((aligned(16)));
+        for (int j = 0; j < 8; j++) {
+            pattern[j] = value;
+        }
+        uint32_t blocks = len / 8;
+        esp_simd_fill_pie(dst, pattern, blocks);
+        i = (size_t)blocks * 8;
+    }
+#endif
+    for (; i < len; i++) {
+        dst[i] = value;
+    }
+}
+
+int32_t esp_simd_dotprod_s16(const int16_t *a, const int16_t *b, size_t len, int shift)
+{
+    int64_t acc = 0;
+    size_t i = 0;
+#if CONFIG_IDF_TARGET_ESP32S3
+    if (PTR_ALIGNED_16(a) && PTR_ALIGNED_16(b) && len >= 8) {
+        uint32_t blocks = len / 8;
+        /* The PIE path applies the shift inside the 40-bit accumulator read;
+         * fold its result back in unshifted so the tail can be added first */
+        acc = (int64_t)esp_simd_dotprod_s16_pie(a, b, blocks, (uint32_t)shift) << shift;
+        i = (size_t)blocks * 8;
+    }
+#endif
+    for (; i < len; i++) {
+        acc += (int32_t)a[i] * b[i];
+    }
+    return (int32_t)(acc >> shift);
+}
+
+float esp_simd_dotprod_f32(const float *a, const float *b, size_t len)
+{
+    /* Four independent partial sums let the FPU pipeline overlap the
+     * multiply-add chains; this is within rounding noise of a plain loop */
+    float s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    size_t i = 0;
+    for (; i + 4 <= len; i += 4) {
+        s0 += a[i + 0] * b[i + 0];
+        s1 += a[i + 1] * b[i + 1];
+        s2 += a[i + 2] * b[i + 2];
+        s3 += a[i + 3] * b[i + 3];
+    }
+    float sum = (s0 + s1) + (s2 + s3);
+    for (; i < len; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+void esp_simd_add_sat_s16(const int16_t *a, const int16_t *b, int16_t *out, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        int32_t sum = (int32_t)a[i] + b[i];
+        if (sum > INT16_MAX) {
+            sum = INT16_MAX;
+        } else if (sum < INT16_MIN) {
+            sum = INT16_MIN;
+        }
+        out[i] = (int16_t)sum;
+    }
+}
+
+void esp_simd_swizzle_u8(const uint8_t *src, uint8_t *out, const uint8_t *map,
+                         size_t group_size, size_t groups)
+{
+    for (size_t g = 0; g < groups; g++) {
+        for (size_t i = 0; i < group_size; i++) {
+            out[i] = src[map[i]];
+        }
+        src += group_size;
+        out += group_size;
+    }
+}
+
+void esp_simd_rgb888_to_rgb565(const uint8_t *src, uint16_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i++) {
+        uint32_t r = src[0];
+        uint32_t g = src[1];
+        uint32_t b = src[2];
+        dst[i] = (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+        src += 3;
+    }
+}
+
+const char *esp_simd_impl_name(void)
+{
+#if CONFIG_IDF_TARGET_ESP32S3
+    return "pie";
+#else
+    return "ansi";
+#endif
+}
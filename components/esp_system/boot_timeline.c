@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "esp_boot_timeline.h"
+#include "esp_private/startup_internal.h"
+
+/**
+ * Markers are stored as raw cycle counts and only converted to microseconds
+ * when printing: recording must stay cheap enough for early startup code, and
+ * the cycle counter is the only clock available at every marker point. The
+ * counter is 32 bits wide and wraps after a few dozen seconds, so elapsed time
+ * is accumulated from wrap-safe deltas between consecutive markers rather than
+ * computed from absolute counts.
+ */
+typedef struct {
+    const char *label;      // Phase name, points to caller-owned storage
+    uint32_t cycles;        // CPU cycle count at the start of the phase
+} boot_timeline_marker_t;
+
+static const char *TAG = "boot_timeline";
+static portMUX_TYPE s_timeline_lock = portMUX_INITIALIZER_UNLOCKED;
+static boot_timeline_marker_t s_markers[CONFIG_ESP_SYSTEM_BOOT_TIMELINE_MAX_MARKERS];
+static uint32_t s_marker_count;
+static uint32_t s_markers_dropped;
+
+void esp_boot_timeline_mark(const char *label)
+{
+    uint32_t cycles = esp_cpu_get_cycle_count();
+
+    portENTER_CRITICAL_SAFE(&s_timeline_lock);
+    if (s_marker_count < CONFIG_ESP_SYSTEM_BOOT_TIMELINE_MAX_MARKERS) {
+        s_markers[s_marker_count].label = label;
+        s_markers[s_marker_count].cycles = cycles;
+        s_marker_count++;
+    } else {
+        s_markers_dropped++;
+    }
+    portEXIT_CRITICAL_SAFE(&s_timeline_lock);
+}
+
+void esp_boot_timeline_print(void)
+{
+    uint32_t ticks_per_us = esp_rom_get_cpu_ticks_per_us();
+    uint32_t now_cycles = esp_cpu_get_cycle_count();
+
+    portENTER_CRITICAL(&s_timeline_lock);
+    uint32_t count = s_marker_count;
+    portEXIT_CRITICAL(&s_timeline_lock);
+
+    /* Time before the first marker was spent in the ROM and the second stage
+     * bootloader; g_startup_time is the RTC time at which the application
+     * entry point took over, so it covers that span without needing any
+     * bootloader-side bookkeeping. */
+    ESP_LOGI(TAG, "phase %-20s start %8u us, took %8" PRIu32 " us",
+             "rom+bootloader", 0, (uint32_t) g_startup_time);
+
+    uint64_t elapsed_us = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t end_cycles = (i + 1 < count) ? s_markers[i + 1].cycles : now_cycles;
+        uint32_t phase_us = (end_cycles - s_markers[i].cycles) / ticks_per_us;
+        ESP_LOGI(TAG, "phase %-20s start %8" PRIu64 " us, took %8" PRIu32 " us",
+                 s_markers[i].label, (uint64_t) g_startup_time + elapsed_us, phase_us);
+        elapsed_us += phase_us;
+    }
+
+    ESP_LOGI(TAG, "total %" PRIu64 " us since power-on", (uint64_t) g_startup_time + elapsed_us);
+    if (s_markers_dropped != 0) {
+        ESP_LOGW(TAG, "%" PRIu32 " markers dropped, increase CONFIG_ESP_SYSTEM_BOOT_TIMELINE_MAX_MARKERS",
+                 s_markers_dropped);
+    }
+}
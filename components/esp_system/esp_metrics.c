@@ -0,0 +1,198 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/queue.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_metrics.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_check.h"
+
+static const char *TAG = "esp_metrics";
+
+typedef struct metrics_provider {
+    SLIST_ENTRY(metrics_provider) next;
+    char tag[ESP_METRICS_TAG_LEN];
+    uint16_t version;
+    uint16_t max_size;
+    esp_metrics_provider_cb_t cb;
+    void *arg;
+} metrics_provider_t;
+
+static SLIST_HEAD(metrics_provider_list, metrics_provider) s_providers = SLIST_HEAD_INITIALIZER(s_providers);
+static SemaphoreHandle_t s_providers_lock;
+static StaticSemaphore_t s_providers_lock_buf;
+static portMUX_TYPE s_lock_init_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static SemaphoreHandle_t providers_lock(void)
+{
+    if (s_providers_lock == NULL) {
+        portENTER_CRITICAL(&s_lock_init_lock);
+        if (s_providers_lock == NULL) {
+            s_providers_lock = xSemaphoreCreateMutexStatic(&s_providers_lock_buf);
+        }
+        portEXIT_CRITICAL(&s_lock_init_lock);
+    }
+    return s_providers_lock;
+}
+
+esp_err_t esp_metrics_register_provider(const char *tag, uint16_t version, size_t max_size,
+                                        esp_metrics_provider_cb_t cb, void *arg)
+{
+    ESP_RETURN_ON_FALSE(tag && cb, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(strlen(tag) < ESP_METRICS_TAG_LEN, ESP_ERR_INVALID_ARG, TAG, "tag too long");
+    ESP_RETURN_ON_FALSE(max_size > 0 && max_size <= UINT16_MAX, ESP_ERR_INVALID_ARG, TAG, "invalid max size");
+
+    metrics_provider_t *provider = heap_caps_calloc(1, sizeof(metrics_provider_t), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(provider, ESP_ERR_NO_MEM, TAG, "no mem for provider");
+    strlcpy(provider->tag, tag, sizeof(provider->tag));
+    provider->version = version;
+    provider->max_size = max_size;
+    provider->cb = cb;
+    provider->arg = arg;
+
+    xSemaphoreTake(providers_lock(), portMAX_DELAY);
+    SLIST_INSERT_HEAD(&s_providers, provider, next);
+    xSemaphoreGive(s_providers_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_metrics_unregister_provider(esp_metrics_provider_cb_t cb, void *arg)
+{
+    ESP_RETURN_ON_FALSE(cb, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    metrics_provider_t *provider = NULL;
+    xSemaphoreTake(providers_lock(), portMAX_DELAY);
+    SLIST_FOREACH(provider, &s_providers, next) {
+        if (provider->cb == cb && provider->arg == arg) {
+            SLIST_REMOVE(&s_providers, provider, metrics_provider, next);
+            break;
+        }
+    }
+    xSemaphoreGive(s_providers_lock);
+    ESP_RETURN_ON_FALSE(provider, ESP_ERR_NOT_FOUND, TAG, "provider not registered");
+    free(provider);
+    return ESP_OK;
+}
+
+static bool emit_section(uint8_t **cursor, size_t *remaining, const char *tag, uint16_t version,
+                         const void *payload, size_t length)
+{
+    if (*remaining < sizeof(esp_metrics_section_header_t) + length) {
+        return false;
+    }
+    esp_metrics_section_header_t header = {
+        .version = version,
+        .length = length,
+    };
+    strlcpy(header.tag, tag, sizeof(header.tag));
+    memcpy(*cursor, &header, sizeof(header));
+    memcpy(*cursor + sizeof(header), payload, length);
+    *cursor += sizeof(header) + length;
+    *remaining -= sizeof(header) + length;
+    return true;
+}
+
+static void fill_heap_section(esp_metrics_heap_section_t *heap)
+{
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, MALLOC_CAP_INTERNAL);
+    heap->internal_free = info.total_free_bytes;
+    heap->internal_min_free = info.minimum_free_bytes;
+    heap->internal_largest_block = info.largest_free_block;
+    heap->internal_allocated = info.total_allocated_bytes;
+#if CONFIG_SPIRAM
+    heap_caps_get_info(&info, MALLOC_CAP_SPIRAM);
+    heap->spiram_free = info.total_free_bytes;
+    heap->spiram_min_free = info.minimum_free_bytes;
+    heap->spiram_largest_block = info.largest_free_block;
+    heap->spiram_allocated = info.total_allocated_bytes;
+#else
+    heap->spiram_free = 0;
+    heap->spiram_min_free = 0;
+    heap->spiram_largest_block = 0;
+    heap->spiram_allocated = 0;
+#endif
+}
+
+static void fill_sched_section(esp_metrics_sched_section_t *sched)
+{
+    sched->tick_count = xTaskGetTickCount();
+    sched->task_count = uxTaskGetNumberOfTasks();
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    sched->idle_run_time = ulTaskGetIdleRunTimeCounter();
+#else
+    sched->idle_run_time = 0;
+#endif
+}
+
+esp_err_t esp_metrics_snapshot(void *buf, size_t buf_size, size_t *out_size)
+{
+    ESP_RETURN_ON_FALSE(buf && out_size, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    *out_size = 0;
+    ESP_RETURN_ON_FALSE(buf_size >= sizeof(esp_metrics_blob_header_t), ESP_ERR_INVALID_SIZE, TAG, "buffer too small");
+
+    uint8_t *cursor = buf;
+    size_t remaining = buf_size;
+    uint8_t num_sections = 0;
+    esp_err_t ret = ESP_OK;
+
+    esp_metrics_blob_header_t blob_header = {
+        .magic = ESP_METRICS_BLOB_MAGIC,
+        .version = ESP_METRICS_BLOB_VERSION,
+        .timestamp_us = esp_timer_get_time(),
+    };
+    memcpy(cursor, &blob_header, sizeof(blob_header));
+    cursor += sizeof(blob_header);
+    remaining -= sizeof(blob_header);
+
+    esp_metrics_heap_section_t heap;
+    fill_heap_section(&heap);
+    ESP_GOTO_ON_FALSE(emit_section(&cursor, &remaining, "heap", 1, &heap, sizeof(heap)),
+                      ESP_ERR_INVALID_SIZE, out, TAG, "buffer too small");
+
+    esp_metrics_sched_section_t sched;
+    fill_sched_section(&sched);
+    ESP_GOTO_ON_FALSE(emit_section(&cursor, &remaining, "sched", 1, &sched, sizeof(sched)),
+                      ESP_ERR_INVALID_SIZE, out, TAG, "buffer too small");
+    num_sections = 2;
+
+    metrics_provider_t *provider;
+    xSemaphoreTake(providers_lock(), portMAX_DELAY);
+    SLIST_FOREACH(provider, &s_providers, next) {
+        if (remaining < sizeof(esp_metrics_section_header_t) + provider->max_size) {
+            ret = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+        uint8_t *payload = cursor + sizeof(esp_metrics_section_header_t);
+        size_t written = provider->cb(payload, provider->max_size, provider->arg);
+        if (written == 0) {
+            continue;
+        }
+        if (written > provider->max_size) {
+            // the provider overflowed its declared budget, drop the section
+            // rather than ship a blob with trailing garbage
+            ESP_LOGE(TAG, "provider %s wrote %zu bytes, max is %u", provider->tag, written, provider->max_size);
+            continue;
+        }
+        esp_metrics_section_header_t *header = (esp_metrics_section_header_t *)cursor;
+        memset(header, 0, sizeof(*header));
+        strlcpy(header->tag, provider->tag, sizeof(header->tag));
+        header->version = provider->version;
+        header->length = written;
+        cursor += sizeof(*header) + written;
+        remaining -= sizeof(*header) + written;
+        num_sections++;
+    }
+    xSemaphoreGive(s_providers_lock);
+
+out:
+    ((esp_metrics_blob_header_t *)buf)->num_sections = num_sections;
+    *out_size = cursor - (uint8_t *)buf;
+    return ret;
+}
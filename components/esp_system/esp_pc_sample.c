@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_pc_sample.h"
+#include "esp_freertos_hooks.h"
+#include "esp_heap_caps.h"
+#include "esp_cpu.h"
+#include "esp_attr.h"
+#include "esp_check.h"
+#if __riscv
+#include "riscv/csr.h"
+#endif
+
+static const char *TAG = "pc_sample";
+
+#define PC_SAMPLE_TABLE_SIZE  CONFIG_ESP_SYSTEM_PC_SAMPLE_TABLE_SIZE
+#define PC_SAMPLE_PROBE_LIMIT 8
+
+typedef struct {
+    uint32_t pc;
+    uint32_t count;
+} pc_sample_slot_t;
+
+static pc_sample_slot_t *s_tables[CONFIG_FREERTOS_NUMBER_OF_CORES];
+static uint32_t s_dropped[CONFIG_FREERTOS_NUMBER_OF_CORES];
+static volatile bool s_running;
+
+static void IRAM_ATTR pc_sample_tick_hook(void)
+{
+    if (!s_running) {
+        return;
+    }
+    uint32_t pc;
+#if __riscv
+    pc = RV_READ_CSR(mepc);
+#else
+    __asm__ volatile ("rsr.epc1 %0" : "=r" (pc));
+#endif
+    int core = esp_cpu_get_core_id();
+    pc_sample_slot_t *table = s_tables[core];
+    uint32_t idx = (pc >> 2) * 2654435761U;
+    for (int probe = 0; probe < PC_SAMPLE_PROBE_LIMIT; probe++) {
+        pc_sample_slot_t *slot = &table[(idx + probe) % PC_SAMPLE_TABLE_SIZE];
+        if (slot->pc == pc) {
+            slot->count++;
+            return;
+        }
+        if (slot->pc == 0) {
+            slot->pc = pc;
+            slot->count = 1;
+            return;
+        }
+    }
+    s_dropped[core]++;
+}
+
+esp_err_t esp_pc_sample_start(void)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(!s_running, ESP_ERR_INVALID_STATE, TAG, "sampling already running");
+    for (int core = 0; core < CONFIG_FREERTOS_NUMBER_OF_CORES; core++) {
+        if (s_tables[core] == NULL) {
+            // the hook runs with the cache potentially disabled, keep the tables internal
+            s_tables[core] = heap_caps_calloc(PC_SAMPLE_TABLE_SIZE, sizeof(pc_sample_slot_t),
+                                              MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            ESP_GOTO_ON_FALSE(s_tables[core], ESP_ERR_NO_MEM, err, TAG, "no mem for sample table");
+        }
+        ESP_GOTO_ON_ERROR(esp_register_freertos_tick_hook_for_cpu(pc_sample_tick_hook, core),
+                          err, TAG, "failed to register tick hook");
+    }
+    s_running = true;
+    return ESP_OK;
+
+err:
+    for (int core = 0; core < CONFIG_FREERTOS_NUMBER_OF_CORES; core++) {
+        esp_deregister_freertos_tick_hook_for_cpu(pc_sample_tick_hook, core);
+        if (s_tables[core]) {
+            free(s_tables[core]);
+            s_tables[core] = NULL;
+        }
+    }
+    return ret;
+}
+
+esp_err_t esp_pc_sample_stop(void)
+{
+    ESP_RETURN_ON_FALSE(s_running, ESP_ERR_INVALID_STATE, TAG, "sampling not running");
+    s_running = false;
+    for (int core = 0; core < CONFIG_FREERTOS_NUMBER_OF_CORES; core++) {
+        esp_deregister_freertos_tick_hook_for_cpu(pc_sample_tick_hook, core);
+    }
+    return ESP_OK;
+}
+
+void esp_pc_sample_reset(void)
+{
+    for (int core = 0; core < CONFIG_FREERTOS_NUMBER_OF_CORES; core++) {
+        if (s_tables[core]) {
+            memset(s_tables[core], 0, PC_SAMPLE_TABLE_SIZE * sizeof(pc_sample_slot_t));
+        }
+        s_dropped[core] = 0;
+    }
+}
+
+esp_err_t esp_pc_sample_dump(FILE *out)
+{
+    ESP_RETURN_ON_FALSE(out, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(s_tables[0], ESP_ERR_INVALID_STATE, TAG, "sampling never started");
+    for (int core = 0; core < CONFIG_FREERTOS_NUMBER_OF_CORES; core++) {
+        for (int i = 0; i < PC_SAMPLE_TABLE_SIZE; i++) {
+            const pc_sample_slot_t *slot = &s_tables[core][i];
+            if (slot->pc != 0) {
+                fprintf(out, "pc_sample: 0x%08" PRIx32 " %" PRIu32 "\n", slot->pc, slot->count);
+            }
+        }
+        fprintf(out, "pc_sample_dropped: %" PRIu32 "\n", s_dropped[core]);
+    }
+    fprintf(out, "pc_sample_end\n");
+    return ESP_OK;
+}
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "esp_warm_boot.h"
+#include "esp_system.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_private/critical_section.h"
+
+#define WARM_BOOT_MAX_SNAPSHOTS     8
+#define WARM_BOOT_MAX_PHASES        16
+#define WARM_BOOT_SEAL_MAGIC        0x57424F54  // "WBOT"
+
+static const char *TAG = "warm_boot";
+
+typedef struct {
+    uint32_t name_crc;      // CRC32 of the snapshot name, used for matching across boots
+    uint32_t data_crc;      // CRC32 of the snapshot data, computed right before deep sleep
+    uint32_t size;
+} warm_boot_seal_entry_t;
+
+/* Seal table, persisted in RTC memory across deep sleep. The magic is cleared
+ * on every boot so that a sleep entry which never completes (or a snapshot
+ * modified after sealing) cannot be mistaken for a valid seal on the next wake. */
+typedef struct {
+    uint32_t magic;
+    uint32_t count;
+    warm_boot_seal_entry_t entries[WARM_BOOT_MAX_SNAPSHOTS];
+} warm_boot_seal_table_t;
+
+static RTC_NOINIT_ATTR warm_boot_seal_table_t s_seal_table;
+
+// Snapshot registrations and phase marks only last for the current boot
+static esp_warm_boot_snapshot_t s_snapshots[WARM_BOOT_MAX_SNAPSHOTS];
+static size_t s_snapshot_count;
+static esp_warm_boot_phase_t s_phases[WARM_BOOT_MAX_PHASES];
+static size_t s_phase_count;
+static bool s_woke_from_seal;
+static bool s_hook_registered;
+
+DEFINE_CRIT_SECTION_LOCK_STATIC(s_warm_boot_lock);
+
+static uint32_t warm_boot_name_crc(const char *name)
+{
+    return esp_rom_crc32_le(0, (const uint8_t *)name, strlen(name));
+}
+
+/* Runs from the deep sleep preparation path: seal the registered snapshots so
+ * that they can be validated on the next wake. Must not block. */
+static void warm_boot_seal(void)
+{
+    s_seal_table.count = 0;
+    for (size_t i = 0; i < s_snapshot_count; i++) {
+        warm_boot_seal_entry_t *entry = &s_seal_table.entries[s_seal_table.count++];
+        entry->name_crc = warm_boot_name_crc(s_snapshots[i].name);
+        entry->data_crc = esp_rom_crc32_le(0, (const uint8_t *)s_snapshots[i].data, s_snapshots[i].size);
+        entry->size = s_snapshots[i].size;
+    }
+    s_seal_table.magic = WARM_BOOT_SEAL_MAGIC;
+}
+
+static void warm_boot_init_once(void)
+{
+    static bool s_inited = false;
+    if (s_inited) {
+        return;
+    }
+    s_inited = true;
+    /* Latch whether the previous boot left a valid seal behind, then clear it:
+     * a seal may only be consumed by the wake immediately following it */
+    s_woke_from_seal = (esp_reset_reason() == ESP_RST_DEEPSLEEP) &&
+                       (s_seal_table.magic == WARM_BOOT_SEAL_MAGIC) &&
+                       (s_seal_table.count <= WARM_BOOT_MAX_SNAPSHOTS);
+    s_seal_table.magic = 0;
+}
+
+esp_err_t esp_warm_boot_snapshot_register(const esp_warm_boot_snapshot_t *snapshot)
+{
+    if (snapshot == NULL || snapshot->name == NULL || snapshot->data == NULL || snapshot->size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t ret = ESP_OK;
+    esp_os_enter_critical(&s_warm_boot_lock);
+    warm_boot_init_once();
+    if (s_snapshot_count < WARM_BOOT_MAX_SNAPSHOTS) {
+        s_snapshots[s_snapshot_count++] = *snapshot;
+    } else {
+        ret = ESP_ERR_NO_MEM;
+    }
+    esp_os_exit_critical(&s_warm_boot_lock);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "snapshot table full, <%s> not registered", snapshot->name);
+        return ret;
+    }
+    if (!s_hook_registered) {
+        ret = esp_deep_sleep_register_hook(warm_boot_seal);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        s_hook_registered = true;
+    }
+    return ESP_OK;
+}
+
+bool esp_warm_boot_snapshot_valid(const esp_warm_boot_snapshot_t *snapshot)
+{
+    if (snapshot == NULL || snapshot->name == NULL || snapshot->data == NULL) {
+        return false;
+    }
+    esp_os_enter_critical(&s_warm_boot_lock);
+    warm_boot_init_once();
+    esp_os_exit_critical(&s_warm_boot_lock);
+    if (!s_woke_from_seal) {
+        return false;
+    }
+    uint32_t name_crc = warm_boot_name_crc(snapshot->name);
+    for (size_t i = 0; i < s_seal_table.count; i++) {
+        const warm_boot_seal_entry_t *entry = &s_seal_table.entries[i];
+        if (entry->name_crc != name_crc) {
+            continue;
+        }
+        if (entry->size != snapshot->size) {
+            ESP_LOGW(TAG, "snapshot <%s> size changed across sleep, discarding", snapshot->name);
+            return false;
+        }
+        return esp_rom_crc32_le(0, (const uint8_t *)snapshot->data, snapshot->size) == entry->data_crc;
+    }
+    return false;
+}
+
+void esp_warm_boot_mark(const char *phase)
+{
+    int64_t now = esp_timer_get_time();
+    esp_os_enter_critical(&s_warm_boot_lock);
+    if (s_phase_count < WARM_BOOT_MAX_PHASES) {
+        s_phases[s_phase_count].phase = phase;
+        s_phases[s_phase_count].time_us = now;
+        s_phase_count++;
+    }
+    esp_os_exit_critical(&s_warm_boot_lock);
+}
+
+size_t esp_warm_boot_get_phases(esp_warm_boot_phase_t *out_phases, size_t max_phases)
+{
+    if (out_phases == NULL) {
+        return 0;
+    }
+    esp_os_enter_critical(&s_warm_boot_lock);
+    size_t count = (s_phase_count < max_phases) ? s_phase_count : max_phases;
+    memcpy(out_phases, s_phases, count * sizeof(esp_warm_boot_phase_t));
+    esp_os_exit_critical(&s_warm_boot_lock);
+    return count;
+}
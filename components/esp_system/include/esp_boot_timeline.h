@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file esp_boot_timeline.h
+ * @brief Boot timeline instrumentation
+ *
+ * When CONFIG_ESP_SYSTEM_BOOT_TIMELINE is enabled, the startup code records a
+ * cycle-stamped marker at the beginning of each boot phase (core init, global
+ * constructors, secondary init, scheduler start, app_main). Each marker opens a
+ * phase that lasts until the next marker. The application can add its own
+ * markers from app_main to extend the timeline into application bring-up.
+ *
+ * esp_boot_timeline_print() prints one line per phase with its start time and
+ * duration, in a format parsed by tools/boot_timeline_report.py to produce a
+ * per-phase report suitable for tracking boot-time regressions in CI.
+ */
+
+#if CONFIG_ESP_SYSTEM_BOOT_TIMELINE || __DOXYGEN__
+
+/**
+ * @brief Record a boot timeline marker
+ *
+ * Opens a new phase named \c label at the current CPU cycle count; the phase
+ * ends at the next marker. Cheap enough to call from early startup code.
+ *
+ * @note \c label is stored by reference and must point to storage that remains
+ *       valid until the timeline is printed (typically a string literal).
+ *
+ * @param[in] label Name of the phase starting at this point
+ */
+void esp_boot_timeline_mark(const char *label);
+
+/**
+ * @brief Print the recorded boot timeline
+ *
+ * Prints one line per phase with its start time (in microseconds since power-on)
+ * and duration. Time spent in the ROM and the second stage bootloader is
+ * reported as a single leading phase, derived from the RTC clock.
+ */
+void esp_boot_timeline_print(void);
+
+#else // CONFIG_ESP_SYSTEM_BOOT_TIMELINE
+
+/* No-op stubs so applications can keep their markers in place unconditionally */
+static inline void esp_boot_timeline_mark(const char *label)
+{
+    (void) label;
+}
+
+static inline void esp_boot_timeline_print(void)
+{
+}
+
+#endif // CONFIG_ESP_SYSTEM_BOOT_TIMELINE
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Magic value at the start of every metrics blob ("EMTR", little endian) */
+#define ESP_METRICS_BLOB_MAGIC      0x52544D45
+/** @brief Layout version of the blob and section headers */
+#define ESP_METRICS_BLOB_VERSION    1
+/** @brief Size of a section tag, including NUL padding */
+#define ESP_METRICS_TAG_LEN         8
+
+/**
+ * @brief Header at the start of a metrics blob
+ *
+ * All multi-byte fields are little endian. `num_sections` section headers,
+ * each immediately followed by its payload, come after this header.
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;         /*!< ESP_METRICS_BLOB_MAGIC */
+    uint8_t version;        /*!< ESP_METRICS_BLOB_VERSION */
+    uint8_t num_sections;   /*!< Number of sections following the header */
+    uint16_t reserved;      /*!< Zero */
+    int64_t timestamp_us;   /*!< Time of the snapshot, microseconds since boot */
+} esp_metrics_blob_header_t;
+
+/**
+ * @brief Header in front of every section payload
+ */
+typedef struct __attribute__((packed)) {
+    char tag[ESP_METRICS_TAG_LEN];  /*!< Section tag, NUL padded (e.g. "heap") */
+    uint16_t version;               /*!< Version of the payload layout, owned by the provider */
+    uint16_t length;                /*!< Payload length in bytes */
+} esp_metrics_section_header_t;
+
+/**
+ * @brief Payload of the built-in "heap" section, version 1
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t internal_free;             /*!< Free bytes in internal heaps */
+    uint32_t internal_min_free;         /*!< Lifetime minimum of free internal bytes */
+    uint32_t internal_largest_block;    /*!< Largest free internal block */
+    uint32_t internal_allocated;        /*!< Allocated bytes in internal heaps */
+    uint32_t spiram_free;               /*!< Free bytes in SPIRAM heaps, 0 without SPIRAM */
+    uint32_t spiram_min_free;           /*!< Lifetime minimum of free SPIRAM bytes */
+    uint32_t spiram_largest_block;      /*!< Largest free SPIRAM block */
+    uint32_t spiram_allocated;          /*!< Allocated bytes in SPIRAM heaps */
+} esp_metrics_heap_section_t;
+
+/**
+ * @brief Payload of the built-in "sched" section, version 1
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t tick_count;    /*!< Scheduler tick count */
+    uint32_t task_count;    /*!< Number of tasks, including suspended and blocked ones */
+    uint32_t idle_run_time; /*!< Idle task run time counter, 0 unless CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS */
+} esp_metrics_sched_section_t;
+
+/**
+ * @brief Section payload writer registered by a subsystem
+ *
+ * Runs in the task calling esp_metrics_snapshot(). The writer must stay within
+ * the snapshot latency budget: copy already-maintained counters, do not walk
+ * large data structures or take long-held locks.
+ *
+ * @param[out] payload Destination buffer for the section payload
+ * @param[in] max_size Capacity of `payload`, at least the `max_size` passed at registration
+ * @param[in] arg User argument given at registration
+ * @return Number of payload bytes written, 0 to omit the section from this snapshot
+ */
+typedef size_t (*esp_metrics_provider_cb_t)(void *payload, size_t max_size, void *arg);
+
+#if CONFIG_ESP_SYSTEM_METRICS || __DOXYGEN__
+
+/**
+ * @brief Register a metrics section provider
+ *
+ * @param[in] tag Section tag, at most ESP_METRICS_TAG_LEN - 1 characters
+ * @param[in] version Version of the section payload layout
+ * @param[in] max_size Maximum payload size the provider may write
+ * @param[in] cb Payload writer
+ * @param[in] arg User argument passed to `cb`
+ * @return
+ *      - ESP_OK: Provider registered successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument (e.g. tag too long)
+ *      - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t esp_metrics_register_provider(const char *tag, uint16_t version, size_t max_size,
+                                        esp_metrics_provider_cb_t cb, void *arg);
+
+/**
+ * @brief Unregister a previously registered metrics section provider
+ *
+ * @param[in] cb Payload writer given at registration
+ * @param[in] arg User argument given at registration
+ * @return
+ *      - ESP_OK: Provider unregistered successfully
+ *      - ESP_ERR_NOT_FOUND: No provider registered with this cb/arg pair
+ */
+esp_err_t esp_metrics_unregister_provider(esp_metrics_provider_cb_t cb, void *arg);
+
+/**
+ * @brief Serialize a snapshot of all metrics sections into one binary blob
+ *
+ * Writes the blob header, the built-in "heap" and "sched" sections and one
+ * section per registered provider into `buf`. The call only copies counters
+ * that the subsystems maintain anyway, so it is cheap enough to run from a
+ * periodic telemetry task.
+ *
+ * @param[out] buf Destination buffer for the blob
+ * @param[in] buf_size Capacity of `buf`
+ * @param[out] out_size Number of bytes written
+ * @return
+ *      - ESP_OK: Snapshot serialized successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_INVALID_SIZE: `buf` too small; `out_size` holds the valid partial length
+ */
+esp_err_t esp_metrics_snapshot(void *buf, size_t buf_size, size_t *out_size);
+
+#else // CONFIG_ESP_SYSTEM_METRICS
+
+static inline esp_err_t esp_metrics_register_provider(const char *tag, uint16_t version, size_t max_size,
+                                                      esp_metrics_provider_cb_t cb, void *arg)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static inline esp_err_t esp_metrics_unregister_provider(esp_metrics_provider_cb_t cb, void *arg)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static inline esp_err_t esp_metrics_snapshot(void *buf, size_t buf_size, size_t *out_size)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif // CONFIG_ESP_SYSTEM_METRICS
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * Statistical profiler that samples the interrupted program counter from the
+ * FreeRTOS tick interrupt into a per-core histogram. The dump is consumed by
+ * tools/placement_optimizer.py, which turns measured heat into linker.lf
+ * placement fragments for the next build.
+ *
+ * On RISC-V the sampled PC comes from the mepc CSR and is exact. On Xtensa it
+ * comes from EPC1, which a window exception inside the tick path may have
+ * overwritten by the time the hook runs; the occasional stray sample lands in
+ * the tick/port code and is filtered on the host with --exclude.
+ */
+
+#if CONFIG_ESP_SYSTEM_PC_SAMPLING || __DOXYGEN__
+
+/**
+ * @brief Allocate the per-core sample tables and start sampling on every core
+ *
+ * @return
+ *      - ESP_OK: Sampling started successfully
+ *      - ESP_ERR_INVALID_STATE: Sampling is already running
+ *      - ESP_ERR_NO_MEM: Out of memory
+ */
+esp_err_t esp_pc_sample_start(void);
+
+/**
+ * @brief Stop sampling, keeping the accumulated histogram for esp_pc_sample_dump()
+ *
+ * @return
+ *      - ESP_OK: Sampling stopped successfully
+ *      - ESP_ERR_INVALID_STATE: Sampling was not running
+ */
+esp_err_t esp_pc_sample_stop(void);
+
+/**
+ * @brief Clear the accumulated histogram and dropped-sample counters
+ */
+void esp_pc_sample_reset(void);
+
+/**
+ * @brief Write the histogram to a stream in the placement optimizer's format
+ *
+ * One `pc_sample: <address> <count>` line per occupied slot, a
+ * `pc_sample_dropped: <count>` line per core, and a final `pc_sample_end`
+ * marker. Stop sampling first for a consistent dump. The stream can be any
+ * VFS-backed FILE, so the profile can leave the device over the console, a
+ * file system or a socket.
+ *
+ * @param[in] out Destination stream
+ * @return
+ *      - ESP_OK: Histogram written successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_INVALID_STATE: Sampling has never been started
+ */
+esp_err_t esp_pc_sample_dump(FILE *out);
+
+#else // CONFIG_ESP_SYSTEM_PC_SAMPLING
+
+static inline esp_err_t esp_pc_sample_start(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static inline esp_err_t esp_pc_sample_stop(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static inline void esp_pc_sample_reset(void)
+{
+}
+
+static inline esp_err_t esp_pc_sample_dump(FILE *out)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif // CONFIG_ESP_SYSTEM_PC_SAMPLING
+
+#ifdef __cplusplus
+}
+#endif
@@ -87,6 +87,21 @@ typedef struct {
 #define ESP_SYSTEM_INIT_ALL_CORES (BIT(SOC_CPU_CORES_NUM) - 1)
 #endif
 
+/**
+ * Flag bit of the `cores` mask marking an init function which runs exactly once,
+ * on whichever core reaches it first while the other core is still busy with its
+ * own part of the init sequence.
+ *
+ * This is a dependency annotation: by using ESP_SYSTEM_INIT_ANY_CORE the author
+ * asserts that the function does not depend on any other init function of the
+ * same stage which could still be running concurrently on another core, only on
+ * the stages that have already completed. Functions keep their priority order
+ * relative to other entries executed by the same core.
+ *
+ * On single core configurations this is equivalent to ESP_SYSTEM_INIT_ALL_CORES.
+ */
+#define ESP_SYSTEM_INIT_ANY_CORE (BIT(15) | ESP_SYSTEM_INIT_ALL_CORES)
+
 extern uint64_t g_startup_time;   // Startup time that serves as the point of origin for system time. Should be set by the entry
 // function in the port layer. May be 0 as well if this is not backed by a persistent counter, in which case
 // startup time = system time = 0 at the point the entry function sets this variable.
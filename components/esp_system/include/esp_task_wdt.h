@@ -89,6 +89,23 @@ esp_err_t esp_task_wdt_deinit(void);
  */
 esp_err_t esp_task_wdt_add(TaskHandle_t task_handle);
 
+/**
+ * @brief Subscribe a task to the Task Watchdog Timer (TWDT) with its own timeout
+ *
+ * Same as esp_task_wdt_add(), but the task gets its own timeout class instead of the global
+ * timeout. The class is tracked in multiples of the configured TWDT period, so the period set in
+ * esp_task_wdt_config_t::timeout_ms is the granularity: configure it to the shortest leash needed
+ * (e.g. 100 ms) and give long-running tasks a larger timeout here. Timeouts are rounded up to the
+ * next period; a timeout of 0 behaves exactly like esp_task_wdt_add().
+ *
+ * @param task_handle Handle of the task. Input NULL to subscribe the current running task to the TWDT
+ * @param[in] timeout_ms Timeout of this task in milliseconds, rounded up to a multiple of the TWDT period
+ * @return
+ *  - ESP_OK: Successfully subscribed the task to the TWDT
+ *  - Other: Failed to subscribe task
+ */
+esp_err_t esp_task_wdt_add_with_timeout(TaskHandle_t task_handle, uint32_t timeout_ms);
+
 /**
  * @brief Subscribe a user to the Task Watchdog Timer (TWDT)
  *
@@ -130,6 +147,47 @@ esp_err_t esp_task_wdt_reset(void);
  */
 esp_err_t esp_task_wdt_reset_user(esp_task_wdt_user_handle_t user_handle);
 
+/**
+ * @brief Feed the TWDT and yield from a busy loop, at near-zero average cost
+ *
+ * Long CPU-bound loops traditionally sprinkle vTaskDelay(1) to keep the TWDT fed, giving up a full tick each time.
+ * This function is designed to be called from the body of such loops instead: it is a cycle-count comparison on most
+ * invocations, and roughly once per millisecond it resets the TWDT for the calling task (if subscribed) and yields
+ * only when another ready task shares the caller's priority, so the core stays busy when nothing else wants it.
+ *
+ * @note Must be called from task context.
+ */
+void esp_task_wdt_yield_if_needed(void);
+
+/**
+ * @brief Mark the start of a compute phase with an extended TWDT deadline
+ *
+ * During a registered compute phase the calling task is allowed to miss up to extra_periods additional TWDT periods
+ * before it is treated as hung, i.e. its effective deadline becomes (extra_periods + 1) times the configured timeout.
+ * Other subscribed tasks keep their normal deadline. Use this around compute kernels whose worst-case runtime is
+ * known to exceed the global timeout, instead of inflating the timeout for the whole system.
+ *
+ * @note The calling task must already be subscribed to the TWDT.
+ * @param[in] extra_periods Number of additional TWDT periods tolerated without a reset
+ * @return
+ *  - ESP_OK: Compute phase registered
+ *  - ESP_ERR_NOT_FOUND: The calling task is not subscribed
+ *  - ESP_ERR_INVALID_STATE: TWDT was never initialized
+ */
+esp_err_t esp_task_wdt_begin_compute_phase(uint32_t extra_periods);
+
+/**
+ * @brief Mark the end of a compute phase, restoring the normal TWDT deadline
+ *
+ * Also counts as a reset on behalf of the calling task.
+ *
+ * @return
+ *  - ESP_OK: Compute phase ended
+ *  - ESP_ERR_NOT_FOUND: The calling task is not subscribed
+ *  - ESP_ERR_INVALID_STATE: TWDT was never initialized
+ */
+esp_err_t esp_task_wdt_end_compute_phase(void);
+
 /**
  * @brief Unsubscribes a task from the Task Watchdog Timer (TWDT)
  *
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Descriptor of an RTC-persisted state snapshot
+ *
+ * The data buffer must be placed in RTC memory (e.g. declared with
+ * RTC_NOINIT_ATTR) so that its contents survive deep sleep. The descriptor
+ * itself may live in normal memory; it is re-registered on every boot.
+ */
+typedef struct {
+    const char *name;   /*!< Short identifier of the snapshot, used for matching and logs */
+    void *data;         /*!< RTC-resident buffer holding the state */
+    size_t size;        /*!< Size of the buffer, in bytes */
+} esp_warm_boot_snapshot_t;
+
+/**
+ * @brief One entry of the warm-boot phase timing record, see esp_warm_boot_get_phases()
+ */
+typedef struct {
+    const char *phase;  /*!< Phase name passed to esp_warm_boot_mark() */
+    int64_t time_us;    /*!< Timestamp of the mark, in microseconds since boot */
+} esp_warm_boot_phase_t;
+
+/**
+ * @brief Register a state snapshot to be persisted across deep sleep
+ *
+ * A checksum of the snapshot data is recorded in RTC memory right before
+ * entering deep sleep. After wake, esp_warm_boot_snapshot_valid() reports
+ * whether the buffer still matches that checksum, allowing the owning
+ * component to restore its state from the snapshot instead of recomputing it.
+ *
+ * Registration only lasts until the next reset, so components must register
+ * their snapshots again on every boot (typically during driver installation).
+ *
+ * @param[in] snapshot Snapshot descriptor, copied by this call
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if the descriptor is incomplete
+ *      - ESP_ERR_NO_MEM if the snapshot table is full
+ */
+esp_err_t esp_warm_boot_snapshot_register(const esp_warm_boot_snapshot_t *snapshot);
+
+/**
+ * @brief Check whether a snapshot survived deep sleep intact
+ *
+ * Returns true only when the chip woke from deep sleep, the snapshot was
+ * sealed before entering sleep, and the checksum of the buffer contents still
+ * matches the sealed one. On any other reset (power-on, panic, brownout, ...)
+ * this returns false and the caller must fall back to a full re-initialization.
+ *
+ * @param[in] snapshot Snapshot descriptor, matching a previous registration by name
+ * @return true if the snapshot contents are valid and may be restored
+ */
+bool esp_warm_boot_snapshot_valid(const esp_warm_boot_snapshot_t *snapshot);
+
+/**
+ * @brief Record a named timestamp in the warm-boot phase timing record
+ *
+ * Intended to bracket the expensive steps of the resume path (clock setup,
+ * driver restore, first sample, ...). The record holds a limited number of
+ * entries; further marks are silently dropped.
+ *
+ * @param[in] phase Phase name, must point to a string with static storage duration
+ */
+void esp_warm_boot_mark(const char *phase);
+
+/**
+ * @brief Retrieve the phase timestamps recorded since this boot
+ *
+ * @param[out] out_phases Array to fill with the recorded entries
+ * @param[in] max_phases  Capacity of `out_phases`
+ * @return Number of entries written
+ */
+size_t esp_warm_boot_get_phases(esp_warm_boot_phase_t *out_phases, size_t max_phases);
+
+#ifdef __cplusplus
+}
+#endif
@@ -329,7 +329,13 @@ void esp_panic_handler(panic_info_t *info)
     // start panic WDT to restart system if we hang in this handler
     if (!wdt_hal_is_enabled(&rtc_wdt_ctx)) {
         wdt_hal_init(&rtc_wdt_ctx, WDT_RWDT, 0, false);
+#if CONFIG_ESP_SYSTEM_PANIC_SILENT_REBOOT && CONFIG_ESP_COREDUMP_CAPTURE_CURRENT_TASK_ONLY
+        // Nothing is printed and the core dump is a single task written to flash,
+        // so a much shorter backstop bounds the crash-to-reboot time.
+        uint32_t stage_timeout_ticks = (uint32_t)(1000ULL * rtc_clk_slow_freq_get_hz() / 1000ULL);
+#else
         uint32_t stage_timeout_ticks = (uint32_t)(7000ULL * rtc_clk_slow_freq_get_hz() / 1000ULL);
+#endif
         wdt_hal_write_protect_disable(&rtc_wdt_ctx);
         wdt_hal_config_stage(&rtc_wdt_ctx, WDT_STAGE0, stage_timeout_ticks, WDT_STAGE_ACTION_RESET_SYSTEM);
         // 64KB of core dump data (stacks of about 30 tasks) will produce ~85KB base64 data.
@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <string.h>
+#include <inttypes.h>
 
 #include "esp_attr.h"
 #include "esp_err.h"
@@ -19,9 +20,14 @@
 
 #include "soc/soc_caps.h"
 #include "esp_cpu.h"
+#include "esp_rom_sys.h"
 
 #include "esp_private/startup_internal.h"
 
+#if CONFIG_ESP_SYSTEM_BOOT_TIMELINE
+#include "esp_boot_timeline.h"
+#endif
+
 // Ensure that system configuration matches the underlying number of cores.
 // This should enable us to avoid checking for both every time.
 #if !(SOC_CPU_CORES_NUM > 1) && !CONFIG_ESP_SYSTEM_SINGLE_CORE_MODE
@@ -90,22 +96,69 @@ static void do_global_ctors(void)
 #endif // CONFIG_COMPILER_CXX_EXCEPTIONS
 
     void (**p)(void);
+#if CONFIG_ESP_SYSTEM_GLOBAL_CTOR_TIME_REPORT
+    uint32_t total_cycles = 0;
+#endif
 
 #if __riscv
     for (p = &__init_priority_array_start; p < &__init_priority_array_end; ++p) {
         ESP_LOGD(TAG, "calling init function: %p", *p);
+#if CONFIG_ESP_SYSTEM_GLOBAL_CTOR_TIME_REPORT
+        uint32_t start_cycles = esp_cpu_get_cycle_count();
+#endif
         (*p)();
+#if CONFIG_ESP_SYSTEM_GLOBAL_CTOR_TIME_REPORT
+        uint32_t ctor_cycles = esp_cpu_get_cycle_count() - start_cycles;
+        total_cycles += ctor_cycles;
+        ESP_EARLY_LOGI(TAG, "global ctor %p: %" PRIu32 " us",
+                       *p, ctor_cycles / esp_rom_get_cpu_ticks_per_us());
+#endif
     }
 #endif
 
     ESP_COMPILER_DIAGNOSTIC_PUSH_IGNORE("-Wanalyzer-out-of-bounds")
     for (p = &__init_array_end - 1; p >= &__init_array_start; --p) {
         ESP_LOGD(TAG, "calling init function: %p", *p);
+#if CONFIG_ESP_SYSTEM_GLOBAL_CTOR_TIME_REPORT
+        uint32_t start_cycles = esp_cpu_get_cycle_count();
+#endif
         (*p)();
+#if CONFIG_ESP_SYSTEM_GLOBAL_CTOR_TIME_REPORT
+        uint32_t ctor_cycles = esp_cpu_get_cycle_count() - start_cycles;
+        total_cycles += ctor_cycles;
+        ESP_EARLY_LOGI(TAG, "global ctor %p: %" PRIu32 " us",
+                       *p, ctor_cycles / esp_rom_get_cpu_ticks_per_us());
+#endif
     }
     ESP_COMPILER_DIAGNOSTIC_POP("-Wanalyzer-out-of-bounds")
 
+#if CONFIG_ESP_SYSTEM_GLOBAL_CTOR_TIME_REPORT
+    ESP_EARLY_LOGI(TAG, "global ctors: %" PRIu32 " us total",
+                   total_cycles / esp_rom_get_cpu_ticks_per_us());
+#endif
+}
+
+#if !CONFIG_ESP_SYSTEM_SINGLE_CORE_MODE
+// Claim bitmap for ESP_SYSTEM_INIT_ANY_CORE entries, indexed by the position of
+// the entry in the init function array. Entries beyond the bitmap capacity are
+// executed by core 0 only.
+#define INIT_FN_CLAIM_MAX   128
+static volatile uint32_t s_init_fn_claimed[INIT_FN_CLAIM_MAX / 32];
+
+static bool do_init_fn_claim(size_t index)
+{
+    volatile uint32_t *word = &s_init_fn_claimed[index / 32];
+    uint32_t mask = BIT(index % 32);
+    uint32_t val;
+    do {
+        val = *word;
+        if (val & mask) {
+            return false;
+        }
+    } while (!esp_cpu_compare_and_set(word, val, val | mask));
+    return true;
 }
+#endif // !CONFIG_ESP_SYSTEM_SINGLE_CORE_MODE
 
 /**
  * @brief Call component init functions defined using ESP_SYSTEM_INIT_Fn macros.
@@ -123,20 +176,51 @@ static void do_system_init_fn(uint32_t stage_num)
     extern esp_system_init_fn_t _esp_system_init_fn_array_end;
 
     esp_system_init_fn_t *p;
+#if CONFIG_ESP_SYSTEM_INIT_TIME_REPORT
+    uint32_t busy_cycles = 0;
+#endif
 
     int core_id = esp_cpu_get_core_id();
     for (p = &_esp_system_init_fn_array_start; p < &_esp_system_init_fn_array_end; ++p) {
-        if (p->stage == stage_num && (p->cores & BIT(core_id)) != 0) {
-            // During core init, stdout is not initialized yet, so use early logging.
-            ESP_EARLY_LOGD(TAG, "calling init function: %p on core: %d", p->fn, core_id);
-            esp_err_t err = (*(p->fn))();
-            if (err != ESP_OK) {
-                ESP_EARLY_LOGE(TAG, "init function %p has failed (0x%x), aborting", p->fn, err);
-                abort();
+        if (p->stage != stage_num || (p->cores & BIT(core_id)) == 0) {
+            continue;
+        }
+#if !CONFIG_ESP_SYSTEM_SINGLE_CORE_MODE
+        if (p->cores & ~((uint16_t)ESP_SYSTEM_INIT_ALL_CORES)) {
+            // ESP_SYSTEM_INIT_ANY_CORE entry: runs once, on the first core that claims it
+            size_t index = p - &_esp_system_init_fn_array_start;
+            if (index < INIT_FN_CLAIM_MAX) {
+                if (!do_init_fn_claim(index)) {
+                    continue;
+                }
+            } else if (core_id != 0) {
+                continue;
             }
         }
+#endif
+        // During core init, stdout is not initialized yet, so use early logging.
+        ESP_EARLY_LOGD(TAG, "calling init function: %p on core: %d", p->fn, core_id);
+#if CONFIG_ESP_SYSTEM_INIT_TIME_REPORT
+        uint32_t start_cycles = esp_cpu_get_cycle_count();
+#endif
+        esp_err_t err = (*(p->fn))();
+        if (err != ESP_OK) {
+            ESP_EARLY_LOGE(TAG, "init function %p has failed (0x%x), aborting", p->fn, err);
+            abort();
+        }
+#if CONFIG_ESP_SYSTEM_INIT_TIME_REPORT
+        uint32_t fn_cycles = esp_cpu_get_cycle_count() - start_cycles;
+        busy_cycles += fn_cycles;
+        ESP_EARLY_LOGI(TAG, "init function %p: %" PRIu32 " us on core %d",
+                       p->fn, fn_cycles / esp_rom_get_cpu_ticks_per_us(), core_id);
+#endif
     }
 
+#if CONFIG_ESP_SYSTEM_INIT_TIME_REPORT
+    ESP_EARLY_LOGI(TAG, "init stage %" PRIu32 ": core %d busy for %" PRIu32 " us",
+                   stage_num, core_id, busy_cycles / esp_rom_get_cpu_ticks_per_us());
+#endif
+
 #if !CONFIG_ESP_SYSTEM_SINGLE_CORE_MODE
     s_system_inited[core_id] = true;
 #endif
@@ -199,12 +283,21 @@ static void do_secondary_init(void)
 
 static void start_cpu0_default(void)
 {
+#if CONFIG_ESP_SYSTEM_BOOT_TIMELINE
+    esp_boot_timeline_mark("core_init");
+#endif
     // Initialize core components and services.
     do_core_init();
 
+#if CONFIG_ESP_SYSTEM_BOOT_TIMELINE
+    esp_boot_timeline_mark("global_ctors");
+#endif
     // Execute constructors.
     do_global_ctors();
 
+#if CONFIG_ESP_SYSTEM_BOOT_TIMELINE
+    esp_boot_timeline_mark("secondary_init");
+#endif
     // Execute init functions of other components; blocks
     // until all cores finish (when !CONFIG_ESP_SYSTEM_SINGLE_CORE_MODE).
     do_secondary_init();
@@ -213,6 +306,9 @@ static void start_cpu0_default(void)
     s_system_full_inited = true;
 #endif
 
+#if CONFIG_ESP_SYSTEM_BOOT_TIMELINE
+    esp_boot_timeline_mark("scheduler_start");
+#endif
     esp_startup_start_app();
 
     ESP_INFINITE_LOOP();
@@ -17,8 +17,10 @@
 #include "esp_attr.h"
 #include "esp_check.h"
 #include "esp_log.h"
+#include "esp_cpu.h"
 #include "esp_debug_helpers.h"
 #include "esp_freertos_hooks.h"
+#include "esp_private/esp_clk.h"
 #include "esp_task_wdt.h"
 #include "esp_private/system_internal.h"
 #include "esp_private/crosscore_int.h"
@@ -66,6 +68,10 @@ struct twdt_entry {
     TaskHandle_t task_handle;   // NULL if user entry
     const char *user_name;      // NULL if task entry
     bool has_reset;
+    uint32_t timeout_ms;        // Requested timeout class, 0 = use the global timeout
+    uint32_t extra_periods;     // Extra periods granted by the timeout class (derived from timeout_ms)
+    uint32_t grace_periods;     // Extra periods tolerated during a compute phase (0 = normal deadline)
+    uint32_t periods_missed;    // Consecutive periods elapsed without a reset
 };
 
 // Structure used to hold run time configuration of the TWDT
@@ -74,6 +80,7 @@ struct twdt_obj {
     twdt_ctx_t impl_ctx;
     SLIST_HEAD(entry_list_head, twdt_entry) entries_slist;
     uint32_t idle_core_mask;    // Current core's who's idle tasks are subscribed
+    uint32_t period_ms;         // Configured timer period, granularity of per-task timeout classes
     bool panic; // Flag to trigger panic when TWDT times out
     bool waiting_for_task; // Flag to start the timer as soon as a task is added
 };
@@ -109,6 +116,34 @@ static void task_wdt_timer_feed(void)
     }
 }
 
+/**
+ * @brief Convert a per-entry timeout class to a number of extra timer periods
+ *
+ * Timeout classes are tracked in multiples of the configured timer period: an entry with a
+ * timeout of N periods only counts as hung after N consecutive periods without a reset.
+ * Timeouts shorter than the period round up to one period; 0 means the global timeout.
+ * When entering this function, the spinlock has already been taken, no need to take it back.
+ *
+ * @param[in] timeout_ms Requested timeout in milliseconds, 0 for the global timeout
+ * @return Number of extra periods tolerated before the entry counts as hung
+ */
+static uint32_t timeout_to_extra_periods(uint32_t timeout_ms)
+{
+    if (timeout_ms <= p_twdt_obj->period_ms || p_twdt_obj->period_ms == 0) {
+        return 0;
+    }
+    return (timeout_ms - 1) / p_twdt_obj->period_ms;
+}
+
+/**
+ * @brief Whether an entry has exhausted its timeout class and grace allowance
+ * When entering this function, the spinlock has already been taken, no need to take it back.
+ */
+static bool entry_is_hung(const twdt_entry_t *entry)
+{
+    return !entry->has_reset && (entry->periods_missed >= entry->extra_periods + entry->grace_periods);
+}
+
 /**
  * @brief Checks whether a user entry exists and if all other entries have been reset
  *
@@ -164,10 +199,11 @@ static twdt_entry_t *find_entry_from_task_handle_and_check_all_reset(TaskHandle_
  *
  * @param[in] is_task Whether the entry is a task entry or user entry
  * @param[in] entry_data Data associated with the entry (either a task handle or user entry name)
+ * @param[in] timeout_ms Timeout class of the entry in milliseconds, 0 to use the global timeout
  * @param[out] entry_ret Pointer to created entry
  * @return ESP_OK if entry was added, failure otherwise
  */
-static esp_err_t add_entry(bool is_task, void *entry_data, twdt_entry_t **entry_ret)
+static esp_err_t add_entry(bool is_task, void *entry_data, uint32_t timeout_ms, twdt_entry_t **entry_ret)
 {
     esp_err_t ret;
 
@@ -181,10 +217,12 @@ static esp_err_t add_entry(bool is_task, void *entry_data, twdt_entry_t **entry_
     } else {
         entry->user_name = (const char *)entry_data;
     }
+    entry->timeout_ms = timeout_ms;
 
     portENTER_CRITICAL(&spinlock);
     // Check TWDT state
     ESP_GOTO_ON_FALSE_ISR((p_twdt_obj != NULL), ESP_ERR_INVALID_STATE, state_err, TAG, "task watchdog was never initialized");
+    entry->extra_periods = timeout_to_extra_periods(timeout_ms);
     // Check if the task is an entry, and if all entries have been reset
     bool all_reset;
     if (is_task) {
@@ -475,6 +513,27 @@ static void task_wdt_isr(void *arg)
     portENTER_CRITICAL_ISR(&spinlock);
     esp_task_wdt_impl_timeout_triggered(p_twdt_obj->impl_ctx);
 
+    /* Entries with a longer timeout class (see esp_task_wdt_add_with_timeout()) or inside a
+     * registered compute phase (see esp_task_wdt_begin_compute_phase()) are granted extra
+     * periods before they count as hung. If every late entry is still within its allowance,
+     * re-arm the timer and wait for the next period instead of timing out. */
+    bool any_triggered = false;
+    twdt_entry_t *late_entry;
+    SLIST_FOREACH(late_entry, &p_twdt_obj->entries_slist, slist_entry) {
+        if (!late_entry->has_reset) {
+            if (late_entry->periods_missed < late_entry->extra_periods + late_entry->grace_periods) {
+                late_entry->periods_missed++;
+            } else {
+                any_triggered = true;
+            }
+        }
+    }
+    if (!any_triggered) {
+        esp_task_wdt_impl_timer_feed(p_twdt_obj->impl_ctx);
+        portEXIT_CRITICAL_ISR(&spinlock);
+        return;
+    }
+
     /* Keep a bitmap of CPU cores having tasks that have not reset TWDT.
      * Bit 0 represents core 0, bit 1 represents core 1, and so on. */
     int cpus_fail = 0;
@@ -521,6 +580,7 @@ esp_err_t esp_task_wdt_init(const esp_task_wdt_config_t *config)
     ESP_GOTO_ON_FALSE((obj != NULL), ESP_ERR_NO_MEM, err, TAG, "insufficient memory");
     SLIST_INIT(&obj->entries_slist);
     obj->panic = config->trigger_panic;
+    obj->period_ms = config->timeout_ms;
 
     /* Allocate the timer itself, NOT STARTED */
     ret = esp_task_wdt_impl_timer_allocate(config, task_wdt_isr, &obj->impl_ctx);
@@ -575,6 +635,16 @@ esp_err_t esp_task_wdt_reconfigure(const esp_task_wdt_config_t *config)
         goto err;
     }
 
+    /* The period changed, recompute the timeout classes of the subscribed entries */
+    if (p_twdt_obj->period_ms != config->timeout_ms) {
+        p_twdt_obj->period_ms = config->timeout_ms;
+        twdt_entry_t *entry;
+        SLIST_FOREACH(entry, &p_twdt_obj->entries_slist, slist_entry) {
+            entry->extra_periods = timeout_to_extra_periods(entry->timeout_ms);
+            entry->periods_missed = 0;
+        }
+    }
+
     old_core_mask = p_twdt_obj->idle_core_mask;
     /* If the new mask is different than the old one, we have to subscribe the new idle tasks */
     if (old_core_mask != config->idle_core_mask) {
@@ -673,7 +743,21 @@ esp_err_t esp_task_wdt_add(TaskHandle_t task_handle)
     }
 
     twdt_entry_t *entry;
-    ret = add_entry(true, (void *)task_handle, &entry);
+    ret = add_entry(true, (void *)task_handle, 0, &entry);
+    (void) entry; // Returned entry pointer not used
+    return ret;
+}
+
+esp_err_t esp_task_wdt_add_with_timeout(TaskHandle_t task_handle, uint32_t timeout_ms)
+{
+    ESP_RETURN_ON_FALSE(p_twdt_obj != NULL, ESP_ERR_INVALID_STATE, TAG, "TWDT was never initialized");
+    esp_err_t ret;
+    if (task_handle == NULL) {   // Get handle of current task if none is provided
+        task_handle = xTaskGetCurrentTaskHandle();
+    }
+
+    twdt_entry_t *entry;
+    ret = add_entry(true, (void *)task_handle, timeout_ms, &entry);
     (void) entry; // Returned entry pointer not used
     return ret;
 }
@@ -684,7 +768,7 @@ esp_err_t esp_task_wdt_add_user(const char *user_name, esp_task_wdt_user_handle_
     ESP_RETURN_ON_FALSE(p_twdt_obj != NULL, ESP_ERR_INVALID_STATE, TAG, "TWDT was never initialized");
     esp_err_t ret;
     twdt_entry_t *entry;
-    ret = add_entry(false, (void *)user_name, &entry);
+    ret = add_entry(false, (void *)user_name, 0, &entry);
     if (ret == ESP_OK) {
         *user_handle_ret = (esp_task_wdt_user_handle_t)entry;
     }
@@ -705,6 +789,7 @@ esp_err_t esp_task_wdt_reset(void)
     ESP_GOTO_ON_FALSE_ISR((entry != NULL), ESP_ERR_NOT_FOUND, err, TAG, "task not found");
     // Mark entry as reset and issue timer reset if all entries have been reset
     entry->has_reset = true;    // Reset the task if it's on the task list
+    entry->periods_missed = 0;
     if (all_reset) {    // Reset if all other tasks in list have reset in
         task_wdt_timer_feed();
     }
@@ -729,6 +814,7 @@ esp_err_t esp_task_wdt_reset_user(esp_task_wdt_user_handle_t user_handle)
     ESP_GOTO_ON_FALSE_ISR(entry_found, ESP_ERR_NOT_FOUND, err, TAG, "user handle not found");
     // Mark entry as reset and issue timer reset if all entries have been reset
     entry->has_reset = true;    // Reset the task if it's on the task list
+    entry->periods_missed = 0;
     if (all_reset) {    // Reset if all other tasks in list have reset in
         task_wdt_timer_feed();
     }
@@ -739,6 +825,67 @@ err:
     return ret;
 }
 
+static esp_err_t task_wdt_set_grace_periods(uint32_t grace_periods)
+{
+    ESP_RETURN_ON_FALSE(p_twdt_obj != NULL, ESP_ERR_INVALID_STATE, TAG, "TWDT was never initialized");
+    esp_err_t ret;
+    TaskHandle_t handle = xTaskGetCurrentTaskHandle();
+
+    portENTER_CRITICAL(&spinlock);
+    bool all_reset;
+    twdt_entry_t *entry = find_entry_from_task_handle_and_check_all_reset(handle, &all_reset);
+    ESP_GOTO_ON_FALSE_ISR((entry != NULL), ESP_ERR_NOT_FOUND, err, TAG, "task not found");
+    entry->grace_periods = grace_periods;
+    entry->periods_missed = 0;
+    // Entering or leaving a compute phase counts as a feed on behalf of the task
+    entry->has_reset = true;
+    if (all_reset) {
+        task_wdt_timer_feed();
+    }
+    ret = ESP_OK;
+err:
+    portEXIT_CRITICAL(&spinlock);
+
+    return ret;
+}
+
+esp_err_t esp_task_wdt_begin_compute_phase(uint32_t extra_periods)
+{
+    return task_wdt_set_grace_periods(extra_periods);
+}
+
+esp_err_t esp_task_wdt_end_compute_phase(void)
+{
+    return task_wdt_set_grace_periods(0);
+}
+
+void esp_task_wdt_yield_if_needed(void)
+{
+    static uint32_t check_interval_cycles;
+    static uint32_t next_check_cycles[CONFIG_FREERTOS_NUMBER_OF_CORES];
+
+    uint32_t now = esp_cpu_get_cycle_count();
+    uint32_t core = xPortGetCoreID();
+    /* Fast path: nothing to do until the next check point. A task migrating
+     * cores between the two reads can at worst check one interval early. */
+    if ((int32_t)(now - next_check_cycles[core]) < 0) {
+        return;
+    }
+    if (check_interval_cycles == 0) {
+        // Check roughly once per millisecond of busy work
+        check_interval_cycles = esp_clk_cpu_freq() / 1000;
+    }
+    next_check_cycles[core] = now + check_interval_cycles;
+
+    // Not all callers are subscribed to the TWDT; feeding is best-effort
+    (void) esp_task_wdt_reset();
+
+    // Hand the core over only if a time-slice peer is actually waiting for it
+    if (xTaskEqualPriorityTaskReady() == pdTRUE) {
+        taskYIELD();
+    }
+}
+
 esp_err_t esp_task_wdt_delete(TaskHandle_t task_handle)
 {
     ESP_RETURN_ON_FALSE(p_twdt_obj != NULL, ESP_ERR_INVALID_STATE, TAG, "TWDT was never initialized");
@@ -794,9 +941,9 @@ esp_err_t esp_task_wdt_print_triggered_tasks(task_wdt_msg_handler msg_handler, v
         msg_handler(opaque, caption);
     }
 
-    // Find what entries triggered the TWDT timeout (i.e., which entries have not been reset)
+    // Find what entries triggered the TWDT timeout (i.e., which entries exhausted their allowance)
     SLIST_FOREACH(entry, &p_twdt_obj->entries_slist, slist_entry) {
-        if (!entry->has_reset) {
+        if (entry_is_hung(entry)) {
             const char *cpu;
             const char *name = entry->task_handle ? pcTaskGetName(entry->task_handle) : entry->user_name;
             const UBaseType_t affinity = get_task_affinity(entry->task_handle);
@@ -216,6 +216,28 @@ esp_err_t esp_timer_stop(esp_timer_handle_t timer);
  */
 esp_err_t esp_timer_delete(esp_timer_handle_t timer);
 
+#if CONFIG_ESP_TIMER_ISR_CALLBACK_BUDGET || __DOXYGEN__
+/**
+ * @brief Declare a run time budget for the ISR dispatch callback of a timer
+ *
+ * Only effective for timers created with ::esp_timer_create_args_t::dispatch_method
+ * set to ESP_TIMER_ISR, and requires Kconfig option
+ * `CONFIG_ESP_TIMER_ISR_CALLBACK_BUDGET`. The callback run time is measured
+ * with the CPU cycle counter on every dispatch. When a callback overruns its
+ * budget, a warning is logged and the timer is demoted to the task dispatch
+ * method, so that a single slow callback cannot keep delaying the other ISR
+ * dispatch callbacks.
+ *
+ * @param timer timer handle created using esp_timer_create()
+ * @param budget_us maximum expected callback run time, in microseconds.
+ *                  0 (the default) disables enforcement for this timer.
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if the handle is invalid
+ */
+esp_err_t esp_timer_set_isr_budget(esp_timer_handle_t timer, uint32_t budget_us);
+#endif // CONFIG_ESP_TIMER_ISR_CALLBACK_BUDGET || __DOXYGEN__
+
 /**
  * @brief Get time in microseconds since boot
  * @return Number of microseconds since the initialization of ESP Timer
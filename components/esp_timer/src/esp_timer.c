@@ -23,10 +23,23 @@
 #include "esp_private/system_internal.h"
 #include "sdkconfig.h"
 
+#ifdef CONFIG_ESP_TIMER_ISR_CALLBACK_BUDGET
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#endif
+
 #ifdef CONFIG_ESP_TIMER_PROFILING
 #define WITH_PROFILING 1
 #endif
 
+#ifdef CONFIG_ESP_TIMER_TIMING_WHEEL
+#define WITH_TIMING_WHEEL 1
+#endif
+
+#ifdef CONFIG_ESP_TIMER_ISR_CALLBACK_BUDGET
+#define WITH_ISR_BUDGET 1
+#endif
+
 #ifndef NDEBUG
 // Enable built-in checks in queue.h in debug builds
 #define INVARIANTS
@@ -49,6 +62,9 @@ struct esp_timer {
         uint32_t event_id;
     };
     void* arg;
+#if WITH_ISR_BUDGET
+    uint32_t isr_budget_us;  //!< max expected callback run time for ISR dispatch, 0 = not enforced
+#endif
 #if WITH_PROFILING
     const char* name;
     size_t times_triggered;
@@ -73,10 +89,38 @@ static void timer_remove_inactive(esp_timer_handle_t timer);
 
 __attribute__((unused)) static const char* TAG = "esp_timer";
 
+#if WITH_TIMING_WHEEL
+/* Armed timers are kept in one hierarchical timing wheel per dispatch method
+ * instead of a single time-sorted list, making arm/disarm O(1) instead of
+ * O(number of armed timers). Level 0 slots are (1 << TIMER_WHEEL_RES_BITS) us
+ * wide; every next level is TIMER_WHEEL_SLOTS times coarser. Timers beyond the
+ * range of the last level wait on the overflow list. Timers of coarser levels
+ * are moved down (cascaded) as the wheel clock passes the start of their slot
+ * window, so the hardware alarm is still programmed with the exact expiry time
+ * once the next timer is on level 0.
+ */
+#define TIMER_WHEEL_RES_BITS     10                             // level 0 slot width: 1024 us
+#define TIMER_WHEEL_SLOT_BITS    6
+#define TIMER_WHEEL_SLOTS        (1 << TIMER_WHEEL_SLOT_BITS)   // slots per level
+#define TIMER_WHEEL_LEVELS       4                              // covered range: 2^34 us, about 4.7 hours
+
+typedef struct {
+    LIST_HEAD(esp_timer_list, esp_timer) slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+    struct esp_timer_list overflow;     // timers beyond the range of the last level
+    uint64_t clock;                     // level 0 slot of the last processed alarm
+    uint64_t next_alarm;                // alarm value currently programmed into the hardware
+} timer_wheel_t;
+
+// timing wheels of currently armed timers for two dispatch methods: ISR and TASK
+static timer_wheel_t s_timer_wheel[ESP_TIMER_MAX] = {
+    [0 ...(ESP_TIMER_MAX - 1)] = { .next_alarm = UINT64_MAX }
+};
+#else
 // lists of currently armed timers for two dispatch methods: ISR and TASK
 static LIST_HEAD(esp_timer_list, esp_timer) s_timers[ESP_TIMER_MAX] = {
     [0 ...(ESP_TIMER_MAX - 1)] = LIST_HEAD_INITIALIZER(s_timers)
 };
+#endif // WITH_TIMING_WHEEL
 #if WITH_PROFILING
 // lists of unarmed timers for two dispatch methods: ISR and TASK,
 // used only to be able to dump statistics about all the timers
@@ -92,6 +136,13 @@ static portMUX_TYPE s_timer_lock[ESP_TIMER_MAX] = {
     [0 ...(ESP_TIMER_MAX - 1)] = portMUX_INITIALIZER_UNLOCKED
 };
 
+#if WITH_PROFILING
+// longest time s_timer_lock was held with interrupts disabled, reported by esp_timer_dump()
+static uint64_t s_lock_max_held_us[ESP_TIMER_MAX];
+static uint64_t s_lock_enter_time[ESP_TIMER_MAX];
+static int s_lock_depth[ESP_TIMER_MAX];
+#endif
+
 #ifdef CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD
 // For ISR dispatch method, a callback function of the timer may require a context switch
 static volatile BaseType_t s_isr_dispatch_need_yield = pdFALSE;
@@ -291,11 +342,185 @@ esp_err_t esp_timer_delete(esp_timer_handle_t timer)
     return err;
 }
 
+#if WITH_ISR_BUDGET
+esp_err_t esp_timer_set_isr_budget(esp_timer_handle_t timer, uint32_t budget_us)
+{
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    timer->isr_budget_us = budget_us;
+    return ESP_OK;
+}
+#endif // WITH_ISR_BUDGET
+
+#if WITH_TIMING_WHEEL
+
+// Link a timer into the slot matching its expiry time. The list lock must be held.
+static IRAM_ATTR void timer_wheel_insert_timer(timer_wheel_t* wheel, esp_timer_handle_t timer)
+{
+    uint64_t alarm_ticks = timer->alarm >> TIMER_WHEEL_RES_BITS;
+    // overdue timers land in the current slot so that they are found immediately
+    uint64_t ticks = MAX(alarm_ticks, wheel->clock);
+    uint64_t delta = ticks - wheel->clock;
+    struct esp_timer_list* slot = &wheel->overflow;
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        if (delta < ((uint64_t)1 << ((level + 1) * TIMER_WHEEL_SLOT_BITS))) {
+            slot = &wheel->slots[level][(ticks >> (level * TIMER_WHEEL_SLOT_BITS)) & (TIMER_WHEEL_SLOTS - 1)];
+            break;
+        }
+    }
+    LIST_INSERT_HEAD(slot, timer, list_entry);
+}
+
+// Re-distribute the contents of one slot to the levels matching the current
+// wheel clock. Timers are drained to a temporary list first, as re-insertion
+// may put a timer back into the slot being cascaded.
+static IRAM_ATTR void timer_wheel_cascade(timer_wheel_t* wheel, struct esp_timer_list* slot)
+{
+    struct esp_timer_list pending = LIST_HEAD_INITIALIZER(pending);
+    esp_timer_handle_t it;
+    while ((it = LIST_FIRST(slot)) != NULL) {
+        LIST_REMOVE(it, list_entry);
+        LIST_INSERT_HEAD(&pending, it, list_entry);
+    }
+    while ((it = LIST_FIRST(&pending)) != NULL) {
+        LIST_REMOVE(it, list_entry);
+        timer_wheel_insert_timer(wheel, it);
+    }
+}
+
+// Advance the wheel clock to now_ticks, cascading every slot whose window start
+// has been passed. The work is bounded by the slot count of each level, not by
+// the distance travelled.
+static IRAM_ATTR void timer_wheel_advance(timer_wheel_t* wheel, uint64_t now_ticks)
+{
+    if (now_ticks <= wheel->clock) {
+        return;
+    }
+    const uint64_t old_ticks = wheel->clock;
+    wheel->clock = now_ticks;
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        uint64_t old_index = old_ticks >> (level * TIMER_WHEEL_SLOT_BITS);
+        uint64_t new_index = now_ticks >> (level * TIMER_WHEEL_SLOT_BITS);
+        if (new_index == old_index) {
+            break;  // this level did not move, so the coarser ones did not either
+        }
+        uint64_t steps = MIN(new_index - old_index, (uint64_t)TIMER_WHEEL_SLOTS);
+        for (uint64_t i = 1; i <= steps; ++i) {
+            timer_wheel_cascade(wheel, &wheel->slots[level][(old_index + i) & (TIMER_WHEEL_SLOTS - 1)]);
+        }
+    }
+    if ((old_ticks >> (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOT_BITS)) !=
+            (now_ticks >> (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOT_BITS))) {
+        // the whole wheel range has been passed, re-distribute the overflow timers
+        timer_wheel_cascade(wheel, &wheel->overflow);
+    }
+}
+
+// Remove and return a timer which is due at 'now', NULL if there is none
+static IRAM_ATTR esp_timer_handle_t timer_wheel_pop_due(timer_wheel_t* wheel, int64_t now)
+{
+    timer_wheel_advance(wheel, (uint64_t)now >> TIMER_WHEEL_RES_BITS);
+    struct esp_timer_list* slot = &wheel->slots[0][wheel->clock & (TIMER_WHEEL_SLOTS - 1)];
+    esp_timer_handle_t it;
+    LIST_FOREACH(it, slot, list_entry) {
+        if (it->alarm <= (uint64_t)now) {
+            LIST_REMOVE(it, list_entry);
+            return it;
+        }
+    }
+    return NULL;
+}
+
+/* Earliest time the hardware alarm has to fire. This is exact when the next
+ * timer is on level 0; for a timer on a coarser level it is the start of its
+ * slot window, at which point the timer cascades down and the alarm is
+ * re-evaluated at a finer granularity.
+ */
+static IRAM_ATTR uint64_t timer_wheel_next_hw_alarm(timer_wheel_t* wheel)
+{
+    uint64_t next_alarm = UINT64_MAX;
+    esp_timer_handle_t it;
+    for (unsigned i = 0; i < TIMER_WHEEL_SLOTS; ++i) {
+        struct esp_timer_list* slot = &wheel->slots[0][(wheel->clock + i) & (TIMER_WHEEL_SLOTS - 1)];
+        if (!LIST_EMPTY(slot)) {
+            LIST_FOREACH(it, slot, list_entry) {
+                next_alarm = MIN(next_alarm, it->alarm);
+            }
+            break;
+        }
+    }
+    for (int level = 1; level < TIMER_WHEEL_LEVELS; ++level) {
+        uint64_t index = wheel->clock >> (level * TIMER_WHEEL_SLOT_BITS);
+        for (unsigned i = 1; i < TIMER_WHEEL_SLOTS; ++i) {
+            if (!LIST_EMPTY(&wheel->slots[level][(index + i) & (TIMER_WHEEL_SLOTS - 1)])) {
+                next_alarm = MIN(next_alarm, (index + i) << (level * TIMER_WHEEL_SLOT_BITS + TIMER_WHEEL_RES_BITS));
+                break;
+            }
+        }
+    }
+    if (!LIST_EMPTY(&wheel->overflow)) {
+        next_alarm = MIN(next_alarm, ((wheel->clock >> (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOT_BITS)) + 1)
+                         << (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOT_BITS + TIMER_WHEEL_RES_BITS));
+    }
+    return next_alarm;
+}
+
+// Exact earliest alarm among the armed timers, for the next alarm query APIs
+static IRAM_ATTR uint64_t timer_wheel_min_alarm(timer_wheel_t* wheel, bool for_wake_up)
+{
+    uint64_t min_alarm = UINT64_MAX;
+    esp_timer_handle_t it;
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        for (unsigned i = 0; i < TIMER_WHEEL_SLOTS; ++i) {
+            LIST_FOREACH(it, &wheel->slots[level][i], list_entry) {
+                // timers with the SKIP_UNHANDLED_EVENTS flag do not want to wake up CPU from a sleep mode
+                if (for_wake_up && (it->flags & FL_SKIP_UNHANDLED_EVENTS)) {
+                    continue;
+                }
+                min_alarm = MIN(min_alarm, it->alarm);
+            }
+        }
+    }
+    LIST_FOREACH(it, &wheel->overflow, list_entry) {
+        if (for_wake_up && (it->flags & FL_SKIP_UNHANDLED_EVENTS)) {
+            continue;
+        }
+        min_alarm = MIN(min_alarm, it->alarm);
+    }
+    return min_alarm;
+}
+
+static bool timer_wheel_empty(timer_wheel_t* wheel)
+{
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        for (unsigned i = 0; i < TIMER_WHEEL_SLOTS; ++i) {
+            if (!LIST_EMPTY(&wheel->slots[level][i])) {
+                return false;
+            }
+        }
+    }
+    return LIST_EMPTY(&wheel->overflow);
+}
+
+#endif // WITH_TIMING_WHEEL
+
 static IRAM_ATTR esp_err_t timer_insert(esp_timer_handle_t timer, bool without_update_alarm)
 {
 #if WITH_PROFILING
     timer_remove_inactive(timer);
 #endif
+#if WITH_TIMING_WHEEL
+    esp_timer_dispatch_t dispatch_method = timer->flags & FL_ISR_DISPATCH_METHOD;
+    timer_wheel_t* wheel = &s_timer_wheel[dispatch_method];
+    timer_wheel_insert_timer(wheel, timer);
+    if (without_update_alarm == false && timer->alarm < wheel->next_alarm) {
+        wheel->next_alarm = timer->alarm;
+        esp_timer_impl_set_alarm_id(timer->alarm, dispatch_method);
+    }
+    return ESP_OK;
+}
+#else // WITH_TIMING_WHEEL
     esp_timer_handle_t it, last = NULL;
     esp_timer_dispatch_t dispatch_method = timer->flags & FL_ISR_DISPATCH_METHOD;
     if (LIST_FIRST(&s_timers[dispatch_method]) == NULL) {
@@ -318,11 +543,24 @@ static IRAM_ATTR esp_err_t timer_insert(esp_timer_handle_t timer, bool without_u
     }
     return ESP_OK;
 }
+#endif // WITH_TIMING_WHEEL
 
 static IRAM_ATTR esp_err_t timer_remove(esp_timer_handle_t timer)
 {
     esp_timer_dispatch_t dispatch_method = timer->flags & FL_ISR_DISPATCH_METHOD;
     timer_list_lock(dispatch_method);
+#if WITH_TIMING_WHEEL
+    timer_wheel_t* wheel = &s_timer_wheel[dispatch_method];
+    const uint64_t alarm = timer->alarm;
+    LIST_REMOVE(timer, list_entry);
+    timer->alarm = 0;
+    timer->period = 0;
+    if (alarm <= wheel->next_alarm) {
+        // the removed timer defined the programmed alarm, find the new earliest one
+        wheel->next_alarm = timer_wheel_next_hw_alarm(wheel);
+        esp_timer_impl_set_alarm_id(wheel->next_alarm, dispatch_method);
+    }
+#else
     esp_timer_handle_t first_timer = LIST_FIRST(&s_timers[dispatch_method]);
     LIST_REMOVE(timer, list_entry);
     timer->alarm = 0;
@@ -335,6 +573,7 @@ static IRAM_ATTR esp_err_t timer_remove(esp_timer_handle_t timer)
         }
         esp_timer_impl_set_alarm_id(next_timestamp, dispatch_method);
     }
+#endif // WITH_TIMING_WHEEL
 #if WITH_PROFILING
     timer_insert_inactive(timer);
 #endif
@@ -376,10 +615,23 @@ static IRAM_ATTR bool timer_armed(esp_timer_handle_t timer)
 static IRAM_ATTR void timer_list_lock(esp_timer_dispatch_t timer_type)
 {
     portENTER_CRITICAL_SAFE(&s_timer_lock[timer_type]);
+#if WITH_PROFILING
+    if (s_lock_depth[timer_type]++ == 0) {
+        s_lock_enter_time[timer_type] = esp_timer_impl_get_time();
+    }
+#endif
 }
 
 static IRAM_ATTR void timer_list_unlock(esp_timer_dispatch_t timer_type)
 {
+#if WITH_PROFILING
+    if (--s_lock_depth[timer_type] == 0) {
+        uint64_t held = esp_timer_impl_get_time() - s_lock_enter_time[timer_type];
+        if (held > s_lock_max_held_us[timer_type]) {
+            s_lock_max_held_us[timer_type] = held;
+        }
+    }
+#endif
     portEXIT_CRITICAL_SAFE(&s_timer_lock[timer_type]);
 }
 
@@ -393,6 +645,14 @@ static bool timer_process_alarm(esp_timer_dispatch_t dispatch_method)
     bool processed = false;
     esp_timer_handle_t it;
     while (1) {
+#if WITH_TIMING_WHEEL
+        int64_t now = esp_timer_impl_get_time();
+        it = timer_wheel_pop_due(&s_timer_wheel[dispatch_method], now);
+        if (it == NULL) {
+            break;
+        }
+        processed = true;
+#else
         it = LIST_FIRST(&s_timers[dispatch_method]);
         int64_t now = esp_timer_impl_get_time();
         ESP_COMPILER_DIAGNOSTIC_PUSH_IGNORE("-Wanalyzer-use-after-free") // False-positive detection. TODO GCC-366
@@ -402,6 +662,7 @@ static bool timer_process_alarm(esp_timer_dispatch_t dispatch_method)
         ESP_COMPILER_DIAGNOSTIC_POP("-Wanalyzer-use-after-free")
         processed = true;
         LIST_REMOVE(it, list_entry);
+#endif // WITH_TIMING_WHEEL
         if (it->event_id == EVENT_ID_DELETE_TIMER) {
             // It is handled only by ESP_TIMER_TASK (see esp_timer_delete()).
             // All the ESP_TIMER_ISR timers which should be deleted are moved by esp_timer_delete() to the ESP_TIMER_TASK list.
@@ -432,14 +693,54 @@ static bool timer_process_alarm(esp_timer_dispatch_t dispatch_method)
             esp_timer_cb_t callback = it->callback;
             void* arg = it->arg;
             timer_list_unlock(dispatch_method);
+#if WITH_ISR_BUDGET
+            const bool with_budget = (dispatch_method == ESP_TIMER_ISR) && (it->isr_budget_us != 0);
+            uint32_t start_cycles = with_budget ? esp_cpu_get_cycle_count() : 0;
+#endif
             (*callback)(arg);
+#if WITH_ISR_BUDGET
+            bool isr_budget_exceeded = false;
+            if (with_budget) {
+                uint32_t spent_cycles = esp_cpu_get_cycle_count() - start_cycles;
+                isr_budget_exceeded = spent_cycles > it->isr_budget_us * esp_rom_get_cpu_ticks_per_us();
+            }
+#endif
             timer_list_lock(dispatch_method);
 #if WITH_PROFILING
             it->times_triggered++;
             it->total_callback_run_time += esp_timer_impl_get_time() - callback_start;
+#endif
+#if WITH_ISR_BUDGET
+            if (isr_budget_exceeded) {
+                ESP_DRAM_LOGW(DRAM_STR("esp_timer"), "callback %p exceeded its %u us ISR budget, demoting to task dispatch",
+                              callback, (unsigned)it->isr_budget_us);
+                if (timer_armed(it)) {
+                    // A periodic timer was already re-armed above, move it to the task list
+                    const uint64_t alarm = it->alarm;
+                    const uint64_t period = it->period;
+                    timer_remove(it);
+                    it->flags &= ~FL_ISR_DISPATCH_METHOD;
+                    it->alarm = alarm;
+                    it->period = period;
+                    timer_list_lock(ESP_TIMER_TASK);
+                    timer_insert(it, false);
+                    timer_list_unlock(ESP_TIMER_TASK);
+                } else {
+                    // A one-shot timer is already unarmed, the next start uses task dispatch
+                    it->flags &= ~FL_ISR_DISPATCH_METHOD;
+                }
+            }
 #endif
         }
     } // while(1)
+#if WITH_TIMING_WHEEL
+    /* Re-program the alarm unconditionally: the wheel also wakes up at cascade
+     * boundaries where nothing is due yet, and the alarm for the next window
+     * has to be set even then. */
+    timer_wheel_t* wheel = &s_timer_wheel[dispatch_method];
+    wheel->next_alarm = timer_wheel_next_hw_alarm(wheel);
+    esp_timer_impl_set_alarm_id(wheel->next_alarm, dispatch_method);
+#else
     if (it) {
         if (dispatch_method == ESP_TIMER_TASK || (dispatch_method != ESP_TIMER_TASK && processed == true)) {
             esp_timer_impl_set_alarm_id(it->alarm, dispatch_method);
@@ -449,6 +750,7 @@ static bool timer_process_alarm(esp_timer_dispatch_t dispatch_method)
             esp_timer_impl_set_alarm_id(UINT64_MAX, dispatch_method);
         }
     }
+#endif // WITH_TIMING_WHEEL
     timer_list_unlock(dispatch_method);
     return processed;
 }
@@ -575,9 +877,15 @@ esp_err_t esp_timer_deinit(void)
 
     /* Check if there are any active timers */
     for (esp_timer_dispatch_t dispatch_method = ESP_TIMER_TASK; dispatch_method < ESP_TIMER_MAX; ++dispatch_method) {
+#if WITH_TIMING_WHEEL
+        if (!timer_wheel_empty(&s_timer_wheel[dispatch_method])) {
+            return ESP_ERR_INVALID_STATE;
+        }
+#else
         if (!LIST_EMPTY(&s_timers[dispatch_method])) {
             return ESP_ERR_INVALID_STATE;
         }
+#endif // WITH_TIMING_WHEEL
     }
 
     /* We can only check if there are any timers which are not deleted if
@@ -619,6 +927,40 @@ static void print_timer_info(esp_timer_handle_t t, char** dst, size_t* dst_size)
     *dst_size -= cb;
 }
 
+#if WITH_TIMING_WHEEL
+static size_t timer_wheel_count(timer_wheel_t* wheel)
+{
+    size_t count = 0;
+    esp_timer_handle_t it;
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        for (unsigned i = 0; i < TIMER_WHEEL_SLOTS; ++i) {
+            LIST_FOREACH(it, &wheel->slots[level][i], list_entry) {
+                ++count;
+            }
+        }
+    }
+    LIST_FOREACH(it, &wheel->overflow, list_entry) {
+        ++count;
+    }
+    return count;
+}
+
+static void timer_wheel_print(timer_wheel_t* wheel, char** dst, size_t* dst_size)
+{
+    esp_timer_handle_t it;
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        for (unsigned i = 0; i < TIMER_WHEEL_SLOTS; ++i) {
+            LIST_FOREACH(it, &wheel->slots[level][i], list_entry) {
+                print_timer_info(it, dst, dst_size);
+            }
+        }
+    }
+    LIST_FOREACH(it, &wheel->overflow, list_entry) {
+        print_timer_info(it, dst, dst_size);
+    }
+}
+#endif // WITH_TIMING_WHEEL
+
 esp_err_t esp_timer_dump(FILE* stream)
 {
     /* Since timer lock is a critical section, we don't want to print directly
@@ -627,15 +969,19 @@ esp_err_t esp_timer_dump(FILE* stream)
      * print to it, then dump this memory to stdout.
      */
 
-    esp_timer_handle_t it;
+    __attribute__((unused)) esp_timer_handle_t it;
 
     /* First count the number of timers */
     size_t timer_count = 0;
     for (esp_timer_dispatch_t dispatch_method = ESP_TIMER_TASK; dispatch_method < ESP_TIMER_MAX; ++dispatch_method) {
         timer_list_lock(dispatch_method);
+#if WITH_TIMING_WHEEL
+        timer_count += timer_wheel_count(&s_timer_wheel[dispatch_method]);
+#else
         LIST_FOREACH(it, &s_timers[dispatch_method], list_entry) {
             ++timer_count;
         }
+#endif // WITH_TIMING_WHEEL
 #if WITH_PROFILING
         LIST_FOREACH(it, &s_inactive_timers[dispatch_method], list_entry) {
             ++timer_count;
@@ -659,9 +1005,13 @@ esp_err_t esp_timer_dump(FILE* stream)
     char* pos = print_buf;
     for (esp_timer_dispatch_t dispatch_method = ESP_TIMER_TASK; dispatch_method < ESP_TIMER_MAX; ++dispatch_method) {
         timer_list_lock(dispatch_method);
+#if WITH_TIMING_WHEEL
+        timer_wheel_print(&s_timer_wheel[dispatch_method], &pos, &buf_size);
+#else
         LIST_FOREACH(it, &s_timers[dispatch_method], list_entry) {
             print_timer_info(it, &pos, &buf_size);
         }
+#endif // WITH_TIMING_WHEEL
 #if WITH_PROFILING
         LIST_FOREACH(it, &s_inactive_timers[dispatch_method], list_entry) {
             print_timer_info(it, &pos, &buf_size);
@@ -672,6 +1022,12 @@ esp_err_t esp_timer_dump(FILE* stream)
 
     if (stream != NULL) {
         fprintf(stream, "Timer stats:\n");
+#if WITH_PROFILING
+        for (esp_timer_dispatch_t dispatch_method = ESP_TIMER_TASK; dispatch_method < ESP_TIMER_MAX; ++dispatch_method) {
+            fprintf(stream, "Max time timer lock was held: %lld us (dispatch method: %d)\n",
+                    s_lock_max_held_us[dispatch_method], dispatch_method);
+        }
+#endif
 #if WITH_PROFILING
         fprintf(stream, "%-20s  %-10s  %-12s  %-12s  %-12s  %-12s  %-12s\n",
                 "Name", "Period", "Alarm", "Times_armed", "Times_trigg", "Times_skip", "Cb_exec_time");
@@ -692,12 +1048,19 @@ int64_t IRAM_ATTR esp_timer_get_next_alarm(void)
     int64_t next_alarm = INT64_MAX;
     for (esp_timer_dispatch_t dispatch_method = ESP_TIMER_TASK; dispatch_method < ESP_TIMER_MAX; ++dispatch_method) {
         timer_list_lock(dispatch_method);
+#if WITH_TIMING_WHEEL
+        uint64_t alarm = timer_wheel_min_alarm(&s_timer_wheel[dispatch_method], false);
+        if (alarm != UINT64_MAX && (uint64_t)next_alarm > alarm) {
+            next_alarm = alarm;
+        }
+#else
         esp_timer_handle_t it = LIST_FIRST(&s_timers[dispatch_method]);
         if (it) {
             if (next_alarm > it->alarm) {
                 next_alarm = it->alarm;
             }
         }
+#endif // WITH_TIMING_WHEEL
         timer_list_unlock(dispatch_method);
     }
     return next_alarm;
@@ -708,6 +1071,12 @@ int64_t IRAM_ATTR esp_timer_get_next_alarm_for_wake_up(void)
     int64_t next_alarm = INT64_MAX;
     for (esp_timer_dispatch_t dispatch_method = ESP_TIMER_TASK; dispatch_method < ESP_TIMER_MAX; ++dispatch_method) {
         timer_list_lock(dispatch_method);
+#if WITH_TIMING_WHEEL
+        uint64_t alarm = timer_wheel_min_alarm(&s_timer_wheel[dispatch_method], true);
+        if (alarm != UINT64_MAX && (uint64_t)next_alarm > alarm) {
+            next_alarm = alarm;
+        }
+#else
         esp_timer_handle_t it = NULL;
         LIST_FOREACH(it, &s_timers[dispatch_method], list_entry) {
             // timers with the SKIP_UNHANDLED_EVENTS flag do not want to wake up CPU from a sleep mode.
@@ -718,6 +1087,7 @@ int64_t IRAM_ATTR esp_timer_get_next_alarm_for_wake_up(void)
                 break;
             }
         }
+#endif // WITH_TIMING_WHEEL
         timer_list_unlock(dispatch_method);
     }
     return next_alarm;
@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "esp_wifi.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Apply the selected performance profile to an init config
+ *
+ * Called by esp_wifi_init() on its working copy of the init config before it
+ * is handed to the WiFi driver. A no-op for WIFI_PERF_PROFILE_DEFAULT.
+ *
+ * @param config init config to adjust in place
+ */
+void esp_wifi_perf_profile_apply(wifi_init_config_t *config);
+
+/**
+ * @brief Allow selecting a new profile again after esp_wifi_deinit()
+ */
+void esp_wifi_perf_profile_reset(void);
+
+/**
+ * @brief Count one transmission rejected for lack of a TX buffer
+ */
+void esp_wifi_perf_stats_count_tx_exhausted(void);
+
+/**
+ * @brief Count one received frame dropped for lack of an RX buffer/pbuf
+ */
+void esp_wifi_perf_stats_count_rx_exhausted(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1190,6 +1190,75 @@ esp_err_t esp_wifi_get_event_mask(uint32_t *mask);
 
 esp_err_t esp_wifi_80211_tx(wifi_interface_t ifx, const void *buffer, int len, bool en_sys_seq);
 
+#if CONFIG_ESP_WIFI_TX_BUFFER_LOAN
+/**
+  * @brief The TX loan buffer completion callback function
+  *
+  *        Called when the WiFi driver has consumed the submitted frame and the
+  *        buffer has been returned to the pool. The buffer must not be touched
+  *        after this callback runs.
+  *
+  * @param arg context argument passed to esp_wifi_tx_buffer_submit()
+  * @param status result of the transmission attempt
+  */
+typedef void (*wifi_tx_buffer_done_cb_t)(void *arg, esp_err_t status);
+
+/**
+  * @brief     Acquire a DMA-capable TX buffer from the loan pool
+  *
+  *            The returned buffer is filled in place by the application and then
+  *            handed back with esp_wifi_tx_buffer_submit() or abandoned with
+  *            esp_wifi_tx_buffer_release(), avoiding a per-frame heap allocation
+  *            and copy on the application side. The pool is allocated from
+  *            internal DMA-capable memory on first use.
+  *
+  * @param     size    requested payload capacity in bytes
+  * @param[out] buffer store the acquired buffer
+  *
+  * @return
+  *    - ESP_OK: succeed
+  *    - ESP_ERR_INVALID_ARG: buffer is NULL or size exceeds CONFIG_ESP_WIFI_TX_BUFFER_LOAN_SIZE
+  *    - ESP_ERR_NO_MEM: all loan buffers are in flight, or pool allocation failed
+  */
+esp_err_t esp_wifi_tx_buffer_acquire(size_t size, void **buffer);
+
+/**
+  * @brief     Transmit an acquired buffer as a raw ieee80211 frame and recycle it
+  *
+  *            Equivalent to esp_wifi_80211_tx() on the buffer contents. The buffer
+  *            is returned to the pool when the driver has consumed the frame and
+  *            cb (if not NULL) is invoked with the transmission status.
+  *
+  * @param     ifx interface, see esp_wifi_80211_tx()
+  * @param     buffer buffer obtained from esp_wifi_tx_buffer_acquire()
+  * @param     len the length of the frame, the len must be <= 1500 Bytes and >= 24 Bytes
+  * @param     en_sys_seq see esp_wifi_80211_tx()
+  * @param     cb completion callback, may be NULL
+  * @param     arg context argument passed to cb
+  *
+  * @return
+  *    - ESP_OK: success, the buffer ownership passed back to the pool
+  *    - ESP_ERR_INVALID_ARG: buffer was not acquired from the pool
+  *    - others: refer to esp_wifi_80211_tx(); the buffer is returned to the pool in all cases
+  */
+esp_err_t esp_wifi_tx_buffer_submit(wifi_interface_t ifx, void *buffer, int len, bool en_sys_seq,
+                                    wifi_tx_buffer_done_cb_t cb, void *arg);
+
+/**
+  * @brief     Return an acquired buffer to the pool without transmitting it
+  *
+  *            Also used after sending the buffer through an API that consumes the
+  *            payload itself, e.g. esp_now_send().
+  *
+  * @param     buffer buffer obtained from esp_wifi_tx_buffer_acquire()
+  *
+  * @return
+  *    - ESP_OK: succeed
+  *    - ESP_ERR_INVALID_ARG: buffer was not acquired from the pool
+  */
+esp_err_t esp_wifi_tx_buffer_release(void *buffer);
+#endif // CONFIG_ESP_WIFI_TX_BUFFER_LOAN
+
 /**
   * @brief The RX callback function of Channel State Information(CSI)  data.
   *
@@ -1771,6 +1840,71 @@ esp_err_t esp_wifi_set_bandwidths(wifi_interface_t ifx, wifi_bandwidths_t* bw);
   */
 esp_err_t esp_wifi_get_bandwidths(wifi_interface_t ifx, wifi_bandwidths_t *bw);
 
+/**
+  * @brief WiFi performance profile
+  *
+  * Named presets for the RX/TX buffer pools and AMPDU window size, so that one
+  * binary can serve both memory constrained and high throughput deployments
+  * without rebuilding with different Kconfig buffer settings.
+  */
+typedef enum {
+    WIFI_PERF_PROFILE_DEFAULT = 0, /**< Use the buffer/AMPDU settings from wifi_init_config_t (Kconfig defaults) */
+    WIFI_PERF_PROFILE_LOWMEM,      /**< Minimum buffering, smallest AMPDU RX window; lowest memory footprint */
+    WIFI_PERF_PROFILE_BALANCED,    /**< Moderate buffering, suits most applications */
+    WIFI_PERF_PROFILE_THROUGHPUT,  /**< Large buffer pools and AMPDU windows; maximum throughput, highest memory use */
+} wifi_perf_profile_t;
+
+/**
+  * @brief WiFi buffer exhaustion counters
+  */
+typedef struct {
+    uint32_t tx_buf_exhausted;     /**< Transmissions rejected with ESP_ERR_NO_MEM because no TX buffer was available */
+    uint32_t rx_buf_exhausted;     /**< Received frames dropped because no pbuf/RX buffer could be allocated.
+                                        Only counted when CONFIG_ESP_NETIF_RECEIVE_REPORT_ERRORS is enabled */
+} wifi_perf_stats_t;
+
+/**
+  * @brief     Select the WiFi performance profile applied by esp_wifi_init()
+  *
+  * The profile overrides the RX/TX buffer pool sizes and the AMPDU RX window
+  * of the wifi_init_config_t passed to esp_wifi_init(). Fields not covered by
+  * the profile are taken from the init config unchanged.
+  *
+  * @attention This API must be called before esp_wifi_init(): the buffer pools
+  *            are committed when the WiFi driver is initialized.
+  *
+  * @param     profile  performance profile to apply
+  *
+  * @return
+  *    - ESP_OK: succeed
+  *    - ESP_ERR_INVALID_ARG: unknown profile
+  *    - ESP_ERR_WIFI_INIT_STATE: WiFi is already initialized
+  */
+esp_err_t esp_wifi_set_perf_profile(wifi_perf_profile_t profile);
+
+/**
+  * @brief     Get the WiFi buffer exhaustion counters
+  *
+  * The counters accumulate since boot (or since esp_wifi_clear_perf_stats())
+  * and allow verifying in the field whether the selected performance profile
+  * provides sufficient buffering.
+  *
+  * @param[out] stats  store the current counter values
+  *
+  * @return
+  *    - ESP_OK: succeed
+  *    - ESP_ERR_INVALID_ARG: stats is NULL
+  */
+esp_err_t esp_wifi_get_perf_stats(wifi_perf_stats_t *stats);
+
+/**
+  * @brief     Reset the WiFi buffer exhaustion counters to zero
+  *
+  * @return
+  *    - ESP_OK: succeed
+  */
+esp_err_t esp_wifi_clear_perf_stats(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Snapshot the current Wi-Fi station connection for fast reconnect after deep sleep
+ *
+ * Records the BSSID and primary channel of the associated AP together with the
+ * station netif IP configuration (address, netmask, gateway, main DNS server)
+ * in RTC memory, sealed against corruption by the warm-boot framework
+ * (see esp_warm_boot.h). Call this while connected, typically right before
+ * entering deep sleep.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_WIFI_NOT_CONNECT if the station is not associated
+ *      - ESP_ERR_INVALID_STATE if the station netif does not exist or has no IP address
+ */
+esp_err_t esp_wifi_fast_connect_save(void);
+
+/**
+ * @brief Restore a connection snapshot taken by esp_wifi_fast_connect_save()
+ *
+ * When the chip woke from deep sleep and the snapshot is intact, this updates
+ * the station config to target the recorded BSSID and channel directly (no
+ * scan) and restores the recorded IP configuration on the station netif, so
+ * traffic can start as soon as association completes. Call after
+ * esp_wifi_init() and before esp_wifi_connect().
+ *
+ * The restored address is used without contacting the DHCP server; call
+ * esp_wifi_fast_connect_revalidate() once latency is no longer critical to
+ * re-run the DHCP exchange in the background.
+ *
+ * @return
+ *      - ESP_OK if the snapshot was applied
+ *      - ESP_ERR_INVALID_STATE if there is no valid snapshot (cold boot, or the
+ *        snapshot did not survive sleep) — connect normally in this case
+ */
+esp_err_t esp_wifi_fast_connect_apply(void);
+
+/**
+ * @brief Revalidate the IP lease restored by esp_wifi_fast_connect_apply()
+ *
+ * Restarts the DHCP client on the station netif so that the address restored
+ * from the snapshot is re-confirmed (or replaced) by the server. The current
+ * address remains usable until the DHCP exchange completes.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if no snapshot was applied on this boot
+ */
+esp_err_t esp_wifi_fast_connect_revalidate(void);
+
+#ifdef __cplusplus
+}
+#endif
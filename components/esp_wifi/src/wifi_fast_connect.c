@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "esp_wifi.h"
+#include "esp_wifi_fast_connect.h"
+#include "esp_netif.h"
+#include "esp_warm_boot.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+
+static const char *TAG = "wifi_fast_connect";
+
+typedef struct {
+    uint8_t bssid[6];
+    uint8_t channel;
+    esp_netif_ip_info_t ip_info;
+    esp_netif_dns_info_t dns;
+} wifi_fast_connect_rec_t;
+
+static RTC_NOINIT_ATTR wifi_fast_connect_rec_t s_fc_rec;
+
+static const esp_warm_boot_snapshot_t s_fc_snapshot = {
+    .name = "wifi_fc",
+    .data = &s_fc_rec,
+    .size = sizeof(s_fc_rec),
+};
+
+static bool s_fc_registered;
+static bool s_fc_applied;
+
+static esp_netif_t *fast_connect_sta_netif(void)
+{
+    return esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+}
+
+esp_err_t esp_wifi_fast_connect_save(void)
+{
+    wifi_ap_record_t ap_info;
+    esp_err_t err = esp_wifi_sta_get_ap_info(&ap_info);
+    if (err != ESP_OK) {
+        return err;
+    }
+    esp_netif_t *netif = fast_connect_sta_netif();
+    if (netif == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_netif_ip_info_t ip_info;
+    err = esp_netif_get_ip_info(netif, &ip_info);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (ip_info.ip.addr == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    memcpy(s_fc_rec.bssid, ap_info.bssid, sizeof(s_fc_rec.bssid));
+    s_fc_rec.channel = ap_info.primary;
+    s_fc_rec.ip_info = ip_info;
+    memset(&s_fc_rec.dns, 0, sizeof(s_fc_rec.dns));
+    esp_netif_get_dns_info(netif, ESP_NETIF_DNS_MAIN, &s_fc_rec.dns);
+
+    if (!s_fc_registered) {
+        err = esp_warm_boot_snapshot_register(&s_fc_snapshot);
+        if (err != ESP_OK) {
+            return err;
+        }
+        s_fc_registered = true;
+    }
+    ESP_LOGD(TAG, "saved connection snapshot: channel %d", s_fc_rec.channel);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_fast_connect_apply(void)
+{
+    if (!esp_warm_boot_snapshot_valid(&s_fc_snapshot)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_netif_t *netif = fast_connect_sta_netif();
+    if (netif == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    wifi_config_t cfg;
+    esp_err_t err = esp_wifi_get_config(WIFI_IF_STA, &cfg);
+    if (err != ESP_OK) {
+        return err;
+    }
+    memcpy(cfg.sta.bssid, s_fc_rec.bssid, sizeof(cfg.sta.bssid));
+    cfg.sta.bssid_set = true;
+    cfg.sta.channel = s_fc_rec.channel;
+    cfg.sta.scan_method = WIFI_FAST_SCAN;
+    err = esp_wifi_set_config(WIFI_IF_STA, &cfg);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    /* Restore the IP configuration recorded before sleep; the lease is used
+     * without contacting the server until esp_wifi_fast_connect_revalidate() */
+    err = esp_netif_dhcpc_stop(netif);
+    if (err != ESP_OK && err != ESP_ERR_ESP_NETIF_DHCP_ALREADY_STOPPED) {
+        return err;
+    }
+    err = esp_netif_set_ip_info(netif, &s_fc_rec.ip_info);
+    if (err != ESP_OK) {
+        return err;
+    }
+    esp_netif_set_dns_info(netif, ESP_NETIF_DNS_MAIN, &s_fc_rec.dns);
+
+    s_fc_applied = true;
+    ESP_LOGI(TAG, "applying connection snapshot: channel %d", s_fc_rec.channel);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_fast_connect_revalidate(void)
+{
+    if (!s_fc_applied) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_netif_t *netif = fast_connect_sta_netif();
+    if (netif == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_fc_applied = false;
+    return esp_netif_dhcpc_start(netif);
+}
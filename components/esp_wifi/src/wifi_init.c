@@ -15,6 +15,7 @@
 #include "esp_check.h"
 #include "esp_private/pm_impl.h"
 #include "esp_private/esp_clk.h"
+#include "esp_private/wifi_perf_profile.h"
 #include "esp_wpa.h"
 #include "esp_netif.h"
 #ifdef CONFIG_ESP_COEX_ENABLED
@@ -235,6 +236,7 @@ static esp_err_t wifi_deinit_internal(void)
 #ifdef CONFIG_ESP_PHY_ENABLED
     esp_phy_modem_deinit();
 #endif
+    esp_wifi_perf_profile_reset();
     s_wifi_inited = false;
 
     return err;
@@ -322,9 +324,14 @@ esp_err_t esp_wifi_init(const wifi_init_config_t *config)
         return ESP_OK;
     }
 
+    /* Work on a copy so that the performance profile overrides never
+       modify the caller's configuration */
+    wifi_init_config_t init_config = *config;
+    esp_wifi_perf_profile_apply(&init_config);
+
     esp_err_t result = ESP_OK;
 #ifdef CONFIG_SPIRAM
-    result = esp_wifi_psram_check(config);
+    result = esp_wifi_psram_check(&init_config);
     if (result != ESP_OK) {
         return result;
     }
@@ -406,10 +413,10 @@ esp_err_t esp_wifi_init(const wifi_init_config_t *config)
     esp_chip_info_t info = {0};
     esp_chip_info(&info);
     if (info.model == CHIP_ESP32C6 && info.revision <= 1) {
-        ((wifi_init_config_t *)config)->feature_caps &= ~(CONFIG_FEATURE_FTM_INITIATOR_BIT);
+        init_config.feature_caps &= ~(CONFIG_FEATURE_FTM_INITIATOR_BIT);
     }
 #endif
-    result = esp_wifi_init_internal(config);
+    result = esp_wifi_init_internal(&init_config);
     if (result == ESP_OK) {
 #if CONFIG_MAC_BB_PD
         esp_mac_bb_pd_mem_init();
@@ -8,6 +8,9 @@
 #include "esp_log.h"
 #include "esp_private/wifi.h"
 #include "esp_wifi_netif.h"
+#if CONFIG_ESP_WIFI_ENABLED || CONFIG_ESP_HOST_WIFI_ENABLED
+#include "esp_private/wifi_perf_profile.h"
+#endif
 
 //
 //  Purpose of this module is provide object oriented abstraction to wifi interfaces
@@ -34,22 +37,48 @@ static esp_netif_t *s_wifi_netifs[MAX_WIFI_IFS] = { NULL };
  * @brief WiFi netif driver IO functions, a thin glue layer
  *         to the original wifi interface API
  */
+#if CONFIG_ESP_WIFI_ENABLED || CONFIG_ESP_HOST_WIFI_ENABLED
+/**
+ * @brief Count buffer exhaustion on the RX/TX glue for the perf profile stats.
+ *        The RX side only reports errors when CONFIG_ESP_NETIF_RECEIVE_REPORT_ERRORS
+ *        is enabled, otherwise the receive callbacks always return ESP_OK.
+ */
+static inline esp_err_t wifi_count_rx_err(esp_err_t ret)
+{
+    if (ret == ESP_ERR_NO_MEM) {
+        esp_wifi_perf_stats_count_rx_exhausted();
+    }
+    return ret;
+}
+
+static inline esp_err_t wifi_count_tx_err(esp_err_t ret)
+{
+    if (ret == ESP_ERR_NO_MEM) {
+        esp_wifi_perf_stats_count_tx_exhausted();
+    }
+    return ret;
+}
+#else
+#define wifi_count_rx_err(ret) (ret)
+#define wifi_count_tx_err(ret) (ret)
+#endif
+
 static esp_err_t wifi_sta_receive(void *buffer, uint16_t len, void *eb)
 {
-    return s_wifi_rxcbs[WIFI_IF_STA](s_wifi_netifs[WIFI_IF_STA], buffer, len, eb);
+    return wifi_count_rx_err(s_wifi_rxcbs[WIFI_IF_STA](s_wifi_netifs[WIFI_IF_STA], buffer, len, eb));
 }
 
 #ifdef CONFIG_ESP_WIFI_SOFTAP_SUPPORT
 static esp_err_t wifi_ap_receive(void *buffer, uint16_t len, void *eb)
 {
-    return s_wifi_rxcbs[WIFI_IF_AP](s_wifi_netifs[WIFI_IF_AP], buffer, len, eb);
+    return wifi_count_rx_err(s_wifi_rxcbs[WIFI_IF_AP](s_wifi_netifs[WIFI_IF_AP], buffer, len, eb));
 }
 #endif
 
 #ifdef CONFIG_ESP_WIFI_NAN_ENABLE
 static esp_err_t wifi_nan_receive(void *buffer, uint16_t len, void *eb)
 {
-    return s_wifi_rxcbs[WIFI_IF_NAN](s_wifi_netifs[WIFI_IF_NAN], buffer, len, eb);
+    return wifi_count_rx_err(s_wifi_rxcbs[WIFI_IF_NAN](s_wifi_netifs[WIFI_IF_NAN], buffer, len, eb));
 }
 #endif
 
@@ -63,16 +92,16 @@ static void wifi_free(void *h, void* buffer)
 static esp_err_t wifi_transmit(void *h, void *buffer, size_t len)
 {
     wifi_netif_driver_t driver = h;
-    return esp_wifi_internal_tx(driver->wifi_if, buffer, len);
+    return wifi_count_tx_err(esp_wifi_internal_tx(driver->wifi_if, buffer, len));
 }
 
 static esp_err_t wifi_transmit_wrap(void *h, void *buffer, size_t len, void *netstack_buf)
 {
     wifi_netif_driver_t driver = h;
 #if CONFIG_SPIRAM_TRY_ALLOCATE_WIFI_LWIP && !CONFIG_SPIRAM_IGNORE_NOTFOUND
-    return esp_wifi_internal_tx_by_ref(driver->wifi_if, buffer, len, netstack_buf);
+    return wifi_count_tx_err(esp_wifi_internal_tx_by_ref(driver->wifi_if, buffer, len, netstack_buf));
 #else
-    return esp_wifi_internal_tx(driver->wifi_if, buffer, len);
+    return wifi_count_tx_err(esp_wifi_internal_tx(driver->wifi_if, buffer, len));
 #endif
 }
 
@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sdkconfig.h"
+#include "esp_wifi.h"
+#include "esp_log.h"
+#include "esp_private/wifi_perf_profile.h"
+
+static const char *TAG = "wifi_perf";
+
+static wifi_perf_profile_t s_perf_profile = WIFI_PERF_PROFILE_DEFAULT;
+static bool s_perf_profile_applied = false;
+
+/* Best-effort counters: incremented from the netif glue on the failing
+ * path only, so no synchronization is needed on the hot path */
+static volatile uint32_t s_tx_buf_exhausted = 0;
+static volatile uint32_t s_rx_buf_exhausted = 0;
+
+/**
+ * Per-profile buffer pool and AMPDU window presets. The values stay within
+ * the ranges the buffer Kconfig options allow, so a profile never requests
+ * a configuration the driver would reject.
+ */
+typedef struct {
+    int static_rx_buf_num;
+    int dynamic_rx_buf_num;
+    int tx_buf_num;             /*!< applied to the TX buffer pool selected by tx_buf_type */
+    int rx_ba_win;
+    bool force_ampdu;           /*!< enable AMPDU RX/TX even if disabled in the init config */
+} wifi_perf_profile_preset_t;
+
+static const wifi_perf_profile_preset_t s_perf_presets[] = {
+    [WIFI_PERF_PROFILE_LOWMEM] = {
+        .static_rx_buf_num = 4,
+        .dynamic_rx_buf_num = 16,
+        .tx_buf_num = 16,
+        .rx_ba_win = 4,
+        .force_ampdu = false,
+    },
+    [WIFI_PERF_PROFILE_BALANCED] = {
+        .static_rx_buf_num = 10,
+        .dynamic_rx_buf_num = 32,
+        .tx_buf_num = 32,
+        .rx_ba_win = 6,
+        .force_ampdu = false,
+    },
+    [WIFI_PERF_PROFILE_THROUGHPUT] = {
+        .static_rx_buf_num = 16,
+        .dynamic_rx_buf_num = 64,
+        .tx_buf_num = 64,
+        .rx_ba_win = 16,
+        .force_ampdu = true,
+    },
+};
+
+esp_err_t esp_wifi_set_perf_profile(wifi_perf_profile_t profile)
+{
+    if (profile != WIFI_PERF_PROFILE_DEFAULT &&
+            (profile < 0 || profile >= sizeof(s_perf_presets) / sizeof(s_perf_presets[0]))) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_perf_profile_applied) {
+        ESP_LOGE(TAG, "performance profile must be selected before esp_wifi_init()");
+        return ESP_ERR_WIFI_INIT_STATE;
+    }
+    s_perf_profile = profile;
+    return ESP_OK;
+}
+
+void esp_wifi_perf_profile_apply(wifi_init_config_t *config)
+{
+    s_perf_profile_applied = true;
+    if (s_perf_profile == WIFI_PERF_PROFILE_DEFAULT) {
+        return;
+    }
+    const wifi_perf_profile_preset_t *preset = &s_perf_presets[s_perf_profile];
+
+    config->static_rx_buf_num = preset->static_rx_buf_num;
+    config->dynamic_rx_buf_num = preset->dynamic_rx_buf_num;
+    if (config->tx_buf_type == 0) {
+        config->static_tx_buf_num = preset->tx_buf_num;
+    } else {
+        config->dynamic_tx_buf_num = preset->tx_buf_num;
+    }
+    if (preset->force_ampdu) {
+        config->ampdu_rx_enable = 1;
+        config->ampdu_tx_enable = 1;
+    }
+    if (config->ampdu_rx_enable) {
+        config->rx_ba_win = preset->rx_ba_win;
+    }
+    ESP_LOGI(TAG, "perf profile %d: rx buf %d static/%d dynamic, tx buf %d %s, rx ba win %d",
+             s_perf_profile, config->static_rx_buf_num, config->dynamic_rx_buf_num,
+             preset->tx_buf_num, (config->tx_buf_type == 0) ? "static" : "dynamic",
+             config->ampdu_rx_enable ? config->rx_ba_win : 0);
+}
+
+void esp_wifi_perf_profile_reset(void)
+{
+    s_perf_profile_applied = false;
+}
+
+void esp_wifi_perf_stats_count_tx_exhausted(void)
+{
+    s_tx_buf_exhausted++;
+}
+
+void esp_wifi_perf_stats_count_rx_exhausted(void)
+{
+    s_rx_buf_exhausted++;
+}
+
+esp_err_t esp_wifi_get_perf_stats(wifi_perf_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    stats->tx_buf_exhausted = s_tx_buf_exhausted;
+    stats->rx_buf_exhausted = s_rx_buf_exhausted;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_clear_perf_stats(void)
+{
+    s_tx_buf_exhausted = 0;
+    s_rx_buf_exhausted = 0;
+    return ESP_OK;
+}
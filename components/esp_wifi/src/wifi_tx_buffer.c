@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_wifi.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+#define TX_LOAN_BUF_NUM     CONFIG_ESP_WIFI_TX_BUFFER_LOAN_NUM
+#define TX_LOAN_BUF_SIZE    CONFIG_ESP_WIFI_TX_BUFFER_LOAN_SIZE
+
+static const char *TAG = "wifi_tx_buf";
+
+/* Single slab carved into fixed slots; a slot is identified (and validated)
+ * by its address range within the slab */
+static uint8_t *s_loan_pool = NULL;
+static uint8_t *s_loan_free[TX_LOAN_BUF_NUM];
+static int s_loan_free_num = 0;
+static portMUX_TYPE s_loan_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static bool loan_pool_init(void)
+{
+    /* WiFi TX goes through the MAC DMA, so the pool must live in internal
+     * DMA-capable memory */
+    uint8_t *pool = heap_caps_malloc(TX_LOAN_BUF_NUM * TX_LOAN_BUF_SIZE,
+                                     MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (pool == NULL) {
+        ESP_LOGE(TAG, "failed to allocate TX loan pool (%d bytes)",
+                 TX_LOAN_BUF_NUM * TX_LOAN_BUF_SIZE);
+        return false;
+    }
+    bool pool_used = false;
+    portENTER_CRITICAL(&s_loan_lock);
+    if (s_loan_pool == NULL) {
+        s_loan_pool = pool;
+        for (int i = 0; i < TX_LOAN_BUF_NUM; i++) {
+            s_loan_free[i] = pool + i * TX_LOAN_BUF_SIZE;
+        }
+        s_loan_free_num = TX_LOAN_BUF_NUM;
+        pool_used = true;
+    }
+    portEXIT_CRITICAL(&s_loan_lock);
+    if (!pool_used) {
+        /* another task initialized the pool concurrently */
+        free(pool);
+    }
+    return true;
+}
+
+static bool loan_buf_in_pool(const void *buffer)
+{
+    const uint8_t *buf = buffer;
+    if (s_loan_pool == NULL || buf < s_loan_pool ||
+            buf >= s_loan_pool + TX_LOAN_BUF_NUM * TX_LOAN_BUF_SIZE) {
+        return false;
+    }
+    return ((buf - s_loan_pool) % TX_LOAN_BUF_SIZE) == 0;
+}
+
+esp_err_t esp_wifi_tx_buffer_acquire(size_t size, void **buffer)
+{
+    if (buffer == NULL || size == 0 || size > TX_LOAN_BUF_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_loan_pool == NULL && !loan_pool_init()) {
+        return ESP_ERR_NO_MEM;
+    }
+    void *buf = NULL;
+    portENTER_CRITICAL(&s_loan_lock);
+    if (s_loan_free_num > 0) {
+        buf = s_loan_free[--s_loan_free_num];
+    }
+    portEXIT_CRITICAL(&s_loan_lock);
+    if (buf == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    *buffer = buf;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_tx_buffer_release(void *buffer)
+{
+    if (!loan_buf_in_pool(buffer)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_loan_lock);
+    /* the address-range check above guarantees the free list has room */
+    s_loan_free[s_loan_free_num++] = buffer;
+    portEXIT_CRITICAL(&s_loan_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_tx_buffer_submit(wifi_interface_t ifx, void *buffer, int len, bool en_sys_seq,
+                                    wifi_tx_buffer_done_cb_t cb, void *arg)
+{
+    if (!loan_buf_in_pool(buffer)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    /* The driver takes ownership of the frame contents during this call, so
+     * the buffer can be recycled as soon as it returns */
+    esp_err_t ret = esp_wifi_80211_tx(ifx, buffer, len, en_sys_seq);
+    esp_wifi_tx_buffer_release(buffer);
+    if (cb != NULL) {
+        cb(arg, ret);
+    }
+    return ret;
+}
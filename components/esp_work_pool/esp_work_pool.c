@@ -0,0 +1,230 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_work_pool.h"
+
+/* Shared worker pool, see esp_work_pool.h.
+ *
+ * Each core owns one job ring per lane and a group of pinned worker tasks.
+ * Posts without affinity go to the posting core, so the common case (post and
+ * wake a worker on the same core) involves no cross-core interrupt. Workers
+ * drain their own core's lanes in lane order and then steal from the other
+ * core, which balances bursts without any migration bookkeeping. The rings
+ * are guarded by a per-core spinlock taken only around the index updates;
+ * workers sleep on a counting task notification so a post between the empty
+ * check and the sleep is never lost.
+ */
+
+#define WORK_POOL_CORES    CONFIG_FREERTOS_NUMBER_OF_CORES
+
+typedef struct {
+    esp_work_fn_t fn;
+    void *arg;
+} work_job_t;
+
+typedef struct {
+    work_job_t jobs[CONFIG_ESP_WORK_POOL_QUEUE_LEN];
+    size_t head;        // Next job to pop
+    size_t tail;        // Next free slot
+    size_t count;
+} work_ring_t;
+
+typedef struct {
+    work_ring_t lanes[ESP_WORK_LANE_MAX];
+    portMUX_TYPE lock;
+    TaskHandle_t workers[CONFIG_ESP_WORK_POOL_WORKERS_PER_CORE];
+    size_t next_worker;     // Round robin wakeup cursor
+} work_core_t;
+
+typedef enum {
+    POOL_STATE_NONE = 0,
+    POOL_STATE_INITIALIZING,
+    POOL_STATE_RUNNING,
+} pool_state_t;
+
+static const char *TAG = "work_pool";
+
+static work_core_t s_cores[WORK_POOL_CORES];
+static atomic_int s_pool_state = POOL_STATE_NONE;
+
+//Push a job onto a lane of a core, pdFALSE when the ring is full. Lock must be held.
+static BaseType_t work_ring_push(work_ring_t *ring, esp_work_fn_t fn, void *arg)
+{
+    if (ring->count == CONFIG_ESP_WORK_POOL_QUEUE_LEN) {
+        return pdFALSE;
+    }
+    ring->jobs[ring->tail].fn = fn;
+    ring->jobs[ring->tail].arg = arg;
+    ring->tail = (ring->tail + 1) % CONFIG_ESP_WORK_POOL_QUEUE_LEN;
+    ring->count++;
+    return pdTRUE;
+}
+
+//Pop the next job of a core, high lane first. pdFALSE when both lanes are empty.
+static BaseType_t work_core_pop(work_core_t *core, work_job_t *job)
+{
+    BaseType_t found = pdFALSE;
+    portENTER_CRITICAL(&core->lock);
+    for (int lane = 0; lane < ESP_WORK_LANE_MAX && found == pdFALSE; lane++) {
+        work_ring_t *ring = &core->lanes[lane];
+        if (ring->count > 0) {
+            *job = ring->jobs[ring->head];
+            ring->head = (ring->head + 1) % CONFIG_ESP_WORK_POOL_QUEUE_LEN;
+            ring->count--;
+            found = pdTRUE;
+        }
+    }
+    portEXIT_CRITICAL(&core->lock);
+    return found;
+}
+
+//Wake one worker of a core, round robin. Lock must be held (guards next_worker).
+static void work_core_notify(work_core_t *core, BaseType_t from_isr, BaseType_t *pxHigherPriorityTaskWoken)
+{
+    TaskHandle_t worker = core->workers[core->next_worker];
+    core->next_worker = (core->next_worker + 1) % CONFIG_ESP_WORK_POOL_WORKERS_PER_CORE;
+    if (from_isr) {
+        vTaskNotifyGiveFromISR(worker, pxHigherPriorityTaskWoken);
+    } else {
+        xTaskNotifyGive(worker);
+    }
+}
+
+static void work_pool_worker(void *arg)
+{
+    work_core_t *own_core = &s_cores[(uintptr_t)arg];
+
+    while (true) {
+        work_job_t job;
+        BaseType_t found = work_core_pop(own_core, &job);
+#if WORK_POOL_CORES > 1
+        if (found == pdFALSE) {
+            //Own core is drained, steal from the other core's backlog
+            for (int i = 0; i < WORK_POOL_CORES && found == pdFALSE; i++) {
+                if (&s_cores[i] != own_core) {
+                    found = work_core_pop(&s_cores[i], &job);
+                }
+            }
+        }
+#endif
+        if (found == pdTRUE) {
+            job.fn(job.arg);
+        } else {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+    }
+}
+
+esp_err_t esp_work_pool_init(void)
+{
+    int expected = POOL_STATE_NONE;
+    if (!atomic_compare_exchange_strong(&s_pool_state, &expected, POOL_STATE_INITIALIZING)) {
+        //Someone else initializes (or has initialized) the pool, wait for it
+        while (atomic_load(&s_pool_state) != POOL_STATE_RUNNING) {
+            vTaskDelay(1);
+        }
+        return ESP_OK;
+    }
+
+    for (int core = 0; core < WORK_POOL_CORES; core++) {
+        portMUX_INITIALIZE(&s_cores[core].lock);
+        for (int i = 0; i < CONFIG_ESP_WORK_POOL_WORKERS_PER_CORE; i++) {
+            char name[configMAX_TASK_NAME_LEN];
+            snprintf(name, sizeof(name), "work_pool_%d_%d", core, i);
+            BaseType_t created = xTaskCreatePinnedToCore(work_pool_worker, name,
+                                                         CONFIG_ESP_WORK_POOL_TASK_STACK_SIZE,
+                                                         (void *)(uintptr_t)core,
+                                                         CONFIG_ESP_WORK_POOL_TASK_PRIORITY,
+                                                         &s_cores[core].workers[i], core);
+            if (created != pdPASS) {
+                ESP_LOGE(TAG, "failed to create worker %d on core %d", i, core);
+                //Tear down what was created so a later init can retry
+                for (int c = 0; c <= core; c++) {
+                    for (int w = 0; w < CONFIG_ESP_WORK_POOL_WORKERS_PER_CORE; w++) {
+                        if (s_cores[c].workers[w] != NULL) {
+                            vTaskDelete(s_cores[c].workers[w]);
+                            s_cores[c].workers[w] = NULL;
+                        }
+                    }
+                }
+                atomic_store(&s_pool_state, POOL_STATE_NONE);
+                return ESP_ERR_NO_MEM;
+            }
+        }
+    }
+    atomic_store(&s_pool_state, POOL_STATE_RUNNING);
+    ESP_LOGD(TAG, "pool running, %d worker(s) per core", CONFIG_ESP_WORK_POOL_WORKERS_PER_CORE);
+    return ESP_OK;
+}
+
+esp_err_t esp_work_pool_post(esp_work_fn_t fn, void *arg, esp_work_lane_t lane, int core_id)
+{
+    if (fn == NULL || lane >= ESP_WORK_LANE_MAX ||
+            core_id < ESP_WORK_POOL_NO_AFFINITY || core_id >= WORK_POOL_CORES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (atomic_load(&s_pool_state) != POOL_STATE_RUNNING) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (core_id == ESP_WORK_POOL_NO_AFFINITY) {
+        core_id = xPortGetCoreID();
+    }
+    work_core_t *core = &s_cores[core_id];
+
+    BaseType_t pushed;
+    BaseType_t had_backlog;
+    portENTER_CRITICAL(&core->lock);
+    had_backlog = (core->lanes[ESP_WORK_LANE_HIGH].count + core->lanes[ESP_WORK_LANE_LOW].count) > 0;
+    pushed = work_ring_push(&core->lanes[lane], fn, arg);
+    if (pushed == pdTRUE) {
+        work_core_notify(core, pdFALSE, NULL);
+    }
+    portEXIT_CRITICAL(&core->lock);
+    if (pushed == pdFALSE) {
+        return ESP_ERR_NO_MEM;
+    }
+
+#if WORK_POOL_CORES > 1
+    if (had_backlog) {
+        //The target core already has work queued, give the other core a chance to steal
+        work_core_t *other = &s_cores[(core_id + 1) % WORK_POOL_CORES];
+        portENTER_CRITICAL(&other->lock);
+        work_core_notify(other, pdFALSE, NULL);
+        portEXIT_CRITICAL(&other->lock);
+    }
+#else
+    (void)had_backlog;
+#endif
+    return ESP_OK;
+}
+
+esp_err_t esp_work_pool_post_from_isr(esp_work_fn_t fn, void *arg, esp_work_lane_t lane,
+                                      BaseType_t *pxHigherPriorityTaskWoken)
+{
+    if (fn == NULL || lane >= ESP_WORK_LANE_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (atomic_load(&s_pool_state) != POOL_STATE_RUNNING) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    work_core_t *core = &s_cores[xPortGetCoreID()];
+
+    BaseType_t pushed;
+    portENTER_CRITICAL_ISR(&core->lock);
+    pushed = work_ring_push(&core->lanes[lane], fn, arg);
+    if (pushed == pdTRUE) {
+        work_core_notify(core, pdTRUE, pxHigherPriorityTaskWoken);
+    }
+    portEXIT_CRITICAL_ISR(&core->lock);
+    return (pushed == pdTRUE) ? ESP_OK : ESP_ERR_NO_MEM;
+}
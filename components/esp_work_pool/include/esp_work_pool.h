@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Shared worker pool
+ *
+ * A fixed set of worker tasks, pinned one group per core, executes short jobs
+ * posted from tasks or ISRs. Components that only need "run this function
+ * soon, off the current context" can use the pool instead of spawning their
+ * own task, sharing stack memory and avoiding cross-core wakeups: jobs posted
+ * without an affinity run on the posting core, and an idle worker steals from
+ * the other core's backlog so bursts spread across both cores.
+ *
+ * Jobs must not block for long periods: a blocked job stalls one worker and
+ * everything queued behind it on that core (minus what the other core steals).
+ */
+
+/**
+ * @brief Prototype of a job function
+ *
+ * @param[in] arg   Argument given at post time
+ */
+typedef void (*esp_work_fn_t)(void *arg);
+
+/**
+ * @brief Priority lanes of the pool
+ *
+ * Workers always drain the high lane of a core before its low lane. Lanes
+ * order jobs relative to each other; all jobs run at the worker task priority.
+ */
+typedef enum {
+    ESP_WORK_LANE_HIGH = 0,     /*!< Drained before the low lane */
+    ESP_WORK_LANE_LOW,          /*!< Bulk/background jobs */
+    ESP_WORK_LANE_MAX,
+} esp_work_lane_t;
+
+/**
+ * @brief Post a job to the core the caller is running on
+ */
+#define ESP_WORK_POOL_NO_AFFINITY    (-1)
+
+/**
+ * @brief Start the worker pool
+ *
+ * Creates the worker tasks according to the ESP_WORK_POOL_* configuration
+ * options. Safe to call from several components; all calls after the first
+ * return once the pool is running.
+ *
+ * @return
+ *  - ESP_OK: Pool is running
+ *  - ESP_ERR_NO_MEM: Worker task creation failed
+ */
+esp_err_t esp_work_pool_init(void);
+
+/**
+ * @brief Post a job to the pool
+ *
+ * Never blocks: posting to a full ring fails immediately.
+ *
+ * @param[in] fn        Function to execute
+ * @param[in] arg       Argument passed to fn
+ * @param[in] lane      Priority lane to queue the job on
+ * @param[in] core_id   Core to run the job on, or ESP_WORK_POOL_NO_AFFINITY to
+ *                      use the posting core (an idle worker on the other core
+ *                      may steal the job either way)
+ *
+ * @return
+ *  - ESP_OK: Job queued
+ *  - ESP_ERR_INVALID_ARG: fn is NULL, or lane/core_id out of range
+ *  - ESP_ERR_INVALID_STATE: esp_work_pool_init() has not completed
+ *  - ESP_ERR_NO_MEM: The target ring is full
+ */
+esp_err_t esp_work_pool_post(esp_work_fn_t fn, void *arg, esp_work_lane_t lane, int core_id);
+
+/**
+ * @brief Post a job to the pool from an ISR
+ *
+ * The job is queued on the core servicing the interrupt.
+ *
+ * @param[in]  fn                           Function to execute
+ * @param[in]  arg                          Argument passed to fn
+ * @param[in]  lane                         Priority lane to queue the job on
+ * @param[out] pxHigherPriorityTaskWoken    Set to pdTRUE if a woken worker
+ *                                          requires a context switch on ISR
+ *                                          exit, can be NULL
+ *
+ * @return
+ *  - ESP_OK: Job queued
+ *  - ESP_ERR_INVALID_ARG: fn is NULL or lane out of range
+ *  - ESP_ERR_INVALID_STATE: esp_work_pool_init() has not completed
+ *  - ESP_ERR_NO_MEM: The target ring is full
+ */
+esp_err_t esp_work_pool_post_from_isr(esp_work_fn_t fn, void *arg, esp_work_lane_t lane,
+                                      BaseType_t *pxHigherPriorityTaskWoken);
+
+#ifdef __cplusplus
+}
+#endif
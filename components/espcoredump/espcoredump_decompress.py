@@ -0,0 +1,138 @@
+#!/usr/bin/env python
+#
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Converts a core dump image produced with CONFIG_ESP_COREDUMP_COMPRESSION
+# into the regular uncompressed layout, so it can be passed to espcoredump.py
+# (the esp-coredump package) unchanged.
+#
+# The compressed image keeps the 24-byte core dump header uncompressed; the
+# rest of the payload is a sequence of independently compressed LZ4 blocks:
+#
+#     <comp_len:u16 LE> <raw_len:u16 LE> <comp_len bytes of LZ4 block data>
+#
+# comp_len == raw_len marks a stored (incompressible) block. The image ends
+# with the configured checksum (CRC32 or SHA256) over everything before it,
+# which this script re-computes for the rebuilt image.
+
+import argparse
+import hashlib
+import struct
+import sys
+import zlib
+
+HEADER_FMT = '<6I'
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+CACHE_SIZE = 32  # COREDUMP_CACHE_SIZE, output is padded to this multiple
+
+# (chip << 16) | (major << 8) | minor; minor 4/5 are the LZ4 variants of 2/3
+MINOR_ELF_CRC32 = 2
+MINOR_ELF_SHA256 = 3
+MINOR_ELF_CRC32_LZ4 = 4
+MINOR_ELF_SHA256_LZ4 = 5
+
+
+def lz4_decompress_block(src, raw_len):  # type: (bytes, int) -> bytes
+    dst = bytearray()
+    pos = 0
+    while pos < len(src):
+        token = src[pos]
+        pos += 1
+        lit_len = token >> 4
+        if lit_len == 15:
+            while True:
+                b = src[pos]
+                pos += 1
+                lit_len += b
+                if b != 255:
+                    break
+        dst += src[pos:pos + lit_len]
+        pos += lit_len
+        if pos >= len(src):
+            break  # last sequence carries literals only
+        offset = src[pos] | (src[pos + 1] << 8)
+        pos += 2
+        match_len = (token & 0x0F) + 4
+        if (token & 0x0F) == 15:
+            while True:
+                b = src[pos]
+                pos += 1
+                match_len += b
+                if b != 255:
+                    break
+        match_pos = len(dst) - offset
+        for _ in range(match_len):  # may self-overlap, copy byte-wise
+            dst.append(dst[match_pos])
+            match_pos += 1
+    if len(dst) != raw_len:
+        raise ValueError('LZ4 block decoded to %d bytes, expected %d' % (len(dst), raw_len))
+    return bytes(dst)
+
+
+def main():  # type: () -> None
+    parser = argparse.ArgumentParser(
+        description='Convert an LZ4-compressed core dump image to the regular layout')
+    parser.add_argument('input', help='compressed core dump image (raw partition dump)')
+    parser.add_argument('output', help='uncompressed core dump image to write')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        image = f.read()
+
+    data_len, version, tasks_num, tcb_sz, mem_segs_num, chip_rev = \
+        struct.unpack_from(HEADER_FMT, image)
+    minor = version & 0xFF
+    if minor == MINOR_ELF_CRC32_LZ4:
+        cs_len = 4
+        plain_minor = MINOR_ELF_CRC32
+    elif minor == MINOR_ELF_SHA256_LZ4:
+        cs_len = 32
+        plain_minor = MINOR_ELF_SHA256
+    else:
+        sys.exit('Not a compressed core dump (version 0x%08x)' % version)
+    if data_len > len(image):
+        sys.exit('Image truncated: header says %d bytes, file has %d' % (data_len, len(image)))
+
+    # The payload runs from the header to the checksum; the zero padding up to
+    # the cache size belongs to the checksummed area but not to the stream, a
+    # frame header of zeros ends the walk naturally.
+    elf = bytearray()
+    pos = HEADER_SIZE
+    end = data_len - cs_len
+    while pos + 4 <= end:
+        comp_len, raw_len = struct.unpack_from('<HH', image, pos)
+        if raw_len == 0:
+            break
+        pos += 4
+        block = image[pos:pos + comp_len]
+        pos += comp_len
+        if comp_len == raw_len:
+            elf += block
+        else:
+            elf += lz4_decompress_block(block, raw_len)
+
+    plain_version = (version & ~0xFF) | plain_minor
+    out_len = HEADER_SIZE + len(elf)
+    padding = (CACHE_SIZE - out_len % CACHE_SIZE) % CACHE_SIZE
+    total = out_len + padding + cs_len
+
+    out = bytearray()
+    out += struct.pack(HEADER_FMT, total, plain_version, tasks_num, tcb_sz,
+                       mem_segs_num, chip_rev)
+    out += elf
+    out += b'\x00' * padding
+    if cs_len == 4:
+        out += struct.pack('<I', zlib.crc32(bytes(out)) & 0xFFFFFFFF)
+    else:
+        out += hashlib.sha256(bytes(out)).digest()
+
+    with open(args.output, 'wb') as f:
+        f.write(bytes(out))
+    print('Decompressed %d bytes into %d bytes of ELF data, wrote %s'
+          % (data_len, len(elf), args.output))
+
+
+if __name__ == '__main__':
+    main()
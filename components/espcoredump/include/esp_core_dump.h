@@ -123,6 +123,25 @@ esp_err_t esp_core_dump_image_get(size_t* out_addr, size_t *out_size);
  */
 esp_err_t esp_core_dump_image_erase(void);
 
+/**
+ * @brief  Exclude a memory region from core dumps.
+ *         Large buffers whose content has no debugging value, such as frame
+ *         buffers or network buffer pools, can be registered here to reduce
+ *         the core dump size and the time spent writing it during a crash.
+ *         Heap allocations that lie entirely inside an excluded region and
+ *         parts of data sections covered by one are left out of the dump.
+ *
+ * @note   Call during startup; regions cannot be registered while a core dump
+ *         is being written.
+ *
+ * @param  start  Start address of the region to exclude.
+ * @param  size   Size of the region, in bytes. Must not be 0.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if size is 0, ESP_ERR_NO_MEM
+ *         if the fixed region table is full.
+ */
+esp_err_t esp_core_dump_exclude_region(uint32_t start, uint32_t size);
+
 #if CONFIG_ESP_COREDUMP_ENABLE_TO_FLASH && CONFIG_ESP_COREDUMP_DATA_FORMAT_ELF
 
 /**
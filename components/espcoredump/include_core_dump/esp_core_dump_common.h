@@ -136,6 +136,51 @@ esp_err_t esp_core_dump_write_data(core_dump_write_data_t *wr_data, void *data,
  */
 esp_err_t esp_core_dump_write_end(core_dump_write_data_t *wr_data);
 
+#if CONFIG_ESP_COREDUMP_COMPRESSION
+/**
+ * @brief Writes a data chunk to the flash without passing through the
+ * compression layer. Used for the core dump header and by the compression
+ * layer itself.
+ */
+esp_err_t esp_core_dump_write_data_raw(core_dump_write_data_t *wr_data, void *data, uint32_t data_len);
+
+/**
+ * @brief Resets the LZ4 compression layer.
+ *
+ * In size-only mode the compressed output is counted but not written, so the
+ * exact amount of flash to erase can be determined before the real pass.
+ * Otherwise the first sizeof(core_dump_header_t) bytes fed to
+ * esp_core_dump_write_data() bypass compression, keeping the header readable
+ * in place.
+ */
+void esp_core_dump_compress_begin(core_dump_write_data_t *wr_data, bool size_only);
+
+/**
+ * @brief Flushes the final partial block and returns the total number of
+ * bytes produced by the compression layer since the last begin, not counting
+ * the bytes that bypassed it.
+ */
+esp_err_t esp_core_dump_compress_end(uint32_t *out_len);
+#endif
+
+/**
+ * @brief Get the number of memory regions registered with
+ * esp_core_dump_exclude_region().
+ */
+uint32_t esp_core_dump_get_excluded_region_count(void);
+
+/**
+ * @brief Get an excluded memory region by index.
+ *
+ * @return false if index is out of range, true else.
+ */
+bool esp_core_dump_get_excluded_region(uint32_t index, uint32_t *start, uint32_t *size);
+
+/**
+ * @brief Check if a memory range lies entirely inside an excluded region.
+ */
+bool esp_core_dump_region_is_excluded(uint32_t start, uint32_t size);
+
 /**
  * @brief Retrieve the stack information which will be used from the coredump module itself.
  * It will show the whole stack boundaries in case the stack is shared with the crashed task.
@@ -208,7 +253,18 @@ static inline void esp_core_dump_task_iterator_init(TaskIterator_t *iter)
  */
 static inline int esp_core_dump_task_iterator_next(TaskIterator_t *task_iterator)
 {
+#if CONFIG_ESP_COREDUMP_CAPTURE_CURRENT_TASK_ONLY
+    /* Yield only the panicked task: the first call returns it, the second ends
+     * the traversal. All writers size and emit the dump through this iterator,
+     * so limiting it here keeps the headers and the payload consistent. */
+    if (task_iterator->pxTaskHandle != NULL) {
+        return -1;
+    }
+    task_iterator->pxTaskHandle = (TaskHandle_t)esp_core_dump_get_current_task_handle();
+    return 0;
+#else
     return xTaskGetNext(task_iterator);
+#endif
 }
 
 #ifdef __cplusplus
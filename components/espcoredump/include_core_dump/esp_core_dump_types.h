@@ -74,6 +74,9 @@ extern "C" {
 #define COREDUMP_VERSION_BIN_CURRENT        COREDUMP_VERSION_MAKE(COREDUMP_VERSION_BIN, 3) // -> 0x0003
 #define COREDUMP_VERSION_ELF_CRC32          COREDUMP_VERSION_MAKE(COREDUMP_VERSION_ELF, 2) // -> 0x0102
 #define COREDUMP_VERSION_ELF_SHA256         COREDUMP_VERSION_MAKE(COREDUMP_VERSION_ELF, 3) // -> 0x0103
+/* Same layouts with the payload after the header stored as LZ4 blocks */
+#define COREDUMP_VERSION_ELF_CRC32_LZ4      COREDUMP_VERSION_MAKE(COREDUMP_VERSION_ELF, 4) // -> 0x0104
+#define COREDUMP_VERSION_ELF_SHA256_LZ4     COREDUMP_VERSION_MAKE(COREDUMP_VERSION_ELF, 5) // -> 0x0105
 #define COREDUMP_CURR_TASK_MARKER           0xDEADBEEF
 #define COREDUMP_CURR_TASK_NOT_FOUND        -1
 
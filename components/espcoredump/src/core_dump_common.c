@@ -10,6 +10,7 @@
 #include "freertos/FreeRTOS.h"
 #include "esp_private/freertos_debug.h"
 #include "esp_rom_sys.h"
+#include "esp_core_dump.h"
 #include "esp_core_dump_port.h"
 #include "esp_core_dump_common.h"
 #if CONFIG_ESP_SYSTEM_HW_STACK_GUARD
@@ -312,6 +313,55 @@ int esp_core_dump_get_user_ram_info(coredump_region_t region, uint32_t *start)
     return total_sz;
 }
 
+/**
+ * @brief Memory regions the application asked to leave out of the dump,
+ * e.g. frame buffers. Registered at runtime, before any crash.
+ */
+#define COREDUMP_MAX_EXCLUDED_REGIONS   8
+
+static core_dump_mem_seg_header_t s_excluded_regions[COREDUMP_MAX_EXCLUDED_REGIONS];
+static uint32_t s_excluded_regions_count;
+
+esp_err_t esp_core_dump_exclude_region(uint32_t start, uint32_t size)
+{
+    if (size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_excluded_regions_count >= COREDUMP_MAX_EXCLUDED_REGIONS) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_excluded_regions[s_excluded_regions_count].start = start;
+    s_excluded_regions[s_excluded_regions_count].size = size;
+    s_excluded_regions_count++;
+    return ESP_OK;
+}
+
+uint32_t esp_core_dump_get_excluded_region_count(void)
+{
+    return s_excluded_regions_count;
+}
+
+bool esp_core_dump_get_excluded_region(uint32_t index, uint32_t *start, uint32_t *size)
+{
+    if (index >= s_excluded_regions_count) {
+        return false;
+    }
+    *start = s_excluded_regions[index].start;
+    *size = s_excluded_regions[index].size;
+    return true;
+}
+
+bool esp_core_dump_region_is_excluded(uint32_t start, uint32_t size)
+{
+    for (uint32_t i = 0; i < s_excluded_regions_count; i++) {
+        if (start >= s_excluded_regions[i].start
+                && (start + size) <= (s_excluded_regions[i].start + s_excluded_regions[i].size)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 #if CONFIG_ESP_COREDUMP_CAPTURE_DRAM
 void esp_core_dump_get_own_stack_info(uint32_t *addr, uint32_t *size)
 {
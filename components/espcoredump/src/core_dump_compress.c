@@ -0,0 +1,252 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/param.h>
+#include "sdkconfig.h"
+#include "esp_core_dump_types.h"
+#include "esp_core_dump_common.h"
+
+#if CONFIG_ESP_COREDUMP_COMPRESSION
+
+/* LZ4 block compression layer sitting between the ELF writer and the flash
+ * cache. The payload after the core dump header is stored as a sequence of
+ * independently compressed blocks:
+ *
+ *     <comp_len:u16> <raw_len:u16> <comp_len bytes of LZ4 block data>
+ *
+ * comp_len == raw_len marks a stored (incompressible) block. Blocks are
+ * independent, so neither side needs a history window; the encoder state
+ * below is everything the crash path requires and no allocation is done.
+ *
+ * The ROM copy of miniz (tdefl) was considered for this purpose, but its
+ * compressor state is close to 100KB, which is far too much to reserve or
+ * allocate reliably while crashing. The LZ4 format costs a few percent of
+ * ratio and needs around 12KB of static state instead.
+ */
+
+#define COREDUMP_COMPRESS_BLOCK_SIZE    4096
+#define COREDUMP_COMPRESS_FRAME_HDR     4
+/* Worst case LZ4 output for an incompressible block, see the block format */
+#define COREDUMP_COMPRESS_OUT_SIZE      (COREDUMP_COMPRESS_BLOCK_SIZE + COREDUMP_COMPRESS_BLOCK_SIZE / 255 + 16)
+
+#define LZ4_HASH_LOG        11
+#define LZ4_HASH_SIZE       (1 << LZ4_HASH_LOG)
+#define LZ4_MIN_MATCH       4
+/* Spec: the last match must start at least 12 bytes before the end of the
+ * block and the block must end with at least 5 literals. */
+#define LZ4_MF_LIMIT        12
+#define LZ4_LAST_LITERALS   5
+
+const static char TAG[] __attribute__((unused)) = "esp_core_dump_compress";
+
+static uint8_t s_in_buf[COREDUMP_COMPRESS_BLOCK_SIZE];
+static uint8_t s_out_buf[COREDUMP_COMPRESS_OUT_SIZE];
+static uint16_t s_hash_table[LZ4_HASH_SIZE];
+static uint32_t s_in_len;
+static uint32_t s_out_total;
+static uint32_t s_raw_remaining;
+static bool s_size_only;
+static core_dump_write_data_t *s_wr_data;
+
+static inline uint32_t s_lz4_read32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t s_lz4_hash(uint32_t seq)
+{
+    return (seq * 2654435761U) >> (32 - LZ4_HASH_LOG);
+}
+
+/* Compress one block into dst (sized COREDUMP_COMPRESS_OUT_SIZE) and return
+ * the compressed length. The output follows the standard LZ4 block format,
+ * so the host side can rely on any stock decoder. */
+static uint32_t s_lz4_compress_block(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+    uint32_t pos = 0;
+    uint32_t anchor = 0;
+    uint32_t out = 0;
+
+    memset(s_hash_table, 0, sizeof(s_hash_table));
+
+    if (len >= LZ4_MF_LIMIT) {
+        const uint32_t mf_limit = len - LZ4_MF_LIMIT;
+        const uint32_t match_limit = len - LZ4_LAST_LITERALS;
+
+        while (pos <= mf_limit) {
+            uint32_t seq = s_lz4_read32(&src[pos]);
+            uint32_t h = s_lz4_hash(seq);
+            uint32_t cand = s_hash_table[h];    /* position + 1, 0 when empty */
+            s_hash_table[h] = (uint16_t)(pos + 1);
+
+            if (cand == 0 || s_lz4_read32(&src[cand - 1]) != seq) {
+                pos++;
+                continue;
+            }
+            cand--;
+
+            uint32_t match_len = LZ4_MIN_MATCH;
+            while (pos + match_len < match_limit && src[cand + match_len] == src[pos + match_len]) {
+                match_len++;
+            }
+
+            /* token: literal run length and match length nibbles */
+            uint32_t lit_len = pos - anchor;
+            uint8_t *token = &dst[out++];
+            if (lit_len >= 15) {
+                *token = 0xF0;
+                uint32_t l = lit_len - 15;
+                while (l >= 255) {
+                    dst[out++] = 255;
+                    l -= 255;
+                }
+                dst[out++] = (uint8_t)l;
+            } else {
+                *token = (uint8_t)(lit_len << 4);
+            }
+            memcpy(&dst[out], &src[anchor], lit_len);
+            out += lit_len;
+
+            uint32_t offset = pos - cand;
+            dst[out++] = (uint8_t)(offset & 0xFF);
+            dst[out++] = (uint8_t)(offset >> 8);
+
+            uint32_t m = match_len - LZ4_MIN_MATCH;
+            if (m >= 15) {
+                *token |= 0x0F;
+                m -= 15;
+                while (m >= 255) {
+                    dst[out++] = 255;
+                    m -= 255;
+                }
+                dst[out++] = (uint8_t)m;
+            } else {
+                *token |= (uint8_t)m;
+            }
+
+            pos += match_len;
+            anchor = pos;
+        }
+    }
+
+    /* trailing literals, no match part in the final sequence */
+    uint32_t lit_len = len - anchor;
+    uint8_t *token = &dst[out++];
+    if (lit_len >= 15) {
+        *token = 0xF0;
+        uint32_t l = lit_len - 15;
+        while (l >= 255) {
+            dst[out++] = 255;
+            l -= 255;
+        }
+        dst[out++] = (uint8_t)l;
+    } else {
+        *token = (uint8_t)(lit_len << 4);
+    }
+    memcpy(&dst[out], &src[anchor], lit_len);
+    out += lit_len;
+
+    return out;
+}
+
+static esp_err_t s_compress_sink(void *data, uint32_t data_len)
+{
+    s_out_total += data_len;
+    if (s_size_only) {
+        return ESP_OK;
+    }
+    return esp_core_dump_write_data_raw(s_wr_data, data, data_len);
+}
+
+static esp_err_t s_compress_flush_block(void)
+{
+    if (s_in_len == 0) {
+        return ESP_OK;
+    }
+
+    uint32_t comp_len = s_lz4_compress_block(s_in_buf, s_in_len, s_out_buf);
+    uint8_t *payload = s_out_buf;
+    if (comp_len >= s_in_len) {
+        /* incompressible block, store it raw; comp_len == raw_len marks this */
+        payload = s_in_buf;
+        comp_len = s_in_len;
+    }
+
+    uint8_t frame_hdr[COREDUMP_COMPRESS_FRAME_HDR] = {
+        (uint8_t)(comp_len & 0xFF), (uint8_t)(comp_len >> 8),
+        (uint8_t)(s_in_len & 0xFF), (uint8_t)(s_in_len >> 8),
+    };
+    esp_err_t err = s_compress_sink(frame_hdr, sizeof(frame_hdr));
+    if (err == ESP_OK) {
+        err = s_compress_sink(payload, comp_len);
+    }
+    s_in_len = 0;
+    return err;
+}
+
+void esp_core_dump_compress_begin(core_dump_write_data_t *wr_data, bool size_only)
+{
+    s_wr_data = wr_data;
+    s_size_only = size_only;
+    s_in_len = 0;
+    s_out_total = 0;
+    /* The core dump header must stay readable in place: boot-time image checks
+     * and the host tooling read the image size and version from it. During the
+     * sizing pass the header is not fed to the writer at all, so nothing needs
+     * to pass through. */
+    s_raw_remaining = size_only ? 0 : sizeof(core_dump_header_t);
+}
+
+esp_err_t esp_core_dump_compress_end(uint32_t *out_len)
+{
+    esp_err_t err = s_compress_flush_block();
+    if (out_len != NULL) {
+        *out_len = s_out_total;
+    }
+    s_wr_data = NULL;
+    return err;
+}
+
+/* With compression enabled this function replaces the direct alias to the
+ * flash write routine, see core_dump_flash.c. */
+esp_err_t esp_core_dump_write_data(core_dump_write_data_t *wr_data, void *data, uint32_t data_len)
+{
+    uint8_t *p = data;
+    esp_err_t err;
+
+    if (s_raw_remaining > 0) {
+        uint32_t raw_len = MIN(s_raw_remaining, data_len);
+        err = esp_core_dump_write_data_raw(wr_data, p, raw_len);
+        if (err != ESP_OK) {
+            return err;
+        }
+        s_raw_remaining -= raw_len;
+        p += raw_len;
+        data_len -= raw_len;
+    }
+
+    while (data_len > 0) {
+        uint32_t copy_len = MIN(COREDUMP_COMPRESS_BLOCK_SIZE - s_in_len, data_len);
+        memcpy(&s_in_buf[s_in_len], p, copy_len);
+        s_in_len += copy_len;
+        p += copy_len;
+        data_len -= copy_len;
+
+        if (s_in_len == COREDUMP_COMPRESS_BLOCK_SIZE) {
+            err = s_compress_flush_block();
+            if (err != ESP_OK) {
+                return err;
+            }
+        }
+    }
+
+    return ESP_OK;
+}
+
+#endif /* CONFIG_ESP_COREDUMP_COMPRESSION */
@@ -37,7 +37,11 @@ static uint32_t core_dump_crc_size(void)
 
 static uint32_t core_dump_crc_version(void)
 {
+#if CONFIG_ESP_COREDUMP_COMPRESSION
+    return COREDUMP_VERSION_ELF_CRC32_LZ4;
+#else
     return COREDUMP_VERSION_ELF_CRC32;
+#endif
 }
 
 static void core_dump_crc_init(core_dump_checksum_ctx cks_ctx)
@@ -522,6 +522,54 @@ static int elf_write_tasks_data(core_dump_elf_t *self)
     return elf_len + ret;
 }
 
+/* Write a memory range as PT_LOAD segments, splitting it around the regions
+ * registered with esp_core_dump_exclude_region(). Returns the accumulated
+ * segment size, which may be 0 if the whole range is excluded. */
+static int elf_add_segment_filtered(core_dump_elf_t *self, uint32_t start, uint32_t data_len)
+{
+    const uint32_t end = start + data_len;
+    int total_sz = 0;
+
+    while (start < end) {
+        uint32_t chunk_end = end;
+        uint32_t skip_to = 0;
+
+        for (uint32_t i = 0;; i++) {
+            uint32_t ex_start = 0;
+            uint32_t ex_size = 0;
+            if (!esp_core_dump_get_excluded_region(i, &ex_start, &ex_size)) {
+                break;
+            }
+            uint32_t ex_end = ex_start + ex_size;
+            if (ex_start <= start && ex_end > start) {
+                /* current position is inside an excluded region, jump past it */
+                skip_to = MAX(skip_to, ex_end);
+            } else if (ex_start > start && ex_start < chunk_end) {
+                /* stop the current chunk at the nearest excluded region */
+                chunk_end = ex_start;
+            }
+        }
+
+        if (skip_to != 0) {
+            ESP_COREDUMP_LOG_PROCESS("Skip excluded region @ 0x%x", start);
+            start = MIN(skip_to, end);
+            continue;
+        }
+
+        int ret = elf_add_segment(self, PT_LOAD,
+                                  start,
+                                  (void*)start,
+                                  chunk_end - start);
+        if (ret <= 0) {
+            return ret;
+        }
+        total_sz += ret;
+        start = chunk_end;
+    }
+
+    return total_sz;
+}
+
 #if CONFIG_ESP_COREDUMP_CAPTURE_DRAM
 
 /* Coredump stack will also be used by the checksum functions while saving sections.
@@ -550,12 +598,9 @@ static int esp_core_dump_store_section(core_dump_elf_t *self, uint32_t start, ui
     if (self->coredump_stack_start > start && self->coredump_stack_start < end) {
         /* write until the coredump stack. */
         data_len = self->coredump_stack_start - start;
-        ret = elf_add_segment(self, PT_LOAD,
-                              start,
-                              (void*)start,
-                              data_len);
+        ret = elf_add_segment_filtered(self, start, data_len);
 
-        if (ret <= 0) {
+        if (ret < 0) {
             return ret;
         }
         total_sz += ret;
@@ -566,11 +611,8 @@ static int esp_core_dump_store_section(core_dump_elf_t *self, uint32_t start, ui
     }
 
     if (data_len > 0) {
-        ret = elf_add_segment(self, PT_LOAD,
-                              (uint32_t)start,
-                              (void*)start,
-                              (uint32_t)data_len);
-        if (ret <= 0) {
+        ret = elf_add_segment_filtered(self, start, data_len);
+        if (ret < 0) {
             return ret;
         }
         total_sz += ret;
@@ -616,6 +658,11 @@ bool esp_core_dump_write_heap_blocks(walker_heap_into_t heap_info, walker_block_
             return true;
         }
 
+        if (esp_core_dump_region_is_excluded((uint32_t)block_info.ptr, block_info.size)) {
+            /* the application asked to leave this block out, e.g. a frame buffer */
+            return true;
+        }
+
         *ret = elf_add_segment(self, PT_LOAD,
                                (uint32_t)block_info.ptr,
                                (void*)block_info.ptr,
@@ -633,10 +680,7 @@ bool esp_core_dump_write_heap_blocks(walker_heap_into_t heap_info, walker_block_
 
 static int esp_core_dump_store_section(core_dump_elf_t *self, uint32_t start, uint32_t data_len)
 {
-    return elf_add_segment(self, PT_LOAD,
-                           start,
-                           (void*)start,
-                           data_len);
+    return elf_add_segment_filtered(self, start, data_len);
 }
 
 #endif
@@ -652,8 +696,9 @@ static int elf_write_core_dump_user_data(core_dump_elf_t *self)
         ELF_CHECK_ERR((data_len >= 0), ELF_PROC_ERR_OTHER, "invalid memory region");
 
         if (data_len > 0) {
+            /* the result may be 0 if the region is entirely excluded */
             int ret = esp_core_dump_store_section(self, start, data_len);
-            ELF_CHECK_ERR((ret > 0), ret, "memory region write failed. Returned (%d).", ret);
+            ELF_CHECK_ERR((ret >= 0), ret, "memory region write failed. Returned (%d).", ret);
             total_sz += ret;
         }
     }
@@ -848,6 +893,35 @@ static esp_err_t esp_core_dump_write_elf(void)
     ESP_COREDUMP_LOG_PROCESS("Core dump tot_len=%lu", tot_len);
     ESP_COREDUMP_LOG_PROCESS("============== Data size = %d bytes ============", tot_len);
 
+#if CONFIG_ESP_COREDUMP_COMPRESSION
+    /* Run the two write stages once more through the compressor with the
+     * output discarded, to learn the exact compressed size. Only that many
+     * flash sectors are then erased and written, which is where the crash
+     * path spends its time. Memory cannot change while crashing, so the
+     * real pass below produces the same byte stream. */
+    esp_core_dump_compress_begin(&self.write_data, true);
+    self.elf_stage = ELF_STAGE_PLACE_HEADERS;
+    self.elf_next_data_offset = sizeof(elfhdr) + ELF_SEG_HEADERS_COUNT(&self) * sizeof(elf_phdr);
+    ret = esp_core_dump_do_write_elf_pass(&self);
+    if (ret < 0) {
+        return ret;
+    }
+    self.elf_stage = ELF_STAGE_PLACE_DATA;
+    self.elf_next_data_offset = sizeof(elfhdr) + ELF_SEG_HEADERS_COUNT(&self) * sizeof(elf_phdr);
+    ret = esp_core_dump_do_write_elf_pass(&self);
+    if (ret < 0) {
+        return ret;
+    }
+    uint32_t compressed_len = 0;
+    esp_err_t comp_err = esp_core_dump_compress_end(&compressed_len);
+    if (comp_err != ESP_OK) {
+        return comp_err;
+    }
+    ESP_COREDUMP_LOG_PROCESS("======== Compressed %d into %d bytes ========",
+                             tot_len - sizeof(dump_hdr), compressed_len);
+    tot_len = sizeof(dump_hdr) + compressed_len;
+#endif
+
     // Prepare write elf
     err = esp_core_dump_write_prepare(&self.write_data, (uint32_t*)&tot_len);
     if (err != ESP_OK) {
@@ -862,6 +936,12 @@ static esp_err_t esp_core_dump_write_elf(void)
         return err;
     }
 
+#if CONFIG_ESP_COREDUMP_COMPRESSION
+    /* Compress for real this time; the core dump header written below
+     * passes through uncompressed. */
+    esp_core_dump_compress_begin(&self.write_data, false);
+#endif
+
     // Write core dump header
     dump_hdr.data_len = tot_len;
     dump_hdr.version = esp_core_dump_elf_version();
@@ -895,6 +975,15 @@ static esp_err_t esp_core_dump_write_elf(void)
     write_len += ret;
     ESP_COREDUMP_LOG_PROCESS("=========== Data written size = %d bytes ==========", write_len);
 
+#if CONFIG_ESP_COREDUMP_COMPRESSION
+    // Flush the last, possibly partial, compressed block
+    err = esp_core_dump_compress_end(NULL);
+    if (err != ESP_OK) {
+        ESP_COREDUMP_LOGE("Failed to flush compressed data (%d)!", err);
+        return err;
+    }
+#endif
+
     // Write end, update checksum
     err = esp_core_dump_write_end(&self.write_data);
     if (err != ESP_OK) {
@@ -1020,6 +1109,11 @@ esp_err_t esp_core_dump_get_panic_reason(char *reason_buffer, size_t buffer_size
         return ESP_ERR_INVALID_ARG;
     }
 
+#if CONFIG_ESP_COREDUMP_COMPRESSION
+    /* The image in flash is LZ4 compressed and cannot be parsed in place. */
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+
     esp_partition_mmap_handle_t core_data_handle;
     uint8_t *ptr = elf_core_dump_image_ptr(&core_data_handle);
     if (ptr == NULL) {
@@ -1045,6 +1139,11 @@ esp_err_t esp_core_dump_get_summary(esp_core_dump_summary_t *summary)
         return ESP_ERR_INVALID_ARG;
     }
 
+#if CONFIG_ESP_COREDUMP_COMPRESSION
+    /* The image in flash is LZ4 compressed and cannot be parsed in place. */
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+
     esp_partition_mmap_handle_t core_data_handle;
     uint8_t *ptr = elf_core_dump_image_ptr(&core_data_handle);
     if (ptr == NULL) {
@@ -87,7 +87,11 @@ static uint32_t core_dump_sha_size(void)
 
 static uint32_t core_dump_sha_version(void)
 {
+#if CONFIG_ESP_COREDUMP_COMPRESSION
+    return COREDUMP_VERSION_ELF_SHA256_LZ4;
+#else
     return COREDUMP_VERSION_ELF_SHA256;
+#endif
 }
 
 static void core_dump_sha_init(core_dump_checksum_ctx cks_ctx)
@@ -4,6 +4,10 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "sdkconfig.h"
 #include "diskio_impl.h"
 #include "ffconf.h"
 #include "ff.h"
@@ -16,6 +20,182 @@ static bool s_disk_status_check_en[FF_VOLUMES] = { };
 
 static const char* TAG = "diskio_sdmmc";
 
+#if CONFIG_FATFS_SDMMC_SECTOR_CACHE
+#define SECTOR_CACHE_SIZE       CONFIG_FATFS_SDMMC_SECTOR_CACHE_SIZE
+#define SECTOR_CACHE_READAHEAD  CONFIG_FATFS_SDMMC_SECTOR_CACHE_READAHEAD
+
+typedef struct {
+    DWORD sector;           //!< Sector number held in this slot
+    uint32_t stamp;         //!< Last access stamp, used for the LRU eviction
+    bool valid;             //!< Whether the slot holds a sector
+    bool dirty;             //!< Whether the slot holds data newer than the card
+} sector_cache_slot_t;
+
+typedef struct {
+    sector_cache_slot_t slots[SECTOR_CACHE_SIZE];
+    uint8_t* data;          //!< Payload storage, SECTOR_CACHE_SIZE sectors
+    uint8_t* burst_buf;     //!< Bounce buffer for the read-ahead burst
+    size_t sector_size;
+    uint32_t stamp;         //!< Running access counter
+    DWORD next_sector;      //!< The sector a sequential read pattern is expected to request next
+} sector_cache_t;
+
+/* The cache relies on FatFS re-entrancy locking (FF_FS_REENTRANT) for thread safety,
+ * the same way the rest of the diskio layer does */
+static sector_cache_t* s_sector_cache[FF_VOLUMES] = { NULL };
+
+static inline uint8_t* s_cache_slot_data(sector_cache_t* cache, int slot)
+{
+    return cache->data + slot * cache->sector_size;
+}
+
+static int s_cache_find(sector_cache_t* cache, DWORD sector)
+{
+    for (int i = 0; i < SECTOR_CACHE_SIZE; i++) {
+        if (cache->slots[i].valid && cache->slots[i].sector == sector) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static DRESULT s_cache_flush_slot(BYTE pdrv, sector_cache_t* cache, int slot)
+{
+    if (!cache->slots[slot].valid || !cache->slots[slot].dirty) {
+        return RES_OK;
+    }
+    esp_err_t err = sdmmc_write_sectors(s_cards[pdrv], s_cache_slot_data(cache, slot), cache->slots[slot].sector, 1);
+    if (unlikely(err != ESP_OK)) {
+        ESP_LOGE(TAG, "flushing cached sector %"PRIu32" failed (0x%x)", (uint32_t)cache->slots[slot].sector, err);
+        return RES_ERROR;
+    }
+    cache->slots[slot].dirty = false;
+    return RES_OK;
+}
+
+//Pick a free slot, or flush and reclaim the least recently used one
+static int s_cache_evict(BYTE pdrv, sector_cache_t* cache)
+{
+    int victim = 0;
+    for (int i = 0; i < SECTOR_CACHE_SIZE; i++) {
+        if (!cache->slots[i].valid) {
+            return i;
+        }
+        if (cache->slots[i].stamp < cache->slots[victim].stamp) {
+            victim = i;
+        }
+    }
+    if (s_cache_flush_slot(pdrv, cache, victim) != RES_OK) {
+        return -1;
+    }
+    cache->slots[victim].valid = false;
+    return victim;
+}
+
+static DRESULT s_cache_read_one(BYTE pdrv, sector_cache_t* cache, BYTE* buff, DWORD sector)
+{
+    sdmmc_card_t* card = s_cards[pdrv];
+    int slot = s_cache_find(cache, sector);
+    if (slot >= 0) {
+        memcpy(buff, s_cache_slot_data(cache, slot), cache->sector_size);
+        cache->slots[slot].stamp = ++cache->stamp;
+        cache->next_sector = sector + 1;
+        return RES_OK;
+    }
+    /* On a miss, read a burst of sectors when the pattern looks sequential, otherwise a single one */
+    UINT burst = 1;
+    if (SECTOR_CACHE_READAHEAD > 0 && sector == cache->next_sector &&
+            sector + 1 + SECTOR_CACHE_READAHEAD <= card->csd.capacity) {
+        burst += SECTOR_CACHE_READAHEAD;
+    }
+    esp_err_t err = sdmmc_read_sectors(card, cache->burst_buf, sector, burst);
+    if (unlikely(err != ESP_OK)) {
+        ESP_LOGE(TAG, "sdmmc_read_blocks failed (0x%x)", err);
+        return RES_ERROR;
+    }
+    /* Populate the cache, skip the sectors that are already cached as they may hold dirty data */
+    for (UINT i = 0; i < burst; i++) {
+        if (s_cache_find(cache, sector + i) >= 0) {
+            continue;
+        }
+        slot = s_cache_evict(pdrv, cache);
+        if (slot < 0) {
+            return RES_ERROR;
+        }
+        cache->slots[slot].sector = sector + i;
+        cache->slots[slot].valid = true;
+        cache->slots[slot].dirty = false;
+        cache->slots[slot].stamp = ++cache->stamp;
+        memcpy(s_cache_slot_data(cache, slot), cache->burst_buf + i * cache->sector_size, cache->sector_size);
+    }
+    memcpy(buff, cache->burst_buf, cache->sector_size);
+    cache->next_sector = sector + 1;
+    return RES_OK;
+}
+
+static DRESULT s_cache_write_one(BYTE pdrv, sector_cache_t* cache, const BYTE* buff, DWORD sector)
+{
+    int slot = s_cache_find(cache, sector);
+    if (slot < 0) {
+        slot = s_cache_evict(pdrv, cache);
+        if (slot < 0) {
+            return RES_ERROR;
+        }
+        cache->slots[slot].sector = sector;
+        cache->slots[slot].valid = true;
+    }
+    /* Write-back: keep the new data in the cache only, the card is updated on eviction or sync */
+    memcpy(s_cache_slot_data(cache, slot), buff, cache->sector_size);
+    cache->slots[slot].dirty = true;
+    cache->slots[slot].stamp = ++cache->stamp;
+    return RES_OK;
+}
+
+static DRESULT s_cache_flush_all(BYTE pdrv, sector_cache_t* cache)
+{
+    DRESULT res = RES_OK;
+    for (int i = 0; i < SECTOR_CACHE_SIZE; i++) {
+        if (s_cache_flush_slot(pdrv, cache, i) != RES_OK) {
+            res = RES_ERROR;
+        }
+    }
+    return res;
+}
+
+static void s_cache_free(BYTE pdrv)
+{
+    sector_cache_t* cache = s_sector_cache[pdrv];
+    if (cache) {
+        free(cache->data);
+        free(cache->burst_buf);
+        free(cache);
+        s_sector_cache[pdrv] = NULL;
+    }
+}
+
+static void s_cache_init(BYTE pdrv, sdmmc_card_t* card)
+{
+    s_cache_free(pdrv);
+    sector_cache_t* cache = calloc(1, sizeof(sector_cache_t));
+    if (cache) {
+        cache->sector_size = card->csd.sector_size;
+        cache->next_sector = (DWORD) -1;
+        cache->data = malloc(SECTOR_CACHE_SIZE * cache->sector_size);
+        cache->burst_buf = malloc((1 + SECTOR_CACHE_READAHEAD) * cache->sector_size);
+    }
+    if (!cache || !cache->data || !cache->burst_buf) {
+        ESP_LOGW(TAG, "no memory for the sector cache, continue without caching");
+        if (cache) {
+            free(cache->data);
+            free(cache->burst_buf);
+            free(cache);
+        }
+        return;
+    }
+    s_sector_cache[pdrv] = cache;
+}
+#endif // CONFIG_FATFS_SDMMC_SECTOR_CACHE
+
 //Check if SD/MMC card is present
 static DSTATUS ff_sdmmc_card_available(BYTE pdrv)
 {
@@ -51,6 +231,23 @@ DRESULT ff_sdmmc_read (BYTE pdrv, BYTE* buff, DWORD sector, UINT count)
 {
     sdmmc_card_t* card = s_cards[pdrv];
     assert(card);
+#if CONFIG_FATFS_SDMMC_SECTOR_CACHE
+    sector_cache_t* cache = s_sector_cache[pdrv];
+    if (cache) {
+        if (count == 1) {
+            return s_cache_read_one(pdrv, cache, buff, sector);
+        }
+        /* Multi-sector reads go to the card directly, but the card has to hold
+         * the newest data first, so flush the overlapping dirty sectors */
+        for (int i = 0; i < SECTOR_CACHE_SIZE; i++) {
+            if (cache->slots[i].valid && cache->slots[i].sector >= sector && cache->slots[i].sector < sector + count) {
+                if (s_cache_flush_slot(pdrv, cache, i) != RES_OK) {
+                    return RES_ERROR;
+                }
+            }
+        }
+    }
+#endif
     esp_err_t err = sdmmc_read_sectors(card, buff, sector, count);
     if (unlikely(err != ESP_OK)) {
         ESP_LOGE(TAG, "sdmmc_read_blocks failed (0x%x)", err);
@@ -63,11 +260,28 @@ DRESULT ff_sdmmc_write (BYTE pdrv, const BYTE* buff, DWORD sector, UINT count)
 {
     sdmmc_card_t* card = s_cards[pdrv];
     assert(card);
+#if CONFIG_FATFS_SDMMC_SECTOR_CACHE
+    sector_cache_t* cache = s_sector_cache[pdrv];
+    if (cache && count == 1) {
+        return s_cache_write_one(pdrv, cache, buff, sector);
+    }
+#endif
     esp_err_t err = sdmmc_write_sectors(card, buff, sector, count);
     if (unlikely(err != ESP_OK)) {
         ESP_LOGE(TAG, "sdmmc_write_blocks failed (0x%x)", err);
         return RES_ERROR;
     }
+#if CONFIG_FATFS_SDMMC_SECTOR_CACHE
+    if (cache) {
+        /* Refresh the cached copies of the overlapping sectors, the card holds the newest data now */
+        for (int i = 0; i < SECTOR_CACHE_SIZE; i++) {
+            if (cache->slots[i].valid && cache->slots[i].sector >= sector && cache->slots[i].sector < sector + count) {
+                memcpy(s_cache_slot_data(cache, i), buff + (cache->slots[i].sector - sector) * cache->sector_size, cache->sector_size);
+                cache->slots[i].dirty = false;
+            }
+        }
+    }
+#endif
     return RES_OK;
 }
 
@@ -94,6 +308,11 @@ DRESULT ff_sdmmc_ioctl (BYTE pdrv, BYTE cmd, void* buff)
     assert(card);
     switch(cmd) {
         case CTRL_SYNC:
+#if CONFIG_FATFS_SDMMC_SECTOR_CACHE
+            if (s_sector_cache[pdrv]) {
+                return s_cache_flush_all(pdrv, s_sector_cache[pdrv]);
+            }
+#endif
             return RES_OK;
         case GET_SECTOR_COUNT:
             *((DWORD*) buff) = card->csd.capacity;
@@ -131,6 +350,9 @@ void ff_diskio_register_sdmmc(BYTE pdrv, sdmmc_card_t* card)
     };
     s_cards[pdrv] = card;
     s_disk_status_check_en[pdrv] = false;
+#if CONFIG_FATFS_SDMMC_SECTOR_CACHE
+    s_cache_init(pdrv, card);
+#endif
     ff_diskio_register(pdrv, &sdmmc_impl);
 }
 
@@ -3944,6 +3944,37 @@ fail:
 
 
 
+#if FF_USE_CONTIG_IO
+/*-----------------------------------------------------------------------*/
+/* Extend a direct transfer over a physically contiguous cluster run     */
+/*-----------------------------------------------------------------------*/
+
+static UINT clst_contig_sects (	/* Returns number of additional sectors covered by the run */
+	FIL* fp,		/* File object (fp->clust is advanced to the last cluster covered) */
+	UINT max_add	/* Maximum number of additional sectors needed */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	DWORD ncl;
+	UINT add = 0, n;
+
+	while (add < max_add) {
+		ncl = get_fat(&fp->obj, fp->clust);			/* Peek at the next cluster in the chain */
+		if (ncl < 2 || ncl >= fs->n_fatent) break;	/* End of chain or broken chain */
+		if (ncl != fp->clust + 1) break;			/* Chain is fragmented here */
+		fp->clust = ncl;							/* The transfer covers this cluster too */
+		n = fs->csize;
+		if (n > max_add - add) n = max_add - add;	/* The run may end in the middle of this cluster */
+		add += n;
+	}
+	return add;
+}
+
+#endif	/* FF_USE_CONTIG_IO */
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Read File                                                             */
 /*-----------------------------------------------------------------------*/
@@ -3998,6 +4029,9 @@ FRESULT f_read (
 			if (cc > 0) {						/* Read maximum contiguous sectors directly */
 				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
 					cc = fs->csize - csect;
+#if FF_USE_CONTIG_IO
+					cc += clst_contig_sects(fp, btr / SS(fs) - cc);	/* Extend over a contiguous cluster run */
+#endif
 				}
 				if (disk_read(fs->pdrv, rbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
 #if !FF_FS_READONLY && FF_FS_MINIMIZE <= 2		/* Replace one of the read sectors with cached data if it contains a dirty sector */
@@ -4113,6 +4147,9 @@ FRESULT f_write (
 			if (cc > 0) {					/* Write maximum contiguous sectors directly */
 				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
 					cc = fs->csize - csect;
+#if FF_USE_CONTIG_IO
+					cc += clst_contig_sects(fp, btw / SS(fs) - cc);	/* Extend over a contiguous cluster run */
+#endif
 				}
 				if (disk_write(fs->pdrv, wbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
 #if FF_FS_MINIMIZE <= 2
@@ -43,6 +43,16 @@
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
 
+#ifdef CONFIG_FATFS_MULTI_CLUSTER_IO
+#define FF_USE_CONTIG_IO	1
+#else
+#define FF_USE_CONTIG_IO	0
+#endif
+/* This option extends direct data transfers in f_read()/f_write() over physically
+/  contiguous cluster runs instead of clipping them at the cluster boundary.
+/  (0:Disable or 1:Enable) */
+
+
 #define FF_USE_EXPAND	1
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
@@ -18,6 +18,9 @@
 #include "esp_freertos_hooks.h"
 #include "esp_heap_caps_init.h"
 #include "esp_chip_info.h"
+#if CONFIG_ESP_SYSTEM_BOOT_TIMELINE
+#include "esp_boot_timeline.h"
+#endif
 #if CONFIG_SPIRAM
 /* Required by esp_psram_extram_reserve_dma_pool() */
 #include "esp_psram.h"
@@ -199,6 +202,11 @@ static void main_task(void* args)
     ESP_ERROR_CHECK(esp_task_wdt_init(&twdt_config));
 #endif // CONFIG_ESP_TASK_WDT
 
+#if CONFIG_ESP_SYSTEM_BOOT_TIMELINE
+    esp_boot_timeline_mark("app_main");
+    esp_boot_timeline_print();
+#endif
+
     /*
     Note: Be careful when changing the "Calling app_main()" log below as multiple pytest scripts expect this log as a
     start-of-application marker.
@@ -262,6 +262,47 @@
             #define traceQUEUE_SEMAPHORE_RECEIVE( pxQueue )
         #endif
     #endif /* CONFIG_FREERTOS_SMP */
+
+    #if CONFIG_FREERTOS_TASK_RUNTIME_HISTOGRAMS
+
+/* Hooks of the per-task run time and scheduling latency histogram collector
+ * (esp_additions/task_runtime_stats.c). Only installed when the macros are
+ * still free, i.e. not claimed by SystemView above. */
+        #include "esp_private/freertos_task_runtime_stats.h"
+
+        #ifndef traceMOVED_TASK_TO_READY_STATE
+            #define traceMOVED_TASK_TO_READY_STATE( pxTCB )    vTaskRuntimeStatsTaskReady( ( void * ) ( pxTCB ) )
+        #endif
+        #ifndef traceTASK_SWITCHED_IN
+            #define traceTASK_SWITCHED_IN()                    vTaskRuntimeStatsSwitchedIn()
+        #endif
+        #ifndef traceTASK_SWITCHED_OUT
+            #define traceTASK_SWITCHED_OUT()                   vTaskRuntimeStatsSwitchedOut()
+        #endif
+        #ifndef traceTASK_DELETE
+            #define traceTASK_DELETE( pxTCB )                  vTaskRuntimeStatsTaskDeleted( ( void * ) ( pxTCB ) )
+        #endif
+    #endif /* CONFIG_FREERTOS_TASK_RUNTIME_HISTOGRAMS */
+
+    #if CONFIG_APPTRACE_FLIGHT_RECORDER_ENABLE
+
+/* Hooks of the flight recorder (app_trace/flight_recorder.c). Only installed
+ * when the macros are still free, i.e. not claimed above. */
+        #include "esp_flight_recorder.h"
+
+        #ifndef traceTASK_SWITCHED_IN
+            #define traceTASK_SWITCHED_IN()     esp_flight_rec_task_switched_in()
+        #endif
+        #ifndef traceTASK_SWITCHED_OUT
+            #define traceTASK_SWITCHED_OUT()    esp_flight_rec_task_switched_out()
+        #endif
+        #ifndef traceISR_ENTER
+            #define traceISR_ENTER( _n_ )       esp_flight_rec_isr_enter( _n_ )
+        #endif
+        #ifndef traceISR_EXIT
+            #define traceISR_EXIT()             esp_flight_rec_isr_exit()
+        #endif
+    #endif /* CONFIG_APPTRACE_FLIGHT_RECORDER_ENABLE */
 #endif /* def __ASSEMBLER__ */
 
 #if CONFIG_FREERTOS_USE_APPLICATION_TASK_TAG
@@ -0,0 +1,211 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/esp_event_mux.h"
+#include "esp_heap_caps.h"
+
+/* Batching front end for queue sets, see esp_event_mux.h.
+ *
+ * The queue set remains the blocking primitive: it is the only kernel
+ * mechanism that parks a task on multiple queues with existing, unmodified
+ * senders. What the multiplexer removes is the per-item call pattern on the
+ * receive side - only the first select of a batch blocks, the rest of the
+ * drain runs with a zero timeout until the set is empty or the caller's
+ * descriptor array is full.
+ */
+
+#if ( configUSE_QUEUE_SETS == 1 )
+
+typedef struct {
+    QueueSetMemberHandle_t handle;
+    esp_event_mux_member_type_t type;
+    size_t item_size;
+    void *user_ctx;
+} esp_event_mux_member_t;
+
+struct esp_event_mux {
+    QueueSetHandle_t set;
+    portMUX_TYPE lock;          // guards the member table against add/remove
+    size_t max_members;
+    size_t num_members;
+    size_t max_item_size;
+    uint8_t *arena;             // event_capacity slots of max_item_size bytes
+    size_t arena_slots;
+    esp_event_mux_member_t members[];
+};
+
+esp_err_t esp_event_mux_create(size_t max_members, size_t event_capacity,
+                               size_t max_item_size, esp_event_mux_handle_t *out_mux)
+{
+    if (out_mux == NULL || max_members == 0 || event_capacity == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct esp_event_mux *mux = heap_caps_calloc(1, sizeof(struct esp_event_mux) +
+                                                 max_members * sizeof(esp_event_mux_member_t),
+                                                 MALLOC_CAP_DEFAULT);
+    if (mux == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (max_item_size > 0) {
+        mux->arena = heap_caps_malloc(event_capacity * max_item_size, MALLOC_CAP_DEFAULT);
+        if (mux->arena == NULL) {
+            free(mux);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    mux->set = xQueueCreateSet(event_capacity);
+    if (mux->set == NULL) {
+        free(mux->arena);
+        free(mux);
+        return ESP_ERR_NO_MEM;
+    }
+    portMUX_INITIALIZE(&mux->lock);
+    mux->max_members = max_members;
+    mux->max_item_size = max_item_size;
+    mux->arena_slots = event_capacity;
+    *out_mux = mux;
+    return ESP_OK;
+}
+
+esp_err_t esp_event_mux_delete(esp_event_mux_handle_t mux)
+{
+    if (mux == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (mux->num_members != 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    vQueueDelete(mux->set);
+    free(mux->arena);
+    free(mux);
+    return ESP_OK;
+}
+
+static esp_event_mux_member_t *event_mux_find_member(esp_event_mux_handle_t mux,
+                                                     QueueSetMemberHandle_t member)
+{
+    for (size_t i = 0; i < mux->num_members; i++) {
+        if (mux->members[i].handle == member) {
+            return &mux->members[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t esp_event_mux_add(esp_event_mux_handle_t mux, QueueSetMemberHandle_t member,
+                            esp_event_mux_member_type_t type, size_t item_size, void *user_ctx)
+{
+    if (mux == NULL || member == NULL || item_size > mux->max_item_size ||
+            (type != ESP_EVENT_MUX_QUEUE && item_size != 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&mux->lock);
+    if (mux->num_members == mux->max_members) {
+        portEXIT_CRITICAL(&mux->lock);
+        return ESP_ERR_NO_MEM;
+    }
+    if (event_mux_find_member(mux, member) != NULL) {
+        portEXIT_CRITICAL(&mux->lock);
+        return ESP_ERR_INVALID_ARG;
+    }
+    mux->members[mux->num_members] = (esp_event_mux_member_t) {
+        .handle = member,
+        .type = type,
+        .item_size = item_size,
+        .user_ctx = user_ctx,
+    };
+    mux->num_members++;
+    portEXIT_CRITICAL(&mux->lock);
+
+    if (xQueueAddToSet(member, mux->set) != pdPASS) {
+        portENTER_CRITICAL(&mux->lock);
+        mux->num_members--;
+        mux->members[mux->num_members] = (esp_event_mux_member_t) { 0 };
+        portEXIT_CRITICAL(&mux->lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_event_mux_remove(esp_event_mux_handle_t mux, QueueSetMemberHandle_t member)
+{
+    if (mux == NULL || member == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (xQueueRemoveFromSet(member, mux->set) != pdPASS) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    portENTER_CRITICAL(&mux->lock);
+    esp_event_mux_member_t *found = event_mux_find_member(mux, member);
+    if (found == NULL) {
+        portEXIT_CRITICAL(&mux->lock);
+        return ESP_ERR_NOT_FOUND;
+    }
+    // compact the table so lookups stay a dense scan
+    *found = mux->members[mux->num_members - 1];
+    mux->members[mux->num_members - 1] = (esp_event_mux_member_t) { 0 };
+    mux->num_members--;
+    portEXIT_CRITICAL(&mux->lock);
+    return ESP_OK;
+}
+
+size_t esp_event_mux_wait(esp_event_mux_handle_t mux, esp_event_mux_event_t *events,
+                          size_t max_events, TickType_t ticks_to_wait)
+{
+    if (mux == NULL || events == NULL || max_events == 0) {
+        return 0;
+    }
+    size_t num_events = 0;
+    TickType_t timeout = ticks_to_wait;
+
+    while (num_events < max_events) {
+        QueueSetMemberHandle_t member = xQueueSelectFromSet(mux->set, timeout);
+        if (member == NULL) {
+            break;
+        }
+        timeout = 0; // only the first select of a batch may block
+
+        portENTER_CRITICAL(&mux->lock);
+        esp_event_mux_member_t info = { .handle = member };
+        esp_event_mux_member_t *found = event_mux_find_member(mux, member);
+        if (found != NULL) {
+            info = *found;
+        } else {
+            info.type = ESP_EVENT_MUX_HANDLE_ONLY; // e.g. a ring buffer attached directly to the set
+        }
+        portEXIT_CRITICAL(&mux->lock);
+
+        esp_event_mux_event_t *event = &events[num_events];
+        event->member = member;
+        event->user_ctx = info.user_ctx;
+        event->item = NULL;
+        if (info.type == ESP_EVENT_MUX_QUEUE) {
+            void *item = mux->arena + (num_events % mux->arena_slots) * mux->max_item_size;
+            if (xQueueReceive(member, item, 0) != pdPASS) {
+                continue; // raced with another consumer of the member, drop the event
+            }
+            event->item = item;
+        } else if (info.type == ESP_EVENT_MUX_SEMAPHORE) {
+            if (xSemaphoreTake(member, 0) != pdPASS) {
+                continue;
+            }
+        }
+        num_events++;
+    }
+    return num_events;
+}
+
+QueueSetHandle_t esp_event_mux_get_queue_set(esp_event_mux_handle_t mux)
+{
+    return (mux != NULL) ? mux->set : NULL;
+}
+
+#endif // configUSE_QUEUE_SETS == 1
@@ -1097,6 +1097,17 @@ void * pvTaskGetCurrentTCBForCore( BaseType_t xCoreID )
     #endif /* CONFIG_FREERTOS_SMP */
     return pvRet;
 }
+/*----------------------------------------------------------*/
+
+BaseType_t xTaskEqualPriorityTaskReady( void )
+{
+    /* The running task stays on its ready list, so another task of the same
+     * priority is ready when the list holds more than one item. The length is
+     * a single word, hence the unlocked read returns a consistent snapshot;
+     * the result is inherently stale by the time the caller acts on it, which
+     * is acceptable for a yield heuristic. */
+    return ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTaskPriorityGet( NULL ) ] ) ) > ( UBaseType_t ) 1 ) ? pdTRUE : pdFALSE;
+}
 
 /* ----------------------------------------------------- OpenOCD ---------------------------------------------------- */
 
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if CONFIG_FREERTOS_TASK_RUNTIME_HISTOGRAMS || __DOXYGEN__
+
+/**
+ * Number of buckets in the run time and scheduling latency histograms.
+ *
+ * The buckets are logarithmic in microseconds: bucket 0 counts events shorter
+ * than 1 us, bucket b (b > 0) counts events in [2^(b-1), 2^b) us, and the last
+ * bucket is open ended (everything of 16 ms and above).
+ */
+#define ESP_FREERTOS_STATS_HIST_BUCKETS    16
+
+/**
+ * @brief Run time and scheduling latency statistics of one task
+ */
+typedef struct {
+    TaskHandle_t task;          /*!< Task the statistics belong to. May refer to an already
+                                     deleted task if the task died since the last reset */
+    uint32_t run_hist[ESP_FREERTOS_STATS_HIST_BUCKETS];     /*!< Histogram of uninterrupted run slice durations */
+    uint32_t latency_hist[ESP_FREERTOS_STATS_HIST_BUCKETS]; /*!< Histogram of ready-to-running scheduling latencies */
+    uint32_t run_count;         /*!< Total number of run slices recorded */
+    uint32_t latency_count;     /*!< Total number of scheduling latencies recorded */
+    uint32_t max_run_us;        /*!< Longest recorded run slice, in microseconds */
+    uint32_t max_latency_us;    /*!< Longest recorded scheduling latency, in microseconds */
+} esp_freertos_task_stats_t;
+
+/**
+ * @brief Retrieve the per-task histograms collected so far
+ *
+ * Collection runs from the context switch trace hooks and is not stopped while
+ * the snapshot is taken, so counters of tasks running on the other core may be
+ * off by the events of the current switch.
+ *
+ * @param[out] stats        Array to fill with per-task statistics
+ * @param[in]  max_tasks    Capacity of the stats array
+ * @param[out] dropped      If non-NULL, set to the number of events dropped
+ *                          because the task table was full
+ *
+ * @return Number of entries filled in
+ */
+size_t esp_freertos_stats_get(esp_freertos_task_stats_t *stats, size_t max_tasks, uint32_t *dropped);
+
+/**
+ * @brief Reset all collected histograms and forget dead tasks
+ *
+ * Slots of deleted tasks are reclaimed when the task is deleted; calling this
+ * periodically is only needed to bound the effect of counter wrap around on
+ * very long uptimes.
+ */
+void esp_freertos_stats_reset(void);
+
+/**
+ * @brief Get the lower bound of a histogram bucket in microseconds
+ *
+ * @param[in] bucket    Bucket index, 0 .. ESP_FREERTOS_STATS_HIST_BUCKETS - 1
+ *
+ * @return Smallest duration counted by this bucket, in microseconds
+ */
+static inline uint32_t esp_freertos_stats_bucket_lower_us(int bucket)
+{
+    return (bucket == 0) ? 0 : (1UL << (bucket - 1));
+}
+
+#endif // CONFIG_FREERTOS_TASK_RUNTIME_HISTOGRAMS || __DOXYGEN__
+
+#ifdef __cplusplus
+}
+#endif
@@ -107,6 +107,18 @@ UBaseType_t uxTaskGetSnapshotAll( TaskSnapshot_t * const pxTaskSnapshotArray,
  */
 void * pvTaskGetCurrentTCBForCore( BaseType_t xCoreID );
 
+/**
+ * @brief Check whether another task of the current task's priority is ready to run
+ *
+ * Lets a CPU-bound task decide whether yielding would actually hand the core to
+ * someone (a time-slice peer) or merely bounce through the scheduler.
+ *
+ * @note The result is a snapshot and may be stale by the time the caller acts
+ * on it; use it as a heuristic only. Must be called from task context.
+ * @return pdTRUE if at least one other ready task shares the caller's priority
+ */
+BaseType_t xTaskEqualPriorityTaskReady( void );
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
@@ -0,0 +1,29 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Trace hook entry points of the task runtime histogram collector
+ * (task_runtime_stats.c). These are installed through the traceTASK_SWITCHED_IN,
+ * traceTASK_SWITCHED_OUT, traceMOVED_TASK_TO_READY_STATE and traceTASK_DELETE
+ * macros in FreeRTOSConfig.h when CONFIG_FREERTOS_TASK_RUNTIME_HISTOGRAMS is
+ * enabled, and are not meant to be called from anywhere else. The TCB argument
+ * is taken as void * as the hooks are expanded inside tasks.c where the TCB
+ * type is private.
+ */
+void vTaskRuntimeStatsTaskReady(void *pxTCB);
+void vTaskRuntimeStatsSwitchedIn(void);
+void vTaskRuntimeStatsSwitchedOut(void);
+void vTaskRuntimeStatsTaskDeleted(void *pxTCB);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Event multiplexer: a batching front end for FreeRTOS queue sets.
+ *
+ * A task waiting on a plain queue set makes two kernel calls per message:
+ * xQueueSelectFromSet() to learn which member is ready, then a receive call
+ * on that member. The multiplexer blocks once and drains every ready member
+ * into an array of event descriptors, so a task serving several queues and
+ * semaphores pays one blocking call per batch instead of two calls per item.
+ */
+
+/**
+ * @brief Opaque event multiplexer handle
+ */
+typedef struct esp_event_mux *esp_event_mux_handle_t;
+
+/**
+ * @brief Type of a registered multiplexer member
+ */
+typedef enum {
+    ESP_EVENT_MUX_QUEUE,        /*!< Queue: the item is received into the event descriptor */
+    ESP_EVENT_MUX_SEMAPHORE,    /*!< Binary or counting semaphore: taken when reported */
+    ESP_EVENT_MUX_HANDLE_ONLY,  /*!< Readiness is reported, the member is not consumed.
+                                     Use for members the caller drains itself, e.g. ring
+                                     buffers added with xRingbufferAddToQueueSet(). */
+} esp_event_mux_member_type_t;
+
+/**
+ * @brief One ready event returned by esp_event_mux_wait()
+ */
+typedef struct {
+    QueueSetMemberHandle_t member;  /*!< Handle registered with esp_event_mux_add() */
+    void *user_ctx;                 /*!< Context given at registration */
+    void *item;                     /*!< For ESP_EVENT_MUX_QUEUE members: the received item,
+                                         valid until the next esp_event_mux_wait() call.
+                                         NULL for other member types. */
+} esp_event_mux_event_t;
+
+/**
+ * @brief Create an event multiplexer
+ *
+ * @param max_members    maximum number of members that can be registered
+ * @param event_capacity capacity of the underlying queue set; must be at least
+ *                       the sum of the lengths of all member queues plus the
+ *                       maximum counts of all member semaphores
+ * @param max_item_size  largest item size among the queue members, in bytes
+ *                       (0 if only semaphores are registered)
+ * @param[out] out_mux   created multiplexer
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if out_mux is NULL or a size is 0
+ *      - ESP_ERR_NO_MEM if out of memory
+ */
+esp_err_t esp_event_mux_create(size_t max_members, size_t event_capacity,
+                               size_t max_item_size, esp_event_mux_handle_t *out_mux);
+
+/**
+ * @brief Delete an event multiplexer
+ *
+ * All members must have been removed first, mirroring the queue set rule that
+ * members may only be deleted while not part of a set.
+ *
+ * @param mux multiplexer to delete
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if members are still registered
+ */
+esp_err_t esp_event_mux_delete(esp_event_mux_handle_t mux);
+
+/**
+ * @brief Register a queue or semaphore with the multiplexer
+ *
+ * The member must be empty (queue) or unavailable (semaphore) when added,
+ * as required by xQueueAddToSet().
+ *
+ * @param mux       multiplexer
+ * @param member    queue or semaphore handle
+ * @param type      how the member is consumed when it becomes ready
+ * @param item_size item size of the queue, in bytes; must not exceed the
+ *                  max_item_size the multiplexer was created with. 0 for
+ *                  semaphore and handle-only members.
+ * @param user_ctx  arbitrary pointer returned in the event descriptor
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG on invalid handle or item_size
+ *      - ESP_ERR_NO_MEM if max_members are already registered
+ *      - ESP_ERR_INVALID_STATE if the member could not be added to the set
+ */
+esp_err_t esp_event_mux_add(esp_event_mux_handle_t mux, QueueSetMemberHandle_t member,
+                            esp_event_mux_member_type_t type, size_t item_size, void *user_ctx);
+
+/**
+ * @brief Remove a previously registered member
+ *
+ * The member must be empty/unavailable, as required by xQueueRemoveFromSet().
+ *
+ * @param mux    multiplexer
+ * @param member handle passed to esp_event_mux_add()
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_NOT_FOUND if the member is not registered
+ *      - ESP_ERR_INVALID_STATE if the member could not be removed from the set
+ */
+esp_err_t esp_event_mux_remove(esp_event_mux_handle_t mux, QueueSetMemberHandle_t member);
+
+/**
+ * @brief Wait for members to become ready and drain them as a batch
+ *
+ * Blocks for at most ticks_to_wait until at least one member is ready, then
+ * collects ready members without blocking until either max_events descriptors
+ * are filled or no member is ready anymore. Queue members have their item
+ * copied into the descriptor, semaphore members are taken.
+ *
+ * @param mux           multiplexer
+ * @param[out] events   array of max_events descriptors to fill
+ * @param max_events    size of the events array
+ * @param ticks_to_wait ticks to wait for the first event
+ * @return number of descriptors filled, 0 on timeout
+ */
+size_t esp_event_mux_wait(esp_event_mux_handle_t mux, esp_event_mux_event_t *events,
+                          size_t max_events, TickType_t ticks_to_wait);
+
+/**
+ * @brief Get the underlying queue set of the multiplexer
+ *
+ * Intended for attaching members that only expose an add-to-set call of their
+ * own, such as xRingbufferAddToQueueSet(). Members the multiplexer does not
+ * know are reported like ESP_EVENT_MUX_HANDLE_ONLY members with a NULL
+ * user_ctx; for ring buffers, match the handle with xRingbufferCanRead().
+ *
+ * @param mux multiplexer
+ * @return queue set handle, NULL if mux is NULL
+ */
+QueueSetHandle_t esp_event_mux_get_queue_set(esp_event_mux_handle_t mux);
+
+#ifdef __cplusplus
+}
+#endif
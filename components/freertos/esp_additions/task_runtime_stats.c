@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "esp_freertos_stats.h"
+#include "esp_private/freertos_task_runtime_stats.h"
+
+/* Per-task run time and scheduling latency histograms, fed by the context
+ * switch trace hooks (see esp_freertos_stats.h for the public API).
+ *
+ * Run slices are timed with the CPU cycle counter: a slice starts and ends on
+ * the same core, so the per-core counters never get mixed. Scheduling latency
+ * (ready to running) can span cores, where cycle counters are not comparable,
+ * so it is timed with esp_timer_get_time() instead; its microsecond resolution
+ * matches the histogram granularity.
+ *
+ * Tasks are mapped to table slots by hashing the TCB pointer with a small
+ * probe sequence. Slot contents are only written by the core currently
+ * switching that task in or out, so no lock is taken on the hook fast path;
+ * the spinlock only guards slot allocation and reclamation.
+ */
+
+#define STATS_MAX_TASKS    CONFIG_FREERTOS_TASK_RUNTIME_HISTOGRAMS_MAX_TASKS
+#define STATS_MAX_PROBES   4
+
+typedef struct {
+    void *task;                 // TCB pointer, NULL when the slot is free
+    uint32_t ready_ts_us;       // Timestamp of the last transition to ready
+    volatile bool ready_valid;  // ready_ts_us holds a pending latency start
+    uint32_t in_ccount;         // Cycle count at the last switch in
+    bool in_valid;              // in_ccount holds a pending run slice start
+    uint32_t run_hist[ESP_FREERTOS_STATS_HIST_BUCKETS];
+    uint32_t latency_hist[ESP_FREERTOS_STATS_HIST_BUCKETS];
+    uint32_t run_count;
+    uint32_t latency_count;
+    uint32_t max_run_us;
+    uint32_t max_latency_us;
+} task_stats_slot_t;
+
+static task_stats_slot_t s_slots[STATS_MAX_TASKS];
+static uint32_t s_dropped_events;
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static inline size_t stats_hash(void *task)
+{
+    return (((uintptr_t)task >> 4) * 2654435761UL) % STATS_MAX_TASKS;
+}
+
+//Find the slot of a task, NULL if it has none
+static task_stats_slot_t *stats_find_slot(void *task)
+{
+    size_t idx = stats_hash(task);
+    for (int probe = 0; probe < STATS_MAX_PROBES; probe++) {
+        task_stats_slot_t *slot = &s_slots[(idx + probe) % STATS_MAX_TASKS];
+        if (slot->task == task) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+//Find or allocate the slot of a task, NULL when the probe window is occupied
+static task_stats_slot_t *stats_get_slot(void *task)
+{
+    task_stats_slot_t *slot = stats_find_slot(task);
+    if (slot != NULL) {
+        return slot;
+    }
+    //Allocation mutates the table and can race with the other core, take the lock
+    portENTER_CRITICAL_SAFE(&s_stats_lock);
+    size_t idx = stats_hash(task);
+    for (int probe = 0; probe < STATS_MAX_PROBES; probe++) {
+        task_stats_slot_t *candidate = &s_slots[(idx + probe) % STATS_MAX_TASKS];
+        if (candidate->task == task) {
+            slot = candidate;
+            break;
+        }
+        if (candidate->task == NULL) {
+            memset(candidate, 0, sizeof(*candidate));
+            candidate->task = task;
+            slot = candidate;
+            break;
+        }
+    }
+    if (slot == NULL) {
+        s_dropped_events++;
+    }
+    portEXIT_CRITICAL_SAFE(&s_stats_lock);
+    return slot;
+}
+
+static inline void stats_hist_add(uint32_t *hist, uint32_t duration_us)
+{
+    int bucket = (duration_us == 0) ? 0 : (32 - __builtin_clz(duration_us));
+    if (bucket >= ESP_FREERTOS_STATS_HIST_BUCKETS) {
+        bucket = ESP_FREERTOS_STATS_HIST_BUCKETS - 1;
+    }
+    hist[bucket]++;
+}
+
+void vTaskRuntimeStatsTaskReady(void *pxTCB)
+{
+    task_stats_slot_t *slot = stats_get_slot(pxTCB);
+    if (slot != NULL) {
+        slot->ready_ts_us = (uint32_t)esp_timer_get_time();
+        slot->ready_valid = true;
+    }
+}
+
+void vTaskRuntimeStatsSwitchedIn(void)
+{
+    task_stats_slot_t *slot = stats_get_slot((void *)xTaskGetCurrentTaskHandle());
+    if (slot == NULL) {
+        return;
+    }
+    if (slot->ready_valid) {
+        //Unsigned subtraction handles the 32-bit timestamp wrapping around
+        uint32_t latency_us = (uint32_t)esp_timer_get_time() - slot->ready_ts_us;
+        slot->ready_valid = false;
+        stats_hist_add(slot->latency_hist, latency_us);
+        slot->latency_count++;
+        if (latency_us > slot->max_latency_us) {
+            slot->max_latency_us = latency_us;
+        }
+    }
+    slot->in_ccount = esp_cpu_get_cycle_count();
+    slot->in_valid = true;
+}
+
+void vTaskRuntimeStatsSwitchedOut(void)
+{
+    task_stats_slot_t *slot = stats_find_slot((void *)xTaskGetCurrentTaskHandle());
+    if (slot == NULL || !slot->in_valid) {
+        return;
+    }
+    slot->in_valid = false;
+    uint32_t run_us = (esp_cpu_get_cycle_count() - slot->in_ccount) / esp_rom_get_cpu_ticks_per_us();
+    stats_hist_add(slot->run_hist, run_us);
+    slot->run_count++;
+    if (run_us > slot->max_run_us) {
+        slot->max_run_us = run_us;
+    }
+}
+
+void vTaskRuntimeStatsTaskDeleted(void *pxTCB)
+{
+    portENTER_CRITICAL_SAFE(&s_stats_lock);
+    task_stats_slot_t *slot = stats_find_slot(pxTCB);
+    if (slot != NULL) {
+        slot->task = NULL;
+    }
+    portEXIT_CRITICAL_SAFE(&s_stats_lock);
+}
+
+size_t esp_freertos_stats_get(esp_freertos_task_stats_t *stats, size_t max_tasks, uint32_t *dropped)
+{
+    size_t count = 0;
+
+    if (stats == NULL) {
+        return 0;
+    }
+    portENTER_CRITICAL(&s_stats_lock);
+    for (int i = 0; i < STATS_MAX_TASKS && count < max_tasks; i++) {
+        task_stats_slot_t *slot = &s_slots[i];
+        if (slot->task == NULL) {
+            continue;
+        }
+        stats[count].task = (TaskHandle_t)slot->task;
+        memcpy(stats[count].run_hist, slot->run_hist, sizeof(slot->run_hist));
+        memcpy(stats[count].latency_hist, slot->latency_hist, sizeof(slot->latency_hist));
+        stats[count].run_count = slot->run_count;
+        stats[count].latency_count = slot->latency_count;
+        stats[count].max_run_us = slot->max_run_us;
+        stats[count].max_latency_us = slot->max_latency_us;
+        count++;
+    }
+    if (dropped != NULL) {
+        *dropped = s_dropped_events;
+    }
+    portEXIT_CRITICAL(&s_stats_lock);
+    return count;
+}
+
+void esp_freertos_stats_reset(void)
+{
+    portENTER_CRITICAL(&s_stats_lock);
+    memset(s_slots, 0, sizeof(s_slots));
+    s_dropped_events = 0;
+    portEXIT_CRITICAL(&s_stats_lock);
+}
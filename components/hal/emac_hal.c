@@ -138,8 +138,14 @@ void emac_hal_init_dma_default(emac_hal_context_t *hal, emac_hal_dma_config_t *h
 #endif
     /* Enable Flushing of Received Frames because of the unavailability of receive descriptors or buffers */
     emac_ll_flush_recv_frame_enable(hal->dma_regs, true);
+#if CONFIG_ETH_EMAC_CHECKSUM_OFFLOAD
+    /* Enable Transmit Store Forward: checksum insertion needs the full frame
+       in the Tx FIFO before transmission starts */
+    emac_ll_trans_store_forward_enable(hal->dma_regs, true);
+#else
     /* Disable Transmit Store Forward */
     emac_ll_trans_store_forward_enable(hal->dma_regs, false);
+#endif
     /* Flush Transmit FIFO */
     emac_hal_flush_trans_fifo(hal);
     /* Transmit Threshold Control */
@@ -23,11 +23,32 @@
 #include "hal/sar_ctrl_ll.h"
 
 #include "soc/regi2c_saradc.h"
+#include "soc/soc_etm_source.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*---------------------------------------------------------------
+                    ETM
+---------------------------------------------------------------*/
+#define ADC_LL_ETM_EVENT_TABLE(event)                     \
+    (uint32_t [ADC_ETM_EVENT_MAX]){                       \
+        [ADC_ETM_EVENT_CONV_DONE] = ADC_EVT_CONV_CMPLT0,  \
+    }[event]
+
+#define ADC_LL_ETM_TASK_TABLE(unit, task)                 \
+    (uint32_t [2][ADC_ETM_TASK_MAX]){                     \
+        {                                                 \
+            [ADC_ETM_TASK_START] = ADC_TASK_START0,       \
+            [ADC_ETM_TASK_STOP] = ADC_TASK_STOP0,         \
+            [ADC_ETM_TASK_SAMPLE] = ADC_TASK_SAMPLE0,     \
+        },                                                \
+        {                                                 \
+            [ADC_ETM_TASK_SAMPLE] = ADC_TASK_SAMPLE1,     \
+        },                                                \
+    }[unit][task]
+
 #define ADC_LL_EVENT_ADC1_ONESHOT_DONE    BIT(31)
 #define ADC_LL_EVENT_ADC2_ONESHOT_DONE    BIT(30)
 
@@ -413,6 +413,29 @@ static inline void gpio_ll_set_level(gpio_dev_t *hw, uint32_t gpio_num, uint32_t
     }
 }
 
+/**
+ * @brief  GPIO set and clear output levels with a bit mask
+ *
+ * Each 32-bit bank is updated with a single register write, so all pins in
+ * the same bank change level on the same clock edge.
+ *
+ * @param  hw Peripheral GPIO hardware instance address.
+ * @param  set_mask Bit mask of GPIOs to drive to high level
+ * @param  clear_mask Bit mask of GPIOs to drive to low level
+ */
+__attribute__((always_inline))
+static inline void gpio_ll_set_level_mask(gpio_dev_t *hw, uint64_t set_mask, uint64_t clear_mask)
+{
+    hw->out_w1ts.out_w1ts = (uint32_t)set_mask;
+    hw->out_w1tc.out_w1tc = (uint32_t)clear_mask;
+    if (set_mask >> 32) {
+        hw->out1_w1ts.out1_w1ts = (uint32_t)(set_mask >> 32);
+    }
+    if (clear_mask >> 32) {
+        hw->out1_w1tc.out1_w1tc = (uint32_t)(clear_mask >> 32);
+    }
+}
+
 /**
  * @brief  GPIO get input level
  *
@@ -631,6 +631,19 @@ static inline void sdmmc_ll_init_dma(sdmmc_dev_t *hw)
     hw->idinten.ti = 1;
 }
 
+/**
+ * @brief Enable or disable the IDMAC transfer completion interrupts
+ *
+ * @param hw    hardware instance address
+ * @param en    enable / disable
+ */
+static inline void sdmmc_ll_enable_idmac_transfer_interrupt(sdmmc_dev_t *hw, bool en)
+{
+    hw->idinten.ni = en;
+    hw->idinten.ri = en;
+    hw->idinten.ti = en;
+}
+
 /**
  * @brief Enable DMA
  *
@@ -236,6 +236,24 @@ typedef struct {
 #endif
 
 
+/**
+ * @brief ADC ETM event types
+ */
+typedef enum {
+    ADC_ETM_EVENT_CONV_DONE,    /*!< The ADC digital controller finished one conversion */
+    ADC_ETM_EVENT_MAX,          /*!< Maximum number of ADC ETM events */
+} adc_etm_event_type_t;
+
+/**
+ * @brief ADC ETM task types
+ */
+typedef enum {
+    ADC_ETM_TASK_START,         /*!< Start the ADC digital controller */
+    ADC_ETM_TASK_STOP,          /*!< Stop the ADC digital controller */
+    ADC_ETM_TASK_SAMPLE,        /*!< Trigger one sample on the given ADC unit */
+    ADC_ETM_TASK_MAX,           /*!< Maximum number of ADC ETM tasks */
+} adc_etm_task_type_t;
+
 #if CONFIG_IDF_TARGET_ESP32S2
 /**
  * @brief ADC digital controller (DMA mode) clock system setting.
@@ -278,6 +278,10 @@ void emac_hal_enable_flow_ctrl(emac_hal_context_t *hal, bool enable);
 
 #define emac_hal_get_intr_status(hal) emac_ll_get_intr_status((hal)->dma_regs)
 
+#define emac_hal_enable_corresponding_intr(hal, bits) emac_ll_enable_corresponding_intr((hal)->dma_regs, bits)
+
+#define emac_hal_disable_corresponding_intr(hal, bits) emac_ll_disable_corresponding_intr((hal)->dma_regs, bits)
+
 #define emac_hal_clear_corresponding_intr(hal, bits) emac_ll_clear_corresponding_intr((hal)->dma_regs, bits)
 
 #define emac_hal_clear_all_intr(hal) emac_ll_clear_all_pending_intr((hal)->dma_regs)
@@ -223,6 +223,15 @@ void gpio_hal_intr_disable(gpio_hal_context_t *hal, uint32_t gpio_num);
  */
 #define gpio_hal_set_level(hal, gpio_num, level) gpio_ll_set_level((hal)->dev, gpio_num, level)
 
+/**
+ * @brief  GPIO set and clear output levels with a bit mask
+ *
+ * @param  hal Context of the HAL layer
+ * @param  set_mask Bit mask of GPIOs to drive to high level
+ * @param  clear_mask Bit mask of GPIOs to drive to low level
+ */
+#define gpio_hal_set_level_mask(hal, set_mask, clear_mask) gpio_ll_set_level_mask((hal)->dev, set_mask, clear_mask)
+
 /**
  * @brief  GPIO get input level
  *
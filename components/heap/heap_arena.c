@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include "esp_arena.h"
+#include "esp_heap_caps.h"
+
+/* Alignment of pointers returned by esp_arena_alloc(). Matches the minimum
+   alignment guaranteed by the heap allocator itself. */
+#define ARENA_ALIGNMENT 4
+
+struct esp_arena_t {
+    uint8_t *buffer;        // backing allocation, capacity bytes
+    size_t capacity;
+    size_t used;            // current bump offset, always a multiple of ARENA_ALIGNMENT
+    size_t high_watermark;  // maximum value ever taken by used
+};
+
+esp_arena_t *esp_arena_create(size_t size, uint32_t caps)
+{
+    if (size == 0) {
+        return NULL;
+    }
+
+    /* The control block is always internal so that arena bookkeeping stays
+       fast even when the buffer itself is in external memory. */
+    esp_arena_t *arena = heap_caps_malloc(sizeof(esp_arena_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (arena == NULL) {
+        return NULL;
+    }
+
+    arena->buffer = heap_caps_malloc(size, caps);
+    if (arena->buffer == NULL) {
+        heap_caps_free(arena);
+        return NULL;
+    }
+
+    arena->capacity = size;
+    arena->used = 0;
+    arena->high_watermark = 0;
+    return arena;
+}
+
+void *esp_arena_alloc(esp_arena_t *arena, size_t size)
+{
+    if (arena == NULL || size == 0) {
+        return NULL;
+    }
+
+    size_t aligned_size = (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+    if (aligned_size < size || aligned_size > arena->capacity - arena->used) {
+        return NULL;
+    }
+
+    void *ptr = arena->buffer + arena->used;
+    arena->used += aligned_size;
+    if (arena->used > arena->high_watermark) {
+        arena->high_watermark = arena->used;
+    }
+    return ptr;
+}
+
+void *esp_arena_calloc(esp_arena_t *arena, size_t n, size_t size)
+{
+    size_t total;
+    if (__builtin_mul_overflow(n, size, &total)) {
+        return NULL;
+    }
+
+    void *ptr = esp_arena_alloc(arena, total);
+    if (ptr != NULL) {
+        memset(ptr, 0, total);
+    }
+    return ptr;
+}
+
+void esp_arena_reset(esp_arena_t *arena)
+{
+    if (arena != NULL) {
+        arena->used = 0;
+    }
+}
+
+void esp_arena_destroy(esp_arena_t *arena)
+{
+    if (arena != NULL) {
+        heap_caps_free(arena->buffer);
+        heap_caps_free(arena);
+    }
+}
+
+size_t esp_arena_get_free_size(const esp_arena_t *arena)
+{
+    return (arena != NULL) ? arena->capacity - arena->used : 0;
+}
+
+size_t esp_arena_get_high_watermark(const esp_arena_t *arena)
+{
+    return (arena != NULL) ? arena->high_watermark : 0;
+}
@@ -81,7 +81,14 @@ Routine to allocate a bit of memory with certain capabilities. caps is a bitfiel
 */
 HEAP_IRAM_ATTR void *heap_caps_malloc( size_t size, uint32_t caps)
 {
+#ifdef CONFIG_HEAP_USE_FAST_BINS
+    void* ptr = heap_caps_fast_bins_malloc(size, caps);
+    if (ptr == NULL) {
+        ptr = heap_caps_malloc_base(size, caps);
+    }
+#else
     void* ptr = heap_caps_malloc_base(size, caps);
+#endif
 
 
     if (!ptr && size > 0){
@@ -23,9 +23,24 @@
 #define CALL_HOOK(hook, ...) {}
 #endif
 
+#ifdef CONFIG_HEAP_SAMPLED_STATS
+#define RECORD_SAMPLED_ALLOC(ptr, size) heap_caps_sampling_record_alloc(ptr, size)
+#define RECORD_SAMPLED_FREE(ptr)        heap_caps_sampling_record_free(ptr)
+#else
+#define RECORD_SAMPLED_ALLOC(ptr, size) {}
+#define RECORD_SAMPLED_FREE(ptr)        {}
+#endif
+
 //This is normally provided by the heap-memalign-hw component.
 extern void esp_heap_adjust_alignment_to_hw(size_t *p_alignment, size_t *p_size, uint32_t *p_caps);
 
+#ifdef CONFIG_HEAP_USE_WIDE_MEMSET
+//Provided by the esp_hw_support component, see esp_private/esp_wide_copy.h
+extern void esp_wide_memset(void *dst, uint8_t c, size_t n);
+//Calloc zeroing switches to the vector fill routine from this size up
+#define WIDE_MEMSET_MIN_SIZE 1024
+#endif
+
 //Default alignment the multiheap allocator / tlsf will align 'unaligned' memory to, in bytes
 #define UNALIGNED_MEM_ALIGNMENT_BYTES 4
 
@@ -57,6 +72,14 @@ HEAP_IRAM_ATTR void heap_caps_free( void *ptr)
         return;
     }
 
+    RECORD_SAMPLED_FREE(ptr);
+
+#ifdef CONFIG_HEAP_USE_FAST_BINS
+    if (!esp_ptr_in_diram_iram(ptr) && heap_caps_fast_bins_free(ptr)) {
+        return;
+    }
+#endif
+
     if (esp_ptr_in_diram_iram(ptr)) {
         //Memory allocated here is actually allocated in the DRAM alias region and
         //cannot be de-allocated as usual. dram_alloc_to_iram_addr stores a pointer to
@@ -143,6 +166,7 @@ HEAP_IRAM_ATTR NOINLINE_ATTR void *heap_caps_aligned_alloc_base(size_t alignment
                             ret = MULTI_HEAP_ADD_BLOCK_OWNER_OFFSET(ret);
                             uint32_t *iptr = dram_alloc_to_iram_addr(ret, size + 4);  // int overflow checked above
                             CALL_HOOK(esp_heap_trace_alloc_hook, iptr, size, caps);
+                            RECORD_SAMPLED_ALLOC(iptr, size);
                             return iptr;
                         }
                     } else {
@@ -153,6 +177,7 @@ HEAP_IRAM_ATTR NOINLINE_ATTR void *heap_caps_aligned_alloc_base(size_t alignment
                             MULTI_HEAP_SET_BLOCK_OWNER(ret);
                             ret = MULTI_HEAP_ADD_BLOCK_OWNER_OFFSET(ret);
                             CALL_HOOK(esp_heap_trace_alloc_hook, ret, size, caps);
+                            RECORD_SAMPLED_ALLOC(ret, size);
                             return ret;
                         }
                     }
@@ -283,7 +308,14 @@ HEAP_IRAM_ATTR void *heap_caps_calloc_base( size_t n, size_t size, uint32_t caps
 
     result = heap_caps_malloc_base(size_bytes, caps);
     if (result != NULL) {
-        memset(result, 0, size_bytes);
+#ifdef CONFIG_HEAP_USE_WIDE_MEMSET
+        if (size_bytes >= WIDE_MEMSET_MIN_SIZE) {
+            esp_wide_memset(result, 0, size_bytes);
+        } else
+#endif
+        {
+            memset(result, 0, size_bytes);
+        }
     }
     return result;
 }
@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_heap_budget.h"
+
+/* Per-subsystem heap budgets, see esp_heap_budget.h.
+ *
+ * A budget is a byte counter checked before the underlying allocation is
+ * made: the requested size is reserved under the budget lock, the allocation
+ * runs without it, and the reservation is corrected to the actual block size
+ * (or rolled back) afterwards. Reclaim callbacks run without the lock so
+ * they can free tagged memory themselves.
+ */
+
+struct heap_budget_t {
+    const char *name;
+    size_t limit;
+    size_t used;
+    size_t peak;
+    uint32_t denied;                    // allocations refused over budget
+    uint32_t reclaims;                  // reclaim callback invocations
+    heap_budget_reclaim_cb_t reclaim_cb;
+    void *reclaim_arg;
+};
+
+static struct heap_budget_t s_budgets[CONFIG_HEAP_MEMORY_BUDGETS_MAX];
+static size_t s_budget_count;
+static portMUX_TYPE s_budget_lock = portMUX_INITIALIZER_UNLOCKED;
+
+esp_err_t heap_caps_budget_register(const char *name, size_t limit, heap_budget_handle_t *budget_out)
+{
+    if (name == NULL || budget_out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_budget_lock);
+    if (s_budget_count >= CONFIG_HEAP_MEMORY_BUDGETS_MAX) {
+        portEXIT_CRITICAL(&s_budget_lock);
+        return ESP_ERR_NO_MEM;
+    }
+    struct heap_budget_t *budget = &s_budgets[s_budget_count++];
+    budget->name = name;
+    budget->limit = limit;
+    portEXIT_CRITICAL(&s_budget_lock);
+    *budget_out = budget;
+    return ESP_OK;
+}
+
+esp_err_t heap_caps_budget_set_limit(heap_budget_handle_t budget, size_t limit)
+{
+    if (budget == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_budget_lock);
+    budget->limit = limit;
+    portEXIT_CRITICAL(&s_budget_lock);
+    return ESP_OK;
+}
+
+esp_err_t heap_caps_budget_set_reclaim_cb(heap_budget_handle_t budget, heap_budget_reclaim_cb_t reclaim_cb, void *user_arg)
+{
+    if (budget == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_budget_lock);
+    budget->reclaim_cb = reclaim_cb;
+    budget->reclaim_arg = user_arg;
+    portEXIT_CRITICAL(&s_budget_lock);
+    return ESP_OK;
+}
+
+// Try to reserve size bytes in the budget. Returns true on success.
+static bool budget_charge(heap_budget_handle_t budget, size_t size)
+{
+    bool ok = false;
+    portENTER_CRITICAL(&s_budget_lock);
+    if (budget->used + size <= budget->limit) {
+        budget->used += size;
+        if (budget->used > budget->peak) {
+            budget->peak = budget->used;
+        }
+        ok = true;
+    }
+    portEXIT_CRITICAL(&s_budget_lock);
+    return ok;
+}
+
+static void budget_uncharge(heap_budget_handle_t budget, size_t size)
+{
+    portENTER_CRITICAL(&s_budget_lock);
+    budget->used = (budget->used > size) ? budget->used - size : 0;
+    portEXIT_CRITICAL(&s_budget_lock);
+}
+
+void *heap_caps_malloc_tagged(size_t size, uint32_t caps, heap_budget_handle_t budget)
+{
+    if (budget == NULL || size == 0) {
+        return NULL;
+    }
+
+    if (!budget_charge(budget, size)) {
+        // Over budget: ask the owner to give memory back, then retry once.
+        // The callback runs without the budget lock so it may free tagged
+        // allocations of its own.
+        heap_budget_reclaim_cb_t reclaim_cb = budget->reclaim_cb;
+        size_t shortfall = size;    // at most `size` bytes are missing
+        if (reclaim_cb != NULL) {
+            portENTER_CRITICAL(&s_budget_lock);
+            budget->reclaims++;
+            portEXIT_CRITICAL(&s_budget_lock);
+            reclaim_cb(shortfall, budget->reclaim_arg);
+        }
+        if (reclaim_cb == NULL || !budget_charge(budget, size)) {
+            portENTER_CRITICAL(&s_budget_lock);
+            budget->denied++;
+            portEXIT_CRITICAL(&s_budget_lock);
+            return NULL;
+        }
+    }
+
+    void *ptr = heap_caps_malloc(size, caps);
+    if (ptr == NULL) {
+        budget_uncharge(budget, size);
+        return NULL;
+    }
+
+    // Charge the real block size (header/alignment overhead included), so
+    // the budget reflects what the heap actually lost
+    size_t actual = heap_caps_get_allocated_size(ptr);
+    if (actual > size) {
+        // Exceeding the limit by the block overhead is accepted here:
+        // failing would leak determinism for a few bytes of slack
+        portENTER_CRITICAL(&s_budget_lock);
+        budget->used += actual - size;
+        if (budget->used > budget->peak) {
+            budget->peak = budget->used;
+        }
+        portEXIT_CRITICAL(&s_budget_lock);
+    }
+    return ptr;
+}
+
+void *heap_caps_calloc_tagged(size_t n, size_t size, uint32_t caps, heap_budget_handle_t budget)
+{
+    size_t total;
+    if (__builtin_mul_overflow(n, size, &total)) {
+        return NULL;
+    }
+    void *ptr = heap_caps_malloc_tagged(total, caps, budget);
+    if (ptr != NULL) {
+        memset(ptr, 0, total);
+    }
+    return ptr;
+}
+
+void heap_caps_free_tagged(void *ptr, heap_budget_handle_t budget)
+{
+    if (ptr == NULL) {
+        return;
+    }
+    size_t actual = heap_caps_get_allocated_size(ptr);
+    heap_caps_free(ptr);
+    if (budget != NULL) {
+        budget_uncharge(budget, actual);
+    }
+}
+
+size_t heap_caps_budget_get_used(heap_budget_handle_t budget)
+{
+    return (budget != NULL) ? budget->used : 0;
+}
+
+size_t heap_caps_budget_get_limit(heap_budget_handle_t budget)
+{
+    return (budget != NULL) ? budget->limit : 0;
+}
+
+void heap_caps_budget_print(void)
+{
+    printf("Heap budgets:\n");
+    printf(" Name                 Limit       Used       Peak  Denied  Reclaims\n");
+    portENTER_CRITICAL(&s_budget_lock);
+    size_t count = s_budget_count;
+    portEXIT_CRITICAL(&s_budget_lock);
+    for (size_t i = 0; i < count; i++) {
+        const struct heap_budget_t *budget = &s_budgets[i];
+        printf(" %-18s %8u %10u %10u %7" PRIu32 " %9" PRIu32 "\n",
+               budget->name, (unsigned)budget->limit, (unsigned)budget->used,
+               (unsigned)budget->peak, budget->denied, budget->reclaims);
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "esp_heap_caps.h"
+#include "heap_private.h"
+
+/* Heap compaction by relocation, see esp_heap_caps.h.
+ *
+ * TLSF cannot move live blocks, so compaction works on allocations whose
+ * owners declared them movable: for each registered allocation the pass tries
+ * to obtain a block at a lower address, copies the contents, notifies the
+ * owner through its relocation callback and frees the old block. Moving
+ * allocations monotonically towards lower addresses drains the "holes"
+ * between them, letting the freed space coalesce into larger blocks at the
+ * upper end of the heap.
+ */
+
+typedef struct {
+    void *ptr;                      // tracked allocation, NULL when the slot is free
+    heap_caps_relocation_cb_t cb;
+    void *cb_arg;
+} movable_entry_t;
+
+static movable_entry_t s_movables[CONFIG_HEAP_DEFRAG_MAX_MOVABLE];
+static portMUX_TYPE s_defrag_lock = portMUX_INITIALIZER_UNLOCKED;
+
+esp_err_t heap_caps_register_movable(void *ptr, heap_caps_relocation_cb_t relocation_cb, void *cb_arg)
+{
+    if (ptr == NULL || relocation_cb == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t err = ESP_ERR_NO_MEM;
+    portENTER_CRITICAL(&s_defrag_lock);
+    movable_entry_t *free_slot = NULL;
+    for (int i = 0; i < CONFIG_HEAP_DEFRAG_MAX_MOVABLE; i++) {
+        if (s_movables[i].ptr == ptr) {
+            err = ESP_ERR_INVALID_STATE;
+            free_slot = NULL;
+            break;
+        }
+        if (s_movables[i].ptr == NULL && free_slot == NULL) {
+            free_slot = &s_movables[i];
+        }
+    }
+    if (free_slot != NULL) {
+        free_slot->ptr = ptr;
+        free_slot->cb = relocation_cb;
+        free_slot->cb_arg = cb_arg;
+        err = ESP_OK;
+    }
+    portEXIT_CRITICAL(&s_defrag_lock);
+    return err;
+}
+
+esp_err_t heap_caps_unregister_movable(void *ptr)
+{
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+    portENTER_CRITICAL(&s_defrag_lock);
+    for (int i = 0; i < CONFIG_HEAP_DEFRAG_MAX_MOVABLE; i++) {
+        if (s_movables[i].ptr == ptr) {
+            s_movables[i].ptr = NULL;
+            err = ESP_OK;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_defrag_lock);
+    return err;
+}
+
+size_t heap_caps_defrag(uint32_t caps, uint32_t budget_us)
+{
+    uint32_t start_cycles = esp_cpu_get_cycle_count();
+    uint32_t budget_cycles = budget_us * esp_rom_get_cpu_ticks_per_us();
+    size_t moved_bytes = 0;
+
+    for (int i = 0; i < CONFIG_HEAP_DEFRAG_MAX_MOVABLE; i++) {
+        if (budget_us != 0 && (esp_cpu_get_cycle_count() - start_cycles) >= budget_cycles) {
+            break;
+        }
+
+        portENTER_CRITICAL(&s_defrag_lock);
+        movable_entry_t entry = s_movables[i];
+        portEXIT_CRITICAL(&s_defrag_lock);
+        if (entry.ptr == NULL) {
+            continue;
+        }
+
+        /* Aliased DIRAM allocations cannot be moved by address comparison */
+        if (esp_ptr_in_diram_iram(entry.ptr)) {
+            continue;
+        }
+
+        heap_t *heap = find_containing_heap(MULTI_HEAP_REMOVE_BLOCK_OWNER_OFFSET(entry.ptr));
+        if (heap == NULL || !heap_caps_match(heap, caps)) {
+            continue;
+        }
+
+        size_t size = heap_caps_get_allocated_size(entry.ptr);
+        void *new_ptr = heap_caps_malloc_base(size, caps);
+        if (new_ptr == NULL) {
+            continue;
+        }
+        if (new_ptr >= entry.ptr) {
+            /* No progress possible for this allocation right now */
+            heap_caps_free(new_ptr);
+            continue;
+        }
+
+        memcpy(new_ptr, entry.ptr, size);
+
+        portENTER_CRITICAL(&s_defrag_lock);
+        /* Re-check: the owner may have unregistered the allocation meanwhile */
+        bool still_registered = (s_movables[i].ptr == entry.ptr);
+        if (still_registered) {
+            s_movables[i].ptr = new_ptr;
+        }
+        portEXIT_CRITICAL(&s_defrag_lock);
+        if (!still_registered) {
+            heap_caps_free(new_ptr);
+            continue;
+        }
+
+        entry.cb(entry.ptr, new_ptr, size, entry.cb_arg);
+        heap_caps_free(entry.ptr);
+        moved_bytes += size;
+    }
+
+    return moved_bytes;
+}
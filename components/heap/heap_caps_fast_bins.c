@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "multi_heap.h"
+#include "heap_private.h"
+
+/*
+ * Per-CPU front end caching freed blocks of up to FAST_BIN_MAX_SIZE bytes in
+ * FAST_BIN_CLASS_COUNT size classes. A hit completes with interrupts briefly
+ * masked on the local core, without taking the shared heap lock or touching
+ * the TLSF structures; misses refill the cache in a batch so the heap lock is
+ * amortized over several allocations. Each CPU owns its bins exclusively, so
+ * there is no cross-core contention.
+ *
+ * Cached blocks come from internal default memory only, which is what the
+ * malloc side hands out; blocks from heaps with other capabilities fall
+ * through to the regular free path.
+ */
+
+#define FAST_BIN_GRANULARITY  16
+#define FAST_BIN_CLASS_COUNT  4
+#define FAST_BIN_MAX_SIZE     (FAST_BIN_GRANULARITY * FAST_BIN_CLASS_COUNT)
+#define FAST_BIN_DEPTH        CONFIG_HEAP_FAST_BINS_CACHE_DEPTH
+#define FAST_BIN_REFILL_COUNT (FAST_BIN_DEPTH / 2)
+
+/* capabilities a cached block can satisfy */
+#define FAST_BIN_SERVABLE_CAPS (MALLOC_CAP_DEFAULT | MALLOC_CAP_INTERNAL | \
+                                MALLOC_CAP_8BIT | MALLOC_CAP_32BIT)
+
+typedef struct fast_bin_node {
+    struct fast_bin_node *next;
+} fast_bin_node_t;
+
+typedef struct {
+    fast_bin_node_t *head;
+    uint16_t count;
+} fast_bin_t;
+
+static fast_bin_t s_fast_bins[CONFIG_FREERTOS_NUMBER_OF_CORES][FAST_BIN_CLASS_COUNT];
+
+/* free a block back to its owning heap, bypassing the fast bins */
+HEAP_IRAM_ATTR static void fast_bin_block_free(void *ptr)
+{
+    heap_t *heap = find_containing_heap(ptr);
+    assert(heap != NULL);
+    multi_heap_free(heap->heap, ptr);
+}
+
+HEAP_IRAM_ATTR void *heap_caps_fast_bins_malloc(size_t size, uint32_t caps)
+{
+    if (size == 0 || size > FAST_BIN_MAX_SIZE || (caps & ~FAST_BIN_SERVABLE_CAPS) != 0) {
+        return NULL;
+    }
+
+    const size_t class_idx = (size - 1) / FAST_BIN_GRANULARITY;
+
+    uint32_t int_state = portSET_INTERRUPT_MASK_FROM_ISR();
+    fast_bin_t *bin = &s_fast_bins[esp_cpu_get_core_id()][class_idx];
+    fast_bin_node_t *node = bin->head;
+    if (node != NULL) {
+        bin->head = node->next;
+        bin->count--;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(int_state);
+
+    if (node != NULL) {
+        return node;
+    }
+
+    // miss: grab a batch from the heap so the lock is amortized over
+    // several allocations
+    const size_t class_size = (class_idx + 1) * FAST_BIN_GRANULARITY;
+    void *blocks[FAST_BIN_REFILL_COUNT];
+    size_t allocated = 0;
+    while (allocated < FAST_BIN_REFILL_COUNT) {
+        blocks[allocated] = heap_caps_malloc_base(class_size, MALLOC_CAP_DEFAULT | MALLOC_CAP_INTERNAL);
+        if (blocks[allocated] == NULL) {
+            break;
+        }
+        allocated++;
+    }
+    if (allocated == 0) {
+        return NULL;
+    }
+
+    void *ret = blocks[--allocated];
+
+    size_t stored = 0;
+    if (allocated > 0) {
+        int_state = portSET_INTERRUPT_MASK_FROM_ISR();
+        bin = &s_fast_bins[esp_cpu_get_core_id()][class_idx];
+        while (stored < allocated && bin->count < FAST_BIN_DEPTH) {
+            node = (fast_bin_node_t *)blocks[stored];
+            node->next = bin->head;
+            bin->head = node;
+            bin->count++;
+            stored++;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(int_state);
+    }
+
+    // bin may have been refilled by a preempting task in the meantime;
+    // return whatever did not fit
+    while (stored < allocated) {
+        fast_bin_block_free(blocks[stored++]);
+    }
+
+    return ret;
+}
+
+HEAP_IRAM_ATTR bool heap_caps_fast_bins_free(void *ptr)
+{
+    heap_t *heap = find_containing_heap(ptr);
+    if (heap == NULL) {
+        return false;
+    }
+
+    // only cache blocks from internal default heaps, the only kind the
+    // allocation side hands out
+    const uint32_t heap_caps = get_all_caps(heap);
+    if ((heap_caps & (MALLOC_CAP_DEFAULT | MALLOC_CAP_INTERNAL)) !=
+            (MALLOC_CAP_DEFAULT | MALLOC_CAP_INTERNAL)) {
+        return false;
+    }
+
+    // reading the block size does not require the heap lock; the header of
+    // an allocated block is not modified by other allocations
+    const size_t alloc_size = multi_heap_get_allocated_size(heap->heap, ptr);
+    if (alloc_size < FAST_BIN_GRANULARITY ||
+            alloc_size >= FAST_BIN_MAX_SIZE + FAST_BIN_GRANULARITY) {
+        return false;
+    }
+    const size_t class_idx = alloc_size / FAST_BIN_GRANULARITY - 1;
+
+    bool cached = false;
+    uint32_t int_state = portSET_INTERRUPT_MASK_FROM_ISR();
+    fast_bin_t *bin = &s_fast_bins[esp_cpu_get_core_id()][class_idx];
+    if (bin->count < FAST_BIN_DEPTH) {
+        fast_bin_node_t *node = (fast_bin_node_t *)ptr;
+        node->next = bin->head;
+        bin->head = node;
+        bin->count++;
+        cached = true;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(int_state);
+
+    return cached;
+}
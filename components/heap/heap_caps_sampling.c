@@ -0,0 +1,196 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_heap_sampled_stats.h"
+#include "heap_private.h"
+
+/* Statistical per-task heap accounting, see esp_heap_sampled_stats.h.
+ *
+ * Every Nth successful allocation is recorded into a small table together
+ * with the calling task; the matching free removes it again. The per-task
+ * accumulators scaled by N estimate the true totals. The fast path executed
+ * on every non-sampled allocation is a single atomic counter decrement, and
+ * on every free a short lock-free probe of the sample table, keeping the
+ * overhead well below heap tracing or task tracking.
+ */
+
+#define SAMPLE_INTERVAL   CONFIG_HEAP_SAMPLED_STATS_INTERVAL
+#define SAMPLE_TABLE_SIZE CONFIG_HEAP_SAMPLED_STATS_TABLE_SIZE
+#define SAMPLE_MAX_TASKS  CONFIG_HEAP_SAMPLED_STATS_MAX_TASKS
+
+/* Linear probing distance in the sample table before a sample is dropped */
+#define SAMPLE_MAX_PROBE  4
+
+typedef struct {
+    void *ptr;              // user pointer of the sampled allocation, NULL when the slot is empty
+    uint32_t size;
+    TaskHandle_t task;
+} sample_entry_t;
+
+typedef struct {
+    TaskHandle_t task;      // owning task, NULL is valid (pre-scheduler allocations)
+    bool used;
+    uint32_t sampled_allocs;
+    uint64_t sampled_bytes;
+    uint32_t live_blocks;
+    uint64_t live_bytes;
+} task_slot_t;
+
+static sample_entry_t s_sample_table[SAMPLE_TABLE_SIZE];
+static task_slot_t s_task_slots[SAMPLE_MAX_TASKS];
+static uint32_t s_dropped_samples;
+static uint32_t s_countdown = SAMPLE_INTERVAL;
+static portMUX_TYPE s_sampling_lock = portMUX_INITIALIZER_UNLOCKED;
+
+HEAP_IRAM_ATTR static inline size_t sample_hash(void *ptr)
+{
+    /* Multiplicative hash of the pointer, ignoring the alignment bits */
+    return (((uintptr_t)ptr >> 2) * 2654435761UL) % SAMPLE_TABLE_SIZE;
+}
+
+/* Find the accumulator slot of a task, allocating one if needed.
+   Called with s_sampling_lock held. Returns NULL when all slots are taken. */
+static task_slot_t *task_slot_get(TaskHandle_t task)
+{
+    task_slot_t *free_slot = NULL;
+    for (int i = 0; i < SAMPLE_MAX_TASKS; i++) {
+        if (s_task_slots[i].used) {
+            if (s_task_slots[i].task == task) {
+                return &s_task_slots[i];
+            }
+        } else if (free_slot == NULL) {
+            free_slot = &s_task_slots[i];
+        }
+    }
+    if (free_slot != NULL) {
+        memset(free_slot, 0, sizeof(*free_slot));
+        free_slot->task = task;
+        free_slot->used = true;
+    }
+    return free_slot;
+}
+
+HEAP_IRAM_ATTR void heap_caps_sampling_record_alloc(void *ptr, size_t size)
+{
+    /* Fast path: only every SAMPLE_INTERVAL-th allocation proceeds */
+    if (__atomic_sub_fetch(&s_countdown, 1, __ATOMIC_RELAXED) != 0) {
+        return;
+    }
+    __atomic_store_n(&s_countdown, SAMPLE_INTERVAL, __ATOMIC_RELAXED);
+
+    /* NULL before the scheduler is started, aggregating startup allocations */
+    TaskHandle_t task = (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) ?
+                        NULL : xTaskGetCurrentTaskHandle();
+
+    portENTER_CRITICAL_SAFE(&s_sampling_lock);
+    sample_entry_t *entry = NULL;
+    size_t idx = sample_hash(ptr);
+    for (int probe = 0; probe < SAMPLE_MAX_PROBE; probe++) {
+        if (s_sample_table[idx].ptr == NULL) {
+            entry = &s_sample_table[idx];
+            break;
+        }
+        idx = (idx + 1) % SAMPLE_TABLE_SIZE;
+    }
+    task_slot_t *slot = (entry != NULL) ? task_slot_get(task) : NULL;
+    if (slot != NULL) {
+        entry->ptr = ptr;
+        entry->size = size;
+        entry->task = task;
+        slot->sampled_allocs += 1;
+        slot->sampled_bytes += size;
+        slot->live_blocks += 1;
+        slot->live_bytes += size;
+    } else {
+        s_dropped_samples++;
+    }
+    portEXIT_CRITICAL_SAFE(&s_sampling_lock);
+}
+
+HEAP_IRAM_ATTR void heap_caps_sampling_record_free(void *ptr)
+{
+    /* Lock-free pre-check: almost all freed pointers were never sampled and
+       exit after probing a few table slots without taking the lock */
+    size_t idx = sample_hash(ptr);
+    bool maybe_sampled = false;
+    for (int probe = 0; probe < SAMPLE_MAX_PROBE; probe++) {
+        if (s_sample_table[idx].ptr == ptr) {
+            maybe_sampled = true;
+            break;
+        }
+        idx = (idx + 1) % SAMPLE_TABLE_SIZE;
+    }
+    if (!maybe_sampled) {
+        return;
+    }
+
+    portENTER_CRITICAL_SAFE(&s_sampling_lock);
+    /* Re-probe under the lock, the table may have changed in between */
+    idx = sample_hash(ptr);
+    for (int probe = 0; probe < SAMPLE_MAX_PROBE; probe++) {
+        sample_entry_t *entry = &s_sample_table[idx];
+        if (entry->ptr == ptr) {
+            task_slot_t *slot = task_slot_get(entry->task);
+            if (slot != NULL && slot->live_blocks > 0) {
+                slot->live_blocks -= 1;
+                slot->live_bytes -= entry->size;
+            }
+            entry->ptr = NULL;
+            break;
+        }
+        idx = (idx + 1) % SAMPLE_TABLE_SIZE;
+    }
+    portEXIT_CRITICAL_SAFE(&s_sampling_lock);
+}
+
+size_t heap_caps_sampled_stats(heap_caps_sampled_task_stats_t *stats, size_t max_tasks, uint32_t *dropped)
+{
+    if (stats == NULL) {
+        return 0;
+    }
+
+    size_t count = 0;
+    portENTER_CRITICAL(&s_sampling_lock);
+    for (int i = 0; i < SAMPLE_MAX_TASKS && count < max_tasks; i++) {
+        if (!s_task_slots[i].used) {
+            continue;
+        }
+        stats[count].task = s_task_slots[i].task;
+        stats[count].alloc_count = s_task_slots[i].sampled_allocs * SAMPLE_INTERVAL;
+        stats[count].alloc_bytes = s_task_slots[i].sampled_bytes * SAMPLE_INTERVAL;
+        stats[count].live_blocks = s_task_slots[i].live_blocks * SAMPLE_INTERVAL;
+        stats[count].live_bytes = s_task_slots[i].live_bytes * SAMPLE_INTERVAL;
+        count++;
+    }
+    if (dropped != NULL) {
+        *dropped = s_dropped_samples;
+    }
+    portEXIT_CRITICAL(&s_sampling_lock);
+    return count;
+}
+
+void heap_caps_sampled_stats_reset(void)
+{
+    portENTER_CRITICAL(&s_sampling_lock);
+    memset(s_task_slots, 0, sizeof(s_task_slots));
+    s_dropped_samples = 0;
+    /* Samples of still-live allocations stay in the table so their frees
+       remain matched; rebuild the live accumulators from them */
+    for (int i = 0; i < SAMPLE_TABLE_SIZE; i++) {
+        if (s_sample_table[i].ptr != NULL) {
+            task_slot_t *slot = task_slot_get(s_sample_table[i].task);
+            if (slot != NULL) {
+                slot->live_blocks += 1;
+                slot->live_bytes += s_sample_table[i].size;
+            }
+        }
+    }
+    portEXIT_CRITICAL(&s_sampling_lock);
+}
@@ -7,6 +7,8 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
 #include <soc/soc_memory_layout.h>
 #include "multi_heap.h"
 #include "multi_heap_platform.h"
@@ -87,6 +89,24 @@ void *heap_caps_calloc_base(size_t n, size_t size, uint32_t caps);
 void *heap_caps_malloc_base(size_t size, uint32_t caps);
 void *heap_caps_aligned_alloc_base(size_t alignment, size_t size, uint32_t caps);
 
+#ifdef CONFIG_HEAP_SAMPLED_STATS
+/* Statistical per-task heap accounting, see heap_caps_sampling.c.
+   Called from the allocation/free paths for every successful allocation and
+   every free; only every Nth call does more than a counter decrement or a
+   short table probe. */
+void heap_caps_sampling_record_alloc(void *ptr, size_t size);
+void heap_caps_sampling_record_free(void *ptr);
+#endif
+
+#ifdef CONFIG_HEAP_USE_FAST_BINS
+/* Per-CPU cache of small blocks, see heap_caps_fast_bins.c.
+   The malloc function returns NULL when the request is not servable from the
+   cache (too large, incompatible caps, refill failed); the free function
+   returns false when the block was not taken and must be freed normally. */
+void *heap_caps_fast_bins_malloc(size_t size, uint32_t caps);
+bool heap_caps_fast_bins_free(void *ptr);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Region ("arena") allocator for groups of allocations freed together
+ *
+ * An arena hands out memory from a single backing allocation by bumping a
+ * pointer, so individual allocations are a few instructions and cause no heap
+ * lock contention or fragmentation. Allocations cannot be freed individually;
+ * the whole arena is recycled at once with esp_arena_reset(). Typical use is
+ * request- or frame-scoped scratch memory where many short-lived buffers die
+ * together.
+ *
+ * Arenas are not thread-safe: an arena must only be used from one task at a
+ * time.
+ */
+typedef struct esp_arena_t esp_arena_t;
+
+/**
+ * @brief Create an arena with the given capacity
+ *
+ * The backing memory is allocated with heap_caps_malloc(), so the usual
+ * capability flags select where the arena lives (e.g. MALLOC_CAP_SPIRAM or
+ * MALLOC_CAP_INTERNAL).
+ *
+ * @param size Usable capacity of the arena, in bytes
+ * @param caps Capabilities of the backing memory, see MALLOC_CAP_*
+ *
+ * @return Pointer to the new arena, or NULL if allocation failed
+ */
+esp_arena_t *esp_arena_create(size_t size, uint32_t caps);
+
+/**
+ * @brief Allocate memory from an arena
+ *
+ * The returned memory is 4-byte aligned and remains valid until the arena is
+ * reset or destroyed. It must not be passed to free().
+ *
+ * @param arena Arena to allocate from
+ * @param size  Number of bytes to allocate
+ *
+ * @return Pointer to the memory, or NULL if the arena has insufficient space
+ */
+void *esp_arena_alloc(esp_arena_t *arena, size_t size);
+
+/**
+ * @brief Allocate zero-initialized memory from an arena
+ *
+ * Behaves as esp_arena_alloc(n * size) with the result zeroed; returns NULL
+ * on multiplication overflow.
+ */
+void *esp_arena_calloc(esp_arena_t *arena, size_t n, size_t size);
+
+/**
+ * @brief Release all allocations of an arena at once
+ *
+ * O(1): only the internal offset is rewound, the backing memory stays
+ * allocated for reuse. All pointers previously handed out become invalid.
+ *
+ * @param arena Arena to reset
+ */
+void esp_arena_reset(esp_arena_t *arena);
+
+/**
+ * @brief Destroy an arena and free its backing memory
+ *
+ * @param arena Arena to destroy, may be NULL
+ */
+void esp_arena_destroy(esp_arena_t *arena);
+
+/**
+ * @brief Number of bytes still available in the arena
+ */
+size_t esp_arena_get_free_size(const esp_arena_t *arena);
+
+/**
+ * @brief Largest number of bytes ever in use at once since creation
+ *
+ * Useful for sizing the arena from measured data; not cleared by
+ * esp_arena_reset().
+ */
+size_t esp_arena_get_high_watermark(const esp_arena_t *arena);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Per-subsystem heap budgets
+ *
+ * A budget is a named byte limit that tagged allocations are charged
+ * against. Subsystems allocate through heap_caps_malloc_tagged() instead of
+ * heap_caps_malloc(); when an allocation would push the budget past its
+ * limit, the budget's reclaim callback (if any) is asked to give memory
+ * back, and if that does not make room the allocation fails. This turns
+ * unpredictable system-wide heap exhaustion into a per-subsystem failure at
+ * a deterministic boundary, with live usage numbers per budget.
+ *
+ * Only available when CONFIG_HEAP_MEMORY_BUDGETS is enabled.
+ */
+
+typedef struct heap_budget_t *heap_budget_handle_t;
+
+/**
+ * @brief Callback asked to release memory when a budget is exhausted
+ *
+ * Called from the context of the task whose tagged allocation exceeded the
+ * budget, without any heap or budget lock held, so the callback is free to
+ * call heap_caps_free_tagged(). Must not block for long.
+ *
+ * @param bytes_needed Number of bytes the budget is short of
+ * @param user_arg As passed to heap_caps_budget_set_reclaim_cb()
+ * @return Number of bytes the callback believes it has released
+ */
+typedef size_t (*heap_budget_reclaim_cb_t)(size_t bytes_needed, void *user_arg);
+
+/**
+ * @brief Register a new budget
+ *
+ * @param name Budget name used in the usage report; stored by reference,
+ *             must remain valid
+ * @param limit Byte limit charged allocations may not exceed in total
+ * @param[out] budget_out Handle of the new budget
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if name or budget_out is NULL
+ *      - ESP_ERR_NO_MEM if CONFIG_HEAP_MEMORY_BUDGETS_MAX budgets exist already
+ */
+esp_err_t heap_caps_budget_register(const char *name, size_t limit, heap_budget_handle_t *budget_out);
+
+/**
+ * @brief Change the limit of a budget
+ *
+ * The limit may be set below the current usage; already-charged memory stays
+ * valid and only new allocations are refused until usage drops.
+ */
+esp_err_t heap_caps_budget_set_limit(heap_budget_handle_t budget, size_t limit);
+
+/**
+ * @brief Install a reclaim callback for a budget
+ *
+ * @param budget Budget handle
+ * @param reclaim_cb Callback invoked when a tagged allocation exceeds the
+ *                   limit, or NULL to make over-budget allocations fail
+ *                   immediately
+ * @param user_arg Passed through to the callback
+ */
+esp_err_t heap_caps_budget_set_reclaim_cb(heap_budget_handle_t budget, heap_budget_reclaim_cb_t reclaim_cb, void *user_arg);
+
+/**
+ * @brief Allocate memory charged against a budget
+ *
+ * Same semantics as heap_caps_malloc(), but the actual block size is charged
+ * against the given budget. Returns NULL if the budget would be exceeded and
+ * the reclaim callback (if any) could not make room, even if the heap itself
+ * still has space. Memory obtained here must be released with
+ * heap_caps_free_tagged() so the budget is credited again.
+ *
+ * @param size Number of bytes to allocate
+ * @param caps Capability flags of suitable memory, see MALLOC_CAP_*
+ * @param budget Budget to charge, must not be NULL
+ */
+void *heap_caps_malloc_tagged(size_t size, uint32_t caps, heap_budget_handle_t budget);
+
+/**
+ * @brief Allocate zero-initialized memory charged against a budget
+ *
+ * heap_caps_calloc() counterpart of heap_caps_malloc_tagged().
+ */
+void *heap_caps_calloc_tagged(size_t n, size_t size, uint32_t caps, heap_budget_handle_t budget);
+
+/**
+ * @brief Free memory allocated with heap_caps_malloc_tagged()
+ *
+ * Credits the block's size back to the budget and frees it. Passing NULL as
+ * ptr is a no-op.
+ */
+void heap_caps_free_tagged(void *ptr, heap_budget_handle_t budget);
+
+/**
+ * @brief Return the number of bytes currently charged against a budget
+ */
+size_t heap_caps_budget_get_used(heap_budget_handle_t budget);
+
+/**
+ * @brief Return the current limit of a budget
+ */
+size_t heap_caps_budget_get_limit(heap_budget_handle_t budget);
+
+/**
+ * @brief Print a summary of all registered budgets to stdout
+ *
+ * One line per budget: name, limit, current and peak usage, the number of
+ * refused allocations and the number of reclaim callback invocations.
+ */
+void heap_caps_budget_print(void);
+
+#ifdef __cplusplus
+}
+#endif
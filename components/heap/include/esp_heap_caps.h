@@ -497,6 +497,71 @@ void heap_caps_walk(uint32_t caps, heap_caps_walker_cb_t walker_func, void *user
  */
 void heap_caps_walk_all(heap_caps_walker_cb_t walker_func, void *user_data);
 
+#ifdef CONFIG_HEAP_DEFRAG
+/**
+ * @brief Callback notifying the owner of a movable allocation that it was relocated
+ *
+ * Called from heap_caps_defrag() after the contents have been copied to the
+ * new location and before the old block is freed. The owner must update every
+ * pointer referring to the allocation; the old block becomes invalid as soon
+ * as the callback returns.
+ *
+ * @param old_ptr Previous address of the allocation
+ * @param new_ptr New address of the allocation
+ * @param size    Usable size of the allocation in bytes
+ * @param arg     User argument given at registration
+ */
+typedef void (*heap_caps_relocation_cb_t)(void *old_ptr, void *new_ptr, size_t size, void *arg);
+
+/**
+ * @brief Register an allocation as movable by heap_caps_defrag()
+ *
+ * The registration follows the allocation across moves: after a relocation
+ * the new address is tracked automatically. Free the allocation only after
+ * unregistering it.
+ *
+ * @param ptr Pointer previously returned by heap_caps_malloc() and friends
+ * @param relocation_cb Callback invoked when the allocation is moved
+ * @param cb_arg User argument passed to the callback
+ *
+ * @return
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_ARG if ptr or relocation_cb is NULL
+ *  - ESP_ERR_INVALID_STATE if ptr is already registered
+ *  - ESP_ERR_NO_MEM if CONFIG_HEAP_DEFRAG_MAX_MOVABLE allocations are already registered
+ */
+esp_err_t heap_caps_register_movable(void *ptr, heap_caps_relocation_cb_t relocation_cb, void *cb_arg);
+
+/**
+ * @brief Remove an allocation from the movable registry
+ *
+ * @param ptr Currently tracked address of the allocation
+ *
+ * @return ESP_OK on success, ESP_ERR_NOT_FOUND if ptr is not registered
+ */
+esp_err_t heap_caps_unregister_movable(void *ptr);
+
+/**
+ * @brief Compact heaps by moving registered movable allocations to lower addresses
+ *
+ * Walks the movable registry and relocates allocations residing in heaps
+ * matching the given capabilities whenever a block at a lower address is
+ * available, which coalesces the freed space into larger blocks over time.
+ * The pass stops once the time budget is exhausted, so it can be called
+ * periodically from a low priority task.
+ *
+ * @note The caller must guarantee that no registered allocation is accessed
+ *       concurrently while the defragmentation pass runs; the relocation
+ *       callbacks are invoked without any lock held.
+ *
+ * @param caps Capabilities of the heaps to compact, see MALLOC_CAP_*
+ * @param budget_us Time budget in microseconds, 0 for no limit
+ *
+ * @return Number of bytes moved
+ */
+size_t heap_caps_defrag(uint32_t caps, uint32_t budget_us);
+#endif // CONFIG_HEAP_DEFRAG
+
 #ifdef __cplusplus
 }
 #endif
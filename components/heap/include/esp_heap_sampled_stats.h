@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "sdkconfig.h"
+
+#ifdef CONFIG_HEAP_SAMPLED_STATS
+
+#include <stdint.h>
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Sampled heap statistics for one task
+ *
+ * All values are estimates obtained by scaling the sampled subset of
+ * allocations by the sampling interval (CONFIG_HEAP_SAMPLED_STATS_INTERVAL).
+ * They converge on the true values for tasks performing many allocations and
+ * are unreliable for tasks that allocate rarely.
+ */
+typedef struct {
+    TaskHandle_t task;      ///< Task to which these estimates belong, NULL for allocations made before the scheduler started
+    uint32_t alloc_count;   ///< Estimated number of allocations since start/reset
+    uint64_t alloc_bytes;   ///< Estimated total bytes allocated since start/reset
+    uint32_t live_blocks;   ///< Estimated number of blocks currently allocated
+    uint64_t live_bytes;    ///< Estimated bytes currently allocated
+} heap_caps_sampled_task_stats_t;
+
+/**
+ * @brief Return per-task heap statistics gathered by allocation sampling
+ *
+ * Allocation counts divided by the time between two calls (or between
+ * heap_caps_sampled_stats_reset() and a call) give per-task allocation
+ * rates, which is the intended way of locating allocation-hot tasks.
+ *
+ * @param[out] stats        Array to fill with per-task statistics
+ * @param[in]  max_tasks    Capacity of the stats array
+ * @param[out] dropped      If not NULL, receives the number of samples dropped
+ *                          because of table or task-slot exhaustion; non-zero
+ *                          values mean the estimates are biased low
+ *
+ * @return Number of entries written to stats
+ */
+size_t heap_caps_sampled_stats(heap_caps_sampled_task_stats_t *stats, size_t max_tasks, uint32_t *dropped);
+
+/**
+ * @brief Reset the cumulative sampled statistics
+ *
+ * Clears the per-task accumulators and the dropped-sample counter. Samples of
+ * still-live allocations are kept so that their frees remain matched.
+ */
+void heap_caps_sampled_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CONFIG_HEAP_SAMPLED_STATS
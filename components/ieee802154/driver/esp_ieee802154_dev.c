@@ -66,6 +66,7 @@ static esp_ieee802154_frame_info_t s_rx_frame_info[CONFIG_IEEE802154_RX_BUFFER_S
 static bool s_needs_next_operation = false;
 
 static uint8_t s_rx_index = 0;
+static uint32_t s_rx_buffer_dropped = 0;
 static uint8_t s_enh_ack_frame[128];
 static uint8_t s_recent_rx_frame_info_index;
 static portMUX_TYPE s_ieee802154_spinlock = portMUX_INITIALIZER_UNLOCKED;
@@ -87,7 +88,9 @@ static pending_tx_t s_pending_tx = { 0 };
 static void ieee802154_receive_done(uint8_t *data, esp_ieee802154_frame_info_t *frame_info)
 {
     // If the RX done packet is written in the stub buffer, drop it silently.
-    if (s_rx_index != CONFIG_IEEE802154_RX_BUFFER_SIZE) {
+    if (s_rx_index == CONFIG_IEEE802154_RX_BUFFER_SIZE) {
+        s_rx_buffer_dropped++;
+    } else {
         // Otherwise, post it to the upper layer.
         // Ignore bit8 for the frame length, due to the max frame length is 127 based 802.15.4 spec.
         data[0] = data[0] & 0x7f;
@@ -121,6 +124,19 @@ esp_err_t ieee802154_receive_handle_done(const uint8_t *data)
     return ESP_OK;
 }
 
+void ieee802154_get_rx_buffer_stats(esp_ieee802154_rx_buffer_stats_t *stats)
+{
+    uint8_t used = 0;
+    for (uint8_t i = 0; i < CONFIG_IEEE802154_RX_BUFFER_SIZE; i++) {
+        if (s_rx_frame_info[i].process) {
+            used++;
+        }
+    }
+    stats->total = CONFIG_IEEE802154_RX_BUFFER_SIZE;
+    stats->used = used;
+    stats->dropped = s_rx_buffer_dropped;
+}
+
 static IRAM_ATTR void event_end_process(void)
 {
     ieee802154_etm_channel_clear(IEEE802154_ETM_CHANNEL0);
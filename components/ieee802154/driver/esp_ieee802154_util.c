@@ -9,6 +9,7 @@
 #include "soc/periph_defs.h"
 #include "hal/ieee802154_ll.h"
 #include "esp_coex_i154.h"
+#include "esp_coexist_policy.h"
 #include "esp_ieee802154_util.h"
 
 uint8_t ieee802154_freq_to_channel(uint8_t freq)
@@ -24,6 +25,7 @@ uint8_t ieee802154_channel_to_freq(uint8_t channel)
 #if !CONFIG_IEEE802154_TEST && (CONFIG_ESP_COEX_SW_COEXIST_ENABLE || CONFIG_EXTERNAL_COEX_ENABLE)
 void ieee802154_set_txrx_pti(ieee802154_txrx_scene_t txrx_scene)
 {
+    bool i154_latency = (esp_coex_policy_get() == ESP_COEX_POLICY_IEEE802154_LATENCY);
 
     switch (txrx_scene) {
     case IEEE802154_SCENE_IDLE:
@@ -31,11 +33,11 @@ void ieee802154_set_txrx_pti(ieee802154_txrx_scene_t txrx_scene)
         break;
     case IEEE802154_SCENE_TX:
     case IEEE802154_SCENE_RX:
-        esp_coex_ieee802154_txrx_pti_set(IEEE802154_LOW);
+        esp_coex_ieee802154_txrx_pti_set(i154_latency ? IEEE802154_HIGH : IEEE802154_LOW);
         break;
     case IEEE802154_SCENE_TX_AT:
     case IEEE802154_SCENE_RX_AT:
-        esp_coex_ieee802154_txrx_pti_set(IEEE802154_MIDDLE);
+        esp_coex_ieee802154_txrx_pti_set(i154_latency ? IEEE802154_HIGH : IEEE802154_MIDDLE);
         break;
     default:
         assert(false);
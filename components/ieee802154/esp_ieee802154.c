@@ -403,6 +403,15 @@ __attribute__((weak)) void esp_ieee802154_timer1_done(void)
 
 }
 
+esp_err_t esp_ieee802154_get_rx_buffer_stats(esp_ieee802154_rx_buffer_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    ieee802154_get_rx_buffer_stats(stats);
+    return ESP_OK;
+}
+
 #if CONFIG_IEEE802154_TXRX_STATISTIC
 void esp_ieee802154_txrx_statistic_clear(void)
 {
@@ -605,6 +605,23 @@ esp_err_t esp_ieee802154_set_transmit_security(uint8_t *frame, uint8_t *key, uin
  */
 esp_err_t esp_ieee802154_enh_ack_generator(uint8_t *frame, esp_ieee802154_frame_info_t *frame_info, uint8_t* enhack_frame);
 
+/**
+ * @brief  Get the occupancy statistics of the receive buffer pool.
+ *
+ * The pool runs dry when frames are received faster than the upper layer hands
+ * the buffers back; the dropped counter then shows how many frames were lost.
+ * Use these figures to choose CONFIG_IEEE802154_RX_BUFFER_SIZE for the
+ * expected burst size.
+ *
+ * @param[out] stats  The pointer to the statistics structure to fill.
+ *
+ * @return
+ *      - ESP_OK on success.
+ *      - ESP_ERR_INVALID_ARG if stats is NULL.
+ *
+ */
+esp_err_t esp_ieee802154_get_rx_buffer_stats(esp_ieee802154_rx_buffer_stats_t *stats);
+
 /**
  * The configurable definitions via Kconfig
  */
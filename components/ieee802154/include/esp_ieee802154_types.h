@@ -81,6 +81,16 @@ typedef struct {
     uint64_t timestamp;          /*!< The timestamp when the frame's SFD field was received */
 } esp_ieee802154_frame_info_t;
 
+/**
+ * @brief The occupancy statistics of the 15.4 receive buffer pool.
+ *
+ */
+typedef struct {
+    uint8_t total;               /*!< Total number of receive buffers (CONFIG_IEEE802154_RX_BUFFER_SIZE) */
+    uint8_t used;                /*!< Buffers currently held by the upper layer */
+    uint32_t dropped;            /*!< Frames dropped because all buffers were held */
+} esp_ieee802154_rx_buffer_stats_t;
+
 #ifdef __cplusplus
 }
 #endif
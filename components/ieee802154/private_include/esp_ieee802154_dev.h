@@ -122,6 +122,14 @@ esp_err_t ieee802154_receive(void);
  */
 esp_err_t ieee802154_receive_handle_done(const uint8_t* frame);
 
+/**
+ * @brief  Get the occupancy statistics of the receive buffer pool.
+ *
+ * @param[out] stats  The pointer to the statistics structure to fill.
+ *
+ */
+void ieee802154_get_rx_buffer_stats(esp_ieee802154_rx_buffer_stats_t *stats);
+
 /**
  * @brief  Transmit the given frame at a specific time.
  *
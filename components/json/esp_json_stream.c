@@ -0,0 +1,723 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "esp_json_stream.h"
+
+#define MAX_DEPTH           32
+#define NUMBER_BUF_SIZE     32
+
+/* ---------------------------- streaming parser ---------------------------- */
+
+typedef struct {
+    const char *p;
+    const char *end;
+    esp_json_stream_cb_t cb;
+    void *ctx;
+} parser_t;
+
+static void skip_ws(parser_t *s)
+{
+    while (s->p < s->end &&
+            (*s->p == ' ' || *s->p == '\t' || *s->p == '\n' || *s->p == '\r')) {
+        s->p++;
+    }
+}
+
+static bool is_hex(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+/* Scan a string literal starting at the opening quote; the reported span
+ * excludes the quotes and keeps escape sequences unresolved */
+static esp_err_t scan_string(parser_t *s, const char **out, size_t *out_len)
+{
+    if (s->p >= s->end || *s->p != '"') {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s->p++;
+    const char *start = s->p;
+    while (s->p < s->end) {
+        char c = *s->p;
+        if (c == '"') {
+            *out = start;
+            *out_len = s->p - start;
+            s->p++;
+            return ESP_OK;
+        }
+        if (c == '\\') {
+            s->p++;
+            if (s->p >= s->end) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            if (*s->p == 'u') {
+                if (s->end - s->p < 5 || !is_hex(s->p[1]) || !is_hex(s->p[2]) ||
+                        !is_hex(s->p[3]) || !is_hex(s->p[4])) {
+                    return ESP_ERR_INVALID_ARG;
+                }
+                s->p += 4;
+            } else if (!strchr("\"\\/bfnrt", *s->p)) {
+                return ESP_ERR_INVALID_ARG;
+            }
+        } else if ((unsigned char) c < 0x20) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        s->p++;
+    }
+    return ESP_ERR_INVALID_ARG;
+}
+
+static esp_err_t scan_number(parser_t *s, const char **out, size_t *out_len, double *num)
+{
+    const char *start = s->p;
+    if (s->p < s->end && *s->p == '-') {
+        s->p++;
+    }
+    while (s->p < s->end && ((*s->p >= '0' && *s->p <= '9') || *s->p == '.' ||
+                             *s->p == 'e' || *s->p == 'E' || *s->p == '+' || *s->p == '-')) {
+        s->p++;
+    }
+    size_t len = s->p - start;
+    if (len == 0 || len >= NUMBER_BUF_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    char tmp[NUMBER_BUF_SIZE];
+    memcpy(tmp, start, len);
+    tmp[len] = '\0';
+    char *endp;
+    double val = strtod(tmp, &endp);
+    if (endp != tmp + len) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *out = start;
+    *out_len = len;
+    *num = val;
+    return ESP_OK;
+}
+
+static esp_err_t emit(parser_t *s, esp_json_type_t type, int depth,
+                      const char *key, size_t key_len,
+                      const char *value, size_t value_len,
+                      double number, bool boolean)
+{
+    esp_json_event_t event = {
+        .type = type,
+        .depth = depth,
+        .key = key,
+        .key_len = key_len,
+        .value = value,
+        .value_len = value_len,
+        .number = number,
+        .boolean = boolean,
+    };
+    return s->cb(&event, s->ctx);
+}
+
+static esp_err_t parse_value(parser_t *s, int depth, const char *key, size_t key_len);
+
+static esp_err_t parse_container(parser_t *s, int depth, const char *key, size_t key_len, bool is_object)
+{
+    if (depth >= MAX_DEPTH) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    esp_err_t err = emit(s, is_object ? ESP_JSON_OBJECT_BEGIN : ESP_JSON_ARRAY_BEGIN,
+                         depth, key, key_len, NULL, 0, 0, false);
+    if (err != ESP_OK) {
+        return err;
+    }
+    s->p++;    /* consume '{' or '[' */
+    skip_ws(s);
+    char close = is_object ? '}' : ']';
+    if (s->p < s->end && *s->p == close) {
+        s->p++;
+        return emit(s, is_object ? ESP_JSON_OBJECT_END : ESP_JSON_ARRAY_END,
+                    depth, key, key_len, NULL, 0, 0, false);
+    }
+    while (true) {
+        const char *member_key = NULL;
+        size_t member_key_len = 0;
+        if (is_object) {
+            skip_ws(s);
+            err = scan_string(s, &member_key, &member_key_len);
+            if (err != ESP_OK) {
+                return err;
+            }
+            skip_ws(s);
+            if (s->p >= s->end || *s->p != ':') {
+                return ESP_ERR_INVALID_ARG;
+            }
+            s->p++;
+        }
+        err = parse_value(s, depth + 1, member_key, member_key_len);
+        if (err != ESP_OK) {
+            return err;
+        }
+        skip_ws(s);
+        if (s->p >= s->end) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (*s->p == ',') {
+            s->p++;
+            continue;
+        }
+        if (*s->p == close) {
+            s->p++;
+            return emit(s, is_object ? ESP_JSON_OBJECT_END : ESP_JSON_ARRAY_END,
+                        depth, key, key_len, NULL, 0, 0, false);
+        }
+        return ESP_ERR_INVALID_ARG;
+    }
+}
+
+static esp_err_t parse_value(parser_t *s, int depth, const char *key, size_t key_len)
+{
+    skip_ws(s);
+    if (s->p >= s->end) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    switch (*s->p) {
+    case '{':
+        return parse_container(s, depth, key, key_len, true);
+    case '[':
+        return parse_container(s, depth, key, key_len, false);
+    case '"': {
+        const char *str;
+        size_t str_len;
+        esp_err_t err = scan_string(s, &str, &str_len);
+        if (err != ESP_OK) {
+            return err;
+        }
+        return emit(s, ESP_JSON_STRING, depth, key, key_len, str, str_len, 0, false);
+    }
+    case 't':
+        if (s->end - s->p < 4 || memcmp(s->p, "true", 4) != 0) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        s->p += 4;
+        return emit(s, ESP_JSON_BOOL, depth, key, key_len, NULL, 0, 0, true);
+    case 'f':
+        if (s->end - s->p < 5 || memcmp(s->p, "false", 5) != 0) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        s->p += 5;
+        return emit(s, ESP_JSON_BOOL, depth, key, key_len, NULL, 0, 0, false);
+    case 'n':
+        if (s->end - s->p < 4 || memcmp(s->p, "null", 4) != 0) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        s->p += 4;
+        return emit(s, ESP_JSON_NULL, depth, key, key_len, NULL, 0, 0, false);
+    default: {
+        const char *num;
+        size_t num_len;
+        double val;
+        esp_err_t err = scan_number(s, &num, &num_len, &val);
+        if (err != ESP_OK) {
+            return err;
+        }
+        return emit(s, ESP_JSON_NUMBER, depth, key, key_len, num, num_len, val, false);
+    }
+    }
+}
+
+esp_err_t esp_json_parse_stream(const char *buf, size_t len, esp_json_stream_cb_t cb, void *ctx)
+{
+    if (buf == NULL || cb == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    parser_t s = {
+        .p = buf,
+        .end = buf + len,
+        .cb = cb,
+        .ctx = ctx,
+    };
+    esp_err_t err = parse_value(&s, 0, NULL, 0);
+    if (err != ESP_OK) {
+        return err;
+    }
+    skip_ws(&s);
+    return (s.p == s.end) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+/* ------------------------------- arena DOM -------------------------------- */
+
+typedef struct {
+    uint8_t *arena;
+    size_t arena_size;
+    size_t offset;
+    esp_json_node_t *root;
+    /* Insertion point per depth: parent container and its last child */
+    esp_json_node_t *parents[MAX_DEPTH];
+    esp_json_node_t *tails[MAX_DEPTH];
+    int depth;
+} dom_builder_t;
+
+static esp_json_node_t *dom_alloc(dom_builder_t *b)
+{
+    size_t aligned = (b->offset + (sizeof(void *) - 1)) & ~(sizeof(void *) - 1);
+    if (aligned + sizeof(esp_json_node_t) > b->arena_size) {
+        return NULL;
+    }
+    esp_json_node_t *node = (esp_json_node_t *)(b->arena + aligned);
+    b->offset = aligned + sizeof(esp_json_node_t);
+    memset(node, 0, sizeof(*node));
+    return node;
+}
+
+static void dom_attach(dom_builder_t *b, esp_json_node_t *node)
+{
+    if (b->depth == 0) {
+        b->root = node;
+        return;
+    }
+    esp_json_node_t *tail = b->tails[b->depth - 1];
+    if (tail) {
+        tail->next = node;
+    } else {
+        b->parents[b->depth - 1]->child = node;
+    }
+    b->tails[b->depth - 1] = node;
+}
+
+static esp_err_t dom_build_cb(const esp_json_event_t *event, void *ctx)
+{
+    dom_builder_t *b = (dom_builder_t *) ctx;
+
+    if (event->type == ESP_JSON_OBJECT_END || event->type == ESP_JSON_ARRAY_END) {
+        b->depth--;
+        return ESP_OK;
+    }
+
+    esp_json_node_t *node = dom_alloc(b);
+    if (node == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    node->key = event->key;
+    node->key_len = event->key_len;
+    node->value = event->value;
+    node->value_len = event->value_len;
+    node->number = event->number;
+    node->boolean = event->boolean;
+
+    switch (event->type) {
+    case ESP_JSON_OBJECT_BEGIN:
+        node->type = ESP_JSON_OBJECT;
+        break;
+    case ESP_JSON_ARRAY_BEGIN:
+        node->type = ESP_JSON_ARRAY;
+        break;
+    default:
+        node->type = event->type;
+        break;
+    }
+
+    dom_attach(b, node);
+
+    if (node->type == ESP_JSON_OBJECT || node->type == ESP_JSON_ARRAY) {
+        b->parents[b->depth] = node;
+        b->tails[b->depth] = NULL;
+        b->depth++;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_json_parse_arena(const char *buf, size_t len,
+                               void *arena, size_t arena_size,
+                               esp_json_node_t **out_root)
+{
+    if (arena == NULL || out_root == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    dom_builder_t builder = {
+        .arena = (uint8_t *) arena,
+        .arena_size = arena_size,
+    };
+    esp_err_t err = esp_json_parse_stream(buf, len, dom_build_cb, &builder);
+    if (err != ESP_OK) {
+        return err;
+    }
+    *out_root = builder.root;
+    return ESP_OK;
+}
+
+esp_json_node_t *esp_json_object_get(const esp_json_node_t *object, const char *key)
+{
+    if (object == NULL || key == NULL || object->type != ESP_JSON_OBJECT) {
+        return NULL;
+    }
+    size_t key_len = strlen(key);
+    for (esp_json_node_t *node = object->child; node; node = node->next) {
+        if (node->key_len == key_len && memcmp(node->key, key, key_len) == 0) {
+            return node;
+        }
+    }
+    return NULL;
+}
+
+/* ------------------------------- unescaping ------------------------------- */
+
+static int hex_val(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+static int parse_u16(const char *p)
+{
+    int h0 = hex_val(p[0]), h1 = hex_val(p[1]), h2 = hex_val(p[2]), h3 = hex_val(p[3]);
+    if (h0 < 0 || h1 < 0 || h2 < 0 || h3 < 0) {
+        return -1;
+    }
+    return (h0 << 12) | (h1 << 8) | (h2 << 4) | h3;
+}
+
+static size_t utf8_encode(uint32_t cp, char *out)
+{
+    if (cp < 0x80) {
+        out[0] = (char) cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+esp_err_t esp_json_unescape(const char *raw, size_t raw_len,
+                            char *out, size_t out_size, size_t *out_len)
+{
+    size_t w = 0;
+    size_t i = 0;
+    while (i < raw_len) {
+        char c = raw[i];
+        char decoded[4];
+        size_t decoded_len;
+        if (c != '\\') {
+            decoded[0] = c;
+            decoded_len = 1;
+            i++;
+        } else {
+            if (i + 1 >= raw_len) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            char esc = raw[i + 1];
+            i += 2;
+            switch (esc) {
+            case '"':  decoded[0] = '"';  decoded_len = 1; break;
+            case '\\': decoded[0] = '\\'; decoded_len = 1; break;
+            case '/':  decoded[0] = '/';  decoded_len = 1; break;
+            case 'b':  decoded[0] = '\b'; decoded_len = 1; break;
+            case 'f':  decoded[0] = '\f'; decoded_len = 1; break;
+            case 'n':  decoded[0] = '\n'; decoded_len = 1; break;
+            case 'r':  decoded[0] = '\r'; decoded_len = 1; break;
+            case 't':  decoded[0] = '\t'; decoded_len = 1; break;
+            case 'u': {
+                if (i + 4 > raw_len) {
+                    return ESP_ERR_INVALID_ARG;
+                }
+                int unit = parse_u16(&raw[i]);
+                if (unit < 0) {
+                    return ESP_ERR_INVALID_ARG;
+                }
+                i += 4;
+                uint32_t cp = (uint32_t) unit;
+                if (cp >= 0xD800 && cp <= 0xDBFF) {
+                    /* High surrogate: a \uXXXX low surrogate must follow */
+                    if (i + 6 > raw_len || raw[i] != '\\' || raw[i + 1] != 'u') {
+                        return ESP_ERR_INVALID_ARG;
+                    }
+                    int low = parse_u16(&raw[i + 2]);
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        return ESP_ERR_INVALID_ARG;
+                    }
+                    i += 6;
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+                    return ESP_ERR_INVALID_ARG;
+                }
+                decoded_len = utf8_encode(cp, decoded);
+                break;
+            }
+            default:
+                return ESP_ERR_INVALID_ARG;
+            }
+        }
+        if (w + decoded_len >= out_size) {
+            return ESP_ERR_NO_MEM;
+        }
+        memcpy(out + w, decoded, decoded_len);
+        w += decoded_len;
+    }
+    if (w >= out_size) {
+        return ESP_ERR_NO_MEM;
+    }
+    out[w] = '\0';
+    if (out_len) {
+        *out_len = w;
+    }
+    return ESP_OK;
+}
+
+/* --------------------------------- writer --------------------------------- */
+
+esp_err_t esp_json_writer_init(esp_json_writer_t *w, char *buf, size_t size,
+                               esp_json_writer_flush_cb_t flush, void *flush_ctx)
+{
+    if (w == NULL || buf == NULL || size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    w->buf = buf;
+    w->size = size;
+    w->pos = 0;
+    w->flush = flush;
+    w->flush_ctx = flush_ctx;
+    w->comma_mask = 0;
+    w->depth = 0;
+    w->err = ESP_OK;
+    return ESP_OK;
+}
+
+static esp_err_t writer_drain(esp_json_writer_t *w)
+{
+    if (w->flush == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (w->pos > 0) {
+        esp_err_t err = w->flush(w->buf, w->pos, w->flush_ctx);
+        if (err != ESP_OK) {
+            return err;
+        }
+        w->pos = 0;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t writer_put(esp_json_writer_t *w, const char *data, size_t len)
+{
+    if (w->err != ESP_OK) {
+        return w->err;
+    }
+    while (len > 0) {
+        if (w->pos == w->size) {
+            w->err = writer_drain(w);
+            if (w->err != ESP_OK) {
+                return w->err;
+            }
+        }
+        size_t chunk = w->size - w->pos;
+        if (chunk > len) {
+            chunk = len;
+        }
+        memcpy(w->buf + w->pos, data, chunk);
+        w->pos += chunk;
+        data += chunk;
+        len -= chunk;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t writer_put_escaped(esp_json_writer_t *w, const char *str)
+{
+    esp_err_t err = writer_put(w, "\"", 1);
+    const char *run = str;
+    const char *p = str;
+    while (err == ESP_OK && *p) {
+        const char *esc = NULL;
+        char ubuf[8];
+        switch (*p) {
+        case '"':  esc = "\\\""; break;
+        case '\\': esc = "\\\\"; break;
+        case '\b': esc = "\\b";  break;
+        case '\f': esc = "\\f";  break;
+        case '\n': esc = "\\n";  break;
+        case '\r': esc = "\\r";  break;
+        case '\t': esc = "\\t";  break;
+        default:
+            if ((unsigned char) *p < 0x20) {
+                snprintf(ubuf, sizeof(ubuf), "\\u%04x", (unsigned char) *p);
+                esc = ubuf;
+            }
+            break;
+        }
+        if (esc) {
+            err = writer_put(w, run, p - run);
+            if (err == ESP_OK) {
+                err = writer_put(w, esc, strlen(esc));
+            }
+            run = p + 1;
+        }
+        p++;
+    }
+    if (err == ESP_OK) {
+        err = writer_put(w, run, p - run);
+    }
+    if (err == ESP_OK) {
+        err = writer_put(w, "\"", 1);
+    }
+    return err;
+}
+
+/* Emit the separating comma and optional "key": prefix of a new value */
+static esp_err_t writer_prefix(esp_json_writer_t *w, const char *key)
+{
+    esp_err_t err = ESP_OK;
+    if (w->depth > 0) {
+        uint32_t bit = 1u << (w->depth - 1);
+        if (w->comma_mask & bit) {
+            err = writer_put(w, ",", 1);
+        }
+        w->comma_mask |= bit;
+    }
+    if (err == ESP_OK && key != NULL) {
+        err = writer_put_escaped(w, key);
+        if (err == ESP_OK) {
+            err = writer_put(w, ":", 1);
+        }
+    }
+    return err;
+}
+
+static esp_err_t writer_container_begin(esp_json_writer_t *w, const char *key, char open)
+{
+    if (w->depth >= MAX_DEPTH) {
+        w->err = ESP_ERR_INVALID_SIZE;
+        return w->err;
+    }
+    esp_err_t err = writer_prefix(w, key);
+    if (err == ESP_OK) {
+        err = writer_put(w, &open, 1);
+    }
+    if (err == ESP_OK) {
+        w->comma_mask &= ~(1u << w->depth);
+        w->depth++;
+    }
+    return err;
+}
+
+static esp_err_t writer_container_end(esp_json_writer_t *w, char close)
+{
+    if (w->depth == 0) {
+        w->err = ESP_ERR_INVALID_STATE;
+        return w->err;
+    }
+    esp_err_t err = writer_put(w, &close, 1);
+    if (err == ESP_OK) {
+        w->depth--;
+    }
+    return err;
+}
+
+esp_err_t esp_json_writer_object_begin(esp_json_writer_t *w, const char *key)
+{
+    return writer_container_begin(w, key, '{');
+}
+
+esp_err_t esp_json_writer_object_end(esp_json_writer_t *w)
+{
+    return writer_container_end(w, '}');
+}
+
+esp_err_t esp_json_writer_array_begin(esp_json_writer_t *w, const char *key)
+{
+    return writer_container_begin(w, key, '[');
+}
+
+esp_err_t esp_json_writer_array_end(esp_json_writer_t *w)
+{
+    return writer_container_end(w, ']');
+}
+
+esp_err_t esp_json_writer_string(esp_json_writer_t *w, const char *key, const char *value)
+{
+    esp_err_t err = writer_prefix(w, key);
+    if (err == ESP_OK) {
+        err = writer_put_escaped(w, value);
+    }
+    return err;
+}
+
+esp_err_t esp_json_writer_int(esp_json_writer_t *w, const char *key, int64_t value)
+{
+    char tmp[24];
+    int len = snprintf(tmp, sizeof(tmp), "%lld", (long long) value);
+    esp_err_t err = writer_prefix(w, key);
+    if (err == ESP_OK) {
+        err = writer_put(w, tmp, len);
+    }
+    return err;
+}
+
+esp_err_t esp_json_writer_double(esp_json_writer_t *w, const char *key, double value)
+{
+    char tmp[32];
+    int len;
+    /* JSON has no representation for non-finite numbers; emit null as cJSON does */
+    if (isnan(value) || isinf(value)) {
+        len = snprintf(tmp, sizeof(tmp), "null");
+    } else {
+        len = snprintf(tmp, sizeof(tmp), "%.17g", value);
+    }
+    esp_err_t err = writer_prefix(w, key);
+    if (err == ESP_OK) {
+        err = writer_put(w, tmp, len);
+    }
+    return err;
+}
+
+esp_err_t esp_json_writer_bool(esp_json_writer_t *w, const char *key, bool value)
+{
+    esp_err_t err = writer_prefix(w, key);
+    if (err == ESP_OK) {
+        err = writer_put(w, value ? "true" : "false", value ? 4 : 5);
+    }
+    return err;
+}
+
+esp_err_t esp_json_writer_null(esp_json_writer_t *w, const char *key)
+{
+    esp_err_t err = writer_prefix(w, key);
+    if (err == ESP_OK) {
+        err = writer_put(w, "null", 4);
+    }
+    return err;
+}
+
+esp_err_t esp_json_writer_flush(esp_json_writer_t *w)
+{
+    if (w->err != ESP_OK) {
+        return w->err;
+    }
+    if (w->flush == NULL) {
+        return ESP_OK;
+    }
+    w->err = writer_drain(w);
+    return w->err;
+}
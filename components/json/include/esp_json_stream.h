@@ -0,0 +1,275 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file esp_json_stream.h
+ * @brief Allocation-free JSON parsing and generation
+ *
+ * cJSON builds a full node tree with one heap allocation per node, which for
+ * large configuration documents means thousands of small allocations and a
+ * peak heap footprint larger than the document itself. The API in this file
+ * offers two alternatives that perform no heap allocation at all:
+ *
+ *  - A streaming (SAX-style) parser that walks the document once and reports
+ *    each structural element through a callback. Strings and numbers are
+ *    passed as spans pointing into the input buffer.
+ *
+ *  - A DOM mode built on the streaming parser that places all nodes in a
+ *    caller-provided arena. Nodes reference string data in the input buffer,
+ *    so the input must stay valid while the tree is used.
+ *
+ * A matching writer emits JSON directly into a caller buffer and can flush
+ * through a callback, allowing generation straight into network buffers.
+ */
+
+/**
+ * @brief Type of a parse event or DOM node
+ */
+typedef enum {
+    ESP_JSON_OBJECT_BEGIN,  /*!< '{' encountered (event only) */
+    ESP_JSON_OBJECT_END,    /*!< '}' encountered (event only) */
+    ESP_JSON_ARRAY_BEGIN,   /*!< '[' encountered (event only) */
+    ESP_JSON_ARRAY_END,     /*!< ']' encountered (event only) */
+    ESP_JSON_OBJECT,        /*!< Object node (DOM only) */
+    ESP_JSON_ARRAY,         /*!< Array node (DOM only) */
+    ESP_JSON_STRING,        /*!< String value */
+    ESP_JSON_NUMBER,        /*!< Number value */
+    ESP_JSON_BOOL,          /*!< true or false */
+    ESP_JSON_NULL,          /*!< null */
+} esp_json_type_t;
+
+/**
+ * @brief One event reported by the streaming parser
+ *
+ * String spans are raw, i.e. escape sequences are not resolved; use
+ * esp_json_unescape() when the decoded form is needed.
+ */
+typedef struct {
+    esp_json_type_t type;   /*!< What was encountered */
+    int depth;              /*!< Nesting depth, 0 for the top level value */
+    const char *key;        /*!< Member name if inside an object, else NULL */
+    size_t key_len;         /*!< Length of key */
+    const char *value;      /*!< Raw span for STRING and NUMBER events */
+    size_t value_len;       /*!< Length of value */
+    double number;          /*!< Parsed value for NUMBER events */
+    bool boolean;           /*!< Value for BOOL events */
+} esp_json_event_t;
+
+/**
+ * @brief Streaming parser callback
+ *
+ * @return ESP_OK to continue parsing; any other value aborts the parse and
+ *         is returned from esp_json_parse_stream()
+ */
+typedef esp_err_t (*esp_json_stream_cb_t)(const esp_json_event_t *event, void *ctx);
+
+/**
+ * @brief Parse a JSON document, reporting each element through a callback
+ *
+ * Performs no allocation. The document must be completely contained in the
+ * given buffer; a NUL terminator is not required.
+ *
+ * @param buf Document text
+ * @param len Length of the document in bytes
+ * @param cb  Callback invoked for every event
+ * @param ctx Arbitrary pointer passed through to the callback
+ *
+ * @return
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_ARG if the document is malformed
+ *  - ESP_ERR_INVALID_SIZE if nesting exceeds the supported depth (32)
+ *  - any non-ESP_OK value returned by the callback
+ */
+esp_err_t esp_json_parse_stream(const char *buf, size_t len, esp_json_stream_cb_t cb, void *ctx);
+
+/**
+ * @brief Node of an arena-allocated JSON tree
+ *
+ * String spans point into the parsed input buffer and are not unescaped.
+ */
+typedef struct esp_json_node {
+    esp_json_type_t type;           /*!< Node type (OBJECT/ARRAY/STRING/NUMBER/BOOL/NULL) */
+    const char *key;                /*!< Member name if the parent is an object, else NULL */
+    size_t key_len;                 /*!< Length of key */
+    const char *value;              /*!< Raw span for STRING and NUMBER nodes */
+    size_t value_len;               /*!< Length of value */
+    double number;                  /*!< Parsed value for NUMBER nodes */
+    bool boolean;                   /*!< Value for BOOL nodes */
+    struct esp_json_node *child;    /*!< First child of an OBJECT or ARRAY node */
+    struct esp_json_node *next;     /*!< Next sibling */
+} esp_json_node_t;
+
+/**
+ * @brief Parse a JSON document into a tree allocated from a caller arena
+ *
+ * No heap allocation takes place; each node costs sizeof(esp_json_node_t)
+ * bytes of arena. The returned tree references string data inside buf, which
+ * must therefore outlive the tree.
+ *
+ * @param buf        Document text
+ * @param len        Length of the document in bytes
+ * @param arena      Memory to allocate nodes from
+ * @param arena_size Size of arena in bytes
+ * @param out_root   Set to the root node on success
+ *
+ * @return
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_ARG if the document is malformed
+ *  - ESP_ERR_NO_MEM if the arena is too small for the document
+ *  - ESP_ERR_INVALID_SIZE if nesting exceeds the supported depth (32)
+ */
+esp_err_t esp_json_parse_arena(const char *buf, size_t len,
+                               void *arena, size_t arena_size,
+                               esp_json_node_t **out_root);
+
+/**
+ * @brief Look up a member of an object node by name
+ *
+ * The name is compared against the raw (escaped) key span.
+ *
+ * @return The member node, or NULL if not found or node is not an object
+ */
+esp_json_node_t *esp_json_object_get(const esp_json_node_t *object, const char *key);
+
+/**
+ * @brief Resolve JSON escape sequences of a raw string span
+ *
+ * Handles the standard single-character escapes and \uXXXX (encoded as
+ * UTF-8, including surrogate pairs). The output is NUL terminated.
+ *
+ * @param raw      Raw span as reported by the parser
+ * @param raw_len  Length of the raw span
+ * @param out      Output buffer
+ * @param out_size Size of the output buffer
+ * @param out_len  Decoded length, excluding the terminator (may be NULL)
+ *
+ * @return
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_ARG on an invalid escape sequence
+ *  - ESP_ERR_NO_MEM if the output buffer is too small
+ */
+esp_err_t esp_json_unescape(const char *raw, size_t raw_len,
+                            char *out, size_t out_size, size_t *out_len);
+
+/**
+ * @brief Flush callback for the writer
+ *
+ * Called with a full buffer (or on explicit flush) so that the data can be
+ * handed to a socket or file. After the callback returns the buffer is
+ * reused.
+ *
+ * @return ESP_OK to continue; any other value aborts the write and is
+ *         reported by the writer functions
+ */
+typedef esp_err_t (*esp_json_writer_flush_cb_t)(const char *data, size_t len, void *ctx);
+
+/**
+ * @brief JSON writer state
+ *
+ * All members are private; initialize with esp_json_writer_init()
+ */
+typedef struct {
+    char *buf;                          /*!< Output buffer */
+    size_t size;                        /*!< Size of the output buffer */
+    size_t pos;                         /*!< Bytes currently buffered */
+    esp_json_writer_flush_cb_t flush;   /*!< Optional flush callback */
+    void *flush_ctx;                    /*!< Context for the flush callback */
+    uint32_t comma_mask;                /*!< Per-depth "value already emitted" flags */
+    int depth;                          /*!< Current nesting depth */
+    esp_err_t err;                      /*!< Sticky error */
+} esp_json_writer_t;
+
+/**
+ * @brief Initialize a writer over a caller-provided buffer
+ *
+ * If a flush callback is given, the buffer is drained through it whenever it
+ * fills up, so documents larger than the buffer can be produced. Without a
+ * callback the whole document must fit the buffer, otherwise the writer
+ * reports ESP_ERR_NO_MEM.
+ *
+ * @param w         Writer to initialize
+ * @param buf       Output buffer
+ * @param size      Size of the output buffer
+ * @param flush     Optional flush callback, may be NULL
+ * @param flush_ctx Context passed to the flush callback
+ */
+esp_err_t esp_json_writer_init(esp_json_writer_t *w, char *buf, size_t size,
+                               esp_json_writer_flush_cb_t flush, void *flush_ctx);
+
+/**
+ * @brief Begin an object: emits '{' (preceded by "key": inside an object)
+ *
+ * @param w   Writer
+ * @param key Member name, or NULL when not inside an object
+ */
+esp_err_t esp_json_writer_object_begin(esp_json_writer_t *w, const char *key);
+
+/**
+ * @brief End the current object: emits '}'
+ */
+esp_err_t esp_json_writer_object_end(esp_json_writer_t *w);
+
+/**
+ * @brief Begin an array: emits '[' (preceded by "key": inside an object)
+ */
+esp_err_t esp_json_writer_array_begin(esp_json_writer_t *w, const char *key);
+
+/**
+ * @brief End the current array: emits ']'
+ */
+esp_err_t esp_json_writer_array_end(esp_json_writer_t *w);
+
+/**
+ * @brief Emit a string value, escaping it as required
+ *
+ * @param w     Writer
+ * @param key   Member name, or NULL when not inside an object
+ * @param value String value, NUL terminated
+ */
+esp_err_t esp_json_writer_string(esp_json_writer_t *w, const char *key, const char *value);
+
+/**
+ * @brief Emit an integer value
+ */
+esp_err_t esp_json_writer_int(esp_json_writer_t *w, const char *key, int64_t value);
+
+/**
+ * @brief Emit a floating point value
+ */
+esp_err_t esp_json_writer_double(esp_json_writer_t *w, const char *key, double value);
+
+/**
+ * @brief Emit true or false
+ */
+esp_err_t esp_json_writer_bool(esp_json_writer_t *w, const char *key, bool value);
+
+/**
+ * @brief Emit null
+ */
+esp_err_t esp_json_writer_null(esp_json_writer_t *w, const char *key);
+
+/**
+ * @brief Drain buffered output through the flush callback
+ *
+ * Without a flush callback this is a no-op; the document remains in the
+ * buffer with length w->pos.
+ */
+esp_err_t esp_json_writer_flush(esp_json_writer_t *w);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <pthread.h>
+
+#include "esp_linux_cost_model.h"
+
+#define COST_MODEL_MAX_OPS      32
+#define COST_MODEL_MAX_OP_NAME  32
+
+typedef struct {
+    char name[COST_MODEL_MAX_OP_NAME];
+    uint64_t fixed_ns;
+    uint64_t per_byte_ns;
+    // accumulated since the last reset
+    uint64_t calls;
+    uint64_t bytes;
+    uint64_t charged_ns;
+} cost_model_op_t;
+
+static cost_model_op_t s_ops[COST_MODEL_MAX_OPS];
+static size_t s_op_count = 0;
+static uint64_t s_virtual_time_ns = 0;
+static uint64_t s_budget_deadline_ns = 0;
+static bool s_budget_armed = false;
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Find an operation slot by name, optionally creating it. Caller holds s_lock.
+static cost_model_op_t *s_find_op(const char *op_name, bool create)
+{
+    for (size_t i = 0; i < s_op_count; i++) {
+        if (strcmp(s_ops[i].name, op_name) == 0) {
+            return &s_ops[i];
+        }
+    }
+    if (!create || s_op_count >= COST_MODEL_MAX_OPS) {
+        return NULL;
+    }
+    cost_model_op_t *op = &s_ops[s_op_count++];
+    memset(op, 0, sizeof(*op));
+    snprintf(op->name, sizeof(op->name), "%s", op_name);
+    return op;
+}
+
+esp_err_t esp_linux_cost_model_set(const char *op_name, uint64_t fixed_ns, uint64_t per_byte_ns)
+{
+    if (op_name == NULL || op_name[0] == '\0') {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&s_lock);
+    cost_model_op_t *op = s_find_op(op_name, true);
+    if (op == NULL) {
+        pthread_mutex_unlock(&s_lock);
+        return ESP_ERR_NO_MEM;
+    }
+    op->fixed_ns = fixed_ns;
+    op->per_byte_ns = per_byte_ns;
+    pthread_mutex_unlock(&s_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_linux_cost_model_load(const char *path)
+{
+    if (path == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    esp_err_t ret = ESP_OK;
+    char line[128];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char name[COST_MODEL_MAX_OP_NAME];
+        uint64_t fixed_ns;
+        uint64_t per_byte_ns;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r' || line[0] == '\0') {
+            continue;
+        }
+        if (sscanf(line, "%31s %" SCNu64 " %" SCNu64, name, &fixed_ns, &per_byte_ns) != 3) {
+            ret = ESP_ERR_INVALID_ARG;
+            break;
+        }
+        ret = esp_linux_cost_model_set(name, fixed_ns, per_byte_ns);
+        if (ret != ESP_OK) {
+            break;
+        }
+    }
+    fclose(f);
+    return ret;
+}
+
+void esp_linux_cost_model_charge(const char *op_name, size_t bytes)
+{
+    if (op_name == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&s_lock);
+    cost_model_op_t *op = s_find_op(op_name, true);
+    if (op != NULL) {
+        uint64_t cost = op->fixed_ns + op->per_byte_ns * (uint64_t)bytes;
+        op->calls++;
+        op->bytes += bytes;
+        op->charged_ns += cost;
+        s_virtual_time_ns += cost;
+    }
+    pthread_mutex_unlock(&s_lock);
+}
+
+uint64_t esp_linux_cost_model_time_ns(void)
+{
+    pthread_mutex_lock(&s_lock);
+    uint64_t now = s_virtual_time_ns;
+    pthread_mutex_unlock(&s_lock);
+    return now;
+}
+
+void esp_linux_cost_model_reset(void)
+{
+    pthread_mutex_lock(&s_lock);
+    for (size_t i = 0; i < s_op_count; i++) {
+        s_ops[i].calls = 0;
+        s_ops[i].bytes = 0;
+        s_ops[i].charged_ns = 0;
+    }
+    s_virtual_time_ns = 0;
+    s_budget_armed = false;
+    s_budget_deadline_ns = 0;
+    pthread_mutex_unlock(&s_lock);
+}
+
+void esp_linux_cost_model_budget_set(uint64_t budget_ns)
+{
+    pthread_mutex_lock(&s_lock);
+    if (budget_ns == 0) {
+        s_budget_armed = false;
+        s_budget_deadline_ns = 0;
+    } else {
+        s_budget_armed = true;
+        s_budget_deadline_ns = s_virtual_time_ns + budget_ns;
+    }
+    pthread_mutex_unlock(&s_lock);
+}
+
+bool esp_linux_cost_model_budget_exceeded(void)
+{
+    pthread_mutex_lock(&s_lock);
+    bool exceeded = s_budget_armed && (s_virtual_time_ns > s_budget_deadline_ns);
+    pthread_mutex_unlock(&s_lock);
+    return exceeded;
+}
+
+void esp_linux_cost_model_report(void)
+{
+    pthread_mutex_lock(&s_lock);
+    printf("cost model: virtual time %" PRIu64 " ns\n", s_virtual_time_ns);
+    printf("%-31s %12s %12s %15s\n", "op", "calls", "bytes", "virtual ns");
+    for (size_t i = 0; i < s_op_count; i++) {
+        printf("%-31s %12" PRIu64 " %12" PRIu64 " %15" PRIu64 "\n",
+               s_ops[i].name, s_ops[i].calls, s_ops[i].bytes, s_ops[i].charged_ns);
+    }
+    pthread_mutex_unlock(&s_lock);
+}
@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * Cost model for the POSIX/Linux simulator.
+ *
+ * Host-side tests run at host speed, so they give no signal about how expensive an algorithm would
+ * be on a real chip. The cost model keeps a virtual clock: instrumented operations (flash access
+ * through the emulated esp_partition, or anything a test charges explicitly) advance it by modeled
+ * latencies, configurable per operation from a calibration file measured on target. A test can then
+ * put a budget on the virtual clock and fail when a code change blows through it — before anything
+ * touches hardware.
+ */
+
+/**
+ * @brief Load per-operation costs from a calibration file
+ *
+ * One operation per line: `<op_name> <fixed_ns> <per_byte_ns>`, blank lines and lines starting
+ * with `#` are ignored. Later lines override earlier ones, so a test-local file can refine a
+ * checked-in baseline.
+ *
+ * @param path Calibration file path
+ *
+ * @return
+ *        - ESP_OK:                  File loaded
+ *        - ESP_ERR_NOT_FOUND:       File could not be opened
+ *        - ESP_ERR_INVALID_ARG:     Null path or malformed line
+ *        - ESP_ERR_NO_MEM:          Operation table is full
+ */
+esp_err_t esp_linux_cost_model_load(const char *path);
+
+/**
+ * @brief Set the modeled cost of one operation programmatically
+ *
+ * @param op_name     Operation name, e.g. "flash_read"
+ * @param fixed_ns    Cost charged per call, in virtual nanoseconds
+ * @param per_byte_ns Additional cost charged per byte, in virtual nanoseconds
+ *
+ * @return
+ *        - ESP_OK:              On success
+ *        - ESP_ERR_INVALID_ARG: Null name
+ *        - ESP_ERR_NO_MEM:      Operation table is full
+ */
+esp_err_t esp_linux_cost_model_set(const char *op_name, uint64_t fixed_ns, uint64_t per_byte_ns);
+
+/**
+ * @brief Charge one operation to the virtual clock
+ *
+ * Operations without a configured cost are still counted (visible in the report) but advance the
+ * clock by zero, so instrumentation callsites cost nothing until a calibration is loaded.
+ *
+ * @param op_name Operation name
+ * @param bytes   Payload size the per-byte cost applies to, 0 for pure per-call operations
+ */
+void esp_linux_cost_model_charge(const char *op_name, size_t bytes);
+
+/**
+ * @brief Get the virtual clock, i.e. the sum of all charged costs since the last reset
+ *
+ * @return Virtual time in nanoseconds
+ */
+uint64_t esp_linux_cost_model_time_ns(void);
+
+/**
+ * @brief Reset the virtual clock, all per-operation counters and the budget
+ *
+ * Configured costs are kept. Call between test cases.
+ */
+void esp_linux_cost_model_reset(void);
+
+/**
+ * @brief Set a budget on the virtual clock, counted from now
+ *
+ * @param budget_ns Budget in virtual nanoseconds, 0 disables budget checking
+ */
+void esp_linux_cost_model_budget_set(uint64_t budget_ns);
+
+/**
+ * @brief Check whether the virtual clock passed the budget set by `esp_linux_cost_model_budget_set`
+ *
+ * @return true if a budget is armed and has been exceeded
+ */
+bool esp_linux_cost_model_budget_exceeded(void);
+
+/**
+ * @brief Print a per-operation breakdown (calls, bytes, virtual time) to stdout
+ */
+void esp_linux_cost_model_report(void);
+
+#ifdef __cplusplus
+}
+#endif
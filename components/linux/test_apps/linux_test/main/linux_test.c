@@ -8,6 +8,7 @@
 #include "unity_test_runner.h"
 #include "unity_test_utils_memory.h"
 #include "esp_log.h"
+#include "esp_linux_cost_model.h"
 #include <strings.h>
 
 static const char* TAG = "event_test_app";
@@ -44,6 +45,29 @@ TEST_CASE("fls(0x80000000) = 32", "[fls]")
     TEST_ASSERT_EQUAL(32, fls(0x80000000));
 }
 
+TEST_CASE("cost model charges virtual time and trips the budget", "[cost_model]")
+{
+    esp_linux_cost_model_reset();
+    TEST_ASSERT_EQUAL(0, esp_linux_cost_model_time_ns());
+
+    // uncalibrated ops are counted but free
+    esp_linux_cost_model_charge("flash_read", 4096);
+    TEST_ASSERT_EQUAL(0, esp_linux_cost_model_time_ns());
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linux_cost_model_set("flash_read", 1000, 10));
+    esp_linux_cost_model_charge("flash_read", 100);
+    TEST_ASSERT_EQUAL_UINT64(1000 + 10 * 100, esp_linux_cost_model_time_ns());
+
+    esp_linux_cost_model_budget_set(3000);
+    TEST_ASSERT_FALSE(esp_linux_cost_model_budget_exceeded());
+    esp_linux_cost_model_charge("flash_read", 1000);    // 11000 ns, far past the budget
+    TEST_ASSERT_TRUE(esp_linux_cost_model_budget_exceeded());
+
+    esp_linux_cost_model_reset();
+    TEST_ASSERT_EQUAL(0, esp_linux_cost_model_time_ns());
+    TEST_ASSERT_FALSE(esp_linux_cost_model_budget_exceeded());
+}
+
 void app_main(void)
 {
     ESP_LOGI(TAG, "Running linux test app");
@@ -57,6 +57,26 @@ void esp_log_write(esp_log_level_t level, const char* tag, const char* format, .
  */
 void esp_log_writev(esp_log_level_t level, const char* tag, const char* format, va_list args);
 
+#if CONFIG_LOG_FORMAT_DEDUP
+/**
+ * @brief Write message into the log, rendering the prefix and trailer at runtime
+ *
+ * Used by the log macros when CONFIG_LOG_FORMAT_DEDUP is enabled. `format` is the bare
+ * user format string without the pasted prefix (color, level letter, timestamp, tag) and
+ * without a trailing newline; both are emitted from strings shared by all call sites.
+ *
+ * This function is not intended to be used directly. Instead, use one of
+ * ESP_LOGE, ESP_LOGW, ESP_LOGI, ESP_LOGD, ESP_LOGV macros.
+ */
+void esp_log_write_dedup(esp_log_level_t level, const char* tag, const char* format, ...) __attribute__((format(printf, 3, 4)));
+
+/**
+ * @brief Write message into the log, va_list variant
+ * @see esp_log_write_dedup()
+ */
+void esp_log_writev_dedup(esp_log_level_t level, const char* tag, const char* format, va_list args);
+#endif // CONFIG_LOG_FORMAT_DEDUP
+
 /** @cond */
 
 #define LOG_FORMAT(letter, format)  LOG_COLOR_ ## letter #letter " (%" PRIu32 ") %s: " format LOG_RESET_COLOR "\n"
@@ -158,6 +178,16 @@ void esp_log_writev(esp_log_level_t level, const char* tag, const char* format,
  *
  * @see ``printf``
  */
+#if CONFIG_LOG_FORMAT_DEDUP
+// The prefix (color, level letter, timestamp, tag) and trailer are rendered at runtime from
+// per-level strings shared by all call sites, so the literal passed here stays bare and the
+// linker can merge identical and tail-duplicate format strings across translation units.
+#if defined(__cplusplus) && (__cplusplus >  201703L)
+#define ESP_LOG_LEVEL(level, tag, format, ...) esp_log_write_dedup(level, tag, format __VA_OPT__(,) __VA_ARGS__)
+#else // !(defined(__cplusplus) && (__cplusplus >  201703L))
+#define ESP_LOG_LEVEL(level, tag, format, ...) esp_log_write_dedup(level, tag, format, ##__VA_ARGS__)
+#endif // !(defined(__cplusplus) && (__cplusplus >  201703L))
+#else // !CONFIG_LOG_FORMAT_DEDUP
 #if defined(__cplusplus) && (__cplusplus >  201703L)
 #if CONFIG_LOG_TIMESTAMP_SOURCE_RTOS
 #define ESP_LOG_LEVEL(level, tag, format, ...) do {                     \
@@ -195,6 +225,7 @@ void esp_log_writev(esp_log_level_t level, const char* tag, const char* format,
     } while(0)
 #endif //CONFIG_LOG_TIMESTAMP_SOURCE_xxx
 #endif // !(defined(__cplusplus) && (__cplusplus >  201703L))
+#endif // !CONFIG_LOG_FORMAT_DEDUP
 
 /** runtime macro to output logs at a specified level. Also check the level with ``LOG_LOCAL_LEVEL``.
  * If ``CONFIG_LOG_MASTER_LEVEL`` set, also check first against ``esp_log_get_level_master()``.
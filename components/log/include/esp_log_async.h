@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * Asynchronous log sink.
+ *
+ * Messages are formatted on the calling task, appended to a ring buffer and
+ * written to the console by a background drain task, so logging tasks do not
+ * wait for the wire. The actual transport is whatever the output callback
+ * writes to; the default callback writes to stdout, which reaches the UART or
+ * USB-Serial-JTAG console driver when one is installed and can drain the
+ * bytes from interrupt or DMA context.
+ */
+
+/**
+ * @brief Output callback of the asynchronous log sink
+ *
+ * Called from the drain task, or from the calling context after
+ * esp_log_async_enter_sync_mode(). May block.
+ *
+ * @param data  bytes to output
+ * @param size  number of bytes
+ * @return number of bytes consumed, negative on error
+ */
+typedef int (*esp_log_async_write_fn_t)(const char* data, size_t size);
+
+/**
+ * @brief Install the asynchronous log sink
+ *
+ * Replaces the log output function (see esp_log_set_vprintf) with one that
+ * appends the formatted message to a ring buffer, and starts the drain task.
+ * Messages which do not fit into the ring are dropped and accounted for with
+ * a "dropped N bytes" line in the output.
+ *
+ * @param output  output callback, or NULL to write to stdout
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if the sink is already installed
+ *      - ESP_ERR_NO_MEM if task or semaphore allocation fails
+ */
+esp_err_t esp_log_async_init(esp_log_async_write_fn_t output);
+
+/**
+ * @brief Remove the asynchronous log sink
+ *
+ * Restores the previous log output function and stops the drain task after
+ * the remaining buffered bytes have been written out.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if the sink is not installed
+ */
+esp_err_t esp_log_async_deinit(void);
+
+/**
+ * @brief Write out all buffered log bytes from the calling context
+ *
+ * Does not rely on the drain task or the scheduler, so it may be called from
+ * a panic or shutdown handler to get the backlog onto the wire.
+ */
+void esp_log_async_flush(void);
+
+/**
+ * @brief Flush and fall back to synchronous logging
+ *
+ * After this call, messages bypass the ring buffer and are written out
+ * directly from the logging context. Intended for panic and shutdown
+ * handlers, where the drain task no longer runs; there is no way back to
+ * asynchronous mode short of esp_log_async_deinit()/init().
+ */
+void esp_log_async_enter_sync_mode(void);
+
+#ifdef __cplusplus
+}
+#endif
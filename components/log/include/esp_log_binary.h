@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * Deferred binary logging backend.
+ *
+ * Instead of running printf-style formatting on the calling task, the binary
+ * backend records the address of the format string (format strings live in
+ * flash, so the address is a stable identifier) together with the raw
+ * argument values into a ring buffer. A background task drains the ring
+ * through a byte-oriented output callback, and the records are formatted
+ * host-side by tools/esp_log_decode.py using the application ELF file.
+ *
+ * Stream format, all values little-endian:
+ *
+ *   frame     := 0xA5 <payload_len u8> <format_addr u32> <args...>
+ *   int arg   := 4 bytes (8 bytes for "ll", "j" and floating point arguments)
+ *   str arg   := <len u8> <bytes...>  ("%s", truncated to 255 bytes)
+ *
+ * A frame with format_addr == 0 is a drop marker; its payload is a u32 count
+ * of records which were lost to ring overflow or unsupported formats.
+ */
+
+/**
+ * @brief Output callback draining the binary log stream
+ *
+ * Called from the drain task. May block.
+ *
+ * @param data  bytes to output
+ * @param size  number of bytes
+ * @return number of bytes consumed, negative on error
+ */
+typedef int (*esp_log_binary_write_fn_t)(const uint8_t* data, size_t size);
+
+/**
+ * @brief Install the binary logging backend
+ *
+ * Replaces the log output function (see esp_log_set_vprintf) with one that
+ * records format address and arguments into the ring buffer, and starts the
+ * drain task.
+ *
+ * @param output  output callback, or NULL to write the raw stream to stdout
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if the backend is already installed
+ *      - ESP_ERR_NO_MEM if task or semaphore allocation fails
+ */
+esp_err_t esp_log_binary_init(esp_log_binary_write_fn_t output);
+
+/**
+ * @brief Remove the binary logging backend
+ *
+ * Restores the previous log output function and stops the drain task after
+ * the remaining buffered records have been written out.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if the backend is not installed
+ */
+esp_err_t esp_log_binary_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
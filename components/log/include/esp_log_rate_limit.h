@@ -0,0 +1,43 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Set a token-bucket rate limit for log messages with the given tag
+ *
+ * Messages which exceed the rate are dropped instead of being formatted and
+ * written out; the next message that passes is preceded by a one-line
+ * "suppressed N messages" summary. Rate limiting is applied after the log
+ * level check, so messages filtered by level do not consume tokens.
+ *
+ * Like esp_log_level_set(), the special tag "*" sets a default which applies
+ * to every tag without its own limit.
+ *
+ * @param tag  log tag, or "*" for the default limit. The string is copied.
+ * @param messages_per_sec  sustained rate in messages per second;
+ *                          0 removes the limit for the tag
+ * @param burst_size  bucket capacity: number of messages that may be emitted
+ *                    back to back after a quiet period. Values below 1 are
+ *                    treated as 1.
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if tag is NULL
+ *      - ESP_ERR_NO_MEM if the entry cannot be allocated
+ */
+esp_err_t esp_log_rate_limit_set(const char* tag, uint32_t messages_per_sec, uint32_t burst_size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,31 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Take one token from the rate limit bucket of the given tag
+ *
+ * Called on the log write path after the level check.
+ *
+ * @param tag  log tag of the message
+ * @param[out] out_suppressed  number of messages suppressed for this bucket
+ *                             since the last one passed; the caller prints
+ *                             the summary
+ * @return true if the message may be emitted, false if it has to be dropped
+ */
+bool esp_log_rate_limit_acquire(const char* tag, uint32_t* out_suppressed);
+
+#ifdef __cplusplus
+}
+#endif
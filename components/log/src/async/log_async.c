@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_log_async.h"
+#include "sdkconfig.h"
+
+#define MAX_MESSAGE_SIZE    256
+#define DRAIN_CHUNK_SIZE    128
+#define DRAIN_IDLE_TICKS    pdMS_TO_TICKS(100)
+
+static char s_ring[CONFIG_LOG_ASYNC_BUFFER_SIZE];
+static size_t s_ring_head;          // next byte to write
+static size_t s_ring_tail;          // next byte to read
+static size_t s_ring_used;
+static uint32_t s_dropped_bytes;
+static portMUX_TYPE s_ring_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static volatile TaskHandle_t s_drain_task;
+static SemaphoreHandle_t s_data_sem;
+static volatile bool s_drain_exit;
+static volatile bool s_sync_mode;
+static esp_log_async_write_fn_t s_output;
+static vprintf_like_t s_prev_vprintf;
+
+static int s_default_output(const char* data, size_t size)
+{
+    return (int) fwrite(data, 1, size, stdout);
+}
+
+// Pop up to out_size buffered bytes. If bytes were dropped since the last
+// call, a notice line is emitted first.
+static size_t s_ring_pop(char* out, size_t out_size)
+{
+    size_t len = 0;
+    portENTER_CRITICAL_SAFE(&s_ring_lock);
+    if (s_dropped_bytes != 0) {
+        int n = snprintf(out, out_size, "\nW log_async: dropped %u bytes\n",
+                         (unsigned) s_dropped_bytes);
+        if (n > 0 && (size_t) n < out_size) {
+            s_dropped_bytes = 0;
+            len = (size_t) n;
+        }
+    }
+    size_t copy = MIN(s_ring_used, out_size - len);
+    for (size_t i = 0; i < copy; ++i) {
+        out[len + i] = s_ring[s_ring_tail];
+        s_ring_tail = (s_ring_tail + 1) % sizeof(s_ring);
+    }
+    s_ring_used -= copy;
+    len += copy;
+    portEXIT_CRITICAL_SAFE(&s_ring_lock);
+    return len;
+}
+
+static int s_log_async_vprintf(const char* format, va_list args)
+{
+    char buf[MAX_MESSAGE_SIZE];
+    int formatted = vsnprintf(buf, sizeof(buf), format, args);
+    if (formatted <= 0) {
+        return formatted;
+    }
+    size_t len = MIN((size_t) formatted, sizeof(buf) - 1);
+    if (s_sync_mode) {
+        return s_output(buf, len);
+    }
+    bool stored = false;
+    portENTER_CRITICAL_SAFE(&s_ring_lock);
+    if (sizeof(s_ring) - s_ring_used >= len) {
+        size_t contig = sizeof(s_ring) - s_ring_head;
+        if (contig >= len) {
+            memcpy(&s_ring[s_ring_head], buf, len);
+        } else {
+            memcpy(&s_ring[s_ring_head], buf, contig);
+            memcpy(&s_ring[0], buf + contig, len - contig);
+        }
+        s_ring_head = (s_ring_head + len) % sizeof(s_ring);
+        s_ring_used += len;
+        stored = true;
+    } else {
+        s_dropped_bytes += len;
+    }
+    portEXIT_CRITICAL_SAFE(&s_ring_lock);
+    if (stored && s_data_sem != NULL) {
+        if (xPortInIsrContext()) {
+            BaseType_t task_woken = pdFALSE;
+            xSemaphoreGiveFromISR(s_data_sem, &task_woken);
+            if (task_woken == pdTRUE) {
+                portYIELD_FROM_ISR();
+            }
+        } else {
+            xSemaphoreGive(s_data_sem);
+        }
+    }
+    return (int) len;
+}
+
+static void s_drain_task_fn(void* arg)
+{
+    char chunk[DRAIN_CHUNK_SIZE];
+    while (true) {
+        xSemaphoreTake(s_data_sem, DRAIN_IDLE_TICKS);
+        size_t len;
+        while (!s_sync_mode && (len = s_ring_pop(chunk, sizeof(chunk))) != 0) {
+            s_output(chunk, len);
+        }
+        if (s_drain_exit) {
+            break;
+        }
+    }
+    s_drain_task = NULL;
+    vTaskDelete(NULL);
+}
+
+void esp_log_async_flush(void)
+{
+    char chunk[DRAIN_CHUNK_SIZE];
+    size_t len;
+    while ((len = s_ring_pop(chunk, sizeof(chunk))) != 0) {
+        s_output(chunk, len);
+    }
+}
+
+void esp_log_async_enter_sync_mode(void)
+{
+    s_sync_mode = true;
+    esp_log_async_flush();
+}
+
+esp_err_t esp_log_async_init(esp_log_async_write_fn_t output)
+{
+    if (s_drain_task != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_output = (output != NULL) ? output : &s_default_output;
+    s_data_sem = xSemaphoreCreateBinary();
+    if (s_data_sem == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_drain_exit = false;
+    s_sync_mode = false;
+    TaskHandle_t task;
+    if (xTaskCreate(s_drain_task_fn, "log_async", CONFIG_LOG_ASYNC_TASK_STACK_SIZE,
+                    NULL, CONFIG_LOG_ASYNC_TASK_PRIORITY, &task) != pdTRUE) {
+        vSemaphoreDelete(s_data_sem);
+        s_data_sem = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    s_drain_task = task;
+    s_prev_vprintf = esp_log_set_vprintf(&s_log_async_vprintf);
+    return ESP_OK;
+}
+
+esp_err_t esp_log_async_deinit(void)
+{
+    if (s_drain_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_log_set_vprintf(s_prev_vprintf);
+    // the drain task writes out the remaining bytes, then deletes itself
+    s_drain_exit = true;
+    xSemaphoreGive(s_data_sem);
+    while (s_drain_task != NULL) {
+        vTaskDelay(1);
+    }
+    vSemaphoreDelete(s_data_sem);
+    s_data_sem = NULL;
+    return ESP_OK;
+}
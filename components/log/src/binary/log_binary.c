@@ -0,0 +1,307 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_log_binary.h"
+#include "sdkconfig.h"
+
+#define FRAME_SYNC          0xA5
+#define FRAME_HEADER_SIZE   6       // sync + payload_len + format_addr
+#define FRAME_MAX_PAYLOAD   255
+#define DRAIN_CHUNK_SIZE    128
+#define DRAIN_IDLE_TICKS    pdMS_TO_TICKS(100)
+
+static uint8_t s_ring[CONFIG_LOG_BINARY_BUFFER_SIZE];
+static size_t s_ring_head;          // next byte to write
+static size_t s_ring_tail;          // next byte to read
+static size_t s_ring_used;
+static uint32_t s_dropped;
+static portMUX_TYPE s_ring_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static volatile TaskHandle_t s_drain_task;
+static SemaphoreHandle_t s_data_sem;
+static volatile bool s_drain_exit;
+static esp_log_binary_write_fn_t s_output;
+static vprintf_like_t s_prev_vprintf;
+
+static int s_default_output(const uint8_t* data, size_t size)
+{
+    return (int) fwrite(data, 1, size, stdout);
+}
+
+static inline bool s_emit(uint8_t* out, size_t out_size, size_t* pos, const void* src, size_t len)
+{
+    if (*pos + len > out_size) {
+        return false;
+    }
+    memcpy(out + *pos, src, len);
+    *pos += len;
+    return true;
+}
+
+// Walk the conversion specifications of the format string and append the
+// matching raw argument values to the frame. Returns false if the frame
+// would overflow or an unsupported conversion is encountered; the record
+// is then dropped as a whole so the stream stays decodable.
+static bool s_encode_args(const char* format, va_list args, uint8_t* out, size_t out_size, size_t* pos)
+{
+    for (const char* p = format; *p != '\0'; ++p) {
+        if (*p != '%') {
+            continue;
+        }
+        ++p;
+        if (*p == '%') {
+            continue;
+        }
+        while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') {
+            ++p;
+        }
+        if (*p == '*') {
+            uint32_t w = (uint32_t) va_arg(args, int);
+            if (!s_emit(out, out_size, pos, &w, 4)) {
+                return false;
+            }
+            ++p;
+        } else {
+            while (*p >= '0' && *p <= '9') {
+                ++p;
+            }
+        }
+        if (*p == '.') {
+            ++p;
+            if (*p == '*') {
+                uint32_t prec = (uint32_t) va_arg(args, int);
+                if (!s_emit(out, out_size, pos, &prec, 4)) {
+                    return false;
+                }
+                ++p;
+            } else {
+                while (*p >= '0' && *p <= '9') {
+                    ++p;
+                }
+            }
+        }
+        int longs = 0;
+        bool is_64bit = false;
+        while (*p == 'l') {
+            ++longs;
+            ++p;
+        }
+        while (*p == 'h') {
+            ++p;
+        }
+        if (*p == 'z' || *p == 't') {
+            ++p;
+        } else if (*p == 'j') {
+            is_64bit = true;
+            ++p;
+        }
+        if (longs >= 2) {
+            is_64bit = true;
+        }
+        switch (*p) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+        case 'c':
+            if (is_64bit) {
+                uint64_t v = (uint64_t) va_arg(args, unsigned long long);
+                if (!s_emit(out, out_size, pos, &v, 8)) {
+                    return false;
+                }
+            } else {
+                uint32_t v = (longs == 1) ? (uint32_t) va_arg(args, unsigned long)
+                             : (uint32_t) va_arg(args, unsigned int);
+                if (!s_emit(out, out_size, pos, &v, 4)) {
+                    return false;
+                }
+            }
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A': {
+            double v = va_arg(args, double);
+            if (!s_emit(out, out_size, pos, &v, 8)) {
+                return false;
+            }
+            break;
+        }
+        case 'p': {
+            uint32_t v = (uint32_t) (uintptr_t) va_arg(args, void*);
+            if (!s_emit(out, out_size, pos, &v, 4)) {
+                return false;
+            }
+            break;
+        }
+        case 's': {
+            const char* s = va_arg(args, const char*);
+            if (s == NULL) {
+                s = "(null)";
+            }
+            size_t len = strnlen(s, FRAME_MAX_PAYLOAD);
+            uint8_t len8 = (uint8_t) len;
+            if (!s_emit(out, out_size, pos, &len8, 1) ||
+                    !s_emit(out, out_size, pos, s, len)) {
+                return false;
+            }
+            break;
+        }
+        default:
+            // unknown conversion: the argument layout cannot be determined
+            return false;
+        }
+    }
+    return true;
+}
+
+static void s_ring_push(const uint8_t* frame, size_t len)
+{
+    bool stored = false;
+    portENTER_CRITICAL_SAFE(&s_ring_lock);
+    if (sizeof(s_ring) - s_ring_used >= len) {
+        size_t contig = sizeof(s_ring) - s_ring_head;
+        if (contig >= len) {
+            memcpy(&s_ring[s_ring_head], frame, len);
+        } else {
+            memcpy(&s_ring[s_ring_head], frame, contig);
+            memcpy(&s_ring[0], frame + contig, len - contig);
+        }
+        s_ring_head = (s_ring_head + len) % sizeof(s_ring);
+        s_ring_used += len;
+        stored = true;
+    } else {
+        ++s_dropped;
+    }
+    portEXIT_CRITICAL_SAFE(&s_ring_lock);
+    if (stored && s_data_sem != NULL) {
+        if (xPortInIsrContext()) {
+            BaseType_t task_woken = pdFALSE;
+            xSemaphoreGiveFromISR(s_data_sem, &task_woken);
+            if (task_woken == pdTRUE) {
+                portYIELD_FROM_ISR();
+            }
+        } else {
+            xSemaphoreGive(s_data_sem);
+        }
+    }
+}
+
+static int s_log_binary_vprintf(const char* format, va_list args)
+{
+    uint8_t frame[FRAME_HEADER_SIZE + FRAME_MAX_PAYLOAD];
+    size_t pos = FRAME_HEADER_SIZE;
+    if (!s_encode_args(format, args, frame, sizeof(frame), &pos)) {
+        portENTER_CRITICAL_SAFE(&s_ring_lock);
+        ++s_dropped;
+        portEXIT_CRITICAL_SAFE(&s_ring_lock);
+        return 0;
+    }
+    uint32_t format_addr = (uint32_t) (uintptr_t) format;
+    frame[0] = FRAME_SYNC;
+    frame[1] = (uint8_t) (pos - 2);     // payload: format_addr + args
+    memcpy(&frame[2], &format_addr, 4);
+    s_ring_push(frame, pos);
+    return (int) pos;
+}
+
+// Pop up to out_size buffered bytes. If records were dropped since the last
+// call, a drop marker frame is emitted first.
+static size_t s_ring_pop(uint8_t* out, size_t out_size)
+{
+    size_t len = 0;
+    portENTER_CRITICAL_SAFE(&s_ring_lock);
+    if (s_dropped != 0 && out_size >= FRAME_HEADER_SIZE + 4) {
+        out[0] = FRAME_SYNC;
+        out[1] = 8;                     // format_addr (0) + drop count
+        memset(&out[2], 0, 4);
+        memcpy(&out[6], &s_dropped, 4);
+        s_dropped = 0;
+        len = FRAME_HEADER_SIZE + 4;
+    }
+    size_t copy = MIN(s_ring_used, out_size - len);
+    for (size_t i = 0; i < copy; ++i) {
+        out[len + i] = s_ring[s_ring_tail];
+        s_ring_tail = (s_ring_tail + 1) % sizeof(s_ring);
+    }
+    s_ring_used -= copy;
+    len += copy;
+    portEXIT_CRITICAL_SAFE(&s_ring_lock);
+    return len;
+}
+
+static void s_drain_task_fn(void* arg)
+{
+    uint8_t chunk[DRAIN_CHUNK_SIZE];
+    while (true) {
+        xSemaphoreTake(s_data_sem, DRAIN_IDLE_TICKS);
+        size_t len;
+        while ((len = s_ring_pop(chunk, sizeof(chunk))) != 0) {
+            s_output(chunk, len);
+        }
+        if (s_drain_exit) {
+            break;
+        }
+    }
+    s_drain_task = NULL;
+    vTaskDelete(NULL);
+}
+
+esp_err_t esp_log_binary_init(esp_log_binary_write_fn_t output)
+{
+    if (s_drain_task != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_output = (output != NULL) ? output : &s_default_output;
+    s_data_sem = xSemaphoreCreateBinary();
+    if (s_data_sem == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_drain_exit = false;
+    TaskHandle_t task;
+    if (xTaskCreate(s_drain_task_fn, "log_binary", CONFIG_LOG_BINARY_TASK_STACK_SIZE,
+                    NULL, CONFIG_LOG_BINARY_TASK_PRIORITY, &task) != pdTRUE) {
+        vSemaphoreDelete(s_data_sem);
+        s_data_sem = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    s_drain_task = task;
+    s_prev_vprintf = esp_log_set_vprintf(&s_log_binary_vprintf);
+    return ESP_OK;
+}
+
+esp_err_t esp_log_binary_deinit(void)
+{
+    if (s_drain_task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_log_set_vprintf(s_prev_vprintf);
+    // the drain task writes out the remaining records, then deletes itself
+    s_drain_exit = true;
+    xSemaphoreGive(s_data_sem);
+    while (s_drain_task != NULL) {
+        vTaskDelay(1);
+    }
+    vSemaphoreDelete(s_data_sem);
+    s_data_sem = NULL;
+    return ESP_OK;
+}
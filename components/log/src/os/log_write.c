@@ -13,8 +13,27 @@
 #include "esp_private/log_level.h"
 #include "sdkconfig.h"
 
+#if CONFIG_LOG_RATE_LIMIT || CONFIG_LOG_FORMAT_DEDUP
+#include <inttypes.h>
+#include "esp_log_timestamp.h"
+#endif
+#if CONFIG_LOG_RATE_LIMIT
+#include "esp_private/log_rate_limit.h"
+#endif
+
 static vprintf_like_t s_log_print_func = &vprintf;
 
+#if CONFIG_LOG_RATE_LIMIT || CONFIG_LOG_FORMAT_DEDUP
+static int s_log_printf(const char *format, ...)
+{
+    va_list list;
+    va_start(list, format);
+    int ret = (*s_log_print_func)(format, list);
+    va_end(list);
+    return ret;
+}
+#endif
+
 vprintf_like_t esp_log_set_vprintf(vprintf_like_t func)
 {
     esp_log_impl_lock();
@@ -31,6 +50,16 @@ void esp_log_writev(esp_log_level_t level,
 {
     esp_log_level_t level_for_tag = esp_log_level_get_timeout(tag);
     if (ESP_LOG_NONE != level_for_tag && level <= level_for_tag) {
+#if CONFIG_LOG_RATE_LIMIT
+        uint32_t suppressed;
+        if (!esp_log_rate_limit_acquire(tag, &suppressed)) {
+            return;
+        }
+        if (suppressed != 0) {
+            s_log_printf("W (%" PRIu32 ") %s: rate limit: suppressed %" PRIu32 " messages\n",
+                         esp_log_timestamp(), tag, suppressed);
+        }
+#endif
         (*s_log_print_func)(format, args);
     }
 }
@@ -44,3 +73,60 @@ void esp_log_write(esp_log_level_t level,
     esp_log_writev(level, tag, format, list);
     va_end(list);
 }
+
+#if CONFIG_LOG_FORMAT_DEDUP
+// One prefix string per level, shared by every call site instead of being
+// pasted into each format string literal
+static const char *const s_dedup_level_str[] = {
+    [ESP_LOG_ERROR]   = LOG_COLOR_E "E",
+    [ESP_LOG_WARN]    = LOG_COLOR_W "W",
+    [ESP_LOG_INFO]    = LOG_COLOR_I "I",
+    [ESP_LOG_DEBUG]   = LOG_COLOR_D "D",
+    [ESP_LOG_VERBOSE] = LOG_COLOR_V "V",
+};
+
+void esp_log_writev_dedup(esp_log_level_t level,
+                          const char *tag,
+                          const char *format,
+                          va_list args)
+{
+    esp_log_level_t level_for_tag = esp_log_level_get_timeout(tag);
+    if (ESP_LOG_NONE == level_for_tag || level > level_for_tag) {
+        return;
+    }
+#if CONFIG_LOG_RATE_LIMIT
+    uint32_t suppressed;
+    if (!esp_log_rate_limit_acquire(tag, &suppressed)) {
+        return;
+    }
+    if (suppressed != 0) {
+        s_log_printf("W (%" PRIu32 ") %s: rate limit: suppressed %" PRIu32 " messages\n",
+                     esp_log_timestamp(), tag, suppressed);
+    }
+#endif
+    if (level < ESP_LOG_ERROR || level > ESP_LOG_VERBOSE) {
+        level = ESP_LOG_INFO;
+    }
+    // hold the log lock so the prefix, body and trailer of one message don't
+    // interleave with messages written from other tasks
+    esp_log_impl_lock();
+#if CONFIG_LOG_TIMESTAMP_SOURCE_SYSTEM
+    s_log_printf("%s (%s) %s: ", s_dedup_level_str[level], esp_log_system_timestamp(), tag);
+#else
+    s_log_printf("%s (%" PRIu32 ") %s: ", s_dedup_level_str[level], esp_log_timestamp(), tag);
+#endif
+    (*s_log_print_func)(format, args);
+    s_log_printf(LOG_RESET_COLOR "\n");
+    esp_log_impl_unlock();
+}
+
+void esp_log_write_dedup(esp_log_level_t level,
+                         const char *tag,
+                         const char *format, ...)
+{
+    va_list list;
+    va_start(list, format);
+    esp_log_writev_dedup(level, tag, format, list);
+    va_end(list);
+}
+#endif // CONFIG_LOG_FORMAT_DEDUP
@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log_rate_limit.h"
+#include "esp_log_timestamp.h"
+#include "esp_private/log_rate_limit.h"
+#include "sdkconfig.h"
+
+// Token counts are kept in thousandths, so sub-1 msg/s refill amounts per
+// millisecond do not round away
+#define TOKEN_SCALE 1000
+
+typedef struct rate_limit_entry {
+    struct rate_limit_entry* next;
+    const char* tag;            // copied at esp_log_rate_limit_set time
+    uint32_t rate;              // messages per second
+    uint32_t capacity_m;        // bucket capacity, in TOKEN_SCALE units
+    uint32_t tokens_m;          // available tokens, in TOKEN_SCALE units
+    uint32_t last_refill_ms;
+    uint32_t suppressed;
+} rate_limit_entry_t;
+
+static rate_limit_entry_t* s_entries;
+static portMUX_TYPE s_rate_limit_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Must be called with s_rate_limit_lock held
+static rate_limit_entry_t* s_find_entry(const char* tag)
+{
+    rate_limit_entry_t* fallback = NULL;
+    for (rate_limit_entry_t* it = s_entries; it != NULL; it = it->next) {
+        if (strcmp(it->tag, tag) == 0) {
+            return it;
+        }
+        if (it->tag[0] == '*' && it->tag[1] == '\0') {
+            fallback = it;
+        }
+    }
+    return fallback;
+}
+
+bool esp_log_rate_limit_acquire(const char* tag, uint32_t* out_suppressed)
+{
+    bool allowed = true;
+    *out_suppressed = 0;
+    uint32_t now = esp_log_timestamp();
+    portENTER_CRITICAL_SAFE(&s_rate_limit_lock);
+    rate_limit_entry_t* entry = s_find_entry(tag);
+    if (entry != NULL) {
+        uint32_t elapsed_ms = now - entry->last_refill_ms;
+        // cap the elapsed time first so the refill product cannot overflow
+        uint32_t full_after_ms = entry->capacity_m / entry->rate + 1;
+        if (elapsed_ms >= full_after_ms) {
+            entry->tokens_m = entry->capacity_m;
+        } else {
+            entry->tokens_m = MIN(entry->tokens_m + elapsed_ms * entry->rate, entry->capacity_m);
+        }
+        entry->last_refill_ms = now;
+        if (entry->tokens_m >= TOKEN_SCALE) {
+            entry->tokens_m -= TOKEN_SCALE;
+            *out_suppressed = entry->suppressed;
+            entry->suppressed = 0;
+        } else {
+            entry->suppressed++;
+            allowed = false;
+        }
+    }
+    portEXIT_CRITICAL_SAFE(&s_rate_limit_lock);
+    return allowed;
+}
+
+esp_err_t esp_log_rate_limit_set(const char* tag, uint32_t messages_per_sec, uint32_t burst_size)
+{
+    if (tag == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (burst_size < 1) {
+        burst_size = 1;
+    }
+
+    // update or remove an existing entry for this exact tag first
+    rate_limit_entry_t* to_free = NULL;
+    bool handled = false;
+    portENTER_CRITICAL_SAFE(&s_rate_limit_lock);
+    rate_limit_entry_t* prev = NULL;
+    for (rate_limit_entry_t* it = s_entries; it != NULL; prev = it, it = it->next) {
+        if (strcmp(it->tag, tag) != 0) {
+            continue;
+        }
+        if (messages_per_sec == 0) {
+            // unlink; free outside the critical section
+            if (prev != NULL) {
+                prev->next = it->next;
+            } else {
+                s_entries = it->next;
+            }
+            to_free = it;
+        } else {
+            it->rate = messages_per_sec;
+            it->capacity_m = burst_size * TOKEN_SCALE;
+            it->tokens_m = it->capacity_m;
+            it->last_refill_ms = esp_log_timestamp();
+            it->suppressed = 0;
+        }
+        handled = true;
+        break;
+    }
+    portEXIT_CRITICAL_SAFE(&s_rate_limit_lock);
+    if (to_free != NULL) {
+        free((void*) to_free->tag);
+        free(to_free);
+    }
+    if (handled || messages_per_sec == 0) {
+        return ESP_OK;
+    }
+
+    rate_limit_entry_t* new_entry = calloc(1, sizeof(*new_entry));
+    if (new_entry == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    new_entry->tag = strdup(tag);
+    if (new_entry->tag == NULL) {
+        free(new_entry);
+        return ESP_ERR_NO_MEM;
+    }
+    new_entry->rate = messages_per_sec;
+    new_entry->capacity_m = burst_size * TOKEN_SCALE;
+    new_entry->tokens_m = new_entry->capacity_m;
+    new_entry->last_refill_ms = esp_log_timestamp();
+    portENTER_CRITICAL_SAFE(&s_rate_limit_lock);
+    new_entry->next = s_entries;
+    s_entries = new_entry;
+    portEXIT_CRITICAL_SAFE(&s_rate_limit_lock);
+    return ESP_OK;
+}
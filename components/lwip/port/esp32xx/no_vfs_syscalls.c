@@ -11,6 +11,8 @@
 #include <sys/lock.h>
 #include <sys/fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <unistd.h>
 #include "sdkconfig.h"
 #include "lwip/sockets.h"
 #include "lwip/sys.h"
@@ -69,6 +71,32 @@ int select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *errorfds, struct
     return lwip_select(nfds, readfds, writefds, errorfds, timeout);
 }
 
+int writev(int s, const struct iovec *iov, int iovcnt)
+{
+    if (s >= LWIP_SOCKET_OFFSET) {
+        /* Sockets take the vectored fast path: the whole iovec traverses the
+         * tcpip mailbox in a single message instead of one round-trip per
+         * buffer, and tcp_write() coalesces the pieces into full segments. */
+        return lwip_writev(s, iov, iovcnt);
+    }
+    /* Not a socket: emulate with sequential writes */
+    int total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        ssize_t written = write(s, iov[i].iov_base, iov[i].iov_len);
+        if (written < 0) {
+            return (total > 0) ? total : -1;
+        }
+        total += written;
+        if ((size_t)written < iov[i].iov_len) {
+            break;
+        }
+    }
+    return total;
+}
+
 void esp_vfs_lwip_sockets_register(void)
 {
     /* Doesn't register anything, just a hook to force linking this file */
@@ -10,6 +10,8 @@
 #include <sys/errno.h>
 #include <sys/lock.h>
 #include <sys/fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
 #include "esp_attr.h"
 #include "esp_vfs.h"
 #include "sdkconfig.h"
@@ -71,6 +73,32 @@ static int lwip_ioctl_r_wrapper(int fd, int cmd, va_list args)
     return lwip_ioctl(fd, cmd, va_arg(args, void *));
 }
 
+int writev(int s, const struct iovec *iov, int iovcnt)
+{
+    if (s >= LWIP_SOCKET_OFFSET) {
+        /* Sockets take the vectored fast path: the whole iovec traverses the
+         * tcpip mailbox in a single message instead of one round-trip per
+         * buffer, and tcp_write() coalesces the pieces into full segments. */
+        return lwip_writev(s, iov, iovcnt);
+    }
+    /* Not a socket: emulate with sequential writes */
+    int total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        ssize_t written = write(s, iov[i].iov_base, iov[i].iov_len);
+        if (written < 0) {
+            return (total > 0) ? total : -1;
+        }
+        total += written;
+        if ((size_t)written < iov[i].iov_len) {
+            break;
+        }
+    }
+    return total;
+}
+
 static int lwip_fstat(int fd, struct stat * st)
 {
     if (st == NULL || fd < LWIP_SOCKET_OFFSET || fd > (MAX_FDS - 1)) {
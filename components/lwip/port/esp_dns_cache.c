@@ -0,0 +1,223 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+#include "esp_attr.h"
+#include "esp_dns_cache.h"
+#include "freertos/FreeRTOS.h"
+#include "lwip/dns.h"
+#include "lwip/tcpip.h"
+#include "lwip/timeouts.h"
+
+#define ESP_DNS_CACHE_HOSTNAME_LEN      64
+#define DNS_CACHE_MAGIC                 0x444e5343  /* "DNSC" */
+/* Interval of the prefetch check; expiry is tracked in whole seconds so a
+ * finer grid buys nothing */
+#define DNS_CACHE_PREFETCH_INTERVAL_MS  10000
+
+typedef struct {
+    char name[ESP_DNS_CACHE_HOSTNAME_LEN];  /* Empty string marks a free slot */
+    ip_addr_t addr;
+    time_t expiry;                          /* Absolute UTC time the entry becomes stale */
+    uint32_t ttl_sec;                       /* Lifetime applied on each (re-)resolution */
+    bool critical;                          /* Kept resolved by the prefetch, never evicted */
+} dns_cache_entry_t;
+
+/* The table lives in RTC memory so that it survives deep sleep; the magic
+ * word guards against the undefined contents after a power-on reset */
+static RTC_DATA_ATTR uint32_t s_dns_cache_magic;
+static RTC_DATA_ATTR dns_cache_entry_t s_dns_cache[CONFIG_LWIP_DNS_PERSISTENT_CACHE_ENTRIES];
+
+static portMUX_TYPE s_dns_cache_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool s_prefetch_running;
+
+static void dns_cache_ensure_valid(void)
+{
+    if (s_dns_cache_magic != DNS_CACHE_MAGIC) {
+        memset(s_dns_cache, 0, sizeof(s_dns_cache));
+        s_dns_cache_magic = DNS_CACHE_MAGIC;
+    }
+}
+
+/* Must be called with s_dns_cache_lock held */
+static dns_cache_entry_t *dns_cache_find(const char *name)
+{
+    for (int i = 0; i < CONFIG_LWIP_DNS_PERSISTENT_CACHE_ENTRIES; i++) {
+        if (s_dns_cache[i].name[0] != '\0' && strcasecmp(s_dns_cache[i].name, name) == 0) {
+            return &s_dns_cache[i];
+        }
+    }
+    return NULL;
+}
+
+/* Must be called with s_dns_cache_lock held */
+static dns_cache_entry_t *dns_cache_find_victim(time_t now)
+{
+    dns_cache_entry_t *victim = NULL;
+    for (int i = 0; i < CONFIG_LWIP_DNS_PERSISTENT_CACHE_ENTRIES; i++) {
+        dns_cache_entry_t *entry = &s_dns_cache[i];
+        if (entry->name[0] == '\0') {
+            return entry;
+        }
+        if (entry->critical) {
+            continue;
+        }
+        if (entry->expiry <= now) {
+            return entry;
+        }
+        if (victim == NULL || entry->expiry < victim->expiry) {
+            victim = entry;
+        }
+    }
+    return victim;
+}
+
+esp_err_t esp_dns_cache_lookup(const char *name, ip_addr_t *addr)
+{
+    if (name == NULL || addr == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    time_t now = time(NULL);
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+
+    portENTER_CRITICAL(&s_dns_cache_lock);
+    dns_cache_ensure_valid();
+    dns_cache_entry_t *entry = dns_cache_find(name);
+    if (entry != NULL && entry->expiry > now) {
+        ip_addr_copy(*addr, entry->addr);
+        ret = ESP_OK;
+    }
+    portEXIT_CRITICAL(&s_dns_cache_lock);
+    return ret;
+}
+
+static esp_err_t dns_cache_insert(const char *name, const ip_addr_t *addr,
+                                  uint32_t ttl_sec, bool critical)
+{
+    if (name == NULL || name[0] == '\0' || strlen(name) >= ESP_DNS_CACHE_HOSTNAME_LEN) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    time_t now = time(NULL);
+    esp_err_t ret = ESP_OK;
+
+    portENTER_CRITICAL(&s_dns_cache_lock);
+    dns_cache_ensure_valid();
+    dns_cache_entry_t *entry = dns_cache_find(name);
+    if (entry == NULL) {
+        entry = dns_cache_find_victim(now);
+    }
+    if (entry == NULL) {
+        ret = ESP_ERR_NO_MEM;
+    } else {
+        strlcpy(entry->name, name, sizeof(entry->name));
+        entry->ttl_sec = ttl_sec;
+        entry->critical = entry->critical || critical;
+        if (addr != NULL) {
+            ip_addr_copy(entry->addr, *addr);
+            entry->expiry = now + ttl_sec;
+        } else if (!critical) {
+            entry->expiry = 0;
+        }
+    }
+    portEXIT_CRITICAL(&s_dns_cache_lock);
+    return ret;
+}
+
+esp_err_t esp_dns_cache_add(const char *name, const ip_addr_t *addr, uint32_t ttl_sec)
+{
+    if (addr == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return dns_cache_insert(name, addr, ttl_sec, false);
+}
+
+esp_err_t esp_dns_cache_register_critical(const char *name, uint32_t ttl_sec)
+{
+    /* The entry starts without an address (expiry 0), so the next prefetch
+     * pass resolves it */
+    return dns_cache_insert(name, NULL, ttl_sec, true);
+}
+
+/* Runs in tcpip thread context */
+static void dns_cache_prefetch_found(const char *name, const ip_addr_t *ipaddr, void *callback_arg)
+{
+    LWIP_UNUSED_ARG(callback_arg);
+    if (ipaddr == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_dns_cache_lock);
+    dns_cache_entry_t *entry = dns_cache_find(name);
+    if (entry != NULL) {
+        ip_addr_copy(entry->addr, *ipaddr);
+        entry->expiry = time(NULL) + entry->ttl_sec;
+    }
+    portEXIT_CRITICAL(&s_dns_cache_lock);
+}
+
+/* Runs in tcpip thread context */
+static void dns_cache_prefetch_check(void *arg)
+{
+    LWIP_UNUSED_ARG(arg);
+    if (!s_prefetch_running) {
+        return;
+    }
+    time_t now = time(NULL);
+
+    for (int i = 0; i < CONFIG_LWIP_DNS_PERSISTENT_CACHE_ENTRIES; i++) {
+        char name[ESP_DNS_CACHE_HOSTNAME_LEN];
+        bool resolve = false;
+
+        portENTER_CRITICAL(&s_dns_cache_lock);
+        dns_cache_ensure_valid();
+        dns_cache_entry_t *entry = &s_dns_cache[i];
+        if (entry->name[0] != '\0' && entry->critical &&
+                entry->expiry <= now + CONFIG_LWIP_DNS_PERSISTENT_CACHE_PREFETCH_LEAD) {
+            strlcpy(name, entry->name, sizeof(name));
+            resolve = true;
+        }
+        portEXIT_CRITICAL(&s_dns_cache_lock);
+
+        if (resolve) {
+            ip_addr_t addr;
+            err_t err = dns_gethostbyname(name, &addr, dns_cache_prefetch_found, NULL);
+            if (err == ERR_OK) {
+                /* Answered from lwIP's own table; no callback will fire */
+                dns_cache_prefetch_found(name, &addr, NULL);
+            }
+        }
+    }
+    sys_timeout(DNS_CACHE_PREFETCH_INTERVAL_MS, dns_cache_prefetch_check, NULL);
+}
+
+/* Runs in tcpip thread context */
+static void dns_cache_prefetch_ctrl(void *arg)
+{
+    bool start = (bool)(uintptr_t)arg;
+    if (start == s_prefetch_running) {
+        return;
+    }
+    s_prefetch_running = start;
+    if (start) {
+        dns_cache_prefetch_check(NULL);
+    } else {
+        sys_untimeout(dns_cache_prefetch_check, NULL);
+    }
+}
+
+esp_err_t esp_dns_cache_prefetch_start(void)
+{
+    return (tcpip_callback(dns_cache_prefetch_ctrl, (void *)(uintptr_t)true) == ERR_OK) ?
+           ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_dns_cache_prefetch_stop(void)
+{
+    return (tcpip_callback(dns_cache_prefetch_ctrl, (void *)(uintptr_t)false) == ERR_OK) ?
+           ESP_OK : ESP_FAIL;
+}
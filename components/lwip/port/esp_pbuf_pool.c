@@ -0,0 +1,174 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/**
+ * @file Packet buffer pool allocator
+ *
+ * lwIP is configured with MEM_LIBC_MALLOC/MEMP_MEM_MALLOC, so every pbuf
+ * allocation normally goes through the shared heap and contends on the heap
+ * lock with every application task. This allocator front-ends
+ * mem_clib_malloc()/mem_clib_free() with a preallocated set of DMA-capable
+ * slabs: requests that fit in a slab are served from a small per-core cache
+ * backed by a shared free list, everything else falls through to the heap
+ * unchanged. Slabs are recognized on free by address range, so the two
+ * allocators can be mixed freely.
+ */
+#include <string.h>
+#include <stdlib.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_pbuf_pool.h"
+
+#define ESP_PBUF_POOL_ALIGN          16
+#define ESP_PBUF_POOL_SLAB_SIZE      ((CONFIG_LWIP_PBUF_POOL_BUFSIZE + ESP_PBUF_POOL_ALIGN - 1) \
+                                      & ~(ESP_PBUF_POOL_ALIGN - 1))
+/* Requests below this size are control blocks, not packets: a slab would
+ * waste most of its space on them, so they stay on the heap. */
+#define ESP_PBUF_POOL_MIN_ALLOC      (ESP_PBUF_POOL_SLAB_SIZE / 4)
+/* Slabs kept aside per core before spilling into the shared free list */
+#define ESP_PBUF_POOL_CORE_CACHE_LEN 4
+
+static const char *TAG = "pbuf_pool";
+
+typedef struct esp_pbuf_pool_slab {
+    struct esp_pbuf_pool_slab *next;
+} esp_pbuf_pool_slab_t;
+
+static uint8_t *s_pool_arena;
+static esp_pbuf_pool_slab_t *s_pool_free_list;
+static portMUX_TYPE s_pool_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static esp_pbuf_pool_slab_t *s_core_cache[portNUM_PROCESSORS][ESP_PBUF_POOL_CORE_CACHE_LEN];
+static uint32_t s_core_cache_len[portNUM_PROCESSORS];
+static portMUX_TYPE s_core_lock[portNUM_PROCESSORS] = {
+    [0 ... portNUM_PROCESSORS - 1] = portMUX_INITIALIZER_UNLOCKED
+};
+
+/* Fallback for oversized requests and pool exhaustion, mirroring the
+ * placement lwIP would use without the pool (see mem_clib_* in lwipopts.h) */
+#if CONFIG_SPIRAM_TRY_ALLOCATE_WIFI_LWIP
+#define pool_fallback_malloc(size)    heap_caps_malloc_prefer(size, 2, MALLOC_CAP_DEFAULT|MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT|MALLOC_CAP_INTERNAL)
+#define pool_fallback_calloc(n, size) heap_caps_calloc_prefer(n, size, 2, MALLOC_CAP_DEFAULT|MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT|MALLOC_CAP_INTERNAL)
+#else
+#define pool_fallback_malloc  malloc
+#define pool_fallback_calloc  calloc
+#endif
+
+void esp_pbuf_pool_init(void)
+{
+    if (s_pool_arena != NULL) {
+        return;
+    }
+    uint8_t *arena = heap_caps_malloc((size_t)CONFIG_LWIP_PBUF_POOL_COUNT * ESP_PBUF_POOL_SLAB_SIZE,
+                                      MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (arena == NULL) {
+        ESP_LOGW(TAG, "no memory for %d x %d pool, falling back to heap",
+                 CONFIG_LWIP_PBUF_POOL_COUNT, ESP_PBUF_POOL_SLAB_SIZE);
+        return;
+    }
+    esp_pbuf_pool_slab_t *head = NULL;
+    for (int i = 0; i < CONFIG_LWIP_PBUF_POOL_COUNT; i++) {
+        esp_pbuf_pool_slab_t *slab = (esp_pbuf_pool_slab_t *)(arena + (size_t)i * ESP_PBUF_POOL_SLAB_SIZE);
+        slab->next = head;
+        head = slab;
+    }
+    portENTER_CRITICAL(&s_pool_lock);
+    s_pool_free_list = head;
+    s_pool_arena = arena;
+    portEXIT_CRITICAL(&s_pool_lock);
+}
+
+static inline bool pool_owns(void *ptr)
+{
+    return (s_pool_arena != NULL) && ((uint8_t *)ptr >= s_pool_arena) &&
+           ((uint8_t *)ptr < s_pool_arena + (size_t)CONFIG_LWIP_PBUF_POOL_COUNT * ESP_PBUF_POOL_SLAB_SIZE);
+}
+
+static esp_pbuf_pool_slab_t *pool_take_slab(void)
+{
+    /* The cache of the core we happen to run on is effectively uncontended:
+     * the spinlock only guards against preemption and task migration */
+    int core = xPortGetCoreID();
+    esp_pbuf_pool_slab_t *slab = NULL;
+
+    portENTER_CRITICAL(&s_core_lock[core]);
+    if (s_core_cache_len[core] > 0) {
+        slab = s_core_cache[core][--s_core_cache_len[core]];
+    }
+    portEXIT_CRITICAL(&s_core_lock[core]);
+    if (slab != NULL) {
+        return slab;
+    }
+
+    portENTER_CRITICAL(&s_pool_lock);
+    slab = s_pool_free_list;
+    if (slab != NULL) {
+        s_pool_free_list = slab->next;
+    }
+    portEXIT_CRITICAL(&s_pool_lock);
+    return slab;
+}
+
+static void pool_return_slab(esp_pbuf_pool_slab_t *slab)
+{
+    int core = xPortGetCoreID();
+    bool cached = false;
+
+    portENTER_CRITICAL(&s_core_lock[core]);
+    if (s_core_cache_len[core] < ESP_PBUF_POOL_CORE_CACHE_LEN) {
+        s_core_cache[core][s_core_cache_len[core]++] = slab;
+        cached = true;
+    }
+    portEXIT_CRITICAL(&s_core_lock[core]);
+    if (cached) {
+        return;
+    }
+
+    portENTER_CRITICAL(&s_pool_lock);
+    slab->next = s_pool_free_list;
+    s_pool_free_list = slab;
+    portEXIT_CRITICAL(&s_pool_lock);
+}
+
+void *esp_pbuf_pool_malloc(size_t size)
+{
+    if ((size >= ESP_PBUF_POOL_MIN_ALLOC) && (size <= ESP_PBUF_POOL_SLAB_SIZE) && (s_pool_arena != NULL)) {
+        void *slab = pool_take_slab();
+        if (slab != NULL) {
+            return slab;
+        }
+    }
+    return pool_fallback_malloc(size);
+}
+
+void *esp_pbuf_pool_calloc(size_t n, size_t size)
+{
+    size_t total = n * size;
+    if ((size != 0) && (total / size != n)) {
+        return NULL;
+    }
+    if ((total >= ESP_PBUF_POOL_MIN_ALLOC) && (total <= ESP_PBUF_POOL_SLAB_SIZE) && (s_pool_arena != NULL)) {
+        void *slab = pool_take_slab();
+        if (slab != NULL) {
+            memset(slab, 0, total);
+            return slab;
+        }
+    }
+    return pool_fallback_calloc(n, size);
+}
+
+void esp_pbuf_pool_free(void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+    if (pool_owns(ptr)) {
+        pool_return_slab((esp_pbuf_pool_slab_t *)ptr);
+        return;
+    }
+    free(ptr);
+}
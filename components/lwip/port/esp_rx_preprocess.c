@@ -0,0 +1,283 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/**
+ * @file Receive pre-processing worker
+ *
+ * The tcpip thread is single-core, so on dual-core chips one core saturates
+ * under heavy ingest while the other idles. This worker runs on the core the
+ * TCP/IP task is not pinned to and performs the per-packet work that does not
+ * need stack state: link/IP header parsing and software checksum
+ * verification. Corrupt frames are dropped before they reach the stack, and
+ * the per-netif checksum checks the worker has already performed are disabled
+ * inside the TCP/IP thread, so those cycles move off the core running lwIP.
+ *
+ * Transport checksums of fragmented datagrams can only be verified after
+ * reassembly, so when IP reassembly is compiled in only the IP header check
+ * is offloaded and the stack keeps verifying TCP/UDP itself.
+ */
+#include <stdbool.h>
+#include "lwip/opt.h"
+#include "lwip/pbuf.h"
+#include "lwip/netif.h"
+#include "lwip/inet_chksum.h"
+#include "lwip/ip4_addr.h"
+#include "lwip/ip6_addr.h"
+#include "lwip/prot/ethernet.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/ip6.h"
+#include "lwip/prot/udp.h"
+#include "lwip/prot/iana.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_log.h"
+#include "esp_rx_preprocess.h"
+
+/* Transport checksums are only offloaded when every TCP/UDP payload is
+ * verifiable per-frame, i.e. no datagram is reassembled inside the stack */
+#define RX_PRE_CHECK_L4         (!IP_REASSEMBLY && !LWIP_IPV6_REASS)
+
+#define RX_PRE_TASK_STACK_SIZE  3072
+#define RX_PRE_TASK_PRIO        TCPIP_THREAD_PRIO
+#if CONFIG_LWIP_TCPIP_TASK_AFFINITY_CPU1
+#define RX_PRE_TASK_CORE        0
+#else
+#define RX_PRE_TASK_CORE        1
+#endif
+
+static const char *TAG = "rx_pre";
+
+typedef struct {
+    struct pbuf *p;
+    struct netif *netif;
+} rx_pre_item_t;
+
+static QueueHandle_t s_rx_pre_queue;
+
+/* The per-netif checksum checks the worker takes over from the stack */
+static u16_t rx_pre_offloaded_checks(void)
+{
+    u16_t flags = 0;
+#if CHECKSUM_CHECK_IP
+    flags |= NETIF_CHECKSUM_CHECK_IP;
+#endif
+#if RX_PRE_CHECK_L4
+#if CHECKSUM_CHECK_TCP
+    flags |= NETIF_CHECKSUM_CHECK_TCP;
+#endif
+#if CHECKSUM_CHECK_UDP
+    flags |= NETIF_CHECKSUM_CHECK_UDP;
+#endif
+#endif
+    return flags;
+}
+
+#if RX_PRE_CHECK_L4
+/* Verify the pseudo-header checksum of a TCP/UDP payload starting l4_off
+ * bytes into the frame. The payload offset is known to lie within the first
+ * pbuf, so pbuf_remove_header() cannot fail. */
+static bool rx_pre_l4_chksum_ok(struct pbuf *p, u8_t proto, u16_t l4_off, u16_t l4_len,
+                                const ip4_addr_t *src4, const ip4_addr_t *dest4
+#if LWIP_IPV6
+                                , const ip6_addr_t *src6, const ip6_addr_t *dest6
+#endif
+                               )
+{
+    u16_t chksum;
+    pbuf_remove_header(p, l4_off);
+#if LWIP_IPV6
+    if (src4 == NULL) {
+        chksum = ip6_chksum_pseudo_partial(p, proto, l4_len, l4_len, src6, dest6);
+    } else
+#endif
+    {
+        chksum = inet_chksum_pseudo_partial(p, proto, l4_len, l4_len, src4, dest4);
+    }
+    pbuf_add_header(p, l4_off);
+    return chksum == 0;
+}
+#endif /* RX_PRE_CHECK_L4 */
+
+/* Returns false if the frame failed a checksum the stack will no longer
+ * verify and must be dropped. Frames the worker cannot parse (non-IP,
+ * malformed, headers not contained in the first pbuf) are passed through:
+ * the stack accounts for and drops them with its usual diagnostics. */
+static bool rx_pre_validate(struct pbuf *p)
+{
+    if (p->len < SIZEOF_ETH_HDR) {
+        return true;
+    }
+    const struct eth_hdr *ethhdr = (const struct eth_hdr *)p->payload;
+
+    if (ethhdr->type == PP_HTONS(ETHTYPE_IP)) {
+        if (p->len < SIZEOF_ETH_HDR + IP_HLEN) {
+            return true;
+        }
+        const struct ip_hdr *iphdr = (const struct ip_hdr *)((const u8_t *)p->payload + SIZEOF_ETH_HDR);
+        u16_t hlen = IPH_HL_BYTES(iphdr);
+        u16_t tot_len = lwip_ntohs(IPH_LEN(iphdr));
+        if (IPH_V(iphdr) != 4 || hlen < IP_HLEN || tot_len < hlen ||
+            p->len < SIZEOF_ETH_HDR + hlen || p->tot_len < SIZEOF_ETH_HDR + tot_len) {
+            return true;
+        }
+#if CHECKSUM_CHECK_IP
+        if (inet_chksum((void *)iphdr, hlen) != 0) {
+            return false;
+        }
+#endif
+#if RX_PRE_CHECK_L4
+        if ((IPH_OFFSET(iphdr) & PP_HTONS(IP_OFFMASK | IP_MF)) != 0) {
+            /* without reassembly a fragment never reaches TCP/UDP input */
+            return true;
+        }
+        u8_t proto = IPH_PROTO(iphdr);
+        u16_t l4_off = SIZEOF_ETH_HDR + hlen;
+        u16_t l4_len = tot_len - hlen;
+        ip4_addr_t src, dest;
+        ip4_addr_copy(src, iphdr->src);
+        ip4_addr_copy(dest, iphdr->dest);
+#if CHECKSUM_CHECK_TCP
+        if (proto == IP_PROTO_TCP) {
+            return rx_pre_l4_chksum_ok(p, proto, l4_off, l4_len, &src, &dest
+#if LWIP_IPV6
+                                       , NULL, NULL
+#endif
+                                      );
+        }
+#endif
+#if CHECKSUM_CHECK_UDP
+        if (proto == IP_PROTO_UDP) {
+            if (p->len < l4_off + UDP_HLEN) {
+                return true;
+            }
+            const struct udp_hdr *udphdr = (const struct udp_hdr *)((const u8_t *)p->payload + l4_off);
+            if (udphdr->chksum == 0) {
+                /* no checksum used, legal for IPv4 UDP */
+                return true;
+            }
+            return rx_pre_l4_chksum_ok(p, proto, l4_off, l4_len, &src, &dest
+#if LWIP_IPV6
+                                       , NULL, NULL
+#endif
+                                      );
+        }
+#endif
+#endif /* RX_PRE_CHECK_L4 */
+        return true;
+    }
+
+#if LWIP_IPV6 && RX_PRE_CHECK_L4
+    if (ethhdr->type == PP_HTONS(ETHTYPE_IPV6)) {
+        if (p->len < SIZEOF_ETH_HDR + IP6_HLEN) {
+            return true;
+        }
+        const struct ip6_hdr *ip6hdr = (const struct ip6_hdr *)((const u8_t *)p->payload + SIZEOF_ETH_HDR);
+        u16_t plen = IP6H_PLEN(ip6hdr);
+        if (IP6H_V(ip6hdr) != 6 || p->tot_len < SIZEOF_ETH_HDR + IP6_HLEN + plen) {
+            return true;
+        }
+        /* walk the extension header chain the same way ip6_input() does */
+        u8_t nexth = IP6H_NEXTH(ip6hdr);
+        u16_t l4_off = SIZEOF_ETH_HDR + IP6_HLEN;
+        u16_t l4_len = plen;
+        while (nexth == IP6_NEXTH_HOPBYHOP || nexth == IP6_NEXTH_ROUTING || nexth == IP6_NEXTH_DESTOPTS) {
+            if (p->len < l4_off + 2) {
+                return true;
+            }
+            const u8_t *exth = (const u8_t *)p->payload + l4_off;
+            u16_t ext_len = (u16_t)(exth[1] + 1) * 8;
+            if (l4_len < ext_len || p->len < l4_off + ext_len) {
+                return true;
+            }
+            nexth = exth[0];
+            l4_off += ext_len;
+            l4_len -= ext_len;
+        }
+        ip6_addr_t src, dest;
+        ip6_addr_copy_from_packed(src, ip6hdr->src);
+        ip6_addr_copy_from_packed(dest, ip6hdr->dest);
+#if CHECKSUM_CHECK_TCP
+        if (nexth == IP6_NEXTH_TCP) {
+            return rx_pre_l4_chksum_ok(p, IP6_NEXTH_TCP, l4_off, l4_len, NULL, NULL, &src, &dest);
+        }
+#endif
+#if CHECKSUM_CHECK_UDP
+        if (nexth == IP6_NEXTH_UDP) {
+            if (p->len < l4_off + UDP_HLEN) {
+                return true;
+            }
+            const struct udp_hdr *udphdr = (const struct udp_hdr *)((const u8_t *)p->payload + l4_off);
+            if (udphdr->chksum == 0) {
+                /* mandatory for IPv6, the stack would drop it too */
+                return false;
+            }
+            return rx_pre_l4_chksum_ok(p, IP6_NEXTH_UDP, l4_off, l4_len, NULL, NULL, &src, &dest);
+        }
+#endif
+        return true;
+    }
+#endif /* LWIP_IPV6 && RX_PRE_CHECK_L4 */
+
+    return true;
+}
+
+static void rx_pre_task(void *arg)
+{
+    rx_pre_item_t item;
+    while (true) {
+        if (xQueueReceive(s_rx_pre_queue, &item, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+#if LWIP_CHECKSUM_CTRL_PER_NETIF
+        u16_t offloaded = rx_pre_offloaded_checks();
+        if (item.netif->chksum_flags & offloaded) {
+            NETIF_SET_CHECKSUM_CTRL(item.netif, item.netif->chksum_flags & ~offloaded);
+        }
+#endif
+        if (!rx_pre_validate(item.p)) {
+            LWIP_DEBUGF(NETIF_DEBUG, ("rx_pre: checksum error, dropping frame\n"));
+            pbuf_free(item.p);
+            continue;
+        }
+        if (item.netif->input(item.p, item.netif) != ERR_OK) {
+            pbuf_free(item.p);
+        }
+    }
+}
+
+void esp_rx_preprocess_init(void)
+{
+    if (s_rx_pre_queue != NULL) {
+        return;
+    }
+    s_rx_pre_queue = xQueueCreate(CONFIG_LWIP_RX_PREPROCESS_QUEUE_LEN, sizeof(rx_pre_item_t));
+    if (s_rx_pre_queue == NULL) {
+        ESP_LOGE(TAG, "no memory for pre-processing queue, packets will be fed to the stack directly");
+        return;
+    }
+    if (xTaskCreatePinnedToCore(rx_pre_task, "rx_pre", RX_PRE_TASK_STACK_SIZE, NULL,
+                                RX_PRE_TASK_PRIO, NULL, RX_PRE_TASK_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "failed to create pre-processing task, packets will be fed to the stack directly");
+        vQueueDelete(s_rx_pre_queue);
+        s_rx_pre_queue = NULL;
+    }
+}
+
+err_t esp_rx_preprocess_input(struct pbuf *p, struct netif *inp)
+{
+    if (s_rx_pre_queue != NULL) {
+        rx_pre_item_t item = {
+            .p = p,
+            .netif = inp,
+        };
+        if (xQueueSend(s_rx_pre_queue, &item, 0) == pdTRUE) {
+            return ERR_OK;
+        }
+        /* queue full: drop here just as a full tcpip mbox would */
+        return ERR_MEM;
+    }
+    return inp->input(p, inp);
+}
@@ -12,6 +12,7 @@
 #include "freertos/task.h"
 #include "freertos/queue.h"
 #include "freertos/semphr.h"
+#include "sdkconfig.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -24,8 +25,18 @@ typedef TaskHandle_t sys_thread_t;
 
 typedef struct sys_mbox_s {
   QueueHandle_t os_mbox;
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+  QueueHandle_t os_mbox_prio;       /* control-plane lane, NULL for plain mailboxes */
+  SemaphoreHandle_t os_mbox_items;  /* counts items queued across both lanes */
+#endif
 }* sys_mbox_t;
 
+/** Tag OR-ed into the size argument of sys_mbox_new() (via TCPIP_MBOX_SIZE in
+ * lwipopts.h) to request a mailbox with a priority lane. Only the tcpip thread
+ * mailbox is tagged; all other mailboxes stay single-lane.
+ */
+#define ESP_SYS_MBOX_PRIO_LANE_FLAG 0x40000000
+
 /** This is returned by _fromisr() sys functions to tell the outermost function
  * that a higher priority task was woken and the scheduler needs to be invoked.
  */
@@ -23,6 +23,19 @@
 #include "esp_log.h"
 #include "esp_compiler.h"
 
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+#include "lwip/netif.h"
+#include "lwip/priv/tcpip_priv.h"
+#include "lwip/prot/ethernet.h"
+#include "lwip/prot/ip.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/ip6.h"
+#endif
+
+#ifdef CONFIG_LWIP_RX_PREPROCESS
+#include "esp_rx_preprocess.h"
+#endif
+
 static const char* TAG = "lwip_arch";
 
 static sys_mutex_t g_lwip_protect_mutex = NULL;
@@ -195,6 +208,79 @@ sys_sem_free(sys_sem_t *sem)
   *sem = NULL;
 }
 
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+
+/* Incoming UDP datagrams above this size are treated as bulk traffic */
+#define ESP_SYS_MBOX_PRIO_LANE_UDP_MAX_LEN 256
+
+/**
+ * @brief Pick the lane for a message posted to the tcpip thread mailbox
+ *
+ * API calls, callbacks and timer bookkeeping form the control plane and always
+ * take the priority lane. Of the packet input messages only small UDP
+ * datagrams on ethernet-like interfaces are promoted; everything else --
+ * notably TCP segments, whose relative order must be preserved -- stays in
+ * the bulk lane.
+ */
+static bool
+sys_mbox_msg_is_prio(void *msg)
+{
+  struct tcpip_msg *tmsg = (struct tcpip_msg *)msg;
+
+#if !LWIP_TCPIP_CORE_LOCKING_INPUT
+  if (tmsg->type == TCPIP_MSG_INPKT) {
+    struct pbuf *p = tmsg->msg.inp.p;
+    struct netif *inp_netif = tmsg->msg.inp.netif;
+    if ((inp_netif == NULL) || !(inp_netif->flags & NETIF_FLAG_ETHARP) ||
+        (p == NULL) || (p->tot_len > ESP_SYS_MBOX_PRIO_LANE_UDP_MAX_LEN) ||
+        (p->len < SIZEOF_ETH_HDR + IP_HLEN)) {
+      return false;
+    }
+    const u8_t *frame = (const u8_t *)p->payload;
+    u16_t ethtype = ((u16_t)frame[12] << 8) | frame[13];
+    if (ethtype == ETHTYPE_IP) {
+      return frame[SIZEOF_ETH_HDR + 9] == IP_PROTO_UDP;
+    }
+#if LWIP_IPV6
+    if ((ethtype == ETHTYPE_IPV6) && (p->len >= SIZEOF_ETH_HDR + IP6_HLEN)) {
+      return frame[SIZEOF_ETH_HDR + 6] == IP6_NEXTH_UDP;
+    }
+#endif /* LWIP_IPV6 */
+    return false;
+  }
+#endif /* !LWIP_TCPIP_CORE_LOCKING_INPUT */
+
+  return true;
+}
+
+static inline QueueHandle_t
+sys_mbox_pick_lane(sys_mbox_t *mbox, void *msg)
+{
+  return sys_mbox_msg_is_prio(msg) ? (*mbox)->os_mbox_prio : (*mbox)->os_mbox;
+}
+
+/**
+ * @brief Fetch one message from a dual-lane mailbox, priority lane first
+ *
+ * os_mbox_items is given only after a message has been queued, so a
+ * successful take guarantees that one of the lanes holds a message for us.
+ *
+ * @return pdTRUE on success, errQUEUE_EMPTY on timeout
+ */
+static BaseType_t
+sys_mbox_fetch_lanes(sys_mbox_t *mbox, void **msg, TickType_t timeout_ticks)
+{
+  if (xSemaphoreTake((*mbox)->os_mbox_items, timeout_ticks) != pdTRUE) {
+    return errQUEUE_EMPTY;
+  }
+  if (xQueueReceive((*mbox)->os_mbox_prio, &(*msg), 0) == pdTRUE) {
+    return pdTRUE;
+  }
+  return xQueueReceive((*mbox)->os_mbox, &(*msg), 0);
+}
+
+#endif /* CONFIG_LWIP_TCPIP_PRIO_LANE */
+
 /**
  * @brief Create an empty mailbox.
  *
@@ -205,6 +291,10 @@ sys_sem_free(sys_sem_t *sem)
 err_t
 sys_mbox_new(sys_mbox_t *mbox, int size)
 {
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+  bool prio_lane = (size & ESP_SYS_MBOX_PRIO_LANE_FLAG) != 0;
+  size &= ~ESP_SYS_MBOX_PRIO_LANE_FLAG;
+#endif
   *mbox = mem_malloc(sizeof(struct sys_mbox_s));
   if (*mbox == NULL){
     LWIP_DEBUGF(ESP_THREAD_SAFE_DEBUG, ("fail to new *mbox\n"));
@@ -219,6 +309,27 @@ sys_mbox_new(sys_mbox_t *mbox, int size)
     return ERR_MEM;
   }
 
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+  (*mbox)->os_mbox_prio = NULL;
+  (*mbox)->os_mbox_items = NULL;
+  if (prio_lane) {
+    (*mbox)->os_mbox_prio = xQueueCreate(size, sizeof(void *));
+    (*mbox)->os_mbox_items = xSemaphoreCreateCounting(2 * size, 0);
+    if (((*mbox)->os_mbox_prio == NULL) || ((*mbox)->os_mbox_items == NULL)) {
+      LWIP_DEBUGF(ESP_THREAD_SAFE_DEBUG, ("fail to new (*mbox) prio lane\n"));
+      if ((*mbox)->os_mbox_prio != NULL) {
+        vQueueDelete((*mbox)->os_mbox_prio);
+      }
+      if ((*mbox)->os_mbox_items != NULL) {
+        vSemaphoreDelete((*mbox)->os_mbox_items);
+      }
+      vQueueDelete((*mbox)->os_mbox);
+      free(*mbox);
+      return ERR_MEM;
+    }
+  }
+#endif
+
   LWIP_DEBUGF(ESP_THREAD_SAFE_DEBUG, ("new *mbox ok mbox=%p os_mbox=%p\n", *mbox, (*mbox)->os_mbox));
   return ERR_OK;
 }
@@ -232,6 +343,15 @@ sys_mbox_new(sys_mbox_t *mbox, int size)
 void
 sys_mbox_post(sys_mbox_t *mbox, void *msg)
 {
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+  if ((*mbox)->os_mbox_prio != NULL) {
+    BaseType_t lane_ret = xQueueSendToBack(sys_mbox_pick_lane(mbox, msg), &msg, portMAX_DELAY);
+    LWIP_ASSERT("mbox post failed", lane_ret == pdTRUE);
+    (void)lane_ret;
+    xSemaphoreGive((*mbox)->os_mbox_items);
+    return;
+  }
+#endif
   BaseType_t ret = xQueueSendToBack((*mbox)->os_mbox, &msg, portMAX_DELAY);
   LWIP_ASSERT("mbox post failed", ret == pdTRUE);
   (void)ret;
@@ -249,6 +369,16 @@ sys_mbox_trypost(sys_mbox_t *mbox, void *msg)
 {
   err_t xReturn;
 
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+  if ((*mbox)->os_mbox_prio != NULL) {
+    if (xQueueSend(sys_mbox_pick_lane(mbox, msg), &msg, 0) == pdTRUE) {
+      xSemaphoreGive((*mbox)->os_mbox_items);
+      return ERR_OK;
+    }
+    LWIP_DEBUGF(ESP_THREAD_SAFE_DEBUG, ("trypost mbox=%p fail\n", (*mbox)->os_mbox));
+    return ERR_MEM;
+  }
+#endif
   if (xQueueSend((*mbox)->os_mbox, &msg, 0) == pdTRUE) {
     xReturn = ERR_OK;
   } else {
@@ -274,6 +404,20 @@ sys_mbox_trypost_fromisr(sys_mbox_t *mbox, void *msg)
   BaseType_t ret;
   BaseType_t xHigherPriorityTaskWoken = pdFALSE;
 
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+  if ((*mbox)->os_mbox_prio != NULL) {
+    ret = xQueueSendFromISR(sys_mbox_pick_lane(mbox, msg), &msg, &xHigherPriorityTaskWoken);
+    if (ret == pdTRUE) {
+      xSemaphoreGiveFromISR((*mbox)->os_mbox_items, &xHigherPriorityTaskWoken);
+      if (xHigherPriorityTaskWoken == pdTRUE) {
+        return ERR_NEED_SCHED;
+      }
+      return ERR_OK;
+    }
+    LWIP_ASSERT("mbox trypost failed", ret == errQUEUE_FULL);
+    return ERR_MEM;
+  }
+#endif
   ret = xQueueSendFromISR((*mbox)->os_mbox, &msg, &xHigherPriorityTaskWoken);
   if (ret == pdTRUE) {
     if (xHigherPriorityTaskWoken == pdTRUE) {
@@ -304,6 +448,19 @@ sys_arch_mbox_fetch(sys_mbox_t *mbox, void **msg, u32_t timeout)
     msg = &msg_dummy;
   }
 
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+  if ((*mbox)->os_mbox_prio != NULL) {
+    TickType_t timeout_ticks = (timeout == 0) ? portMAX_DELAY : (timeout / portTICK_PERIOD_MS);
+    ret = sys_mbox_fetch_lanes(mbox, msg, timeout_ticks);
+    if (ret == errQUEUE_EMPTY) {
+      /* timed out */
+      *msg = NULL;
+      return SYS_ARCH_TIMEOUT;
+    }
+    LWIP_ASSERT("mbox fetch failed", ret == pdTRUE);
+    return 0;
+  }
+#endif
   if (timeout == 0) {
     /* wait infinite */
     ret = xQueueReceive((*mbox)->os_mbox, &(*msg), portMAX_DELAY);
@@ -338,7 +495,15 @@ sys_arch_mbox_tryfetch(sys_mbox_t *mbox, void **msg)
   if (msg == NULL) {
     msg = &msg_dummy;
   }
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+  if ((*mbox)->os_mbox_prio != NULL) {
+    ret = sys_mbox_fetch_lanes(mbox, msg, 0);
+  } else {
+    ret = xQueueReceive((*mbox)->os_mbox, &(*msg), 0);
+  }
+#else
   ret = xQueueReceive((*mbox)->os_mbox, &(*msg), 0);
+#endif
   if (ret == errQUEUE_EMPTY) {
     *msg = NULL;
     return SYS_MBOX_EMPTY;
@@ -360,6 +525,13 @@ sys_mbox_free(sys_mbox_t *mbox)
     return;
   }
   UBaseType_t msgs_waiting = uxQueueMessagesWaiting((*mbox)->os_mbox);
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+  if ((*mbox)->os_mbox_prio != NULL) {
+    msgs_waiting += uxQueueMessagesWaiting((*mbox)->os_mbox_prio);
+    vQueueDelete((*mbox)->os_mbox_prio);
+    vSemaphoreDelete((*mbox)->os_mbox_items);
+  }
+#endif
   LWIP_ASSERT("mbox quence not empty", msgs_waiting == 0);
 
   vQueueDelete((*mbox)->os_mbox);
@@ -416,6 +588,14 @@ sys_init(void)
   // Create the pthreads key for the per-thread semaphore storage
   pthread_key_create(&sys_thread_sem_key, sys_thread_sem_free);
 
+#ifdef CONFIG_LWIP_PBUF_POOL
+  esp_pbuf_pool_init();
+#endif
+
+#ifdef CONFIG_LWIP_RX_PREPROCESS
+  esp_rx_preprocess_init();
+#endif
+
   esp_vfs_lwip_sockets_register();
 }
 
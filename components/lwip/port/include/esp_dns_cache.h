@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "lwip/ip_addr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file esp_dns_cache.h
+ * @brief DNS cache persisted across deep sleep, with prefetch of critical names
+ *
+ * lwIP's DNS table lives in ordinary RAM and is rebuilt from scratch on every
+ * wakeup, so a wake-publish-sleep cycle pays a full DNS round trip before the
+ * first connection. This cache keeps a small number of name/address entries
+ * in RTC memory with absolute expiry times, so resolutions performed before a
+ * deep sleep are still valid after it (system time is maintained across deep
+ * sleep by the RTC timer). Names registered as critical are re-resolved in
+ * the background shortly before their entry expires, keeping the cache warm.
+ *
+ * lwIP does not expose the TTL of a DNS answer, so the lifetime of an entry
+ * is the one supplied when it was added or registered; pick it from the known
+ * TTL policy of the names involved (e.g. the DNS record of the MQTT broker).
+ *
+ * Enabled by CONFIG_LWIP_DNS_PERSISTENT_CACHE.
+ */
+
+/**
+ * @brief Look up a name in the persistent cache
+ *
+ * @param name Hostname to look up (case-insensitive)
+ * @param addr Resolved address, set on a hit
+ *
+ * @return ESP_OK on a hit, ESP_ERR_NOT_FOUND if the name is absent or its
+ *         entry has expired, ESP_ERR_INVALID_ARG on invalid arguments
+ */
+esp_err_t esp_dns_cache_lookup(const char *name, ip_addr_t *addr);
+
+/**
+ * @brief Insert or refresh a cache entry
+ *
+ * An existing entry for the name is updated in place. Otherwise a free or
+ * expired slot is used, evicting the soonest-expiring non-critical entry if
+ * the table is full.
+ *
+ * @param name    Hostname (at most ESP_DNS_CACHE_HOSTNAME_LEN - 1 characters)
+ * @param addr    Address the name resolves to
+ * @param ttl_sec Entry lifetime in seconds from now
+ *
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if all slots hold unexpired
+ *         critical entries, ESP_ERR_INVALID_ARG on invalid arguments
+ */
+esp_err_t esp_dns_cache_add(const char *name, const ip_addr_t *addr, uint32_t ttl_sec);
+
+/**
+ * @brief Register a name as critical
+ *
+ * Critical names are never evicted by esp_dns_cache_add() and are re-resolved
+ * by the background prefetch before their entry expires. The entry starts out
+ * expired, so the first prefetch pass resolves it.
+ *
+ * @param name    Hostname to keep resolved
+ * @param ttl_sec Lifetime applied to each successful (re-)resolution
+ *
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if the table is full of other
+ *         critical names, ESP_ERR_INVALID_ARG on invalid arguments
+ */
+esp_err_t esp_dns_cache_register_critical(const char *name, uint32_t ttl_sec);
+
+/**
+ * @brief Start the background prefetch of critical names
+ *
+ * A periodic check runs in the lwIP tcpip thread and issues a DNS query for
+ * every critical name whose entry expires within the configured lead time
+ * (CONFIG_LWIP_DNS_PERSISTENT_CACHE_PREFETCH_LEAD).
+ *
+ * @return ESP_OK on success, ESP_FAIL if the request could not be posted to
+ *         the tcpip thread
+ */
+esp_err_t esp_dns_cache_prefetch_start(void);
+
+/**
+ * @brief Stop the background prefetch
+ *
+ * @return ESP_OK on success, ESP_FAIL if the request could not be posted to
+ *         the tcpip thread
+ */
+esp_err_t esp_dns_cache_prefetch_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
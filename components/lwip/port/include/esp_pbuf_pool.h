@@ -0,0 +1,38 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Preallocate the packet buffer pool
+ *
+ * Called once from sys_init(). Carves CONFIG_LWIP_PBUF_POOL_COUNT slabs of
+ * CONFIG_LWIP_PBUF_POOL_BUFSIZE bytes out of a single DMA-capable internal
+ * allocation. Until this has run (or if the allocation fails) the allocator
+ * entry points below simply fall through to the heap.
+ */
+void esp_pbuf_pool_init(void);
+
+/**
+ * @brief Allocator entry points installed as mem_clib_malloc/calloc/free
+ *
+ * Allocations that fit in a pool slab are served from a per-core cache
+ * (refilled from a shared free list), so the hot packet path does not take
+ * the heap lock. Oversized requests, and all requests once the pool is
+ * exhausted, fall back to the heap; esp_pbuf_pool_free() recognizes pool
+ * slabs by address range and returns foreign pointers to the heap.
+ */
+void *esp_pbuf_pool_malloc(size_t size);
+void *esp_pbuf_pool_calloc(size_t n, size_t size);
+void esp_pbuf_pool_free(void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,46 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "lwip/err.h"
+#include "lwip/pbuf.h"
+#include "lwip/netif.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Start the receive pre-processing worker
+ *
+ * Called once from sys_init(). Creates the hand-off queue and the worker
+ * task pinned to the other core than the TCP/IP task. If the task cannot
+ * be created, esp_rx_preprocess_input() falls through to the netif input
+ * function and the stack behaves as if pre-processing was disabled.
+ */
+void esp_rx_preprocess_init(void);
+
+/**
+ * @brief Feed a received frame through the pre-processing worker
+ *
+ * Drop-in replacement for calling netif->input() from a driver context:
+ * the frame is handed to a core-pinned worker which parses the link and IP
+ * headers, verifies the checksums the stack would otherwise verify inside
+ * the TCP/IP thread, drops corrupt frames, and forwards the rest through
+ * netif->input(). The corresponding per-netif checksum checks are disabled,
+ * so the cycles move to the worker's core.
+ *
+ * @param p packet to process, ownership is taken on ERR_OK
+ * @param inp network interface the packet was received on
+ * @return ERR_OK if the packet was queued (or fed to the stack directly),
+ *         ERR_MEM if the hand-off queue is full - the caller frees the
+ *         packet, matching the behavior of a full TCP/IP mailbox
+ */
+err_t esp_rx_preprocess_input(struct pbuf *p, struct netif *inp);
+
+#ifdef __cplusplus
+}
+#endif
@@ -870,8 +870,14 @@ static inline uint32_t timeout_from_offered(uint32_t lease, uint32_t min)
  * TCPIP_MBOX_SIZE: The mailbox size for the tcpip thread messages
  * The queue size value itself is platform-dependent, but is passed to
  * sys_mbox_new() when tcpip_init is called.
+ * With LWIP_TCPIP_PRIO_LANE the size is tagged so that sys_mbox_new()
+ * gives this particular mailbox a priority lane (see sys_arch.c).
  */
+#ifdef CONFIG_LWIP_TCPIP_PRIO_LANE
+#define TCPIP_MBOX_SIZE                 (ESP_SYS_MBOX_PRIO_LANE_FLAG | CONFIG_LWIP_TCPIP_RECVMBOX_SIZE)
+#else
 #define TCPIP_MBOX_SIZE                 CONFIG_LWIP_TCPIP_RECVMBOX_SIZE
+#endif
 
 /**
  * DEFAULT_UDP_RECVMBOX_SIZE: The mailbox size for the incoming packets on a
@@ -1186,6 +1192,16 @@ static inline uint32_t timeout_from_offered(uint32_t lease, uint32_t min)
    --------------------------------------
 */
 
+/**
+ * LWIP_CHECKSUM_CTRL_PER_NETIF==1: Checksum generation and checking can be
+ * controlled per netif. Enabled together with EMAC checksum offload so the
+ * Ethernet netif leaves checksums to hardware (see ethernetif.c) while other
+ * interfaces keep computing them in software.
+ */
+#if CONFIG_ETH_EMAC_CHECKSUM_OFFLOAD
+#define LWIP_CHECKSUM_CTRL_PER_NETIF    1
+#endif
+
 /**
  * CHECKSUM_CHECK_IP==1: Check checksums in software for incoming IP packets.
  */
@@ -1693,8 +1709,15 @@ static inline uint32_t timeout_from_offered(uint32_t lease, uint32_t min)
  * If CONFIG_ALLOC_MEMORY_IN_SPIRAM_FIRST is enabled, Try to
  * allocate memory for lwip in SPIRAM firstly. If failed, try to allocate
  * internal memory then.
- */
-#if CONFIG_SPIRAM_TRY_ALLOCATE_WIFI_LWIP
+ * With CONFIG_LWIP_PBUF_POOL the allocator is front-ended by the packet
+ * buffer pool; its fallback path applies the same SPIRAM preference.
+ */
+#if CONFIG_LWIP_PBUF_POOL
+#include "esp_pbuf_pool.h"
+#define mem_clib_malloc          esp_pbuf_pool_malloc
+#define mem_clib_calloc          esp_pbuf_pool_calloc
+#define mem_clib_free            esp_pbuf_pool_free
+#elif CONFIG_SPIRAM_TRY_ALLOCATE_WIFI_LWIP
 #define mem_clib_malloc(size)    heap_caps_malloc_prefer(size, 2, MALLOC_CAP_DEFAULT|MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT|MALLOC_CAP_INTERNAL)
 #define mem_clib_calloc(n, size) heap_caps_calloc_prefer(n, size, 2, MALLOC_CAP_DEFAULT|MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT|MALLOC_CAP_INTERNAL)
 #else /* !CONFIG_SPIRAM_TRY_ALLOCATE_WIFI_LWIP */
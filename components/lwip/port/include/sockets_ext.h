@@ -15,7 +15,90 @@ extern "C" {
 #define IPV6_MULTICAST_HOPS  0x301
 #define IPV6_MULTICAST_LOOP  0x302
 
+/**
+ * TCP_CORK: hold back sub-MSS segments until the option is cleared again,
+ * so that a burst of small send()/writev() calls is coalesced into full
+ * segments. Corking maps onto enabling the Nagle algorithm for the
+ * connection; clearing the option pushes the queued data out immediately.
+ * An application combining TCP_CORK with TCP_NODELAY should re-apply
+ * TCP_NODELAY after uncorking.
+ */
+#define TCP_CORK             0x400
+
+/**
+ * ESP_TCP_INFO: read a compact per-connection instrumentation snapshot with
+ * getsockopt(IPPROTO_TCP, ESP_TCP_INFO) into an esp_tcp_info_t. The values
+ * are sampled from the protocol control block on demand, so enabling or
+ * polling this option adds no cost to the send/receive hot path.
+ */
+#define ESP_TCP_INFO         0x401
+
+/**
+ * ESP_TCP_SNDBUF_AUTOTUNE: let the stack size this connection's effective
+ * send buffer from the congestion window instead of the fixed TCP_SND_BUF.
+ * A fixed buffer either starves a fast path or queues far more than the
+ * path can carry, inflating the RTT seen by every other connection sharing
+ * the link. With the option set (int, 0/1) the port periodically clamps the
+ * writable send space to about twice the current congestion window, so a
+ * bulk sender keeps the pipe full without building a deep standing queue.
+ */
+#define ESP_TCP_SNDBUF_AUTOTUNE  0x402
+
+/**
+ * ESP_TCP_PACING_RATE: cap a connection's throughput to approximately the
+ * given rate in bytes per second (uint32_t, 0 disables the cap). lwIP has no
+ * per-segment transmit timer, so the port enforces the rate by limiting the
+ * data in flight to rate x smoothed RTT, which bounds both the throughput
+ * and the queueing delay the connection can add. Intended for bulk sockets
+ * that should leave headroom for latency-sensitive traffic.
+ */
+#define ESP_TCP_PACING_RATE      0x403
+
+typedef struct esp_tcp_info {
+    uint32_t rtt_ms;                /*!< smoothed round-trip time estimate */
+    uint32_t rtt_var_ms;            /*!< round-trip time variance */
+    uint32_t rto_ms;                /*!< current retransmission timeout */
+    uint32_t snd_queued_bytes;      /*!< bytes waiting in the send buffer */
+    uint32_t snd_wnd;               /*!< send window announced by the peer */
+    uint32_t cwnd;                  /*!< congestion window */
+    uint32_t recv_queued_packets;   /*!< packets waiting in the receive mailbox */
+    uint16_t mss;                   /*!< effective send MSS */
+    uint8_t  nrtx;                  /*!< retransmissions of the current segment */
+    uint8_t  dupacks;               /*!< duplicate ACKs for the current segment */
+} esp_tcp_info_t;
+
 struct lwip_sock;
+struct msghdr;
+
+/**
+ * Message descriptor for esp_recvmmsg(), mirroring the struct mmsghdr used
+ * by the Linux recvmmsg() call
+ */
+struct esp_mmsghdr {
+    struct msghdr msg_hdr;  /*!< Message header, filled in by the caller as for recvmsg() */
+    size_t msg_len;         /*!< Number of bytes received for this message, set on return */
+};
+
+/**
+ * @brief Receive multiple datagrams with a single call
+ *
+ * A discovery responder answering probe bursts pays one task wakeup and one
+ * socket lock round trip per recvfrom() call. This call drains up to vlen
+ * queued datagrams at once: the first receive honors the socket's blocking
+ * mode and the given flags, the remaining ones are non-blocking, so the call
+ * returns as soon as the queue is empty rather than waiting for the batch to
+ * fill.
+ *
+ * @param s      Socket descriptor
+ * @param msgvec Array of message descriptors to fill
+ * @param vlen   Number of entries in msgvec
+ * @param flags  Flags applied to each receive, as for recvmsg()
+ *
+ * @return Number of messages received on success. -1 with errno set if the
+ *         first receive fails; errors on subsequent receives end the batch
+ *         and are reported by the next call.
+ */
+int esp_recvmmsg(int s, struct esp_mmsghdr *msgvec, unsigned int vlen, int flags);
 
 bool lwip_setsockopt_impl_ext(struct lwip_sock* sock, int level, int optname, const void *optval, uint32_t optlen, int *err);
 bool lwip_getsockopt_impl_ext(struct lwip_sock* sock, int level, int optname, void *optval, uint32_t *optlen, int *err);
@@ -4,13 +4,18 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <errno.h>
+#include <string.h>
 #include "lwip/sockets.h"
 #include "lwip/priv/sockets_priv.h"
+#include "sockets_ext.h"
 #include "lwip/api.h"
 #include "lwip/sys.h"
 #include "lwip/tcp.h"
+#include "lwip/priv/tcp_priv.h"
 #include "lwip/raw.h"
 #include "lwip/udp.h"
+#include "lwip/timeouts.h"
 
 #define LWIP_SOCKOPT_CHECK_OPTLEN_CONN_PCB(sock, optlen, opttype) do { \
   if (((optlen) < sizeof(opttype)) || ((sock)->conn == NULL) || ((sock)->conn->pcb.tcp == NULL)) { *err=EINVAL; goto exit; } }while(0)
@@ -20,8 +25,199 @@
   if (NETCONNTYPE_GROUP(netconn_type((sock)->conn)) != netconntype) { *err=ENOPROTOOPT; goto exit; } } while(0)
 
 
+int esp_recvmmsg(int s, struct esp_mmsghdr *msgvec, unsigned int vlen, int flags)
+{
+    if (msgvec == NULL || vlen == 0) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    unsigned int received = 0;
+    while (received < vlen) {
+        /* Only the first receive may block; the rest just drain the queue */
+        int msg_flags = flags | (received ? MSG_DONTWAIT : 0);
+        int len = lwip_recvmsg(s, &msgvec[received].msg_hdr, msg_flags);
+        if (len < 0) {
+            /* As with recvmmsg(), an error after the first message ends the
+             * batch and will be reported by the next call */
+            return received ? (int)received : -1;
+        }
+        msgvec[received].msg_len = (size_t)len;
+        received++;
+    }
+    return (int)received;
+}
+
+/*
+ * Send-buffer auto-tuning and pacing.
+ *
+ * lwIP accounts the send buffer with a conserved per-pcb counter: snd_buf
+ * starts at TCP_SND_BUF, tcp_write() subtracts queued bytes and incoming
+ * ACKs add them back. Reserving bytes out of that counter therefore shrinks
+ * the connection's effective send buffer for as long as the reservation is
+ * held, without touching the core (which is what limits how much data the
+ * connection can keep in flight). A periodic tick in the tcpip thread
+ * re-targets the reservation from the congestion window and, when a pacing
+ * rate is set, from rate x smoothed RTT.
+ */
+
+#define ESP_TCP_TUNE_MAX_PCBS       8
+#define ESP_TCP_TUNE_INTERVAL_MS    250
+
+typedef struct {
+    struct tcp_pcb *pcb;
+    u32_t reserved;     /* bytes currently held back from pcb->snd_buf */
+    u32_t pacing_rate;  /* bytes per second, 0 when pacing is off */
+    u8_t autotune;      /* size the buffer from cwnd when set */
+} esp_tcp_tune_entry_t;
+
+static esp_tcp_tune_entry_t s_tcp_tune[ESP_TCP_TUNE_MAX_PCBS];
+static bool s_tcp_tune_timer_armed;
+
+static esp_tcp_tune_entry_t *esp_tcp_tune_find(const struct tcp_pcb *pcb)
+{
+    for (int i = 0; i < ESP_TCP_TUNE_MAX_PCBS; i++) {
+        if (s_tcp_tune[i].pcb == pcb) {
+            return &s_tcp_tune[i];
+        }
+    }
+    return NULL;
+}
+
+static bool esp_tcp_tune_pcb_is_active(const struct tcp_pcb *pcb)
+{
+    for (struct tcp_pcb *it = tcp_active_pcbs; it != NULL; it = it->next) {
+        if (it == pcb) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Give the reservation back to the connection and forget the entry */
+static void esp_tcp_tune_release(esp_tcp_tune_entry_t *entry, bool pcb_alive)
+{
+    if (pcb_alive && entry->reserved) {
+        entry->pcb->snd_buf += (tcpwnd_size_t)entry->reserved;
+    }
+    memset(entry, 0, sizeof(*entry));
+}
+
+static void esp_tcp_tune_tick(void *arg)
+{
+    LWIP_UNUSED_ARG(arg);
+    bool any = false;
+
+    for (int i = 0; i < ESP_TCP_TUNE_MAX_PCBS; i++) {
+        esp_tcp_tune_entry_t *entry = &s_tcp_tune[i];
+        struct tcp_pcb *pcb = entry->pcb;
+        if (pcb == NULL) {
+            continue;
+        }
+        /* The socket layer gives no callback when a pcb is freed, so confirm
+         * the connection is still on the active list before touching it */
+        if (!esp_tcp_tune_pcb_is_active(pcb)) {
+            esp_tcp_tune_release(entry, false);
+            continue;
+        }
+        u32_t target = TCP_SND_BUF;
+        if (entry->autotune) {
+            /* twice the congestion window keeps the pipe full across one RTT
+             * of ACK feedback without building a deep standing queue */
+            u32_t by_cwnd = LWIP_MAX(2 * (u32_t)pcb->cwnd, 4 * (u32_t)pcb->mss);
+            target = LWIP_MIN(target, by_cwnd);
+        }
+        if (entry->pacing_rate) {
+            u32_t srtt_ms = (pcb->sa > 0) ? ((u32_t)pcb->sa >> 3) * TCP_SLOW_INTERVAL : TCP_SLOW_INTERVAL;
+            u32_t by_rate = (u32_t)(((uint64_t)entry->pacing_rate * srtt_ms) / 1000);
+            target = LWIP_MIN(target, LWIP_MAX(by_rate, 2 * (u32_t)pcb->mss));
+        }
+        u32_t want = TCP_SND_BUF - target;
+        if (want > entry->reserved) {
+            /* shrink: only take space that is currently free, the rest is
+             * collected on later ticks as ACKs return buffer */
+            u32_t take = LWIP_MIN(want - entry->reserved, (u32_t)pcb->snd_buf);
+            pcb->snd_buf -= (tcpwnd_size_t)take;
+            entry->reserved += take;
+        } else if (want < entry->reserved) {
+            u32_t give = entry->reserved - want;
+            pcb->snd_buf += (tcpwnd_size_t)give;
+            entry->reserved -= give;
+        }
+        any = true;
+    }
+
+    if (any) {
+        sys_timeout(ESP_TCP_TUNE_INTERVAL_MS, esp_tcp_tune_tick, NULL);
+    } else {
+        s_tcp_tune_timer_armed = false;
+    }
+}
+
+/* Runs in tcpip context (like the rest of the setsockopt extension).
+ * NULL for autotune or pacing_rate leaves that setting unchanged. */
+static int esp_tcp_tune_update(struct tcp_pcb *pcb, const int *autotune, const u32_t *pacing_rate)
+{
+    esp_tcp_tune_entry_t *entry = esp_tcp_tune_find(pcb);
+    if (entry == NULL) {
+        if ((autotune == NULL || *autotune == 0) && (pacing_rate == NULL || *pacing_rate == 0)) {
+            return 0; /* nothing enabled and nothing to clear */
+        }
+        entry = esp_tcp_tune_find(NULL);
+        if (entry == NULL) {
+            return ENOMEM;
+        }
+        entry->pcb = pcb;
+    }
+    if (autotune != NULL) {
+        entry->autotune = (u8_t)(*autotune != 0);
+    }
+    if (pacing_rate != NULL) {
+        entry->pacing_rate = *pacing_rate;
+    }
+    if (!entry->autotune && !entry->pacing_rate) {
+        esp_tcp_tune_release(entry, true);
+        return 0;
+    }
+    if (!s_tcp_tune_timer_armed) {
+        s_tcp_tune_timer_armed = true;
+        sys_timeout(ESP_TCP_TUNE_INTERVAL_MS, esp_tcp_tune_tick, NULL);
+    }
+    return 0;
+}
+
 bool lwip_setsockopt_impl_ext(struct lwip_sock* sock, int level, int optname, const void *optval, socklen_t optlen, int *err)
 {
+    if (level == IPPROTO_TCP) {
+        switch (optname) {
+            default:
+                return false;
+            case TCP_CORK:
+                LWIP_SOCKOPT_CHECK_OPTLEN_CONN_PCB_TYPE(sock, optlen, int, NETCONN_TCP);
+                if (*(const int*)optval) {
+                    /* while corked, the Nagle algorithm holds back sub-MSS segments */
+                    tcp_nagle_enable(sock->conn->pcb.tcp);
+                } else {
+                    /* uncork: push out whatever has been queued */
+                    tcp_output(sock->conn->pcb.tcp);
+                }
+                break;
+            case ESP_TCP_SNDBUF_AUTOTUNE: {
+                LWIP_SOCKOPT_CHECK_OPTLEN_CONN_PCB_TYPE(sock, optlen, int, NETCONN_TCP);
+                int enable = *(const int*)optval;
+                *err = esp_tcp_tune_update(sock->conn->pcb.tcp, &enable, NULL);
+                break;
+            }
+            case ESP_TCP_PACING_RATE: {
+                LWIP_SOCKOPT_CHECK_OPTLEN_CONN_PCB_TYPE(sock, optlen, uint32_t, NETCONN_TCP);
+                u32_t rate = *(const uint32_t*)optval;
+                *err = esp_tcp_tune_update(sock->conn->pcb.tcp, NULL, &rate);
+                break;
+            }
+        }
+        goto exit;
+    }
+
 #if LWIP_IPV6
     if (level != IPPROTO_IPV6)
 #endif /* LWIP_IPV6 */
@@ -52,13 +248,71 @@ bool lwip_setsockopt_impl_ext(struct lwip_sock* sock, int level, int optname, co
             }
             break;
     }
+#endif /* LWIP_IPV6 */
 exit:
     return true;
-#endif /* LWIP_IPV6 */
 }
 
 bool lwip_getsockopt_impl_ext(struct lwip_sock* sock, int level, int optname, void *optval, uint32_t *optlen, int *err)
 {
+    if (level == IPPROTO_TCP) {
+        switch (optname) {
+            default:
+                return false;
+            case TCP_CORK:
+                LWIP_SOCKOPT_CHECK_OPTLEN_CONN_PCB(sock, *optlen, int);
+                if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) != NETCONN_TCP) {
+                    *err = ENOPROTOOPT;
+                    goto exit;
+                }
+                *(int*)optval = tcp_nagle_disabled(sock->conn->pcb.tcp) ? 0 : 1;
+                break;
+            case ESP_TCP_INFO: {
+                LWIP_SOCKOPT_CHECK_OPTLEN_CONN_PCB(sock, *optlen, esp_tcp_info_t);
+                if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) != NETCONN_TCP) {
+                    *err = ENOPROTOOPT;
+                    goto exit;
+                }
+                struct tcp_pcb *pcb = sock->conn->pcb.tcp;
+                esp_tcp_info_t *info = (esp_tcp_info_t*)optval;
+                info->rtt_ms = (pcb->sa > 0) ? (pcb->sa >> 3) * TCP_SLOW_INTERVAL : 0;
+                info->rtt_var_ms = (pcb->sv >> 2) * TCP_SLOW_INTERVAL;
+                info->rto_ms = pcb->rto * TCP_SLOW_INTERVAL;
+                info->snd_queued_bytes = TCP_SND_BUF - pcb->snd_buf;
+                info->snd_wnd = pcb->snd_wnd;
+                info->cwnd = pcb->cwnd;
+                info->recv_queued_packets = sys_mbox_valid(&sock->conn->recvmbox) ?
+                        uxQueueMessagesWaiting(sock->conn->recvmbox->os_mbox) : 0;
+                info->mss = pcb->mss;
+                info->nrtx = pcb->nrtx;
+                info->dupacks = pcb->dupacks;
+                *optlen = sizeof(esp_tcp_info_t);
+                break;
+            }
+            case ESP_TCP_SNDBUF_AUTOTUNE: {
+                LWIP_SOCKOPT_CHECK_OPTLEN_CONN_PCB(sock, *optlen, int);
+                if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) != NETCONN_TCP) {
+                    *err = ENOPROTOOPT;
+                    goto exit;
+                }
+                esp_tcp_tune_entry_t *entry = esp_tcp_tune_find(sock->conn->pcb.tcp);
+                *(int*)optval = (entry != NULL && entry->autotune) ? 1 : 0;
+                break;
+            }
+            case ESP_TCP_PACING_RATE: {
+                LWIP_SOCKOPT_CHECK_OPTLEN_CONN_PCB(sock, *optlen, uint32_t);
+                if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) != NETCONN_TCP) {
+                    *err = ENOPROTOOPT;
+                    goto exit;
+                }
+                esp_tcp_tune_entry_t *entry = esp_tcp_tune_find(sock->conn->pcb.tcp);
+                *(uint32_t*)optval = (entry != NULL) ? entry->pacing_rate : 0;
+                break;
+            }
+        }
+        goto exit;
+    }
+
 #if LWIP_IPV6
     if (level != IPPROTO_IPV6)
 #endif /* LWIP_IPV6 */
@@ -102,7 +356,7 @@ bool lwip_getsockopt_impl_ext(struct lwip_sock* sock, int level, int optname, vo
                     *(int *)optval));
             break;
     }
+#endif /* LWIP_IPV6 */
 exit:
     return true;
-#endif /* LWIP_IPV6 */
 }
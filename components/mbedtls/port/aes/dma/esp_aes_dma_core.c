@@ -900,6 +900,38 @@ static DRAM_ATTR crypto_dma_desc_t s_stream_out_desc;
 static DRAM_ATTR uint8_t s_stream_in[AES_BLOCK_BYTES];
 static DRAM_ATTR uint8_t s_stream_out[AES_BLOCK_BYTES];
 
+/* Cached descriptor array, reused across operations to avoid an allocation
+ * and free on every call: TLS-style traffic runs one or two AES operations
+ * per record and pays the heap round trip each time. Protected by the AES
+ * hardware lock, which every caller of esp_aes_process_dma[_gcm]() holds.
+ * Operations needing more than AES_DMA_DESC_CACHE_MAX descriptors fall back
+ * to a per-call allocation so the cache stays small. */
+#define AES_DMA_DESC_CACHE_MAX 32
+
+static crypto_dma_desc_t *s_desc_cache;
+
+static crypto_dma_desc_t *aes_dma_desc_get(size_t num)
+{
+    if (num <= AES_DMA_DESC_CACHE_MAX) {
+        if (s_desc_cache == NULL) {
+            s_desc_cache = heap_caps_aligned_calloc(8, AES_DMA_DESC_CACHE_MAX, sizeof(crypto_dma_desc_t), MALLOC_CAP_DMA);
+        }
+        if (s_desc_cache != NULL) {
+            memset(s_desc_cache, 0, num * sizeof(crypto_dma_desc_t));
+            return s_desc_cache;
+        }
+        /* fall through to a one-off allocation if the cache could not be allocated */
+    }
+    return heap_caps_aligned_calloc(8, num, sizeof(crypto_dma_desc_t), MALLOC_CAP_DMA);
+}
+
+static void aes_dma_desc_put(crypto_dma_desc_t *desc)
+{
+    if (desc != s_desc_cache) {
+        free(desc);
+    }
+}
+
 /**
  * Generate a linked list pointing to a (huge) buffer in an descriptor array.
  *
@@ -1013,8 +1045,8 @@ int esp_aes_process_dma(esp_aes_context *ctx, const unsigned char *input, unsign
         /* Set up dma descriptors for input and output considering the 16 byte alignment requirement for EDMA */
         crypto_dma_desc_num = dma_desc_get_required_num(block_bytes, DMA_DESCRIPTOR_BUFFER_MAX_SIZE_16B_ALIGNED);
 
-        /* Allocate both in and out descriptors to save a malloc/free per function call */
-        block_desc = heap_caps_aligned_calloc(8, crypto_dma_desc_num * 2, sizeof(crypto_dma_desc_t), MALLOC_CAP_DMA);
+        /* Both in and out descriptors come from one (usually cached) allocation */
+        block_desc = aes_dma_desc_get(crypto_dma_desc_num * 2);
         if (block_desc == NULL) {
             mbedtls_platform_zeroize(output, len);
             ESP_LOGE(TAG, "Failed to allocate memory");
@@ -1111,7 +1143,7 @@ cleanup:
     if (ret != 0) {
         mbedtls_platform_zeroize(output, len);
     }
-    free(block_desc);
+    aes_dma_desc_put(block_desc);
     return ret;
 }
 
@@ -1187,8 +1219,8 @@ int esp_aes_process_dma_gcm(esp_aes_context *ctx, const unsigned char *input, un
     /* Set up dma descriptors for input and output */
     crypto_dma_desc_num = dma_desc_get_required_num(block_bytes, DMA_DESCRIPTOR_BUFFER_MAX_SIZE_4B_ALIGNED);
 
-    /* Allocate both in and out descriptors to save a malloc/free per function call, add 1 for length descriptor */
-    block_desc = heap_caps_calloc((crypto_dma_desc_num * 2) + 1, sizeof(crypto_dma_desc_t), MALLOC_CAP_DMA);
+    /* Both in and out descriptors plus the length descriptor come from one (usually cached) allocation */
+    block_desc = aes_dma_desc_get((crypto_dma_desc_num * 2) + 1);
     if (block_desc == NULL) {
         mbedtls_platform_zeroize(output, len);
         ESP_LOGE(TAG, "Failed to allocate memory");
@@ -1278,7 +1310,7 @@ cleanup:
     if (ret != 0) {
         mbedtls_platform_zeroize(output, len);
     }
-    free(block_desc);
+    aes_dma_desc_put(block_desc);
     return ret;
 }
 
@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "esp_mbedtls_dynamic_impl.h"
+#include "esp_mbedtls_buffer_pool.h"
+#include "sdkconfig.h"
+
+#ifdef CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+static const char *TAG = "Dynamic Pool";
+
+#define POOL_COUNT CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL_COUNT
+
+/* Each slab fits the biggest record either direction can produce */
+#if MBEDTLS_SSL_IN_BUFFER_LEN > MBEDTLS_SSL_OUT_BUFFER_LEN
+#define POOL_SLAB_SIZE (SSL_BUF_HEAD_OFFSET_SIZE + MBEDTLS_SSL_IN_BUFFER_LEN)
+#else
+#define POOL_SLAB_SIZE (SSL_BUF_HEAD_OFFSET_SIZE + MBEDTLS_SSL_OUT_BUFFER_LEN)
+#endif
+
+/* The small idle buffers kept between records (tens of bytes) are not worth
+ * a slab; only record-size allocations go through the pool */
+#define POOL_MIN_ALLOC (512)
+
+static unsigned char *s_slab[POOL_COUNT];
+static bool s_slab_in_use[POOL_COUNT];
+static SemaphoreHandle_t s_slab_sem;
+static portMUX_TYPE s_pool_lock = portMUX_INITIALIZER_UNLOCKED;
+static esp_mbedtls_ssl_buf_pool_stats_t s_stats;
+
+/* Create the counting semaphore on first checkout; allocation of the slabs
+ * themselves is deferred further, to the first checkout of each slot */
+static bool esp_mbedtls_pool_init(void)
+{
+    if (s_slab_sem) {
+        return true;
+    }
+
+    SemaphoreHandle_t sem = xSemaphoreCreateCounting(POOL_COUNT, POOL_COUNT);
+    if (!sem) {
+        return false;
+    }
+
+    bool installed = false;
+    portENTER_CRITICAL(&s_pool_lock);
+    if (!s_slab_sem) {
+        s_slab_sem = sem;
+        s_stats.free_count = POOL_COUNT;
+        s_stats.min_free_count = POOL_COUNT;
+        installed = true;
+    }
+    portEXIT_CRITICAL(&s_pool_lock);
+
+    if (!installed) {
+        vSemaphoreDelete(sem);
+    }
+    return true;
+}
+
+struct esp_mbedtls_ssl_buf *esp_mbedtls_pool_calloc(size_t size)
+{
+    if (size < POOL_MIN_ALLOC || size > POOL_SLAB_SIZE || !esp_mbedtls_pool_init()) {
+        return mbedtls_calloc(1, size);
+    }
+
+    bool contended = false;
+    TickType_t waited = 0;
+
+    if (xSemaphoreTake(s_slab_sem, 0) != pdTRUE) {
+        contended = true;
+        TickType_t start = xTaskGetTickCount();
+        if (xSemaphoreTake(s_slab_sem, pdMS_TO_TICKS(CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL_TIMEOUT_MS)) != pdTRUE) {
+            portENTER_CRITICAL(&s_pool_lock);
+            s_stats.heap_fallback_count++;
+            portEXIT_CRITICAL(&s_pool_lock);
+            ESP_LOGD(TAG, "pool exhausted for %d ms, falling back to heap",
+                     CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL_TIMEOUT_MS);
+            return mbedtls_calloc(1, size);
+        }
+        waited = xTaskGetTickCount() - start;
+    }
+
+    int idx = -1;
+    portENTER_CRITICAL(&s_pool_lock);
+    for (int i = 0; i < POOL_COUNT; i++) {
+        if (!s_slab_in_use[i]) {
+            s_slab_in_use[i] = true;
+            idx = i;
+            break;
+        }
+    }
+    s_stats.checkout_count++;
+    s_stats.free_count--;
+    if (s_stats.free_count < s_stats.min_free_count) {
+        s_stats.min_free_count = s_stats.free_count;
+    }
+    if (contended) {
+        uint32_t wait_ms = waited * portTICK_PERIOD_MS;
+        s_stats.contended_count++;
+        s_stats.total_wait_ms += wait_ms;
+        if (wait_ms > s_stats.max_wait_ms) {
+            s_stats.max_wait_ms = wait_ms;
+        }
+    }
+    portEXIT_CRITICAL(&s_pool_lock);
+
+    /* The semaphore guarantees a free slot, idx cannot be -1 here */
+    if (!s_slab[idx]) {
+        s_slab[idx] = mbedtls_calloc(1, POOL_SLAB_SIZE);
+        if (!s_slab[idx]) {
+            portENTER_CRITICAL(&s_pool_lock);
+            s_slab_in_use[idx] = false;
+            s_stats.checkout_count--;
+            s_stats.free_count++;
+            portEXIT_CRITICAL(&s_pool_lock);
+            xSemaphoreGive(s_slab_sem);
+            return mbedtls_calloc(1, size);
+        }
+        ESP_LOGD(TAG, "slab %d (%d bytes) allocated @ %p", idx, POOL_SLAB_SIZE, s_slab[idx]);
+    } else {
+        memset(s_slab[idx], 0, size);
+    }
+
+    return (struct esp_mbedtls_ssl_buf *)s_slab[idx];
+}
+
+void esp_mbedtls_pool_free(struct esp_mbedtls_ssl_buf *buf)
+{
+    for (int i = 0; i < POOL_COUNT; i++) {
+        if ((unsigned char *)buf == s_slab[i]) {
+            portENTER_CRITICAL(&s_pool_lock);
+            s_slab_in_use[i] = false;
+            s_stats.free_count++;
+            portEXIT_CRITICAL(&s_pool_lock);
+            xSemaphoreGive(s_slab_sem);
+            return;
+        }
+    }
+
+    mbedtls_free(buf);
+}
+
+esp_err_t esp_mbedtls_ssl_buf_pool_get_stats(esp_mbedtls_ssl_buf_pool_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&s_pool_lock);
+    *stats = s_stats;
+    if (!s_slab_sem) {
+        /* Nothing checked out yet, the whole pool counts as free */
+        stats->free_count = POOL_COUNT;
+        stats->min_free_count = POOL_COUNT;
+    }
+    portEXIT_CRITICAL(&s_pool_lock);
+    return ESP_OK;
+}
+
+void esp_mbedtls_ssl_buf_pool_reset_stats(void)
+{
+    portENTER_CRITICAL(&s_pool_lock);
+    uint32_t free_count = s_slab_sem ? s_stats.free_count : POOL_COUNT;
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.free_count = free_count;
+    s_stats.min_free_count = free_count;
+    portEXIT_CRITICAL(&s_pool_lock);
+}
+
+#endif /* CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL */
@@ -5,7 +5,9 @@
  */
 
 #include <string.h>
+#include "freertos/FreeRTOS.h"
 #include "esp_mbedtls_dynamic_impl.h"
+#include "esp_mbedtls_dynamic.h"
 #include "sdkconfig.h"
 
 #if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
@@ -36,7 +38,23 @@ void esp_mbedtls_free_buf(unsigned char *buf)
 {
     struct esp_mbedtls_ssl_buf *temp = __containerof(buf, struct esp_mbedtls_ssl_buf, buf[0]);
     ESP_LOGV(TAG, "free buffer @ %p", temp);
+#ifdef CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL
+    esp_mbedtls_pool_free(temp);
+#else
     mbedtls_free(temp);
+#endif
+}
+
+/* Record buffers either come straight from the heap or, with
+ * CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL, from the slab pool shared
+ * between all connections */
+static struct esp_mbedtls_ssl_buf *esp_mbedtls_calloc_ssl_buf(size_t size)
+{
+#ifdef CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL
+    return esp_mbedtls_pool_calloc(size);
+#else
+    return mbedtls_calloc(1, size);
+#endif
 }
 
 static void esp_mbedtls_init_ssl_buf(struct esp_mbedtls_ssl_buf *buf, unsigned int len)
@@ -47,6 +65,108 @@ static void esp_mbedtls_init_ssl_buf(struct esp_mbedtls_ssl_buf *buf, unsigned i
     }
 }
 
+/**
+ * Per-connection peak record buffer sizes. The connections a device really
+ * makes rarely need the full MBEDTLS_SSL_IN/OUT_CONTENT_LEN; recording the
+ * high-water mark per ssl context gives the number to size content length
+ * limits (or the shared buffer pool) against. Tracking is best effort: if
+ * the record cannot be allocated, the buffers still work, only the query
+ * reports ESP_ERR_NOT_FOUND.
+ */
+struct esp_mbedtls_buf_watermark {
+    const mbedtls_ssl_context *ssl;
+    size_t rx_peak;
+    size_t tx_peak;
+    struct esp_mbedtls_buf_watermark *next;
+};
+
+static struct esp_mbedtls_buf_watermark *s_watermark_list;
+static portMUX_TYPE s_watermark_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static struct esp_mbedtls_buf_watermark *esp_mbedtls_watermark_find(const mbedtls_ssl_context *ssl)
+{
+    struct esp_mbedtls_buf_watermark *wm;
+
+    portENTER_CRITICAL(&s_watermark_lock);
+    for (wm = s_watermark_list; wm; wm = wm->next) {
+        if (wm->ssl == ssl) {
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_watermark_lock);
+
+    return wm;
+}
+
+static void esp_mbedtls_watermark_note(const mbedtls_ssl_context *ssl, unsigned char *buf, bool is_rx)
+{
+    struct esp_mbedtls_ssl_buf *esp_buf = __containerof(buf, struct esp_mbedtls_ssl_buf, buf[0]);
+    struct esp_mbedtls_buf_watermark *wm = esp_mbedtls_watermark_find(ssl);
+
+    if (!wm) {
+        wm = mbedtls_calloc(1, sizeof(struct esp_mbedtls_buf_watermark));
+        if (!wm) {
+            return;
+        }
+        wm->ssl = ssl;
+        portENTER_CRITICAL(&s_watermark_lock);
+        wm->next = s_watermark_list;
+        s_watermark_list = wm;
+        portEXIT_CRITICAL(&s_watermark_lock);
+    }
+
+    if (is_rx) {
+        if (esp_buf->len > wm->rx_peak) {
+            wm->rx_peak = esp_buf->len;
+        }
+    } else {
+        if (esp_buf->len > wm->tx_peak) {
+            wm->tx_peak = esp_buf->len;
+        }
+    }
+}
+
+void esp_mbedtls_free_buf_watermark(mbedtls_ssl_context *ssl)
+{
+    struct esp_mbedtls_buf_watermark *wm;
+    struct esp_mbedtls_buf_watermark **prev;
+
+    portENTER_CRITICAL(&s_watermark_lock);
+    for (prev = &s_watermark_list; (wm = *prev) != NULL; prev = &wm->next) {
+        if (wm->ssl == ssl) {
+            *prev = wm->next;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_watermark_lock);
+
+    if (wm) {
+        ESP_LOGD(TAG, "connection %p buffer peaks: rx %d tx %d", ssl, (int)wm->rx_peak, (int)wm->tx_peak);
+        mbedtls_free(wm);
+    }
+}
+
+esp_err_t esp_mbedtls_get_buf_watermark(const mbedtls_ssl_context *ssl, size_t *rx_peak, size_t *tx_peak)
+{
+    if (!ssl) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    struct esp_mbedtls_buf_watermark *wm = esp_mbedtls_watermark_find(ssl);
+    if (!wm) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    if (rx_peak) {
+        *rx_peak = wm->rx_peak;
+    }
+    if (tx_peak) {
+        *tx_peak = wm->tx_peak;
+    }
+
+    return ESP_OK;
+}
+
 static void esp_mbedtls_parse_record_header(mbedtls_ssl_context *ssl)
 {
     ssl->MBEDTLS_PRIVATE(in_msgtype) =  ssl->MBEDTLS_PRIVATE(in_hdr)[0];
@@ -97,6 +217,8 @@ static void init_tx_buffer(mbedtls_ssl_context *ssl, unsigned char *buf)
         ssl->MBEDTLS_PRIVATE(out_msg) = ssl->MBEDTLS_PRIVATE(out_buf) + out_msg_off;
 
         ESP_LOGV(TAG, "out msg offset is %d", out_msg_off);
+
+        esp_mbedtls_watermark_note(ssl, buf, false);
     }
 
     ssl->MBEDTLS_PRIVATE(out_msgtype) = 0;
@@ -133,6 +255,8 @@ static void init_rx_buffer(mbedtls_ssl_context *ssl, unsigned char *buf)
         ssl->MBEDTLS_PRIVATE(in_msg) = ssl->MBEDTLS_PRIVATE(in_buf) + in_msg_off;
 
         ESP_LOGV(TAG, "in msg offset is %d", in_msg_off);
+
+        esp_mbedtls_watermark_note(ssl, buf, true);
     }
 
     ssl->MBEDTLS_PRIVATE(in_msgtype) = 0;
@@ -149,7 +273,7 @@ static int esp_mbedtls_alloc_tx_buf(mbedtls_ssl_context *ssl, int len)
         ssl->MBEDTLS_PRIVATE(out_buf) = NULL;
     }
 
-    esp_buf = mbedtls_calloc(1, SSL_BUF_HEAD_OFFSET_SIZE + len);
+    esp_buf = esp_mbedtls_calloc_ssl_buf(SSL_BUF_HEAD_OFFSET_SIZE + len);
     if (!esp_buf) {
         ESP_LOGE(TAG, "alloc(%d bytes) failed", SSL_BUF_HEAD_OFFSET_SIZE + len);
         return MBEDTLS_ERR_SSL_ALLOC_FAILED;
@@ -210,7 +334,7 @@ int esp_mbedtls_reset_add_rx_buffer(mbedtls_ssl_context *ssl)
         ssl->MBEDTLS_PRIVATE(in_buf) = NULL;
     }
 
-    esp_buf = mbedtls_calloc(1, SSL_BUF_HEAD_OFFSET_SIZE + MBEDTLS_SSL_IN_BUFFER_LEN);
+    esp_buf = esp_mbedtls_calloc_ssl_buf(SSL_BUF_HEAD_OFFSET_SIZE + MBEDTLS_SSL_IN_BUFFER_LEN);
     if (!esp_buf) {
         ESP_LOGE(TAG, "alloc(%d bytes) failed", SSL_BUF_HEAD_OFFSET_SIZE + MBEDTLS_SSL_IN_BUFFER_LEN);
         return MBEDTLS_ERR_SSL_ALLOC_FAILED;
@@ -261,7 +385,7 @@ int esp_mbedtls_add_tx_buffer(mbedtls_ssl_context *ssl, size_t buffer_len)
 
     buffer_len = tx_buffer_len(ssl, buffer_len);
 
-    esp_buf = mbedtls_calloc(1, SSL_BUF_HEAD_OFFSET_SIZE + buffer_len);
+    esp_buf = esp_mbedtls_calloc_ssl_buf(SSL_BUF_HEAD_OFFSET_SIZE + buffer_len);
     if (!esp_buf) {
         ESP_LOGE(TAG, "alloc(%zu bytes) failed", SSL_BUF_HEAD_OFFSET_SIZE + buffer_len);
         ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
@@ -306,7 +430,7 @@ int esp_mbedtls_free_tx_buffer(mbedtls_ssl_context *ssl)
     esp_mbedtls_free_buf(ssl->MBEDTLS_PRIVATE(out_buf));
     init_tx_buffer(ssl, NULL);
 
-    esp_buf = mbedtls_calloc(1, SSL_BUF_HEAD_OFFSET_SIZE + TX_IDLE_BUFFER_SIZE);
+    esp_buf = esp_mbedtls_calloc_ssl_buf(SSL_BUF_HEAD_OFFSET_SIZE + TX_IDLE_BUFFER_SIZE);
     if (!esp_buf) {
         ESP_LOGE(TAG, "alloc(%d bytes) failed", SSL_BUF_HEAD_OFFSET_SIZE + TX_IDLE_BUFFER_SIZE);
         return MBEDTLS_ERR_SSL_ALLOC_FAILED;
@@ -374,7 +498,7 @@ int esp_mbedtls_add_rx_buffer(mbedtls_ssl_context *ssl)
         init_rx_buffer(ssl, NULL);
     }
 
-    esp_buf = mbedtls_calloc(1, SSL_BUF_HEAD_OFFSET_SIZE + buffer_len);
+    esp_buf = esp_mbedtls_calloc_ssl_buf(SSL_BUF_HEAD_OFFSET_SIZE + buffer_len);
     if (!esp_buf) {
         ESP_LOGE(TAG, "alloc(%d bytes) failed", SSL_BUF_HEAD_OFFSET_SIZE + buffer_len);
         ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
@@ -440,7 +564,7 @@ int esp_mbedtls_free_rx_buffer(mbedtls_ssl_context *ssl)
     esp_mbedtls_free_buf(ssl->MBEDTLS_PRIVATE(in_buf));
     init_rx_buffer(ssl, NULL);
 
-    esp_buf = mbedtls_calloc(1, SSL_BUF_HEAD_OFFSET_SIZE + 16);
+    esp_buf = esp_mbedtls_calloc_ssl_buf(SSL_BUF_HEAD_OFFSET_SIZE + 16);
     if (!esp_buf) {
         ESP_LOGE(TAG, "alloc(%d bytes) failed", SSL_BUF_HEAD_OFFSET_SIZE + 16);
         ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
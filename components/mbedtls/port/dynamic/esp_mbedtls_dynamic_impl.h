@@ -60,8 +60,16 @@ struct esp_mbedtls_ssl_buf {
 
 #define SSL_BUF_HEAD_OFFSET_SIZE ((int)offsetof(struct esp_mbedtls_ssl_buf, buf))
 
+#ifdef CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL
+struct esp_mbedtls_ssl_buf *esp_mbedtls_pool_calloc(size_t size);
+
+void esp_mbedtls_pool_free(struct esp_mbedtls_ssl_buf *buf);
+#endif
+
 void esp_mbedtls_free_buf(unsigned char *buf);
 
+void esp_mbedtls_free_buf_watermark(mbedtls_ssl_context *ssl);
+
 int esp_mbedtls_setup_tx_buffer(mbedtls_ssl_context *ssl);
 
 void esp_mbedtls_setup_rx_buffer(mbedtls_ssl_context *ssl);
@@ -366,6 +366,8 @@ void __wrap_mbedtls_ssl_free(mbedtls_ssl_context *ssl)
         ssl->MBEDTLS_PRIVATE(in_buf) = NULL;
     }
 
+    esp_mbedtls_free_buf_watermark(ssl);
+
     __real_mbedtls_ssl_free(ssl);
 }
 
@@ -13,6 +13,68 @@
 #include "hal/ecc_hal.h"
 #include "hal/ecc_ll.h"
 #include "soc/soc_caps.h"
+#include "sdkconfig.h"
+
+#if defined(CONFIG_MBEDTLS_ECC_USE_INTERRUPT)
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_intr_alloc.h"
+#include "esp_log.h"
+#include "soc/interrupts.h"
+
+/* A single point multiplication takes a few milliseconds at most */
+#define ECC_WAIT_INTR_TIMEOUT_MS 100
+
+static const char *TAG = "esp-ecc";
+
+static SemaphoreHandle_t s_op_complete_sem;
+
+static IRAM_ATTR void esp_ecc_complete_isr(void *arg)
+{
+    BaseType_t higher_woken;
+    ecc_ll_clear_interrupt();
+    xSemaphoreGiveFromISR(s_op_complete_sem, &higher_woken);
+    if (higher_woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void esp_ecc_isr_initialise(void)
+{
+    if (s_op_complete_sem == NULL) {
+        esp_err_t ret = esp_intr_alloc(ETS_ECC_INTR_SOURCE, 0, esp_ecc_complete_isr, NULL, NULL);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to allocate ECC interrupt %d", ret);
+            // This should be treated as a fatal error as this API would mostly
+            // be invoked within the mbedTLS interface. There is no way for the
+            // system to proceed if the ECC interrupt allocation fails here.
+            abort();
+        }
+
+        static StaticSemaphore_t op_sem_buf;
+        s_op_complete_sem = xSemaphoreCreateBinaryStatic(&op_sem_buf);
+        // Static semaphore creation is unlikely to fail but still basic sanity
+        assert(s_op_complete_sem != NULL);
+    }
+}
+#endif /* CONFIG_MBEDTLS_ECC_USE_INTERRUPT */
+
+/* Wait for the started operation to finish.
+ * Returns 0 on completion, -1 if the completion interrupt timed out. */
+static int esp_ecc_wait_op_complete(void)
+{
+#if defined(CONFIG_MBEDTLS_ECC_USE_INTERRUPT)
+    if (!xSemaphoreTake(s_op_complete_sem, ECC_WAIT_INTR_TIMEOUT_MS / portTICK_PERIOD_MS)) {
+        ESP_LOGE(TAG, "Timed out waiting for ECC operation to complete");
+        return -1;
+    }
+#else
+    while (!ecc_hal_is_calc_finished()) {
+        ;
+    }
+#endif
+    return 0;
+}
 
 static void esp_ecc_acquire_hardware(void)
 {
@@ -23,10 +85,20 @@ static void esp_ecc_acquire_hardware(void)
         ecc_ll_power_up();
         ecc_ll_reset_register();
     }
+
+#if defined(CONFIG_MBEDTLS_ECC_USE_INTERRUPT)
+    esp_ecc_isr_initialise();
+    ecc_ll_clear_interrupt();
+    ecc_ll_enable_interrupt();
+#endif
 }
 
 static void esp_ecc_release_hardware(void)
 {
+#if defined(CONFIG_MBEDTLS_ECC_USE_INTERRUPT)
+    ecc_ll_disable_interrupt();
+#endif
+
     ECC_RCC_ATOMIC() {
         ecc_ll_enable_bus_clock(false);
         ecc_ll_power_down();
@@ -59,12 +131,10 @@ int esp_ecc_point_multiply(const ecc_point_t *point, const uint8_t *scalar, ecc_
 
     result->len = len;
 
-    while (!ecc_hal_is_calc_finished()) {
-        ;
+    if (esp_ecc_wait_op_complete() == 0) {
+        ret = ecc_hal_read_mul_result(result->x, result->y, len);
     }
 
-    ret = ecc_hal_read_mul_result(result->x, result->y, len);
-
     esp_ecc_release_hardware();
 
     return ret;
@@ -79,12 +149,12 @@ int esp_ecc_point_verify(const ecc_point_t *point)
     ecc_hal_set_mode(ECC_MODE_VERIFY);
     ecc_hal_start_calc();
 
-    while (!ecc_hal_is_calc_finished()) {
-        ;
+    if (esp_ecc_wait_op_complete() == 0) {
+        result = ecc_hal_read_verify_result();
+    } else {
+        result = 0; // treat a completion timeout as a failed verification
     }
 
-    result = ecc_hal_read_verify_result();
-
     esp_ecc_release_hardware();
 
     return result;
@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Usage counters of the shared TLS record buffer pool,
+ *        see CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL
+ */
+typedef struct {
+    uint32_t checkout_count;        /*!< Record buffers handed out from the pool */
+    uint32_t contended_count;       /*!< Checkouts that had to wait for a buffer to be returned */
+    uint32_t heap_fallback_count;   /*!< Allocations served from the heap because the pool stayed exhausted past the timeout */
+    uint32_t total_wait_ms;         /*!< Accumulated time spent waiting for a pool buffer */
+    uint32_t max_wait_ms;           /*!< Longest single wait for a pool buffer */
+    uint32_t free_count;            /*!< Pool buffers currently free */
+    uint32_t min_free_count;        /*!< Low watermark of free pool buffers */
+} esp_mbedtls_ssl_buf_pool_stats_t;
+
+#ifdef CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL
+
+/**
+ * @brief Get the usage counters of the shared TLS record buffer pool
+ *
+ * A non-zero contended count with low wait times is the intended operating
+ * point; a growing heap fall-back count means the pool is too small for the
+ * number of connections that process records simultaneously.
+ *
+ * @param[out] stats Filled with a snapshot of the pool counters
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if stats is NULL
+ */
+esp_err_t esp_mbedtls_ssl_buf_pool_get_stats(esp_mbedtls_ssl_buf_pool_stats_t *stats);
+
+/**
+ * @brief Reset the cumulative counters of the shared TLS record buffer pool
+ *
+ * The current free count is kept, the watermark restarts from it.
+ */
+void esp_mbedtls_ssl_buf_pool_reset_stats(void);
+
+#else /* CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL */
+
+static inline esp_err_t esp_mbedtls_ssl_buf_pool_get_stats(esp_mbedtls_ssl_buf_pool_stats_t *stats)
+{
+    (void) stats;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static inline void esp_mbedtls_ssl_buf_pool_reset_stats(void)
+{
+}
+
+#endif /* CONFIG_MBEDTLS_DYNAMIC_BUFFER_POOL */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include "mbedtls/ssl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CONFIG_MBEDTLS_DYNAMIC_BUFFER
+
+/**
+ * @brief Get the peak record buffer sizes of a connection
+ *
+ * With CONFIG_MBEDTLS_DYNAMIC_BUFFER the RX and TX record buffers are
+ * allocated per record at their exact size instead of the fixed
+ * MBEDTLS_SSL_IN/OUT_CONTENT_LEN. This reports the largest buffer either
+ * direction actually needed over the lifetime of the connection (the
+ * certificate chain during the handshake, typically), which is the number
+ * to use when sizing content length limits or the shared buffer pool for
+ * a fleet.
+ *
+ * @param[in]  ssl     SSL context the peaks are recorded for
+ * @param[out] rx_peak Largest RX record buffer allocated so far, may be NULL
+ * @param[out] tx_peak Largest TX record buffer allocated so far, may be NULL
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if ssl is NULL
+ *      - ESP_ERR_NOT_FOUND if no buffer has been allocated for this
+ *        connection yet (or the tracking record could not be allocated)
+ */
+esp_err_t esp_mbedtls_get_buf_watermark(const mbedtls_ssl_context *ssl, size_t *rx_peak, size_t *tx_peak);
+
+#else /* CONFIG_MBEDTLS_DYNAMIC_BUFFER */
+
+static inline esp_err_t esp_mbedtls_get_buf_watermark(const mbedtls_ssl_context *ssl, size_t *rx_peak, size_t *tx_peak)
+{
+    (void)ssl;
+    (void)rx_peak;
+    (void)tx_peak;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif /* !CONFIG_MBEDTLS_DYNAMIC_BUFFER */
+
+#ifdef __cplusplus
+}
+#endif
@@ -65,6 +65,27 @@ static uint64_t s_boot_time; // when RTC is used to persist time, two RTC_STORE
 
 static _lock_t s_boot_time_lock;
 
+/* Seqlock-published copy of the boot time. Readers on the gettimeofday() fast
+ * path use it without taking s_boot_time_lock (and, when the RTC registers
+ * persist the boot time, without the slow register reads). An odd sequence
+ * number means an update is in progress; zero means the cache has not been
+ * seeded yet. The fields are volatile 32-bit words: volatile accesses keep
+ * the program order on these in-order cores, and 32-bit stores are atomic. */
+static struct {
+    volatile uint32_t seq;
+    volatile uint32_t time_lo;
+    volatile uint32_t time_hi;
+} s_boot_time_cache;
+
+static void boot_time_cache_publish(uint64_t time_us)
+{
+    /* called with s_boot_time_lock held, so there is a single writer */
+    s_boot_time_cache.seq++; // odd: update in progress
+    s_boot_time_cache.time_lo = (uint32_t) time_us;
+    s_boot_time_cache.time_hi = (uint32_t) (time_us >> 32);
+    s_boot_time_cache.seq++; // even: consistent
+}
+
 #if defined( CONFIG_ESP_TIME_FUNCS_USE_ESP_TIMER ) || defined( CONFIG_ESP_TIME_FUNCS_USE_RTC_TIMER )
 uint64_t esp_time_impl_get_time_since_boot(void)
 {
@@ -104,6 +125,7 @@ void esp_time_impl_set_boot_time(uint64_t time_us)
 #else
     s_boot_time = time_us;
 #endif
+    boot_time_cache_publish(time_us);
     _lock_release(&s_boot_time_lock);
 }
 
@@ -120,6 +142,34 @@ uint64_t esp_time_impl_get_boot_time(void)
     return result;
 }
 
+uint64_t IRAM_ATTR esp_time_impl_get_boot_time_fast(void)
+{
+    while (true) {
+        uint32_t seq = s_boot_time_cache.seq;
+        if (seq == 0) {
+            /* cache not seeded yet: take the locked path once and publish */
+            uint64_t result;
+            _lock_acquire(&s_boot_time_lock);
+#ifdef CONFIG_ESP_TIME_FUNCS_USE_RTC_TIMER
+            result = ((uint64_t) REG_READ(RTC_BOOT_TIME_LOW_REG)) + (((uint64_t) REG_READ(RTC_BOOT_TIME_HIGH_REG)) << 32);
+#else
+            result = s_boot_time;
+#endif
+            boot_time_cache_publish(result);
+            _lock_release(&s_boot_time_lock);
+            return result;
+        }
+        if (seq & 1) { // update in progress, retry
+            continue;
+        }
+        uint32_t lo = s_boot_time_cache.time_lo;
+        uint32_t hi = s_boot_time_cache.time_hi;
+        if (s_boot_time_cache.seq == seq) {
+            return ((uint64_t) hi << 32) | lo;
+        }
+    }
+}
+
 void esp_set_time_from_rtc(void)
 {
 #if defined( CONFIG_ESP_TIME_FUNCS_USE_ESP_TIMER ) && defined( CONFIG_ESP_TIME_FUNCS_USE_RTC_TIMER )
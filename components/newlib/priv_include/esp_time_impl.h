@@ -16,3 +16,7 @@ uint32_t esp_time_impl_get_time_resolution(void);
 void esp_time_impl_set_boot_time(uint64_t t);
 
 uint64_t esp_time_impl_get_boot_time(void);
+
+/* Lock-free boot time read from a seqlock-published cache; used by the
+ * gettimeofday()/clock_gettime() fast path when no adjtime() slew is active */
+uint64_t esp_time_impl_get_boot_time_fast(void);
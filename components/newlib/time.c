@@ -38,8 +38,9 @@
 // time functions are implemented -- they should not be weak
 #define WEAK_UNLESS_TIMEFUNC_IMPL
 
-// stores the start time of the slew
-static uint64_t s_adjtime_start_us;
+// stores the start time of the slew; volatile so the gettimeofday() fast path
+// can check for an active slew without taking s_time_lock
+static volatile uint64_t s_adjtime_start_us;
 // is how many microseconds total to slew
 static int64_t  s_adjtime_total_correction_us;
 
@@ -170,7 +171,16 @@ WEAK_UNLESS_TIMEFUNC_IMPL int IRAM_ATTR _gettimeofday_r(struct _reent *r, struct
 
 #if IMPL_NEWLIB_TIME_FUNCS
     if (tv) {
-        uint64_t microseconds = get_adjusted_boot_time() + esp_time_impl_get_time_since_boot();
+        uint64_t microseconds;
+        if (s_adjtime_start_us == 0) {
+            /* No adjtime() slew in progress: the boot time is constant, read
+             * it from the lock-free cache. This is the hot path for logging
+             * and tracing timestamps. */
+            microseconds = esp_time_impl_get_boot_time_fast() + esp_time_impl_get_time_since_boot();
+        } else {
+            /* A slew is active; the locked path also steps the correction */
+            microseconds = get_adjusted_boot_time() + esp_time_impl_get_time_since_boot();
+        }
         tv->tv_sec = microseconds / 1000000;
         tv->tv_usec = microseconds % 1000000;
     }
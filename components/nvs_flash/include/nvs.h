@@ -345,6 +345,70 @@ esp_err_t nvs_set_str (nvs_handle_t handle, const char* key, const char* value);
  */
 esp_err_t nvs_set_blob(nvs_handle_t handle, const char* key, const void* value, size_t length);
 
+/**
+ * @brief One key-value pair of a batch operation
+ *
+ * Only integer types are supported in batches; strings and blobs keep using
+ * the single-item functions.
+ */
+typedef struct {
+    const char *key;        /*!< Key name, same constraints as for the single-item functions */
+    nvs_type_t type;        /*!< Value type, one of the integer NVS_TYPE_x values */
+    union {
+        uint8_t  u8;        /*!< Value if type is NVS_TYPE_U8 */
+        int8_t   i8;        /*!< Value if type is NVS_TYPE_I8 */
+        uint16_t u16;       /*!< Value if type is NVS_TYPE_U16 */
+        int16_t  i16;       /*!< Value if type is NVS_TYPE_I16 */
+        uint32_t u32;       /*!< Value if type is NVS_TYPE_U32 */
+        int32_t  i32;       /*!< Value if type is NVS_TYPE_I32 */
+        uint64_t u64;       /*!< Value if type is NVS_TYPE_U64 */
+        int64_t  i64;       /*!< Value if type is NVS_TYPE_I64 */
+    } value;                /*!< Value: input for nvs_set_batch, output for nvs_get_batch */
+    esp_err_t result;       /*!< Per-entry result, filled in by the batch call */
+} nvs_batch_entry_t;
+
+/**
+ * @brief      set several integer values under one lock acquisition
+ *
+ * Equivalent to calling the matching nvs_set_x function for each entry, but
+ * the global NVS lock and the handle lookup are paid once per batch instead
+ * of once per key. Entries are processed in order; processing continues past
+ * failing entries and each entry's status is stored in its `result` field.
+ * Note that the underlying storage will not be updated until \c nvs_commit is called.
+ *
+ * @param[in]     handle   Handle obtained from nvs_open function.
+ *                         Handles that were opened read only cannot be used.
+ * @param[in,out] entries  Array of entries to set
+ * @param[in]     count    Number of entries
+ *
+ * @return
+ *             - ESP_OK if all entries were set successfully
+ *             - ESP_ERR_INVALID_ARG if entries is NULL or count is 0
+ *             - ESP_ERR_NVS_INVALID_HANDLE if handle has been closed or is NULL
+ *             - otherwise the error of the first failing entry; check the
+ *               per-entry `result` fields for details
+ */
+esp_err_t nvs_set_batch(nvs_handle_t handle, nvs_batch_entry_t *entries, size_t count);
+
+/**
+ * @brief      get several integer values under one lock acquisition
+ *
+ * Equivalent to calling the matching nvs_get_x function for each entry, with
+ * the same amortization and per-entry status reporting as nvs_set_batch().
+ *
+ * @param[in]     handle   Handle obtained from nvs_open function.
+ * @param[in,out] entries  Array of entries; each entry's `value` is filled on success
+ * @param[in]     count    Number of entries
+ *
+ * @return
+ *             - ESP_OK if all entries were read successfully
+ *             - ESP_ERR_INVALID_ARG if entries is NULL or count is 0
+ *             - ESP_ERR_NVS_INVALID_HANDLE if handle has been closed or is NULL
+ *             - otherwise the error of the first failing entry; check the
+ *               per-entry `result` fields for details
+ */
+esp_err_t nvs_get_batch(nvs_handle_t handle, nvs_batch_entry_t *entries, size_t count);
+
 /**@{*/
 /**
  * @brief      get int8_t value for given key
@@ -499,6 +563,61 @@ esp_err_t nvs_get_str (nvs_handle_t handle, const char* key, char* out_value, si
  * This function behaves the same as \c nvs_get_str, except for the data type.
  */
 esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key, void* out_value, size_t* length);
+
+/**
+ * @brief      read a range of a blob value for given key
+ *
+ * Reads `length` bytes of the blob starting at byte `offset` into `out_value`.
+ * Only the chunks overlapping the range are read from flash, so a large blob
+ * can be consumed piece by piece with a small, fixed-size buffer instead of
+ * being double-buffered through a full-size allocation.
+ *
+ * @param[in]  handle    Handle obtained from nvs_open function.
+ * @param[in]  key       Key name. Maximum length is (NVS_KEY_NAME_MAX_SIZE-1) characters. Shouldn't be empty.
+ * @param[in]  offset    Byte offset inside the stored blob to start reading at.
+ * @param[out] out_value Buffer receiving the data.
+ * @param[in]  length    Number of bytes to read. offset + length must not
+ *                       exceed the stored blob size.
+ *
+ * @return
+ *             - ESP_OK if the range was retrieved successfully
+ *             - ESP_FAIL if there is an internal error; most likely due to corrupted
+ *               NVS partition (only if NVS assertion checks are disabled)
+ *             - ESP_ERR_NVS_NOT_FOUND if the requested key doesn't exist
+ *             - ESP_ERR_NVS_INVALID_HANDLE if handle has been closed or is NULL
+ *             - ESP_ERR_NVS_INVALID_NAME if key name doesn't satisfy constraints
+ *             - ESP_ERR_NVS_INVALID_LENGTH if offset + length exceeds the stored blob size
+ */
+esp_err_t nvs_get_blob_range(nvs_handle_t handle, const char* key, size_t offset, void* out_value, size_t length);
+
+/**
+ * @brief      Enable a RAM cache of small values for the given handle
+ *
+ * When enabled, values of primitive types (integers of up to 8 bytes) read or
+ * written through this handle are kept in a small RAM cache, and repeated
+ * nvs_get calls for them are served from RAM without touching flash. Writes
+ * remain write-through: the value is stored in flash first and the cached
+ * copy is updated only on success.
+ *
+ * The cache tracks modifications made through this handle only. If the same
+ * keys may also be written through another handle of the same namespace, call
+ * nvs_commit() on this handle to drop the cached values and re-read them from
+ * flash. Passing cache_size 0 disables the cache again.
+ *
+ * Available only when CONFIG_NVS_HANDLE_VALUE_CACHE is enabled.
+ *
+ * @param[in]  handle      Handle obtained from nvs_open function.
+ * @param[in]  cache_size  RAM budget for the cache in bytes. Each cached
+ *                         value occupies roughly 28 bytes.
+ *
+ * @return
+ *             - ESP_OK if the cache was enabled (or disabled) successfully
+ *             - ESP_ERR_NVS_INVALID_HANDLE if handle has been closed or is NULL
+ *             - ESP_ERR_INVALID_ARG if cache_size is non-zero but too small for a single entry
+ *             - ESP_ERR_NO_MEM if the cache could not be allocated
+ *             - ESP_ERR_NOT_SUPPORTED if CONFIG_NVS_HANDLE_VALUE_CACHE is disabled
+ */
+esp_err_t nvs_enable_value_cache(nvs_handle_t handle, size_t cache_size);
 /**@}*/
 
 /**
@@ -635,6 +754,42 @@ typedef struct {
  */
 esp_err_t nvs_get_stats(const char *part_name, nvs_stats_t *nvs_stats);
 
+/**
+ * @note Info about flash wear of an NVS partition.
+ */
+typedef struct {
+    uint32_t min_erase_count; /**< Lowest erase count over all sectors of the partition. */
+    uint32_t max_erase_count; /**< Highest erase count over all sectors of the partition. */
+    uint32_t avg_erase_count; /**< Average erase count over all sectors of the partition. */
+    uint32_t sector_count;    /**< Number of sectors the partition consists of. */
+} nvs_wear_stats_t;
+
+/**
+ * @brief      Fill structure nvs_wear_stats_t. It provides info about flash wear of an NVS partition.
+ *
+ * NVS maintains a per-sector erase counter in the page header and prefers the
+ * least erased spare page when a new page is brought into use. This function
+ * reports the minimum, maximum and average erase count over all sectors of the
+ * partition, which allows estimating the remaining flash life from measured
+ * data.
+ *
+ * Erase counts are persisted when a page is (re)initialized; pages erased but
+ * not yet reused at the time of an unclean shutdown may under-report by one
+ * erase. Pages written by IDF versions without the counter start at zero.
+ *
+ * @param[in]   part_name   Partition name NVS in the partition table.
+ *                          If pass a NULL than will use NVS_DEFAULT_PART_NAME ("nvs").
+ *
+ * @param[out]  wear_stats  Returns filled structure nvs_wear_stats_t.
+ *
+ * @return
+ *             - ESP_OK if the statistics were retrieved successfully
+ *             - ESP_ERR_NVS_PART_NOT_FOUND if the partition with label "name" is not found
+ *             - ESP_ERR_NVS_NOT_INITIALIZED if the storage driver is not initialized
+ *             - ESP_ERR_INVALID_ARG if wear_stats is equal to NULL
+ */
+esp_err_t nvs_get_wear_stats(const char *part_name, nvs_wear_stats_t *wear_stats);
+
 /**
  * @brief      Calculate all entries in a namespace.
  *
@@ -0,0 +1,165 @@
+#!/usr/bin/env python
+#
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Generates a C header with typed NVS accessor functions from a CSV schema.
+#
+# Schema format (one entry per line):
+#
+#     namespace,key,type[,default]
+#
+# where type is one of: u8, i8, u16, i16, u32, i32, u64, i64, str, blob.
+# Lines starting with '#' and blank lines are ignored.
+#
+# For every entry the generated header contains static inline get/set wrappers
+# with the key and namespace baked in, so a typo in a key or a type mismatch
+# becomes a compile error instead of ESP_ERR_NVS_NOT_FOUND at run time. For
+# integer entries with a default, the get wrapper returns the default when the
+# key is not present.
+#
+# Example:
+#
+#     python nvs_accessor_gen.py schema.csv app_nvs_accessors.h --prefix app
+
+import argparse
+import csv
+import os
+import re
+import sys
+
+INT_TYPES = {
+    'u8': 'uint8_t', 'i8': 'int8_t',
+    'u16': 'uint16_t', 'i16': 'int16_t',
+    'u32': 'uint32_t', 'i32': 'int32_t',
+    'u64': 'uint64_t', 'i64': 'int64_t',
+}
+
+MAX_KEY_LEN = 15        # NVS_KEY_NAME_MAX_SIZE - 1
+MAX_NS_LEN = 15
+
+HEADER = '''\
+/*
+ * Typed NVS accessors generated by nvs_accessor_gen.py -- do not edit.
+ *
+ * Schema: {schema}
+ */
+#pragma once
+
+#include "nvs.h"
+
+#ifdef __cplusplus
+extern "C" {{
+#endif
+'''
+
+FOOTER = '''\
+
+#ifdef __cplusplus
+}
+#endif
+'''
+
+
+def c_ident(name):
+    ident = re.sub(r'[^A-Za-z0-9_]', '_', name)
+    if ident[0].isdigit():
+        ident = '_' + ident
+    return ident
+
+
+def gen_int_accessors(out, prefix, ns, key, nvs_type, default):
+    ctype = INT_TYPES[nvs_type]
+    fn = '{}_{}_{}'.format(prefix, c_ident(ns), c_ident(key))
+    out.append('')
+    out.append('static inline esp_err_t {}_get(nvs_handle_t handle, {} *out_value)'.format(fn, ctype))
+    out.append('{')
+    if default is not None:
+        out.append('    esp_err_t err = nvs_get_{}(handle, "{}", out_value);'.format(nvs_type, key))
+        out.append('    if (err == ESP_ERR_NVS_NOT_FOUND) {')
+        out.append('        *out_value = {};'.format(default))
+        out.append('        err = ESP_OK;')
+        out.append('    }')
+        out.append('    return err;')
+    else:
+        out.append('    return nvs_get_{}(handle, "{}", out_value);'.format(nvs_type, key))
+    out.append('}')
+    out.append('')
+    out.append('static inline esp_err_t {}_set(nvs_handle_t handle, {} value)'.format(fn, ctype))
+    out.append('{')
+    out.append('    return nvs_set_{}(handle, "{}", value);'.format(nvs_type, key))
+    out.append('}')
+
+
+def gen_var_accessors(out, prefix, ns, key, nvs_type):
+    fn = '{}_{}_{}'.format(prefix, c_ident(ns), c_ident(key))
+    if nvs_type == 'str':
+        get_args, get_call = 'char *out_value, size_t *length', 'nvs_get_str(handle, "{}", out_value, length)'.format(key)
+        set_args, set_call = 'const char *value', 'nvs_set_str(handle, "{}", value)'.format(key)
+    else:
+        get_args, get_call = 'void *out_value, size_t *length', 'nvs_get_blob(handle, "{}", out_value, length)'.format(key)
+        set_args, set_call = 'const void *value, size_t length', 'nvs_set_blob(handle, "{}", value, length)'.format(key)
+    out.append('')
+    out.append('static inline esp_err_t {}_get(nvs_handle_t handle, {})'.format(fn, get_args))
+    out.append('{')
+    out.append('    return {};'.format(get_call))
+    out.append('}')
+    out.append('')
+    out.append('static inline esp_err_t {}_set(nvs_handle_t handle, {})'.format(fn, set_args))
+    out.append('{')
+    out.append('    return {};'.format(set_call))
+    out.append('}')
+
+
+def generate(schema_path, output_path, prefix):
+    out = []
+    namespaces = []
+    with open(schema_path, newline='') as schema_file:
+        for line_no, row in enumerate(csv.reader(schema_file), start=1):
+            if not row or row[0].lstrip().startswith('#'):
+                continue
+            if len(row) not in (3, 4):
+                raise SystemExit('{}:{}: expected namespace,key,type[,default]'.format(schema_path, line_no))
+            ns, key, nvs_type = (field.strip() for field in row[:3])
+            default = row[3].strip() if len(row) == 4 else None
+            if len(key) > MAX_KEY_LEN:
+                raise SystemExit('{}:{}: key "{}" longer than {} characters'.format(schema_path, line_no, key, MAX_KEY_LEN))
+            if len(ns) > MAX_NS_LEN:
+                raise SystemExit('{}:{}: namespace "{}" longer than {} characters'.format(schema_path, line_no, ns, MAX_NS_LEN))
+            if ns not in namespaces:
+                namespaces.append(ns)
+            if nvs_type in INT_TYPES:
+                gen_int_accessors(out, prefix, ns, key, nvs_type, default)
+            elif nvs_type in ('str', 'blob'):
+                if default is not None:
+                    raise SystemExit('{}:{}: defaults are only supported for integer types'.format(schema_path, line_no))
+                gen_var_accessors(out, prefix, ns, key, nvs_type)
+            else:
+                raise SystemExit('{}:{}: unknown type "{}"'.format(schema_path, line_no, nvs_type))
+
+    # One open helper per namespace, so the namespace string is baked in too
+    for ns in namespaces:
+        out.append('')
+        out.append('static inline esp_err_t {}_{}_open(nvs_open_mode_t open_mode, nvs_handle_t *out_handle)'.format(prefix, c_ident(ns)))
+        out.append('{')
+        out.append('    return nvs_open("{}", open_mode, out_handle);'.format(ns))
+        out.append('}')
+
+    with open(output_path, 'w') as output_file:
+        output_file.write(HEADER.format(schema=os.path.basename(schema_path)))
+        output_file.write('\n'.join(out))
+        output_file.write(FOOTER)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate typed NVS accessors from a CSV schema')
+    parser.add_argument('schema', help='CSV schema file (namespace,key,type[,default])')
+    parser.add_argument('output', help='Header file to write')
+    parser.add_argument('--prefix', default='nvs_gen', help='Prefix of the generated functions (default: nvs_gen)')
+    args = parser.parse_args()
+    generate(args.schema, args.output, args.prefix)
+
+
+if __name__ == '__main__':
+    main()
@@ -87,6 +87,15 @@ static esp_err_t close_handles_and_deinit(const char* part_name)
         it = find_if(begin(s_nvs_handles), end(s_nvs_handles), belongs_to_part);
     }
 
+    // Drain any operation still running on this partition: new operations
+    // cannot start (the global lock is held), so taking and releasing the
+    // storage lock once guarantees the storage is idle before it is deleted.
+    nvs::Storage *storage = lookup_storage_from_name(part_name);
+    if (storage != nullptr) {
+        storage->opLock();
+        storage->opUnlock();
+    }
+
     // Deinit partition
     return NVSPartitionManager::get_instance()->deinit_partition(part_name);
 }
@@ -263,6 +272,37 @@ static esp_err_t nvs_find_ns_handle(nvs_handle_t c_handle, NVSHandleSimple** han
     return ESP_OK;
 }
 
+/**
+ * RAII guard of the per-storage operation lock. The global lock is only held
+ * long enough to resolve the handle and attach the guard, so item operations
+ * on different partitions no longer convoy behind one mutex. Operations within
+ * one partition still serialize: pages and the free-page pool are shared
+ * between namespaces. Lock order is always global -> storage.
+ */
+class StorageOpGuard
+{
+public:
+    StorageOpGuard() : mStorage(nullptr) { }
+
+    void attach(nvs::Storage *storage)
+    {
+        mStorage = storage;
+        if (mStorage != nullptr) {
+            mStorage->opLock();
+        }
+    }
+
+    ~StorageOpGuard()
+    {
+        if (mStorage != nullptr) {
+            mStorage->opUnlock();
+        }
+    }
+
+private:
+    nvs::Storage *mStorage;
+};
+
 extern "C" esp_err_t nvs_open_from_partition(const char *part_name, const char* namespace_name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
 {
     esp_err_t lock_result = Lock::init();
@@ -295,6 +335,9 @@ extern "C" esp_err_t nvs_open(const char* namespace_name, nvs_open_mode_t open_m
 
 extern "C" void nvs_close(nvs_handle_t handle)
 {
+    // Taking the storage lock waits out any operation still running on this
+    // handle's partition before the handle is destroyed.
+    StorageOpGuard op;
     Lock lock;
     ESP_LOGD(TAG, "%s %d", __func__, static_cast<int>(handle));
     auto it = find_if(begin(s_nvs_handles), end(s_nvs_handles), [=](NVSHandleEntry& e) -> bool {
@@ -303,18 +346,24 @@ extern "C" void nvs_close(nvs_handle_t handle)
     if (it == end(s_nvs_handles)) {
         return;
     }
+    op.attach(it->nvs_handle->get_storage());
     s_nvs_handles.erase(it);
     delete static_cast<NVSHandleEntry*>(it);
 }
 
 extern "C" esp_err_t nvs_find_key(nvs_handle_t c_handle, const char* key, nvs_type_t* out_type)
 {
-    Lock lock;
-    ESP_LOGD(TAG, "%s %s", __func__, key);
+    StorageOpGuard op;
     NVSHandleSimple *handle;
-    auto err = nvs_find_ns_handle(c_handle, &handle);
-    if (err != ESP_OK) {
-        return err;
+    esp_err_t err;
+    {
+        Lock lock;
+        ESP_LOGD(TAG, "%s %s", __func__, key);
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
     }
 
     nvs_type_t nvstype;
@@ -328,12 +377,17 @@ extern "C" esp_err_t nvs_find_key(nvs_handle_t c_handle, const char* key, nvs_ty
 
 extern "C" esp_err_t nvs_erase_key(nvs_handle_t c_handle, const char* key)
 {
-    Lock lock;
-    ESP_LOGD(TAG, "%s %s", __func__, key);
+    StorageOpGuard op;
     NVSHandleSimple *handle;
-    auto err = nvs_find_ns_handle(c_handle, &handle);
-    if (err != ESP_OK) {
-        return err;
+    esp_err_t err;
+    {
+        Lock lock;
+        ESP_LOGD(TAG, "%s %s", __func__, key);
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
     }
 
     return handle->erase_item(key);
@@ -341,12 +395,17 @@ extern "C" esp_err_t nvs_erase_key(nvs_handle_t c_handle, const char* key)
 
 extern "C" esp_err_t nvs_erase_all(nvs_handle_t c_handle)
 {
-    Lock lock;
-    ESP_LOGD(TAG, "%s", __func__);
+    StorageOpGuard op;
     NVSHandleSimple *handle;
-    auto err = nvs_find_ns_handle(c_handle, &handle);
-    if (err != ESP_OK) {
-        return err;
+    esp_err_t err;
+    {
+        Lock lock;
+        ESP_LOGD(TAG, "%s", __func__);
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
     }
 
     return handle->erase_all();
@@ -355,12 +414,17 @@ extern "C" esp_err_t nvs_erase_all(nvs_handle_t c_handle)
 template<typename T>
 static esp_err_t nvs_set(nvs_handle_t c_handle, const char* key, T value)
 {
-    Lock lock;
-    ESP_LOGD(TAG, "%s %s %d %ld", __func__, key, static_cast<int>(sizeof(T)), static_cast<long int>(value));
+    StorageOpGuard op;
     NVSHandleSimple *handle;
-    auto err = nvs_find_ns_handle(c_handle, &handle);
-    if (err != ESP_OK) {
-        return err;
+    esp_err_t err;
+    {
+        Lock lock;
+        ESP_LOGD(TAG, "%s %s %d %ld", __func__, key, static_cast<int>(sizeof(T)), static_cast<long int>(value));
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
     }
 
     return handle->set_item(key, value);
@@ -408,51 +472,154 @@ extern "C" esp_err_t nvs_set_u64 (nvs_handle_t handle, const char* key, uint64_t
 
 extern "C" esp_err_t nvs_commit(nvs_handle_t c_handle)
 {
-    Lock lock;
-    // no-op for now, to be used when intermediate cache is added
+    StorageOpGuard op;
     NVSHandleSimple *handle;
-    auto err = nvs_find_ns_handle(c_handle, &handle);
-    if (err != ESP_OK) {
-        return err;
+    esp_err_t err;
+    {
+        Lock lock;
+        // no-op for now, to be used when intermediate cache is added
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
     }
     return handle->commit();
 }
 
 extern "C" esp_err_t nvs_set_str(nvs_handle_t c_handle, const char* key, const char* value)
 {
-    Lock lock;
-    ESP_LOGD(TAG, "%s %s %s", __func__, key, value);
+    StorageOpGuard op;
     NVSHandleSimple *handle;
-    auto err = nvs_find_ns_handle(c_handle, &handle);
-    if (err != ESP_OK) {
-        return err;
+    esp_err_t err;
+    {
+        Lock lock;
+        ESP_LOGD(TAG, "%s %s %s", __func__, key, value);
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
     }
     return handle->set_string(key, value);
 }
 
 extern "C" esp_err_t nvs_set_blob(nvs_handle_t c_handle, const char* key, const void* value, size_t length)
 {
-    Lock lock;
-    ESP_LOGD(TAG, "%s %s %d", __func__, key, static_cast<int>(length));
+    StorageOpGuard op;
     NVSHandleSimple *handle;
-    auto err = nvs_find_ns_handle(c_handle, &handle);
-    if (err != ESP_OK) {
-        return err;
+    esp_err_t err;
+    {
+        Lock lock;
+        ESP_LOGD(TAG, "%s %s %d", __func__, key, static_cast<int>(length));
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
     }
     return handle->set_blob(key, value, length);
 }
 
+template<bool IsSet>
+static esp_err_t nvs_batch_op(nvs_handle_t c_handle, nvs_batch_entry_t *entries, size_t count)
+{
+    if (entries == nullptr || count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    StorageOpGuard op;
+    NVSHandleSimple *handle;
+    esp_err_t err;
+    {
+        Lock lock;
+        ESP_LOGD(TAG, "%s %d entries", __func__, static_cast<int>(count));
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
+    }
+
+    esp_err_t first_err = ESP_OK;
+    for (size_t i = 0; i < count; i++) {
+        nvs_batch_entry_t &e = entries[i];
+        switch (e.type) {
+        case NVS_TYPE_U8:
+            e.result = IsSet ? handle->set_item(e.key, e.value.u8) : handle->get_item(e.key, e.value.u8);
+            break;
+        case NVS_TYPE_I8:
+            e.result = IsSet ? handle->set_item(e.key, e.value.i8) : handle->get_item(e.key, e.value.i8);
+            break;
+        case NVS_TYPE_U16:
+            e.result = IsSet ? handle->set_item(e.key, e.value.u16) : handle->get_item(e.key, e.value.u16);
+            break;
+        case NVS_TYPE_I16:
+            e.result = IsSet ? handle->set_item(e.key, e.value.i16) : handle->get_item(e.key, e.value.i16);
+            break;
+        case NVS_TYPE_U32:
+            e.result = IsSet ? handle->set_item(e.key, e.value.u32) : handle->get_item(e.key, e.value.u32);
+            break;
+        case NVS_TYPE_I32:
+            e.result = IsSet ? handle->set_item(e.key, e.value.i32) : handle->get_item(e.key, e.value.i32);
+            break;
+        case NVS_TYPE_U64:
+            e.result = IsSet ? handle->set_item(e.key, e.value.u64) : handle->get_item(e.key, e.value.u64);
+            break;
+        case NVS_TYPE_I64:
+            e.result = IsSet ? handle->set_item(e.key, e.value.i64) : handle->get_item(e.key, e.value.i64);
+            break;
+        default:
+            e.result = ESP_ERR_NVS_TYPE_MISMATCH;
+            break;
+        }
+        if (first_err == ESP_OK && e.result != ESP_OK) {
+            first_err = e.result;
+        }
+    }
+    return first_err;
+}
+
+extern "C" esp_err_t nvs_set_batch(nvs_handle_t c_handle, nvs_batch_entry_t *entries, size_t count)
+{
+    return nvs_batch_op<true>(c_handle, entries, count);
+}
 
-template<typename T>
-static esp_err_t nvs_get(nvs_handle_t c_handle, const char* key, T* out_value)
+extern "C" esp_err_t nvs_get_batch(nvs_handle_t c_handle, nvs_batch_entry_t *entries, size_t count)
 {
+    return nvs_batch_op<false>(c_handle, entries, count);
+}
+
+extern "C" esp_err_t nvs_enable_value_cache(nvs_handle_t c_handle, size_t cache_size)
+{
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
     Lock lock;
-    ESP_LOGD(TAG, "%s %s %ld", __func__, key, static_cast<long int>(sizeof(T)));
+    ESP_LOGD(TAG, "%s %u", __func__, static_cast<unsigned>(cache_size));
     NVSHandleSimple *handle;
-    auto err = nvs_find_ns_handle(c_handle, &handle);
+    esp_err_t err = nvs_find_ns_handle(c_handle, &handle);
     if (err != ESP_OK) {
         return err;
     }
+    return handle->enableValueCache(cache_size);
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+template<typename T>
+static esp_err_t nvs_get(nvs_handle_t c_handle, const char* key, T* out_value)
+{
+    StorageOpGuard op;
+    NVSHandleSimple *handle;
+    esp_err_t err;
+    {
+        Lock lock;
+        ESP_LOGD(TAG, "%s %s %ld", __func__, key, static_cast<long int>(sizeof(T)));
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
+    }
     return handle->get_item(key, *out_value);
 }
 
@@ -498,12 +665,17 @@ extern "C" esp_err_t nvs_get_u64 (nvs_handle_t c_handle, const char* key, uint64
 
 static esp_err_t nvs_get_str_or_blob(nvs_handle_t c_handle, nvs::ItemType type, const char* key, void* out_value, size_t* length)
 {
-    Lock lock;
-    ESP_LOGD(TAG, "%s %s", __func__, key);
+    StorageOpGuard op;
     NVSHandleSimple *handle;
-    auto err = nvs_find_ns_handle(c_handle, &handle);
-    if (err != ESP_OK) {
-        return err;
+    esp_err_t err;
+    {
+        Lock lock;
+        ESP_LOGD(TAG, "%s %s", __func__, key);
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
     }
 
     size_t dataSize;
@@ -536,6 +708,26 @@ extern "C" esp_err_t nvs_get_blob(nvs_handle_t c_handle, const char* key, void*
     return nvs_get_str_or_blob(c_handle, nvs::ItemType::BLOB, key, out_value, length);
 }
 
+extern "C" esp_err_t nvs_get_blob_range(nvs_handle_t c_handle, const char* key, size_t offset, void* out_value, size_t length)
+{
+    StorageOpGuard op;
+    NVSHandleSimple *handle;
+    esp_err_t err;
+    {
+        Lock lock;
+        ESP_LOGD(TAG, "%s %s %u %u", __func__, key, static_cast<unsigned>(offset), static_cast<unsigned>(length));
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
+    }
+    if (out_value == nullptr || length == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return handle->get_blob_range(key, offset, out_value, length);
+}
+
 extern "C" esp_err_t nvs_get_stats(const char* part_name, nvs_stats_t* nvs_stats)
 {
     Lock lock;
@@ -562,18 +754,44 @@ extern "C" esp_err_t nvs_get_stats(const char* part_name, nvs_stats_t* nvs_stats
     return pStorage->fillStats(*nvs_stats);
 }
 
-extern "C" esp_err_t nvs_get_used_entry_count(nvs_handle_t c_handle, size_t* used_entries)
+extern "C" esp_err_t nvs_get_wear_stats(const char* part_name, nvs_wear_stats_t* wear_stats)
 {
     Lock lock;
+    nvs::Storage* pStorage;
+
+    if (wear_stats == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pStorage = lookup_storage_from_name((part_name == nullptr) ? NVS_DEFAULT_PART_NAME : part_name);
+    if (pStorage == nullptr) {
+        return ESP_ERR_NVS_NOT_INITIALIZED;
+    }
+
+    if(!pStorage->isValid()){
+        return ESP_ERR_NVS_INVALID_STATE;
+    }
+
+    return pStorage->fillWearStats(*wear_stats);
+}
+
+extern "C" esp_err_t nvs_get_used_entry_count(nvs_handle_t c_handle, size_t* used_entries)
+{
     if(used_entries == nullptr){
         return ESP_ERR_INVALID_ARG;
     }
     *used_entries = 0;
 
+    StorageOpGuard op;
     NVSHandleSimple *handle;
-    auto err = nvs_find_ns_handle(c_handle, &handle);
-    if (err != ESP_OK) {
-        return err;
+    esp_err_t err;
+    {
+        Lock lock;
+        err = nvs_find_ns_handle(c_handle, &handle);
+        if (err != ESP_OK) {
+            return err;
+        }
+        op.attach(handle->get_storage());
     }
 
     size_t used_entry_count;
@@ -818,14 +1036,17 @@ extern "C" esp_err_t nvs_entry_find_in_handle(nvs_handle_t handle, nvs_type_t ty
         return lock_result;
     }
 
-    Lock lock;
+    StorageOpGuard op;
     nvs::Storage *pStorage;
     NVSHandleSimple *handle_obj;
-
-    auto err = nvs_find_ns_handle(handle, &handle_obj);
-    if (err != ESP_OK) {
-        *output_iterator = nullptr;
-        return err;
+    {
+        Lock lock;
+        auto err = nvs_find_ns_handle(handle, &handle_obj);
+        if (err != ESP_OK) {
+            *output_iterator = nullptr;
+            return err;
+        }
+        op.attach(handle_obj->get_storage());
     }
 
     pStorage = handle_obj->get_storage();
@@ -852,7 +1073,11 @@ extern "C" esp_err_t nvs_entry_next(nvs_iterator_t *iterator)
         return ESP_ERR_INVALID_ARG;
     }
 
-    Lock lock;
+    StorageOpGuard op;
+    {
+        Lock lock;
+        op.attach((*iterator)->storage);
+    }
 
     bool entryFound = (*iterator)->storage->nextEntry(*iterator);
     if (!entryFound) {
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <cstdlib>
+#include <cstring>
 #include "nvs_handle.hpp"
 #include "nvs_partition_manager.hpp"
 
@@ -11,21 +12,132 @@ namespace nvs {
 
 NVSHandleSimple::~NVSHandleSimple() {
     NVSPartitionManager::get_instance()->close_handle(this);
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+    delete[] mValueCache;
+#endif
 }
 
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+
+esp_err_t NVSHandleSimple::enableValueCache(size_t cacheSize)
+{
+    if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
+
+    delete[] mValueCache;
+    mValueCache = nullptr;
+    mValueCacheCapacity = 0;
+    mValueCacheNextEvict = 0;
+
+    size_t capacity = cacheSize / sizeof(CachedValue);
+    if (capacity == 0) {
+        return (cacheSize == 0) ? ESP_OK : ESP_ERR_INVALID_ARG;
+    }
+
+    mValueCache = new (std::nothrow) CachedValue[capacity];
+    if (mValueCache == nullptr) {
+        return ESP_ERR_NO_MEM;
+    }
+    for (size_t i = 0; i < capacity; ++i) {
+        mValueCache[i].used = false;
+    }
+    mValueCacheCapacity = capacity;
+    return ESP_OK;
+}
+
+bool NVSHandleSimple::cacheLookup(ItemType datatype, const char *key, void *data, size_t dataSize)
+{
+    for (size_t i = 0; i < mValueCacheCapacity; ++i) {
+        CachedValue &cv = mValueCache[i];
+        if (cv.used && cv.datatype == datatype && cv.dataSize == dataSize &&
+                strncmp(cv.key, key, sizeof(cv.key)) == 0) {
+            memcpy(data, cv.data, dataSize);
+            return true;
+        }
+    }
+    return false;
+}
+
+void NVSHandleSimple::cacheStore(ItemType datatype, const char *key, const void *data, size_t dataSize)
+{
+    if (mValueCacheCapacity == 0 || isVariableLengthType(datatype) ||
+            dataSize > sizeof(mValueCache[0].data) || strlen(key) > Item::MAX_KEY_LENGTH) {
+        return;
+    }
+
+    CachedValue *slot = nullptr;
+    for (size_t i = 0; i < mValueCacheCapacity; ++i) {
+        if (mValueCache[i].used && strncmp(mValueCache[i].key, key, sizeof(mValueCache[i].key)) == 0) {
+            slot = &mValueCache[i];
+            break;
+        }
+        if (slot == nullptr && !mValueCache[i].used) {
+            slot = &mValueCache[i];
+        }
+    }
+    if (slot == nullptr) {
+        slot = &mValueCache[mValueCacheNextEvict];
+        mValueCacheNextEvict = (mValueCacheNextEvict + 1) % mValueCacheCapacity;
+    }
+
+    strncpy(slot->key, key, sizeof(slot->key) - 1);
+    slot->key[sizeof(slot->key) - 1] = '\0';
+    slot->datatype = datatype;
+    slot->dataSize = static_cast<uint8_t>(dataSize);
+    memcpy(slot->data, data, dataSize);
+    slot->used = true;
+}
+
+void NVSHandleSimple::cacheInvalidate(const char *key)
+{
+    for (size_t i = 0; i < mValueCacheCapacity; ++i) {
+        if (mValueCache[i].used && strncmp(mValueCache[i].key, key, sizeof(mValueCache[i].key)) == 0) {
+            mValueCache[i].used = false;
+            return;
+        }
+    }
+}
+
+void NVSHandleSimple::cacheClear()
+{
+    for (size_t i = 0; i < mValueCacheCapacity; ++i) {
+        mValueCache[i].used = false;
+    }
+}
+
+#endif // CONFIG_NVS_HANDLE_VALUE_CACHE
+
 esp_err_t NVSHandleSimple::set_typed_item(ItemType datatype, const char *key, const void* data, size_t dataSize)
 {
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
     if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
 
-    return mStoragePtr->writeItem(mNsIndex, datatype, key, data, dataSize);
+    esp_err_t err = mStoragePtr->writeItem(mNsIndex, datatype, key, data, dataSize);
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+    // write-through: keep the cached copy in sync with flash
+    if (err == ESP_OK) {
+        cacheStore(datatype, key, data, dataSize);
+    }
+#endif
+    return err;
 }
 
 esp_err_t NVSHandleSimple::get_typed_item(ItemType datatype, const char *key, void* data, size_t dataSize)
 {
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
 
-    return mStoragePtr->readItem(mNsIndex, datatype, key, data, dataSize);
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+    if (cacheLookup(datatype, key, data, dataSize)) {
+        return ESP_OK;
+    }
+#endif
+
+    esp_err_t err = mStoragePtr->readItem(mNsIndex, datatype, key, data, dataSize);
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+    if (err == ESP_OK) {
+        cacheStore(datatype, key, data, dataSize);
+    }
+#endif
+    return err;
 }
 
 esp_err_t NVSHandleSimple::set_string(const char *key, const char* str)
@@ -33,6 +145,10 @@ esp_err_t NVSHandleSimple::set_string(const char *key, const char* str)
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
     if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
 
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+    // the key may previously have held a cached primitive value
+    cacheInvalidate(key);
+#endif
     return mStoragePtr->writeItem(mNsIndex, nvs::ItemType::SZ, key, str, strlen(str) + 1);
 }
 
@@ -41,6 +157,9 @@ esp_err_t NVSHandleSimple::set_blob(const char *key, const void* blob, size_t le
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
     if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
 
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+    cacheInvalidate(key);
+#endif
     return mStoragePtr->writeItem(mNsIndex, nvs::ItemType::BLOB, key, blob, len);
 }
 
@@ -58,6 +177,13 @@ esp_err_t NVSHandleSimple::get_blob(const char *key, void* out_blob, size_t len)
     return mStoragePtr->readItem(mNsIndex, nvs::ItemType::BLOB, key, out_blob, len);
 }
 
+esp_err_t NVSHandleSimple::get_blob_range(const char *key, size_t offset, void* out_blob, size_t len)
+{
+    if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
+
+    return mStoragePtr->readBlobRange(mNsIndex, key, offset, out_blob, len);
+}
+
 esp_err_t NVSHandleSimple::get_item_size(ItemType datatype, const char *key, size_t &size)
 {
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
@@ -87,6 +213,9 @@ esp_err_t NVSHandleSimple::erase_item(const char* key)
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
     if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
 
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+    cacheInvalidate(key);
+#endif
     return mStoragePtr->eraseItem(mNsIndex, key);
 }
 
@@ -95,6 +224,9 @@ esp_err_t NVSHandleSimple::erase_all()
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
     if (mReadOnly) return ESP_ERR_NVS_READ_ONLY;
 
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+    cacheClear();
+#endif
     return mStoragePtr->eraseNamespace(mNsIndex);
 }
 
@@ -102,6 +234,11 @@ esp_err_t NVSHandleSimple::commit()
 {
     if (!valid) return ESP_ERR_NVS_INVALID_HANDLE;
 
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+    // drop cached values so that items written through other handles of the
+    // same namespace are picked up again from flash
+    cacheClear();
+#endif
     return ESP_OK;
 }
 
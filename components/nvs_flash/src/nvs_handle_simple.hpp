@@ -49,6 +49,8 @@ public:
 
     esp_err_t get_blob(const char *key, void *out_blob, size_t len) override;
 
+    esp_err_t get_blob_range(const char *key, size_t offset, void *out_blob, size_t len);
+
     esp_err_t get_item_size(ItemType datatype, const char *key, size_t &size) override;
 
     esp_err_t find_key(const char *key, nvs_type_t &nvstype) override;
@@ -79,7 +81,38 @@ public:
 
     Storage *get_storage() const;
 
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+    /**
+     * Enable (or resize) the per-handle value cache; cacheSize is the cache
+     * RAM budget in bytes, 0 disables the cache again. See
+     * nvs_enable_value_cache() for the semantics.
+     */
+    esp_err_t enableValueCache(size_t cacheSize);
+#endif
+
 private:
+#ifdef CONFIG_NVS_HANDLE_VALUE_CACHE
+    struct CachedValue {
+        char key[Item::MAX_KEY_LENGTH + 1];
+        ItemType datatype;
+        uint8_t dataSize;
+        bool used;
+        uint8_t data[8];
+    };
+
+    bool cacheLookup(ItemType datatype, const char *key, void *data, size_t dataSize);
+
+    void cacheStore(ItemType datatype, const char *key, const void *data, size_t dataSize);
+
+    void cacheInvalidate(const char *key);
+
+    void cacheClear();
+
+    CachedValue *mValueCache = nullptr;
+    size_t mValueCacheCapacity = 0;
+    size_t mValueCacheNextEvict = 0;
+#endif
+
     /**
      * The underlying storage's object.
      */
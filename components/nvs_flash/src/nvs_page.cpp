@@ -71,6 +71,7 @@ esp_err_t Page::load(Partition *partition, uint32_t sectorNumber)
     } else {
         mState = header.mState;
         mSeqNumber = header.mSeqNumber;
+        mEraseCount = (header.mEraseCount == UINT32_MAX) ? 0 : header.mEraseCount;
         if (header.mVersion < NVS_VERSION) {
             return ESP_ERR_NVS_NEW_VERSION_FOUND;
         } else {
@@ -526,6 +527,81 @@ esp_err_t Page::copyItems(Page &other)
     return ESP_OK;
 }
 
+esp_err_t Page::copyItemsIncremental(Page &other, size_t maxItems, size_t &copiedItems)
+{
+    copiedItems = 0;
+
+    if (mFirstUsedEntry == INVALID_ENTRY) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+
+    if (other.mState == PageState::UNINITIALIZED) {
+        auto err = other.initialize();
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+
+    Item entry;
+    EntryState state;
+    esp_err_t err;
+
+    while (copiedItems < maxItems && mFirstUsedEntry != INVALID_ENTRY) {
+        size_t readEntryIndex = mFirstUsedEntry;
+        err = mEntryTable.get(readEntryIndex, &state);
+        if (err != ESP_OK) {
+            return err;
+        }
+        NVS_ASSERT_OR_RETURN(state == EntryState::WRITTEN, ESP_FAIL);
+        err = readEntry(readEntryIndex, entry);
+        if (err != ESP_OK) {
+            return err;
+        }
+
+        // The item may already be present on the destination if power was lost
+        // after it was copied but before the source entry was erased; in that
+        // case only the source copy has to go.
+        size_t dupIndex = 0;
+        Item dup;
+        if (other.findItem(entry.nsIndex, entry.datatype, entry.key, dupIndex, dup,
+                           entry.chunkIndex) != ESP_OK) {
+            if (other.getFreeEntryCount() < entry.span) {
+                return ESP_ERR_NVS_PAGE_FULL;
+            }
+            err = other.mHashList.insert(entry, other.mNextFreeEntry);
+            if (err != ESP_OK) {
+                return err;
+            }
+            err = other.writeEntry(entry);
+            if (err != ESP_OK) {
+                return err;
+            }
+            size_t end = readEntryIndex + entry.span;
+            NVS_ASSERT_OR_RETURN(end <= ENTRY_COUNT, ESP_FAIL);
+            Item dataEntry;
+            for (size_t i = readEntryIndex + 1; i < end; ++i) {
+                err = readEntry(i, dataEntry);
+                if (err != ESP_OK) {
+                    return err;
+                }
+                err = other.writeEntry(dataEntry);
+                if (err != ESP_OK) {
+                    return err;
+                }
+            }
+        }
+
+        // Erasing the source entry both records the migration progress in flash
+        // and keeps the item visible exactly once to lookups.
+        err = eraseEntryAndSpan(readEntryIndex);
+        if (err != ESP_OK) {
+            return err;
+        }
+        ++copiedItems;
+    }
+    return ESP_OK;
+}
+
 esp_err_t Page::mLoadEntryTable()
 {
     // for states where we actually care about data in the page, read entry state table
@@ -775,6 +851,7 @@ esp_err_t Page::initialize()
     header.mState = mState;
     header.mSeqNumber = mSeqNumber;
     header.mVersion = mVersion;
+    header.mEraseCount = mEraseCount;
     header.mCrc32 = header.calculateCrc32();
 
     auto rc = mPartition->write_raw(mBaseAddress, &header, sizeof(header));
@@ -1028,6 +1105,7 @@ esp_err_t Page::erase()
         mState = PageState::INVALID;
         return rc;
     }
+    ++mEraseCount;
     mUsedEntryCount = 0;
     mErasedEntryCount = 0;
     mFirstUsedEntry = INVALID_ENTRY;
@@ -132,14 +132,35 @@ public:
     {
         return mErasedEntryCount;
     }
+
+    /**
+     * Number of times the underlying sector was erased. Persisted in the page
+     * header when the page is initialized; while a page sits erased in the
+     * free pool the latest increment only exists in RAM, so the count may
+     * under-report by one erase per unclean shutdown.
+     */
+    uint32_t getEraseCount() const
+    {
+        return mEraseCount;
+    }
     size_t getVarDataTailroom() const ;
 
+    size_t getFreeEntryCount() const
+    {
+        if (mNextFreeEntry == INVALID_ENTRY || mNextFreeEntry > ENTRY_COUNT) {
+            return 0;
+        }
+        return ENTRY_COUNT - mNextFreeEntry;
+    }
+
     esp_err_t markFull();
 
     esp_err_t markFreeing();
 
     esp_err_t copyItems(Page& other);
 
+    esp_err_t copyItemsIncremental(Page& other, size_t maxItems, size_t& copiedItems);
+
     esp_err_t erase();
 
     void debugDump() const;
@@ -151,7 +172,7 @@ protected:
     class Header
     {
     public:
-        Header()
+        Header() : mEraseCount(UINT32_MAX)
         {
             std::fill_n(mReserved, sizeof(mReserved)/sizeof(mReserved[0]), UINT8_MAX);
         }
@@ -159,7 +180,8 @@ protected:
         PageState mState;       // page state
         uint32_t mSeqNumber;    // sequence number of this page
         uint8_t mVersion;       // nvs format version
-        uint8_t mReserved[19];  // unused, must be 0xff
+        uint8_t mReserved[15];  // unused, must be 0xff
+        uint32_t mEraseCount;   // times the sector was erased; 0xffffffff on pages written before this field existed
         uint32_t mCrc32;        // crc of everything except mState
 
         uint32_t calculateCrc32();
@@ -217,6 +239,7 @@ protected:
     size_t mFirstUsedEntry = INVALID_ENTRY;
     uint16_t mUsedEntryCount = 0;
     uint16_t mErasedEntryCount = 0;
+    uint32_t mEraseCount = 0;
 
     /**
      * This hash list stores hashes of namespace index, key, and ChunkIndex for quick lookup when searching items.
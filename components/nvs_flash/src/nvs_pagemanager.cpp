@@ -92,6 +92,39 @@ esp_err_t PageManager::load(Partition *partition, uint32_t baseSector, uint32_t
     // check if power went out while page was being freed
     for (auto it = begin(); it!= end(); ++it) {
         if (it->state() == Page::PageState::FREEING) {
+#ifdef CONFIG_NVS_INCREMENTAL_GC
+            // Incremental GC erases entries from the source page as they are
+            // migrated, so the items remaining on the freeing page are exactly
+            // the ones not moved yet. Resume the migration instead of
+            // discarding the destination page, which may already hold entries
+            // written after the migration started. copyItemsIncremental()
+            // skips items which already exist on the destination, which also
+            // covers a freeing page left behind by the non-incremental move.
+            Page* newPage = &mPageList.back();
+            if (newPage->state() != Page::PageState::ACTIVE) {
+                auto err = activatePage();
+                if (err != ESP_OK) {
+                    return err;
+                }
+                newPage = &mPageList.back();
+            }
+
+            size_t copied;
+            auto err = it->copyItemsIncremental(*newPage, SIZE_MAX, copied);
+            if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+                return err;
+            }
+
+            err = it->erase();
+            if (err != ESP_OK) {
+                return err;
+            }
+
+            Page* p = static_cast<Page*>(it);
+            mPageList.erase(it);
+            mFreePageList.push_back(p);
+            break;
+#else
             Page* newPage = &mPageList.back();
             if (newPage->state() == Page::PageState::ACTIVE) {
                 auto err = newPage->erase();
@@ -121,6 +154,7 @@ esp_err_t PageManager::load(Partition *partition, uint32_t baseSector, uint32_t
             mPageList.erase(it);
             mFreePageList.push_back(p);
             break;
+#endif // CONFIG_NVS_INCREMENTAL_GC
         }
     }
 
@@ -134,6 +168,15 @@ esp_err_t PageManager::load(Partition *partition, uint32_t baseSector, uint32_t
 
 esp_err_t PageManager::requestNewPage()
 {
+#ifdef CONFIG_NVS_INCREMENTAL_GC
+    // finish a migration still in flight so that the free page accounting
+    // below sees a consistent state
+    esp_err_t gc_err = gcDrain();
+    if (gc_err != ESP_OK) {
+        return gc_err;
+    }
+#endif
+
     if (mFreePageList.empty()) {
         return ESP_ERR_NVS_INVALID_STATE;
     }
@@ -195,19 +238,151 @@ esp_err_t PageManager::requestNewPage()
     return ESP_OK;
 }
 
+#ifdef CONFIG_NVS_INCREMENTAL_GC
+esp_err_t PageManager::requestNewPageIncremental()
+{
+    esp_err_t err = gcDrain();
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    if (mFreePageList.empty()) {
+        return ESP_ERR_NVS_INVALID_STATE;
+    }
+
+    // do we have at least two free pages? in that case no erasing is required
+    if (mFreePageList.size() >= 2) {
+        return activatePage();
+    }
+
+    // find the page with the highest number of erased items
+    TPageListIterator maxUnusedItemsPageIt;
+    size_t maxUnusedItems = 0;
+    for (auto it = begin(); it != end(); ++it) {
+
+        auto unused =  Page::ENTRY_COUNT - it->getUsedEntryCount();
+        if (unused > maxUnusedItems) {
+            maxUnusedItemsPageIt = it;
+            maxUnusedItems = unused;
+        }
+    }
+
+    if (maxUnusedItems == 0) {
+        return ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+    }
+
+    // The fixed-size entry which triggered this call consumes one entry of
+    // the new page; the migration needs at least one more entry of slack on
+    // top of that, otherwise fall back to the synchronous move.
+    if (maxUnusedItems < 2) {
+        return requestNewPage();
+    }
+
+    err = activatePage();
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    Page* victimPage = maxUnusedItemsPageIt;
+
+    err = victimPage->markFreeing();
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    mGcSrcPage = victimPage;
+
+    // make some initial progress; the remainder is migrated by later
+    // operations through gcStep()/gcDrain()
+    return gcStep(CONFIG_NVS_INCREMENTAL_GC_MAX_ITEMS);
+}
+
+esp_err_t PageManager::gcStep(size_t maxItems)
+{
+    if (mGcSrcPage == nullptr) {
+        return ESP_OK;
+    }
+
+    size_t copied;
+    esp_err_t err = mGcSrcPage->copyItemsIncremental(back(), maxItems, copied);
+    if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+        return err;
+    }
+
+    if (mGcSrcPage->getUsedEntryCount() != 0) {
+        // more steps needed
+        return ESP_OK;
+    }
+
+    err = mGcSrcPage->erase();
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    Page* freedPage = mGcSrcPage;
+    mGcSrcPage = nullptr;
+    mPageList.erase(freedPage);
+    mFreePageList.push_back(freedPage);
+
+    return ESP_OK;
+}
+
+esp_err_t PageManager::gcDrain()
+{
+    while (mGcSrcPage != nullptr) {
+        esp_err_t err = gcStep(SIZE_MAX);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t PageManager::gcBeforeWrite(bool variableLength)
+{
+    if (mGcSrcPage == nullptr) {
+        return ESP_OK;
+    }
+
+    if (variableLength) {
+        return gcDrain();
+    }
+
+    esp_err_t err = gcStep(CONFIG_NVS_INCREMENTAL_GC_MAX_ITEMS);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    // keep enough room on the destination page for the remaining source
+    // entries plus the entry about to be written
+    if (mGcSrcPage != nullptr &&
+            back().getFreeEntryCount() < mGcSrcPage->getUsedEntryCount() + 2) {
+        return gcDrain();
+    }
+
+    return ESP_OK;
+}
+#endif // CONFIG_NVS_INCREMENTAL_GC
+
 esp_err_t PageManager::activatePage()
 {
     if (mFreePageList.empty()) {
         return ESP_ERR_NVS_NOT_ENOUGH_SPACE;
     }
+    // wear levelling: prefer the least erased spare page
     Page* p = &mFreePageList.front();
+    for (auto it = mFreePageList.begin(); it != mFreePageList.end(); ++it) {
+        if (it->getEraseCount() < p->getEraseCount()) {
+            p = it;
+        }
+    }
     if (p->state() == Page::PageState::CORRUPT) {
         auto err = p->erase();
         if (err != ESP_OK) {
             return err;
         }
     }
-    mFreePageList.pop_front();
+    mFreePageList.erase(p);
     mPageList.push_back(p);
     p->setSeqNumber(mSeqNumber);
     ++mSeqNumber;
@@ -216,6 +391,14 @@ esp_err_t PageManager::activatePage()
 
 esp_err_t PageManager::fillStats(nvs_stats_t& nvsStats)
 {
+#ifdef CONFIG_NVS_INCREMENTAL_GC
+    // entries of a page in mid-migration would be counted on both pages
+    esp_err_t gc_err = gcDrain();
+    if (gc_err != ESP_OK) {
+        return gc_err;
+    }
+#endif
+
     nvsStats.used_entries      = 0;
     nvsStats.free_entries      = 0;
     nvsStats.available_entries = 0;
@@ -241,4 +424,31 @@ esp_err_t PageManager::fillStats(nvs_stats_t& nvsStats)
     return err;
 }
 
+esp_err_t PageManager::fillWearStats(nvs_wear_stats_t& wearStats)
+{
+    wearStats.min_erase_count = 0;
+    wearStats.max_erase_count = 0;
+    wearStats.avg_erase_count = 0;
+    wearStats.sector_count    = mPageCount;
+
+    if (!mPages || mPageCount == 0) {
+        return ESP_ERR_NVS_INVALID_STATE;
+    }
+
+    uint32_t minCount = UINT32_MAX;
+    uint32_t maxCount = 0;
+    uint64_t totalCount = 0;
+    for (uint32_t i = 0; i < mPageCount; ++i) {
+        uint32_t eraseCount = mPages[i].getEraseCount();
+        minCount = std::min(minCount, eraseCount);
+        maxCount = std::max(maxCount, eraseCount);
+        totalCount += eraseCount;
+    }
+
+    wearStats.min_erase_count = minCount;
+    wearStats.max_erase_count = maxCount;
+    wearStats.avg_erase_count = static_cast<uint32_t>(totalCount / mPageCount);
+    return ESP_OK;
+}
+
 } // namespace nvs
@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <list>
+#include "sdkconfig.h"
 #include "nvs_types.hpp"
 #include "nvs_page.hpp"
 #include "partition.hpp"
@@ -54,8 +55,46 @@ public:
 
     esp_err_t requestNewPage();
 
+#ifdef CONFIG_NVS_INCREMENTAL_GC
+    /**
+     * Like requestNewPage(), but defers the relocation of the victim page's
+     * entries: only up to NVS_INCREMENTAL_GC_MAX_ITEMS items are moved here,
+     * the rest is migrated by later calls to gcStep()/gcDrain(). The caller
+     * may write one fixed-size entry to the new page right away; anything
+     * larger has to go through gcBeforeWrite() first.
+     */
+    esp_err_t requestNewPageIncremental();
+
+    /**
+     * Advance a pending page migration by up to maxItems items. No-op when
+     * no migration is in progress.
+     */
+    esp_err_t gcStep(size_t maxItems);
+
+    /**
+     * Finish a pending page migration and move the reclaimed page to the
+     * free page list.
+     */
+    esp_err_t gcDrain();
+
+    /**
+     * Make room for an upcoming write to the current page. Variable length
+     * items size their chunks to the page tailroom and may consume all of it,
+     * so they finish the migration; fixed size items only need the migration
+     * to keep one entry of slack on the destination page.
+     */
+    esp_err_t gcBeforeWrite(bool variableLength);
+
+    bool gcActive() const
+    {
+        return mGcSrcPage != nullptr;
+    }
+#endif // CONFIG_NVS_INCREMENTAL_GC
+
     esp_err_t fillStats(nvs_stats_t& nvsStats);
 
+    esp_err_t fillWearStats(nvs_wear_stats_t& wearStats);
+
     uint32_t getBaseSector()
     {
         return mBaseSector;
@@ -68,6 +107,9 @@ protected:
 
     TPageList mPageList;
     TPageList mFreePageList;
+#ifdef CONFIG_NVS_INCREMENTAL_GC
+    Page* mGcSrcPage = nullptr;
+#endif
     std::unique_ptr<Page[]> mPages;
     uint32_t mBaseSector;
     uint32_t mPageCount;
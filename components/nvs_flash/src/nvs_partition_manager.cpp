@@ -69,6 +69,21 @@ error:
 
 esp_err_t NVSPartitionManager::init_custom(Partition *partition, uint32_t baseSector, uint32_t sectorCount)
 {
+#ifdef CONFIG_NVS_RETAIN_INIT_INDEX
+    // Reuse the index retained at deinit time. The partition may not be
+    // written by anything besides NVS while deinitialized, so the retained
+    // page states and hash lists are still valid and the full-partition scan
+    // can be skipped.
+    for (auto it = nvs_retained_storage_list.begin(); it != nvs_retained_storage_list.end(); ++it) {
+        if (strcmp(it->getPartName(), partition->get_partition_name()) == 0) {
+            Storage* retained = it;
+            nvs_retained_storage_list.erase(it);
+            nvs_storage_list.push_back(retained);
+            return ESP_OK;
+        }
+    }
+#endif
+
     Storage* new_storage = nullptr;
     Storage* storage = lookup_storage_from_name(partition->get_partition_name());
     if (storage == nullptr) {
@@ -157,6 +172,24 @@ esp_err_t NVSPartitionManager::deinit_partition(const char *partition_label)
         }
     }
 
+#ifdef CONFIG_NVS_RETAIN_INIT_INDEX
+    /* Keep the storage (and the partition object it references) alive on the
+     * retained list, so a later init of the same partition can skip the
+     * full-partition scan. Only drop the partition from the active list. */
+    nvs_storage_list.erase(storage);
+    nvs_retained_storage_list.push_back(storage);
+
+    for (auto it = nvs_partition_list.begin(); it != nvs_partition_list.end(); ++it) {
+        if (strcmp(it->get_partition_name(), partition_label) == 0) {
+            NVSPartition *p = it;
+            nvs_partition_list.erase(it);
+            if (p != storage->getPart()) {
+                delete p;
+            }
+            break;
+        }
+    }
+#else
     /* Finally delete the storage and its partition */
     nvs_storage_list.erase(storage);
     delete storage;
@@ -169,6 +202,7 @@ esp_err_t NVSPartitionManager::deinit_partition(const char *partition_label)
             break;
         }
     }
+#endif
 
     return ESP_OK;
 }
@@ -11,6 +11,7 @@
 #include "nvs_partition.hpp"
 #include "nvs_memory_management.hpp"
 #include "nvs_flash.h"
+#include "sdkconfig.h"
 
 namespace nvs {
 
@@ -46,6 +47,12 @@ protected:
     intrusive_list<nvs::Storage> nvs_storage_list;
 
     intrusive_list<nvs::NVSPartition> nvs_partition_list;
+
+#ifdef CONFIG_NVS_RETAIN_INIT_INDEX
+    // Storages retained at deinit time, so a later init of the same partition
+    // reuses the page/hash index instead of rescanning the whole partition.
+    intrusive_list<nvs::Storage> nvs_retained_storage_list;
+#endif
 };
 
 } // nvs
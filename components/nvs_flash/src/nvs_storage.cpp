@@ -3,6 +3,7 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <algorithm>
 #include "nvs_storage.hpp"
 #if __has_include(<bsd/string.h>)
 // for strlcpy
@@ -378,6 +379,13 @@ esp_err_t Storage::writeItem(uint8_t nsIndex, ItemType datatype, const char* key
         return ESP_ERR_NVS_NOT_INITIALIZED;
     }
 
+#ifdef CONFIG_NVS_INCREMENTAL_GC
+    esp_err_t gc_err = mPageManager.gcBeforeWrite(isVariableLengthType(datatype) || datatype == ItemType::BLOB);
+    if (gc_err != ESP_OK) {
+        return gc_err;
+    }
+#endif
+
     Page* findPage = nullptr;
     bool matchedTypePageFound = false;
     Item item;
@@ -480,7 +488,14 @@ esp_err_t Storage::writeItem(uint8_t nsIndex, ItemType datatype, const char* key
                     return err;
                 }
             }
+#ifdef CONFIG_NVS_INCREMENTAL_GC
+            // fixed-size items take a single entry, so the relocation of the
+            // victim page's entries can be spread over later operations
+            err = isVariableLengthType(datatype) ? mPageManager.requestNewPage()
+                                                 : mPageManager.requestNewPageIncremental();
+#else
             err = mPageManager.requestNewPage();
+#endif
             if (err != ESP_OK) {
                 return err;
             }
@@ -630,6 +645,86 @@ esp_err_t Storage::readMultiPageBlob(uint8_t nsIndex, const char* key, void* dat
     return err;
 }
 
+esp_err_t Storage::readBlobRange(uint8_t nsIndex, const char* key, size_t srcOffset, void* data, size_t dataSize)
+{
+    Item item;
+    Page* findPage = nullptr;
+
+    /* Multi-page blob: walk the chunk list, only reading the chunks that
+     * overlap the requested range. The temporary buffer is bounded by the
+     * largest single chunk, not by the blob size. */
+    auto err = findItem(nsIndex, ItemType::BLOB_IDX, key, findPage, item);
+    if (err == ESP_OK) {
+        uint8_t chunkCount = item.blobIndex.chunkCount;
+        VerOffset chunkStart = item.blobIndex.chunkStart;
+        size_t blobSize = item.blobIndex.dataSize;
+
+        if (srcOffset > blobSize || dataSize > blobSize - srcOffset) {
+            return ESP_ERR_NVS_INVALID_LENGTH;
+        }
+
+        size_t chunkOffset = 0;     // offset of the current chunk inside the blob
+        size_t copied = 0;
+        uint8_t* chunkBuf = nullptr;
+        size_t chunkBufSize = 0;
+
+        for (uint8_t chunkNum = 0; chunkNum < chunkCount && copied < dataSize; chunkNum++) {
+            err = findItem(nsIndex, ItemType::BLOB_DATA, key, findPage, item, static_cast<uint8_t> (chunkStart) + chunkNum);
+            if (err != ESP_OK) {
+                break;
+            }
+            size_t chunkSize = item.varLength.dataSize;
+            if (chunkOffset + chunkSize > srcOffset) {
+                if (chunkBufSize < chunkSize) {
+                    delete[] chunkBuf;
+                    chunkBuf = new (std::nothrow) uint8_t[chunkSize];
+                    if (chunkBuf == nullptr) {
+                        return ESP_ERR_NO_MEM;
+                    }
+                    chunkBufSize = chunkSize;
+                }
+                err = findPage->readItem(nsIndex, ItemType::BLOB_DATA, key, chunkBuf, chunkSize, static_cast<uint8_t> (chunkStart) + chunkNum);
+                if (err != ESP_OK) {
+                    break;
+                }
+                size_t start = (srcOffset > chunkOffset) ? srcOffset - chunkOffset : 0;
+                size_t toCopy = std::min(chunkSize - start, dataSize - copied);
+                memcpy(static_cast<uint8_t*>(data) + copied, chunkBuf + start, toCopy);
+                copied += toCopy;
+            }
+            chunkOffset += chunkSize;
+        }
+        delete[] chunkBuf;
+
+        if (err == ESP_OK && copied != dataSize) {
+            /* The size of the entry in the index is inconsistent with the sum of the sizes of chunks */
+            err = ESP_ERR_NVS_INVALID_LENGTH;
+        }
+        return err;
+    }
+
+    /* Legacy single-page blob: the item has to be read (and CRC-checked) as a
+     * whole, then the requested range is copied out. */
+    err = findItem(nsIndex, ItemType::BLOB, key, findPage, item);
+    if (err != ESP_OK) {
+        return err;
+    }
+    size_t blobSize = item.varLength.dataSize;
+    if (srcOffset > blobSize || dataSize > blobSize - srcOffset) {
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    uint8_t* buf = new (std::nothrow) uint8_t[blobSize];
+    if (buf == nullptr) {
+        return ESP_ERR_NO_MEM;
+    }
+    err = findPage->readItem(nsIndex, ItemType::BLOB, key, buf, blobSize);
+    if (err == ESP_OK) {
+        memcpy(data, buf + srcOffset, dataSize);
+    }
+    delete[] buf;
+    return err;
+}
+
 esp_err_t Storage::cmpMultiPageBlob(uint8_t nsIndex, const char* key, const void* data, size_t dataSize)
 {
     Item item;
@@ -769,6 +864,15 @@ esp_err_t Storage::eraseItem(uint8_t nsIndex, ItemType datatype, const char* key
         return ESP_ERR_NVS_NOT_INITIALIZED;
     }
 
+#ifdef CONFIG_NVS_INCREMENTAL_GC
+    // opportunistically advance a pending page migration; erases only clear
+    // entry state bits and do not consume entries on the destination page
+    esp_err_t gc_err = mPageManager.gcStep(CONFIG_NVS_INCREMENTAL_GC_MAX_ITEMS);
+    if (gc_err != ESP_OK) {
+        return gc_err;
+    }
+#endif
+
     if (datatype == ItemType::BLOB) {
         return eraseMultiPageBlob(nsIndex, key);
     }
@@ -893,6 +997,11 @@ esp_err_t Storage::fillStats(nvs_stats_t& nvsStats)
     return mPageManager.fillStats(nvsStats);
 }
 
+esp_err_t Storage::fillWearStats(nvs_wear_stats_t& wearStats)
+{
+    return mPageManager.fillWearStats(wearStats);
+}
+
 esp_err_t Storage::calcEntriesInNamespace(uint8_t nsIndex, size_t& usedEntries)
 {
     usedEntries = 0;
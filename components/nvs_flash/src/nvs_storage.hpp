@@ -9,6 +9,9 @@
 #include <memory>
 #include <cstdlib>
 #include <unordered_map>
+#ifndef LINUX_TARGET
+#include <sys/lock.h>
+#endif
 #include "nvs.hpp"
 #include "nvs_types.hpp"
 #include "nvs_page.hpp"
@@ -109,6 +112,26 @@ public:
         return mPartition->get_partition_name();
     }
 
+    /**
+     * Per-storage operation lock. Item operations on different partitions only
+     * contend on the short global handle-table lock, not on each other; see
+     * nvs_api.cpp. Always acquired while holding the global lock, so the lock
+     * order is global -> storage.
+     */
+    void opLock()
+    {
+#ifndef LINUX_TARGET
+        _lock_acquire(&mOpLock);
+#endif
+    }
+
+    void opUnlock()
+    {
+#ifndef LINUX_TARGET
+        _lock_release(&mOpLock);
+#endif
+    }
+
     uint32_t getBaseSector()
     {
         return mPageManager.getBaseSector();
@@ -118,6 +141,8 @@ public:
 
     esp_err_t readMultiPageBlob(uint8_t nsIndex, const char* key, void* data, size_t dataSize);
 
+    esp_err_t readBlobRange(uint8_t nsIndex, const char* key, size_t srcOffset, void* data, size_t dataSize);
+
     esp_err_t cmpMultiPageBlob(uint8_t nsIndex, const char* key, const void* data, size_t dataSize);
 
     esp_err_t eraseMultiPageBlob(uint8_t nsIndex, const char* key, VerOffset chunkStart = VerOffset::VER_ANY);
@@ -128,6 +153,8 @@ public:
 
     esp_err_t fillStats(nvs_stats_t& nvsStats);
 
+    esp_err_t fillWearStats(nvs_wear_stats_t& wearStats);
+
     esp_err_t calcEntriesInNamespace(uint8_t nsIndex, size_t& usedEntries);
 
     bool findEntry(nvs_opaque_iterator_t* it, const char* name);
@@ -162,6 +189,9 @@ protected:
     TNamespaces mNamespaces;
     CompressedEnumTable<bool, 1, 256> mNamespaceUsage;
     StorageState mState = StorageState::INVALID;
+#ifndef LINUX_TARGET
+    _lock_t mOpLock = 0;
+#endif
 };
 
 } // namespace nvs
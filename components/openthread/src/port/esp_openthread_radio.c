@@ -714,8 +714,13 @@ void IRAM_ATTR esp_ieee802154_receive_done(uint8_t *data, esp_ieee802154_frame_i
     s_with_security_enh_ack = false;
 #endif // OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
     s_recv_queue.tail = (s_recv_queue.tail + 1) % CONFIG_IEEE802154_RX_BUFFER_SIZE;
-    atomic_fetch_add(&s_recv_queue.used, 1);
-    set_event(EVENT_RX_DONE);
+    // Only wake the OpenThread task when the queue transitions from empty to
+    // non-empty; the process loop drains the whole queue in one pass, so frames
+    // arriving in a burst share a single task wakeup. If the queue was already
+    // non-empty, the drain loop is either still running or a wakeup is pending.
+    if (atomic_fetch_add(&s_recv_queue.used, 1) == 0) {
+        set_event(EVENT_RX_DONE);
+    }
 }
 
 void IRAM_ATTR esp_ieee802154_transmit_failed(const uint8_t *frame, esp_ieee802154_tx_error_t error)
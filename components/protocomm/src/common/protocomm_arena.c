@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "protocomm_arena.h"
+
+#define ARENA_ALIGN 8
+
+static void *arena_alloc(void *allocator_data, size_t size)
+{
+    protocomm_arena_t *arena = (protocomm_arena_t *) allocator_data;
+    size_t aligned = (size + (ARENA_ALIGN - 1)) & ~(size_t)(ARENA_ALIGN - 1);
+
+    if (aligned <= arena->size - arena->offset) {
+        void *ptr = arena->buf + arena->offset;
+        arena->offset += aligned;
+        return ptr;
+    }
+    /* Arena exhausted, serve this allocation from the heap */
+    return malloc(size);
+}
+
+static void arena_free(void *allocator_data, void *ptr)
+{
+    protocomm_arena_t *arena = (protocomm_arena_t *) allocator_data;
+
+    if (ptr == NULL) {
+        return;
+    }
+    /* Pointers inside the arena are released all at once with the arena
+     * itself; only heap fallback blocks need an explicit free */
+    if ((uint8_t *) ptr >= arena->buf && (uint8_t *) ptr < arena->buf + arena->size) {
+        return;
+    }
+    free(ptr);
+}
+
+ProtobufCAllocator *protocomm_arena_init(protocomm_arena_t *arena, void *buf, size_t size)
+{
+    arena->buf = (uint8_t *) buf;
+    arena->size = size;
+    arena->offset = 0;
+    arena->allocator.alloc = arena_alloc;
+    arena->allocator.free = arena_free;
+    arena->allocator.allocator_data = arena;
+    return &arena->allocator;
+}
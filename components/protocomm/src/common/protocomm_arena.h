@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <protobuf-c/protobuf-c.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Stack buffer size that comfortably fits the decoded form of the session
+ * setup messages used by the security schemes
+ */
+#define PROTOCOMM_ARENA_BUF_SIZE 256
+
+/**
+ * @brief Bump allocator backing a ProtobufCAllocator
+ *
+ * Protobuf-c performs one heap allocation per decoded field; during a
+ * provisioning exchange that adds up to dozens of small mallocs per message.
+ * An arena serves these from a caller-provided buffer (typically on the
+ * stack) with a simple bump pointer. Allocations that do not fit fall back to
+ * the heap, so oversized messages still decode, and the free hook only
+ * releases those fallback blocks.
+ */
+typedef struct protocomm_arena {
+    ProtobufCAllocator allocator;   /*!< Allocator to pass to protobuf-c unpack/free_unpacked */
+    uint8_t *buf;                   /*!< Arena memory */
+    size_t size;                    /*!< Size of the arena memory */
+    size_t offset;                  /*!< Current bump offset */
+} protocomm_arena_t;
+
+/**
+ * @brief Initialize an arena over the given buffer
+ *
+ * @param arena Arena object to initialize
+ * @param buf   Memory to serve allocations from
+ * @param size  Size of buf in bytes
+ *
+ * @return Pointer to the embedded ProtobufCAllocator, to be passed to the
+ *         protobuf-c unpack and free_unpacked functions
+ */
+ProtobufCAllocator *protocomm_arena_init(protocomm_arena_t *arena, void *buf, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
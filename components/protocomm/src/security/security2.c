@@ -23,6 +23,8 @@
 #include "sec2.pb-c.h"
 #include "constants.pb-c.h"
 
+#include "protocomm_arena.h"
+
 #include "esp_srp.h"
 
 static const char *TAG = "security2";
@@ -506,15 +508,18 @@ static esp_err_t sec2_req_handler(protocomm_security_handle_t handle,
     SessionData *req;
     SessionData resp;
     esp_err_t ret;
+    protocomm_arena_t arena;
+    uint8_t arena_buf[PROTOCOMM_ARENA_BUF_SIZE];
+    ProtobufCAllocator *allocator = protocomm_arena_init(&arena, arena_buf, sizeof(arena_buf));
 
-    req = session_data__unpack(NULL, inlen, inbuf);
+    req = session_data__unpack(allocator, inlen, inbuf);
     if (!req) {
         ESP_LOGE(TAG, "Unable to unpack setup_req");
         return ESP_ERR_INVALID_ARG;
     }
     if (req->sec_ver != protocomm_security2.ver) {
         ESP_LOGE(TAG, "Security version mismatch. Closing connection");
-        session_data__free_unpacked(req, NULL);
+        session_data__free_unpacked(req, allocator);
         return ESP_ERR_INVALID_ARG;
     }
 
@@ -522,12 +527,12 @@ static esp_err_t sec2_req_handler(protocomm_security_handle_t handle,
     ret = sec2_session_setup(cur_session, session_id, req, &resp, (protocomm_security2_params_t *) sec_params);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Session setup error %d", ret);
-        session_data__free_unpacked(req, NULL);
+        session_data__free_unpacked(req, allocator);
         return ESP_FAIL;
     }
 
     resp.sec_ver = req->sec_ver;
-    session_data__free_unpacked(req, NULL);
+    session_data__free_unpacked(req, allocator);
 
     *outlen = session_data__get_packed_size(&resp);
     *outbuf = (uint8_t *) malloc(*outlen);
@@ -264,6 +264,17 @@ static void transport_simple_ble_write(esp_gatts_cb_event_t event, esp_gatt_if_t
         ESP_LOGD(TAG, "is_prep not set");
     }
 
+    /* Acknowledge the write before running the request handler, so that the
+     * client can put its next message on air while the handler (potentially
+     * a long crypto or Wi-Fi operation) is still executing. GATT events are
+     * serialized in the Bluetooth task, hence the attribute value set below
+     * is in place before any subsequent read is processed. */
+    ret = esp_ble_gatts_send_response(gatts_if, param->write.conn_id,
+                                      param->write.trans_id, ESP_GATT_OK, NULL);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Send response error in write");
+    }
+
     ret = protocomm_req_handle(protoble_internal->pc_ble,
                                handle_to_handler(param->write.handle),
                                param->write.conn_id,
@@ -275,11 +286,6 @@ static void transport_simple_ble_write(esp_gatts_cb_event_t event, esp_gatt_if_t
         if (ret != ESP_OK) {
             ESP_LOGE(TAG, "Failed to set the session attribute value");
         }
-        ret = esp_ble_gatts_send_response(gatts_if, param->write.conn_id,
-                                          param->write.trans_id, ESP_GATT_OK, NULL);
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "Send response error in write");
-        }
         hexdump("Response from  write", outbuf, outlen);
 
     } else {
@@ -298,6 +304,13 @@ static void transport_simple_ble_exec_write(esp_gatts_cb_event_t event, esp_gatt
     ssize_t outlen = 0;
     ESP_LOGD(TAG, "Inside exec_write w/ session - %d", param->exec_write.conn_id);
 
+    /* As in the write handler, acknowledge the execute write before running
+     * the request handler so that the client is not stalled behind it */
+    err = esp_ble_gatts_send_response(gatts_if, param->exec_write.conn_id, param->exec_write.trans_id, ESP_GATT_OK, NULL);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Send response error in exec write");
+    }
+
     if ((param->exec_write.exec_write_flag == ESP_GATT_PREP_WRITE_EXEC)
             &&
             prepare_write_env.prepare_buf) {
@@ -321,11 +334,6 @@ static void transport_simple_ble_exec_write(esp_gatts_cb_event_t event, esp_gatt
         prepare_write_env.prepare_buf = NULL;
         prepare_write_env.prepare_len = 0;
     }
-
-    err = esp_ble_gatts_send_response(gatts_if, param->exec_write.conn_id, param->exec_write.trans_id, ESP_GATT_OK, NULL);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Send response error in exec write");
-    }
     if (outbuf) {
         free(outbuf);
     }
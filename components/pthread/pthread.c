@@ -70,6 +70,26 @@ static pthread_key_t s_pthread_cfg_key;
 
 static int pthread_mutex_lock_internal(esp_pthread_mutex_t *mux, TickType_t tmo);
 
+#if CONFIG_PTHREAD_STACK_POOL
+/** State of one slot of the preallocated stack/TCB pool */
+typedef enum {
+    PTHREAD_POOL_SLOT_FREE,     ///< Slot is available for the next pthread_create()
+    PTHREAD_POOL_SLOT_USED,     ///< Slot backs a live task
+    PTHREAD_POOL_SLOT_ZOMBIE,   ///< Detached thread exited; task sits suspended until it is reaped
+} esp_pthread_pool_slot_state_t;
+
+/** One preallocated thread slot: statically created task plus its stack */
+typedef struct {
+    StaticTask_t tcb;                       ///< TCB storage passed to xTaskCreateStaticPinnedToCore()
+    StackType_t *stack;                     ///< Stack buffer, allocated once on first use and kept
+    TaskHandle_t handle;                    ///< Handle of the task currently occupying the slot
+    esp_pthread_pool_slot_state_t state;
+} esp_pthread_pool_slot_t;
+
+static esp_pthread_pool_slot_t s_stack_pool[CONFIG_PTHREAD_STACK_POOL_SLOTS];
+static _lock_t s_stack_pool_lock;
+#endif // CONFIG_PTHREAD_STACK_POOL
+
 static void esp_pthread_cfg_key_destructor(void *value)
 {
     free(value);
@@ -297,6 +317,96 @@ static BaseType_t pthread_create_freertos_task_with_caps(TaskFunction_t pxTaskCo
 #endif
 }
 
+#if CONFIG_PTHREAD_STACK_POOL
+static esp_pthread_pool_slot_t *pthread_pool_find_slot(TaskHandle_t handle)
+{
+    for (int i = 0; i < CONFIG_PTHREAD_STACK_POOL_SLOTS; i++) {
+        if (s_stack_pool[i].state != PTHREAD_POOL_SLOT_FREE && s_stack_pool[i].handle == handle) {
+            return &s_stack_pool[i];
+        }
+    }
+    return NULL;
+}
+
+/* The slot memory must not be reused while the kernel still references the
+ * TCB. A self-deleting task is unlinked by the idle task at some later point,
+ * so pooled tasks never delete themselves: they suspend, and are deleted from
+ * another task's context here. Deleting a suspended (or ready) task unlinks
+ * the TCB immediately; only a task actively running on the other core would
+ * defer the cleanup, hence the wait below. */
+static void pthread_pool_wait_not_running(TaskHandle_t handle)
+{
+    while (eTaskGetState(handle) == eRunning) {
+        vTaskDelay(1);
+    }
+}
+
+static esp_pthread_pool_slot_t *pthread_pool_acquire(void)
+{
+    esp_pthread_pool_slot_t *slot = NULL;
+
+    _lock_acquire(&s_stack_pool_lock);
+    for (int i = 0; i < CONFIG_PTHREAD_STACK_POOL_SLOTS; i++) {
+        esp_pthread_pool_slot_t *it = &s_stack_pool[i];
+        if (it->state == PTHREAD_POOL_SLOT_ZOMBIE) {
+            pthread_pool_wait_not_running(it->handle);
+            vTaskDelete(it->handle);
+            it->state = PTHREAD_POOL_SLOT_FREE;
+        }
+        if (slot == NULL && it->state == PTHREAD_POOL_SLOT_FREE) {
+            if (it->stack == NULL) {
+                it->stack = heap_caps_malloc(CONFIG_PTHREAD_STACK_POOL_STACK_SIZE,
+                                             MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+                if (it->stack == NULL) {
+                    continue;
+                }
+            }
+            it->state = PTHREAD_POOL_SLOT_USED;
+            slot = it;
+        }
+    }
+    _lock_release(&s_stack_pool_lock);
+
+    return slot;
+}
+
+static void pthread_pool_release(esp_pthread_pool_slot_t *slot)
+{
+    _lock_acquire(&s_stack_pool_lock);
+    slot->state = PTHREAD_POOL_SLOT_FREE;
+    _lock_release(&s_stack_pool_lock);
+}
+
+/* Called by pthread_join()/pthread_detach() around their vTaskDelete(): wait
+ * until the pooled task has left the running state, and return the slot so it
+ * can be released once the task is deleted. NULL for non-pooled threads. */
+static esp_pthread_pool_slot_t *pthread_pool_prepare_delete(TaskHandle_t handle)
+{
+    _lock_acquire(&s_stack_pool_lock);
+    esp_pthread_pool_slot_t *slot = pthread_pool_find_slot(handle);
+    _lock_release(&s_stack_pool_lock);
+    if (slot) {
+        pthread_pool_wait_not_running(handle);
+    }
+    return slot;
+}
+
+/* Called by pthread_exit() for a detached pooled thread. Marks the slot so a
+ * later pthread_create() deletes the task; the caller must suspend itself
+ * instead of calling vTaskDelete(NULL). Returns false if the thread does not
+ * run out of the pool. */
+static bool pthread_pool_mark_zombie(TaskHandle_t handle)
+{
+    _lock_acquire(&s_stack_pool_lock);
+    esp_pthread_pool_slot_t *slot = pthread_pool_find_slot(handle);
+    if (slot) {
+        slot->state = PTHREAD_POOL_SLOT_ZOMBIE;
+    }
+    _lock_release(&s_stack_pool_lock);
+    return slot != NULL;
+}
+#endif // CONFIG_PTHREAD_STACK_POOL
+
 int pthread_create(pthread_t *thread, const pthread_attr_t *attr,
                    void *(*start_routine)(void *), void *arg)
 {
@@ -384,14 +494,45 @@ int pthread_create(pthread_t *thread, const pthread_attr_t *attr,
     task_arg->arg = arg;
     pthread->task_arg = task_arg;
 
-    BaseType_t res = pthread_create_freertos_task_with_caps(&pthread_task_func,
-                                                            task_name,
-                                                            stack_size,
-                                                            task_arg,
-                                                            prio,
-                                                            core_id,
-                                                            stack_alloc_caps,
-                                                            &xHandle);
+    BaseType_t res = pdFAIL;
+
+#if CONFIG_PTHREAD_STACK_POOL
+    /* Pooled slots live in internal RAM, so only threads with the default
+     * stack caps and a stack that fits the configured slot size are eligible.
+     * Everything else (and creation when the pool is exhausted) falls back to
+     * the regular allocating path below. */
+    if (stack_alloc_caps == (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) &&
+            stack_size <= CONFIG_PTHREAD_STACK_POOL_STACK_SIZE / sizeof(StackType_t)) {
+        esp_pthread_pool_slot_t *slot = pthread_pool_acquire();
+        if (slot) {
+            xHandle = xTaskCreateStaticPinnedToCore(&pthread_task_func,
+                                                    task_name,
+                                                    CONFIG_PTHREAD_STACK_POOL_STACK_SIZE / sizeof(StackType_t),
+                                                    task_arg,
+                                                    prio,
+                                                    slot->stack,
+                                                    &slot->tcb,
+                                                    core_id);
+            if (xHandle != NULL) {
+                slot->handle = xHandle;
+                res = pdPASS;
+            } else {
+                pthread_pool_release(slot);
+            }
+        }
+    }
+#endif // CONFIG_PTHREAD_STACK_POOL
+
+    if (res != pdPASS) {
+        res = pthread_create_freertos_task_with_caps(&pthread_task_func,
+                                                     task_name,
+                                                     stack_size,
+                                                     task_arg,
+                                                     prio,
+                                                     core_id,
+                                                     stack_alloc_caps,
+                                                     &xHandle);
+    }
 
     if (res != pdPASS) {
         ESP_LOGE(TAG, "Failed to create task!");
@@ -472,7 +613,15 @@ int pthread_join(pthread_t thread, void **retval)
         }
         /* clean up thread local storage before task deletion */
         pthread_internal_local_storage_destructor_callback(handle);
+#if CONFIG_PTHREAD_STACK_POOL
+        esp_pthread_pool_slot_t *slot = pthread_pool_prepare_delete(handle);
+        vTaskDelete(handle);
+        if (slot) {
+            pthread_pool_release(slot);
+        }
+#else
         vTaskDelete(handle);
+#endif
     }
 
     if (retval) {
@@ -507,7 +656,15 @@ int pthread_detach(pthread_t thread)
         pthread_delete(pthread);
         /* clean up thread local storage before task deletion */
         pthread_internal_local_storage_destructor_callback(handle);
+#if CONFIG_PTHREAD_STACK_POOL
+        esp_pthread_pool_slot_t *slot = pthread_pool_prepare_delete(handle);
         vTaskDelete(handle);
+        if (slot) {
+            pthread_pool_release(slot);
+        }
+#else
+        vTaskDelete(handle);
+#endif
     }
     _lock_release(&s_threads_lock);
     ESP_LOGV(TAG, "%s %p EXIT %d", __FUNCTION__, pthread, ret);
@@ -553,6 +710,14 @@ void pthread_exit(void *value_ptr)
     // do anything that might lock (such as printing to stdout)
 
     if (detached) {
+#if CONFIG_PTHREAD_STACK_POOL
+        /* A pooled task must not delete itself: self-deletion defers the TCB
+         * unlink to the idle task, and the slot cannot be reused until then.
+         * Park the task instead; the next pthread_create() reaps it. */
+        if (pthread_pool_mark_zombie(xTaskGetCurrentTaskHandle())) {
+            vTaskSuspend(NULL);
+        }
+#endif
         vTaskDelete(NULL);
     } else {
         vTaskSuspend(NULL);
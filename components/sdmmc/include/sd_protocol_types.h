@@ -213,6 +213,22 @@ typedef struct {
     esp_err_t (*get_dma_info)(int slot, esp_dma_mem_info_t *dma_mem_info); /*!< host function to dma memory information*/
 } sdmmc_host_t;
 
+/**
+ * SD/MMC command statistics, collected since the card was initialized
+ */
+typedef struct {
+    uint32_t cmd_count;         /*!< Total number of commands sent to the card */
+    uint32_t data_cmd_count;    /*!< Number of commands with a data phase */
+    uint64_t bytes_transferred; /*!< Total number of bytes moved in data phases */
+    uint64_t busy_time_us;      /*!< Total time spent executing commands, in microseconds */
+    uint32_t max_cmd_time_us;   /*!< Duration of the longest single command, in microseconds */
+    uint32_t timeout_count;     /*!< Number of commands that failed with a timeout */
+    uint32_t crc_error_count;   /*!< Number of commands that failed with a response or data CRC error */
+    uint32_t error_count;       /*!< Number of commands that failed with any other error */
+    uint32_t dma_direct_count;  /*!< Number of sector transfers which used DMA directly to/from the user buffer */
+    uint32_t dma_bounce_count;  /*!< Number of sector transfers which had to bounce through a DMA-capable buffer */
+} sdmmc_stats_t;
+
 /**
  * SD/MMC card information structure
  */
@@ -238,6 +254,7 @@ typedef struct {
     uint32_t log_bus_width : 2; /*!< log2(bus width supported by card) */
     uint32_t is_ddr : 1;        /*!< Card supports DDR mode */
     uint32_t reserved : 23;     /*!< Reserved for future expansion */
+    sdmmc_stats_t stats;        /*!< Command statistics, can be printed with sdmmc_card_print_info */
 } sdmmc_card_t;
 
 /**
@@ -49,6 +49,23 @@ void sdmmc_card_print_info(FILE* stream, const sdmmc_card_t* card);
  */
 esp_err_t sdmmc_get_status(sdmmc_card_t* card);
 
+/**
+ * Get a snapshot of the command and transfer statistics of the card
+ *
+ * Statistics are collected since the card was initialized with
+ * sdmmc_card_init. The dma_direct_count and dma_bounce_count fields can be
+ * used to check whether application buffers passed to sdmmc_read_sectors and
+ * sdmmc_write_sectors qualify for zero-copy DMA.
+ *
+ * @param card  pointer to card information structure previously initialized
+ *              using sdmmc_card_init
+ * @param out_stats  pointer to structure which receives the statistics
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if card or out_stats is NULL
+ */
+esp_err_t sdmmc_get_xfer_stats(const sdmmc_card_t* card, sdmmc_stats_t* out_stats);
+
 /**
  * Write given number of sectors to SD/MMC card
  *
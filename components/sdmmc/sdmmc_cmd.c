@@ -10,6 +10,11 @@
 
 static const char* TAG = "sdmmc_cmd";
 
+/* Maximum size of the temporary buffer used to bounce transfers from/to
+ * buffers which are not DMA-capable, in blocks. Bouncing several blocks at
+ * a time keeps multi-block commands usable for such buffers. */
+#define SDMMC_BOUNCE_BUF_MAX_BLOCKS 16
+
 
 esp_err_t sdmmc_send_cmd(sdmmc_card_t* card, sdmmc_command_t* cmd)
 {
@@ -22,7 +27,25 @@ esp_err_t sdmmc_send_cmd(sdmmc_card_t* card, sdmmc_command_t* cmd)
     int slot = card->host.slot;
     ESP_LOGV(TAG, "sending cmd slot=%d op=%" PRIu32 " arg=%" PRIx32 " flags=%x data=%p blklen=%" PRIu32 " datalen=%" PRIu32 " timeout=%" PRIu32,
             slot, cmd->opcode, cmd->arg, cmd->flags, cmd->data, (uint32_t) cmd->blklen, (uint32_t) cmd->datalen, cmd->timeout_ms);
+    int64_t t_start = esp_timer_get_time();
     esp_err_t err = (*card->host.do_transaction)(slot, cmd);
+    uint32_t cmd_time_us = (uint32_t)(esp_timer_get_time() - t_start);
+    card->stats.cmd_count++;
+    card->stats.busy_time_us += cmd_time_us;
+    if (cmd_time_us > card->stats.max_cmd_time_us) {
+        card->stats.max_cmd_time_us = cmd_time_us;
+    }
+    esp_err_t cmd_err = (err != ESP_OK) ? err : cmd->error;
+    if (cmd_err == ESP_ERR_TIMEOUT) {
+        card->stats.timeout_count++;
+    } else if (cmd_err == ESP_ERR_INVALID_CRC) {
+        card->stats.crc_error_count++;
+    } else if (cmd_err != ESP_OK) {
+        card->stats.error_count++;
+    } else if (cmd->data != NULL) {
+        card->stats.data_cmd_count++;
+        card->stats.bytes_transferred += cmd->datalen;
+    }
     if (err != 0) {
         ESP_LOGD(TAG, "cmd=%" PRIu32 ", sdmmc_req_run returned 0x%x", cmd->opcode, err);
         return err;
@@ -428,26 +451,33 @@ esp_err_t sdmmc_write_sectors(sdmmc_card_t* card, const void* src,
             && !esp_ptr_external_ram(src)
         #endif
     ) {
+        card->stats.dma_direct_count++;
         err = sdmmc_write_sectors_dma(card, src, start_block, block_count, block_size * block_count);
     } else {
-        // SDMMC peripheral needs DMA-capable buffers. Split the write into
-        // separate single block writes, if needed, and allocate a temporary
-        // DMA-capable buffer.
+        // SDMMC peripheral needs DMA-capable buffers. Bounce the write through
+        // a temporary DMA-capable buffer, several blocks at a time, so that
+        // multi-block commands can still be used.
+        card->stats.dma_bounce_count++;
         void *tmp_buf = NULL;
         size_t actual_size = 0;
         // Clear the SPIRAM flag. We don't want to force the allocation into SPIRAM, the allocator
         // will decide based on the buffer size and memory availability.
         dma_mem_info.extra_heap_caps &= ~MALLOC_CAP_SPIRAM;
-        err = esp_dma_capable_malloc(block_size, &dma_mem_info, &tmp_buf, &actual_size);
+        size_t bounce_blocks = MIN(block_count, SDMMC_BOUNCE_BUF_MAX_BLOCKS);
+        while ((err = esp_dma_capable_malloc(block_size * bounce_blocks, &dma_mem_info, &tmp_buf, &actual_size)) != ESP_OK
+                && bounce_blocks > 1) {
+            bounce_blocks /= 2;
+        }
         if (err != ESP_OK) {
             return err;
         }
 
         const uint8_t* cur_src = (const uint8_t*) src;
-        for (size_t i = 0; i < block_count; ++i) {
-            memcpy(tmp_buf, cur_src, block_size);
-            cur_src += block_size;
-            err = sdmmc_write_sectors_dma(card, tmp_buf, start_block + i, 1, actual_size);
+        for (size_t i = 0; i < block_count; i += bounce_blocks) {
+            size_t chunk = MIN(bounce_blocks, block_count - i);
+            memcpy(tmp_buf, cur_src, chunk * block_size);
+            cur_src += chunk * block_size;
+            err = sdmmc_write_sectors_dma(card, tmp_buf, start_block + i, chunk, actual_size);
             if (err != ESP_OK) {
                 ESP_LOGD(TAG, "%s: error 0x%x writing block %d+%d",
                         __func__, err, start_block, i);
@@ -568,27 +598,34 @@ esp_err_t sdmmc_read_sectors(sdmmc_card_t* card, void* dst,
             && !esp_ptr_external_ram(dst)
         #endif
     ) {
+        card->stats.dma_direct_count++;
         err = sdmmc_read_sectors_dma(card, dst, start_block, block_count, block_size * block_count);
     } else {
-        // SDMMC peripheral needs DMA-capable buffers. Split the read into
-        // separate single block reads, if needed, and allocate a temporary
-        // DMA-capable buffer.
+        // SDMMC peripheral needs DMA-capable buffers. Bounce the read through
+        // a temporary DMA-capable buffer, several blocks at a time, so that
+        // multi-block commands can still be used.
+        card->stats.dma_bounce_count++;
         void *tmp_buf = NULL;
         size_t actual_size = 0;
-        err = esp_dma_capable_malloc(block_size, &dma_mem_info, &tmp_buf, &actual_size);
+        size_t bounce_blocks = MIN(block_count, SDMMC_BOUNCE_BUF_MAX_BLOCKS);
+        while ((err = esp_dma_capable_malloc(block_size * bounce_blocks, &dma_mem_info, &tmp_buf, &actual_size)) != ESP_OK
+                && bounce_blocks > 1) {
+            bounce_blocks /= 2;
+        }
         if (err != ESP_OK) {
             return err;
         }
         uint8_t* cur_dst = (uint8_t*) dst;
-        for (size_t i = 0; i < block_count; ++i) {
-            err = sdmmc_read_sectors_dma(card, tmp_buf, start_block + i, 1, actual_size);
+        for (size_t i = 0; i < block_count; i += bounce_blocks) {
+            size_t chunk = MIN(bounce_blocks, block_count - i);
+            err = sdmmc_read_sectors_dma(card, tmp_buf, start_block + i, chunk, actual_size);
             if (err != ESP_OK) {
                 ESP_LOGD(TAG, "%s: error 0x%x writing block %d+%d",
                         __func__, err, start_block, i);
                 break;
             }
-            memcpy(cur_dst, tmp_buf, block_size);
-            cur_dst += block_size;
+            memcpy(cur_dst, tmp_buf, chunk * block_size);
+            cur_dst += chunk * block_size;
         }
         free(tmp_buf);
     }
@@ -833,3 +870,12 @@ esp_err_t sdmmc_get_status(sdmmc_card_t* card)
     uint32_t stat;
     return sdmmc_send_cmd_send_status(card, &stat);
 }
+
+esp_err_t sdmmc_get_xfer_stats(const sdmmc_card_t* card, sdmmc_stats_t* out_stats)
+{
+    if (card == NULL || out_stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *out_stats = card->stats;
+    return ESP_OK;
+}
@@ -308,6 +308,17 @@ void sdmmc_card_print_info(FILE* stream, const sdmmc_card_t* card)
     if (print_scr) {
         fprintf(stream, "SCR: sd_spec=%d, bus_width=%d\n", card->scr.sd_spec, card->scr.bus_width);
     }
+    if (card->stats.cmd_count > 0) {
+        fprintf(stream, "Stats: cmds=%" PRIu32 " (data=%" PRIu32 "), transferred=%llukB, busy=%llums, max_cmd=%" PRIu32 "us\n",
+                card->stats.cmd_count, card->stats.data_cmd_count,
+                (unsigned long long) (card->stats.bytes_transferred / 1024),
+                (unsigned long long) (card->stats.busy_time_us / 1000),
+                card->stats.max_cmd_time_us);
+        fprintf(stream, "Transfers: direct=%" PRIu32 ", bounced=%" PRIu32 "\n",
+                card->stats.dma_direct_count, card->stats.dma_bounce_count);
+        fprintf(stream, "Errors: timeout=%" PRIu32 ", crc=%" PRIu32 ", other=%" PRIu32 "\n",
+                card->stats.timeout_count, card->stats.crc_error_count, card->stats.error_count);
+    }
 }
 
 esp_err_t sdmmc_fix_host_flags(sdmmc_card_t* card)
@@ -20,6 +20,7 @@
 #define SOC_ADC_SUPPORTED               1
 #define SOC_DEDICATED_GPIO_SUPPORTED    1
 #define SOC_UART_SUPPORTED              1
+#define SOC_UHCI_SUPPORTED              1
 #define SOC_GDMA_SUPPORTED              1
 #define SOC_AHB_GDMA_SUPPORTED          1
 #define SOC_GPTIMER_SUPPORTED           1
@@ -130,6 +131,9 @@
 /*!< ADC power control is shared by PWDET */
 #define SOC_ADC_SHARED_POWER                    1
 
+/*!< ADC conversions can be triggered and observed by the ETM module */
+#define SOC_ADC_SUPPORT_ETM                     (1)
+
 // ESP32C6-TODO: Copy from esp32c6, need check
 /*-------------------------- APB BACKUP DMA CAPS -------------------------------*/
 #define SOC_APB_BACKUP_DMA              (0)
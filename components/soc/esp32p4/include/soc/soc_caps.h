@@ -150,6 +150,9 @@
 /*!< ADC power control is shared by PWDET, TempSensor */
 #define SOC_ADC_SHARED_POWER                    1
 
+/*!< ADC conversions can be triggered and observed by the ETM module */
+#define SOC_ADC_SUPPORT_ETM                     (1)
+
 // ESP32P4-TODO: Copy from esp32c6, need check
 /*-------------------------- APB BACKUP DMA CAPS -------------------------------*/
 #define SOC_APB_BACKUP_DMA              (0)
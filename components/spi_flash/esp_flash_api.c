@@ -21,6 +21,7 @@
 #include "esp_rom_spiflash.h"
 #include "esp_private/esp_clk.h"
 #include "esp_spi_flash_counters.h"
+#include "esp_private/spi_flash_tuning.h"
 
 #if CONFIG_IDF_TARGET_ESP32S2
 #include "esp_crypto_lock.h" // for locking flash encryption peripheral
@@ -318,7 +319,13 @@ esp_err_t IRAM_ATTR esp_flash_init(esp_flash_t *chip)
         }
     }
     // Done: all fields on 'chip' are initialised
-    return rom_spiflash_api_funcs->end(chip, err);
+    err = rom_spiflash_api_funcs->end(chip, err);
+#if CONFIG_SPI_FLASH_AUTO_CALIBRATE_READ_TIMING
+    if (err == ESP_OK) {
+        err = esp_flash_app_tune_read_timing(chip);
+    }
+#endif
+    return err;
 }
 
 // Note: This function is only used for internal. Only call this function to initialize the main flash.
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <sys/param.h>
+#include <sys/lock.h>
+
+#include "sdkconfig.h"
+#include "soc/soc_caps.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_memory_utils.h"
+#include "esp_flash.h"
+#include "spi_flash_mmap.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_private/esp_flash_bulk_read.h"
+
+#if SOC_ASYNC_MEMCPY_SUPPORTED
+#include "esp_async_memcpy.h"
+#endif
+
+static const char TAG[] = "flash_bulk";
+
+#if SOC_ASYNC_MEMCPY_SUPPORTED
+
+static async_memcpy_handle_t s_bulk_mcp;
+static SemaphoreHandle_t s_bulk_done;
+static _lock_t s_bulk_lock;
+
+static bool s_bulk_copy_done_cb(async_memcpy_handle_t mcp_hdl, async_memcpy_event_t *event, void *cb_args)
+{
+    BaseType_t high_task_wakeup = pdFALSE;
+    xSemaphoreGiveFromISR((SemaphoreHandle_t)cb_args, &high_task_wakeup);
+    return high_task_wakeup == pdTRUE;
+}
+
+static esp_err_t s_bulk_engine_init(void)
+{
+    esp_err_t err = ESP_OK;
+    _lock_acquire(&s_bulk_lock);
+    if (s_bulk_mcp == NULL) {
+        s_bulk_done = xSemaphoreCreateBinary();
+        if (s_bulk_done == NULL) {
+            err = ESP_ERR_NO_MEM;
+        } else {
+            async_memcpy_config_t config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+            err = esp_async_memcpy_install(&config, &s_bulk_mcp);
+            if (err != ESP_OK) {
+                vSemaphoreDelete(s_bulk_done);
+                s_bulk_done = NULL;
+            }
+        }
+    }
+    _lock_release(&s_bulk_lock);
+    return err;
+}
+
+static esp_err_t s_bulk_read_dma(void *buffer, uint32_t address, uint32_t length)
+{
+    esp_err_t err = s_bulk_engine_init();
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    // Map the source region through the MMU, so the copy engine sees it as
+    // ordinary cached memory and can stream it without suspending the cache.
+    uint32_t map_start = address & ~(SPI_FLASH_MMU_PAGE_SIZE - 1);
+    uint32_t map_size = (address + length - map_start + SPI_FLASH_MMU_PAGE_SIZE - 1) & ~(SPI_FLASH_MMU_PAGE_SIZE - 1);
+    const void *map_ptr = NULL;
+    spi_flash_mmap_handle_t map_handle;
+    err = spi_flash_mmap(map_start, map_size, SPI_FLASH_MMAP_DATA, &map_ptr, &map_handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    const uint8_t *src = (const uint8_t *)map_ptr + (address - map_start);
+
+    // One waiter at a time; the copy itself is fully descriptor-driven
+    _lock_acquire(&s_bulk_lock);
+    err = esp_async_memcpy(s_bulk_mcp, buffer, (void *)src, length, s_bulk_copy_done_cb, s_bulk_done);
+    if (err == ESP_OK) {
+        xSemaphoreTake(s_bulk_done, portMAX_DELAY);
+    }
+    _lock_release(&s_bulk_lock);
+
+    spi_flash_munmap(map_handle);
+    return err;
+}
+#endif // SOC_ASYNC_MEMCPY_SUPPORTED
+
+esp_err_t esp_flash_read_bulk(esp_flash_t *chip, void *buffer, uint32_t address, uint32_t length)
+{
+#if SOC_ASYNC_MEMCPY_SUPPORTED
+    bool dma_eligible = (chip == NULL || chip == esp_flash_default_chip)
+                        && length >= CONFIG_SPI_FLASH_BULK_READ_MIN_SIZE
+                        && buffer != NULL
+                        && esp_ptr_dma_capable(buffer)
+                        && !xPortInIsrContext();
+    if (dma_eligible) {
+        esp_err_t err = s_bulk_read_dma(buffer, address, length);
+        if (err == ESP_OK) {
+            return ESP_OK;
+        }
+        ESP_LOGD(TAG, "DMA bulk read failed (0x%x), falling back to CPU path", err);
+    }
+#endif // SOC_ASYNC_MEMCPY_SUPPORTED
+    return esp_flash_read(chip, buffer, address, length);
+}
@@ -233,6 +233,97 @@ err:
 }
 
 
+esp_err_t spi_flash_mmap_batch(const spi_flash_mmap_region_t *regions, size_t region_count,
+                         spi_flash_mmap_memory_t memory, const void **out_ptrs,
+                         spi_flash_mmap_handle_t *out_handle)
+{
+    esp_err_t ret = ESP_FAIL;
+    mmu_mem_caps_t caps = 0;
+    mmap_block_t *block = NULL;
+    uint32_t *vaddr_list = NULL;
+    int successful_cnt = 0;
+
+    if (!regions || region_count == 0 || !out_ptrs || !out_handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    /**
+     * Merge physically adjacent input regions into runs, so each run costs one
+     * MMU walk and one batch of TLB entries instead of one per region.
+     * run_of[i] remembers which run region i landed in, run_off[i] its byte
+     * offset inside that run.
+     */
+    int run_num = 0;
+    size_t run_start[region_count], run_size[region_count];
+    int run_of[region_count];
+    size_t run_off[region_count];
+    for (size_t i = 0; i < region_count; i++) {
+        if (regions[i].size == 0) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (run_num > 0 && regions[i].src_addr == run_start[run_num - 1] + run_size[run_num - 1]) {
+            run_of[i] = run_num - 1;
+            run_off[i] = run_size[run_num - 1];
+            run_size[run_num - 1] += regions[i].size;
+        } else {
+            run_start[run_num] = regions[i].src_addr;
+            run_size[run_num] = regions[i].size;
+            run_of[i] = run_num;
+            run_off[i] = 0;
+            run_num++;
+        }
+    }
+
+    block = heap_caps_calloc(1, sizeof(mmap_block_t), MALLOC_CAP_INTERNAL);
+    if (!block) {
+        ret = ESP_ERR_NO_MEM;
+        goto err;
+    }
+
+    vaddr_list = heap_caps_calloc(1, run_num * sizeof(uint32_t), MALLOC_CAP_INTERNAL);
+    if (!vaddr_list) {
+        ret = ESP_ERR_NO_MEM;
+        goto err;
+    }
+
+    if (memory == SPI_FLASH_MMAP_INST) {
+        caps = MMU_MEM_CAP_EXEC | MMU_MEM_CAP_32BIT;
+    } else {
+        caps = MMU_MEM_CAP_READ | MMU_MEM_CAP_8BIT;
+    }
+    for (int i = 0; i < run_num; i++) {
+        void *ptr = NULL;
+        ret = esp_mmu_map(run_start[i], run_size[i], MMU_TARGET_FLASH0, caps, ESP_MMU_MMAP_FLAG_PADDR_SHARED, &ptr);
+        if (ret != ESP_OK) {
+            goto err;
+        }
+        vaddr_list[i] = (uint32_t)ptr;
+        successful_cnt++;
+    }
+
+    block->vaddr_list = vaddr_list;
+    block->list_num = successful_cnt;
+
+    for (size_t i = 0; i < region_count; i++) {
+        out_ptrs[i] = (const void *)(vaddr_list[run_of[i]] + run_off[i]);
+    }
+    *out_handle = (uint32_t)block;
+
+    return ESP_OK;
+
+err:
+    for (int i = 0; i < successful_cnt; i++) {
+        esp_mmu_unmap((void *)vaddr_list[i]);
+    }
+    if (vaddr_list) {
+        free(vaddr_list);
+    }
+    if (block) {
+        free(block);
+    }
+    return ret;
+}
+
 void spi_flash_munmap(spi_flash_mmap_handle_t handle)
 {
     esp_err_t ret = ESP_FAIL;
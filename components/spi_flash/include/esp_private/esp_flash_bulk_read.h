@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_flash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Read a large region of flash into a DRAM buffer using the DMA bulk path
+ *
+ * For transfers of at least CONFIG_SPI_FLASH_BULK_READ_MIN_SIZE bytes whose
+ * destination is an internal, DMA-capable buffer, the data is streamed through
+ * an MMU mapping of the source region and copied by the GDMA-backed async
+ * memcpy engine, instead of chunked CPU copies with the cache suspended.
+ * Smaller or unaligned requests, external-RAM destinations, and non-default
+ * chips transparently fall back to esp_flash_read().
+ *
+ * @param chip    Pointer to identify flash chip. Must be NULL or the default
+ *                chip for the DMA path to be taken (other chips fall back).
+ * @param buffer  Pointer to a buffer where the data will be read. To get better
+ *                performance, this should be in internal DRAM and word aligned.
+ * @param address Address on flash to read from. Must be less than chip->size
+ * @param length  Length (in bytes) of data to read.
+ *
+ * @return
+ *      - ESP_OK: success
+ *      - or a flash error code from esp_flash_read() on fallback/failure
+ */
+esp_err_t esp_flash_read_bulk(esp_flash_t *chip, void *buffer, uint32_t address, uint32_t length);
+
+#ifdef __cplusplus
+}
+#endif
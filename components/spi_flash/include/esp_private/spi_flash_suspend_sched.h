@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_flash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Install the erase-suspend-aware scheduling policy on a chip
+ *
+ * Wraps the chip's current `esp_flash_os_functions_t` with a policy that keeps
+ * track of tasks blocked in `start` while another task holds the chip for a
+ * long erase. While a waiter is registered, `check_yield` requests a yield
+ * immediately instead of waiting for the configured erase-yield interval, so
+ * the erase is suspended (on chips with program/erase suspend support) and
+ * the waiting reads run with bounded latency.
+ *
+ * The policy is opt-in per chip, and a no-op on chips whose driver does not
+ * support suspend. Call esp_flash_app_disable_suspend_scheduler() to restore
+ * the previous OS functions.
+ *
+ * @param chip The flash chip to install the policy on. Must already be initialized.
+ *
+ * @return
+ *      - ESP_OK: success
+ *      - ESP_ERR_INVALID_ARG: chip is NULL or has no OS functions installed
+ *      - ESP_ERR_NOT_SUPPORTED: the chip driver has no suspend support
+ *      - ESP_ERR_INVALID_STATE: the policy is already installed
+ */
+esp_err_t esp_flash_app_enable_suspend_scheduler(esp_flash_t *chip);
+
+/**
+ * @brief Remove the erase-suspend-aware scheduling policy from a chip
+ *
+ * @param chip The flash chip to restore. Must be the same chip previously
+ *             passed to esp_flash_app_enable_suspend_scheduler().
+ *
+ * @return
+ *      - ESP_OK: success
+ *      - ESP_ERR_INVALID_ARG: chip is NULL
+ *      - ESP_ERR_INVALID_STATE: the policy is not installed on this chip
+ */
+esp_err_t esp_flash_app_disable_suspend_scheduler(esp_flash_t *chip);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,40 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "esp_flash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Verify and, if needed, compensate the read timing of a chip
+ *
+ * Re-reads a small reference window several times and checks that the data is
+ * stable at the chip's configured frequency and dummy-cycle count. If it is
+ * not, up to two extra compensation dummy cycles are tried before giving up.
+ * Run automatically at the end of esp_flash_init() when
+ * CONFIG_SPI_FLASH_AUTO_CALIBRATE_READ_TIMING is enabled; may also be called
+ * manually after changing bus timing.
+ *
+ * Only intended for chips attached via esp_flash_spi_init (SPI2/SPI3); the
+ * main flash timing is owned by the bootloader/HPM code.
+ *
+ * @param chip The initialized chip to tune
+ *
+ * @return
+ *      - ESP_OK: a stable setting is in effect
+ *      - ESP_ERR_FLASH_NOT_INITIALISED: no stable setting found at this frequency
+ *      - ESP_ERR_INVALID_ARG: chip or its host is NULL
+ */
+esp_err_t esp_flash_app_tune_read_timing(esp_flash_t *chip);
+
+#ifdef __cplusplus
+}
+#endif
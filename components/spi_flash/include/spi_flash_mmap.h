@@ -94,6 +94,38 @@ esp_err_t spi_flash_mmap(size_t src_addr, size_t size, spi_flash_mmap_memory_t m
 esp_err_t spi_flash_mmap_pages(const int *pages, size_t page_count, spi_flash_mmap_memory_t memory,
                          const void** out_ptr, spi_flash_mmap_handle_t* out_handle);
 
+/**
+ * @brief A physical flash region to be mapped by spi_flash_mmap_batch
+ */
+typedef struct {
+    size_t src_addr;    ///< Physical address in flash where the region starts, must be aligned to 64kB
+    size_t size;        ///< Size of the region, in bytes
+} spi_flash_mmap_region_t;
+
+/**
+ * @brief Map several regions of flash in one call, sharing one handle
+ *
+ * Compared to calling spi_flash_mmap() once per region, this walks the MMU
+ * table once, coalesces physically adjacent regions before programming TLB
+ * entries, and either maps all regions or none. All regions share one handle
+ * and are released together by a single spi_flash_munmap() call.
+ *
+ * @param regions      Array of regions to map. Must be located in internal memory.
+ * @param region_count Number of entries in the regions array
+ * @param memory       Whether to map the regions to data or instruction address space
+ * @param[out] out_ptrs    Array (region_count entries) filled with the mapped
+ *                         virtual address of each region, in input order
+ * @param[out] out_handle  Handle which should be used for spi_flash_munmap call
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_NO_MEM if pages can not be allocated
+ *      - ESP_ERR_INVALID_ARG if region_count is zero or an address is unaligned
+ */
+esp_err_t spi_flash_mmap_batch(const spi_flash_mmap_region_t *regions, size_t region_count,
+                         spi_flash_mmap_memory_t memory, const void **out_ptrs,
+                         spi_flash_mmap_handle_t *out_handle);
+
 
 /**
  * @brief Release region previously obtained using spi_flash_mmap
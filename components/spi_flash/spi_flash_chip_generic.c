@@ -281,6 +281,53 @@ esp_err_t spi_flash_chip_generic_write(esp_flash_t *chip, const void *buffer, ui
     esp_err_t err = ESP_OK;
     const uint32_t page_size = chip->chip_drv->page_size;
     uint32_t align_address;
+
+    if (chip->chip_drv->program_page == spi_flash_chip_generic_page_program) {
+        /* Pipelined path: the completion wait of each program command is
+         * deferred until just before the next WREN, so slicing and staging the
+         * next chunk overlaps with the chip programming the previous one.
+         * Only valid when the chip uses the generic page program sequence;
+         * vendor overrides keep the non-overlapped loop below.
+         */
+        uint8_t ping_pong_buffer[2][64]; //spiflash hal max length of write no longer than 64byte
+        int slot = 0;
+        bool in_flight = false;
+
+        while (err == ESP_OK && length > 0) {
+            uint8_t *temp_buffer = ping_pong_buffer[slot];
+            memset(temp_buffer, 0xFF, sizeof(ping_pong_buffer[0]));
+            uint32_t page_len = chip->host->driver->write_data_slicer(chip->host, address, length, &align_address, page_size);
+            uint32_t left_off = address - align_address;
+            uint32_t write_len = MIN(align_address + page_len, address + length) - address;
+            memcpy(temp_buffer + left_off, buffer, write_len);
+
+            if (in_flight) {
+                err = chip->chip_drv->wait_idle(chip, chip->chip_drv->timeout->page_program_timeout);
+                if (err != ESP_OK) {
+                    break;
+                }
+            }
+            err = chip->chip_drv->set_chip_write_protect(chip, false);
+            if (err == ESP_OK) {
+                chip->host->driver->program_page(chip->host, temp_buffer, align_address, page_len);
+                chip->busy = 1;
+                in_flight = true;
+
+                address += write_len;
+                buffer = (void *)((intptr_t)buffer + write_len);
+                length -= write_len;
+                slot ^= 1;
+            }
+        }
+        if (in_flight) {
+            esp_err_t wait_err = chip->chip_drv->wait_idle(chip, chip->chip_drv->timeout->page_program_timeout);
+            if (err == ESP_OK) {
+                err = wait_err;
+            }
+        }
+        return err;
+    }
+
     uint8_t temp_buffer[64]; //spiflash hal max length of write no longer than 64byte
 
     while (err == ESP_OK && length > 0) {
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_attr.h"
+#include "esp_flash.h"
+#include "memspi_host_driver.h"
+#include "hal/spi_flash_hal.h"
+#include "esp_private/spi_flash_tuning.h"
+
+static const char TAG[] = "flash_tuning";
+
+#define TUNING_SAMPLE_ADDR      0       // reference window read during tuning
+#define TUNING_SAMPLE_LEN       64
+#define TUNING_SAMPLE_ROUNDS    4       // re-reads that must match per setting
+#define TUNING_MAX_EXTRA_DUMMY  2       // extra compensation cycles to try
+
+/**
+ * A read setting is considered stable when several re-reads of the reference
+ * window return identical data. Marginal dummy-cycle/frequency combinations
+ * show up as bit flips between re-reads long before they corrupt every read.
+ */
+static esp_err_t s_read_is_stable(esp_flash_t *chip, bool *out_stable)
+{
+    uint8_t reference[TUNING_SAMPLE_LEN];
+    uint8_t sample[TUNING_SAMPLE_LEN];
+
+    esp_err_t err = esp_flash_read(chip, reference, TUNING_SAMPLE_ADDR, sizeof(reference));
+    if (err != ESP_OK) {
+        return err;
+    }
+    for (int round = 1; round < TUNING_SAMPLE_ROUNDS; round++) {
+        err = esp_flash_read(chip, sample, TUNING_SAMPLE_ADDR, sizeof(sample));
+        if (err != ESP_OK) {
+            return err;
+        }
+        if (memcmp(reference, sample, sizeof(sample)) != 0) {
+            *out_stable = false;
+            return ESP_OK;
+        }
+    }
+    *out_stable = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_flash_app_tune_read_timing(esp_flash_t *chip)
+{
+    if (chip == NULL || chip->host == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memspi_host_inst_t *host = (memspi_host_inst_t *)chip->host;
+    uint8_t base_dummy = host->extra_dummy;
+
+    for (uint8_t extra = 0; extra <= TUNING_MAX_EXTRA_DUMMY; extra++) {
+        host->extra_dummy = base_dummy + extra;
+        bool stable = false;
+        esp_err_t err = s_read_is_stable(chip, &stable);
+        if (err != ESP_OK) {
+            host->extra_dummy = base_dummy;
+            return err;
+        }
+        if (stable) {
+            if (extra != 0) {
+                ESP_LOGW(TAG, "read unstable at %dMHz with %d dummy cycles, compensated with +%d",
+                         host->freq_mhz, base_dummy, extra);
+            } else {
+                ESP_LOGD(TAG, "read timing stable at %dMHz, no compensation needed", host->freq_mhz);
+            }
+            return ESP_OK;
+        }
+    }
+
+    // No dummy setting was stable at the configured frequency; restore the
+    // pre-calculated value and report, so the caller can drop the frequency.
+    host->extra_dummy = base_dummy;
+    ESP_LOGE(TAG, "no stable read timing found at %dMHz, consider a lower flash frequency", host->freq_mhz);
+    return ESP_ERR_FLASH_NOT_INITIALISED;
+}
@@ -0,0 +1,162 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdatomic.h>
+
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_flash.h"
+#include "spi_flash_chip_driver.h"
+#include "esp_private/spi_flash_suspend_sched.h"
+
+static const char TAG[] = "flash_sus_sched";
+
+/**
+ * The scheduler is a thin shim around the chip's existing OS functions:
+ *
+ * - `start` counts the task as a waiter while it is blocked on the inner
+ *   `start`, so the erasing task can see that someone wants the chip;
+ * - `check_yield` (called periodically by the erasing task) requests a yield
+ *   as soon as a waiter is registered, instead of waiting out the configured
+ *   erase-yield interval. The chip driver then suspends the erase, the
+ *   waiter's operation runs, and the erase is resumed afterwards.
+ *
+ * All hooks may run with the cache disabled, so both the code and the context
+ * live in IRAM/DRAM.
+ */
+typedef struct {
+    const esp_flash_os_functions_t *inner_func; // the wrapped OS functions
+    void *inner_arg;                            // their original argument
+    volatile atomic_int waiters;                // tasks blocked in start()
+} suspend_sched_arg_t;
+
+static IRAM_ATTR esp_err_t sched_start(void *arg)
+{
+    suspend_sched_arg_t *ctx = (suspend_sched_arg_t *)arg;
+    atomic_fetch_add(&ctx->waiters, 1);
+    esp_err_t ret = ctx->inner_func->start(ctx->inner_arg);
+    atomic_fetch_sub(&ctx->waiters, 1);
+    return ret;
+}
+
+static IRAM_ATTR esp_err_t sched_end(void *arg)
+{
+    suspend_sched_arg_t *ctx = (suspend_sched_arg_t *)arg;
+    return ctx->inner_func->end(ctx->inner_arg);
+}
+
+static IRAM_ATTR esp_err_t sched_region_protected(void *arg, size_t start_addr, size_t size)
+{
+    suspend_sched_arg_t *ctx = (suspend_sched_arg_t *)arg;
+    return ctx->inner_func->region_protected(ctx->inner_arg, start_addr, size);
+}
+
+static IRAM_ATTR esp_err_t sched_delay_us(void *arg, uint32_t us)
+{
+    suspend_sched_arg_t *ctx = (suspend_sched_arg_t *)arg;
+    return ctx->inner_func->delay_us(ctx->inner_arg, us);
+}
+
+static IRAM_ATTR void *sched_get_temp_buffer(void *arg, size_t reqest_size, size_t *out_size)
+{
+    suspend_sched_arg_t *ctx = (suspend_sched_arg_t *)arg;
+    return ctx->inner_func->get_temp_buffer(ctx->inner_arg, reqest_size, out_size);
+}
+
+static IRAM_ATTR void sched_release_temp_buffer(void *arg, void *temp_buf)
+{
+    suspend_sched_arg_t *ctx = (suspend_sched_arg_t *)arg;
+    ctx->inner_func->release_temp_buffer(ctx->inner_arg, temp_buf);
+}
+
+static IRAM_ATTR esp_err_t sched_check_yield(void *arg, uint32_t chip_status, uint32_t *out_request)
+{
+    suspend_sched_arg_t *ctx = (suspend_sched_arg_t *)arg;
+    if ((chip_status & SPI_FLASH_OS_IS_ERASING_STATUS_FLAG) && atomic_load(&ctx->waiters) > 0) {
+        // Someone is blocked on the chip: ask the caller to yield right away,
+        // so the ongoing erase is suspended and the waiter can slip in.
+        *out_request = SPI_FLASH_YIELD_REQ_YIELD;
+        return ESP_OK;
+    }
+    return ctx->inner_func->check_yield(ctx->inner_arg, chip_status, out_request);
+}
+
+static IRAM_ATTR esp_err_t sched_yield(void *arg, uint32_t *out_status)
+{
+    suspend_sched_arg_t *ctx = (suspend_sched_arg_t *)arg;
+    return ctx->inner_func->yield(ctx->inner_arg, out_status);
+}
+
+static IRAM_ATTR int64_t sched_get_system_time(void *arg)
+{
+    suspend_sched_arg_t *ctx = (suspend_sched_arg_t *)arg;
+    return ctx->inner_func->get_system_time(ctx->inner_arg);
+}
+
+static IRAM_ATTR void sched_set_flash_op_status(uint32_t op_status)
+{
+    // status is global, not per-chip; forwarding needs no context
+}
+
+static DRAM_ATTR esp_flash_os_functions_t s_sched_os_functions = {
+    .start = sched_start,
+    .end = sched_end,
+    .region_protected = sched_region_protected,
+    .delay_us = sched_delay_us,
+    .get_temp_buffer = sched_get_temp_buffer,
+    .release_temp_buffer = sched_release_temp_buffer,
+    .check_yield = sched_check_yield,
+    .yield = sched_yield,
+    .get_system_time = sched_get_system_time,
+    .set_flash_op_status = sched_set_flash_op_status,
+};
+
+esp_err_t esp_flash_app_enable_suspend_scheduler(esp_flash_t *chip)
+{
+    if (chip == NULL || chip->os_func == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (chip->os_func == &s_sched_os_functions) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (chip->chip_drv == NULL || chip->chip_drv->sus_setup == NULL
+            || (chip->chip_drv->get_chip_caps && !(chip->chip_drv->get_chip_caps(chip) & SPI_FLASH_CHIP_CAP_SUSPEND))) {
+        ESP_LOGW(TAG, "chip has no program/erase suspend support");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    suspend_sched_arg_t *ctx = heap_caps_calloc(1, sizeof(suspend_sched_arg_t),
+                                                MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (ctx == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    ctx->inner_func = chip->os_func;
+    ctx->inner_arg = chip->os_func_data;
+    atomic_init(&ctx->waiters, 0);
+
+    s_sched_os_functions.set_flash_op_status = chip->os_func->set_flash_op_status;
+    chip->os_func_data = ctx;
+    chip->os_func = &s_sched_os_functions;
+    return ESP_OK;
+}
+
+esp_err_t esp_flash_app_disable_suspend_scheduler(esp_flash_t *chip)
+{
+    if (chip == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (chip->os_func != &s_sched_os_functions) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    suspend_sched_arg_t *ctx = (suspend_sched_arg_t *)chip->os_func_data;
+    chip->os_func = ctx->inner_func;
+    chip->os_func_data = ctx->inner_arg;
+    free(ctx);
+    return ESP_OK;
+}
@@ -20,6 +20,7 @@
 #include <sys/lock.h>
 #include "esp_vfs.h"
 #include "esp_err.h"
+#include "esp_timer.h"
 #include "esp_rom_spiflash.h"
 
 #include "spiffs_api.h"
@@ -399,6 +400,62 @@ esp_err_t esp_spiffs_gc(const char* partition_label, size_t size_to_gc)
     return ESP_OK;
 }
 
+esp_err_t esp_spiffs_gc_hint(const char* partition_label, size_t size_to_gc, uint32_t budget_ms)
+{
+    int index;
+    if (esp_spiffs_by_label(partition_label, &index) != ESP_OK) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    spiffs *fs = _efs[index]->fs;
+    const int64_t deadline = esp_timer_get_time() + (int64_t)budget_ms * 1000;
+
+    // Erasing blocks which only hold deleted pages is cheap, always start with that
+    int res = SPIFFS_gc_quick(fs, 0);
+    if (res != SPIFFS_OK) {
+        SPIFFS_clearerr(fs);
+    }
+
+    uint32_t total = 0;
+    uint32_t used = 0;
+    uint32_t prev_free = UINT32_MAX;
+    while (true) {
+        res = SPIFFS_info(fs, &total, &used);
+        if (res != SPIFFS_OK) {
+            ESP_LOGE(TAG, "SPIFFS_info failed, %" PRId32, SPIFFS_errno(fs));
+            SPIFFS_clearerr(fs);
+            return ESP_FAIL;
+        }
+        uint32_t free_bytes = total - used;
+        if (free_bytes >= size_to_gc) {
+            return ESP_OK;
+        }
+        if (free_bytes == prev_free) {
+            // The last GC run made no progress, the requested space cannot be reclaimed
+            return ESP_ERR_NOT_FINISHED;
+        }
+        prev_free = free_bytes;
+        if (esp_timer_get_time() >= deadline) {
+            return ESP_ERR_TIMEOUT;
+        }
+        // Raise the free space target by one logical block per run, so every
+        // SPIFFS_gc call stays bounded to roughly one block move and erase
+        uint32_t step = free_bytes + _efs[index]->cfg.log_block_size;
+        if (step > size_to_gc) {
+            step = size_to_gc;
+        }
+        res = SPIFFS_gc(fs, step);
+        if (res != SPIFFS_OK) {
+            s32_t err = SPIFFS_errno(fs);
+            SPIFFS_clearerr(fs);
+            if (res == SPIFFS_ERR_FULL || err == SPIFFS_ERR_FULL) {
+                return ESP_ERR_NOT_FINISHED;
+            }
+            ESP_LOGE(TAG, "SPIFFS_gc failed, %d", res);
+            return ESP_FAIL;
+        }
+    }
+}
+
 esp_err_t esp_vfs_spiffs_register(const esp_vfs_spiffs_conf_t * conf)
 {
     assert(conf->base_path);
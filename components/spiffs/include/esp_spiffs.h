@@ -124,6 +124,35 @@ esp_err_t esp_spiffs_check(const char* partition_label);
  */
 esp_err_t esp_spiffs_gc(const char* partition_label, size_t size_to_gc);
 
+/**
+ * @brief Perform time-bounded garbage collection in SPIFFS partition
+ *
+ * Behaves like esp_spiffs_gc(), but limits the time spent in the garbage
+ * collector: the GC is performed one logical block at a time and stops once
+ * either the requested amount of free space is available or the time budget
+ * is exhausted. This allows an application to run GC proactively from an idle
+ * or housekeeping task in small slices, instead of paying the whole GC cost
+ * inside whichever write operation happens to trigger it.
+ *
+ * The call always starts with a quick pass which erases blocks consisting
+ * entirely of deleted pages. If the budget runs out, the space reclaimed so
+ * far remains available and the call can simply be repeated later.
+ *
+ * @param partition_label  Label of the partition to be garbage-collected.
+ *                         The partition must be already mounted.
+ * @param size_to_gc       The number of bytes of free space the GC process
+ *                         should attempt to make available.
+ * @param budget_ms        Maximum time to spend, in milliseconds. With a zero
+ *                         budget only the quick pass is performed.
+ * @return
+ *          - ESP_OK if at least size_to_gc bytes are free
+ *          - ESP_ERR_TIMEOUT if the time budget was exhausted first
+ *          - ESP_ERR_NOT_FINISHED if the requested space cannot be reclaimed
+ *          - ESP_ERR_INVALID_STATE if the partition is not mounted
+ *          - ESP_FAIL on all other errors
+ */
+esp_err_t esp_spiffs_gc_hint(const char* partition_label, size_t size_to_gc, uint32_t budget_ms);
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,6 +9,7 @@
 
 #include <esp_err.h>
 #include <stdbool.h>
+#include <sys/uio.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,8 +28,14 @@ typedef struct esp_transport_keepalive {
 typedef struct esp_transport_list_t* esp_transport_list_handle_t;
 typedef struct esp_transport_item_t* esp_transport_handle_t;
 
+/**
+ * @brief I/O vector for scatter-gather transport operations, equivalent to POSIX struct iovec
+ */
+typedef struct iovec esp_transport_iovec_t;
+
 typedef int (*connect_func)(esp_transport_handle_t t, const char *host, int port, int timeout_ms);
 typedef int (*io_func)(esp_transport_handle_t t, const char *buffer, int len, int timeout_ms);
+typedef int (*io_writev_func)(esp_transport_handle_t t, const esp_transport_iovec_t *iov, int iovcnt, int timeout_ms);
 typedef int (*io_read_func)(esp_transport_handle_t t, char *buffer, int len, int timeout_ms);
 typedef int (*trans_func)(esp_transport_handle_t t);
 typedef int (*poll_func)(esp_transport_handle_t t, int timeout_ms);
@@ -220,6 +227,50 @@ int esp_transport_poll_read(esp_transport_handle_t t, int timeout_ms);
  */
 int esp_transport_write(esp_transport_handle_t t, const char *buffer, int len, int timeout_ms);
 
+/**
+ * @brief      Vectored transport write function
+ *
+ *             Writes the buffers described by iov in order, as if they were concatenated.
+ *             Transports providing a scatter-gather implementation submit the whole vector
+ *             at once (the plain TCP transport maps it to socket writev(), the WebSocket
+ *             transport packs all buffers into a single frame), so protocol clients do not
+ *             have to assemble header and payload into one flat copy. Transports without
+ *             such an implementation fall back to writing the buffers sequentially.
+ *
+ * @param      t           The transport handle
+ * @param      iov         Array of buffers to write
+ * @param[in]  iovcnt      Number of entries in iov
+ * @param[in]  timeout_ms  The timeout milliseconds (-1 indicates wait forever)
+ *
+ * @return
+ *  - Total number of bytes written
+ *  - (-1) if there are any errors, should check errno
+ */
+int esp_transport_writev(esp_transport_handle_t t, const esp_transport_iovec_t *iov, int iovcnt, int timeout_ms);
+
+/**
+ * @brief      Vectored transport read function
+ *
+ *             Deposits received data directly into the buffers described by iov in order,
+ *             e.g. into the two free segments of a caller's ring buffer, without an
+ *             intermediate copy. The first buffer is read with the supplied timeout;
+ *             subsequent buffers are only filled from data that is already available, so
+ *             the call returns as soon as the transport would have to block again.
+ *
+ * @param      t           The transport handle
+ * @param      iov         Array of buffers to fill
+ * @param[in]  iovcnt      Number of entries in iov
+ * @param[in]  timeout_ms  The timeout milliseconds (-1 indicates wait forever)
+ *
+ * @return
+ *  - Total number of bytes read
+ *  - 0    Read timed-out
+ *  - (<0) For other errors
+ *
+ * @note: Please refer to the enum `esp_tcp_transport_err_t` for all the possible return values
+ */
+int esp_transport_readv(esp_transport_handle_t t, const esp_transport_iovec_t *iov, int iovcnt, int timeout_ms);
+
 /**
  * @brief      Poll the transport until writeable or timeout
  *
@@ -312,6 +363,22 @@ esp_err_t esp_transport_set_func(esp_transport_handle_t t,
  */
 esp_err_t esp_transport_set_async_connect_func(esp_transport_handle_t t, connect_async_func _connect_async_func);
 
+/**
+ * @brief      Set the scatter-gather write function for the transport handle
+ *
+ *             Transports which do not set one are still usable with
+ *             esp_transport_writev(), which then falls back to writing the
+ *             buffers sequentially through the plain write function.
+ *
+ * @param[in]  t        The transport handle
+ * @param[in]  _writev  The vectored write function pointer
+ *
+ * @return
+ *     - ESP_OK
+ *     - ESP_FAIL
+ */
+esp_err_t esp_transport_set_writev_func(esp_transport_handle_t t, io_writev_func _writev);
+
 /**
  * @brief      Set parent transport function to the handle
  *
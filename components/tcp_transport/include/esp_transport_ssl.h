@@ -231,6 +231,37 @@ typedef enum {
  * @note This operation is only available if CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS=y
  */
 esp_err_t esp_transport_ssl_session_ticket_operation(esp_transport_handle_t t, esp_transport_session_ticket_operation_t operation);
+
+/**
+ * @brief      Get a copy of the TLS client session of a connected transport
+ *
+ * Unlike esp_transport_ssl_session_ticket_operation(), which keeps the saved
+ * session inside the transport, the returned session is owned by the caller
+ * and can be handed to a different transport via
+ * esp_transport_ssl_set_client_session(). Free it with
+ * esp_tls_free_client_session() when no longer needed.
+ *
+ * @param[in]  t    The transport handle
+ *
+ * @return Newly allocated client session, or NULL if the transport is not connected
+ *
+ * @note This operation is only available if CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS=y
+ */
+esp_tls_client_session_t *esp_transport_ssl_get_client_session(esp_transport_handle_t t);
+
+/**
+ * @brief      Set the TLS client session to resume on the next connect
+ *
+ * The session is borrowed, not copied: the caller keeps ownership and must
+ * keep it valid until the connect attempt completes. Pass NULL to clear a
+ * previously set session.
+ *
+ * @param[in]  t        The transport handle
+ * @param[in]  session  Client session obtained from esp_transport_ssl_get_client_session()
+ *
+ * @note This operation is only available if CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS=y
+ */
+void esp_transport_ssl_set_client_session(esp_transport_handle_t t, esp_tls_client_session_t *session);
 #endif // CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
 
 #ifdef __cplusplus
@@ -45,6 +45,7 @@ struct esp_transport_item_t {
     connect_func    _connect;       /*!< Connect function of this transport */
     io_read_func    _read;          /*!< Read */
     io_func         _write;         /*!< Write */
+    io_writev_func  _writev;        /*!< Scatter-gather write (optional) */
     trans_func      _close;         /*!< Close */
     poll_func       _poll_read;     /*!< Poll and read */
     poll_func       _poll_write;    /*!< Poll and write */
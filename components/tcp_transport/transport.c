@@ -150,6 +150,58 @@ int esp_transport_write(esp_transport_handle_t t, const char *buffer, int len, i
     return -1;
 }
 
+int esp_transport_writev(esp_transport_handle_t t, const esp_transport_iovec_t *iov, int iovcnt, int timeout_ms)
+{
+    if (t == NULL || iov == NULL || iovcnt < 0) {
+        return -1;
+    }
+    if (t->_writev) {
+        return t->_writev(t, iov, iovcnt, timeout_ms);
+    }
+    if (t->_write == NULL) {
+        return -1;
+    }
+    /* Fallback: write the buffers sequentially through the plain write function */
+    int total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        int ret = t->_write(t, (const char *)iov[i].iov_base, iov[i].iov_len, timeout_ms);
+        if (ret < 0) {
+            return total > 0 ? total : ret;
+        }
+        total += ret;
+        if (ret < (int)iov[i].iov_len) {
+            break;
+        }
+    }
+    return total;
+}
+
+int esp_transport_readv(esp_transport_handle_t t, const esp_transport_iovec_t *iov, int iovcnt, int timeout_ms)
+{
+    if (t == NULL || iov == NULL || iovcnt < 0 || t->_read == NULL) {
+        return -1;
+    }
+    int total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        /* Only the first buffer waits for data; the rest take what is already available */
+        int ret = t->_read(t, (char *)iov[i].iov_base, iov[i].iov_len, total == 0 ? timeout_ms : 0);
+        if (ret <= 0) {
+            return total > 0 ? total : ret;
+        }
+        total += ret;
+        if (ret < (int)iov[i].iov_len) {
+            break;
+        }
+    }
+    return total;
+}
+
 int esp_transport_poll_read(esp_transport_handle_t t, int timeout_ms)
 {
     if (t && t->_poll_read) {
@@ -206,6 +258,7 @@ esp_err_t esp_transport_set_func(esp_transport_handle_t t,
     t->_connect = _connect;
     t->_read = _read;
     t->_write = _write;
+    t->_writev = NULL;
     t->_close = _close;
     t->_poll_read = _poll_read;
     t->_poll_write = _poll_write;
@@ -241,6 +294,15 @@ esp_err_t esp_transport_set_async_connect_func(esp_transport_handle_t t, connect
     return ESP_OK;
 }
 
+esp_err_t esp_transport_set_writev_func(esp_transport_handle_t t, io_writev_func _writev)
+{
+    if (t == NULL) {
+        return ESP_FAIL;
+    }
+    t->_writev = _writev;
+    return ESP_OK;
+}
+
 esp_err_t esp_transport_set_parent_transport_func(esp_transport_handle_t t, payload_transfer_func _parent_transport)
 {
     if (t == NULL) {
@@ -254,6 +254,60 @@ static int tcp_write(esp_transport_handle_t t, const char *buffer, int len, int
     return ret;
 }
 
+static int ssl_writev(esp_transport_handle_t t, const esp_transport_iovec_t *iov, int iovcnt, int timeout_ms)
+{
+    int poll;
+    transport_esp_tls_t *ssl = ssl_get_context_data(t);
+    ESP_STATIC_ANALYZER_CHECK(ssl == NULL, -1);
+
+    if ((poll = esp_transport_poll_write(t, timeout_ms)) <= 0) {
+        ESP_LOGW(TAG, "Poll timeout or error, errno=%s, fd=%d, timeout_ms=%d", strerror(errno), ssl->sockfd, timeout_ms);
+        return poll;
+    }
+    /* esp-tls has no gather interface, so each buffer becomes (at least) one TLS
+     * record; the underlying TCP segments are still coalesced by the socket layer */
+    int total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len == 0) {
+            continue;
+        }
+        int ret = esp_tls_conn_write(ssl->tls, iov[i].iov_base, iov[i].iov_len);
+        if (ret < 0) {
+            ESP_LOGE(TAG, "esp_tls_conn_write error, errno=%s", strerror(errno));
+            esp_tls_error_handle_t esp_tls_error_handle;
+            if (esp_tls_get_error_handle(ssl->tls, &esp_tls_error_handle) == ESP_OK) {
+                esp_transport_set_errors(t, esp_tls_error_handle);
+            } else {
+                ESP_LOGE(TAG, "Error in obtaining the error handle");
+            }
+            return total > 0 ? total : ret;
+        }
+        total += ret;
+        if (ret < (int)iov[i].iov_len) {
+            break;
+        }
+    }
+    return total;
+}
+
+static int tcp_writev(esp_transport_handle_t t, const esp_transport_iovec_t *iov, int iovcnt, int timeout_ms)
+{
+    int poll;
+    transport_esp_tls_t *ssl = ssl_get_context_data(t);
+    ESP_STATIC_ANALYZER_CHECK(ssl == NULL, -1);
+
+    if ((poll = esp_transport_poll_write(t, timeout_ms)) <= 0) {
+        ESP_LOGW(TAG, "Poll timeout or error, errno=%s, fd=%d, timeout_ms=%d", strerror(errno), ssl->sockfd, timeout_ms);
+        return poll;
+    }
+    int ret = writev(ssl->sockfd, iov, iovcnt);
+    if (ret < 0) {
+        ESP_LOGE(TAG, "tcp_writev error, errno=%s", strerror(errno));
+        esp_transport_capture_errno(t, errno);
+    }
+    return ret;
+}
+
 static int ssl_read(esp_transport_handle_t t, char *buffer, int len, int timeout_ms)
 {
     transport_esp_tls_t *ssl = ssl_get_context_data(t);
@@ -534,6 +588,7 @@ esp_transport_handle_t esp_transport_ssl_init(void)
     ((transport_esp_tls_t *)ssl_transport->data)->cfg.is_plain_tcp = false;
     esp_transport_set_func(ssl_transport, ssl_connect, ssl_read, ssl_write, base_close, base_poll_read, base_poll_write, base_destroy);
     esp_transport_set_async_connect_func(ssl_transport, ssl_connect_async);
+    esp_transport_set_writev_func(ssl_transport, ssl_writev);
     ssl_transport->_get_socket = base_get_socket;
     return ssl_transport;
 }
@@ -556,6 +611,7 @@ esp_transport_handle_t esp_transport_tcp_init(void)
     ((transport_esp_tls_t *)tcp_transport->data)->cfg.is_plain_tcp = true;
     esp_transport_set_func(tcp_transport, tcp_connect, tcp_read, tcp_write, base_close, base_poll_read, base_poll_write, base_destroy);
     esp_transport_set_async_connect_func(tcp_transport, tcp_connect_async);
+    esp_transport_set_writev_func(tcp_transport, tcp_writev);
     tcp_transport->_get_socket = base_get_socket;
     return tcp_transport;
 }
@@ -597,4 +653,22 @@ esp_err_t esp_transport_ssl_session_ticket_operation(esp_transport_handle_t t, e
     }
     return ESP_OK;
 }
+
+esp_tls_client_session_t *esp_transport_ssl_get_client_session(esp_transport_handle_t t)
+{
+    transport_esp_tls_t *ssl = ssl_get_context_data(t);
+    if (!ssl || !ssl->tls) {
+        return NULL;
+    }
+    return esp_tls_get_client_session(ssl->tls);
+}
+
+void esp_transport_ssl_set_client_session(esp_transport_handle_t t, esp_tls_client_session_t *session)
+{
+    transport_esp_tls_t *ssl = ssl_get_context_data(t);
+    if (!ssl) {
+        return;
+    }
+    ssl->cfg.client_session = session;
+}
 #endif // CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
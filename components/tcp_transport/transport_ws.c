@@ -39,6 +39,7 @@ static const char *TAG = "transport_ws";
 #define MAX_WEBSOCKET_HEADER_SIZE   16
 #define WS_RESPONSE_OK              101
 #define WS_TRANSPORT_MAX_CONTROL_FRAME_BUFFER_LEN 125
+#define WS_TRANSPORT_MAX_IOVCNT     8
 
 
 typedef struct {
@@ -438,6 +439,89 @@ static int ws_write(esp_transport_handle_t t, const char *b, int len, int timeou
     return _ws_write(t, WS_OPCODE_BINARY | WS_FIN, WS_MASK, b, len, timeout_ms);
 }
 
+static int ws_writev(esp_transport_handle_t t, const esp_transport_iovec_t *iov, int iovcnt, int timeout_ms)
+{
+    transport_ws_t *ws = esp_transport_get_context_data(t);
+    char ws_header[MAX_WEBSOCKET_HEADER_SIZE];
+    esp_transport_iovec_t frame_iov[WS_TRANSPORT_MAX_IOVCNT + 1];
+    char *mask;
+    int header_len = 0, i;
+
+    if (iovcnt > WS_TRANSPORT_MAX_IOVCNT) {
+        ESP_LOGE(TAG, "Too many iovec entries (%d, maximum %d)", iovcnt, WS_TRANSPORT_MAX_IOVCNT);
+        return -1;
+    }
+    int len = 0;
+    for (i = 0; i < iovcnt; i++) {
+        len += iov[i].iov_len;
+    }
+    if (len == 0) {
+        return 0;
+    }
+
+    int poll_write;
+    if ((poll_write = esp_transport_poll_write(ws->parent, timeout_ms)) <= 0) {
+        ESP_LOGE(TAG, "Error transport_poll_write");
+        return poll_write;
+    }
+    ws_header[header_len++] = WS_OPCODE_BINARY | WS_FIN;
+
+    if (len <= 125) {
+        ws_header[header_len++] = (uint8_t)(len | WS_MASK);
+    } else if (len < 65536) {
+        ws_header[header_len++] = WS_SIZE16 | WS_MASK;
+        ws_header[header_len++] = (uint8_t)(len >> 8);
+        ws_header[header_len++] = (uint8_t)(len & 0xFF);
+    } else {
+        ws_header[header_len++] = WS_SIZE64 | WS_MASK;
+        /* Support maximum 4 bytes length */
+        ws_header[header_len++] = 0;
+        ws_header[header_len++] = 0;
+        ws_header[header_len++] = 0;
+        ws_header[header_len++] = 0;
+        ws_header[header_len++] = (uint8_t)((len >> 24) & 0xFF);
+        ws_header[header_len++] = (uint8_t)((len >> 16) & 0xFF);
+        ws_header[header_len++] = (uint8_t)((len >> 8) & 0xFF);
+        ws_header[header_len++] = (uint8_t)((len >> 0) & 0xFF);
+    }
+
+    mask = &ws_header[header_len];
+    ssize_t rc;
+    if ((rc = getrandom(ws_header + header_len, 4, 0)) < 0) {
+        ESP_LOGD(TAG, "getrandom() returned %zd", rc);
+        return -1;
+    }
+    header_len += 4;
+
+    // All buffers form a single frame, so the mask index continues across buffers
+    int offset = 0;
+    for (i = 0; i < iovcnt; i++) {
+        char *buffer = (char *)iov[i].iov_base;
+        for (size_t j = 0; j < iov[i].iov_len; ++j, ++offset) {
+            buffer[j] = (buffer[j] ^ mask[offset % 4]);
+        }
+    }
+
+    frame_iov[0].iov_base = ws_header;
+    frame_iov[0].iov_len = header_len;
+    memcpy(&frame_iov[1], iov, iovcnt * sizeof(esp_transport_iovec_t));
+
+    int ret = esp_transport_writev(ws->parent, frame_iov, iovcnt + 1, timeout_ms);
+    // in case of masked transport we have to revert back to the original data, as ws layer
+    // does not create its own copy of data to be sent
+    offset = 0;
+    for (i = 0; i < iovcnt; i++) {
+        char *buffer = (char *)iov[i].iov_base;
+        for (size_t j = 0; j < iov[i].iov_len; ++j, ++offset) {
+            buffer[j] = (buffer[j] ^ mask[offset % 4]);
+        }
+    }
+    if (ret < header_len) {
+        ESP_LOGE(TAG, "Error write header");
+        return ret < 0 ? ret : -1;
+    }
+    return ret - header_len;
+}
 
 static int ws_read_payload(esp_transport_handle_t t, char *buffer, int len, int timeout_ms)
 {
@@ -732,6 +816,7 @@ esp_transport_handle_t esp_transport_ws_init(esp_transport_handle_t parent_handl
     });
 
     esp_transport_set_func(t, ws_connect, ws_read, ws_write, ws_close, ws_poll_read, ws_poll_write, ws_destroy);
+    esp_transport_set_writev_func(t, ws_writev);
     // websocket underlying transfer is the payload transfer handle
     esp_transport_set_parent_transport_func(t, ws_get_payload_transport_handle);
 
@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "ulp_lp_core_sample_batch_shared.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initialize a sample ring before the LP core program starts
+ *
+ * `ring` must point to at least ULP_LP_CORE_SAMPLE_RING_SIZE(capacity) bytes
+ * of RTC slow memory (e.g. an RTC_SLOW_ATTR array shared with the LP program).
+ *
+ * @param[in] ring Ring memory to initialize
+ * @param[in] capacity Number of sample slots
+ * @return
+ *      - ESP_OK: Ring initialized successfully
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ */
+esp_err_t lp_core_sample_batch_init(ulp_lp_core_sample_ring_t *ring, uint16_t capacity);
+
+/**
+ * @brief Number of samples accumulated and not yet read
+ *
+ * @param[in] ring Sample ring
+ * @return Number of pending samples, 0 when `ring` is not an initialized ring
+ */
+uint32_t lp_core_sample_batch_pending(const ulp_lp_core_sample_ring_t *ring);
+
+/**
+ * @brief Drain the batch the LP core accumulated while the main CPU slept
+ *
+ * Copies up to `max_samples` pending samples in sequence order and advances
+ * the consumer position. Samples the LP core had to drop because the ring was
+ * full are reported through `out_dropped` (cumulative since init); gaps also
+ * show up as missing sequence numbers.
+ *
+ * @param[in] ring Sample ring
+ * @param[out] out_samples Destination array for the drained samples
+ * @param[in] max_samples Capacity of `out_samples`
+ * @param[out] out_num_samples Number of samples copied
+ * @param[out] out_dropped Cumulative dropped-sample count, may be NULL
+ * @return
+ *      - ESP_OK: Batch drained successfully (0 samples is a successful empty read)
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - ESP_ERR_INVALID_STATE: `ring` is not an initialized sample ring
+ */
+esp_err_t lp_core_sample_batch_read(ulp_lp_core_sample_ring_t *ring,
+                                    ulp_lp_core_sample_t *out_samples, uint32_t max_samples,
+                                    uint32_t *out_num_samples, uint32_t *out_dropped);
+
+#ifdef __cplusplus
+}
+#endif
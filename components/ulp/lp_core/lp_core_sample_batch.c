@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+#include "lp_core_sample_batch.h"
+#include "esp_check.h"
+
+static const char *TAG = "lp_core_sample_batch";
+
+esp_err_t lp_core_sample_batch_init(ulp_lp_core_sample_ring_t *ring, uint16_t capacity)
+{
+    ESP_RETURN_ON_FALSE(ring && capacity > 0, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    memset(ring, 0, ULP_LP_CORE_SAMPLE_RING_SIZE(capacity));
+    ring->capacity = capacity;
+    ring->magic = ULP_LP_CORE_SAMPLE_BATCH_MAGIC;
+    return ESP_OK;
+}
+
+uint32_t lp_core_sample_batch_pending(const ulp_lp_core_sample_ring_t *ring)
+{
+    if (!ring || ring->magic != ULP_LP_CORE_SAMPLE_BATCH_MAGIC) {
+        return 0;
+    }
+    return ring->head - ring->tail;
+}
+
+esp_err_t lp_core_sample_batch_read(ulp_lp_core_sample_ring_t *ring,
+                                    ulp_lp_core_sample_t *out_samples, uint32_t max_samples,
+                                    uint32_t *out_num_samples, uint32_t *out_dropped)
+{
+    ESP_RETURN_ON_FALSE(ring && out_samples && out_num_samples, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(ring->magic == ULP_LP_CORE_SAMPLE_BATCH_MAGIC, ESP_ERR_INVALID_STATE, TAG,
+                        "ring not initialized");
+
+    // snapshot the producer position once; samples recorded while we drain
+    // stay for the next read
+    uint32_t head = ring->head;
+    uint32_t tail = ring->tail;
+    uint32_t num = head - tail;
+    if (num > max_samples) {
+        num = max_samples;
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        out_samples[i] = ring->samples[(tail + i) % ring->capacity];
+    }
+    // release the consumed slots only after the copy is done
+    __asm__ volatile ("" ::: "memory");
+    ring->tail = tail + num;
+    *out_num_samples = num;
+    if (out_dropped) {
+        *out_dropped = ring->dropped;
+    }
+    return ESP_OK;
+}
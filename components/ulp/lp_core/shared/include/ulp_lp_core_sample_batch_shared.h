@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * Sleep-and-batch sampling framework shared between the LP core and the main CPU.
+ *
+ * The application places a sample ring and a channel table in RTC slow memory.
+ * On every wakeup the LP core calls ulp_lp_core_sample_batch_run(), which
+ * samples the channels that are due, tags each sample with a sequence number,
+ * pushes it into the ring and reports whether a threshold crossing asks for a
+ * main CPU wakeup. The main CPU drains the accumulated batch with the
+ * lp_core_sample_batch API after it wakes. The ring is single producer
+ * (LP core) / single consumer (main CPU) and needs no locking.
+ */
+
+/** @brief Magic value identifying an initialized sample ring ("ULSB") */
+#define ULP_LP_CORE_SAMPLE_BATCH_MAGIC  0x42534C55
+
+/**
+ * @brief Kind of source a sampling channel reads
+ */
+typedef enum {
+    ULP_LP_CORE_SAMPLE_CH_TYPE_ADC = 0, /*!< LP ADC channel, `source` is the ADC channel number on unit 1 */
+    ULP_LP_CORE_SAMPLE_CH_TYPE_GPIO,    /*!< LP GPIO level, `source` is the LP IO number (LP core only) */
+    ULP_LP_CORE_SAMPLE_CH_TYPE_CUSTOM,  /*!< Read through the user callback (e.g. temperature, I2C sensors) */
+} ulp_lp_core_sample_channel_type_t;
+
+/** @brief Channel flag: a threshold crossing on this channel requests a main CPU wakeup */
+#define ULP_LP_CORE_SAMPLE_CH_FLAG_WAKE_ON_THRESHOLD  (1 << 0)
+
+/** @brief Sample flag: value is at or below the channel's low threshold */
+#define ULP_LP_CORE_SAMPLE_FLAG_LOW_THRESHOLD   (1 << 0)
+/** @brief Sample flag: value is at or above the channel's high threshold */
+#define ULP_LP_CORE_SAMPLE_FLAG_HIGH_THRESHOLD  (1 << 1)
+
+/**
+ * @brief One entry of the declarative channel table
+ *
+ * The table lives in RTC slow memory and is filled by the main CPU before the
+ * LP core program starts. `countdown` is framework state, initialize it to 0.
+ */
+typedef struct {
+    uint8_t type;           /*!< Channel type, one of ulp_lp_core_sample_channel_type_t */
+    uint8_t source;         /*!< ADC channel / LP IO number / user id for custom channels */
+    uint16_t interval;      /*!< Sample every `interval` framework runs, 0 and 1 both mean every run */
+    int32_t low_threshold;  /*!< Sample flagged when value <= low_threshold, INT32_MIN to disable */
+    int32_t high_threshold; /*!< Sample flagged when value >= high_threshold, INT32_MAX to disable */
+    uint16_t flags;         /*!< ULP_LP_CORE_SAMPLE_CH_FLAG_* */
+    uint16_t countdown;     /*!< Internal: runs left until this channel is due */
+} ulp_lp_core_sample_channel_t;
+
+/**
+ * @brief One recorded sample
+ */
+typedef struct {
+    uint32_t seq;       /*!< Sequence number, increments by one per recorded sample */
+    int32_t value;      /*!< Sampled value (raw ADC count, GPIO level, or custom) */
+    uint8_t channel;    /*!< Index of the producing channel in the channel table */
+    uint8_t flags;      /*!< ULP_LP_CORE_SAMPLE_FLAG_* */
+    uint16_t reserved;  /*!< Zero */
+} ulp_lp_core_sample_t;
+
+/**
+ * @brief Sample ring header, followed by `capacity` sample slots
+ *
+ * Place the whole ring (see ULP_LP_CORE_SAMPLE_RING_SIZE) in RTC slow memory
+ * so it survives while the main CPU sleeps. `head` and `tail` are monotonic;
+ * `head - tail` is the number of pending samples.
+ */
+typedef struct {
+    uint32_t magic;             /*!< ULP_LP_CORE_SAMPLE_BATCH_MAGIC once initialized */
+    uint16_t capacity;          /*!< Number of sample slots */
+    uint16_t reserved;          /*!< Zero */
+    volatile uint32_t head;     /*!< Monotonic producer position, written by the LP core only */
+    volatile uint32_t tail;     /*!< Monotonic consumer position, written by the main CPU only */
+    volatile uint32_t dropped;  /*!< Samples discarded because the ring was full */
+    ulp_lp_core_sample_t samples[]; /*!< Sample slots */
+} ulp_lp_core_sample_ring_t;
+
+/** @brief Bytes of RTC slow memory needed for a ring with `capacity` sample slots */
+#define ULP_LP_CORE_SAMPLE_RING_SIZE(capacity) \
+    (sizeof(ulp_lp_core_sample_ring_t) + (capacity) * sizeof(ulp_lp_core_sample_t))
+
+/**
+ * @brief Reader for ULP_LP_CORE_SAMPLE_CH_TYPE_CUSTOM channels
+ *
+ * @param[in] channel Channel table entry being sampled
+ * @param[in] arg User argument passed to ulp_lp_core_sample_batch_run()
+ * @return Sampled value
+ */
+typedef int32_t (*ulp_lp_core_sample_read_fn_t)(const ulp_lp_core_sample_channel_t *channel, void *arg);
+
+/**
+ * @brief Record one sample into the ring
+ *
+ * Producer side, call from the LP core only. The newest sample is dropped
+ * (and counted in `dropped`) when the ring is full, so an unserviced ring
+ * keeps its oldest samples.
+ *
+ * @param[in] ring Sample ring
+ * @param[in] channel Index of the producing channel
+ * @param[in] value Sampled value
+ * @param[in] flags ULP_LP_CORE_SAMPLE_FLAG_* describing the sample
+ * @return true when the sample was recorded, false when the ring was full
+ */
+bool ulp_lp_core_sample_batch_push(ulp_lp_core_sample_ring_t *ring, uint8_t channel, int32_t value, uint8_t flags);
+
+/**
+ * @brief Sample every channel that is due and record the results
+ *
+ * Call once per LP core wakeup. ADC channels are read with
+ * lp_core_lp_adc_read_channel_raw() (the application initializes the LP ADC
+ * beforehand), GPIO channels read the LP IO level, custom channels go through
+ * `read_fn`. Threshold comparisons set the per-sample flags; a crossing on a
+ * channel with ULP_LP_CORE_SAMPLE_CH_FLAG_WAKE_ON_THRESHOLD makes this
+ * function return true so the caller can wake the main CPU.
+ *
+ * @param[in] channels Channel table
+ * @param[in] num_channels Number of entries in `channels`
+ * @param[in] ring Sample ring
+ * @param[in] read_fn Reader for custom channels, may be NULL when the table has none
+ * @param[in] arg User argument passed to `read_fn`
+ * @return true when a wake-flagged channel crossed one of its thresholds
+ */
+bool ulp_lp_core_sample_batch_run(ulp_lp_core_sample_channel_t *channels, uint16_t num_channels,
+                                  ulp_lp_core_sample_ring_t *ring,
+                                  ulp_lp_core_sample_read_fn_t read_fn, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdint.h>
+#include "ulp_lp_core_sample_batch_shared.h"
+#include "soc/soc_caps.h"
+
+#if SOC_LP_ADC_SUPPORTED
+#include "ulp_lp_core_lp_adc_shared.h"
+#endif
+
+#ifdef IS_ULP_COCPU
+#include "ulp_lp_core_gpio.h"
+#endif
+
+bool ulp_lp_core_sample_batch_push(ulp_lp_core_sample_ring_t *ring, uint8_t channel, int32_t value, uint8_t flags)
+{
+    if (ring->head - ring->tail >= ring->capacity) {
+        ring->dropped = ring->dropped + 1;
+        return false;
+    }
+    uint32_t seq = ring->head;
+    ulp_lp_core_sample_t *slot = &ring->samples[seq % ring->capacity];
+    slot->seq = seq;
+    slot->value = value;
+    slot->channel = channel;
+    slot->flags = flags;
+    slot->reserved = 0;
+    // make sure the slot contents are committed before the consumer can see them
+    __asm__ volatile ("" ::: "memory");
+    ring->head = seq + 1;
+    return true;
+}
+
+static int32_t sample_channel(const ulp_lp_core_sample_channel_t *channel,
+                              ulp_lp_core_sample_read_fn_t read_fn, void *arg)
+{
+    switch (channel->type) {
+#if SOC_LP_ADC_SUPPORTED
+    case ULP_LP_CORE_SAMPLE_CH_TYPE_ADC: {
+        int raw = 0;
+        lp_core_lp_adc_read_channel_raw(ADC_UNIT_1, channel->source, &raw);
+        return raw;
+    }
+#endif
+#ifdef IS_ULP_COCPU
+    case ULP_LP_CORE_SAMPLE_CH_TYPE_GPIO:
+        return (int32_t)ulp_lp_core_gpio_get_level(channel->source);
+#endif
+    case ULP_LP_CORE_SAMPLE_CH_TYPE_CUSTOM:
+    default:
+        return read_fn ? read_fn(channel, arg) : 0;
+    }
+}
+
+bool ulp_lp_core_sample_batch_run(ulp_lp_core_sample_channel_t *channels, uint16_t num_channels,
+                                  ulp_lp_core_sample_ring_t *ring,
+                                  ulp_lp_core_sample_read_fn_t read_fn, void *arg)
+{
+    bool wakeup = false;
+    for (uint16_t i = 0; i < num_channels; i++) {
+        ulp_lp_core_sample_channel_t *channel = &channels[i];
+        if (channel->countdown > 1) {
+            channel->countdown--;
+            continue;
+        }
+        channel->countdown = channel->interval;
+
+        int32_t value = sample_channel(channel, read_fn, arg);
+        uint8_t flags = 0;
+        if (value <= channel->low_threshold) {
+            flags |= ULP_LP_CORE_SAMPLE_FLAG_LOW_THRESHOLD;
+        }
+        if (value >= channel->high_threshold) {
+            flags |= ULP_LP_CORE_SAMPLE_FLAG_HIGH_THRESHOLD;
+        }
+        ulp_lp_core_sample_batch_push(ring, i, value, flags);
+        if (flags != 0 && (channel->flags & ULP_LP_CORE_SAMPLE_CH_FLAG_WAKE_ON_THRESHOLD)) {
+            wakeup = true;
+        }
+    }
+    return wakeup;
+}
@@ -46,7 +46,16 @@
 // ----------------------- Configs -------------------------
 
 #define FRAME_LIST_LEN                          USB_HAL_FRAME_LIST_LEN_32
+#if CONFIG_USB_HOST_PIPE_NUM_URB_BUFFERS_8
+#define NUM_BUFFERS                             8
+#define BUFFER_IDX_BITS                         3   // log2(NUM_BUFFERS). Index bit-fields of this width wrap automatically
+#elif CONFIG_USB_HOST_PIPE_NUM_URB_BUFFERS_4
+#define NUM_BUFFERS                             4
+#define BUFFER_IDX_BITS                         2   // log2(NUM_BUFFERS). Index bit-fields of this width wrap automatically
+#else
 #define NUM_BUFFERS                             2
+#define BUFFER_IDX_BITS                         1   // log2(NUM_BUFFERS). Index bit-fields of this width wrap automatically
+#endif
 
 #define XFER_LIST_LEN_CTRL                      3   // One descriptor for each stage
 #define XFER_LIST_LEN_BULK                      2   // One descriptor for transfer, one to support an extra zero length packet
@@ -173,18 +182,17 @@ struct pipe_obj {
     int num_urb_pending;
     int num_urb_done;
     // Multi-buffer control
-    dma_buffer_block_t *buffers[NUM_BUFFERS];  // Double buffering scheme
+    dma_buffer_block_t *buffers[NUM_BUFFERS];  // Multi-buffering scheme. Depth set by CONFIG_USB_HOST_PIPE_NUM_URB_BUFFERS
     union {
         struct {
-            uint32_t buffer_num_to_fill: 2; // Number of buffers that can be filled
-            uint32_t buffer_num_to_exec: 2; // Number of buffers that are filled and need to be executed
-            uint32_t buffer_num_to_parse: 2;// Number of buffers completed execution and waiting to be parsed
-            uint32_t reserved2: 2;
-            uint32_t wr_idx: 1;             // Index of the next buffer to fill. Bit width must allow NUM_BUFFERS to wrap automatically
-            uint32_t rd_idx: 1;             // Index of the current buffer in-flight. Bit width must allow NUM_BUFFERS to wrap automatically
-            uint32_t fr_idx: 1;             // Index of the next buffer to parse. Bit width must allow NUM_BUFFERS to wrap automatically
-            uint32_t buffer_is_executing: 1;// One of the buffers is in flight
-            uint32_t reserved20: 20;
+            uint32_t buffer_num_to_fill: BUFFER_IDX_BITS + 1;   // Number of buffers that can be filled
+            uint32_t buffer_num_to_exec: BUFFER_IDX_BITS + 1;   // Number of buffers that are filled and need to be executed
+            uint32_t buffer_num_to_parse: BUFFER_IDX_BITS + 1;  // Number of buffers completed execution and waiting to be parsed
+            uint32_t wr_idx: BUFFER_IDX_BITS;   // Index of the next buffer to fill. Bit width must allow NUM_BUFFERS to wrap automatically
+            uint32_t rd_idx: BUFFER_IDX_BITS;   // Index of the current buffer in-flight. Bit width must allow NUM_BUFFERS to wrap automatically
+            uint32_t fr_idx: BUFFER_IDX_BITS;   // Index of the next buffer to parse. Bit width must allow NUM_BUFFERS to wrap automatically
+            uint32_t buffer_is_executing: 1;    // One of the buffers is in flight
+            uint32_t reserved: 31 - (6 * BUFFER_IDX_BITS + 3);
         };
         uint32_t val;
     } multi_buffer_control;
@@ -503,6 +503,41 @@ void esp_vfs_dump_fds(FILE *fp);
  */
 void esp_vfs_dump_registered_paths(FILE *fp);
 
+#if CONFIG_VFS_SUPPORT_STATS
+
+/**
+ * @brief Start collecting per-mount I/O statistics
+ *
+ * Collection is off after boot; until this function is called, the only
+ * overhead of the statistics shim is one branch per operation.
+ */
+void esp_vfs_stats_enable(void);
+
+/**
+ * @brief Stop collecting per-mount I/O statistics
+ */
+void esp_vfs_stats_disable(void);
+
+/**
+ * @brief Clear the collected per-mount I/O statistics
+ */
+void esp_vfs_stats_reset(void);
+
+/**
+ * @brief Dump the collected per-mount I/O statistics to the provided FILE*
+ *
+ * For every registered filesystem with at least one recorded operation,
+ * prints the per-operation call counts (with byte totals for read and
+ * write) and a logarithmic latency histogram covering all operations.
+ * Only operations performed while collection was enabled with
+ * esp_vfs_stats_enable() are counted.
+ *
+ * @param fp File descriptor where data will be dumped
+ */
+void esp_vfs_dump_stats(FILE *fp);
+
+#endif // CONFIG_VFS_SUPPORT_STATS
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
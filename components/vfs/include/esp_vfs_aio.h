@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Operation type of an asynchronous I/O request
+ */
+typedef enum {
+    ESP_VFS_AIO_OP_READ,    /*!< Scatter read from the file descriptor */
+    ESP_VFS_AIO_OP_WRITE,   /*!< Gather write to the file descriptor */
+    ESP_VFS_AIO_OP_FSYNC,   /*!< Flush the file descriptor to the storage */
+} esp_vfs_aio_op_t;
+
+/**
+ * @brief Handle of an asynchronous I/O completion queue
+ */
+typedef struct esp_vfs_aio_queue *esp_vfs_aio_queue_handle_t;
+
+/**
+ * @brief Asynchronous I/O request
+ *
+ * @note The iovec array and the buffers it points to must stay valid until the
+ *       completion of the request is collected with `esp_vfs_aio_wait`.
+ */
+typedef struct {
+    esp_vfs_aio_op_t op;        /*!< Operation to perform */
+    int fd;                     /*!< File descriptor the operation targets */
+    const struct iovec *iov;    /*!< Scatter/gather list, ignored for `ESP_VFS_AIO_OP_FSYNC` */
+    int iovcnt;                 /*!< Number of iovec entries, ignored for `ESP_VFS_AIO_OP_FSYNC` */
+    off_t offset;               /*!< File offset of the transfer, or a negative value to use
+                                     (and advance) the current file position */
+    void *user_data;            /*!< Opaque pointer returned in the completion entry */
+} esp_vfs_aio_req_t;
+
+/**
+ * @brief Completion entry of an asynchronous I/O request
+ */
+typedef struct {
+    esp_vfs_aio_op_t op;        /*!< Operation that completed */
+    int fd;                     /*!< File descriptor the operation targeted */
+    ssize_t result;             /*!< Number of bytes transferred (0 for fsync), or -1 on error */
+    int error;                  /*!< `errno` value of the failed operation when `result` is -1, 0 otherwise */
+    void *user_data;            /*!< `user_data` of the corresponding request */
+} esp_vfs_aio_cqe_t;
+
+/**
+ * @brief Configuration of an asynchronous I/O completion queue
+ */
+typedef struct {
+    size_t depth;               /*!< Maximum number of requests in flight on this queue */
+} esp_vfs_aio_queue_config_t;
+
+/**
+ * @brief Create an asynchronous I/O completion queue
+ *
+ * Requests submitted against the queue are executed in order by a worker task
+ * dedicated to the filesystem the target file descriptor belongs to, so
+ * operations on different filesystems proceed in parallel while operations on
+ * one filesystem never interleave.
+ *
+ * @param config     Queue configuration
+ * @param out_queue  Returned queue handle
+ * @return
+ *      - ESP_OK                on success
+ *      - ESP_ERR_INVALID_ARG   if config, out_queue or the configured depth is invalid
+ *      - ESP_ERR_NO_MEM        if there is no memory for the queue
+ */
+esp_err_t esp_vfs_aio_queue_create(const esp_vfs_aio_queue_config_t *config, esp_vfs_aio_queue_handle_t *out_queue);
+
+/**
+ * @brief Delete an asynchronous I/O completion queue
+ *
+ * All submitted requests have to be collected with `esp_vfs_aio_wait` before
+ * the queue can be deleted.
+ *
+ * @param queue  Queue handle
+ * @return
+ *      - ESP_OK                  on success
+ *      - ESP_ERR_INVALID_ARG     if queue is NULL
+ *      - ESP_ERR_INVALID_STATE   if requests are still in flight on the queue
+ */
+esp_err_t esp_vfs_aio_queue_delete(esp_vfs_aio_queue_handle_t queue);
+
+/**
+ * @brief Submit an asynchronous I/O request
+ *
+ * The call never blocks on the actual I/O: it hands the request to the worker
+ * task of the filesystem that owns `req->fd` and returns. The completion is
+ * reported through the queue and has to be collected with `esp_vfs_aio_wait`.
+ *
+ * @param queue  Queue the completion will be posted to
+ * @param req    Request to perform, copied by the call (the iovec array is not)
+ * @return
+ *      - ESP_OK                  on success
+ *      - ESP_ERR_INVALID_ARG     if queue or the request is invalid
+ *      - ESP_ERR_NOT_FOUND       if `req->fd` does not belong to a registered filesystem
+ *      - ESP_ERR_INVALID_STATE   if the queue already has `depth` requests in flight
+ *      - ESP_ERR_NO_MEM          if the worker task for the filesystem cannot be created
+ */
+esp_err_t esp_vfs_aio_submit(esp_vfs_aio_queue_handle_t queue, const esp_vfs_aio_req_t *req);
+
+/**
+ * @brief Collect one completed asynchronous I/O request
+ *
+ * @param queue    Queue to collect the completion from
+ * @param out_cqe  Returned completion entry
+ * @param timeout  Maximum number of ticks to wait, 0 to poll
+ * @return
+ *      - ESP_OK                on success
+ *      - ESP_ERR_INVALID_ARG   if queue or out_cqe is NULL
+ *      - ESP_ERR_TIMEOUT       if no request completed within the timeout
+ */
+esp_err_t esp_vfs_aio_wait(esp_vfs_aio_queue_handle_t queue, esp_vfs_aio_cqe_t *out_cqe, TickType_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
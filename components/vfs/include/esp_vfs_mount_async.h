@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Handle of an asynchronous mount operation, returned by esp_vfs_mount_async()
+ */
+typedef struct esp_vfs_mount_async_t* esp_vfs_mount_async_handle_t;
+
+/**
+ * @brief Mount function executed asynchronously
+ *
+ * Typically a thin wrapper which calls one of the filesystem registration
+ * functions (esp_vfs_fat_sdmmc_mount, esp_vfs_spiffs_register, ...) with
+ * the desired arguments.
+ *
+ * @param ctx  context pointer passed to esp_vfs_mount_async()
+ * @return result of the mount, reported through esp_vfs_mount_async_wait()
+ */
+typedef esp_err_t (*esp_vfs_mount_fn_t)(void* ctx);
+
+/**
+ * @brief Start a filesystem mount in the background
+ *
+ * Runs the given mount function in a temporary task, so that several
+ * independent filesystems can be initialized concurrently during boot, or
+ * so that the application can start other subsystems while a slow mount
+ * (for example SD card initialization) is in progress.
+ *
+ * Every successful call must be matched by a completed call to
+ * esp_vfs_mount_async_wait(), which releases the handle.
+ *
+ * @param fn   mount function to execute
+ * @param ctx  context pointer passed through to the mount function
+ * @param[out] out_handle  handle to pass to esp_vfs_mount_async_wait()
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if fn or out_handle is NULL
+ *      - ESP_ERR_NO_MEM if handle or task allocation fails
+ */
+esp_err_t esp_vfs_mount_async(esp_vfs_mount_fn_t fn, void* ctx,
+                              esp_vfs_mount_async_handle_t* out_handle);
+
+/**
+ * @brief Wait for an asynchronous mount to finish
+ *
+ * @param handle  handle obtained from esp_vfs_mount_async()
+ * @param ticks_to_wait  number of ticks to wait, or portMAX_DELAY
+ * @param[out] out_mount_err  result returned by the mount function; may be
+ *                            NULL if the caller does not need it
+ * @return
+ *      - ESP_OK if the mount finished; the handle is released and must not
+ *        be used again. Check out_mount_err for the result of the mount
+ *        itself.
+ *      - ESP_ERR_INVALID_ARG if handle is NULL
+ *      - ESP_ERR_TIMEOUT if the mount is still in progress; the handle stays
+ *        valid and the call can be repeated
+ */
+esp_err_t esp_vfs_mount_async_wait(esp_vfs_mount_async_handle_t handle,
+                                   TickType_t ticks_to_wait, esp_err_t* out_mount_err);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <sys/types.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Handle of a buffered stream, returned by esp_stream_open()
+ */
+typedef struct esp_stream_t* esp_stream_handle_t;
+
+/**
+ * @brief Configuration of a buffered stream
+ */
+typedef struct {
+    size_t buffer_size;     /*!< Size of each readahead/write-behind buffer, in bytes.
+                                 Two buffers per direction are allocated. Pass 0 to use
+                                 the default of 4096 bytes. For best throughput, use a
+                                 multiple of the filesystem allocation unit. */
+    bool prefer_psram;      /*!< If true, allocate the buffers from external RAM when
+                                 available, falling back to internal RAM otherwise */
+} esp_stream_config_t;
+
+/**
+ * @brief Open a file with readahead and write-behind buffering
+ *
+ * The returned stream wraps a regular VFS file descriptor. Reads are served
+ * from a readahead buffer which is refilled ahead of time by a background
+ * flusher task, and writes are accumulated in a write-behind buffer which is
+ * handed to the same task once full. Small sequential reads and writes are
+ * thereby batched into buffer-sized filesystem transfers without blocking
+ * the calling task on each one.
+ *
+ * Errors from background writes are sticky: they are reported by the next
+ * esp_stream_write(), esp_stream_fsync() or esp_stream_close() call.
+ *
+ * A stream must only be used from one task at a time.
+ *
+ * @param path      path of the file, passed to open()
+ * @param flags     flags, passed to open() (O_RDONLY, O_WRONLY, O_RDWR, ...)
+ * @param config    stream configuration, or NULL to use the defaults
+ * @param[out] out_stream  stream handle, valid if ESP_OK is returned
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if path or out_stream is NULL
+ *      - ESP_ERR_NO_MEM if buffer or task allocation fails
+ *      - ESP_FAIL if open() fails; errno is set by the filesystem driver
+ */
+esp_err_t esp_stream_open(const char* path, int flags, const esp_stream_config_t* config,
+                          esp_stream_handle_t* out_stream);
+
+/**
+ * @brief Read from a buffered stream
+ *
+ * Same semantics as read(). Data is served from the readahead buffer; a
+ * buffer-sized refill of the underlying file is started in the background
+ * whenever a buffer is drained.
+ *
+ * @param stream  stream handle obtained from esp_stream_open()
+ * @param dst     destination buffer
+ * @param size    number of bytes to read
+ * @return number of bytes read (0 at end of file), or -1 with errno set
+ */
+ssize_t esp_stream_read(esp_stream_handle_t stream, void* dst, size_t size);
+
+/**
+ * @brief Write to a buffered stream
+ *
+ * Same semantics as write(), except that the data is normally only copied
+ * into the write-behind buffer and written out later by the background
+ * flusher task. Writes of at least the configured buffer size bypass the
+ * buffer and go directly to the underlying file.
+ *
+ * @param stream  stream handle obtained from esp_stream_open()
+ * @param src     data to write
+ * @param size    number of bytes to write
+ * @return number of bytes written, or -1 with errno set
+ */
+ssize_t esp_stream_write(esp_stream_handle_t stream, const void* src, size_t size);
+
+/**
+ * @brief Flush buffered writes and synchronize the file to storage
+ *
+ * Acts as a barrier: waits for any background write in progress, writes out
+ * the partially filled write-behind buffer, then calls fsync() on the
+ * underlying file descriptor.
+ *
+ * @param stream  stream handle obtained from esp_stream_open()
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL if a buffered write or fsync() failed; errno is set
+ */
+esp_err_t esp_stream_fsync(esp_stream_handle_t stream);
+
+/**
+ * @brief Change the file position of a buffered stream
+ *
+ * Same semantics as lseek(). Flushes buffered writes and discards the
+ * readahead buffers before repositioning, so seeking defeats the purpose of
+ * the stream when done frequently.
+ *
+ * @param stream  stream handle obtained from esp_stream_open()
+ * @param offset  offset, interpreted according to whence
+ * @param whence  SEEK_SET, SEEK_CUR or SEEK_END
+ * @return the resulting file position, or -1 with errno set
+ */
+off_t esp_stream_lseek(esp_stream_handle_t stream, off_t offset, int whence);
+
+/**
+ * @brief Flush and close a buffered stream
+ *
+ * The handle is freed even if flushing the remaining buffered data fails,
+ * in which case the error is returned.
+ *
+ * @param stream  stream handle obtained from esp_stream_open()
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_FAIL if flushing or close() failed; errno is set
+ */
+esp_err_t esp_stream_close(esp_stream_handle_t stream);
+
+#ifdef __cplusplus
+}
+#endif
@@ -73,6 +73,16 @@ const vfs_entry_t *get_vfs_for_path(const char *path);
  */
 const vfs_entry_t *get_vfs_for_index(int index);
 
+/**
+ * Get the index of the VFS a global file descriptor belongs to.
+ *
+ * @param fd global file descriptor.
+ *
+ * @return VFS index of the filesystem owning the descriptor, or -1 if the
+ *         descriptor is invalid or not in use.
+ */
+int esp_vfs_index_from_fd(int fd);
+
 #ifdef __cplusplus
 }
 #endif
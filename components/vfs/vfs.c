@@ -32,6 +32,12 @@
 #endif //CONFIG_VFS_SUPPRESS_SELECT_DEBUG_OUTPUT
 #include "esp_log.h"
 
+#if CONFIG_VFS_SUPPORT_STATS
+#include <inttypes.h>
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#endif
+
 static const char *TAG = "vfs";
 
 /* Max number of VFS entries (registered filesystems) */
@@ -76,6 +82,71 @@ static size_t s_vfs_count = 0;
 static fd_table_t s_fd_table[MAX_FDS] = { [0 ... MAX_FDS-1] = FD_TABLE_ENTRY_UNUSED };
 static _lock_t s_fd_table_lock;
 
+#if CONFIG_VFS_SUPPORT_STATS
+
+/* Per-mount I/O statistics. Counters are kept per core, so the hot path can
+ * increment them without taking a lock; esp_vfs_dump_stats() aggregates the
+ * cores. Collection is off until esp_vfs_stats_enable() is called, reducing
+ * the cost of an idle shim to one branch per operation.
+ */
+
+#define VFS_STATS_HIST_BUCKETS 16
+
+typedef enum {
+    VFS_STATS_OP_OPEN,
+    VFS_STATS_OP_CLOSE,
+    VFS_STATS_OP_READ,
+    VFS_STATS_OP_WRITE,
+    VFS_STATS_OP_LSEEK,
+    VFS_STATS_OP_FSYNC,
+    VFS_STATS_OP_MAX,
+} vfs_stats_op_t;
+
+typedef struct {
+    uint32_t op_count[VFS_STATS_OP_MAX];
+    uint64_t bytes_read;
+    uint64_t bytes_written;
+    // histogram of log2(operation latency in microseconds): bucket b counts
+    // operations which took [2^(b-1), 2^b) us, the last bucket is open-ended
+    uint32_t latency_hist[VFS_STATS_HIST_BUCKETS];
+} vfs_stats_t;
+
+static vfs_stats_t s_vfs_stats[CONFIG_FREERTOS_NUMBER_OF_CORES][VFS_MAX_COUNT];
+static volatile bool s_vfs_stats_enabled = false;
+
+static inline int64_t vfs_stats_begin(void)
+{
+    return s_vfs_stats_enabled ? esp_timer_get_time() : 0;
+}
+
+static void vfs_stats_record(int vfs_index, vfs_stats_op_t op, size_t bytes, int64_t t_start)
+{
+    if (t_start == 0 || vfs_index < 0 || vfs_index >= VFS_MAX_COUNT) {
+        return;
+    }
+    int64_t elapsed = esp_timer_get_time() - t_start;
+    uint32_t us = (elapsed < 0) ? 0 : (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t) elapsed;
+    vfs_stats_t* stats = &s_vfs_stats[esp_cpu_get_core_id()][vfs_index];
+    stats->op_count[op]++;
+    if (op == VFS_STATS_OP_READ) {
+        stats->bytes_read += bytes;
+    } else if (op == VFS_STATS_OP_WRITE) {
+        stats->bytes_written += bytes;
+    }
+    int bucket = (us == 0) ? 0 : MIN(32 - __builtin_clz(us), VFS_STATS_HIST_BUCKETS - 1);
+    stats->latency_hist[bucket]++;
+}
+
+#define VFS_STATS_BEGIN() int64_t vfs_stats_t_start = vfs_stats_begin()
+#define VFS_STATS_END(pvfs, op, bytes) vfs_stats_record((pvfs)->offset, op, bytes, vfs_stats_t_start)
+
+#else // CONFIG_VFS_SUPPORT_STATS
+
+#define VFS_STATS_BEGIN()
+#define VFS_STATS_END(pvfs, op, bytes)
+
+#endif // CONFIG_VFS_SUPPORT_STATS
+
 static ssize_t esp_get_free_index(void) {
     for (ssize_t i = 0; i < VFS_MAX_COUNT; i++) {
         if (s_vfs[i] == NULL) {
@@ -616,6 +687,17 @@ esp_err_t esp_vfs_unregister_fd(esp_vfs_id_t vfs_id, int fd)
     return ret;
 }
 
+int esp_vfs_index_from_fd(int fd)
+{
+    if (fd < 0 || fd >= MAX_FDS) {
+        return -1;
+    }
+    _lock_acquire(&s_fd_table_lock);
+    int index = s_fd_table[fd].vfs_index;
+    _lock_release(&s_fd_table_lock);
+    return index;
+}
+
 void esp_vfs_dump_fds(FILE *fp)
 {
     const vfs_entry_t* vfs;
@@ -652,6 +734,87 @@ void esp_vfs_dump_registered_paths(FILE *fp)
     }
 }
 
+#if CONFIG_VFS_SUPPORT_STATS
+
+void esp_vfs_stats_enable(void)
+{
+    s_vfs_stats_enabled = true;
+}
+
+void esp_vfs_stats_disable(void)
+{
+    s_vfs_stats_enabled = false;
+}
+
+void esp_vfs_stats_reset(void)
+{
+    memset(s_vfs_stats, 0, sizeof(s_vfs_stats));
+}
+
+void esp_vfs_dump_stats(FILE *fp)
+{
+    static const char* op_names[VFS_STATS_OP_MAX] = {
+        "open", "close", "read", "write", "lseek", "fsync",
+    };
+    fprintf(fp, "------------------------------------------------------\n");
+    fprintf(fp, "<VFS Path Prefix>: op counts, bytes, latency histogram\n");
+    fprintf(fp, "------------------------------------------------------\n");
+    for (size_t i = 0; i < s_vfs_count; ++i) {
+        const vfs_entry_t* vfs = s_vfs[i];
+        if (vfs == NULL) {
+            continue;
+        }
+        // aggregate the per-core counters; collection may be running
+        // concurrently, so the totals are a best-effort snapshot
+        vfs_stats_t total = { 0 };
+        for (int core = 0; core < CONFIG_FREERTOS_NUMBER_OF_CORES; ++core) {
+            const vfs_stats_t* src = &s_vfs_stats[core][i];
+            for (int op = 0; op < VFS_STATS_OP_MAX; ++op) {
+                total.op_count[op] += src->op_count[op];
+            }
+            total.bytes_read += src->bytes_read;
+            total.bytes_written += src->bytes_written;
+            for (int b = 0; b < VFS_STATS_HIST_BUCKETS; ++b) {
+                total.latency_hist[b] += src->latency_hist[b];
+            }
+        }
+        uint32_t total_ops = 0;
+        for (int op = 0; op < VFS_STATS_OP_MAX; ++op) {
+            total_ops += total.op_count[op];
+        }
+        if (total_ops == 0) {
+            continue;
+        }
+        fprintf(fp, "(%s)\n", strcmp(vfs->path_prefix, "") ? vfs->path_prefix : "socket");
+        for (int op = 0; op < VFS_STATS_OP_MAX; ++op) {
+            if (total.op_count[op] == 0) {
+                continue;
+            }
+            fprintf(fp, "  %-5s: %" PRIu32, op_names[op], total.op_count[op]);
+            if (op == VFS_STATS_OP_READ) {
+                fprintf(fp, " (%llu bytes)", (unsigned long long) total.bytes_read);
+            } else if (op == VFS_STATS_OP_WRITE) {
+                fprintf(fp, " (%llu bytes)", (unsigned long long) total.bytes_written);
+            }
+            fprintf(fp, "\n");
+        }
+        fprintf(fp, "  latency:");
+        for (int b = 0; b < VFS_STATS_HIST_BUCKETS; ++b) {
+            if (total.latency_hist[b] == 0) {
+                continue;
+            }
+            if (b < VFS_STATS_HIST_BUCKETS - 1) {
+                fprintf(fp, " <%uus:%" PRIu32, 1u << b, total.latency_hist[b]);
+            } else {
+                fprintf(fp, " >=%uus:%" PRIu32, 1u << (b - 1), total.latency_hist[b]);
+            }
+        }
+        fprintf(fp, "\n");
+    }
+}
+
+#endif // CONFIG_VFS_SUPPORT_STATS
+
 /*
  * Set ESP_VFS_FLAG_READONLY_FS read-only flag for a registered virtual filesystem
  * for given path prefix. Should be only called from the esp_vfs_*filesystem* register
@@ -861,7 +1024,9 @@ int esp_vfs_open(struct _reent *r, const char * path, int flags, int mode)
 
     const char *path_within_vfs = translate_path(vfs, path);
     int fd_within_vfs;
+    VFS_STATS_BEGIN();
     CHECK_AND_CALL(fd_within_vfs, r, vfs, open, path_within_vfs, flags, mode);
+    VFS_STATS_END(vfs, VFS_STATS_OP_OPEN, 0);
     if (fd_within_vfs >= 0) {
         _lock_acquire(&s_fd_table_lock);
         for (int i = 0; i < MAX_FDS; ++i) {
@@ -893,7 +1058,9 @@ ssize_t esp_vfs_write(struct _reent *r, int fd, const void * data, size_t size)
         return -1;
     }
     ssize_t ret;
+    VFS_STATS_BEGIN();
     CHECK_AND_CALL(ret, r, vfs, write, local_fd, data, size);
+    VFS_STATS_END(vfs, VFS_STATS_OP_WRITE, ret > 0 ? (size_t) ret : 0);
     return ret;
 }
 
@@ -906,7 +1073,9 @@ off_t esp_vfs_lseek(struct _reent *r, int fd, off_t size, int mode)
         return -1;
     }
     off_t ret;
+    VFS_STATS_BEGIN();
     CHECK_AND_CALL(ret, r, vfs, lseek, local_fd, size, mode);
+    VFS_STATS_END(vfs, VFS_STATS_OP_LSEEK, 0);
     return ret;
 }
 
@@ -919,7 +1088,9 @@ ssize_t esp_vfs_read(struct _reent *r, int fd, void * dst, size_t size)
         return -1;
     }
     ssize_t ret;
+    VFS_STATS_BEGIN();
     CHECK_AND_CALL(ret, r, vfs, read, local_fd, dst, size);
+    VFS_STATS_END(vfs, VFS_STATS_OP_READ, ret > 0 ? (size_t) ret : 0);
     return ret;
 }
 
@@ -933,7 +1104,9 @@ ssize_t esp_vfs_pread(int fd, void *dst, size_t size, off_t offset)
         return -1;
     }
     ssize_t ret;
+    VFS_STATS_BEGIN();
     CHECK_AND_CALL(ret, r, vfs, pread, local_fd, dst, size, offset);
+    VFS_STATS_END(vfs, VFS_STATS_OP_READ, ret > 0 ? (size_t) ret : 0);
     return ret;
 }
 
@@ -947,7 +1120,9 @@ ssize_t esp_vfs_pwrite(int fd, const void *src, size_t size, off_t offset)
         return -1;
     }
     ssize_t ret;
+    VFS_STATS_BEGIN();
     CHECK_AND_CALL(ret, r, vfs, pwrite, local_fd, src, size, offset);
+    VFS_STATS_END(vfs, VFS_STATS_OP_WRITE, ret > 0 ? (size_t) ret : 0);
     return ret;
 }
 
@@ -960,7 +1135,9 @@ int esp_vfs_close(struct _reent *r, int fd)
         return -1;
     }
     int ret;
+    VFS_STATS_BEGIN();
     CHECK_AND_CALL(ret, r, vfs, close, local_fd);
+    VFS_STATS_END(vfs, VFS_STATS_OP_CLOSE, 0);
 
     _lock_acquire(&s_fd_table_lock);
     if (!s_fd_table[fd].permanent) {
@@ -1027,7 +1204,9 @@ int esp_vfs_fsync(int fd)
         return -1;
     }
     int ret;
+    VFS_STATS_BEGIN();
     CHECK_AND_CALL(ret, r, vfs, fsync, local_fd);
+    VFS_STATS_END(vfs, VFS_STATS_OP_FSYNC, 0);
     return ret;
 }
 
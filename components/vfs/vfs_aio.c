@@ -0,0 +1,223 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_vfs_aio.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/lock.h>
+
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_vfs.h"
+#include "esp_vfs_private.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+static const char *TAG = "vfs_aio";
+
+typedef struct esp_vfs_aio_queue {
+    QueueHandle_t completions;  // holds esp_vfs_aio_cqe_t, sized for `depth` entries
+    size_t depth;
+    volatile size_t in_flight;  // submitted but not yet collected, protected by s_aio_lock
+} esp_vfs_aio_queue_t;
+
+typedef struct {
+    esp_vfs_aio_req_t req;
+    esp_vfs_aio_queue_t *queue;
+} aio_submission_t;
+
+typedef struct {
+    TaskHandle_t task;
+    QueueHandle_t submissions;  // holds aio_submission_t
+} aio_worker_t;
+
+// One worker per registered filesystem, created on first submission.
+// The workers never go away: a couple of idle tasks are cheaper than
+// the teardown races, matching the approach of esp_timer and friends.
+static aio_worker_t s_workers[VFS_MAX_COUNT];
+static _lock_t s_aio_lock;
+
+static ssize_t aio_transfer(const esp_vfs_aio_req_t *req)
+{
+    ssize_t total = 0;
+    off_t offset = req->offset;
+    for (int i = 0; i < req->iovcnt; i++) {
+        uint8_t *base = (uint8_t *)req->iov[i].iov_base;
+        size_t len = req->iov[i].iov_len;
+        ssize_t chunk;
+        if (req->op == ESP_VFS_AIO_OP_READ) {
+            chunk = (offset < 0) ? read(req->fd, base, len) : pread(req->fd, base, len, offset);
+        } else {
+            chunk = (offset < 0) ? write(req->fd, base, len) : pwrite(req->fd, base, len, offset);
+        }
+        if (chunk < 0) {
+            // Report the short count if earlier segments already transferred
+            return (total > 0) ? total : -1;
+        }
+        total += chunk;
+        if (offset >= 0) {
+            offset += chunk;
+        }
+        if ((size_t)chunk < len) {
+            break;  // Short transfer, e.g. end of file or full filesystem
+        }
+    }
+    return total;
+}
+
+static void aio_worker_main(void *arg)
+{
+    QueueHandle_t submissions = (QueueHandle_t)arg;
+    aio_submission_t sub;
+    while (true) {
+        if (xQueueReceive(submissions, &sub, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        esp_vfs_aio_cqe_t cqe = {
+            .op = sub.req.op,
+            .fd = sub.req.fd,
+            .user_data = sub.req.user_data,
+        };
+        errno = 0;
+        if (sub.req.op == ESP_VFS_AIO_OP_FSYNC) {
+            cqe.result = fsync(sub.req.fd);
+        } else {
+            cqe.result = aio_transfer(&sub.req);
+        }
+        cqe.error = (cqe.result < 0) ? errno : 0;
+        // Space for the completion was reserved at submission time,
+        // so this send never blocks the worker
+        BaseType_t sent = xQueueSend(sub.queue->completions, &cqe, 0);
+        assert(sent == pdTRUE);
+        (void)sent;
+    }
+}
+
+static esp_err_t aio_worker_get(int vfs_index, aio_worker_t **out_worker)
+{
+    aio_worker_t *worker = &s_workers[vfs_index];
+    esp_err_t ret = ESP_OK;
+    _lock_acquire(&s_aio_lock);
+    if (worker->task == NULL) {
+        worker->submissions = xQueueCreate(CONFIG_VFS_AIO_WORKER_QUEUE_DEPTH, sizeof(aio_submission_t));
+        if (worker->submissions == NULL) {
+            ret = ESP_ERR_NO_MEM;
+            goto out;
+        }
+        char name[configMAX_TASK_NAME_LEN];
+        snprintf(name, sizeof(name), "vfs_aio%d", vfs_index);
+        if (xTaskCreate(aio_worker_main, name, CONFIG_VFS_AIO_WORKER_STACK_SIZE,
+                        worker->submissions, CONFIG_VFS_AIO_WORKER_TASK_PRIORITY, &worker->task) != pdPASS) {
+            vQueueDelete(worker->submissions);
+            worker->submissions = NULL;
+            ret = ESP_ERR_NO_MEM;
+            goto out;
+        }
+        ESP_LOGD(TAG, "created AIO worker for VFS %d", vfs_index);
+    }
+out:
+    _lock_release(&s_aio_lock);
+    if (ret == ESP_OK) {
+        *out_worker = worker;
+    }
+    return ret;
+}
+
+esp_err_t esp_vfs_aio_queue_create(const esp_vfs_aio_queue_config_t *config, esp_vfs_aio_queue_handle_t *out_queue)
+{
+    if (config == NULL || out_queue == NULL || config->depth == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_vfs_aio_queue_t *queue = calloc(1, sizeof(esp_vfs_aio_queue_t));
+    if (queue == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    queue->depth = config->depth;
+    queue->completions = xQueueCreate(config->depth, sizeof(esp_vfs_aio_cqe_t));
+    if (queue->completions == NULL) {
+        free(queue);
+        return ESP_ERR_NO_MEM;
+    }
+    *out_queue = queue;
+    return ESP_OK;
+}
+
+esp_err_t esp_vfs_aio_queue_delete(esp_vfs_aio_queue_handle_t queue)
+{
+    if (queue == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    _lock_acquire(&s_aio_lock);
+    size_t in_flight = queue->in_flight;
+    _lock_release(&s_aio_lock);
+    if (in_flight != 0) {
+        ESP_LOGE(TAG, "cannot delete AIO queue, %u requests in flight", (unsigned)in_flight);
+        return ESP_ERR_INVALID_STATE;
+    }
+    vQueueDelete(queue->completions);
+    free(queue);
+    return ESP_OK;
+}
+
+esp_err_t esp_vfs_aio_submit(esp_vfs_aio_queue_handle_t queue, const esp_vfs_aio_req_t *req)
+{
+    if (queue == NULL || req == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (req->op != ESP_VFS_AIO_OP_FSYNC && (req->iov == NULL || req->iovcnt <= 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    int vfs_index = esp_vfs_index_from_fd(req->fd);
+    if (vfs_index < 0) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    aio_worker_t *worker;
+    esp_err_t ret = aio_worker_get(vfs_index, &worker);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    // Reserve the completion slot before handing the request to the worker,
+    // so the completion queue can never overflow
+    _lock_acquire(&s_aio_lock);
+    if (queue->in_flight >= queue->depth) {
+        _lock_release(&s_aio_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    queue->in_flight++;
+    _lock_release(&s_aio_lock);
+
+    aio_submission_t sub = {
+        .req = *req,
+        .queue = queue,
+    };
+    if (xQueueSend(worker->submissions, &sub, 0) != pdTRUE) {
+        _lock_acquire(&s_aio_lock);
+        queue->in_flight--;
+        _lock_release(&s_aio_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_vfs_aio_wait(esp_vfs_aio_queue_handle_t queue, esp_vfs_aio_cqe_t *out_cqe, TickType_t timeout)
+{
+    if (queue == NULL || out_cqe == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (xQueueReceive(queue->completions, out_cqe, timeout) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    _lock_acquire(&s_aio_lock);
+    queue->in_flight--;
+    _lock_release(&s_aio_lock);
+    return ESP_OK;
+}
@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_vfs_mount_async.h"
+#include "sdkconfig.h"
+
+struct esp_vfs_mount_async_t {
+    esp_vfs_mount_fn_t fn;
+    void* ctx;
+    esp_err_t result;
+    SemaphoreHandle_t done;
+};
+
+static void s_mount_task(void* arg)
+{
+    struct esp_vfs_mount_async_t* handle = (struct esp_vfs_mount_async_t*) arg;
+    handle->result = handle->fn(handle->ctx);
+    xSemaphoreGive(handle->done);
+    vTaskDelete(NULL);
+}
+
+esp_err_t esp_vfs_mount_async(esp_vfs_mount_fn_t fn, void* ctx,
+                              esp_vfs_mount_async_handle_t* out_handle)
+{
+    if (fn == NULL || out_handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct esp_vfs_mount_async_t* handle = calloc(1, sizeof(*handle));
+    if (handle == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    handle->fn = fn;
+    handle->ctx = ctx;
+    handle->done = xSemaphoreCreateBinary();
+    if (handle->done == NULL) {
+        free(handle);
+        return ESP_ERR_NO_MEM;
+    }
+    if (xTaskCreate(s_mount_task, "vfs_mount", CONFIG_VFS_MOUNT_ASYNC_STACK_SIZE,
+                    handle, CONFIG_VFS_MOUNT_ASYNC_TASK_PRIORITY, NULL) != pdTRUE) {
+        vSemaphoreDelete(handle->done);
+        free(handle);
+        return ESP_ERR_NO_MEM;
+    }
+    *out_handle = handle;
+    return ESP_OK;
+}
+
+esp_err_t esp_vfs_mount_async_wait(esp_vfs_mount_async_handle_t handle,
+                                   TickType_t ticks_to_wait, esp_err_t* out_mount_err)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (xSemaphoreTake(handle->done, ticks_to_wait) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    if (out_mount_err != NULL) {
+        *out_mount_err = handle->result;
+    }
+    vSemaphoreDelete(handle->done);
+    free(handle);
+    return ESP_OK;
+}
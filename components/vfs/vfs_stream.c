@@ -0,0 +1,442 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/lock.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_vfs_stream.h"
+#include "sdkconfig.h"
+
+#define STREAM_DEFAULT_BUF_SIZE 4096
+
+static const char *TAG = "vfs_stream";
+
+typedef enum {
+    STREAM_JOB_WRITE,       // write job.len bytes from job.buf to the file
+    STREAM_JOB_PREFETCH,    // read up to buf_size bytes from the file into job.buf
+    STREAM_JOB_EXIT,        // terminate the flusher task
+} stream_job_type_t;
+
+typedef struct {
+    stream_job_type_t type;
+    uint8_t* buf;
+    size_t len;
+} stream_job_t;
+
+struct esp_stream_t {
+    int fd;
+    int acc_mode;               // flags & O_ACCMODE
+    size_t buf_size;
+    _lock_t lock;
+    TaskHandle_t worker;
+    QueueHandle_t jobs;
+    SemaphoreHandle_t idle;     // given whenever the worker has no job in flight
+    int io_errno;               // first errno from a background operation, 0 if none
+    // write-behind: the active buffer is filled by the caller while the other
+    // one may be written out by the worker
+    uint8_t* wr_buf[2];
+    int wr_active;
+    size_t wr_fill;
+    // readahead: the active buffer is drained by the caller while the other
+    // one may be refilled by the worker
+    uint8_t* rd_buf[2];
+    int rd_active;
+    size_t rd_pos;
+    size_t rd_len;
+    ssize_t prefetch_len;       // result of the last completed prefetch
+    bool prefetch_pending;      // a prefetch has been submitted for the inactive buffer
+    bool rd_eof;
+};
+
+static void s_stream_worker(void* arg)
+{
+    struct esp_stream_t* stream = (struct esp_stream_t*) arg;
+    stream_job_t job;
+    while (true) {
+        xQueueReceive(stream->jobs, &job, portMAX_DELAY);
+        if (job.type == STREAM_JOB_EXIT) {
+            xSemaphoreGive(stream->idle);
+            break;
+        }
+        if (job.type == STREAM_JOB_WRITE) {
+            size_t done = 0;
+            while (done < job.len) {
+                ssize_t n = write(stream->fd, job.buf + done, job.len - done);
+                if (n < 0) {
+                    ESP_LOGE(TAG, "background write on fd %d failed: errno %d", stream->fd, errno);
+                    if (stream->io_errno == 0) {
+                        stream->io_errno = errno;
+                    }
+                    break;
+                }
+                done += n;
+            }
+        } else {
+            ssize_t n = read(stream->fd, job.buf, stream->buf_size);
+            if (n < 0 && stream->io_errno == 0) {
+                stream->io_errno = errno;
+            }
+            stream->prefetch_len = n;
+        }
+        xSemaphoreGive(stream->idle);
+    }
+    vTaskDelete(NULL);
+}
+
+// Hand a job to the worker. At most one job is in flight; the idle semaphore
+// is held by the worker for the duration of the job.
+static void s_stream_submit(struct esp_stream_t* stream, stream_job_type_t type, uint8_t* buf, size_t len)
+{
+    stream_job_t job = {
+        .type = type,
+        .buf = buf,
+        .len = len,
+    };
+    xSemaphoreTake(stream->idle, portMAX_DELAY);
+    xQueueSend(stream->jobs, &job, portMAX_DELAY);
+}
+
+// Wait until the worker has finished the job in flight, if any
+static void s_stream_drain(struct esp_stream_t* stream)
+{
+    xSemaphoreTake(stream->idle, portMAX_DELAY);
+    xSemaphoreGive(stream->idle);
+}
+
+// Write out the partially filled write-behind buffer and report any deferred
+// background error. Returns 0 on success, -1 with errno set on failure.
+static int s_stream_flush_writes(struct esp_stream_t* stream)
+{
+    s_stream_drain(stream);
+    if (stream->io_errno != 0) {
+        errno = stream->io_errno;
+        stream->io_errno = 0;
+        return -1;
+    }
+    size_t done = 0;
+    uint8_t* buf = stream->wr_buf[stream->wr_active];
+    while (done < stream->wr_fill) {
+        ssize_t n = write(stream->fd, buf + done, stream->wr_fill - done);
+        if (n < 0) {
+            return -1;
+        }
+        done += n;
+    }
+    stream->wr_fill = 0;
+    return 0;
+}
+
+// File position as seen by the caller: the fd position minus whatever the
+// readahead has fetched but not yet served. The worker must be drained.
+static off_t s_stream_logical_pos(struct esp_stream_t* stream)
+{
+    off_t pos = lseek(stream->fd, 0, SEEK_CUR);
+    if (pos < 0) {
+        return -1;
+    }
+    pos -= (off_t) (stream->rd_len - stream->rd_pos);
+    if (stream->prefetch_pending && stream->prefetch_len > 0) {
+        pos -= (off_t) stream->prefetch_len;
+    }
+    return pos;
+}
+
+static void s_stream_discard_readahead(struct esp_stream_t* stream)
+{
+    stream->rd_pos = 0;
+    stream->rd_len = 0;
+    stream->prefetch_pending = false;
+    stream->prefetch_len = 0;
+    stream->rd_eof = false;
+}
+
+static uint8_t* s_stream_buf_alloc(size_t size, bool prefer_psram)
+{
+    uint8_t* buf = NULL;
+    if (prefer_psram) {
+        buf = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (buf == NULL) {
+        buf = heap_caps_malloc(size, MALLOC_CAP_DEFAULT);
+    }
+    return buf;
+}
+
+static void s_stream_free(struct esp_stream_t* stream)
+{
+    for (int i = 0; i < 2; ++i) {
+        free(stream->wr_buf[i]);
+        free(stream->rd_buf[i]);
+    }
+    if (stream->jobs) {
+        vQueueDelete(stream->jobs);
+    }
+    if (stream->idle) {
+        vSemaphoreDelete(stream->idle);
+    }
+    _lock_close(&stream->lock);
+    free(stream);
+}
+
+esp_err_t esp_stream_open(const char* path, int flags, const esp_stream_config_t* config,
+                          esp_stream_handle_t* out_stream)
+{
+    if (path == NULL || out_stream == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct esp_stream_t* stream = calloc(1, sizeof(*stream));
+    if (stream == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    stream->fd = -1;
+    stream->acc_mode = flags & O_ACCMODE;
+    stream->buf_size = (config != NULL && config->buffer_size != 0) ?
+            config->buffer_size : STREAM_DEFAULT_BUF_SIZE;
+    bool prefer_psram = config != NULL && config->prefer_psram;
+    _lock_init(&stream->lock);
+
+    esp_err_t err = ESP_ERR_NO_MEM;
+    for (int i = 0; i < 2; ++i) {
+        if (stream->acc_mode != O_RDONLY) {
+            stream->wr_buf[i] = s_stream_buf_alloc(stream->buf_size, prefer_psram);
+            if (stream->wr_buf[i] == NULL) {
+                goto fail;
+            }
+        }
+        if (stream->acc_mode != O_WRONLY) {
+            stream->rd_buf[i] = s_stream_buf_alloc(stream->buf_size, prefer_psram);
+            if (stream->rd_buf[i] == NULL) {
+                goto fail;
+            }
+        }
+    }
+    stream->jobs = xQueueCreate(1, sizeof(stream_job_t));
+    stream->idle = xSemaphoreCreateBinary();
+    if (stream->jobs == NULL || stream->idle == NULL) {
+        goto fail;
+    }
+    xSemaphoreGive(stream->idle);
+
+    stream->fd = open(path, flags, 0666);
+    if (stream->fd < 0) {
+        err = ESP_FAIL;
+        goto fail;
+    }
+    if (xTaskCreate(s_stream_worker, "vfs_stream", CONFIG_VFS_STREAM_FLUSHER_STACK_SIZE,
+                    stream, CONFIG_VFS_STREAM_FLUSHER_TASK_PRIORITY, &stream->worker) != pdTRUE) {
+        goto fail;
+    }
+    *out_stream = stream;
+    return ESP_OK;
+
+fail:
+    if (stream->fd >= 0) {
+        close(stream->fd);
+    }
+    s_stream_free(stream);
+    return err;
+}
+
+ssize_t esp_stream_read(esp_stream_handle_t stream, void* dst, size_t size)
+{
+    if (stream == NULL || (dst == NULL && size > 0)) {
+        errno = EINVAL;
+        return -1;
+    }
+    if (stream->acc_mode == O_WRONLY) {
+        errno = EBADF;
+        return -1;
+    }
+    _lock_acquire(&stream->lock);
+    if (stream->acc_mode == O_RDWR && s_stream_flush_writes(stream) < 0) {
+        _lock_release(&stream->lock);
+        return -1;
+    }
+    uint8_t* p = (uint8_t*) dst;
+    size_t remaining = size;
+    int err = 0;
+    while (remaining > 0 && !stream->rd_eof) {
+        size_t avail = stream->rd_len - stream->rd_pos;
+        if (avail > 0) {
+            size_t copy = MIN(avail, remaining);
+            memcpy(p, stream->rd_buf[stream->rd_active] + stream->rd_pos, copy);
+            stream->rd_pos += copy;
+            p += copy;
+            remaining -= copy;
+            continue;
+        }
+        if (stream->prefetch_pending) {
+            s_stream_drain(stream);
+            stream->prefetch_pending = false;
+            if (stream->prefetch_len < 0) {
+                err = stream->io_errno != 0 ? stream->io_errno : EIO;
+                stream->io_errno = 0;
+                break;
+            }
+            stream->rd_active ^= 1;
+            stream->rd_len = (size_t) stream->prefetch_len;
+        } else {
+            ssize_t n = read(stream->fd, stream->rd_buf[stream->rd_active], stream->buf_size);
+            if (n < 0) {
+                err = errno;
+                break;
+            }
+            stream->rd_len = (size_t) n;
+        }
+        stream->rd_pos = 0;
+        if (stream->rd_len == 0) {
+            stream->rd_eof = true;
+        } else if (stream->rd_len == stream->buf_size) {
+            // a full buffer suggests more data follows: refill the other
+            // buffer in the background while this one is being drained
+            stream->prefetch_pending = true;
+            s_stream_submit(stream, STREAM_JOB_PREFETCH, stream->rd_buf[stream->rd_active ^ 1], 0);
+        }
+    }
+    _lock_release(&stream->lock);
+    if (err != 0 && remaining == size) {
+        errno = err;
+        return -1;
+    }
+    return (ssize_t) (size - remaining);
+}
+
+ssize_t esp_stream_write(esp_stream_handle_t stream, const void* src, size_t size)
+{
+    if (stream == NULL || (src == NULL && size > 0)) {
+        errno = EINVAL;
+        return -1;
+    }
+    if (stream->acc_mode == O_RDONLY) {
+        errno = EBADF;
+        return -1;
+    }
+    _lock_acquire(&stream->lock);
+    if (stream->rd_len > stream->rd_pos || stream->prefetch_pending) {
+        // readahead has moved the fd past the logical position; rewind
+        s_stream_drain(stream);
+        off_t pos = s_stream_logical_pos(stream);
+        s_stream_discard_readahead(stream);
+        if (pos < 0 || lseek(stream->fd, pos, SEEK_SET) < 0) {
+            _lock_release(&stream->lock);
+            return -1;
+        }
+    }
+    if (stream->io_errno != 0) {
+        errno = stream->io_errno;
+        stream->io_errno = 0;
+        _lock_release(&stream->lock);
+        return -1;
+    }
+    const uint8_t* p = (const uint8_t*) src;
+    size_t remaining = size;
+    int err = 0;
+    while (remaining > 0) {
+        if (stream->wr_fill == 0 && remaining >= stream->buf_size) {
+            // buffering would only add a copy; write directly once the
+            // buffer in flight (if any) has been written out
+            s_stream_drain(stream);
+            ssize_t n = write(stream->fd, p, remaining);
+            if (n < 0) {
+                err = errno;
+                break;
+            }
+            if (n == 0) {
+                break;
+            }
+            p += n;
+            remaining -= n;
+            continue;
+        }
+        size_t copy = MIN(stream->buf_size - stream->wr_fill, remaining);
+        memcpy(stream->wr_buf[stream->wr_active] + stream->wr_fill, p, copy);
+        stream->wr_fill += copy;
+        p += copy;
+        remaining -= copy;
+        if (stream->wr_fill == stream->buf_size) {
+            s_stream_submit(stream, STREAM_JOB_WRITE, stream->wr_buf[stream->wr_active], stream->buf_size);
+            stream->wr_active ^= 1;
+            stream->wr_fill = 0;
+        }
+    }
+    _lock_release(&stream->lock);
+    if (err != 0 && remaining == size) {
+        errno = err;
+        return -1;
+    }
+    return (ssize_t) (size - remaining);
+}
+
+esp_err_t esp_stream_fsync(esp_stream_handle_t stream)
+{
+    if (stream == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t ret = ESP_OK;
+    _lock_acquire(&stream->lock);
+    if (s_stream_flush_writes(stream) < 0 || fsync(stream->fd) < 0) {
+        ret = ESP_FAIL;
+    }
+    _lock_release(&stream->lock);
+    return ret;
+}
+
+off_t esp_stream_lseek(esp_stream_handle_t stream, off_t offset, int whence)
+{
+    if (stream == NULL) {
+        errno = EINVAL;
+        return -1;
+    }
+    _lock_acquire(&stream->lock);
+    if (s_stream_flush_writes(stream) < 0) {
+        _lock_release(&stream->lock);
+        return -1;
+    }
+    if (whence == SEEK_CUR) {
+        off_t pos = s_stream_logical_pos(stream);
+        if (pos < 0) {
+            _lock_release(&stream->lock);
+            return -1;
+        }
+        offset += pos;
+        whence = SEEK_SET;
+    }
+    s_stream_discard_readahead(stream);
+    off_t res = lseek(stream->fd, offset, whence);
+    _lock_release(&stream->lock);
+    return res;
+}
+
+esp_err_t esp_stream_close(esp_stream_handle_t stream)
+{
+    if (stream == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t ret = ESP_OK;
+    _lock_acquire(&stream->lock);
+    if (s_stream_flush_writes(stream) < 0) {
+        ret = ESP_FAIL;
+    }
+    s_stream_submit(stream, STREAM_JOB_EXIT, NULL, 0);
+    // the worker gives the idle semaphore one last time before terminating
+    xSemaphoreTake(stream->idle, portMAX_DELAY);
+    if (close(stream->fd) < 0 && ret == ESP_OK) {
+        ret = ESP_FAIL;
+    }
+    _lock_release(&stream->lock);
+    s_stream_free(stream);
+    return ret;
+}
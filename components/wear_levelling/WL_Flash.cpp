@@ -246,17 +246,28 @@ esp_err_t WL_Flash::recoverPos()
     esp_err_t result = ESP_OK;
     size_t position = 0;
     ESP_LOGV(TAG, "%s start", __func__);
-    for (size_t i = 0; i < this->state.wl_part_max_sec_pos; i++) {
+    // The position update records are appended strictly in order and the whole
+    // record table is erased when the dummy sector wraps around, so the table
+    // always consists of a run of valid records followed by erased ones. Search
+    // for the first invalid record with a binary search instead of a full scan:
+    // the position is recovered with log2(wl_part_max_sec_pos) record reads and
+    // CRC checks, which keeps the mount time flat on large partitions.
+    size_t lo = 0; // number of records known to be valid
+    size_t hi = this->state.wl_part_max_sec_pos;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
         bool pos_bits;
-        position = i;
-        result = this->partition->read(this->addr_state1 + sizeof(wl_state_t) + i * this->cfg.wl_pos_update_record_size, this->temp_buff, this->cfg.wl_pos_update_record_size);
-        pos_bits = this->OkBuffSet(i);
+        result = this->partition->read(this->addr_state1 + sizeof(wl_state_t) + mid * this->cfg.wl_pos_update_record_size, this->temp_buff, this->cfg.wl_pos_update_record_size);
+        pos_bits = this->OkBuffSet(mid);
         WL_RESULT_CHECK(result);
-        ESP_LOGV(TAG, "%s - check pos: result=0x%08" PRIx32 ", position= %" PRIu32 ", pos_bits= 0x%08" PRIx32 , __func__, (uint32_t) result, (uint32_t) position, (uint32_t) pos_bits);
-        if (pos_bits == false) {
-            break; // we have found position
+        ESP_LOGV(TAG, "%s - check pos: result=0x%08" PRIx32 ", position= %" PRIu32 ", pos_bits= 0x%08" PRIx32 , __func__, (uint32_t) result, (uint32_t) mid, (uint32_t) pos_bits);
+        if (pos_bits == true) {
+            lo = mid + 1;
+        } else {
+            hi = mid; // we have found an invalid record, the position is at or before it
         }
     }
+    position = lo;
 
     this->state.wl_dummy_sec_pos = position;
     if (this->state.wl_dummy_sec_pos == this->state.wl_part_max_sec_pos) {
@@ -445,6 +456,7 @@ esp_err_t WL_Flash::updateWL()
         this->state.wl_sec_erase_cycle_count = this->state.wl_max_sec_erase_cycle_count - 1; // we will update next time
         return result;
     }
+    this->perf_counters.total_erase_count += this->cfg.wl_page_size / this->cfg.flash_sector_size;
 
     size_t copy_count = this->cfg.wl_page_size / this->cfg.wl_temp_buff_size;
     for (size_t i = 0; i < copy_count; i++) {
@@ -462,6 +474,7 @@ esp_err_t WL_Flash::updateWL()
         }
     }
     // done... block moved.
+    this->perf_counters.sector_move_count++;
     // Here we will update structures...
     // Update bits and save to flash:
     uint32_t byte_pos = this->state.wl_dummy_sec_pos * this->cfg.wl_pos_update_record_size;
@@ -500,6 +513,7 @@ esp_err_t WL_Flash::updateWL()
         WL_RESULT_CHECK(result);
         result = this->partition->write(this->addr_state2, &this->state, sizeof(wl_state_t));
         WL_RESULT_CHECK(result);
+        this->perf_counters.total_erase_count += 2 * this->state_size / this->cfg.flash_sector_size;
         ESP_LOGD(TAG, "%s - wl_dummy_sec_move_count= 0x%08" PRIx32 ", wl_dummy_sec_pos= 0x%08" PRIx32 ", ", __func__, this->state.wl_dummy_sec_move_count, this->state.wl_dummy_sec_pos);
     }
     // Save structures to the flash... and check result
@@ -552,6 +566,8 @@ esp_err_t WL_Flash::erase_sector(size_t sector)
     size_t virt_addr = this->calcAddr(sector * this->cfg.flash_sector_size);
     result = this->partition->erase_sector((this->cfg.wl_partition_start_addr + virt_addr) / this->cfg.flash_sector_size);
     WL_RESULT_CHECK(result);
+    this->perf_counters.user_erase_count++;
+    this->perf_counters.total_erase_count++;
     return result;
 }
 
@@ -615,6 +631,12 @@ Partition *WL_Flash::get_part()
 {
     return this->partition;
 }
+
+void WL_Flash::get_perf_counters(wl_perf_counters_t *counters)
+{
+    *counters = this->perf_counters;
+    counters->dummy_loop_count = this->state.wl_dummy_sec_move_count;
+}
 wl_config_t *WL_Flash::get_cfg()
 {
     return &this->cfg;
@@ -120,6 +120,33 @@ size_t wl_size(wl_handle_t handle);
 */
 size_t wl_sector_size(wl_handle_t handle);
 
+/**
+* @brief Performance counters of a WL instance
+*
+* All counters except dummy_loop_count are collected since the instance was
+* mounted; dummy_loop_count is part of the persistent WL state. The erase
+* amplification of the instance is total_erase_count / user_erase_count.
+*/
+typedef struct {
+    uint32_t sector_move_count;    /*!< Number of sector moves performed by the WL algorithm since mount */
+    uint32_t dummy_loop_count;     /*!< Number of full passes the dummy sector has made over the partition */
+    uint32_t user_erase_count;     /*!< Number of sector erases requested by the upper layer since mount */
+    uint32_t total_erase_count;    /*!< Number of physical sector erases performed since mount, including WL housekeeping */
+} wl_perf_counters_t;
+
+/**
+* @brief Get the performance counters of the WL instance
+*
+* @param handle WL module handle that was initialized before
+* @param counters Pointer to the structure where the counters should be stored
+*
+* @return
+*       - ESP_OK, if the counters were read successfully;
+*       - ESP_ERR_INVALID_ARG, if counters is NULL;
+*       - ESP_ERR_NOT_FOUND, if the handle is not valid;
+*/
+esp_err_t wl_get_perf_counters(wl_handle_t handle, wl_perf_counters_t *counters);
+
 
 #ifdef __cplusplus
 } // extern "C"
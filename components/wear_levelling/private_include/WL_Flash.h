@@ -11,6 +11,7 @@
 #include "Partition.h"
 #include "WL_Config.h"
 #include "WL_State.h"
+#include "wear_levelling.h"
 
 /**
 * @brief This class is used to make wear levelling for flash devices. Class implements Flash_Access interface
@@ -38,6 +39,7 @@ public :
 
     Partition *get_part();
     wl_config_t *get_cfg();
+    void get_perf_counters(wl_perf_counters_t *counters);
 
 protected:
     bool configured = false;
@@ -58,6 +60,7 @@ protected:
     uint8_t *temp_buff = NULL;
     size_t dummy_addr;
     uint32_t pos_data[4];
+    wl_perf_counters_t perf_counters = {};
 
     esp_err_t initSections();
     esp_err_t updateWL();
@@ -251,6 +251,21 @@ size_t wl_sector_size(wl_handle_t handle)
     return result;
 }
 
+esp_err_t wl_get_perf_counters(wl_handle_t handle, wl_perf_counters_t *counters)
+{
+    esp_err_t result = check_handle(handle, __func__);
+    if (result != ESP_OK) {
+        return result;
+    }
+    if (counters == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    _lock_acquire(&s_instances[handle].lock);
+    s_instances[handle].instance->get_perf_counters(counters);
+    _lock_release(&s_instances[handle].lock);
+    return ESP_OK;
+}
+
 static esp_err_t check_handle(wl_handle_t handle, const char *func)
 {
     if (handle == WL_INVALID_HANDLE) {
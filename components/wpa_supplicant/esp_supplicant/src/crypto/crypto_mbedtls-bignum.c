@@ -7,6 +7,7 @@
 #ifdef ESP_PLATFORM
 #include "esp_system.h"
 #include "mbedtls/bignum.h"
+#include "soc/soc_caps.h"
 #endif
 
 #include "utils/includes.h"
@@ -151,6 +152,24 @@ int crypto_bignum_mulmod(const struct crypto_bignum *a,
                          const struct crypto_bignum *c,
                          struct crypto_bignum *d)
 {
+#ifdef CONFIG_MBEDTLS_HARDWARE_MPI
+    /* SAE and EAP-pwd spend most of their time in modular multiplications;
+     * use the MPI accelerator for them when the operands fit it. The hardware
+     * performs Montgomery multiplication, so the modulus must be odd (always
+     * the case for the DH and ECC primes used here) and the operands
+     * non-negative. Fall through to the software path otherwise. */
+    if (mbedtls_mpi_get_bit((const mbedtls_mpi *) c, 0) == 1 &&
+            mbedtls_mpi_bitlen((const mbedtls_mpi *) c) <= SOC_RSA_MAX_BIT_LEN &&
+            mbedtls_mpi_bitlen((const mbedtls_mpi *) a) <= SOC_RSA_MAX_BIT_LEN &&
+            mbedtls_mpi_bitlen((const mbedtls_mpi *) b) <= SOC_RSA_MAX_BIT_LEN &&
+            mbedtls_mpi_cmp_int((const mbedtls_mpi *) a, 0) > 0 &&
+            mbedtls_mpi_cmp_int((const mbedtls_mpi *) b, 0) > 0) {
+        if (esp_mpi_mul_mpi_mod((mbedtls_mpi *) d, (const mbedtls_mpi *) a,
+                                (const mbedtls_mpi *) b, (const mbedtls_mpi *) c) == 0) {
+            return 0;
+        }
+    }
+#endif /* CONFIG_MBEDTLS_HARDWARE_MPI */
     return mbedtls_mpi_mul_mpi((mbedtls_mpi *)d, (const mbedtls_mpi *)a, (const mbedtls_mpi *)b) ||
            mbedtls_mpi_mod_mpi((mbedtls_mpi *)d, (mbedtls_mpi *)d, (const mbedtls_mpi *)c) ? -1 : 0;
 }
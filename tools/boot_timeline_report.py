@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+#
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Parse the boot timeline printed by an application built with
+# CONFIG_ESP_SYSTEM_BOOT_TIMELINE (components/esp_system/boot_timeline.c)
+# and render a per-phase report with proportional bars. With --baseline,
+# compare against a previously saved report and fail when any phase (or the
+# total) regressed by more than the allowed margin — intended to be wired
+# into CI so boot-time regressions are caught per phase.
+#
+# Usage:
+#   idf.py monitor | tee boot.log
+#   boot_timeline_report.py boot.log
+#   boot_timeline_report.py boot.log --save baseline.json
+#   boot_timeline_report.py boot.log --baseline baseline.json --margin-pct 10
+
+import argparse
+import json
+import re
+import sys
+
+PHASE_REGEX = re.compile(r'boot_timeline: phase (\S+)\s+start\s+(\d+) us, took\s+(\d+) us')
+TOTAL_REGEX = re.compile(r'boot_timeline: total (\d+) us since power-on')
+
+BAR_WIDTH = 50
+
+
+def parse_log(stream):
+    phases = []  # list of (name, start_us, duration_us), in boot order
+    total_us = None
+    for line in stream:
+        match = PHASE_REGEX.search(line)
+        if match:
+            phases.append((match.group(1), int(match.group(2)), int(match.group(3))))
+            continue
+        match = TOTAL_REGEX.search(line)
+        if match:
+            total_us = int(match.group(1))
+    if not phases:
+        raise SystemExit('error: no boot_timeline lines found; '
+                         'is CONFIG_ESP_SYSTEM_BOOT_TIMELINE enabled?')
+    if total_us is None:
+        total_us = phases[-1][1] + phases[-1][2]
+    return phases, total_us
+
+
+def print_report(phases, total_us):
+    name_width = max(len(name) for name, _, _ in phases)
+    print('{:<{w}} {:>10} {:>10} {:>6}'.format('phase', 'start/us', 'dur/us', '%', w=name_width))
+    for name, start_us, duration_us in phases:
+        fraction = duration_us / total_us if total_us else 0
+        bar = '#' * max(1, round(fraction * BAR_WIDTH)) if duration_us else ''
+        print('{:<{w}} {:>10} {:>10} {:>5.1f}  {}'.format(
+            name, start_us, duration_us, fraction * 100, bar, w=name_width))
+    print('{:<{w}} {:>10} {:>10} {:>5.1f}'.format('total', 0, total_us, 100.0, w=name_width))
+
+
+def compare(phases, total_us, baseline, margin_pct):
+    failed = False
+    base_phases = {entry['name']: entry['duration_us'] for entry in baseline['phases']}
+    for name, _, duration_us in phases:
+        base = base_phases.get(name)
+        if base is None:
+            print('note: phase {} not present in baseline'.format(name))
+            continue
+        limit = base * (1 + margin_pct / 100)
+        if duration_us > limit:
+            print('FAIL: phase {} took {} us, baseline {} us (+{:.1f}%, margin {}%)'.format(
+                name, duration_us, base, (duration_us - base) * 100 / base if base else 0, margin_pct))
+            failed = True
+    base_total = baseline['total_us']
+    if total_us > base_total * (1 + margin_pct / 100):
+        print('FAIL: total boot time {} us, baseline {} us (margin {}%)'.format(
+            total_us, base_total, margin_pct))
+        failed = True
+    return failed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('log', help='log file to parse, or - for stdin')
+    parser.add_argument('--save', metavar='FILE', help='save the parsed timeline as a JSON baseline')
+    parser.add_argument('--baseline', metavar='FILE', help='JSON baseline to compare against')
+    parser.add_argument('--margin-pct', type=float, default=10.0,
+                        help='allowed per-phase regression in percent (default: 10)')
+    args = parser.parse_args()
+
+    if args.log == '-':
+        phases, total_us = parse_log(sys.stdin)
+    else:
+        with open(args.log) as log_file:
+            phases, total_us = parse_log(log_file)
+
+    print_report(phases, total_us)
+
+    if args.save:
+        with open(args.save, 'w') as out_file:
+            json.dump({'phases': [{'name': name, 'start_us': start_us, 'duration_us': duration_us}
+                                  for name, start_us, duration_us in phases],
+                       'total_us': total_us}, out_file, indent=2)
+            out_file.write('\n')
+
+    if args.baseline:
+        with open(args.baseline) as baseline_file:
+            baseline = json.load(baseline_file)
+        if compare(phases, total_us, baseline, args.margin_pct):
+            raise SystemExit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -829,6 +829,12 @@ macro(project project_name)
             # Print warnings if orphan sections are found
             target_link_options(${project_elf} PRIVATE "-Wl,--orphan-handling=warn")
         endif()
+        if(CONFIG_LOG_FORMAT_DEDUP)
+            # Upgrade the linker's mergeable-string handling to tail merging, so a
+            # string that is the suffix of another is folded into it. Bare log format
+            # strings (see LOG_FORMAT_DEDUP) are the main beneficiary.
+            target_link_options(${project_elf} PRIVATE "-Wl,-O2")
+        endif()
         unset(idf_target)
     endif()
 
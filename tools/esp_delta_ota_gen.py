@@ -0,0 +1,124 @@
+#!/usr/bin/env python
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+# SPDX-License-Identifier: Apache-2.0
+#
+# Generates a binary delta patch between two firmware images, in the "EDP1"
+# format consumed by esp_https_ota when CONFIG_ESP_HTTPS_OTA_DELTA is enabled.
+#
+# Patch stream layout (all integers little-endian):
+#   header:  magic "EDP1" (u32) | target_len (u32) | source_len (u32) | reserved (u32)
+#   ops:     0xC0 src_offset (u32) len (u32)    copy `len` bytes from the source image
+#            0xAD len (u32) followed by `len` literal bytes
+#
+# The device applies COPY operations against the running partition, so the
+# source image passed here must match the firmware currently on the device.
+
+import argparse
+import struct
+import sys
+
+MAGIC = b'EDP1'
+OP_COPY = 0xC0
+OP_ADD = 0xAD
+
+CHUNK = 16          # granularity of the source index
+MIN_COPY = 32       # matches shorter than this are cheaper as literals
+
+
+def build_index(source):  # type: (bytes) -> dict
+    index = {}
+    for off in range(0, len(source) - CHUNK + 1, CHUNK):
+        index.setdefault(source[off:off + CHUNK], []).append(off)
+    return index
+
+
+def extend_match(source, target, src_off, dst_off):  # type: (bytes, bytes, int, int) -> int
+    length = 0
+    while (src_off + length < len(source) and dst_off + length < len(target)
+           and source[src_off + length] == target[dst_off + length]):
+        length += 1
+    return length
+
+
+def generate(source, target):  # type: (bytes, bytes) -> bytes
+    index = build_index(source)
+    ops = [struct.pack('<4sIII', MAGIC, len(target), len(source), 0)]
+    literal = bytearray()
+    pos = 0
+    while pos < len(target):
+        best_len = 0
+        best_src = 0
+        for src_off in index.get(target[pos:pos + CHUNK], []):
+            length = extend_match(source, target, src_off, pos)
+            if length > best_len:
+                best_len = length
+                best_src = src_off
+        if best_len >= MIN_COPY:
+            if literal:
+                ops.append(struct.pack('<BI', OP_ADD, len(literal)) + bytes(literal))
+                literal = bytearray()
+            ops.append(struct.pack('<BII', OP_COPY, best_src, best_len))
+            pos += best_len
+        else:
+            literal.append(target[pos])
+            pos += 1
+    if literal:
+        ops.append(struct.pack('<BI', OP_ADD, len(literal)) + bytes(literal))
+    return b''.join(ops)
+
+
+def apply_patch(source, patch):  # type: (bytes, bytes) -> bytes
+    magic, target_len, source_len, _ = struct.unpack_from('<4sIII', patch, 0)
+    if magic != MAGIC:
+        raise ValueError('bad patch magic')
+    if source_len != len(source):
+        raise ValueError('patch source length mismatch')
+    out = bytearray()
+    pos = 16
+    while len(out) < target_len:
+        opcode = patch[pos]
+        pos += 1
+        if opcode == OP_COPY:
+            src_off, length = struct.unpack_from('<II', patch, pos)
+            pos += 8
+            out += source[src_off:src_off + length]
+        elif opcode == OP_ADD:
+            (length, ) = struct.unpack_from('<I', patch, pos)
+            pos += 4
+            out += patch[pos:pos + length]
+            pos += length
+        else:
+            raise ValueError('unknown opcode 0x%02x' % opcode)
+    if pos != len(patch):
+        raise ValueError('trailing data after the end of the patch')
+    return bytes(out)
+
+
+def main():  # type: () -> int
+    parser = argparse.ArgumentParser(description='Generate an EDP1 delta patch for esp_https_ota')
+    parser.add_argument('source', help='firmware image currently running on the device')
+    parser.add_argument('target', help='firmware image to update to')
+    parser.add_argument('patch', help='output patch file')
+    parser.add_argument('--verify', action='store_true',
+                        help='re-apply the generated patch and compare against the target image')
+    args = parser.parse_args()
+
+    with open(args.source, 'rb') as f:
+        source = f.read()
+    with open(args.target, 'rb') as f:
+        target = f.read()
+
+    patch = generate(source, target)
+    if args.verify and apply_patch(source, patch) != target:
+        print('Verification failed: applying the patch does not reproduce the target image', file=sys.stderr)
+        return 1
+
+    with open(args.patch, 'wb') as f:
+        f.write(patch)
+    print('Wrote %s: %d bytes (target %d bytes, %.1f%%)'
+          % (args.patch, len(patch), len(target), 100.0 * len(patch) / len(target) if target else 0.0))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
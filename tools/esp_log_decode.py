@@ -0,0 +1,143 @@
+#!/usr/bin/env python
+#
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Decode a binary log stream produced by the deferred binary logging backend
+# (esp_log_binary_init, components/log/src/binary/log_binary.c).
+#
+# Stream format, all values little-endian:
+#
+#   frame     := 0xA5 <payload_len u8> <format_addr u32> <args...>
+#   int arg   := 4 bytes (8 bytes for "ll", "j" and floating point arguments)
+#   str arg   := <len u8> <bytes...>  ("%s", truncated to 255 bytes)
+#
+# A frame with format_addr == 0 is a drop marker whose payload is a u32 count
+# of lost records. Format strings are resolved to text by reading them from
+# the application ELF file at the recorded address.
+#
+# Usage:
+#   esp_log_decode.py app.elf capture.bin
+#   idf.py monitor ... | esp_log_decode.py app.elf -
+
+import argparse
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+FRAME_SYNC = 0xA5
+
+# conversion specification, mirroring what the target-side encoder accepts
+SPEC_RE = re.compile(r'%[-+ #0]*(\*|\d+)?(\.(\*|\d+))?(ll|l|hh|h|z|t|j)?([%diuxXocfFeEgGaAps])')
+
+
+def load_strings(elf_path):
+    """Return a list of (start_addr, data) tuples for allocated ELF sections."""
+    sections = []
+    with open(elf_path, 'rb') as f:
+        elf = ELFFile(f)
+        for section in elf.iter_sections():
+            if section['sh_flags'] & 0x2 and section['sh_type'] != 'SHT_NOBITS':  # SHF_ALLOC
+                sections.append((section['sh_addr'], section.data()))
+    return sections
+
+
+def string_at(sections, addr):
+    for start, data in sections:
+        if start <= addr < start + len(data):
+            end = data.find(b'\0', addr - start)
+            if end == -1:
+                end = len(data)
+            return data[addr - start:end].decode('utf-8', errors='replace')
+    return None
+
+
+def decode_frame(fmt, payload):
+    """Format one record. Returns the formatted line."""
+    args = []
+    pos = 0
+    for m in SPEC_RE.finditer(fmt):
+        width, _, precision, length, conv = m.groups()
+        if conv == '%':
+            continue
+        for star in (width, precision):
+            if star == '*':
+                args.append(struct.unpack_from('<i', payload, pos)[0])
+                pos += 4
+        if conv in 'fFeEgGaA':
+            args.append(struct.unpack_from('<d', payload, pos)[0])
+            pos += 8
+        elif conv == 's':
+            slen = payload[pos]
+            args.append(payload[pos + 1:pos + 1 + slen].decode('utf-8', errors='replace'))
+            pos += 1 + slen
+        elif conv == 'c':
+            args.append(chr(struct.unpack_from('<I', payload, pos)[0] & 0xFF))
+            pos += 4
+        else:
+            size = 8 if length in ('ll', 'j') else 4
+            signed = conv in 'di'
+            args.append(int.from_bytes(payload[pos:pos + size], 'little', signed=signed))
+            pos += size
+    # python's % does not know the C length modifiers; strip them
+    py_fmt = SPEC_RE.sub(lambda m: '%' + (m.group(1) or '') + (m.group(2) or '') + m.group(5), fmt)
+    py_fmt = py_fmt.replace('%i', '%d')
+    try:
+        return py_fmt % tuple(args)
+    except (TypeError, ValueError) as e:
+        return '[decode error: {} fmt={!r} args={!r}]'.format(e, fmt, args)
+
+
+def decode_stream(stream, sections, out):
+    buf = b''
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            break
+        buf += chunk
+        while True:
+            sync = buf.find(bytes([FRAME_SYNC]))
+            if sync == -1:
+                buf = b''
+                break
+            buf = buf[sync:]
+            if len(buf) < 2 or len(buf) < 2 + buf[1]:
+                break  # incomplete frame, wait for more data
+            payload_len = buf[1]
+            payload = buf[2:2 + payload_len]
+            buf = buf[2 + payload_len:]
+            addr = struct.unpack_from('<I', payload)[0]
+            if addr == 0:
+                dropped = struct.unpack_from('<I', payload, 4)[0]
+                out.write('[{} records dropped]\n'.format(dropped))
+                continue
+            fmt = string_at(sections, addr)
+            if fmt is None:
+                out.write('[unknown format string at 0x{:08x}]\n'.format(addr))
+                continue
+            line = decode_frame(fmt, payload[4:])
+            out.write(line)
+            if not line.endswith('\n'):
+                out.write('\n')
+    out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode a binary log stream using the application ELF file')
+    parser.add_argument('elf', help='application ELF file')
+    parser.add_argument('capture', help='captured binary log stream, or - for stdin')
+    args = parser.parse_args()
+
+    sections = load_strings(args.elf)
+    if args.capture == '-':
+        decode_stream(sys.stdin.buffer, sections, sys.stdout)
+    else:
+        with open(args.capture, 'rb') as f:
+            decode_stream(f, sections, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
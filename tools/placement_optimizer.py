@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+# SPDX-License-Identifier: Apache-2.0
+#
+# Convert a PC-sampling profile (CONFIG_ESP_SYSTEM_PC_SAMPLING, see
+# esp_pc_sample_dump()) into linker.lf placement fragments, so code placement
+# follows measured heat instead of hand-maintained IRAM_ATTR guesses.
+#
+# The tool attributes every sampled program counter to a function using the
+# application's GNU ld map file, ranks functions that currently run from
+# flash, and emits:
+#   - a "hot" mapping that promotes the top functions to IRAM with (noflash)
+#     entries, up to --iram-budget bytes, and
+#   - optionally a "warm" mapping that lists the next tier explicitly, which
+#     groups those functions next to each other in flash for cache locality.
+#
+# Apply the generated fragment by listing it in a component's LDFRAGMENTS,
+# e.g. in the project's main component:
+#     idf_component_register(... LDFRAGMENTS "hot_placement.lf")
+#
+# Typical flow:
+#   1. enable CONFIG_ESP_SYSTEM_PC_SAMPLING, run the workload in the field,
+#      save the esp_pc_sample_dump() output to samples.txt
+#   2. placement_optimizer.py --map build/app.map --samples samples.txt \
+#         --iram-budget 16384 --output main/hot_placement.lf
+#   3. rebuild; repeat as the profile changes
+
+import argparse
+import bisect
+import re
+import sys
+from collections import defaultdict
+
+SAMPLE_REGEX = re.compile(r'pc_sample: (0x[0-9a-fA-F]+) (\d+)')
+DROPPED_REGEX = re.compile(r'pc_sample_dropped: (\d+)')
+
+# output section header at column 0, e.g. ".flash.text  0x42000020  0x1234"
+OUT_SECTION_REGEX = re.compile(r'^(\.[^\s]+)')
+# input section with the location on the same line
+IN_SECTION_REGEX = re.compile(
+    r'^ (\.[^\s]+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+\.a)\((\S+)\)\s*$')
+# location of an input section whose name was too long and wrapped
+IN_CONT_REGEX = re.compile(
+    r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+\.a)\((\S+)\)\s*$')
+
+
+class Function(object):
+    def __init__(self, symbol, start, size, archive, obj, out_section):
+        self.symbol = symbol
+        self.start = start
+        self.size = size
+        self.archive = archive
+        self.obj = obj
+        self.out_section = out_section
+        self.samples = 0
+
+    @property
+    def in_iram(self):
+        return 'iram' in self.out_section
+
+    @property
+    def lf_entry(self):
+        obj = self.obj
+        for suffix in ('.c.obj', '.cpp.obj', '.S.obj', '.obj', '.o'):
+            if obj.endswith(suffix):
+                obj = obj[:-len(suffix)]
+                break
+        return '{}: {}'.format(obj, self.symbol)
+
+
+def parse_map(path):
+    functions = []
+    out_section = ''
+    pending = None  # input section name waiting for its wrapped location line
+    with open(path) as f:
+        for line in f:
+            if line and not line[0].isspace():
+                m = OUT_SECTION_REGEX.match(line)
+                if m:
+                    out_section = m.group(1)
+                pending = None
+                continue
+            m = IN_SECTION_REGEX.match(line)
+            if m:
+                pending = None
+                name, start, size, archive, obj = m.groups()
+                if name.startswith('.text.'):
+                    functions.append(Function(name[len('.text.'):], int(start, 16),
+                                              int(size, 16), archive, obj, out_section))
+                continue
+            if line.startswith(' .'):
+                pending = line.strip()
+                continue
+            if pending is not None:
+                m = IN_CONT_REGEX.match(line)
+                if m and pending.startswith('.text.'):
+                    start, size, archive, obj = m.groups()
+                    functions.append(Function(pending[len('.text.'):], int(start, 16),
+                                              int(size, 16), archive, obj, out_section))
+                pending = None
+    functions.sort(key=lambda fn: fn.start)
+    return functions
+
+
+def parse_samples(paths):
+    histogram = defaultdict(int)
+    dropped = 0
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                m = SAMPLE_REGEX.search(line)
+                if m:
+                    histogram[int(m.group(1), 16)] += int(m.group(2))
+                    continue
+                m = DROPPED_REGEX.search(line)
+                if m:
+                    dropped += int(m.group(1))
+    return histogram, dropped
+
+
+def attribute_samples(functions, histogram):
+    starts = [fn.start for fn in functions]
+    unattributed = 0
+    for pc, count in histogram.items():
+        i = bisect.bisect_right(starts, pc) - 1
+        if i >= 0 and pc < functions[i].start + functions[i].size:
+            functions[i].samples += count
+        else:
+            unattributed += count
+    return unattributed
+
+
+def mapping_name(prefix, archive):
+    base = archive.rsplit('/', 1)[-1]
+    if base.startswith('lib'):
+        base = base[3:]
+    if base.endswith('.a'):
+        base = base[:-2]
+    return '{}_{}'.format(prefix, re.sub(r'[^0-9a-zA-Z_]', '_', base))
+
+
+def emit_mappings(out, prefix, functions, scheme):
+    by_archive = defaultdict(list)
+    for fn in functions:
+        by_archive[fn.archive].append(fn)
+    for archive in sorted(by_archive):
+        out.write('\n[mapping:{}]\n'.format(mapping_name(prefix, archive)))
+        out.write('archive: {}\n'.format(archive.rsplit('/', 1)[-1]))
+        out.write('entries:\n')
+        for fn in sorted(by_archive[archive], key=lambda fn: -fn.samples):
+            out.write('    {} ({})   # {} samples, {} bytes\n'.format(fn.lf_entry, scheme,
+                                                                      fn.samples, fn.size))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generate linker.lf placement fragments from a PC-sampling profile')
+    parser.add_argument('--map', required=True, help='GNU ld map file of the profiled build')
+    parser.add_argument('--samples', required=True, nargs='+',
+                        help='file(s) with esp_pc_sample_dump() output')
+    parser.add_argument('--iram-budget', type=int, default=16384,
+                        help='bytes of IRAM to spend on promoted functions (default: 16384)')
+    parser.add_argument('--min-samples', type=int, default=2,
+                        help='ignore functions with fewer samples (default: 2)')
+    parser.add_argument('--cluster-warm', type=int, default=0, metavar='N',
+                        help='also emit a mapping clustering the next N hot flash functions')
+    parser.add_argument('--exclude', action='append', default=[], metavar='REGEX',
+                        help='never place functions matching this symbol regex')
+    parser.add_argument('--output', default='hot_placement.lf', help='fragment file to write')
+    args = parser.parse_args()
+
+    functions = parse_map(args.map)
+    if not functions:
+        print('error: no .text.* input sections found in {}'.format(args.map), file=sys.stderr)
+        return 1
+    histogram, dropped = parse_samples(args.samples)
+    if not histogram:
+        print('error: no pc_sample lines found', file=sys.stderr)
+        return 1
+    total = sum(histogram.values())
+    unattributed = attribute_samples(functions, histogram)
+
+    exclude = [re.compile(pattern) for pattern in args.exclude]
+    candidates = [fn for fn in functions
+                  if fn.samples >= args.min_samples and not fn.in_iram
+                  and not any(pattern.search(fn.symbol) for pattern in exclude)]
+    candidates.sort(key=lambda fn: -fn.samples)
+
+    hot = []
+    spent = 0
+    for fn in candidates:
+        if spent + fn.size <= args.iram_budget:
+            hot.append(fn)
+            spent += fn.size
+    warm = [fn for fn in candidates if fn not in hot][:args.cluster_warm]
+
+    covered = sum(fn.samples for fn in hot)
+    iram_samples = sum(fn.samples for fn in functions if fn.in_iram)
+    with open(args.output, 'w') as out:
+        out.write('# Generated by tools/placement_optimizer.py -- do not edit by hand\n')
+        out.write('# profile: {} samples ({} dropped, {} unattributed)\n'.format(
+            total, dropped, unattributed))
+        out.write('# promoting {} functions, {} bytes of IRAM, covering {:.1f}% of flash samples\n'
+                  .format(len(hot), spent, 100.0 * covered / max(total - iram_samples, 1)))
+        emit_mappings(out, 'prof_hot', hot, 'noflash')
+        if warm:
+            emit_mappings(out, 'prof_warm', warm, 'default')
+
+    print('{} samples total, {} already in IRAM, {} unattributed'.format(
+        total, iram_samples, unattributed))
+    print('promoted {} functions ({} bytes) covering {} samples -> {}'.format(
+        len(hot), spent, covered, args.output))
+    if warm:
+        print('clustered {} warm functions in flash'.format(len(warm)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+# SPDX-License-Identifier: Apache-2.0
+#
+# Host-side driver for the network_bench target app.
+#
+# Connects to the device's control port, runs every benchmark --runs times,
+# reports mean / standard deviation / coefficient of variation per metric and
+# writes a machine-readable JSON report. With --baseline it compares against a
+# previous report and exits non-zero when a metric regressed by more than
+# --threshold percent, so a CI job can gate an IDF upgrade on it:
+#
+#   net_bench_host.py --device 192.168.1.42 --runs 5 --output candidate.json \
+#       --baseline release.json --threshold 10
+
+import argparse
+import http.client
+import json
+import os
+import socket
+import ssl
+import statistics
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+CONTROL_PORT = 5199
+DATA_PORT = 5201
+HTTP_PORT = 80
+CHUNK = b'\x00' * 65536
+
+# test name -> (metric key reported by the device, higher is better)
+DEVICE_TESTS = {
+    'tcp_tx': ('mbps', True),
+    'tcp_rx': ('mbps', True),
+    'udp_tx': ('mbps', True),
+    'udp_rx': ('mbps', True),
+    'tls_tx': ('mbps', True),
+    'conn_lat': ('mean_us', False),
+}
+
+
+class PeerServer(threading.Thread):
+    """One-shot data-plane peer: sink, source, UDP reflector or TLS sink."""
+
+    def __init__(self, mode, seconds, tls_context=None):
+        super().__init__(daemon=True)
+        self.mode = mode
+        self.seconds = seconds
+        self.tls_context = tls_context
+        if mode.startswith('udp'):
+            self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+            self.sock.bind(('', 0))
+        else:
+            self.sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+            self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+            self.sock.bind(('', 0))
+            self.sock.listen(8)
+        self.port = self.sock.getsockname()[1]
+
+    def run(self):
+        try:
+            if self.mode == 'udp_sink':
+                self.sock.settimeout(self.seconds + 10)
+                deadline = time.time() + self.seconds + 5
+                while time.time() < deadline:
+                    try:
+                        self.sock.recvfrom(65536)
+                    except socket.timeout:
+                        break
+            elif self.mode == 'udp_source':
+                # wait for the device's hello, then blast back for the duration
+                self.sock.settimeout(10)
+                _, peer = self.sock.recvfrom(1024)
+                payload = b'\x00' * 1460
+                deadline = time.time() + self.seconds
+                while time.time() < deadline:
+                    self.sock.sendto(payload, peer)
+            elif self.mode == 'accept_only':
+                self.sock.settimeout(self.seconds + 30)
+                while True:
+                    conn, _ = self.sock.accept()
+                    conn.close()
+            else:
+                self.sock.settimeout(30)
+                conn, _ = self.sock.accept()
+                if self.mode == 'tls_sink':
+                    conn = self.tls_context.wrap_socket(conn, server_side=True)
+                conn.settimeout(self.seconds + 30)
+                if self.mode in ('tcp_sink', 'tls_sink'):
+                    while conn.recv(65536):
+                        pass
+                elif self.mode == 'tcp_source':
+                    deadline = time.time() + self.seconds
+                    while time.time() < deadline:
+                        conn.send(CHUNK)
+                conn.close()
+        except (OSError, ssl.SSLError):
+            pass
+        finally:
+            self.sock.close()
+
+
+def make_tls_context():
+    """Self-signed throwaway certificate; the device skips verification."""
+    tmpdir = tempfile.mkdtemp(prefix='net_bench_')
+    cert = os.path.join(tmpdir, 'cert.pem')
+    key = os.path.join(tmpdir, 'key.pem')
+    subprocess.run(['openssl', 'req', '-x509', '-newkey', 'rsa:2048', '-nodes',
+                    '-keyout', key, '-out', cert, '-days', '1', '-subj', '/CN=net_bench'],
+                   check=True, capture_output=True)
+    ctx = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    ctx.load_cert_chain(cert, key)
+    return ctx
+
+
+def run_device_test(control, test, seconds, tls_context):
+    mode = {
+        'tcp_tx': 'tcp_sink',
+        'tcp_rx': 'tcp_source',
+        'udp_tx': 'udp_sink',
+        'udp_rx': 'udp_source',
+        'tls_tx': 'tls_sink',
+        'conn_lat': 'accept_only',
+    }[test]
+    server = PeerServer(mode, seconds, tls_context if mode == 'tls_sink' else None)
+    server.start()
+    arg = 50 if test == 'conn_lat' else seconds
+    control.sendall('{} {} {}\n'.format(test, server.port, arg).encode())
+    line = b''
+    while not line.endswith(b'\n'):
+        data = control.recv(1024)
+        if not data:
+            raise RuntimeError('device closed the control connection')
+        line += data
+    result = json.loads(line.decode())
+    if 'error' in result:
+        raise RuntimeError('{}: {}'.format(test, result['error']))
+    return result
+
+
+def run_http_test(device, seconds):
+    """Sequential request rate over a persistent connection."""
+    conn = http.client.HTTPConnection(device, HTTP_PORT, timeout=10)
+    requests = 0
+    start = time.time()
+    deadline = start + seconds
+    while time.time() < deadline:
+        conn.request('GET', '/bench')
+        resp = conn.getresponse()
+        resp.read()
+        if resp.status != 200:
+            raise RuntimeError('http status {}'.format(resp.status))
+        requests += 1
+    elapsed = time.time() - start
+    conn.close()
+    return {'test': 'http_rps', 'requests': requests, 'rps': requests / elapsed}
+
+
+def summarize(samples):
+    mean = statistics.mean(samples)
+    stddev = statistics.stdev(samples) if len(samples) > 1 else 0.0
+    return {
+        'samples': samples,
+        'mean': mean,
+        'stddev': stddev,
+        'cv_percent': 100.0 * stddev / mean if mean else 0.0,
+    }
+
+
+def compare(report, baseline, threshold):
+    regressions = []
+    for test, summary in report['results'].items():
+        base = baseline.get('results', {}).get(test)
+        if base is None:
+            continue
+        higher_better = DEVICE_TESTS.get(test, ('rps', True))[1]
+        delta = 100.0 * (summary['mean'] - base['mean']) / base['mean']
+        regressed = delta < -threshold if higher_better else delta > threshold
+        print('{:10s} {:10.2f} -> {:10.2f} ({:+.1f}%){}'.format(
+            test, base['mean'], summary['mean'], delta, '  REGRESSION' if regressed else ''))
+        if regressed:
+            regressions.append(test)
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Drive the network_bench target app')
+    parser.add_argument('--device', required=True, help='IP address printed as net_bench_ready')
+    parser.add_argument('--runs', type=int, default=5, help='reruns per benchmark (default: 5)')
+    parser.add_argument('--seconds', type=int, default=5, help='duration of one run (default: 5)')
+    parser.add_argument('--tests', nargs='+',
+                        default=list(DEVICE_TESTS) + ['http_rps'], help='subset of tests to run')
+    parser.add_argument('--output', default='net_bench_report.json', help='JSON report to write')
+    parser.add_argument('--baseline', help='previous report to compare against')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='regression threshold in percent (default: 10)')
+    args = parser.parse_args()
+
+    tls_context = make_tls_context() if 'tls_tx' in args.tests else None
+    control = socket.create_connection((args.device, CONTROL_PORT), timeout=120)
+
+    report = {'device': args.device, 'runs': args.runs, 'seconds': args.seconds, 'results': {}}
+    for test in args.tests:
+        samples = []
+        for run in range(args.runs):
+            if test == 'http_rps':
+                result = run_http_test(args.device, args.seconds)
+                metric = 'rps'
+            else:
+                result = run_device_test(control, test, args.seconds, tls_context)
+                metric = DEVICE_TESTS[test][0]
+            samples.append(result[metric])
+            print('{} run {}/{}: {} = {:.2f}'.format(test, run + 1, args.runs, metric, result[metric]))
+        report['results'][test] = summarize(samples)
+    control.close()
+
+    with open(args.output, 'w') as f:
+        json.dump(report, f, indent=2)
+    print('report written to', args.output)
+
+    for test, summary in report['results'].items():
+        print('{:10s} mean={:10.2f} stddev={:8.2f} cv={:5.1f}%'.format(
+            test, summary['mean'], summary['stddev'], summary['cv_percent']))
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare(report, baseline, args.threshold)
+        if regressions:
+            print('regressed: {}'.format(', '.join(regressions)), file=sys.stderr)
+            return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
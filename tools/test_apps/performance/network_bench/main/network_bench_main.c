@@ -0,0 +1,353 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Network benchmark target.
+ *
+ * Connects to the network (protocol_examples_common), starts an HTTP server
+ * and then accepts a single control connection on TCP port 5199 from
+ * host/net_bench_host.py. The host drives one benchmark at a time with a
+ * one-line command; the device answers with exactly one JSON line:
+ *
+ *   tcp_tx <port> <seconds>     connect to the controller, send as fast as possible
+ *   tcp_rx <port> <seconds>     connect to the controller, drain until EOF
+ *   udp_tx <port> <seconds>     blast datagrams at the controller
+ *   udp_rx <port> <seconds>     send one hello datagram, count what comes back
+ *   conn_lat <port> <count>     repeated TCP connect/close, latency statistics
+ *   tls_tx <port> <seconds>     TLS handshake + bulk send to the controller
+ *
+ * The HTTP request-rate test needs no command: the host hammers GET /bench
+ * directly. All statistics over reruns are computed on the host.
+ */
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <inttypes.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_tls.h"
+#include "esp_http_server.h"
+#include "nvs_flash.h"
+#include "esp_event.h"
+#include "esp_netif.h"
+#include "protocol_examples_common.h"
+
+#define CONTROL_PORT        5199
+#define TCP_CHUNK_SIZE      (16 * 1024)
+#define UDP_PAYLOAD_SIZE    1460
+#define UDP_RX_IDLE_MS      500
+
+static const char *TAG = "net_bench";
+
+static char s_chunk[TCP_CHUNK_SIZE];
+
+static int s_connect_to_peer(const struct sockaddr_in *peer, uint16_t port, int type)
+{
+    struct sockaddr_in addr = *peer;
+    addr.sin_port = htons(port);
+    int sock = socket(AF_INET, type, type == SOCK_STREAM ? IPPROTO_TCP : IPPROTO_UDP);
+    if (sock < 0) {
+        return -1;
+    }
+    if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+static void s_bench_tcp_tx(const struct sockaddr_in *peer, uint16_t port, int seconds, char *out, size_t out_size)
+{
+    int sock = s_connect_to_peer(peer, port, SOCK_STREAM);
+    if (sock < 0) {
+        snprintf(out, out_size, "{\"test\":\"tcp_tx\",\"error\":\"connect failed\"}");
+        return;
+    }
+    int64_t start = esp_timer_get_time();
+    int64_t deadline = start + (int64_t)seconds * 1000000;
+    uint64_t total = 0;
+    while (esp_timer_get_time() < deadline) {
+        int sent = send(sock, s_chunk, sizeof(s_chunk), 0);
+        if (sent <= 0) {
+            break;
+        }
+        total += sent;
+    }
+    int64_t us = esp_timer_get_time() - start;
+    close(sock);
+    snprintf(out, out_size, "{\"test\":\"tcp_tx\",\"bytes\":%llu,\"us\":%lld,\"mbps\":%.2f}",
+             (unsigned long long)total, (long long)us, total * 8.0 / us);
+}
+
+static void s_bench_tcp_rx(const struct sockaddr_in *peer, uint16_t port, int seconds, char *out, size_t out_size)
+{
+    (void)seconds;  // the host decides how long to send, the device drains until EOF
+    int sock = s_connect_to_peer(peer, port, SOCK_STREAM);
+    if (sock < 0) {
+        snprintf(out, out_size, "{\"test\":\"tcp_rx\",\"error\":\"connect failed\"}");
+        return;
+    }
+    int64_t start = esp_timer_get_time();
+    uint64_t total = 0;
+    int received;
+    while ((received = recv(sock, s_chunk, sizeof(s_chunk), 0)) > 0) {
+        total += received;
+    }
+    int64_t us = esp_timer_get_time() - start;
+    close(sock);
+    snprintf(out, out_size, "{\"test\":\"tcp_rx\",\"bytes\":%llu,\"us\":%lld,\"mbps\":%.2f}",
+             (unsigned long long)total, (long long)us, total * 8.0 / us);
+}
+
+static void s_bench_udp_tx(const struct sockaddr_in *peer, uint16_t port, int seconds, char *out, size_t out_size)
+{
+    int sock = s_connect_to_peer(peer, port, SOCK_DGRAM);
+    if (sock < 0) {
+        snprintf(out, out_size, "{\"test\":\"udp_tx\",\"error\":\"socket failed\"}");
+        return;
+    }
+    int64_t start = esp_timer_get_time();
+    int64_t deadline = start + (int64_t)seconds * 1000000;
+    uint64_t total = 0;
+    while (esp_timer_get_time() < deadline) {
+        int sent = send(sock, s_chunk, UDP_PAYLOAD_SIZE, 0);
+        if (sent > 0) {
+            total += sent;
+        } else {
+            // out of lwip buffers, give the stack a chance to drain
+            vTaskDelay(1);
+        }
+    }
+    int64_t us = esp_timer_get_time() - start;
+    close(sock);
+    snprintf(out, out_size, "{\"test\":\"udp_tx\",\"bytes\":%llu,\"us\":%lld,\"mbps\":%.2f}",
+             (unsigned long long)total, (long long)us, total * 8.0 / us);
+}
+
+static void s_bench_udp_rx(const struct sockaddr_in *peer, uint16_t port, int seconds, char *out, size_t out_size)
+{
+    (void)seconds;
+    int sock = s_connect_to_peer(peer, port, SOCK_DGRAM);
+    if (sock < 0) {
+        snprintf(out, out_size, "{\"test\":\"udp_rx\",\"error\":\"socket failed\"}");
+        return;
+    }
+    // tell the host where to aim, then count until the stream goes quiet
+    send(sock, "hello", 5, 0);
+    struct timeval tv = { .tv_sec = 0, .tv_usec = UDP_RX_IDLE_MS * 1000 };
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    uint64_t total = 0;
+    uint32_t datagrams = 0;
+    int64_t start = 0;
+    int64_t last = 0;
+    int received;
+    while ((received = recv(sock, s_chunk, sizeof(s_chunk), 0)) > 0) {
+        last = esp_timer_get_time();
+        if (start == 0) {
+            start = last;
+        }
+        total += received;
+        datagrams++;
+    }
+    close(sock);
+    int64_t us = (start && last > start) ? last - start : 1;
+    snprintf(out, out_size, "{\"test\":\"udp_rx\",\"bytes\":%llu,\"us\":%lld,\"datagrams\":%" PRIu32 ",\"mbps\":%.2f}",
+             (unsigned long long)total, (long long)us, datagrams, total * 8.0 / us);
+}
+
+static void s_bench_conn_lat(const struct sockaddr_in *peer, uint16_t port, int count, char *out, size_t out_size)
+{
+    int64_t min_us = INT64_MAX;
+    int64_t max_us = 0;
+    double sum = 0;
+    double sum_sq = 0;
+    int ok = 0;
+    for (int i = 0; i < count; i++) {
+        int64_t start = esp_timer_get_time();
+        int sock = s_connect_to_peer(peer, port, SOCK_STREAM);
+        int64_t us = esp_timer_get_time() - start;
+        if (sock < 0) {
+            continue;
+        }
+        close(sock);
+        ok++;
+        sum += us;
+        sum_sq += (double)us * us;
+        min_us = us < min_us ? us : min_us;
+        max_us = us > max_us ? us : max_us;
+    }
+    if (ok == 0) {
+        snprintf(out, out_size, "{\"test\":\"conn_lat\",\"error\":\"all connects failed\"}");
+        return;
+    }
+    double mean = sum / ok;
+    double var = sum_sq / ok - mean * mean;
+    snprintf(out, out_size,
+             "{\"test\":\"conn_lat\",\"count\":%d,\"mean_us\":%.1f,\"stddev_us\":%.1f,\"min_us\":%lld,\"max_us\":%lld}",
+             ok, mean, var > 0 ? sqrt(var) : 0.0, (long long)min_us, (long long)max_us);
+}
+
+static void s_bench_tls_tx(const char *peer_ip, uint16_t port, int seconds, char *out, size_t out_size)
+{
+    esp_tls_cfg_t cfg = {
+        .skip_common_name = true,
+        .timeout_ms = 10000,
+    };
+    esp_tls_t *tls = esp_tls_init();
+    if (!tls) {
+        snprintf(out, out_size, "{\"test\":\"tls_tx\",\"error\":\"esp_tls_init failed\"}");
+        return;
+    }
+    int64_t handshake_start = esp_timer_get_time();
+    if (esp_tls_conn_new_sync(peer_ip, strlen(peer_ip), port, &cfg, tls) != 1) {
+        esp_tls_conn_destroy(tls);
+        snprintf(out, out_size, "{\"test\":\"tls_tx\",\"error\":\"handshake failed\"}");
+        return;
+    }
+    int64_t handshake_us = esp_timer_get_time() - handshake_start;
+
+    int64_t start = esp_timer_get_time();
+    int64_t deadline = start + (int64_t)seconds * 1000000;
+    uint64_t total = 0;
+    while (esp_timer_get_time() < deadline) {
+        ssize_t sent = esp_tls_conn_write(tls, s_chunk, sizeof(s_chunk));
+        if (sent <= 0) {
+            break;
+        }
+        total += sent;
+    }
+    int64_t us = esp_timer_get_time() - start;
+    esp_tls_conn_destroy(tls);
+    snprintf(out, out_size,
+             "{\"test\":\"tls_tx\",\"bytes\":%llu,\"us\":%lld,\"mbps\":%.2f,\"handshake_us\":%lld}",
+             (unsigned long long)total, (long long)us, total * 8.0 / us, (long long)handshake_us);
+}
+
+static esp_err_t s_http_bench_handler(httpd_req_t *req)
+{
+    // small fixed response: the test measures request handling rate, not body throughput
+    return httpd_resp_send(req, "net_bench ok", HTTPD_RESP_USE_STRLEN);
+}
+
+static void s_start_http_server(void)
+{
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.lru_purge_enable = true;
+    config.max_open_sockets = 7;
+    httpd_handle_t server = NULL;
+    ESP_ERROR_CHECK(httpd_start(&server, &config));
+    const httpd_uri_t bench_uri = {
+        .uri = "/bench",
+        .method = HTTP_GET,
+        .handler = s_http_bench_handler,
+    };
+    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &bench_uri));
+}
+
+// Reads a \n-terminated command, returns false when the peer hung up
+static bool s_read_line(int sock, char *line, size_t size)
+{
+    size_t len = 0;
+    while (len + 1 < size) {
+        char c;
+        int received = recv(sock, &c, 1, 0);
+        if (received <= 0) {
+            return false;
+        }
+        if (c == '\n') {
+            break;
+        }
+        line[len++] = c;
+    }
+    line[len] = '\0';
+    return true;
+}
+
+static void s_control_loop(void)
+{
+    int listen_sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    assert(listen_sock >= 0);
+    int opt = 1;
+    setsockopt(listen_sock, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+        .sin_port = htons(CONTROL_PORT),
+    };
+    assert(bind(listen_sock, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+    assert(listen(listen_sock, 1) == 0);
+    ESP_LOGI(TAG, "control server listening on port %d", CONTROL_PORT);
+
+    while (true) {
+        struct sockaddr_in peer;
+        socklen_t peer_len = sizeof(peer);
+        int sock = accept(listen_sock, (struct sockaddr *)&peer, &peer_len);
+        if (sock < 0) {
+            continue;
+        }
+        char peer_ip[INET_ADDRSTRLEN];
+        inet_ntop(AF_INET, &peer.sin_addr, peer_ip, sizeof(peer_ip));
+        ESP_LOGI(TAG, "controller connected from %s", peer_ip);
+
+        char line[64];
+        static char result[256];
+        while (s_read_line(sock, line, sizeof(line))) {
+            char cmd[16];
+            int port = 0;
+            int arg = 0;
+            if (sscanf(line, "%15s %d %d", cmd, &port, &arg) != 3) {
+                snprintf(result, sizeof(result), "{\"error\":\"bad command\"}");
+            } else if (strcmp(cmd, "tcp_tx") == 0) {
+                s_bench_tcp_tx(&peer, port, arg, result, sizeof(result));
+            } else if (strcmp(cmd, "tcp_rx") == 0) {
+                s_bench_tcp_rx(&peer, port, arg, result, sizeof(result));
+            } else if (strcmp(cmd, "udp_tx") == 0) {
+                s_bench_udp_tx(&peer, port, arg, result, sizeof(result));
+            } else if (strcmp(cmd, "udp_rx") == 0) {
+                s_bench_udp_rx(&peer, port, arg, result, sizeof(result));
+            } else if (strcmp(cmd, "conn_lat") == 0) {
+                s_bench_conn_lat(&peer, port, arg, result, sizeof(result));
+            } else if (strcmp(cmd, "tls_tx") == 0) {
+                s_bench_tls_tx(peer_ip, port, arg, result, sizeof(result));
+            } else {
+                snprintf(result, sizeof(result), "{\"error\":\"unknown command\"}");
+            }
+            strlcat(result, "\n", sizeof(result));
+            send(sock, result, strlen(result), 0);
+            printf("net_bench: %s", result);
+        }
+        close(sock);
+        ESP_LOGI(TAG, "controller disconnected");
+    }
+}
+
+void app_main(void)
+{
+    ESP_ERROR_CHECK(nvs_flash_init());
+    ESP_ERROR_CHECK(esp_netif_init());
+    ESP_ERROR_CHECK(esp_event_loop_create_default());
+    ESP_ERROR_CHECK(example_connect());
+
+    for (size_t i = 0; i < sizeof(s_chunk); i++) {
+        s_chunk[i] = (char)(i & 0xFF);
+    }
+
+    s_start_http_server();
+
+    esp_netif_ip_info_t ip_info;
+    ESP_ERROR_CHECK(esp_netif_get_ip_info(get_example_netif(), &ip_info));
+    printf("net_bench_ready: " IPSTR "\n", IP2STR(&ip_info.ip));
+
+    s_control_loop();
+}
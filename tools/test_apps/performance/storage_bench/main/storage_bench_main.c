@@ -0,0 +1,382 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * fio-style storage workload generator.
+ *
+ * Runs a fixed workload matrix (sequential/random, read/write/mixed, block
+ * size sweep) against raw esp_partition I/O, FatFS on wear levelling, SPIFFS
+ * and NVS, and prints one JSON line per workload with throughput and latency
+ * percentiles:
+ *
+ *   storage_bench: {"backend":"fat","workload":"seq_write","bs":4096,...}
+ *
+ * Per-operation latencies are recorded and sorted, so p50/p95/p99/max expose
+ * erase stalls and FS metadata cliffs that an average would hide. Queue depth
+ * is fixed at 1 (synchronous VFS); the workload loop is written so a queue
+ * depth parameter can be added when asynchronous file I/O becomes available.
+ */
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "esp_partition.h"
+#include "esp_vfs_fat.h"
+#include "esp_spiffs.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+#include "wear_levelling.h"
+
+static const char *TAG = "storage_bench";
+
+#define FILE_SIZE           (128 * 1024)    // working set per file-based workload
+#define RAW_REGION_SIZE     (192 * 1024)    // working set on the raw partition
+#define MAX_BLOCK_SIZE      (64 * 1024)
+#define LAT_SAMPLES         1024            // per-op latencies kept for percentiles
+#define NVS_OPS             500
+
+static uint8_t s_block[MAX_BLOCK_SIZE];
+static uint32_t s_lat[LAT_SAMPLES];
+static size_t s_lat_count;
+
+static void s_lat_reset(void)
+{
+    s_lat_count = 0;
+}
+
+static void s_lat_record(uint32_t us)
+{
+    if (s_lat_count < LAT_SAMPLES) {
+        s_lat[s_lat_count++] = us;
+    }
+}
+
+static int s_lat_cmp(const void *a, const void *b)
+{
+    uint32_t ua = *(const uint32_t *)a;
+    uint32_t ub = *(const uint32_t *)b;
+    return (ua > ub) - (ua < ub);
+}
+
+static uint32_t s_lat_percentile(int percent)
+{
+    if (s_lat_count == 0) {
+        return 0;
+    }
+    size_t idx = (s_lat_count * percent) / 100;
+    return s_lat[idx < s_lat_count ? idx : s_lat_count - 1];
+}
+
+static void s_report(const char *backend, const char *workload, size_t bs, uint64_t bytes, int64_t us, uint32_t ops)
+{
+    qsort(s_lat, s_lat_count, sizeof(uint32_t), s_lat_cmp);
+    printf("storage_bench: {\"backend\":\"%s\",\"workload\":\"%s\",\"bs\":%u,"
+           "\"bytes\":%llu,\"us\":%lld,\"kbps\":%.1f,\"ops\":%" PRIu32 ","
+           "\"p50_us\":%" PRIu32 ",\"p95_us\":%" PRIu32 ",\"p99_us\":%" PRIu32 ",\"max_us\":%" PRIu32 "}\n",
+           backend, workload, (unsigned)bs,
+           (unsigned long long)bytes, (long long)us,
+           us > 0 ? bytes * 1000.0 / us : 0.0, ops,
+           s_lat_percentile(50), s_lat_percentile(95), s_lat_percentile(99),
+           s_lat_count ? s_lat[s_lat_count - 1] : 0);
+}
+
+static uint32_t s_rand_offset(size_t region, size_t bs)
+{
+    uint32_t blocks = region / bs;
+    return (esp_random() % blocks) * bs;
+}
+
+/* ---------------------------------------------------------------------------
+ * Raw esp_partition workloads
+ * ------------------------------------------------------------------------ */
+
+static void s_raw_bench(const esp_partition_t *part, size_t bs)
+{
+    size_t region = RAW_REGION_SIZE < part->size ? RAW_REGION_SIZE : part->size;
+
+    // sequential erase+write: an op is what a log-structured writer pays per block
+    s_lat_reset();
+    uint64_t bytes = 0;
+    uint32_t ops = 0;
+    int64_t start = esp_timer_get_time();
+    for (size_t off = 0; off + bs <= region; off += bs) {
+        int64_t op_start = esp_timer_get_time();
+        ESP_ERROR_CHECK(esp_partition_erase_range(part, off, bs));
+        ESP_ERROR_CHECK(esp_partition_write(part, off, s_block, bs));
+        s_lat_record(esp_timer_get_time() - op_start);
+        bytes += bs;
+        ops++;
+    }
+    s_report("raw", "seq_erase_write", bs, bytes, esp_timer_get_time() - start, ops);
+
+    s_lat_reset();
+    bytes = 0;
+    ops = 0;
+    start = esp_timer_get_time();
+    for (size_t off = 0; off + bs <= region; off += bs) {
+        int64_t op_start = esp_timer_get_time();
+        ESP_ERROR_CHECK(esp_partition_read(part, off, s_block, bs));
+        s_lat_record(esp_timer_get_time() - op_start);
+        bytes += bs;
+        ops++;
+    }
+    s_report("raw", "seq_read", bs, bytes, esp_timer_get_time() - start, ops);
+
+    s_lat_reset();
+    bytes = 0;
+    start = esp_timer_get_time();
+    for (ops = 0; ops < region / bs; ops++) {
+        uint32_t off = s_rand_offset(region, bs);
+        int64_t op_start = esp_timer_get_time();
+        ESP_ERROR_CHECK(esp_partition_read(part, off, s_block, bs));
+        s_lat_record(esp_timer_get_time() - op_start);
+        bytes += bs;
+    }
+    s_report("raw", "rand_read", bs, bytes, esp_timer_get_time() - start, ops);
+}
+
+/* ---------------------------------------------------------------------------
+ * File-based (FatFS / SPIFFS) workloads
+ * ------------------------------------------------------------------------ */
+
+static void s_file_seq_write(const char *backend, const char *path, size_t bs)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        ESP_LOGE(TAG, "%s: can't create %s", backend, path);
+        return;
+    }
+    setvbuf(f, NULL, _IONBF, 0);    // measure the filesystem, not the stdio buffer
+    s_lat_reset();
+    uint64_t bytes = 0;
+    uint32_t ops = 0;
+    int64_t start = esp_timer_get_time();
+    while (bytes + bs <= FILE_SIZE) {
+        int64_t op_start = esp_timer_get_time();
+        if (fwrite(s_block, 1, bs, f) != bs) {
+            break;
+        }
+        s_lat_record(esp_timer_get_time() - op_start);
+        bytes += bs;
+        ops++;
+    }
+    fclose(f);
+    s_report(backend, "seq_write", bs, bytes, esp_timer_get_time() - start, ops);
+}
+
+static void s_file_seq_read(const char *backend, const char *path, size_t bs)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return;
+    }
+    setvbuf(f, NULL, _IONBF, 0);
+    s_lat_reset();
+    uint64_t bytes = 0;
+    uint32_t ops = 0;
+    int64_t start = esp_timer_get_time();
+    while (bytes + bs <= FILE_SIZE) {
+        int64_t op_start = esp_timer_get_time();
+        if (fread(s_block, 1, bs, f) != bs) {
+            break;
+        }
+        s_lat_record(esp_timer_get_time() - op_start);
+        bytes += bs;
+        ops++;
+    }
+    fclose(f);
+    s_report(backend, "seq_read", bs, bytes, esp_timer_get_time() - start, ops);
+}
+
+static void s_file_rand_read(const char *backend, const char *path, size_t bs)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return;
+    }
+    setvbuf(f, NULL, _IONBF, 0);
+    s_lat_reset();
+    uint64_t bytes = 0;
+    uint32_t ops;
+    int64_t start = esp_timer_get_time();
+    for (ops = 0; ops < FILE_SIZE / bs; ops++) {
+        uint32_t off = s_rand_offset(FILE_SIZE, bs);
+        int64_t op_start = esp_timer_get_time();
+        fseek(f, off, SEEK_SET);
+        if (fread(s_block, 1, bs, f) != bs) {
+            break;
+        }
+        s_lat_record(esp_timer_get_time() - op_start);
+        bytes += bs;
+    }
+    fclose(f);
+    s_report(backend, "rand_read", bs, bytes, esp_timer_get_time() - start, ops);
+}
+
+// Random writes and a 50/50 read/write mix over an existing file; FatFS only,
+// SPIFFS rewrites whole pages on overwrite and is not meant for this pattern.
+static void s_file_rand_rw(const char *backend, const char *path, size_t bs, int write_percent, const char *name)
+{
+    FILE *f = fopen(path, "rb+");
+    if (!f) {
+        return;
+    }
+    setvbuf(f, NULL, _IONBF, 0);
+    s_lat_reset();
+    uint64_t bytes = 0;
+    uint32_t ops;
+    int64_t start = esp_timer_get_time();
+    for (ops = 0; ops < FILE_SIZE / bs; ops++) {
+        uint32_t off = s_rand_offset(FILE_SIZE, bs);
+        bool is_write = (int)(esp_random() % 100) < write_percent;
+        int64_t op_start = esp_timer_get_time();
+        fseek(f, off, SEEK_SET);
+        size_t done = is_write ? fwrite(s_block, 1, bs, f) : fread(s_block, 1, bs, f);
+        if (done != bs) {
+            break;
+        }
+        s_lat_record(esp_timer_get_time() - op_start);
+        bytes += bs;
+    }
+    fclose(f);
+    s_report(backend, name, bs, bytes, esp_timer_get_time() - start, ops);
+}
+
+/* ---------------------------------------------------------------------------
+ * NVS workloads
+ * ------------------------------------------------------------------------ */
+
+static void s_nvs_bench(void)
+{
+    nvs_handle_t handle;
+    ESP_ERROR_CHECK(nvs_open("bench", NVS_READWRITE, &handle));
+
+    s_lat_reset();
+    int64_t start = esp_timer_get_time();
+    uint32_t ops;
+    for (ops = 0; ops < NVS_OPS; ops++) {
+        int64_t op_start = esp_timer_get_time();
+        ESP_ERROR_CHECK(nvs_set_u32(handle, "counter", ops));
+        ESP_ERROR_CHECK(nvs_commit(handle));
+        s_lat_record(esp_timer_get_time() - op_start);
+    }
+    s_report("nvs", "set_u32_commit", sizeof(uint32_t), (uint64_t)ops * sizeof(uint32_t),
+             esp_timer_get_time() - start, ops);
+
+    s_lat_reset();
+    start = esp_timer_get_time();
+    for (ops = 0; ops < NVS_OPS; ops++) {
+        uint32_t value;
+        int64_t op_start = esp_timer_get_time();
+        ESP_ERROR_CHECK(nvs_get_u32(handle, "counter", &value));
+        s_lat_record(esp_timer_get_time() - op_start);
+    }
+    s_report("nvs", "get_u32", sizeof(uint32_t), (uint64_t)ops * sizeof(uint32_t),
+             esp_timer_get_time() - start, ops);
+
+    const size_t blob_size = 1024;
+    s_lat_reset();
+    start = esp_timer_get_time();
+    for (ops = 0; ops < 50; ops++) {
+        s_block[0] = ops;   // force a real rewrite, NVS dedups identical blobs
+        int64_t op_start = esp_timer_get_time();
+        ESP_ERROR_CHECK(nvs_set_blob(handle, "blob", s_block, blob_size));
+        ESP_ERROR_CHECK(nvs_commit(handle));
+        s_lat_record(esp_timer_get_time() - op_start);
+    }
+    s_report("nvs", "set_blob_1k", blob_size, (uint64_t)ops * blob_size, esp_timer_get_time() - start, ops);
+
+    s_lat_reset();
+    start = esp_timer_get_time();
+    for (ops = 0; ops < 50; ops++) {
+        size_t length = blob_size;
+        int64_t op_start = esp_timer_get_time();
+        ESP_ERROR_CHECK(nvs_get_blob(handle, "blob", s_block, &length));
+        s_lat_record(esp_timer_get_time() - op_start);
+    }
+    s_report("nvs", "get_blob_1k", blob_size, (uint64_t)ops * blob_size, esp_timer_get_time() - start, ops);
+
+    nvs_close(handle);
+}
+
+/* ------------------------------------------------------------------------ */
+
+static const size_t s_fs_block_sizes[] = { 4096, 16384 };
+static const size_t s_raw_block_sizes[] = { 4096, 16384, 65536 };
+
+void app_main(void)
+{
+    ESP_ERROR_CHECK(nvs_flash_init());
+    for (size_t i = 0; i < sizeof(s_block); i++) {
+        s_block[i] = (uint8_t)i;
+    }
+
+    printf("storage_bench_start\n");
+
+    const esp_partition_t *raw = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                          ESP_PARTITION_SUBTYPE_ANY, "rawbench");
+    if (raw) {
+        for (size_t i = 0; i < sizeof(s_raw_block_sizes) / sizeof(s_raw_block_sizes[0]); i++) {
+            s_raw_bench(raw, s_raw_block_sizes[i]);
+        }
+    } else {
+        ESP_LOGW(TAG, "no 'rawbench' partition, skipping raw workloads");
+    }
+
+    wl_handle_t wl_handle = WL_INVALID_HANDLE;
+    esp_vfs_fat_mount_config_t fat_config = {
+        .format_if_mount_failed = true,
+        .max_files = 4,
+        .allocation_unit_size = 4096,
+    };
+    if (esp_vfs_fat_spiflash_mount_rw_wl("/fat", "storage", &fat_config, &wl_handle) == ESP_OK) {
+        for (size_t i = 0; i < sizeof(s_fs_block_sizes) / sizeof(s_fs_block_sizes[0]); i++) {
+            size_t bs = s_fs_block_sizes[i];
+            s_file_seq_write("fat", "/fat/bench.bin", bs);
+            s_file_seq_read("fat", "/fat/bench.bin", bs);
+            s_file_rand_read("fat", "/fat/bench.bin", bs);
+            s_file_rand_rw("fat", "/fat/bench.bin", bs, 100, "rand_write");
+            s_file_rand_rw("fat", "/fat/bench.bin", bs, 50, "mixed_rw");
+        }
+        unlink("/fat/bench.bin");
+        esp_vfs_fat_spiflash_unmount_rw_wl("/fat", wl_handle);
+    } else {
+        ESP_LOGW(TAG, "FatFS mount failed, skipping fat workloads");
+    }
+
+    esp_vfs_spiffs_conf_t spiffs_config = {
+        .base_path = "/spiffs",
+        .partition_label = "spiffs",
+        .max_files = 4,
+        .format_if_mount_failed = true,
+    };
+    if (esp_vfs_spiffs_register(&spiffs_config) == ESP_OK) {
+        // SPIFFS keeps the whole file in flash twice during rewrite, stay well below capacity
+        for (size_t i = 0; i < sizeof(s_fs_block_sizes) / sizeof(s_fs_block_sizes[0]); i++) {
+            size_t bs = s_fs_block_sizes[i];
+            s_file_seq_write("spiffs", "/spiffs/bench.bin", bs);
+            s_file_seq_read("spiffs", "/spiffs/bench.bin", bs);
+            s_file_rand_read("spiffs", "/spiffs/bench.bin", bs);
+        }
+        unlink("/spiffs/bench.bin");
+        esp_vfs_spiffs_unregister("spiffs");
+    } else {
+        ESP_LOGW(TAG, "SPIFFS mount failed, skipping spiffs workloads");
+    }
+
+    s_nvs_bench();
+
+    printf("storage_bench_end\n");
+}
@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "esp_cpu.h"
+#include "esp_log.h"
+#include "esp_simd.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "simd_bench";
+
+#define MAX_LEN     1024
+#define REPEATS     16
+
+static const size_t s_lengths[] = {64, 256, MAX_LEN};
+
+static int16_t s_a16[MAX_LEN] __attribute__((aligned(16)));
+static int16_t s_b16[MAX_LEN] __attribute__((aligned(16)));
+static int16_t s_o16[MAX_LEN] __attribute__((aligned(16)));
+static float s_af[MAX_LEN] __attribute__((aligned(16)));
+static float s_bf[MAX_LEN] __attribute__((aligned(16)));
+static uint8_t s_src8[MAX_LEN * 4] __attribute__((aligned(16)));
+static uint8_t s_dst8[MAX_LEN * 4] __attribute__((aligned(16)));
+
+static void fill_random(void)
+{
+    for (size_t i = 0; i < MAX_LEN; i++) {
+        s_a16[i] = (int16_t)(rand() & 0xFFFF);
+        s_b16[i] = (int16_t)(rand() & 0xFFFF);
+        s_af[i] = (float)(rand() % 2000 - 1000) / 64.0f;
+        s_bf[i] = (float)(rand() % 2000 - 1000) / 64.0f;
+    }
+    for (size_t i = 0; i < sizeof(s_src8); i++) {
+        s_src8[i] = (uint8_t)rand();
+    }
+}
+
+static void report(const char *kernel, size_t len, uint32_t cycles)
+{
+    printf("%s: impl=%s len=%u cycles/elem=%.2f\n",
+           kernel, esp_simd_impl_name(), (unsigned)len,
+           (float)cycles / (REPEATS * len));
+}
+
+/* Scalar references the kernels are validated against */
+
+static int32_t ref_dotprod_s16(const int16_t *a, const int16_t *b, size_t len, int shift)
+{
+    int64_t acc = 0;
+    for (size_t i = 0; i < len; i++) {
+        acc += (int32_t)a[i] * b[i];
+    }
+    return (int32_t)(acc >> shift);
+}
+
+static void ref_add_sat_s16(const int16_t *a, const int16_t *b, int16_t *out, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        int32_t sum = (int32_t)a[i] + b[i];
+        out[i] = (int16_t)(sum > INT16_MAX ? INT16_MAX : (sum < INT16_MIN ? INT16_MIN : sum));
+    }
+}
+
+static void bench_memcpy(size_t len)
+{
+    size_t bytes = len * sizeof(int16_t);
+    memset(s_o16, 0, bytes);
+    esp_simd_memcpy(s_o16, s_a16, bytes);
+    if (memcmp(s_o16, s_a16, bytes) != 0) {
+        ESP_LOGE(TAG, "memcpy mismatch (len %u)", (unsigned)bytes);
+        return;
+    }
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (int r = 0; r < REPEATS; r++) {
+        esp_simd_memcpy(s_o16, s_a16, bytes);
+    }
+    report("memcpy(bytes)", bytes, esp_cpu_get_cycle_count() - start);
+}
+
+static void bench_fill_s16(size_t len)
+{
+    esp_simd_fill_s16(s_o16, 0x1234, len);
+    for (size_t i = 0; i < len; i++) {
+        if (s_o16[i] != 0x1234) {
+            ESP_LOGE(TAG, "fill_s16 mismatch at %u", (unsigned)i);
+            return;
+        }
+    }
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (int r = 0; r < REPEATS; r++) {
+        esp_simd_fill_s16(s_o16, 0x1234, len);
+    }
+    report("fill_s16", len, esp_cpu_get_cycle_count() - start);
+}
+
+static void bench_dotprod_s16(size_t len)
+{
+    int32_t expected = ref_dotprod_s16(s_a16, s_b16, len, 8);
+    int32_t got = esp_simd_dotprod_s16(s_a16, s_b16, len, 8);
+    if (got != expected) {
+        ESP_LOGE(TAG, "dotprod_s16 mismatch: %ld != %ld", (long)got, (long)expected);
+        return;
+    }
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (int r = 0; r < REPEATS; r++) {
+        got += esp_simd_dotprod_s16(s_a16, s_b16, len, 8);
+    }
+    uint32_t cycles = esp_cpu_get_cycle_count() - start;
+    (void)got;
+    report("dotprod_s16", len, cycles);
+}
+
+static void bench_dotprod_f32(size_t len)
+{
+    float expected = 0;
+    for (size_t i = 0; i < len; i++) {
+        expected += s_af[i] * s_bf[i];
+    }
+    float got = esp_simd_dotprod_f32(s_af, s_bf, len);
+    if (fabsf(got - expected) > fabsf(expected) * 1e-3f + 1e-3f) {
+        ESP_LOGE(TAG, "dotprod_f32 mismatch: %f != %f", got, expected);
+        return;
+    }
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (int r = 0; r < REPEATS; r++) {
+        got += esp_simd_dotprod_f32(s_af, s_bf, len);
+    }
+    uint32_t cycles = esp_cpu_get_cycle_count() - start;
+    (void)got;
+    report("dotprod_f32", len, cycles);
+}
+
+static void bench_add_sat_s16(size_t len)
+{
+    static int16_t ref[MAX_LEN];
+    ref_add_sat_s16(s_a16, s_b16, ref, len);
+    esp_simd_add_sat_s16(s_a16, s_b16, s_o16, len);
+    if (memcmp(ref, s_o16, len * sizeof(int16_t)) != 0) {
+        ESP_LOGE(TAG, "add_sat_s16 mismatch");
+        return;
+    }
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (int r = 0; r < REPEATS; r++) {
+        esp_simd_add_sat_s16(s_a16, s_b16, s_o16, len);
+    }
+    report("add_sat_s16", len, esp_cpu_get_cycle_count() - start);
+}
+
+static void bench_swizzle(size_t len)
+{
+    static const uint8_t bgra_map[4] = {2, 1, 0, 3};
+    esp_simd_swizzle_u8(s_src8, s_dst8, bgra_map, 4, len);
+    for (size_t g = 0; g < len; g++) {
+        for (size_t i = 0; i < 4; i++) {
+            if (s_dst8[g * 4 + i] != s_src8[g * 4 + bgra_map[i]]) {
+                ESP_LOGE(TAG, "swizzle mismatch at group %u", (unsigned)g);
+                return;
+            }
+        }
+    }
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (int r = 0; r < REPEATS; r++) {
+        esp_simd_swizzle_u8(s_src8, s_dst8, bgra_map, 4, len);
+    }
+    report("swizzle_u8(rgba)", len, esp_cpu_get_cycle_count() - start);
+}
+
+static void bench_rgb565(size_t len)
+{
+    uint16_t *dst = (uint16_t *)s_dst8;
+    esp_simd_rgb888_to_rgb565(s_src8, dst, len);
+    for (size_t i = 0; i < len; i++) {
+        const uint8_t *p = &s_src8[i * 3];
+        uint16_t expected = (uint16_t)(((p[0] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[2] >> 3));
+        if (dst[i] != expected) {
+            ESP_LOGE(TAG, "rgb565 mismatch at %u", (unsigned)i);
+            return;
+        }
+    }
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (int r = 0; r < REPEATS; r++) {
+        esp_simd_rgb888_to_rgb565(s_src8, dst, len);
+    }
+    report("rgb888_to_rgb565", len, esp_cpu_get_cycle_count() - start);
+}
+
+void app_main(void)
+{
+    srand(0x5eed);
+    fill_random();
+    printf("esp_simd benchmark, implementation: %s\n", esp_simd_impl_name());
+
+    for (size_t i = 0; i < sizeof(s_lengths) / sizeof(s_lengths[0]); i++) {
+        size_t len = s_lengths[i];
+        bench_memcpy(len);
+        bench_fill_s16(len);
+        bench_dotprod_s16(len);
+        bench_dotprod_f32(len);
+        bench_add_sat_s16(len);
+        bench_swizzle(len);
+        bench_rgb565(len);
+    }
+    printf("esp_simd benchmark done\n");
+}
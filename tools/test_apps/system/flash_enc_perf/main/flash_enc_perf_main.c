@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_partition.h"
+#include "esp_flash_encrypt.h"
+#include "esp_heap_caps.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+
+/* Benchmark for the flash read paths affected by flash encryption. Every
+ * measurement is emitted as one "RESULT: {...}" JSON line so runs with
+ * different sdkconfigs (plain vs encrypted, different cache geometries)
+ * can be scraped and compared mechanically.
+ */
+
+static const char *TAG = "flash_enc_perf";
+
+#define BENCH_REGION_SIZE   (1024 * 1024)   // larger than any cache so a sequential pass misses
+#define PARTITION_READ_TOTAL (256 * 1024)
+#define NVS_OP_ITERATIONS   100
+#define FILL_PATTERN_SEED   0x9E3779B9u
+
+static void report(const char *name, uint64_t bytes, uint64_t us)
+{
+    uint64_t kbps = (us > 0) ? (bytes * 1000000ULL) / (1024ULL * us) : 0;
+    printf("RESULT: {\"name\": \"%s\", \"bytes\": %" PRIu64 ", \"us\": %" PRIu64 ", \"kbps\": %" PRIu64 "}\n",
+           name, bytes, us, kbps);
+}
+
+static void report_latency(const char *name, uint64_t iterations, uint64_t total_us)
+{
+    printf("RESULT: {\"name\": \"%s\", \"iterations\": %" PRIu64 ", \"us\": %" PRIu64 ", \"avg_us\": %" PRIu64 "}\n",
+           name, iterations, total_us, (iterations > 0) ? total_us / iterations : 0);
+}
+
+static uint32_t fill_word(size_t index)
+{
+    // xorshift over the word index: cheap, deterministic, incompressible enough
+    uint32_t x = FILL_PATTERN_SEED ^ (uint32_t)index;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+static const esp_partition_t *prepare_storage_partition(void)
+{
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                           ESP_PARTITION_SUBTYPE_ANY, "storage");
+    if (part == NULL) {
+        ESP_LOGE(TAG, "storage partition not found");
+        return NULL;
+    }
+    uint32_t first_word;
+    ESP_ERROR_CHECK(esp_partition_read(part, 0, &first_word, sizeof(first_word)));
+    if (first_word == fill_word(0)) {
+        return part;    // already filled by a previous run
+    }
+    ESP_LOGI(TAG, "filling storage partition, one-time cost");
+    ESP_ERROR_CHECK(esp_partition_erase_range(part, 0, BENCH_REGION_SIZE));
+    uint32_t *chunk = heap_caps_malloc(4096, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (chunk == NULL) {
+        ESP_LOGE(TAG, "no memory for fill buffer");
+        return NULL;
+    }
+    for (size_t offset = 0; offset < BENCH_REGION_SIZE; offset += 4096) {
+        for (size_t i = 0; i < 4096 / sizeof(uint32_t); i++) {
+            chunk[i] = fill_word(offset / sizeof(uint32_t) + i);
+        }
+        ESP_ERROR_CHECK(esp_partition_write(part, offset, chunk, 4096));
+    }
+    free(chunk);
+    return part;
+}
+
+static uint32_t sum_mapped_region(const volatile uint32_t *words, size_t num_words)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < num_words; i++) {
+        sum += words[i];
+    }
+    return sum;
+}
+
+static void bench_mapped_read(const esp_partition_t *part)
+{
+    const void *ptr;
+    esp_partition_mmap_handle_t handle;
+    ESP_ERROR_CHECK(esp_partition_mmap(part, 0, BENCH_REGION_SIZE, ESP_PARTITION_MMAP_DATA,
+                                       &ptr, &handle));
+
+    // first sequential pass after mapping: dominated by cache misses
+    int64_t start = esp_timer_get_time();
+    uint32_t sum = sum_mapped_region(ptr, BENCH_REGION_SIZE / sizeof(uint32_t));
+    report("mmap_read_cold", BENCH_REGION_SIZE, esp_timer_get_time() - start);
+
+    // second pass: whatever fits stays resident, upper bound for the cache hit path
+    start = esp_timer_get_time();
+    sum += sum_mapped_region(ptr, BENCH_REGION_SIZE / sizeof(uint32_t));
+    report("mmap_read_warm", BENCH_REGION_SIZE, esp_timer_get_time() - start);
+
+    esp_partition_munmap(handle);
+    ESP_LOGD(TAG, "mapped read checksum 0x%08" PRIx32, sum);
+}
+
+static void bench_partition_read(const esp_partition_t *part)
+{
+    static const size_t chunk_sizes[] = { 256, 4096, 16384 };
+    uint8_t *buf = heap_caps_malloc(16384, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (buf == NULL) {
+        ESP_LOGE(TAG, "no memory for read buffer");
+        return;
+    }
+    for (size_t c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); c++) {
+        size_t chunk = chunk_sizes[c];
+        int64_t start = esp_timer_get_time();
+        for (size_t offset = 0; offset < PARTITION_READ_TOTAL; offset += chunk) {
+            ESP_ERROR_CHECK(esp_partition_read(part, offset, buf, chunk));
+        }
+        char name[48];
+        snprintf(name, sizeof(name), "partition_read_%uB", (unsigned) chunk);
+        report(name, PARTITION_READ_TOTAL, esp_timer_get_time() - start);
+    }
+    free(buf);
+}
+
+static void bench_nvs_ops(void)
+{
+    esp_err_t err = nvs_flash_init();
+    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        err = nvs_flash_init();
+    }
+    ESP_ERROR_CHECK(err);
+
+    nvs_handle_t handle;
+    ESP_ERROR_CHECK(nvs_open("perf", NVS_READWRITE, &handle));
+
+    uint64_t set_us = 0;
+    uint64_t commit_us = 0;
+    uint64_t get_us = 0;
+    for (uint32_t i = 0; i < NVS_OP_ITERATIONS; i++) {
+        int64_t start = esp_timer_get_time();
+        ESP_ERROR_CHECK(nvs_set_u32(handle, "bench", i));
+        set_us += esp_timer_get_time() - start;
+
+        start = esp_timer_get_time();
+        ESP_ERROR_CHECK(nvs_commit(handle));
+        commit_us += esp_timer_get_time() - start;
+
+        uint32_t value;
+        start = esp_timer_get_time();
+        ESP_ERROR_CHECK(nvs_get_u32(handle, "bench", &value));
+        get_us += esp_timer_get_time() - start;
+    }
+    nvs_close(handle);
+
+    report_latency("nvs_set_u32", NVS_OP_ITERATIONS, set_us);
+    report_latency("nvs_commit", NVS_OP_ITERATIONS, commit_us);
+    report_latency("nvs_get_u32", NVS_OP_ITERATIONS, get_us);
+}
+
+void app_main(void)
+{
+    printf("RESULT: {\"name\": \"config\", \"target\": \"%s\", \"flash_encryption\": %d}\n",
+           CONFIG_IDF_TARGET, esp_flash_encryption_enabled() ? 1 : 0);
+
+    const esp_partition_t *part = prepare_storage_partition();
+    if (part == NULL) {
+        return;
+    }
+    bench_mapped_read(part);
+    bench_partition_read(part);
+    bench_nvs_ops();
+    printf("flash_enc_perf: done\n");
+}